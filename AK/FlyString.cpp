@@ -5,7 +5,7 @@
  */
 
 #include <AK/FlyString.h>
-#include <AK/HashTable.h>
+#include <AK/ShardedHashTable.h>
 #include <AK/Singleton.h>
 #include <AK/String.h>
 #include <AK/StringData.h>
@@ -22,18 +22,30 @@ struct FlyStringTableHashTraits : public Traits<Detail::StringData const*> {
 
 static auto& all_fly_strings()
 {
-    static Singleton<HashTable<Detail::StringData const*, FlyStringTableHashTraits>> table;
+    static Singleton<ShardedHashTable<Detail::StringData const*, FlyStringTableHashTraits>> table;
     return *table;
 }
 
+// NB: The reference to a string we find must be taken while its shard is still locked, so that another thread can't
+//     remove the string from the table in between.
+static Optional<Detail::StringBase> find_fly_string_data(StringView string)
+{
+    auto hash = string.hash();
+    return all_fly_strings().with_shard_for_hash(hash, [&](auto& table) -> Optional<Detail::StringBase> {
+        if (auto it = table.find(hash, [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != table.end())
+            return Detail::StringBase(**it);
+        return {};
+    });
+}
+
 ErrorOr<FlyString> FlyString::from_utf8(StringView string)
 {
     if (string.is_empty())
         return FlyString {};
     if (string.length() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { TRY(String::from_utf8(string)) };
-    if (auto it = all_fly_strings().find(string.hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto data = find_fly_string_data(string); data.has_value())
+        return FlyString { data.release_value() };
     return FlyString { TRY(String::from_utf8(string)) };
 }
 
@@ -43,8 +55,8 @@ FlyString FlyString::from_utf8_without_validation(ReadonlyBytes string)
         return FlyString {};
     if (string.size() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { String::from_utf8_without_validation(string) };
-    if (auto it = all_fly_strings().find(StringView(string).hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto data = find_fly_string_data(StringView { string }); data.has_value())
+        return FlyString { data.release_value() };
     return FlyString { String::from_utf8_without_validation(string) };
 }
 
@@ -62,15 +74,18 @@ FlyString::FlyString(String const& string)
         return;
     }
 
-    auto it = all_fly_strings().find(string.m_impl.data);
-    if (it == all_fly_strings().end()) {
-        m_data = string;
-        all_fly_strings().set(string.m_impl.data);
-        string.m_impl.data->set_fly_string(true);
-    } else {
-        m_data.m_impl.data = *it;
-        m_data.m_impl.data->ref();
-    }
+    auto const* data = string.m_impl.data;
+    all_fly_strings().with_shard_for_hash(data->hash(), [&](auto& table) {
+        auto it = table.find(data);
+        if (it == table.end()) {
+            m_data = string;
+            table.set(data);
+            data->set_fly_string(true);
+        } else {
+            m_data.m_impl.data = *it;
+            m_data.m_impl.data->ref();
+        }
+    });
 }
 
 FlyString& FlyString::operator=(String const& string)
@@ -209,7 +224,9 @@ namespace Detail {
 
 void did_destroy_fly_string_data(Badge<Detail::StringData>, Detail::StringData const& string_data)
 {
-    all_fly_strings().remove(&string_data);
+    all_fly_strings().with_shard_for_hash(string_data.hash(), [&](auto& table) {
+        table.remove(&string_data);
+    });
 }
 
 }
@@ -108,12 +108,18 @@ class HashTable;
 template<typename T, typename TraitsForT = Traits<T>>
 using OrderedHashTable = HashTable<T, TraitsForT, true>;
 
-template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>, bool IsOrdered = false>
+template<typename T, typename TraitsForT = Traits<T>, bool IsOrdered = false>
+class GroupedHashTable;
+
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>, bool IsOrdered = false, template<typename, typename, bool> typename HashTableTemplate = HashTable>
 class HashMap;
 
 template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
 using OrderedHashMap = HashMap<K, V, KeyTraits, ValueTraits, true>;
 
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
+using GroupedHashMap = HashMap<K, V, KeyTraits, ValueTraits, false, GroupedHashTable>;
+
 template<typename T>
 class Badge;
 
@@ -201,6 +207,8 @@ using AK::FixedArray;
 using AK::FlyString;
 using AK::Function;
 using AK::GenericLexer;
+using AK::GroupedHashMap;
+using AK::GroupedHashTable;
 using AK::HashMap;
 using AK::HashTable;
 using AK::IPv4Address;
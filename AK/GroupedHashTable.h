@@ -0,0 +1,639 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BitCast.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/Concepts.h>
+#include <AK/Error.h>
+#include <AK/HashTable.h>
+#include <AK/IntegralMath.h>
+#include <AK/Optional.h>
+#include <AK/SIMD.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Traits.h>
+#include <AK/TypedTransfer.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+#include <AK/kmalloc.h>
+
+namespace AK {
+
+namespace Detail {
+
+// The control bytes of a group of consecutive slots in a GroupedHashTable, which are all compared at once.
+class HashTableGroup {
+public:
+    static constexpr size_t size = 16;
+
+    // The slots of a group that matched, which are visited from the first slot to the last.
+    class Mask {
+    public:
+        explicit Mask(u64 bits)
+            : m_bits(bits)
+        {
+        }
+
+        [[nodiscard]] bool is_empty() const { return m_bits == 0; }
+        [[nodiscard]] size_t first() const { return count_trailing_zeroes(m_bits) / bits_per_slot; }
+        void remove_first() { m_bits &= m_bits - 1; }
+
+    private:
+        u64 m_bits { 0 };
+    };
+
+    explicit HashTableGroup(u8 const* control)
+        : m_control(SIMD::load_unaligned<SIMD::i8x16>(control))
+    {
+    }
+
+    [[nodiscard]] Mask match(u8 control) const { return to_mask(m_control == splat(static_cast<i8>(control))); }
+    [[nodiscard]] Mask match_empty() const { return match(empty_control); }
+    [[nodiscard]] Mask match_empty_or_deleted() const { return to_mask(m_control < splat(0)); }
+
+    // Used slots store the low 7 bits of their hash, so free slots are the ones with the high bit set.
+    static constexpr u8 empty_control = 0x80;
+    static constexpr u8 deleted_control = 0xfe;
+    static constexpr bool is_used(u8 control) { return (control & 0x80) == 0; }
+
+private:
+#if defined(__SSE2__)
+    static constexpr size_t bits_per_slot = 1;
+#else
+    static constexpr size_t bits_per_slot = 4;
+#endif
+
+    static ALWAYS_INLINE SIMD::i8x16 splat(i8 value) { return SIMD::i8x16 {} + value; }
+
+    static ALWAYS_INLINE Mask to_mask(SIMD::i8x16 comparison)
+    {
+#if defined(__SSE2__)
+        return Mask(static_cast<u16>(__builtin_ia32_pmovmskb128((SIMD::c8x16)comparison)));
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        // NB: There is no movemask instruction on NEON, but shifting every pair of slots right by 4 and narrowing them
+        //     back to bytes leaves 4 bits for each slot, of which we keep one.
+        auto nibbles = __builtin_convertvector((SIMD::u16x8)comparison >> 4, SIMD::u8x8);
+        return Mask(bit_cast<u64>(nibbles) & 0x8888888888888888ull);
+#else
+        u64 bits = 0;
+        for (size_t i = 0; i < size; ++i) {
+            if (comparison[i])
+                bits |= 0x8ull << (i * bits_per_slot);
+        }
+        return Mask(bits);
+#endif
+    }
+
+    SIMD::i8x16 m_control;
+};
+
+}
+
+template<typename HashTableType, typename T>
+class GroupedHashTableIterator {
+    friend HashTableType;
+
+public:
+    bool operator==(GroupedHashTableIterator const& other) const { return m_slot == other.m_slot; }
+    bool operator!=(GroupedHashTableIterator const& other) const { return m_slot != other.m_slot; }
+    T& operator*() { return *m_slot; }
+    T* operator->() { return m_slot; }
+    void operator++() { skip_to_next(); }
+
+private:
+    void skip_to_next()
+    {
+        if (!m_slot)
+            return;
+        do {
+            ++m_slot;
+            ++m_control;
+            if (m_slot == m_end_slot) {
+                m_slot = nullptr;
+                return;
+            }
+        } while (!Detail::HashTableGroup::is_used(*m_control));
+    }
+
+    GroupedHashTableIterator(u8 const* control, T* slot, T* end_slot)
+        : m_control(control)
+        , m_slot(slot)
+        , m_end_slot(end_slot)
+    {
+    }
+
+    u8 const* m_control { nullptr };
+    T* m_slot { nullptr };
+    T* m_end_slot { nullptr };
+};
+
+// A set datastructure based on a hash table with open addressing, with the same interface as HashTable.
+// Next to the slots, every slot has a control byte which tells whether the slot is free, and if it is not, holds 7 bits
+// of the hash of its value. A lookup compares the control bytes of 16 slots at once, and only calls the (potentially
+// slow) equality check for the slots whose control byte matches. This makes lookups in large tables and lookups of
+// values that are not in the table much cheaper than in HashTable, which checks the buckets one by one.
+// Values are not moved around once inserted, so removing a value leaves a tombstone behind instead.
+// For a map datastructure with key-value entries, see GroupedHashMap.
+template<typename T, typename TraitsForT, bool IsOrdered>
+class GroupedHashTable {
+    static_assert(!IsOrdered, "GroupedHashTable does not support ordered iteration, use OrderedHashTable instead");
+
+    using Group = Detail::HashTableGroup;
+
+    static constexpr size_t minimum_capacity = Group::size;
+
+    // Since a lookup stops at the first group with a free slot, we can fill the table up more than HashTable.
+    static constexpr size_t grow_at_load_factor_eighths = 7;
+
+    // Visits every group of the table once, with the distance between the groups growing by one group on each step.
+    class ProbeSequence {
+    public:
+        ProbeSequence(u32 hash, size_t group_mask)
+            : m_group_mask(group_mask)
+            , m_group_index((hash >> 7) & group_mask)
+        {
+        }
+
+        size_t offset() const { return m_group_index * Group::size; }
+        void next()
+        {
+            ++m_stride;
+            m_group_index = (m_group_index + m_stride) & m_group_mask;
+        }
+
+    private:
+        size_t m_group_mask { 0 };
+        size_t m_group_index { 0 };
+        size_t m_stride { 0 };
+    };
+
+public:
+    GroupedHashTable() = default;
+    explicit GroupedHashTable(size_t capacity) { MUST(try_rehash(capacity)); }
+
+    ~GroupedHashTable()
+    {
+        if (!m_control)
+            return;
+
+        if constexpr (!IsTriviallyDestructible<T>) {
+            for (size_t i = 0; i < m_capacity; ++i) {
+                if (Group::is_used(m_control[i]))
+                    m_slots[i].~T();
+            }
+        }
+
+        kfree_sized(m_control, size_in_bytes(m_capacity));
+    }
+
+    GroupedHashTable(GroupedHashTable const& other)
+    {
+        MUST(try_ensure_capacity(other.size()));
+        for (auto& it : other)
+            set(it);
+    }
+
+    GroupedHashTable& operator=(GroupedHashTable const& other)
+    {
+        GroupedHashTable temporary(other);
+        swap(*this, temporary);
+        return *this;
+    }
+
+    GroupedHashTable(GroupedHashTable&& other) noexcept
+        : m_control(exchange(other.m_control, nullptr))
+        , m_slots(exchange(other.m_slots, nullptr))
+        , m_capacity(exchange(other.m_capacity, 0))
+        , m_size(exchange(other.m_size, 0))
+        , m_deleted(exchange(other.m_deleted, 0))
+    {
+    }
+
+    GroupedHashTable& operator=(GroupedHashTable&& other) noexcept
+    {
+        GroupedHashTable temporary { move(other) };
+        swap(*this, temporary);
+        return *this;
+    }
+
+    friend void swap(GroupedHashTable& a, GroupedHashTable& b) noexcept
+    {
+        swap(a.m_control, b.m_control);
+        swap(a.m_slots, b.m_slots);
+        swap(a.m_capacity, b.m_capacity);
+        swap(a.m_size, b.m_size);
+        swap(a.m_deleted, b.m_deleted);
+    }
+
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+
+    ErrorOr<void> try_ensure_capacity(size_t capacity)
+    {
+        // NB: Like in HashTable, "capacity" is the number of values that can be stored without reallocating.
+        size_t required_capacity = (capacity * 8 / grow_at_load_factor_eighths) + 1;
+        if (required_capacity <= m_capacity)
+            return {};
+        return try_rehash(required_capacity);
+    }
+    void ensure_capacity(size_t capacity)
+    {
+        MUST(try_ensure_capacity(capacity));
+    }
+
+    [[nodiscard]] bool contains(T const& value) const
+    {
+        return find(value) != end();
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] bool contains(K const& value) const
+    {
+        return find(value) != end();
+    }
+
+    using Iterator = GroupedHashTableIterator<GroupedHashTable, T>;
+    using ConstIterator = GroupedHashTableIterator<GroupedHashTable const, T const>;
+
+    [[nodiscard]] Iterator begin()
+    {
+        if (auto index = first_used_index(); index < m_capacity)
+            return Iterator(&m_control[index], &m_slots[index], &m_slots[m_capacity]);
+        return end();
+    }
+
+    [[nodiscard]] Iterator end()
+    {
+        return Iterator(nullptr, nullptr, nullptr);
+    }
+
+    [[nodiscard]] ConstIterator begin() const
+    {
+        if (auto index = first_used_index(); index < m_capacity)
+            return ConstIterator(&m_control[index], &m_slots[index], &m_slots[m_capacity]);
+        return end();
+    }
+
+    [[nodiscard]] ConstIterator end() const
+    {
+        return ConstIterator(nullptr, nullptr, nullptr);
+    }
+
+    void clear()
+    {
+        *this = GroupedHashTable();
+    }
+
+    void clear_with_capacity()
+    {
+        if (!m_control)
+            return;
+
+        if constexpr (!IsTriviallyDestructible<T>) {
+            for (auto& value : *this)
+                value.~T();
+        }
+        __builtin_memset(m_control, Group::empty_control, m_capacity);
+        m_size = 0;
+        m_deleted = 0;
+    }
+
+    template<typename U = T>
+    ErrorOr<HashSetResult> try_set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        if (should_grow())
+            TRY(try_grow());
+
+        return write_value(forward<U>(value), existing_entry_behavior);
+    }
+    template<typename U = T>
+    HashSetResult set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        return MUST(try_set(forward<U>(value), existing_entry_behavior));
+    }
+
+    template<typename TUnaryPredicate, typename InitializationCallback>
+    [[nodiscard]] T& ensure(unsigned hash, TUnaryPredicate predicate, InitializationCallback initialization_callback, HashSetExistingEntryBehavior existing_entry_behavior)
+    {
+        if (should_grow())
+            MUST(try_grow());
+
+        auto [result, slot] = lookup_for_writing(hash, move(predicate), existing_entry_behavior);
+        switch (result) {
+        case HashSetResult::InsertedNewEntry:
+            new (&slot) T(initialization_callback());
+            break;
+        case HashSetResult::ReplacedExistingEntry:
+            slot = T(initialization_callback());
+            break;
+        case HashSetResult::KeptExistingEntry:
+            break;
+        default:
+            __builtin_unreachable();
+        }
+        return slot;
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] Iterator find(unsigned hash, TUnaryPredicate predicate)
+    {
+        auto* slot = lookup_with_hash(hash, move(predicate));
+        if (!slot)
+            return end();
+        return Iterator(&m_control[slot - m_slots], slot, &m_slots[m_capacity]);
+    }
+
+    [[nodiscard]] Iterator find(T const& value)
+    {
+        if (is_empty())
+            return end();
+        return find(TraitsForT::hash(value), [&](auto& entry) { return TraitsForT::equals(entry, value); });
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] ConstIterator find(unsigned hash, TUnaryPredicate predicate) const
+    {
+        auto* slot = lookup_with_hash(hash, move(predicate));
+        if (!slot)
+            return end();
+        return ConstIterator(&m_control[slot - m_slots], slot, &m_slots[m_capacity]);
+    }
+
+    [[nodiscard]] ConstIterator find(T const& value) const
+    {
+        if (is_empty())
+            return end();
+        return find(TraitsForT::hash(value), [&](auto& entry) { return TraitsForT::equals(entry, value); });
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] Iterator find(K const& value)
+    {
+        if (is_empty())
+            return end();
+        return find(Traits<K>::hash(value), [&](auto& entry) { return Traits<T>::equals(entry, value); });
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] ConstIterator find(K const& value) const
+    {
+        if (is_empty())
+            return end();
+        return find(Traits<K>::hash(value), [&](auto& entry) { return Traits<T>::equals(entry, value); });
+    }
+
+    bool remove(T const& value)
+    {
+        auto it = find(value);
+        if (it != end()) {
+            remove(it);
+            return true;
+        }
+        return false;
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) bool remove(K const& value)
+    {
+        auto it = find(value);
+        if (it != end()) {
+            remove(it);
+            return true;
+        }
+        return false;
+    }
+
+    // This invalidates the iterator
+    void remove(Iterator& iterator)
+    {
+        VERIFY(iterator.m_slot);
+        delete_slot(iterator.m_slot - m_slots);
+        iterator.m_slot = nullptr;
+    }
+
+    template<typename TUnaryPredicate>
+    bool remove_all_matching(TUnaryPredicate const& predicate)
+    {
+        bool has_removed_anything = false;
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (!Group::is_used(m_control[i]) || !predicate(m_slots[i]))
+                continue;
+
+            delete_slot(i);
+            has_removed_anything = true;
+        }
+        return has_removed_anything;
+    }
+
+    template<typename TUnaryPredicate>
+    Vector<T> take_all_matching(TUnaryPredicate const& predicate)
+    {
+        Vector<T> values;
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (!Group::is_used(m_control[i]) || !predicate(m_slots[i]))
+                continue;
+
+            values.append(move(m_slots[i]));
+            delete_slot(i);
+        }
+        return values;
+    }
+
+    [[nodiscard]] Vector<T> values() const
+    {
+        Vector<T> list;
+        list.ensure_capacity(size());
+        for (auto& value : *this)
+            list.unchecked_append(value);
+        return list;
+    }
+
+private:
+    static constexpr size_t slots_offset(size_t capacity) { return round_up_to_power_of_two(capacity, alignof(T)); }
+    static constexpr size_t size_in_bytes(size_t capacity) { return slots_offset(capacity) + sizeof(T) * capacity; }
+    static constexpr u8 control_for_hash(u32 hash) { return hash & 0x7f; }
+
+    size_t group_mask() const { return (m_capacity / Group::size) - 1; }
+
+    // NB: Tombstones count towards the load factor, since lookups have to go past them just like past used slots.
+    bool should_grow() const { return ((m_size + m_deleted + 1) * 8) > (m_capacity * grow_at_load_factor_eighths); }
+
+    ErrorOr<void> try_grow()
+    {
+        // If most of the load is made up of tombstones, get rid of them instead of making the table larger.
+        if (m_capacity != 0 && (m_size + 1) * 16 <= m_capacity * grow_at_load_factor_eighths)
+            return try_rehash(m_capacity);
+        return try_rehash(m_capacity * 2);
+    }
+
+    size_t first_used_index() const
+    {
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (Group::is_used(m_control[i]))
+                return i;
+        }
+        return m_capacity;
+    }
+
+    ErrorOr<void> try_rehash(size_t new_capacity)
+    {
+        new_capacity = AK::exp2<size_t>(AK::ceil_log2(max(new_capacity, minimum_capacity)));
+        VERIFY(m_size * 8 < new_capacity * grow_at_load_factor_eighths);
+
+        auto* new_storage = static_cast<u8*>(kmalloc(size_in_bytes(new_capacity)));
+        if (!new_storage)
+            return Error::from_errno(ENOMEM);
+        __builtin_memset(new_storage, Group::empty_control, new_capacity);
+
+        auto* old_control = exchange(m_control, new_storage);
+        auto* old_slots = exchange(m_slots, reinterpret_cast<T*>(new_storage + slots_offset(new_capacity)));
+        auto old_capacity = exchange(m_capacity, new_capacity);
+        m_deleted = 0;
+
+        if (!old_control)
+            return {};
+
+        // NB: The values in the old table are all different, so they can be moved into free slots without looking
+        //     them up first.
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (!Group::is_used(old_control[i]))
+                continue;
+            auto hash = TraitsForT::hash(old_slots[i]);
+            auto index = find_free_index(hash);
+            m_control[index] = control_for_hash(hash);
+            TypedTransfer<T>::relocate(&m_slots[index], &old_slots[i], 1);
+        }
+
+        kfree_sized(old_control, size_in_bytes(old_capacity));
+        return {};
+    }
+
+    size_t find_free_index(u32 hash) const
+    {
+        ProbeSequence probe { hash, group_mask() };
+        for (;;) {
+            auto free_slots = Group { &m_control[probe.offset()] }.match_empty_or_deleted();
+            if (!free_slots.is_empty())
+                return probe.offset() + free_slots.first();
+            probe.next();
+        }
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] T* lookup_with_hash(u32 hash, TUnaryPredicate predicate) const
+    {
+        if (is_empty())
+            return nullptr;
+
+        auto control = control_for_hash(hash);
+        ProbeSequence probe { hash, group_mask() };
+        for (;;) {
+            Group group { &m_control[probe.offset()] };
+            for (auto matches = group.match(control); !matches.is_empty(); matches.remove_first()) {
+                auto* slot = &m_slots[probe.offset() + matches.first()];
+                if (predicate(*slot))
+                    return slot;
+            }
+
+            // A value is never inserted past a group that has an empty slot, so it can't be in any later group.
+            if (!group.match_empty().is_empty())
+                return nullptr;
+            probe.next();
+        }
+    }
+
+    struct LookupForWritingResult {
+        HashSetResult result;
+        T& slot;
+    };
+
+    template<typename TUnaryPredicate>
+    ALWAYS_INLINE LookupForWritingResult lookup_for_writing(u32 hash, TUnaryPredicate predicate, HashSetExistingEntryBehavior existing_entry_behavior)
+    {
+        auto control = control_for_hash(hash);
+        Optional<size_t> free_index;
+        ProbeSequence probe { hash, group_mask() };
+        for (;;) {
+            Group group { &m_control[probe.offset()] };
+            for (auto matches = group.match(control); !matches.is_empty(); matches.remove_first()) {
+                auto& slot = m_slots[probe.offset() + matches.first()];
+                if (predicate(slot)) {
+                    if (existing_entry_behavior == HashSetExistingEntryBehavior::Replace)
+                        return { HashSetResult::ReplacedExistingEntry, slot };
+                    return { HashSetResult::KeptExistingEntry, slot };
+                }
+            }
+
+            // Reuse the first free slot we come across, but keep looking for an existing value until we reach a group
+            // with an empty slot.
+            if (!free_index.has_value()) {
+                if (auto free_slots = group.match_empty_or_deleted(); !free_slots.is_empty())
+                    free_index = probe.offset() + free_slots.first();
+            }
+            if (!group.match_empty().is_empty())
+                break;
+            probe.next();
+        }
+
+        if (m_control[*free_index] == Group::deleted_control)
+            --m_deleted;
+        m_control[*free_index] = control;
+        ++m_size;
+        return { HashSetResult::InsertedNewEntry, m_slots[*free_index] };
+    }
+
+    template<typename U = T>
+    ALWAYS_INLINE HashSetResult write_value(U&& value, HashSetExistingEntryBehavior existing_entry_behavior)
+    {
+        u32 const hash = TraitsForT::hash(value);
+        auto [result, slot] = lookup_for_writing(hash, [&](auto& candidate) { return TraitsForT::equals(candidate, static_cast<T const&>(value)); }, existing_entry_behavior);
+        switch (result) {
+        case HashSetResult::ReplacedExistingEntry:
+            slot = forward<U>(value);
+            break;
+        case HashSetResult::InsertedNewEntry:
+            new (&slot) T(forward<U>(value));
+            break;
+        case HashSetResult::KeptExistingEntry:
+            break;
+        default:
+            __builtin_unreachable();
+        }
+        return result;
+    }
+
+    void delete_slot(size_t index)
+    {
+        VERIFY(Group::is_used(m_control[index]));
+
+        m_slots[index].~T();
+        --m_size;
+
+        // If the group of this slot has an empty slot, it was never full, so no lookup ever continued past it and we can
+        // mark this slot as empty as well. Otherwise, lookups must not stop at this slot, so we leave a tombstone.
+        auto group_offset = index & ~(Group::size - 1);
+        if (!Group { &m_control[group_offset] }.match_empty().is_empty()) {
+            m_control[index] = Group::empty_control;
+        } else {
+            m_control[index] = Group::deleted_control;
+            ++m_deleted;
+        }
+    }
+
+    u8* m_control { nullptr };
+    T* m_slots { nullptr };
+    size_t m_capacity { 0 };
+    size_t m_size { 0 };
+    size_t m_deleted { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::GroupedHashTable;
+#endif
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/GroupedHashTable.h>
 #include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/Vector.h>
@@ -17,7 +18,8 @@ namespace AK {
 // A map datastructure, mapping keys K to values V, based on a hash table with closed hashing.
 // HashMap can optionally provide ordered iteration based on the order of keys when IsOrdered = true.
 // HashMap is based on HashTable, which should be used instead if just a set datastructure is required.
-template<typename K, typename V, typename KeyTraits, typename ValueTraits, bool IsOrdered>
+// GroupedHashMap is a HashMap that is based on GroupedHashTable instead, which is faster to look up values in.
+template<typename K, typename V, typename KeyTraits, typename ValueTraits, bool IsOrdered, template<typename, typename, bool> typename HashTableTemplate>
 class HashMap {
 private:
     struct Entry {
@@ -108,7 +110,7 @@ public:
         });
     }
 
-    using HashTableType = HashTable<Entry, EntryTraits, IsOrdered>;
+    using HashTableType = HashTableTemplate<Entry, EntryTraits, IsOrdered>;
     using IteratorType = typename HashTableType::Iterator;
     using ConstIteratorType = typename HashTableType::ConstIterator;
 
@@ -302,9 +304,9 @@ public:
     }
 
     template<typename NewKeyTraits = KeyTraits, typename NewValueTraits = ValueTraits, bool NewIsOrdered = IsOrdered>
-    ErrorOr<HashMap<K, V, NewKeyTraits, NewValueTraits, NewIsOrdered>> clone() const
+    ErrorOr<HashMap<K, V, NewKeyTraits, NewValueTraits, NewIsOrdered, HashTableTemplate>> clone() const
     {
-        HashMap<K, V, NewKeyTraits, NewValueTraits, NewIsOrdered> hash_map_clone;
+        HashMap<K, V, NewKeyTraits, NewValueTraits, NewIsOrdered, HashTableTemplate> hash_map_clone;
         TRY(hash_map_clone.try_ensure_capacity(size()));
         for (auto const& [key, value] : *this)
             hash_map_clone.set(key, value);
@@ -339,6 +341,7 @@ private:
 }
 
 #if USING_AK_GLOBALLY
+using AK::GroupedHashMap;
 using AK::HashMap;
 using AK::OrderedHashMap;
 #endif
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/HashTable.h>
+#include <AK/Noncopyable.h>
+#include <AK/StdLibExtras.h>
+
+namespace AK {
+
+// A set datastructure that can be used from multiple threads at once. The values are spread over a number of shards by
+// their hash, each of which is a HashTable with its own lock, so that threads only wait for each other when they happen
+// to use the same shard at the same time.
+template<typename T, typename TraitsForT = Traits<T>, size_t ShardCount = 16>
+class ShardedHashTable {
+    AK_MAKE_NONCOPYABLE(ShardedHashTable);
+    AK_MAKE_NONMOVABLE(ShardedHashTable);
+
+    static_assert(is_power_of_two(ShardCount) && ShardCount <= 256);
+
+public:
+    using Table = HashTable<T, TraitsForT>;
+
+    ShardedHashTable() = default;
+
+    // Calls the callback with the shard that values with the given hash belong to. No other thread can use that shard
+    // until the callback returns, so the callback must not use this table itself.
+    template<typename Callback>
+    decltype(auto) with_shard_for_hash(u32 hash, Callback callback)
+    {
+        auto& shard = m_shards[shard_index_for_hash(hash)];
+        Locker locker { shard.lock };
+        return callback(shard.table);
+    }
+
+    [[nodiscard]] size_t size()
+    {
+        size_t size = 0;
+        for (auto& shard : m_shards) {
+            Locker locker { shard.lock };
+            size += shard.table.size();
+        }
+        return size;
+    }
+
+private:
+    // NB: HashTable picks the bucket of a value by the low bits of its hash, so we pick the shard by the high bits.
+    static constexpr size_t shard_index_for_hash(u32 hash) { return (hash >> 24) & (ShardCount - 1); }
+
+    // NB: The shards are only ever locked for a single lookup or change of their table, so spinning is cheaper than
+    //     asking the kernel to put us to sleep.
+    class Lock {
+    public:
+        void lock()
+        {
+            while (m_is_locked.exchange(true, AK::memory_order_acquire)) {
+                while (m_is_locked.load(AK::memory_order_relaxed))
+                    atomic_pause();
+            }
+        }
+
+        void unlock() { m_is_locked.store(false, AK::memory_order_release); }
+
+    private:
+        Atomic<bool> m_is_locked { false };
+    };
+
+    class Locker {
+        AK_MAKE_NONCOPYABLE(Locker);
+        AK_MAKE_NONMOVABLE(Locker);
+
+    public:
+        explicit Locker(Lock& lock)
+            : m_lock(lock)
+        {
+            m_lock.lock();
+        }
+
+        ~Locker() { m_lock.unlock(); }
+
+    private:
+        Lock& m_lock;
+    };
+
+    struct Shard {
+        Lock lock;
+        Table table;
+    };
+
+    Array<Shard, ShardCount> m_shards;
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::ShardedHashTable;
+#endif
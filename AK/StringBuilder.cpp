@@ -135,9 +135,20 @@ ErrorOr<void> StringBuilder::try_append(StringView string)
     } else {
         TRY(ensure_storage_is_utf16());
 
+        // A UTF-8 string never has more code units in UTF-16 than it has bytes in UTF-8.
         TRY(will_append(string.length() * 2));
-        for (auto code_point : Utf8View { string })
-            TRY(try_append_code_point(code_point));
+
+        // Fast path.
+        auto* uninitialized_data_pointer = reinterpret_cast<char16_t*>(m_buffer.end_pointer());
+        auto result = simdutf::convert_utf8_to_utf16_with_errors(string.characters_without_null_termination(), string.length(), uninitialized_data_pointer);
+
+        if (result.error == simdutf::SUCCESS) {
+            m_buffer.set_size(m_buffer.size() + result.count * 2);
+        } else {
+            // Slow path. The string is not valid UTF-8, or contains lonely surrogates, which Utf8View handles for us.
+            for (auto code_point : Utf8View { string })
+                TRY(try_append_code_point(code_point));
+        }
     }
 
     return {};
@@ -156,14 +167,14 @@ ErrorOr<void> StringBuilder::try_append_ascii_without_validation(ReadonlyBytes s
     if (m_mode == Mode::UTF8 || m_utf16_builder_is_ascii) {
         TRY(m_buffer.try_append(string));
     } else {
-        if (m_mode == Mode::UTF16) {
-            TRY(ensure_storage_is_utf16());
-            TRY(will_append(string.size() * 2));
-        } else {
-            TRY(will_append(string.size()));
-        }
-        for (auto code_point : Utf8View { string })
-            TRY(try_append_code_point(code_point));
+        TRY(will_append(string.size() * 2));
+
+        // NB: ASCII is a subset of Latin-1, so the widening conversion of the latter gives us UTF-16 as well.
+        auto* uninitialized_data_pointer = reinterpret_cast<char16_t*>(m_buffer.end_pointer());
+        auto code_unit_length = simdutf::convert_latin1_to_utf16(reinterpret_cast<char const*>(string.data()), string.size(), uninitialized_data_pointer);
+        VERIFY(code_unit_length == string.size());
+
+        m_buffer.set_size(m_buffer.size() + code_unit_length * 2);
     }
 
     return {};
@@ -444,10 +455,10 @@ ErrorOr<void> StringBuilder::try_append(Utf16View const& utf16_view)
 
     if (!append_as_utf8) {
         TRY(ensure_storage_is_utf16());
-        TRY(will_append(utf16_view.length_in_code_units() * 2));
 
-        for (size_t i = 0; i < utf16_view.length_in_code_units(); ++i)
-            TRY(try_append_code_unit(utf16_view.code_unit_at(i)));
+        auto utf16_span = utf16_view.utf16_span();
+        TRY(will_append(utf16_span.size() * 2));
+        TRY(m_buffer.try_append(utf16_span.data(), utf16_span.size() * 2));
 
         return {};
     }
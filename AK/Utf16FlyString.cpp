@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/HashTable.h>
+#include <AK/ShardedHashTable.h>
 #include <AK/Singleton.h>
 #include <AK/Utf16FlyString.h>
 
@@ -18,7 +18,7 @@ struct Utf16FlyStringTableHashTraits : public Traits<Detail::Utf16StringData con
 
 static auto& all_utf16_fly_strings()
 {
-    static Singleton<HashTable<Detail::Utf16StringData const*, Utf16FlyStringTableHashTraits>> table;
+    static Singleton<ShardedHashTable<Detail::Utf16StringData const*, Utf16FlyStringTableHashTraits>> table;
     return *table;
 }
 
@@ -26,7 +26,9 @@ namespace Detail {
 
 void did_destroy_utf16_fly_string_data(Badge<Detail::Utf16StringData>, Detail::Utf16StringData const& data)
 {
-    all_utf16_fly_strings().remove(&data);
+    all_utf16_fly_strings().with_shard_for_hash(data.hash(), [&](auto& table) {
+        table.remove(&data);
+    });
 }
 
 }
@@ -45,10 +47,14 @@ Optional<Utf16FlyString> Utf16FlyString::create_fly_string_from_cache(ViewType c
             return Utf16String::from_utf16(string);
     }
 
-    if (auto it = all_utf16_fly_strings().find(string.hash(), [&](auto const& entry) { return *entry == string; }); it != all_utf16_fly_strings().end())
-        return Utf16FlyString { Detail::Utf16StringBase(**it) };
-
-    return {};
+    // NB: The reference to the string we find must be taken while its shard is still locked, so that another thread
+    //     can't remove the string from the table in between.
+    auto hash = string.hash();
+    return all_utf16_fly_strings().with_shard_for_hash(hash, [&](auto& table) -> Optional<Utf16FlyString> {
+        if (auto it = table.find(hash, [&](auto const& entry) { return *entry == string; }); it != table.end())
+            return Utf16FlyString { Detail::Utf16StringBase(**it) };
+        return {};
+    });
 }
 
 Utf16FlyString Utf16FlyString::from_utf8(StringView string)
@@ -86,14 +92,16 @@ Utf16FlyString::Utf16FlyString(Utf16String const& string)
         return;
     }
 
-    if (auto it = all_utf16_fly_strings().find(data); it == all_utf16_fly_strings().end()) {
-        m_data = string;
+    all_utf16_fly_strings().with_shard_for_hash(data->hash(), [&](auto& table) {
+        if (auto it = table.find(data); it == table.end()) {
+            m_data = string;
 
-        all_utf16_fly_strings().set(data);
-        data->mark_as_fly_string({});
-    } else {
-        m_data.set_data({}, *it);
-    }
+            table.set(data);
+            data->mark_as_fly_string({});
+        } else {
+            m_data.set_data({}, *it);
+        }
+    });
 }
 
 size_t Utf16FlyString::number_of_utf16_fly_strings()
@@ -31,10 +31,9 @@ ErrorOr<String> Utf16View::to_utf8(AllowLonelySurrogates allow_lonely_surrogates
     if (has_ascii_storage())
         return String::from_utf8_without_validation(bytes());
 
-    if (allow_lonely_surrogates == AllowLonelySurrogates::No) {
-        if (!validate())
-            return Error::from_string_literal("Input was not valid UTF-16");
-
+    // NB: Most strings do not contain lonely surrogates, even if they are allowed to. We convert those straight into a
+    //     string of the exact length, rather than going through a StringBuilder that has to allocate for the worst case.
+    if (validate()) {
         String result;
         auto utf8_length = simdutf::utf8_length_from_utf16(m_string.utf16, length_in_code_units());
 
@@ -47,6 +46,9 @@ ErrorOr<String> Utf16View::to_utf8(AllowLonelySurrogates allow_lonely_surrogates
         return result;
     }
 
+    if (allow_lonely_surrogates == AllowLonelySurrogates::No)
+        return Error::from_string_literal("Input was not valid UTF-16");
+
     StringBuilder builder;
     builder.append(*this);
     return builder.to_string();
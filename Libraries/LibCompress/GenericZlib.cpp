@@ -97,6 +97,38 @@ ErrorOr<Bytes> GenericZlibDecompressor::read_some(Bytes bytes)
     return bytes.slice(0, bytes.size() - m_zstream->avail_out);
 }
 
+ErrorOr<Bytes> GenericZlibDecompressor::read_some_of_available_input(Bytes bytes)
+{
+    m_zstream->avail_out = bytes.size();
+    m_zstream->next_out = bytes.data();
+
+    while (m_zstream->avail_out > 0 && !m_eof) {
+        if (m_zstream->avail_in == 0) {
+            auto in = TRY(m_stream->read_some(m_buffer.span()));
+            m_zstream->avail_in = in.size();
+            m_zstream->next_in = m_buffer.data();
+        }
+
+        auto ret = inflate(m_zstream, Z_NO_FLUSH);
+
+        if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+            return handle_zlib_error(ret);
+
+        // We got Z_BUF_ERROR (no progress was possible), so all available input has been consumed and there is no
+        // pending output left. Unlike read_some(), this is not an error, as more input may still be written.
+        if (ret == Z_BUF_ERROR)
+            break;
+
+        if (ret == Z_STREAM_END) {
+            inflateReset(m_zstream);
+            if (m_zstream->avail_in == 0)
+                m_eof = true;
+        }
+    }
+
+    return bytes.slice(0, bytes.size() - m_zstream->avail_out);
+}
+
 ErrorOr<size_t> GenericZlibDecompressor::write_some(ReadonlyBytes)
 {
     return Error::from_errno(EBADF);
@@ -201,6 +233,28 @@ void GenericZlibCompressor::close()
 {
 }
 
+ErrorOr<void> GenericZlibCompressor::flush()
+{
+    VERIFY(m_zstream->avail_in == 0);
+
+    // If the parameter flush is set to Z_SYNC_FLUSH, all pending output is flushed to the output buffer and the output is aligned on
+    // a byte boundary. If deflate returns with avail_out == 0, this function must be called again with the same value of the flush
+    // parameter and more output space (updated avail_out), until the flush is complete (deflate returns with non-zero avail_out).
+    do {
+        m_zstream->avail_out = m_buffer.size();
+        m_zstream->next_out = m_buffer.data();
+
+        auto ret = deflate(m_zstream, Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+            return handle_zlib_error(ret);
+
+        auto have = m_buffer.size() - m_zstream->avail_out;
+        TRY(m_stream->write_until_depleted(m_buffer.span().slice(0, have)));
+    } while (m_zstream->avail_out == 0);
+
+    return {};
+}
+
 ErrorOr<void> GenericZlibCompressor::finish()
 {
     VERIFY(m_zstream->avail_in == 0);
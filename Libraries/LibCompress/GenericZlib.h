@@ -36,6 +36,11 @@ public:
     virtual bool is_open() const override;
     virtual void close() override;
 
+    // Decompresses as much of the input that has been written to the underlying stream so far as fits into the given
+    // buffer. Unlike read_some(), running out of input is not an error, which makes this suitable for underlying
+    // streams that are still being written to.
+    ErrorOr<Bytes> read_some_of_available_input(Bytes);
+
 protected:
     GenericZlibDecompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, z_stream*);
 
@@ -61,6 +66,11 @@ public:
     virtual bool is_eof() const override;
     virtual bool is_open() const override;
     virtual void close() override;
+
+    // Writes all pending output to the underlying stream, ending it on a byte boundary with an empty stored block
+    // (0x00 0x00 0xff 0xff), without ending the compressed stream. Later output may still refer back to data
+    // written before the flush.
+    ErrorOr<void> flush();
     ErrorOr<void> finish();
 
 protected:
@@ -20,7 +20,13 @@ ErrorOr<AnonymousBuffer> AnonymousBuffer::create_with_size(size_t size)
 
 ErrorOr<NonnullRefPtr<AnonymousBufferImpl>> AnonymousBufferImpl::create(int fd, size_t size)
 {
-    auto* data = mmap(nullptr, round_up_to_power_of_two(size, PAGE_SIZE), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    auto mapping_size = round_up_to_power_of_two(size, PAGE_SIZE);
+    auto* data = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    // NB: Buffers that were sealed against writes may only be mapped read-only.
+    if (data == MAP_FAILED && errno == EPERM)
+        data = mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+
     if (data == MAP_FAILED)
         return Error::from_errno(errno);
     return AK::adopt_nonnull_ref_or_enomem(new (nothrow) AnonymousBufferImpl(fd, size, data));
@@ -42,6 +48,19 @@ ErrorOr<AnonymousBuffer> AnonymousBuffer::create_from_anon_fd(int fd, size_t siz
     return AnonymousBuffer(move(impl));
 }
 
+ErrorOr<void> AnonymousBuffer::seal_against_writes()
+{
+    VERIFY(m_impl);
+
+#if defined(AK_OS_LINUX) && defined(F_SEAL_FUTURE_WRITE)
+    if (fcntl(m_impl->fd(), F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_FUTURE_WRITE) < 0)
+        return Error::from_syscall("fcntl"sv, errno);
+#endif
+
+    // FIXME: Seal buffers on other platforms as well.
+    return {};
+}
+
 AnonymousBufferImpl::AnonymousBufferImpl(int fd, size_t size, void* data)
     : m_fd(fd)
     , m_size(size)
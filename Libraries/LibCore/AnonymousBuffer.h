@@ -47,6 +47,11 @@ public:
     int fd() const { return m_impl ? m_impl->fd() : -1; }
     size_t size() const { return m_impl ? m_impl->size() : 0; }
 
+    // Prevents any process that the buffer is shared with from writing to it from now on, where the platform allows it.
+    // Existing mappings, such as our own, stay writable. Other processes map a sealed buffer read-only, so they crash
+    // rather than change its contents when they try to write to it.
+    ErrorOr<void> seal_against_writes();
+
     ReadonlyBytes bytes() const
     {
         if (!m_impl)
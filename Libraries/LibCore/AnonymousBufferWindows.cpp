@@ -58,4 +58,12 @@ ErrorOr<AnonymousBuffer> AnonymousBuffer::create_from_anon_fd(int fd, size_t siz
     return AnonymousBuffer(move(impl));
 }
 
+ErrorOr<void> AnonymousBuffer::seal_against_writes()
+{
+    VERIFY(m_impl);
+
+    // FIXME: Hand out read-only duplicates of the file mapping handle instead.
+    return {};
+}
+
 }
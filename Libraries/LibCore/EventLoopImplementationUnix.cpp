@@ -4,8 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/BinaryHeap.h>
+#include <AK/Array.h>
+#include <AK/BuiltinWrappers.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/IntrusiveList.h>
+#include <AK/QuickSort.h>
 #include <AK/Singleton.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Time.h>
@@ -17,12 +21,22 @@
 #include <LibCore/Platform/ScopedAutoreleasePool.h>
 #include <LibCore/System.h>
 #include <LibCore/ThreadEventQueue.h>
+#include <LibCore/TimerWheel.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/RWLock.h>
 #include <pthread.h>
 #include <sys/select.h>
 #include <unistd.h>
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+#    define EVENT_LOOP_USES_EPOLL
+#    include <sys/epoll.h>
+#elif defined(AK_OS_MACOS) || defined(AK_OS_IOS) || defined(AK_OS_FREEBSD) || defined(AK_OS_NETBSD) || defined(AK_OS_OPENBSD) || defined(AK_OS_DRAGONFLY)
+#    define EVENT_LOOP_USES_KQUEUE
+#    include <fcntl.h>
+#    include <sys/event.h>
+#endif
+
 namespace Core {
 
 namespace {
@@ -50,10 +64,501 @@ bool has_flag(int value, int flag)
     return (value & flag) == flag;
 }
 
+// Polls the file descriptors of all notifiers on every call, which takes time proportional to the number of notifiers.
+class PollNotifierSet {
+public:
+    void add_wake_pipe(int wake_pipe_fd)
+    {
+        // The wake pipe informs us of POSIX signals as well as manual calls to wake()
+        m_poll_fds.append({ .fd = wake_pipe_fd, .events = POLLIN, .revents = 0 });
+        m_notifiers.append(nullptr);
+    }
+
+    void add(Notifier& notifier)
+    {
+        m_notifier_to_index.set(&notifier, m_poll_fds.size());
+        m_notifiers.append(&notifier);
+
+        auto events = notification_type_to_poll_events(notifier.type());
+        m_poll_fds.append({ .fd = notifier.fd(), .events = events, .revents = 0 });
+    }
+
+    void remove(Notifier& notifier)
+    {
+        auto notifier_index = m_notifier_to_index.take(&notifier).release_value();
+
+        if (notifier_index + 1 < m_poll_fds.size()) {
+            swap(m_notifiers[notifier_index], m_notifiers.last());
+            swap(m_poll_fds[notifier_index], m_poll_fds.last());
+
+            auto* swapped_notifier = m_notifiers[notifier_index];
+            m_notifier_to_index.set(swapped_notifier, notifier_index);
+        }
+
+        m_notifiers.take_last();
+        m_poll_fds.take_last();
+    }
+
+    ErrorOr<void> wait(int timeout)
+    {
+        m_ready_count = 0;
+        m_ready_count = TRY(System::poll(m_poll_fds, timeout));
+        return {};
+    }
+
+    bool is_wake_pipe_readable() const
+    {
+        return has_flag(m_poll_fds[0].revents, POLLIN);
+    }
+
+    template<typename Callback>
+    void for_each_ready_notifier(Callback callback) const
+    {
+        if (m_ready_count == 0)
+            return;
+
+        for (size_t i = 1; i < m_poll_fds.size(); ++i) {
+            auto& notifier = *m_notifiers[i];
+
+#ifdef AK_OS_ANDROID
+            // FIXME: Make the check work under Android, perhaps use ALooper.
+            callback(notifier, notifier.type());
+#else
+            auto revents = m_poll_fds[i].revents;
+
+            NotificationType type = NotificationType::None;
+            if (has_flag(revents, POLLIN))
+                type |= NotificationType::Read;
+            if (has_flag(revents, POLLOUT))
+                type |= NotificationType::Write;
+            if (has_flag(revents, POLLHUP))
+                type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
+            if (has_flag(revents, POLLERR))
+                type |= NotificationType::Error;
+
+            callback(notifier, type);
+#endif
+        }
+    }
+
+private:
+    HashMap<Notifier*, size_t> m_notifier_to_index;
+    Vector<Notifier*, 32> m_notifiers;
+    Vector<pollfd, 32> m_poll_fds;
+    int m_ready_count { 0 };
+};
+
+#if defined(EVENT_LOOP_USES_EPOLL) || defined(EVENT_LOOP_USES_KQUEUE)
+
+// The most events we receive from the kernel per wakeup. Any others remain pending, and are received on the next one.
+static constexpr size_t MAXIMUM_READY_EVENT_COUNT = 256;
+
+// Notifiers are level-triggered, just like with poll(): a notifier keeps being activated while its file descriptor is
+// ready, rather than only when it becomes ready.
+//
+// Several notifiers may share a file descriptor (e.g. one for reading from a socket, and one for writing to it), but the
+// kernel only tracks one registration per file descriptor. So we track the notifiers of each file descriptor ourselves.
+struct NotifierRegistration {
+    Vector<Notifier*, 1> notifiers;
+
+    // The kernel refuses to wait on some file descriptors, such as regular files. poll() considers those to always be
+    // ready, so we do as well.
+    bool is_always_ready { false };
+};
+
+#endif
+
+#if defined(EVENT_LOOP_USES_EPOLL)
+
+// Only reports the file descriptors that are ready, which takes time proportional to the number of ready descriptors.
+class EpollNotifierSet {
+public:
+    EpollNotifierSet()
+    {
+        m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (m_epoll_fd < 0) {
+            warnln("\033[31;1mFailed to create event loop epoll instance:\033[0m {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+    }
+
+    ~EpollNotifierSet()
+    {
+        close(m_epoll_fd);
+    }
+
+    void add_wake_pipe(int wake_pipe_fd)
+    {
+        m_wake_pipe_fd = wake_pipe_fd;
+
+        epoll_event event { .events = EPOLLIN, .data = { .fd = wake_pipe_fd } };
+        if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, wake_pipe_fd, &event) < 0) {
+            warnln("\033[31;1mFailed to watch event loop pipe:\033[0m {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+    }
+
+    void add(Notifier& notifier)
+    {
+        auto fd = notifier.fd();
+
+        auto& registration = m_registrations.ensure(fd);
+        registration.notifiers.append(&notifier);
+
+        // NB: We tell the kernel about every new notifier, even if it does not change the events we wait for. If the file
+        //     descriptor was closed and reused without its previous notifiers being removed, the kernel has already
+        //     dropped its registration.
+        update_registration(fd, registration);
+    }
+
+    void remove(Notifier& notifier)
+    {
+        auto fd = notifier.fd();
+
+        auto it = m_registrations.find(fd);
+        VERIFY(it != m_registrations.end());
+
+        auto& registration = it->value;
+        auto previous_events = events_for_notifiers(registration);
+        registration.notifiers.remove_first_matching([&](auto* registered_notifier) { return registered_notifier == &notifier; });
+
+        if (!registration.notifiers.is_empty()) {
+            if (events_for_notifiers(registration) != previous_events)
+                update_registration(fd, registration);
+            return;
+        }
+
+        // NB: The file descriptor may have been closed already, which removes it from the epoll instance by itself.
+        if (registration.is_always_ready)
+            m_always_ready_fds.remove(fd);
+        else
+            (void)epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+
+        m_registrations.remove(it);
+    }
+
+    ErrorOr<void> wait(int timeout)
+    {
+        m_ready_count = 0;
+
+        if (!m_always_ready_fds.is_empty())
+            timeout = 0;
+
+        auto ready_count = epoll_wait(m_epoll_fd, m_ready_events.data(), static_cast<int>(m_ready_events.size()), timeout);
+        if (ready_count < 0)
+            return Error::from_errno(errno);
+
+        m_ready_count = static_cast<size_t>(ready_count);
+        return {};
+    }
+
+    bool is_wake_pipe_readable() const
+    {
+        for (size_t i = 0; i < m_ready_count; ++i) {
+            if (m_ready_events[i].data.fd == m_wake_pipe_fd)
+                return has_flag(m_ready_events[i].events, EPOLLIN);
+        }
+        return false;
+    }
+
+    template<typename Callback>
+    void for_each_ready_notifier(Callback callback) const
+    {
+        for (size_t i = 0; i < m_ready_count; ++i) {
+            auto const& event = m_ready_events[i];
+            if (event.data.fd == m_wake_pipe_fd)
+                continue;
+
+            auto it = m_registrations.find(event.data.fd);
+            if (it == m_registrations.end())
+                continue;
+
+            NotificationType type = NotificationType::None;
+            if (has_flag(event.events, EPOLLIN))
+                type |= NotificationType::Read;
+            if (has_flag(event.events, EPOLLOUT))
+                type |= NotificationType::Write;
+            if (has_flag(event.events, EPOLLHUP))
+                type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
+            if (has_flag(event.events, EPOLLERR))
+                type |= NotificationType::Error;
+
+            for (auto* notifier : it->value.notifiers)
+                callback(*notifier, type);
+        }
+
+        for (auto fd : m_always_ready_fds) {
+            for (auto* notifier : m_registrations.find(fd)->value.notifiers)
+                callback(*notifier, NotificationType::Read | NotificationType::Write);
+        }
+    }
+
+private:
+    static u32 events_for_notifier(Notifier const& notifier)
+    {
+        u32 events = 0;
+        if (has_flag(notifier.type(), NotificationType::Read))
+            events |= EPOLLIN;
+        if (has_flag(notifier.type(), NotificationType::Write))
+            events |= EPOLLOUT;
+        return events;
+    }
+
+    static u32 events_for_notifiers(NotifierRegistration const& registration)
+    {
+        u32 events = 0;
+        for (auto const* notifier : registration.notifiers)
+            events |= events_for_notifier(*notifier);
+        return events;
+    }
+
+    void update_registration(int fd, NotifierRegistration& registration)
+    {
+        if (registration.is_always_ready)
+            return;
+
+        epoll_event event { .events = events_for_notifiers(registration), .data = { .fd = fd } };
+
+        auto result = epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, fd, &event);
+        if (result < 0 && errno == ENOENT)
+            result = epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event);
+        if (result == 0)
+            return;
+
+        if (errno == EPERM) {
+            registration.is_always_ready = true;
+            m_always_ready_fds.set(fd);
+            return;
+        }
+
+        dbgln("EventLoopImplementationUnix: Unable to watch file descriptor {}: {}", fd, Error::from_errno(errno));
+    }
+
+    int m_epoll_fd { -1 };
+    int m_wake_pipe_fd { -1 };
+
+    HashMap<int, NotifierRegistration> m_registrations;
+    HashTable<int> m_always_ready_fds;
+
+    Array<epoll_event, MAXIMUM_READY_EVENT_COUNT> m_ready_events;
+    size_t m_ready_count { 0 };
+};
+
+using NotifierSet = EpollNotifierSet;
+
+#elif defined(EVENT_LOOP_USES_KQUEUE)
+
+// Only reports the file descriptors that are ready, which takes time proportional to the number of ready descriptors.
+class KqueueNotifierSet {
+public:
+    KqueueNotifierSet()
+    {
+        m_kqueue_fd = kqueue();
+        if (m_kqueue_fd < 0) {
+            warnln("\033[31;1mFailed to create event loop kqueue:\033[0m {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+
+        (void)fcntl(m_kqueue_fd, F_SETFD, FD_CLOEXEC);
+    }
+
+    ~KqueueNotifierSet()
+    {
+        close(m_kqueue_fd);
+    }
+
+    void add_wake_pipe(int wake_pipe_fd)
+    {
+        m_wake_pipe_fd = wake_pipe_fd;
+
+        if (auto result = change_filter(wake_pipe_fd, EVFILT_READ, EV_ADD); result.is_error()) {
+            warnln("\033[31;1mFailed to watch event loop pipe:\033[0m {}", result.error());
+            VERIFY_NOT_REACHED();
+        }
+    }
+
+    void add(Notifier& notifier)
+    {
+        auto fd = notifier.fd();
+
+        auto& registration = m_registrations.ensure(fd);
+        registration.notifiers.append(&notifier);
+
+        if (registration.is_always_ready)
+            return;
+
+        // NB: Adding a filter that already exists only updates it, so we add the new notifier's filters even if another
+        //     notifier already needed them. If the file descriptor was closed and reused without its previous notifiers
+        //     being removed, the kernel has already dropped those filters.
+        auto result = [&]() -> ErrorOr<void> {
+            if (has_flag(notifier.type(), NotificationType::Read))
+                TRY(change_filter(fd, EVFILT_READ, EV_ADD));
+            if (has_flag(notifier.type(), NotificationType::Write))
+                TRY(change_filter(fd, EVFILT_WRITE, EV_ADD));
+            return {};
+        }();
+
+        if (result.is_error()) {
+            if (result.error().code() != EINVAL)
+                dbgln("EventLoopImplementationUnix: Unable to watch file descriptor {}: {}", fd, result.error());
+
+            (void)change_filter(fd, EVFILT_READ, EV_DELETE);
+            (void)change_filter(fd, EVFILT_WRITE, EV_DELETE);
+
+            registration.is_always_ready = true;
+            m_always_ready_fds.set(fd);
+        }
+    }
+
+    void remove(Notifier& notifier)
+    {
+        auto fd = notifier.fd();
+
+        auto it = m_registrations.find(fd);
+        VERIFY(it != m_registrations.end());
+
+        auto& registration = it->value;
+        registration.notifiers.remove_first_matching([&](auto* registered_notifier) { return registered_notifier == &notifier; });
+
+        auto remaining_type = NotificationType::None;
+        for (auto const* remaining_notifier : registration.notifiers)
+            remaining_type |= remaining_notifier->type();
+
+        // NB: The file descriptor may have been closed already, which removes its filters by itself.
+        if (!registration.is_always_ready) {
+            if (has_flag(notifier.type(), NotificationType::Read) && !has_flag(remaining_type, NotificationType::Read))
+                (void)change_filter(fd, EVFILT_READ, EV_DELETE);
+            if (has_flag(notifier.type(), NotificationType::Write) && !has_flag(remaining_type, NotificationType::Write))
+                (void)change_filter(fd, EVFILT_WRITE, EV_DELETE);
+        }
+
+        if (registration.notifiers.is_empty()) {
+            if (registration.is_always_ready)
+                m_always_ready_fds.remove(fd);
+            m_registrations.remove(it);
+        }
+    }
+
+    ErrorOr<void> wait(int timeout)
+    {
+        m_ready_types.clear_with_capacity();
+
+        if (!m_always_ready_fds.is_empty())
+            timeout = 0;
+
+        timespec timeout_spec { .tv_sec = timeout / 1000, .tv_nsec = (timeout % 1000) * 1'000'000 };
+        auto ready_count = kevent(m_kqueue_fd, nullptr, 0, m_ready_events.data(), static_cast<int>(m_ready_events.size()), timeout < 0 ? nullptr : &timeout_spec);
+        if (ready_count < 0)
+            return Error::from_errno(errno);
+
+        m_is_wake_pipe_readable = false;
+
+        // A file descriptor that is ready for both reading and writing is reported once for each filter, but its
+        // notifiers must only be activated once.
+        for (int i = 0; i < ready_count; ++i) {
+            auto const& event = m_ready_events[i];
+            auto fd = static_cast<int>(event.ident);
+
+            if (fd == m_wake_pipe_fd) {
+                m_is_wake_pipe_readable = true;
+                continue;
+            }
+
+            NotificationType type = NotificationType::None;
+            if (event.filter == EVFILT_READ)
+                type |= NotificationType::Read;
+            if (event.filter == EVFILT_WRITE)
+                type |= NotificationType::Write;
+            if (has_flag(event.flags, EV_EOF))
+                type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
+            if (has_flag(event.flags, EV_ERROR))
+                type |= NotificationType::Error;
+
+            m_ready_types.ensure(fd, [] { return NotificationType::None; }) |= type;
+        }
+
+        return {};
+    }
+
+    bool is_wake_pipe_readable() const
+    {
+        return m_is_wake_pipe_readable;
+    }
+
+    template<typename Callback>
+    void for_each_ready_notifier(Callback callback) const
+    {
+        for (auto const& [fd, type] : m_ready_types) {
+            auto it = m_registrations.find(fd);
+            if (it == m_registrations.end())
+                continue;
+
+            for (auto* notifier : it->value.notifiers)
+                callback(*notifier, type);
+        }
+
+        for (auto fd : m_always_ready_fds) {
+            for (auto* notifier : m_registrations.find(fd)->value.notifiers)
+                callback(*notifier, NotificationType::Read | NotificationType::Write);
+        }
+    }
+
+private:
+    ErrorOr<void> change_filter(int fd, short filter, u16 flags)
+    {
+        struct kevent change;
+        EV_SET(&change, fd, filter, flags, 0, 0, nullptr);
+
+        if (kevent(m_kqueue_fd, &change, 1, nullptr, 0, nullptr) < 0)
+            return Error::from_errno(errno);
+        return {};
+    }
+
+    int m_kqueue_fd { -1 };
+    int m_wake_pipe_fd { -1 };
+
+    HashMap<int, NotifierRegistration> m_registrations;
+    HashTable<int> m_always_ready_fds;
+
+    Array<struct kevent, MAXIMUM_READY_EVENT_COUNT> m_ready_events;
+    HashMap<int, NotificationType> m_ready_types;
+    bool m_is_wake_pipe_readable { false };
+};
+
+using NotifierSet = KqueueNotifierSet;
+
+#else
+
+using NotifierSet = PollNotifierSet;
+
+#endif
+
+// Timers may fire up to 1/32nd of their interval late, so that timers with nearby deadlines fire in the same wakeup
+// rather than each waking up the event loop on its own. Short timers are never delayed.
+static constexpr i64 COALESCING_WINDOW_INTERVAL_DIVISOR = 32;
+static constexpr i64 MAXIMUM_COALESCING_WINDOW_MS = 64;
+
+static AK::Duration coalescing_window_for_interval(AK::Duration interval)
+{
+    auto window_ms = interval.to_milliseconds() / COALESCING_WINDOW_INTERVAL_DIVISOR;
+    if (window_ms < 2)
+        return {};
+
+    // NB: The window is a power of two, so that timers with different intervals still share deadlines.
+    auto rounded_window_ms = static_cast<i64>(1) << (63 - count_leading_zeroes(static_cast<u64>(window_ms)));
+    return AK::Duration::from_milliseconds(min(rounded_window_ms, MAXIMUM_COALESCING_WINDOW_MS));
+}
+
 class EventLoopTimeout {
 public:
     static constexpr ssize_t INVALID_INDEX = NumericLimits<ssize_t>::max();
 
+    // The index of timeouts that have an absolute fire time, and are in the timer wheel.
+    static constexpr ssize_t TIMER_WHEEL_INDEX = 0;
+
+    // The index of timeouts that have been taken out of the timer wheel, and are about to be fired.
+    static constexpr ssize_t EXPIRED_INDEX = 1;
+
     EventLoopTimeout() { }
     virtual ~EventLoopTimeout() = default;
 
@@ -61,6 +566,21 @@ public:
 
     MonotonicTime fire_time() const { return m_fire_time; }
 
+    // The fire time rounded up to the coalescing window, which is when the timeout actually fires.
+    MonotonicTime deadline() const
+    {
+        if (m_coalescing_window.is_zero())
+            return m_fire_time;
+
+        auto window = m_coalescing_window.to_nanoseconds();
+        auto remainder = m_fire_time.nanoseconds() % window;
+        if (remainder <= 0)
+            return m_fire_time - AK::Duration::from_nanoseconds(remainder);
+        return m_fire_time + AK::Duration::from_nanoseconds(window - remainder);
+    }
+
+    void set_coalescing_window(AK::Duration window) { m_coalescing_window = window; }
+
     void absolutize(Badge<TimeoutSet>, MonotonicTime current_time)
     {
         m_fire_time = current_time + m_duration;
@@ -81,47 +601,64 @@ protected:
     };
 
 private:
+    friend class TimeoutSet;
+
+    IntrusiveListNode<EventLoopTimeout> m_timer_wheel_node;
+    AK::Duration m_coalescing_window;
     ssize_t m_index = INVALID_INDEX;
     u64 m_sequence_id { 0 };
 };
 
 class TimeoutSet {
 public:
-    TimeoutSet() = default;
+    TimeoutSet()
+        : m_wheel(MonotonicTime::now_coarse())
+    {
+    }
 
     Optional<MonotonicTime> next_timer_expiration()
     {
-        if (!m_heap.is_empty()) {
-            return m_heap.peek_min()->fire_time();
-        } else {
-            return {};
-        }
+        return m_wheel.next_deadline();
     }
 
     void absolutize_relative_timeouts(MonotonicTime current_time)
     {
         for (auto timeout : m_scheduled_timeouts) {
             timeout->absolutize({}, current_time);
-            m_heap.insert(timeout);
+            timeout->set_index({}, EventLoopTimeout::TIMER_WHEEL_INDEX);
+            m_wheel.insert(*timeout);
         }
         m_scheduled_timeouts.clear();
     }
 
     size_t fire_expired(MonotonicTime current_time)
     {
+        m_expired_timeouts.clear_with_capacity();
+        m_wheel.take_expired(current_time, m_expired_timeouts);
+
+        // NB: The wheel does not order the timeouts that expire together, so we fire them in the order of their fire
+        //     times, or of their scheduling if they were due at the same time.
+        quick_sort(m_expired_timeouts, [](EventLoopTimeout* a, EventLoopTimeout* b) {
+            if (a->fire_time() == b->fire_time())
+                return a->sequence_id() < b->sequence_id();
+            return a->fire_time() < b->fire_time();
+        });
+
+        for (auto* timeout : m_expired_timeouts)
+            timeout->set_index({}, EventLoopTimeout::EXPIRED_INDEX);
+
         size_t fired_count = 0;
-        while (!m_heap.is_empty()) {
-            auto& timeout = *m_heap.peek_min();
-
-            if (timeout.fire_time() <= current_time) {
-                ++fired_count;
-                m_heap.pop_min();
-                timeout.set_index({}, EventLoopTimeout::INVALID_INDEX);
-                timeout.fire(*this, current_time);
-            } else {
-                break;
-            }
+        for (auto*& timeout : m_expired_timeouts) {
+            // NB: Firing a timeout may unregister one of the timeouts that expired along with it.
+            if (!timeout)
+                continue;
+
+            auto* expired_timeout = exchange(timeout, nullptr);
+            expired_timeout->set_index({}, EventLoopTimeout::INVALID_INDEX);
+            expired_timeout->fire(*this, current_time);
+            ++fired_count;
         }
+
         return fired_count;
     }
 
@@ -135,7 +672,8 @@ public:
     void schedule_absolute(EventLoopTimeout* timeout)
     {
         timeout->set_sequence_id(m_next_sequence_id++);
-        m_heap.insert(timeout);
+        timeout->set_index({}, EventLoopTimeout::TIMER_WHEEL_INDEX);
+        m_wheel.insert(*timeout);
     }
 
     void unschedule(EventLoopTimeout* timeout)
@@ -147,36 +685,35 @@ public:
             swap(m_scheduled_timeouts[i], m_scheduled_timeouts[j]);
             swap(m_scheduled_timeouts[i]->index({}), m_scheduled_timeouts[j]->index({}));
             (void)m_scheduled_timeouts.take_last();
+        } else if (timeout->index({}) == EventLoopTimeout::EXPIRED_INDEX) {
+            auto expired_index = m_expired_timeouts.find_first_index(timeout);
+            m_expired_timeouts[expired_index.release_value()] = nullptr;
         } else {
-            m_heap.pop(timeout->index({}));
+            m_wheel.remove(*timeout);
         }
         timeout->set_index({}, EventLoopTimeout::INVALID_INDEX);
     }
 
     void clear()
     {
-        for (auto* timeout : m_heap.nodes_in_arbitrary_order())
-            timeout->set_index({}, EventLoopTimeout::INVALID_INDEX);
-        m_heap.clear();
+        m_wheel.for_each([](EventLoopTimeout& timeout) {
+            timeout.set_index({}, EventLoopTimeout::INVALID_INDEX);
+        });
+        m_wheel.clear();
         for (auto* timeout : m_scheduled_timeouts)
             timeout->set_index({}, EventLoopTimeout::INVALID_INDEX);
         m_scheduled_timeouts.clear();
+        for (auto* timeout : m_expired_timeouts) {
+            if (timeout)
+                timeout->set_index({}, EventLoopTimeout::INVALID_INDEX);
+        }
+        m_expired_timeouts.clear();
     }
 
 private:
-    IntrusiveBinaryHeap<
-        EventLoopTimeout*,
-        decltype([](EventLoopTimeout* a, EventLoopTimeout* b) {
-            if (a->fire_time() == b->fire_time())
-                return a->sequence_id() < b->sequence_id();
-            return a->fire_time() < b->fire_time();
-        }),
-        decltype([](EventLoopTimeout* timeout, size_t index) {
-            timeout->set_index({}, static_cast<ssize_t>(index));
-        }),
-        8>
-        m_heap;
+    TimerWheel<EventLoopTimeout, &EventLoopTimeout::m_timer_wheel_node> m_wheel;
     Vector<EventLoopTimeout*, 8> m_scheduled_timeouts;
+    Vector<EventLoopTimeout*, 8> m_expired_timeouts;
     u64 m_next_sequence_id { 0 };
 };
 
@@ -256,10 +793,7 @@ struct ThreadData {
         }
 
         wake_pipe_fds = result.release_value();
-
-        // The wake pipe informs us of POSIX signals as well as manual calls to wake()
-        poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
-        notifiers.append(nullptr);
+        notifiers.add_wake_pipe(wake_pipe_fds[0]);
     }
 
     ~ThreadData()
@@ -276,9 +810,7 @@ struct ThreadData {
     // Each thread has its own timers, notifiers and a wake pipe.
     TimeoutSet timeouts;
 
-    HashMap<Notifier*, size_t> notifier_to_index;
-    Vector<Notifier*, 32> notifiers;
-    Vector<pollfd, 32> poll_fds;
+    NotifierSet notifiers;
 
     // The wake pipe is used to notify another event loop that someone has called wake(), or a signal has been received.
     // wake() writes 0i32 into the pipe, signals write the signal number (guaranteed non-zero).
@@ -361,19 +893,19 @@ retry:
 
 try_select_again:
     // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
-    auto error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
+    auto wait_result = thread_data.notifiers.wait(should_wait_forever ? -1 : timeout);
     auto time_after_poll = MonotonicTime::now_coarse();
     // Because POSIX, we might spuriously return from select() with EINTR; just select again.
-    if (error_or_marked_fd_count.is_error()) {
-        if (error_or_marked_fd_count.error().code() == EINTR)
+    if (wait_result.is_error()) {
+        if (wait_result.error().code() == EINTR)
             goto try_select_again;
-        dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
+        dbgln("EventLoopImplementationUnix::wait_for_events: {}", wait_result.error());
         VERIFY_NOT_REACHED();
     }
 
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
-    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+    if (thread_data.notifiers.is_wake_pipe_readable()) {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -402,34 +934,13 @@ try_select_again:
             goto retry;
     }
 
-    if (error_or_marked_fd_count.value() != 0) {
-        // Handle file system notifiers by making them normal events.
-        for (size_t i = 1; i < thread_data.poll_fds.size(); ++i) {
-            auto& notifier = *thread_data.notifiers[i];
-
-#ifdef AK_OS_ANDROID
-            // FIXME: Make the check work under Android, perhaps use ALooper.
-            ThreadEventQueue::current().post_event(notifier, Core::Event::Type::NotifierActivation);
-#else
-            auto revents = thread_data.poll_fds[i].revents;
-
-            NotificationType type = NotificationType::None;
-            if (has_flag(revents, POLLIN))
-                type |= NotificationType::Read;
-            if (has_flag(revents, POLLOUT))
-                type |= NotificationType::Write;
-            if (has_flag(revents, POLLHUP))
-                type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
-            if (has_flag(revents, POLLERR))
-                type |= NotificationType::Error;
-
-            type &= notifier.type();
+    // Handle file system notifiers by making them normal events.
+    thread_data.notifiers.for_each_ready_notifier([](Notifier& notifier, NotificationType type) {
+        type &= notifier.type();
 
-            if (type != NotificationType::None)
-                ThreadEventQueue::current().post_event(&notifier, Core::Event::Type::NotifierActivation);
-#endif
-        }
-    }
+        if (type != NotificationType::None)
+            ThreadEventQueue::current().post_event(&notifier, Core::Event::Type::NotifierActivation);
+    });
 
     // Handle expired timers.
     thread_data.timeouts.fire_expired(time_after_poll);
@@ -631,6 +1142,7 @@ intptr_t EventLoopManagerUnix::register_timer(EventReceiver& object, int millise
     timer->owner_thread = s_thread_id;
     timer->owner = object;
     timer->interval = AK::Duration::from_milliseconds(milliseconds);
+    timer->set_coalescing_window(coalescing_window_for_interval(timer->interval));
     timer->reload(MonotonicTime::now_coarse());
     timer->should_reload = should_reload;
     thread_data.timeouts.schedule_absolute(timer);
@@ -659,12 +1171,7 @@ void EventLoopManagerUnix::register_notifier(Notifier& notifier)
     auto& thread_data = ThreadData::the();
     Threading::MutexLocker locker(thread_data.mutex);
 
-    thread_data.notifier_to_index.set(&notifier, thread_data.poll_fds.size());
-    thread_data.notifiers.append(&notifier);
-
-    auto events = notification_type_to_poll_events(notifier.type());
-    thread_data.poll_fds.append({ .fd = notifier.fd(), .events = events, .revents = 0 });
-
+    thread_data.notifiers.add(notifier);
     notifier.set_owner_thread(s_thread_id);
 }
 
@@ -676,18 +1183,7 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
         return;
     Threading::MutexLocker thread_data_content_locker(thread_data->mutex);
 
-    auto notifier_index = thread_data->notifier_to_index.take(&notifier).release_value();
-
-    if (notifier_index + 1 < thread_data->poll_fds.size()) {
-        swap(thread_data->notifiers[notifier_index], thread_data->notifiers.last());
-        swap(thread_data->poll_fds[notifier_index], thread_data->poll_fds.last());
-
-        auto* swapped_notifier = thread_data->notifiers[notifier_index];
-        thread_data->notifier_to_index.set(swapped_notifier, notifier_index);
-    }
-
-    thread_data->notifiers.take_last();
-    thread_data->poll_fds.take_last();
+    thread_data->notifiers.remove(notifier);
 }
 
 void EventLoopManagerUnix::did_post_event()
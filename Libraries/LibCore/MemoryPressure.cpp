@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Format.h>
+#include <AK/Vector.h>
+#include <LibCore/MemoryPressure.h>
+
+namespace Core {
+
+struct RegisteredHandler {
+    int id { 0 };
+    MemoryPressure::Handler handler;
+};
+
+static Vector<RegisteredHandler>& registered_handlers()
+{
+    static Vector<RegisteredHandler> handlers;
+    return handlers;
+}
+
+static int s_next_handler_id = 0;
+
+int MemoryPressure::register_handler(Handler handler)
+{
+    auto id = ++s_next_handler_id;
+    registered_handlers().append({ id, move(handler) });
+    return id;
+}
+
+void MemoryPressure::unregister_handler(int handler_id)
+{
+    registered_handlers().remove_first_matching([&](auto const& registered_handler) {
+        return registered_handler.id == handler_id;
+    });
+}
+
+void MemoryPressure::notify(MemoryPressureLevel level)
+{
+    dbgln("Releasing memory due to {} memory pressure", level == MemoryPressureLevel::Critical ? "critical"sv : "moderate"sv);
+
+    for (auto& registered_handler : registered_handlers())
+        registered_handler.handler(level);
+}
+
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Types.h>
+#include <LibCore/Export.h>
+
+namespace Core {
+
+enum class MemoryPressureLevel : u8 {
+    // Drop whatever is cheap to recreate.
+    Moderate,
+
+    // Drop everything that can be recreated at all, as the process is about to be killed otherwise.
+    Critical,
+};
+
+// Subsystems that hold on to memory which they are able to recreate register a handler here, which is invoked whenever
+// the process is asked to release memory. Handlers are invoked on the main thread, in the order they were registered,
+// and may not register or unregister handlers themselves.
+class CORE_API MemoryPressure {
+public:
+    using Handler = Function<void(MemoryPressureLevel)>;
+
+    static int register_handler(Handler);
+    static void unregister_handler(int handler_id);
+
+    static void notify(MemoryPressureLevel);
+};
+
+}
@@ -147,7 +147,8 @@ ErrorOr<int> anon_create([[maybe_unused]] size_t size, [[maybe_unused]] int opti
     int fd = -1;
 #if defined(AK_OS_LINUX) || defined(AK_OS_FREEBSD)
     // FIXME: Support more options on Linux.
-    auto linux_options = ((options & O_CLOEXEC) > 0) ? MFD_CLOEXEC : 0;
+    // NB: Sealing is always allowed, so that buffers may be sealed against writes once they are shared.
+    auto linux_options = (((options & O_CLOEXEC) > 0) ? MFD_CLOEXEC : 0) | MFD_ALLOW_SEALING;
     fd = memfd_create("", linux_options);
 #elif defined(SHM_ANON)
     fd = shm_open(SHM_ANON, O_RDWR | O_CREAT | options, 0600);
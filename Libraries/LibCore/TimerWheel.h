@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/IntrusiveList.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+
+namespace Core {
+
+// A hierarchical timer wheel, as described in "Hashed and Hierarchical Timing Wheels" by Varghese and Lauck. Entries
+// are bucketed into slots by their deadline, so inserting and removing an entry takes constant time regardless of how
+// many entries there are. The slots of the lowest level each span one millisecond, and the slots of every other level
+// span as much time as the entire level below them. Whenever the wheel reaches the start of a slot, the entries in that
+// slot move down to the level below.
+//
+// Entries must provide a `MonotonicTime deadline() const`, which may not change while they are in the wheel. They expire
+// once the time passed to take_expired() reaches their deadline, never before.
+//
+// http://www.cs.columbia.edu/~nahum/w6998/papers/sosp87-timing-wheels.pdf
+template<typename T, IntrusiveListNode<T> T::* member>
+class TimerWheel {
+    AK_MAKE_NONCOPYABLE(TimerWheel);
+    AK_MAKE_NONMOVABLE(TimerWheel);
+
+public:
+    explicit TimerWheel(MonotonicTime start_time)
+        : m_start_time(start_time)
+    {
+    }
+
+    bool is_empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+
+    void insert(T& entry)
+    {
+        VERIFY(!(entry.*member).is_in_list());
+
+        if (m_next_deadline.has_value() || m_size == 0)
+            m_next_deadline = min(m_next_deadline.value_or(entry.deadline()), entry.deadline());
+
+        ++m_size;
+
+        auto tick = tick_for(entry.deadline());
+
+        // Entries within the current tick may or may not have expired yet, so we keep them aside and check them against
+        // the exact time whenever we are advanced.
+        if (tick <= m_current_tick) {
+            m_current_tick_entries.append(entry);
+            return;
+        }
+
+        place(entry, tick);
+    }
+
+    void remove(T& entry)
+    {
+        VERIFY((entry.*member).is_in_list());
+
+        // NB: The slot's bit in the occupied slot mask is cleared lazily, once the slot is next looked at.
+        (entry.*member).remove();
+        --m_size;
+
+        if (m_next_deadline == entry.deadline())
+            m_next_deadline.clear();
+    }
+
+    // Returns the earliest deadline of any entry in the wheel.
+    Optional<MonotonicTime> next_deadline()
+    {
+        if (m_size == 0)
+            return {};
+        if (m_next_deadline.has_value())
+            return m_next_deadline;
+
+        Optional<MonotonicTime> next_deadline;
+        auto consider = [&](List const& entries) {
+            for (auto const& entry : entries) {
+                if (!next_deadline.has_value() || entry.deadline() < *next_deadline)
+                    next_deadline = entry.deadline();
+            }
+        };
+
+        consider(m_current_tick_entries);
+
+        // The earliest entry of each level is in the first occupied slot after the slot of the current tick, as each
+        // slot spans a later stretch of time than the slot before it.
+        for (size_t level = 0; level < LEVEL_COUNT; ++level) {
+            if (auto* slot = first_occupied_slot(level))
+                consider(*slot);
+        }
+
+        m_next_deadline = next_deadline;
+        return next_deadline;
+    }
+
+    // Removes all entries whose deadline is at or before the given time, and appends them to the vector in no particular
+    // order.
+    void take_expired(MonotonicTime now, Vector<T*>& expired)
+    {
+        auto expired_count = expired.size();
+
+        advance_to(tick_for(now), expired);
+
+        for (auto it = m_current_tick_entries.begin(); it != m_current_tick_entries.end();) {
+            auto& entry = *it;
+            ++it;
+
+            if (entry.deadline() <= now) {
+                (entry.*member).remove();
+                expired.append(&entry);
+            }
+        }
+
+        if (expired.size() != expired_count) {
+            m_size -= expired.size() - expired_count;
+            m_next_deadline.clear();
+        }
+    }
+
+    template<typename Callback>
+    void for_each(Callback callback)
+    {
+        for (auto& entry : m_current_tick_entries)
+            callback(entry);
+
+        for (auto& level : m_levels) {
+            for (auto& slot : level.slots) {
+                for (auto& entry : slot)
+                    callback(entry);
+            }
+        }
+    }
+
+    void clear()
+    {
+        m_current_tick_entries.clear();
+
+        for (auto& level : m_levels) {
+            for (auto& slot : level.slots)
+                slot.clear();
+            level.occupied_slots = 0;
+        }
+
+        m_size = 0;
+        m_next_deadline.clear();
+    }
+
+private:
+    using List = IntrusiveList<member>;
+
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS_PER_LEVEL = 1 << SLOT_BITS;
+    static constexpr u64 SLOT_MASK = SLOTS_PER_LEVEL - 1;
+
+    // Six levels span more than two years, which is longer than any timer interval that fits into milliseconds as an int.
+    static constexpr size_t LEVEL_COUNT = 6;
+    static constexpr u64 MAXIMUM_TICK_DELTA = (1ull << (SLOT_BITS * LEVEL_COUNT)) - 1;
+
+    struct Level {
+        Array<List, SLOTS_PER_LEVEL> slots;
+        u64 occupied_slots { 0 };
+    };
+
+    u64 tick_for(MonotonicTime time) const
+    {
+        return static_cast<u64>(max<i64>(0, (time - m_start_time).to_truncated_milliseconds()));
+    }
+
+    static size_t slot_index(u64 tick, size_t level)
+    {
+        return (tick >> (SLOT_BITS * level)) & SLOT_MASK;
+    }
+
+    // Places an entry into the slot of the lowest level whose range still covers its tick.
+    void place(T& entry, u64 tick)
+    {
+        VERIFY(tick >= m_current_tick);
+
+        auto delta = min(tick - m_current_tick, MAXIMUM_TICK_DELTA);
+        tick = m_current_tick + delta;
+
+        size_t level = 0;
+        while (delta >= (1ull << (SLOT_BITS * (level + 1))))
+            ++level;
+
+        auto index = slot_index(tick, level);
+        m_levels[level].slots[index].append(entry);
+        m_levels[level].occupied_slots |= 1ull << index;
+    }
+
+    List* first_occupied_slot(size_t level)
+    {
+        auto& occupied_slots = m_levels[level].occupied_slots;
+        auto first_index = (slot_index(m_current_tick, level) + 1) & SLOT_MASK;
+
+        while (occupied_slots != 0) {
+            auto rotated_slots = first_index == 0 ? occupied_slots : (occupied_slots >> first_index) | (occupied_slots << (SLOTS_PER_LEVEL - first_index));
+            auto index = (first_index + count_trailing_zeroes(rotated_slots)) & SLOT_MASK;
+
+            auto& slot = m_levels[level].slots[index];
+            if (!slot.is_empty())
+                return &slot;
+
+            occupied_slots &= ~(1ull << index);
+        }
+
+        return nullptr;
+    }
+
+    void expire_slot(size_t index, u64 tick, Vector<T*>& expired)
+    {
+        auto& slot = m_levels[0].slots[index];
+        m_levels[0].occupied_slots &= ~(1ull << index);
+
+        while (!slot.is_empty()) {
+            auto& entry = *slot.take_first();
+
+            // Entries within the tick we are advancing to may still be slightly in the future.
+            if (tick == m_current_tick_target)
+                m_current_tick_entries.append(entry);
+            else
+                expired.append(&entry);
+        }
+    }
+
+    void cascade()
+    {
+        for (size_t level = 1; level < LEVEL_COUNT; ++level) {
+            auto index = slot_index(m_current_tick, level);
+            auto& slot = m_levels[level].slots[index];
+            m_levels[level].occupied_slots &= ~(1ull << index);
+
+            while (!slot.is_empty()) {
+                auto& entry = *slot.take_first();
+                place(entry, max(tick_for(entry.deadline()), m_current_tick));
+            }
+
+            // The next level only reaches the start of a slot when this level wraps around.
+            if (index != 0)
+                break;
+        }
+    }
+
+    void advance_to(u64 target_tick, Vector<T*>& expired)
+    {
+        if (target_tick <= m_current_tick)
+            return;
+
+        // OPTIMIZATION: An empty wheel has nothing to expire or cascade, so we can jump straight to the target.
+        if (m_size == m_current_tick_entries.size_slow()) {
+            m_current_tick = target_tick;
+            return;
+        }
+
+        // Entries from the tick we are leaving behind have all expired by now.
+        while (!m_current_tick_entries.is_empty())
+            expired.append(m_current_tick_entries.take_first());
+
+        m_current_tick_target = target_tick;
+
+        while (m_current_tick < target_tick) {
+            // Expire the occupied slots of the lowest level up to the end of its current rotation, or the target.
+            auto last_tick = min(target_tick, m_current_tick | SLOT_MASK);
+
+            if (last_tick > m_current_tick) {
+                auto first_index = (m_current_tick & SLOT_MASK) + 1;
+                auto last_index = last_tick & SLOT_MASK;
+
+                auto range_mask = (last_index == SLOT_MASK ? ~0ull : (1ull << (last_index + 1)) - 1) & ~((1ull << first_index) - 1);
+                auto slots_to_expire = m_levels[0].occupied_slots & range_mask;
+
+                while (slots_to_expire != 0) {
+                    auto index = count_trailing_zeroes(slots_to_expire);
+                    slots_to_expire &= slots_to_expire - 1;
+                    expire_slot(index, (m_current_tick & ~SLOT_MASK) | index, expired);
+                }
+
+                m_current_tick = last_tick;
+                continue;
+            }
+
+            // Start the next rotation of the lowest level, which brings the next slot of the level above it down.
+            ++m_current_tick;
+            cascade();
+
+            if (m_levels[0].occupied_slots & 1)
+                expire_slot(0, m_current_tick, expired);
+        }
+    }
+
+    MonotonicTime m_start_time;
+    u64 m_current_tick { 0 };
+    u64 m_current_tick_target { 0 };
+
+    Array<Level, LEVEL_COUNT> m_levels;
+    List m_current_tick_entries;
+
+    size_t m_size { 0 };
+    Optional<MonotonicTime> m_next_deadline;
+};
+
+}
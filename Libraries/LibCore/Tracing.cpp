@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
+#include <LibCore/System.h>
+#include <LibCore/Tracing.h>
+#include <LibThreading/Mutex.h>
+
+namespace Core::Tracing {
+
+Atomic<bool> g_is_enabled { false };
+
+namespace {
+
+struct Event {
+    enum class Type : u8 {
+        Complete,
+        Counter,
+        Async,
+    };
+
+    char const* category { nullptr };
+    char const* name { nullptr };
+    i64 timestamp_nanoseconds { 0 };
+    // The duration of complete and async events, and the value of counters.
+    i64 duration_nanoseconds_or_value { 0 };
+    u64 async_id { 0 };
+    Type type { Type::Complete };
+};
+
+// Every thread only ever writes to its own buffer, so its lock is only contended while the events are being taken.
+struct ThreadBuffer {
+    static constexpr size_t capacity = 32 * KiB;
+
+    explicit ThreadBuffer(u32 thread_id)
+        : thread_id(thread_id)
+    {
+    }
+
+    void append(Event const& event)
+    {
+        Threading::MutexLocker locker { lock };
+        if (events.size() < capacity) {
+            events.append(event);
+            return;
+        }
+        events[next_index_to_overwrite] = event;
+        next_index_to_overwrite = (next_index_to_overwrite + 1) % capacity;
+    }
+
+    Threading::Mutex lock;
+    Vector<Event> events;
+    size_t next_index_to_overwrite { 0 };
+    u32 thread_id { 0 };
+};
+
+}
+
+static Threading::Mutex s_thread_buffers_lock;
+static Vector<NonnullOwnPtr<ThreadBuffer>> s_thread_buffers;
+
+// NB: The buffers of threads that have exited are kept around, so that their events can still be taken.
+static thread_local ThreadBuffer* t_thread_buffer { nullptr };
+
+static ThreadBuffer& thread_buffer()
+{
+    if (!t_thread_buffer) [[unlikely]] {
+        Threading::MutexLocker locker { s_thread_buffers_lock };
+        auto buffer = make<ThreadBuffer>(static_cast<u32>(s_thread_buffers.size() + 1));
+        t_thread_buffer = buffer.ptr();
+        s_thread_buffers.append(move(buffer));
+    }
+    return *t_thread_buffer;
+}
+
+void set_enabled(bool enabled)
+{
+    if (enabled) {
+        Threading::MutexLocker locker { s_thread_buffers_lock };
+        for (auto& buffer : s_thread_buffers) {
+            Threading::MutexLocker buffer_locker { buffer->lock };
+            buffer->events.clear_with_capacity();
+            buffer->next_index_to_overwrite = 0;
+        }
+    }
+
+    g_is_enabled.store(enabled, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void record_complete_event(char const* category, char const* name, i64 start_nanoseconds, i64 end_nanoseconds)
+{
+    thread_buffer().append({
+        .category = category,
+        .name = name,
+        .timestamp_nanoseconds = start_nanoseconds,
+        .duration_nanoseconds_or_value = end_nanoseconds - start_nanoseconds,
+        .type = Event::Type::Complete,
+    });
+}
+
+void record_counter(char const* category, char const* name, i64 value)
+{
+    thread_buffer().append({
+        .category = category,
+        .name = name,
+        .timestamp_nanoseconds = MonotonicTime::now().nanoseconds(),
+        .duration_nanoseconds_or_value = value,
+        .type = Event::Type::Counter,
+    });
+}
+
+void record_async_event(char const* category, char const* name, u64 id, i64 start_nanoseconds, i64 end_nanoseconds)
+{
+    thread_buffer().append({
+        .category = category,
+        .name = name,
+        .timestamp_nanoseconds = start_nanoseconds,
+        .duration_nanoseconds_or_value = end_nanoseconds - start_nanoseconds,
+        .async_id = id,
+        .type = Event::Type::Async,
+    });
+}
+
+// The trace event format has timestamps and durations in microseconds, which might be fractional.
+static void append_microseconds(StringBuilder& builder, i64 nanoseconds)
+{
+    builder.appendff("{}.{:03}", nanoseconds / 1000, nanoseconds % 1000);
+}
+
+static void append_event_fields(StringBuilder& builder, Event const& event, int pid, u32 thread_id, i64 timestamp_nanoseconds)
+{
+    builder.append("{\"name\":\""sv);
+    builder.append_escaped_for_json(StringView { event.name, strlen(event.name) });
+    builder.append("\",\"cat\":\""sv);
+    builder.append_escaped_for_json(StringView { event.category, strlen(event.category) });
+    builder.appendff("\",\"pid\":{},\"tid\":{},\"ts\":", pid, thread_id);
+    append_microseconds(builder, timestamp_nanoseconds);
+}
+
+static void append_event(StringBuilder& builder, Event const& event, int pid, u32 thread_id)
+{
+    append_event_fields(builder, event, pid, thread_id, event.timestamp_nanoseconds);
+
+    switch (event.type) {
+    case Event::Type::Complete:
+        builder.append(",\"ph\":\"X\",\"dur\":"sv);
+        append_microseconds(builder, event.duration_nanoseconds_or_value);
+        builder.append('}');
+        break;
+    case Event::Type::Counter:
+        builder.appendff(",\"ph\":\"C\",\"args\":{{\"value\":{}}}}}", event.duration_nanoseconds_or_value);
+        break;
+    case Event::Type::Async:
+        // Async events are written as a pair of events that begin and end them.
+        builder.appendff(",\"ph\":\"b\",\"id\":\"{:#x}\"}},", event.async_id);
+        append_event_fields(builder, event, pid, thread_id, event.timestamp_nanoseconds + event.duration_nanoseconds_or_value);
+        builder.appendff(",\"ph\":\"e\",\"id\":\"{:#x}\"}}", event.async_id);
+        break;
+    }
+}
+
+ByteString take_events_as_json()
+{
+    auto pid = System::getpid();
+
+    StringBuilder builder;
+    bool first = true;
+
+    Threading::MutexLocker locker { s_thread_buffers_lock };
+    for (auto& buffer : s_thread_buffers) {
+        Threading::MutexLocker buffer_locker { buffer->lock };
+
+        // Once the ring buffer has wrapped around, its oldest event is the one that would be overwritten next.
+        auto event_count = buffer->events.size();
+        for (size_t i = 0; i < event_count; ++i) {
+            auto const& event = buffer->events[(buffer->next_index_to_overwrite + i) % event_count];
+            if (!first)
+                builder.append(',');
+            first = false;
+            append_event(builder, event, pid, buffer->thread_id);
+        }
+
+        buffer->events.clear_with_capacity();
+        buffer->next_index_to_overwrite = 0;
+    }
+
+    return builder.to_byte_string();
+}
+
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/ByteString.h>
+#include <AK/Noncopyable.h>
+#include <AK/Time.h>
+#include <LibCore/Export.h>
+
+// Trace events record what a process spends its time on, to be looked at in a trace viewer like https://ui.perfetto.dev
+// or chrome://tracing. Nothing is recorded unless tracing has been enabled at runtime. While it is, every thread writes
+// its events into a ring buffer of its own, which only keeps the most recent ones.
+//
+// Categories and names must be string literals (or otherwise live forever), as only pointers to them are recorded.
+namespace Core::Tracing {
+
+CORE_API extern Atomic<bool> g_is_enabled;
+
+ALWAYS_INLINE bool is_enabled()
+{
+    return g_is_enabled.load(AK::MemoryOrder::memory_order_relaxed);
+}
+
+// Enabling tracing discards the events that were recorded before.
+CORE_API void set_enabled(bool);
+
+CORE_API void record_complete_event(char const* category, char const* name, i64 start_nanoseconds, i64 end_nanoseconds);
+CORE_API void record_counter(char const* category, char const* name, i64 value);
+
+// Unlike complete events, async events may overlap other events of the same thread, e.g. the phases of network requests
+// that are in flight at the same time. Events with the same category and ID are shown on the same track.
+CORE_API void record_async_event(char const* category, char const* name, u64 id, i64 start_nanoseconds, i64 end_nanoseconds);
+
+// Returns the events this process has recorded as the members of a JSON array of events in the Chrome trace event
+// format, i.e. without the surrounding brackets, so that the events of several processes can simply be concatenated.
+// The returned events are removed from the ring buffers.
+CORE_API ByteString take_events_as_json();
+
+class ScopedEvent {
+    AK_MAKE_NONCOPYABLE(ScopedEvent);
+    AK_MAKE_NONMOVABLE(ScopedEvent);
+
+public:
+    ALWAYS_INLINE ScopedEvent(char const* category, char const* name)
+    {
+        if (!is_enabled()) [[likely]]
+            return;
+        m_category = category;
+        m_name = name;
+        m_start_nanoseconds = MonotonicTime::now().nanoseconds();
+    }
+
+    ALWAYS_INLINE ~ScopedEvent()
+    {
+        if (m_name) [[unlikely]]
+            record_complete_event(m_category, m_name, m_start_nanoseconds, MonotonicTime::now().nanoseconds());
+    }
+
+private:
+    char const* m_category { nullptr };
+    char const* m_name { nullptr };
+    i64 m_start_nanoseconds { 0 };
+};
+
+}
+
+#define CORE_TRACING_CONCAT_IMPL(a, b) a##b
+#define CORE_TRACING_CONCAT(a, b) CORE_TRACING_CONCAT_IMPL(a, b)
+
+// Records the time from here to the end of the enclosing scope as an event.
+#define TRACE_EVENT(category, name) \
+    Core::Tracing::ScopedEvent CORE_TRACING_CONCAT(trace_event_, __LINE__) { category, name }
+
+// Records the current value of a counter, e.g. the number of requests in flight.
+#define TRACE_COUNTER(category, name, value)                        \
+    do {                                                            \
+        if (Core::Tracing::is_enabled()) [[unlikely]]               \
+            Core::Tracing::record_counter(category, name, (value)); \
+    } while (0)
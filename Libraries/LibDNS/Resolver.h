@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/AnyOf.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/CountingStream.h>
 #include <AK/HashTable.h>
@@ -83,6 +84,10 @@ public:
         return has_record_of_type(Messages::ResourceType::A) || has_record_of_type(Messages::ResourceType::AAAA);
     }
 
+    // Records that have expired are kept for this long, so that they can be served while they are being revalidated.
+    // https://www.rfc-editor.org/rfc/rfc8767#section-5
+    static constexpr AK::Duration max_stale_duration = AK::Duration::from_seconds(24 * 60 * 60);
+
     void check_expiration()
     {
         if (!m_valid)
@@ -91,7 +96,7 @@ public:
         auto now = AK::UnixDateTime::now();
         for (size_t i = 0; i < m_cached_records.size();) {
             auto& record = m_cached_records[i];
-            if (record.expiration.has_value() && record.expiration.value() < now) {
+            if (record.expiration.has_value() && record.expiration.value() + max_stale_duration < now) {
                 dbgln_if(DNS_DEBUG, "DNS: Removing expired record for {}", m_name.to_string());
                 m_cached_records.remove(i);
             } else {
@@ -105,13 +110,33 @@ public:
             m_valid = false;
     }
 
+    bool is_stale() const
+    {
+        auto now = AK::UnixDateTime::now();
+        return any_of(m_cached_records, [&](auto const& record) {
+            return record.expiration.has_value() && record.expiration.value() < now;
+        });
+    }
+
     void add_record(Messages::ResourceRecord record)
     {
-        m_valid = true;
         auto expiration = record.ttl > 0 ? Optional<AK::UnixDateTime>(AK::UnixDateTime::now() + AK::Duration::from_seconds(record.ttl)) : OptionalNone();
+        add_record(move(record), move(expiration));
+    }
+
+    void add_record(Messages::ResourceRecord record, Optional<AK::UnixDateTime> expiration)
+    {
+        m_valid = true;
         m_cached_records.append({ move(record), move(expiration) });
     }
 
+    struct RecordWithExpiration {
+        Messages::ResourceRecord record;
+        Optional<AK::UnixDateTime> expiration;
+    };
+
+    ReadonlySpan<RecordWithExpiration> records_with_expiration() const { return m_cached_records; }
+
     Vector<Messages::ResourceRecord> records() const
     {
         Vector<Messages::ResourceRecord> result;
@@ -191,11 +216,6 @@ private:
     bool m_being_dnssec_validated { false };
     Messages::DomainName m_name;
 
-    struct RecordWithExpiration {
-        Messages::ResourceRecord record;
-        Optional<AK::UnixDateTime> expiration;
-    };
-
     Vector<RecordWithExpiration> m_cached_records;
     HashTable<Messages::ResourceType> m_desired_types;
     Vector<Messages::Records::DNSKEY> m_used_dnskeys {};
@@ -299,6 +319,9 @@ public:
                 return {};
 
             auto& result = *it->value;
+            if (result.is_stale())
+                return {};
+
             for (auto const& type : desired_types) {
                 if (!result.has_record_of_type(type))
                     return {};
@@ -308,9 +331,81 @@ public:
         });
     }
 
+    // The address records in the cache that expire, e.g. to persist them across restarts.
+    struct CachedAddress {
+        ByteString name;
+        Variant<IPv4Address, IPv6Address> address;
+        AK::UnixDateTime expiration;
+    };
+
+    Vector<CachedAddress> cached_addresses_with_expiration()
+    {
+        Vector<CachedAddress> addresses;
+        m_cache.with_read_locked([&](auto& cache) {
+            for (auto const& [name, result] : cache) {
+                for (auto const& record : result->records_with_expiration()) {
+                    if (!record.expiration.has_value())
+                        continue;
+                    record.record.record.visit(
+                        [&](Messages::Records::A const& a) { addresses.append({ name, a.address, *record.expiration }); },
+                        [&](Messages::Records::AAAA const& aaaa) { addresses.append({ name, aaaa.address, *record.expiration }); },
+                        [](auto const&) {});
+                }
+            }
+        });
+        return addresses;
+    }
+
+    // Adds address records to the cache for names that aren't cached yet. They are served like any other records,
+    // i.e. they are revalidated when they are used after they've expired.
+    void add_cached_addresses(ReadonlySpan<CachedAddress> addresses)
+    {
+        m_cache.with_write_locked([&](auto& cache) {
+            HashTable<ByteString> names_cached_before;
+            for (auto const& [name, result] : cache)
+                names_cached_before.set(name);
+
+            for (auto const& address : addresses) {
+                if (names_cached_before.contains(address.name))
+                    continue;
+
+                auto& result = cache.ensure(address.name, [&] {
+                    auto result = make_ref_counted<LookupResult>(Messages::DomainName::from_string(address.name));
+                    result->will_add_record_of_type(Messages::ResourceType::A);
+                    result->will_add_record_of_type(Messages::ResourceType::AAAA);
+                    result->finished_request();
+                    return result;
+                });
+
+                auto ttl = static_cast<u32>(max<i64>(0, (address.expiration - AK::UnixDateTime::now()).to_seconds()));
+                address.address.visit(
+                    [&](IPv4Address const& ipv4) {
+                        result->add_record({ .name = result->name(), .type = Messages::ResourceType::A, .class_ = Messages::Class::IN, .ttl = ttl, .record = Messages::Records::A { ipv4 }, .raw = {} }, address.expiration);
+                    },
+                    [&](IPv6Address const& ipv6) {
+                        result->add_record({ .name = result->name(), .type = Messages::ResourceType::AAAA, .class_ = Messages::Class::IN, .ttl = ttl, .record = Messages::Records::AAAA { ipv6 }, .raw = {} }, address.expiration);
+                    });
+            }
+        });
+    }
+
     NonnullRefPtr<Core::Promise<NonnullRefPtr<LookupResult const>>> lookup(ByteString name, Messages::Class class_, Vector<Vector<Messages::ResourceType>> desired_types, LookupOptions options = LookupOptions::default_())
     {
         using ResultPromise = Core::Promise<NonnullRefPtr<LookupResult const>>;
+
+        Vector<Messages::ResourceType> all_desired_types;
+        for (auto const& types : desired_types)
+            all_desired_types.extend(types);
+
+        if (auto stale_result = take_stale_result_for_revalidation(name, all_desired_types, options)) {
+            auto revalidation = lookup(name, class_, desired_types, options);
+            restore_stale_result_if_revalidation_fails(*revalidation, name, *stale_result);
+
+            auto promise = ResultPromise::construct();
+            promise->resolve(stale_result.release_nonnull());
+            return promise;
+        }
+
         Vector<NonnullRefPtr<ResultPromise>> promises;
         promises.ensure_capacity(desired_types.size());
 
@@ -382,6 +477,14 @@ public:
             }
         }
 
+        if (auto stale_result = take_stale_result_for_revalidation(name, desired_types, options)) {
+            auto revalidation = lookup(name, class_, desired_types, options);
+            restore_stale_result_if_revalidation_fails(*revalidation, name, *stale_result);
+
+            promise->resolve(stale_result.release_nonnull());
+            return promise;
+        }
+
         if (auto result = lookup_in_cache(name, class_, desired_types)) {
             dbgln_if(DNS_DEBUG, "DNS: Resolving {} from cache...", name);
             if (!options.validate_dnssec_locally || result->is_dnssec_validated()) {
@@ -429,7 +532,8 @@ public:
         auto result = m_cache.with_write_locked([&](auto& cache) -> NonnullRefPtr<LookupResult> {
             dbgln_if(DNS_DEBUG, "DNS: Resolving {}...", name);
             auto existing = [&] -> RefPtr<LookupResult> {
-                if (cache.contains(name)) {
+                // NB: Stale entries are only served while being revalidated, which never reaches this point.
+                if (cache.contains(name) && !(*cache.get(name))->is_stale()) {
                     dbgln_if(DNS_DEBUG, "DNS: Resolving {} from cache...", name);
                     auto ptr = *cache.get(name);
 
@@ -441,6 +545,13 @@ public:
                         }
                     }
 
+                    // NB: Lookups of other types for the same name (e.g. the AAAA lookup that is made at the same time as
+                    //     an A lookup) share this entry, so later lookups of this type can join the one we're about to make.
+                    if (!already_in_cache) {
+                        for (auto const& type : desired_types)
+                            ptr->will_add_record_of_type(type);
+                    }
+
                     dbgln_if(DNS_DEBUG, "DNS: Found {} in cache, already_in_cache={}", name, already_in_cache);
                     dbgln_if(DNS_DEBUG, "DNS: That entry is {} DNSSEC validated", ptr->is_dnssec_validated() ? "already" : "not");
                     for (auto const& entry : ptr->records())
@@ -607,6 +718,46 @@ public:
     }
 
 private:
+    // Answers that have expired are served for a while longer, and are revalidated in the background at the same time,
+    // so that looking up a name that was looked up before does not have to wait for the network.
+    // https://www.rfc-editor.org/rfc/rfc8767#section-5
+    RefPtr<LookupResult> take_stale_result_for_revalidation(StringView name, ReadonlySpan<Messages::ResourceType> desired_types, LookupOptions const& options)
+    {
+        // NB: Stale answers could not be validated again before they are used.
+        if (options.validate_dnssec_locally || options.repeating_lookup)
+            return {};
+
+        return m_cache.with_write_locked([&](auto& cache) -> RefPtr<LookupResult> {
+            auto it = cache.find(name);
+            if (it == cache.end() || !it->value->is_stale())
+                return {};
+
+            // NB: Types that were looked up but had no records (e.g. AAAA for a name without IPv6 addresses) count as
+            //     cached, so that such names can be served from stale entries as well.
+            auto result = it->value;
+            for (auto const& type : desired_types) {
+                if (!result->has_record_of_type(type, true))
+                    return {};
+            }
+
+            dbgln_if(DNS_DEBUG, "DNS: Resolving {} from a stale cache entry, and revalidating it", name);
+
+            // The revalidating lookup then replaces the entry, as if the name had not been cached at all.
+            cache.remove(it);
+            return result;
+        });
+    }
+
+    void restore_stale_result_if_revalidation_fails(Core::Promise<NonnullRefPtr<LookupResult const>>& revalidation, ByteString name, NonnullRefPtr<LookupResult> stale_result)
+    {
+        revalidation.when_rejected([this, name = move(name), stale_result = move(stale_result)](auto const& error) {
+            dbgln_if(DNS_DEBUG, "DNS: Revalidating {} failed: {}", name, error);
+            m_cache.with_write_locked([&](auto& cache) {
+                cache.set(name, stale_result);
+            });
+        });
+    }
+
     ErrorOr<Messages::Message> parse_one_message()
     {
         if (m_mode == ConnectionMode::UDP)
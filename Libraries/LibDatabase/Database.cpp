@@ -78,6 +78,9 @@ ErrorOr<NonnullRefPtr<Database>> Database::create(sqlite3* sql_database, Optiona
     TRY(database->set_journal_mode_pragma(JournalMode::WriteAheadLog));
     TRY(database->set_synchronous_pragma(Synchronous::Normal));
 
+    database->m_begin_transaction_statement = TRY(database->prepare_statement("BEGIN TRANSACTION;"sv));
+    database->m_commit_transaction_statement = TRY(database->prepare_statement("COMMIT;"sv));
+
     return database;
 }
 
@@ -96,6 +99,21 @@ Database::~Database()
     sqlite3_close(m_database);
 }
 
+Database::Transaction::Transaction(Database& database)
+    : m_database(database)
+{
+    if (m_database.m_transaction_depth++ == 0)
+        m_database.execute_statement(m_database.m_begin_transaction_statement, {});
+}
+
+Database::Transaction::~Transaction()
+{
+    VERIFY(m_database.m_transaction_depth > 0);
+
+    if (--m_database.m_transaction_depth == 0)
+        m_database.execute_statement(m_database.m_commit_transaction_statement, {});
+}
+
 ErrorOr<StatementID> Database::prepare_statement(StringView statement)
 {
     sqlite3_stmt* prepared_statement { nullptr };
@@ -243,4 +261,36 @@ ErrorOr<void> Database::set_synchronous_pragma(Synchronous synchronous)
     return {};
 }
 
+ErrorOr<void> Database::set_wal_autocheckpoint_pragma(u32 page_count)
+{
+    auto pragma = ByteString::formatted("PRAGMA wal_autocheckpoint={};", page_count);
+    SQL_TRY(sqlite3_exec(m_database, pragma.characters(), nullptr, nullptr, nullptr));
+
+    return {};
+}
+
+ErrorOr<void> Database::checkpoint(CheckpointMode mode)
+{
+    // NB: A checkpoint cannot include the statements of a transaction that has not been committed yet.
+    VERIFY(!is_in_transaction());
+
+    auto sqlite_mode = [&]() {
+        switch (mode) {
+        case CheckpointMode::Passive:
+            return SQLITE_CHECKPOINT_PASSIVE;
+        case CheckpointMode::Full:
+            return SQLITE_CHECKPOINT_FULL;
+        case CheckpointMode::Restart:
+            return SQLITE_CHECKPOINT_RESTART;
+        case CheckpointMode::Truncate:
+            return SQLITE_CHECKPOINT_TRUNCATE;
+        }
+        VERIFY_NOT_REACHED();
+    }();
+
+    SQL_TRY(sqlite3_wal_checkpoint_v2(m_database, nullptr, sqlite_mode, nullptr, nullptr));
+
+    return {};
+}
+
 }
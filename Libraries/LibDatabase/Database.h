@@ -10,6 +10,7 @@
 #include <AK/Error.h>
 #include <AK/Function.h>
 #include <AK/LexicalPath.h>
+#include <AK/Noncopyable.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/RefCounted.h>
 #include <AK/StringView.h>
@@ -52,6 +53,24 @@ public:
     template<typename ValueType>
     ValueType result_column(StatementID, int column);
 
+    // Runs all statements that are executed while it is alive in a single transaction, which is committed once it goes
+    // out of scope. This is much faster than having each statement commit on its own when writing many rows at once.
+    // Transactions may be nested, in which case the statements are committed with the outermost transaction.
+    class DATABASE_API Transaction {
+        AK_MAKE_NONCOPYABLE(Transaction);
+        AK_MAKE_NONMOVABLE(Transaction);
+
+    public:
+        explicit Transaction(Database&);
+        ~Transaction();
+
+    private:
+        Database& m_database;
+    };
+
+    [[nodiscard]] Transaction begin_transaction() { return Transaction { *this }; }
+    bool is_in_transaction() const { return m_transaction_depth > 0; }
+
     // https://www.sqlite.org/pragma.html#pragma_journal_mode
     enum class JournalMode {
         Delete,
@@ -72,6 +91,18 @@ public:
     };
     ErrorOr<void> set_synchronous_pragma(Synchronous);
 
+    // https://www.sqlite.org/pragma.html#pragma_wal_autocheckpoint
+    ErrorOr<void> set_wal_autocheckpoint_pragma(u32 page_count);
+
+    // https://www.sqlite.org/c3ref/wal_checkpoint_v2.html
+    enum class CheckpointMode {
+        Passive,
+        Full,
+        Restart,
+        Truncate,
+    };
+    ErrorOr<void> checkpoint(CheckpointMode);
+
 private:
     static ErrorOr<NonnullRefPtr<Database>> create(sqlite3*, Optional<LexicalPath> database_path = {});
     Database(sqlite3*, Optional<LexicalPath> database_path);
@@ -92,6 +123,10 @@ private:
     Optional<LexicalPath> m_database_path;
     sqlite3* m_database { nullptr };
     Vector<sqlite3_stmt*> m_prepared_statements;
+
+    StatementID m_begin_transaction_statement { 0 };
+    StatementID m_commit_transaction_statement { 0 };
+    size_t m_transaction_depth { 0 };
 };
 
 }
@@ -30,30 +30,45 @@
 
 namespace GC {
 
-BlockAllocator::~BlockAllocator()
+static void release_block(void* block)
 {
-    for (auto* block : m_blocks) {
-        ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::BLOCK_SIZE);
+    ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::BLOCK_SIZE);
 #if defined(AK_OS_MACOS)
-        kern_return_t kr = mach_vm_deallocate(mach_task_self(), reinterpret_cast<mach_vm_address_t>(block), HeapBlock::BLOCK_SIZE);
-        VERIFY(kr == KERN_SUCCESS);
+    kern_return_t kr = mach_vm_deallocate(mach_task_self(), reinterpret_cast<mach_vm_address_t>(block), HeapBlock::BLOCK_SIZE);
+    VERIFY(kr == KERN_SUCCESS);
 #elif defined(AK_OS_WINDOWS)
-        if (!VirtualFree(block, 0, MEM_RELEASE)) {
-            warnln("{}", Error::from_windows_error());
-            VERIFY_NOT_REACHED();
-        }
+    if (!VirtualFree(block, 0, MEM_RELEASE)) {
+        warnln("{}", Error::from_windows_error());
+        VERIFY_NOT_REACHED();
+    }
 #else
-        free(block);
+    free(block);
 #endif
-    }
+}
+
+BlockAllocator::~BlockAllocator()
+{
+    for (auto& committed_block : m_committed_blocks)
+        release_block(committed_block.block);
+    for (auto* block : m_decommitted_blocks)
+        release_block(block);
 }
 
 void* BlockAllocator::allocate_block([[maybe_unused]] char const* name)
 {
-    if (!m_blocks.is_empty()) {
-        // To reduce predictability, take a random block from the cache.
-        size_t random_index = get_random_uniform(m_blocks.size());
-        auto* block = m_blocks.unstable_take(random_index);
+    // To reduce predictability, take a random block from the cache. We prefer blocks that are still committed, as
+    // reusing those does not have to fault in any memory.
+    if (!m_committed_blocks.is_empty()) {
+        size_t random_index = get_random_uniform(m_committed_blocks.size());
+        auto* block = m_committed_blocks.unstable_take(random_index).block;
+        ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::BLOCK_SIZE);
+        LSAN_REGISTER_ROOT_REGION(block, HeapBlock::BLOCK_SIZE);
+        return block;
+    }
+
+    if (!m_decommitted_blocks.is_empty()) {
+        size_t random_index = get_random_uniform(m_decommitted_blocks.size());
+        auto* block = m_decommitted_blocks.unstable_take(random_index);
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::BLOCK_SIZE);
         LSAN_REGISTER_ROOT_REGION(block, HeapBlock::BLOCK_SIZE);
 #if defined(MADV_FREE_REUSE) && defined(MADV_FREE_REUSABLE)
@@ -97,6 +112,13 @@ void BlockAllocator::deallocate_block(void* block)
 {
     VERIFY(block);
 
+    ASAN_POISON_MEMORY_REGION(block, HeapBlock::BLOCK_SIZE);
+    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::BLOCK_SIZE);
+    m_committed_blocks.append({ block, MonotonicTime::now_coarse() });
+}
+
+void BlockAllocator::decommit_block(void* block)
+{
 #if defined(AK_OS_WINDOWS)
     DWORD ret = DiscardVirtualMemory(block, HeapBlock::BLOCK_SIZE);
     if (ret != ERROR_SUCCESS) {
@@ -108,21 +130,43 @@ void BlockAllocator::deallocate_block(void* block)
         perror("madvise(MADV_FREE_REUSABLE)");
         VERIFY_NOT_REACHED();
     }
-#elif defined(MADV_FREE)
-    if (madvise(block, HeapBlock::BLOCK_SIZE, MADV_FREE) < 0) {
-        perror("madvise(MADV_FREE)");
-        VERIFY_NOT_REACHED();
-    }
 #elif defined(MADV_DONTNEED)
+    // NB: We prefer MADV_DONTNEED over MADV_FREE, as memory freed with MADV_FREE keeps counting towards our resident
+    //     memory until the system itself is short on memory, which is too late when our memory is limited by other
+    //     means. The block has been unused for a while by now, so it is unlikely to be reused shortly anyway.
     if (madvise(block, HeapBlock::BLOCK_SIZE, MADV_DONTNEED) < 0) {
         perror("madvise(MADV_DONTNEED)");
         VERIFY_NOT_REACHED();
     }
+#elif defined(MADV_FREE)
+    if (madvise(block, HeapBlock::BLOCK_SIZE, MADV_FREE) < 0) {
+        perror("madvise(MADV_FREE)");
+        VERIFY_NOT_REACHED();
+    }
+#else
+    (void)block;
 #endif
+}
 
-    ASAN_POISON_MEMORY_REGION(block, HeapBlock::BLOCK_SIZE);
-    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::BLOCK_SIZE);
-    m_blocks.append(block);
+void BlockAllocator::decommit_blocks_cached_before(MonotonicTime time)
+{
+    m_committed_blocks.remove_all_matching([&](auto const& committed_block) {
+        if (committed_block.cached_since >= time)
+            return false;
+
+        decommit_block(committed_block.block);
+        m_decommitted_blocks.append(committed_block.block);
+        return true;
+    });
+}
+
+void BlockAllocator::decommit_all_cached_blocks()
+{
+    for (auto& committed_block : m_committed_blocks) {
+        decommit_block(committed_block.block);
+        m_decommitted_blocks.append(committed_block.block);
+    }
+    m_committed_blocks.clear();
 }
 
 }
@@ -6,11 +6,16 @@
 
 #pragma once
 
+#include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibGC/Forward.h>
 
 namespace GC {
 
+// Blocks that are deallocated are cached for reuse, so that they are only ever reused for cells of the same type. Their
+// memory stays committed for a while, as blocks are often reused shortly after, e.g. when a collection runs in the
+// middle of a burst of allocations. Blocks that stay unused for longer are decommitted, i.e. their memory is returned
+// to the system.
 class GC_API BlockAllocator {
 public:
     BlockAllocator() = default;
@@ -19,10 +24,24 @@ public:
     void* allocate_block(char const* name);
     void deallocate_block(void*);
 
-    auto const& blocks() const { return m_blocks; }
+    // Decommits all cached blocks that were deallocated before the given time.
+    void decommit_blocks_cached_before(MonotonicTime);
+    void decommit_all_cached_blocks();
+
+    size_t committed_cached_block_count() const { return m_committed_blocks.size(); }
+    size_t decommitted_cached_block_count() const { return m_decommitted_blocks.size(); }
+    size_t cached_block_count() const { return m_committed_blocks.size() + m_decommitted_blocks.size(); }
 
 private:
-    Vector<void*> m_blocks;
+    struct CommittedBlock {
+        void* block { nullptr };
+        MonotonicTime cached_since;
+    };
+
+    static void decommit_block(void*);
+
+    Vector<CommittedBlock> m_committed_blocks;
+    Vector<void*> m_decommitted_blocks;
 };
 
 }
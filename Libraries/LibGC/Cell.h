@@ -59,6 +59,10 @@ public:
     State state() const { return m_state; }
     void set_state(State state) { m_state = state; }
 
+    // A cell is young until it has survived its first garbage collection.
+    bool is_young() const { return m_young; }
+    void set_young(bool b) { m_young = b; }
+
     virtual StringView class_name() const = 0;
 
     class GC_API Visitor {
@@ -216,6 +220,7 @@ protected:
 
 private:
     bool m_mark { false };
+    bool m_young { true };
     State m_state { State::Live };
 };
 
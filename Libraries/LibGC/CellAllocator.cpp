@@ -5,6 +5,7 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/QuickSort.h>
 #include <LibGC/BlockAllocator.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
@@ -57,4 +58,35 @@ void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
     m_usable_blocks.append(block);
 }
 
+void CellAllocator::sort_usable_blocks_if_fragmented(Badge<Heap>)
+{
+    size_t usable_block_count = 0;
+    size_t live_cell_count = 0;
+    size_t cell_count = 0;
+
+    for (auto& block : m_usable_blocks) {
+        ++usable_block_count;
+        live_cell_count += block.live_cell_count_at_last_sweep();
+        cell_count += block.cell_count();
+    }
+
+    // Only bother once at least half of the cells in usable blocks are free, which means that their live cells would
+    // fit into half as many blocks.
+    if (usable_block_count < 2 || live_cell_count * 2 > cell_count)
+        return;
+
+    Vector<HeapBlock*> blocks;
+    blocks.ensure_capacity(usable_block_count);
+    while (!m_usable_blocks.is_empty())
+        blocks.unchecked_append(m_usable_blocks.take_first());
+
+    // NB: We allocate from the last usable block, so the most occupied blocks go last.
+    quick_sort(blocks, [](auto* a, auto* b) {
+        return a->live_cell_count_at_last_sweep() < b->live_cell_count_at_last_sweep();
+    });
+
+    for (auto* block : blocks)
+        m_usable_blocks.append(*block);
+}
+
 }
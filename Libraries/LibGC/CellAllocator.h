@@ -56,6 +56,10 @@ public:
     void block_did_become_empty(Badge<Heap>, HeapBlock&);
     void block_did_become_usable(Badge<Heap>, HeapBlock&);
 
+    // Reorders the usable blocks so that the most occupied ones are allocated from first, if many of their cells are
+    // free. Cells are never moved, so this gives the least occupied blocks a chance to become empty instead.
+    void sort_usable_blocks_if_fragmented(Badge<Heap>);
+
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
 
@@ -14,12 +14,14 @@
 #include <AK/JsonObject.h>
 #include <AK/LexicalPath.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <AK/StackInfo.h>
 #include <AK/StackUnwinder.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/File.h>
 #include <LibCore/StandardPaths.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
@@ -40,6 +42,10 @@ namespace GC {
 
 static Heap* s_the;
 
+// Blocks that are left empty by a collection often end up being reused shortly after, so we only decommit them once
+// they have been left unused for this long.
+static constexpr auto CACHED_BLOCK_DECOMMIT_DELAY = AK::Duration::from_seconds(10);
+
 Heap& Heap::the()
 {
     return *s_the;
@@ -64,6 +70,37 @@ Heap::~Heap()
     collect_garbage(CollectionType::CollectEverything);
 }
 
+void Heap::set_sizing_policy(HeapSizingPolicy policy)
+{
+    VERIFY(policy.live_bytes_growth_factor > 0);
+    VERIFY(policy.target_gc_overhead >= 0 && policy.target_gc_overhead < 1);
+    m_sizing_policy = policy;
+    m_gc_overhead_scale = 1.0;
+    update_gc_bytes_threshold({});
+}
+
+void Heap::update_gc_bytes_threshold(AK::Duration time_spent_collecting)
+{
+    auto const& policy = m_sizing_policy;
+
+    if (policy.target_gc_overhead > 0) {
+        auto now = MonotonicTime::now();
+        auto time_spent_mutating = (now - m_last_collection_end_time) - time_spent_collecting;
+        auto total_microseconds = time_spent_mutating.to_microseconds() + time_spent_collecting.to_microseconds();
+        if (total_microseconds > 0 && time_spent_collecting.to_microseconds() > 0) {
+            auto overhead = static_cast<double>(time_spent_collecting.to_microseconds()) / static_cast<double>(total_microseconds);
+            // Move towards the target gradually, so a single slow or fast collection doesn't swing the threshold wildly.
+            auto adjustment = clamp(overhead / policy.target_gc_overhead, 0.5, 2.0);
+            m_gc_overhead_scale = clamp(m_gc_overhead_scale * adjustment, 1.0, 16.0);
+        }
+    }
+
+    auto threshold = static_cast<double>(m_live_bytes_after_last_gc) * policy.live_bytes_growth_factor * m_gc_overhead_scale;
+    if (policy.maximum_bytes_threshold != 0)
+        threshold = min(threshold, static_cast<double>(policy.maximum_bytes_threshold));
+    m_gc_bytes_threshold = max(static_cast<size_t>(threshold), policy.minimum_bytes_threshold);
+}
+
 void Heap::will_allocate(size_t size)
 {
     if (should_collect_on_every_allocation()) {
@@ -75,6 +112,7 @@ void Heap::will_allocate(size_t size)
     }
 
     m_allocated_bytes_since_last_gc += size;
+    m_total_allocated_bytes += size;
 }
 
 static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
@@ -112,7 +150,7 @@ void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_a
 }
 
 template<typename Callback>
-static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
+static void for_each_cell_among_possible_pointers(LiveHeapBlockSet const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
 {
     for (auto possible_pointer : possible_pointers.keys()) {
         if (!possible_pointer)
@@ -264,7 +302,7 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
+    LiveHeapBlockSet m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
@@ -272,7 +310,7 @@ private:
 AK::JsonObject Heap::dump_graph()
 {
     HashMap<Cell*, HeapRoot> roots;
-    HashTable<HeapBlock*> all_live_heap_blocks;
+    LiveHeapBlockSet all_live_heap_blocks;
     Vector<StackFrameInfo> stack_frames;
     gather_roots(roots, all_live_heap_blocks, &stack_frames);
     GraphConstructorVisitor visitor(*this, roots);
@@ -299,10 +337,12 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
 
     {
         TemporaryChange change(m_collecting_garbage, true);
+        TRACE_EVENT("gc", "Heap::collect_garbage");
 
-        Core::ElapsedTimer collection_measurement_timer;
-        if (print_report)
-            collection_measurement_timer.start();
+        auto collection_measurement_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        TemporaryChange measuring_change(m_is_measuring_collection, print_report || m_collection_statistics_callback);
+        if (m_is_measuring_collection)
+            m_last_collection_statistics = {};
 
         if (collection_type == CollectionType::CollectGarbage) {
             if (m_gc_deferrals) {
@@ -310,21 +350,97 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
                 return;
             }
             HashMap<Cell*, HeapRoot> roots;
-            HashTable<HeapBlock*> all_live_heap_blocks;
+            LiveHeapBlockSet all_live_heap_blocks;
             gather_roots(roots, all_live_heap_blocks);
+            if (m_is_measuring_collection)
+                m_last_collection_statistics.gather_roots_time = collection_measurement_timer.elapsed_time();
             mark_live_cells(roots, all_live_heap_blocks);
+            if (m_is_measuring_collection)
+                m_last_collection_statistics.mark_live_cells_time = collection_measurement_timer.elapsed_time() - m_last_collection_statistics.gather_roots_time;
         }
+        auto time_before_finalize = m_is_measuring_collection ? collection_measurement_timer.elapsed_time() : AK::Duration {};
         finalize_unmarked_cells();
+        if (m_is_measuring_collection)
+            m_last_collection_statistics.finalize_unmarked_cells_time = collection_measurement_timer.elapsed_time() - time_before_finalize;
         sweep_weak_blocks();
         sweep_dead_cells(print_report, collection_measurement_timer);
 
+        auto time_spent_collecting = collection_measurement_timer.elapsed_time();
+        update_gc_bytes_threshold(time_spent_collecting);
+        m_last_collection_end_time = MonotonicTime::now();
+
+        if (m_is_measuring_collection) {
+            m_last_collection_statistics.total_time = time_spent_collecting;
+            m_last_collection_statistics.live_bytes_after_collection = m_live_bytes_after_last_gc;
+        }
+
         if (print_report)
             dump_allocators();
     }
 
+    if (m_collection_statistics_callback)
+        m_collection_statistics_callback(m_last_collection_statistics);
+
     run_post_gc_tasks();
 }
 
+void Heap::set_collection_statistics_callback(AK::Function<void(CollectionStatistics const&)> callback)
+{
+    m_collection_statistics_callback = move(callback);
+}
+
+bool Heap::collect_garbage_if_past_idle_threshold()
+{
+    if (m_collecting_garbage || m_gc_deferrals)
+        return false;
+    if (m_allocated_bytes_since_last_gc < m_gc_bytes_threshold / 2)
+        return false;
+    m_allocated_bytes_since_last_gc = 0;
+    collect_garbage();
+    return true;
+}
+
+void Heap::release_unused_memory()
+{
+    collect_garbage();
+
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.block_allocator().decommit_all_cached_blocks();
+    m_last_block_decommit_time = MonotonicTime::now_coarse();
+}
+
+void Heap::decommit_unused_blocks()
+{
+    auto now = MonotonicTime::now_coarse();
+
+    // OPTIMIZATION: There are many allocators, so we don't look at them any more often than needed for blocks to be
+    //               decommitted within twice the delay.
+    if (now - m_last_block_decommit_time < CACHED_BLOCK_DECOMMIT_DELAY)
+        return;
+    m_last_block_decommit_time = now;
+
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.block_allocator().decommit_blocks_cached_before(now - CACHED_BLOCK_DECOMMIT_DELAY);
+}
+
+Heap::BlockStatistics Heap::block_statistics()
+{
+    BlockStatistics statistics;
+
+    for (auto& allocator : m_all_cell_allocators) {
+        statistics.committed_cached_block_count += allocator.block_allocator().committed_cached_block_count();
+        statistics.decommitted_cached_block_count += allocator.block_allocator().decommitted_cached_block_count();
+    }
+
+    for_each_block([&](HeapBlock& block) {
+        ++statistics.live_block_count;
+        statistics.fragmented_bytes += (block.cell_count() - block.live_cell_count_at_last_sweep()) * block.cell_size();
+        return IterationDecision::Continue;
+    });
+
+    return statistics;
+}
+
 void Heap::run_post_gc_tasks()
 {
     auto tasks = move(m_post_gc_tasks);
@@ -381,8 +497,9 @@ void Heap::dump_allocators()
         builder.appendff(" x {}", total_live_cells);
 
         size_t cost = blocks.size() * HeapBlock::BLOCK_SIZE / KiB;
-        size_t reserved = allocator.block_allocator().blocks().size() * HeapBlock::BLOCK_SIZE / KiB;
-        builder.appendff(", cost: {} KiB, reserved: {} KiB", cost, reserved);
+        size_t reserved = allocator.block_allocator().committed_cached_block_count() * HeapBlock::BLOCK_SIZE / KiB;
+        size_t decommitted = allocator.block_allocator().decommitted_cached_block_count() * HeapBlock::BLOCK_SIZE / KiB;
+        builder.appendff(", cost: {} KiB, reserved: {} KiB, decommitted: {} KiB", cost, reserved, decommitted);
 
         size_t total_dead_bytes = ((blocks.size() * cell_count) - total_live_cells) * allocator.cell_size();
         if (total_dead_bytes) {
@@ -400,6 +517,44 @@ void Heap::dump_allocators()
     dbgln("Total wasted on fragmentation: {} KiB", total_waste / KiB);
 }
 
+void Heap::dump_cell_statistics()
+{
+    struct ClassStatistics {
+        StringView class_name;
+        size_t live_cells { 0 };
+        size_t live_bytes { 0 };
+    };
+    HashMap<StringView, ClassStatistics> statistics_by_class_name;
+
+    size_t total_live_cells = 0;
+    size_t total_live_bytes = 0;
+    for_each_block([&](auto& block) {
+        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            // NB: Size-based allocators mix different classes in the same block, so we ask each cell.
+            auto class_name = cell->class_name();
+            auto& statistics = statistics_by_class_name.ensure(class_name, [&] { return ClassStatistics { .class_name = class_name }; });
+            ++statistics.live_cells;
+            statistics.live_bytes += block.cell_size();
+            ++total_live_cells;
+            total_live_bytes += block.cell_size();
+        });
+        return IterationDecision::Continue;
+    });
+
+    Vector<ClassStatistics> sorted_statistics;
+    sorted_statistics.ensure_capacity(statistics_by_class_name.size());
+    for (auto const& it : statistics_by_class_name)
+        sorted_statistics.unchecked_append(it.value);
+    quick_sort(sorted_statistics, [](auto const& a, auto const& b) { return a.live_bytes > b.live_bytes; });
+
+    dbgln("GC cell statistics");
+    dbgln("=============================================");
+    for (auto const& statistics : sorted_statistics)
+        dbgln("{:>10} KiB {:>10} cells  {}", statistics.live_bytes / KiB, statistics.live_cells, statistics.class_name);
+    dbgln("=============================================");
+    dbgln("{:>10} KiB {:>10} cells  (total)", total_live_bytes / KiB, total_live_cells);
+}
+
 void Heap::enqueue_post_gc_task(AK::Function<void()> task)
 {
     m_post_gc_tasks.append(move(task));
@@ -410,7 +565,7 @@ void Heap::register_sweep_callback(AK::Function<void()> callback)
     m_sweep_callbacks.append(move(callback));
 }
 
-void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*>& all_live_heap_blocks, Vector<StackFrameInfo>* out_stack_frames)
+void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, LiveHeapBlockSet& all_live_heap_blocks, Vector<StackFrameInfo>* out_stack_frames)
 {
     for_each_block([&](auto& block) {
         all_live_heap_blocks.set(&block);
@@ -427,7 +582,14 @@ void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*>&
     });
 
     m_gather_embedder_roots(roots);
-    gather_conservative_roots(roots, all_live_heap_blocks, out_stack_frames);
+
+    if (m_is_measuring_collection) {
+        auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        gather_conservative_roots(roots, all_live_heap_blocks, out_stack_frames);
+        m_last_collection_statistics.gather_conservative_roots_time = timer.elapsed_time();
+    } else {
+        gather_conservative_roots(roots, all_live_heap_blocks, out_stack_frames);
+    }
 
     for (auto& root : m_roots)
         roots.set(root.cell(), HeapRoot { .type = HeapRoot::Type::Root, .location = &root.source_location() });
@@ -467,7 +629,7 @@ void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, Fl
 }
 #endif
 
-NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*> const& all_live_heap_blocks, Vector<StackFrameInfo>* out_stack_frames)
+NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots, LiveHeapBlockSet const& all_live_heap_blocks, Vector<StackFrameInfo>* out_stack_frames)
 {
     FlatPtr dummy;
 
@@ -603,7 +765,7 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
 
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
+    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, LiveHeapBlockSet const& all_live_heap_blocks)
         : m_heap(heap)
         , m_all_live_heap_blocks(all_live_heap_blocks)
     {
@@ -668,12 +830,12 @@ public:
 private:
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
-    HashTable<HeapBlock*> const& m_all_live_heap_blocks;
+    LiveHeapBlockSet const& m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
-void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
+void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, LiveHeapBlockSet const& all_live_heap_blocks)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
@@ -725,24 +887,33 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cells = 0;
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
+    size_t collected_young_cells = 0;
+    size_t surviving_young_cells = 0;
 
     for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
+        size_t block_live_cells = 0;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked()) {
                 dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+                if (cell->is_young())
+                    ++collected_young_cells;
                 block.deallocate(cell);
                 ++collected_cells;
                 collected_cell_bytes += block.cell_size();
             } else {
                 cell->set_marked(false);
-                block_has_live_cells = true;
+                if (cell->is_young()) {
+                    cell->set_young(false);
+                    ++surviving_young_cells;
+                }
+                ++block_live_cells;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
             }
         });
-        if (!block_has_live_cells)
+        block.set_live_cell_count_at_last_sweep({}, block_live_cells);
+        if (block_live_cells == 0)
             empty_blocks.append(&block);
         else if (block_was_full != block.is_full())
             full_blocks_that_became_usable.append(&block);
@@ -765,6 +936,11 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         block->cell_allocator().block_did_become_usable({}, *block);
     }
 
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.sort_usable_blocks_if_fragmented({});
+
+    decommit_unused_blocks();
+
     if constexpr (HEAP_DEBUG) {
         for_each_block([&](auto& block) {
             dbgln(" > Live HeapBlock @ {}: cell_size={}", &block, block.cell_size());
@@ -772,7 +948,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    m_live_bytes_after_last_gc = live_cell_bytes;
 
     if (print_report) {
         AK::Duration const time_spent = measurement_timer.elapsed_time();
@@ -784,11 +960,20 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
 
         dbgln("Garbage collection report");
         dbgln("=============================================");
+        auto const& statistics = m_last_collection_statistics;
         dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
+        dbgln("   Gather roots: {} us", statistics.gather_roots_time.to_microseconds());
+        dbgln("        Marking: {} us", statistics.mark_live_cells_time.to_microseconds());
+        dbgln("     Finalizing: {} us", statistics.finalize_unmarked_cells_time.to_microseconds());
+        dbgln("       Sweeping: {} us", (time_spent - statistics.gather_roots_time - statistics.mark_live_cells_time - statistics.finalize_unmarked_cells_time).to_microseconds());
         dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
+        dbgln("    Young cells: {} collected, {} survived", collected_young_cells, surviving_young_cells);
         dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::BLOCK_SIZE);
         dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::BLOCK_SIZE);
+        auto block_statistics = this->block_statistics();
+        dbgln("  Cached blocks: {} committed, {} decommitted", block_statistics.committed_cached_block_count, block_statistics.decommitted_cached_block_count);
+        dbgln("  Fragmentation: {} bytes", block_statistics.fragmented_bytes);
         dbgln("=============================================");
     }
 }
@@ -8,10 +8,12 @@
 
 #include <AK/Badge.h>
 #include <AK/Function.h>
+#include <AK/HashTable.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/String.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -33,6 +35,59 @@ struct StackFrameInfo {
     size_t size_bytes { 0 };
 };
 
+// The set of blocks currently owned by the heap, used to check whether a conservatively found pointer
+// could point into one of them. Most candidate words don't, so a bitmap indexed by the low bits of the
+// block number rejects them before we have to hash and probe the table.
+class LiveHeapBlockSet {
+public:
+    LiveHeapBlockSet()
+    {
+        m_filter.resize(filter_bit_count / 64);
+    }
+
+    void set(HeapBlock* block)
+    {
+        auto index = filter_index(block);
+        m_filter[index / 64] |= 1ull << (index % 64);
+        m_blocks.set(block);
+    }
+
+    bool contains(HeapBlock* block) const
+    {
+        auto index = filter_index(block);
+        if (!(m_filter[index / 64] & (1ull << (index % 64))))
+            return false;
+        return m_blocks.contains(block);
+    }
+
+private:
+    static constexpr size_t filter_bit_count = 64 * KiB;
+
+    static size_t filter_index(HeapBlock const* block)
+    {
+        return (bit_cast<FlatPtr>(block) / HeapBlock::BLOCK_SIZE) % filter_bit_count;
+    }
+
+    Vector<u64> m_filter;
+    HashTable<HeapBlock*> m_blocks;
+};
+
+// Decides how many bytes may be allocated after a collection before the next one is triggered.
+struct HeapSizingPolicy {
+    // Never collect more often than once per this many allocated bytes.
+    size_t minimum_bytes_threshold { 4 * MiB };
+
+    // Allow this many allocated bytes per byte that survived the last collection.
+    double live_bytes_growth_factor { 1.0 };
+
+    // If non-zero, the fraction of time we're willing to spend collecting garbage. When collections take
+    // up more time than this relative to the mutator, the threshold is scaled up so we collect less often.
+    double target_gc_overhead { 0 };
+
+    // If non-zero, the threshold never grows beyond this, e.g. to stay within a memory limit.
+    size_t maximum_bytes_threshold { 0 };
+};
+
 class GC_API Heap {
     AK_MAKE_NONCOPYABLE(Heap);
     AK_MAKE_NONMOVABLE(Heap);
@@ -59,8 +114,63 @@ public:
     };
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
+
+    // Collects garbage ahead of schedule if at least half of the allocation budget until the next
+    // collection has already been used up. Embedders call this when they are idle, so that the
+    // collection doesn't end up happening in the middle of latency-sensitive work later on.
+    bool collect_garbage_if_past_idle_threshold();
+
+    // Collects garbage and returns the memory of every block that is left empty to the system, for when the embedder is
+    // running low on memory.
+    void release_unused_memory();
+
+    // Returns the memory of blocks that have been left empty for a while to the system. This is done after every
+    // collection, and embedders should call this when they are idle as well.
+    void decommit_unused_blocks();
+
+    struct BlockStatistics {
+        size_t live_block_count { 0 };
+        size_t committed_cached_block_count { 0 };
+        size_t decommitted_cached_block_count { 0 };
+
+        // The bytes of live blocks that are not occupied by live cells, as of the last collection.
+        size_t fragmented_bytes { 0 };
+    };
+    BlockStatistics block_statistics();
     AK::JsonObject dump_graph();
 
+    // What a single collection spent its time on, for embedders that keep track of how the collector performs.
+    struct CollectionStatistics {
+        AK::Duration total_time;
+        AK::Duration gather_roots_time;
+        AK::Duration gather_conservative_roots_time; // Part of the time spent gathering roots.
+        AK::Duration mark_live_cells_time;
+        AK::Duration finalize_unmarked_cells_time;
+        size_t live_bytes_after_collection { 0 };
+    };
+
+    // Invoked after every collection. As measuring them has a (small) cost, collections are only measured while a
+    // callback is set.
+    void set_collection_statistics_callback(AK::Function<void(CollectionStatistics const&)>);
+
+    // The number of bytes allocated for cells over the lifetime of the heap.
+    u64 total_allocated_bytes() const { return m_total_allocated_bytes; }
+
+    // Prints the number of live cells and the bytes they occupy, per class, largest first.
+    void dump_cell_statistics();
+
+    template<typename Callback>
+    void for_each_live_cell(Callback callback)
+    {
+        for_each_block([&](auto& block) {
+            block.template for_each_cell_in_state<Cell::State::Live>(callback);
+            return IterationDecision::Continue;
+        });
+    }
+
+    HeapSizingPolicy const& sizing_policy() const { return m_sizing_policy; }
+    void set_sizing_policy(HeapSizingPolicy);
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
@@ -126,14 +236,15 @@ private:
     void will_allocate(size_t);
 
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
-    void gather_roots(HashMap<Cell*, HeapRoot>&, HashTable<HeapBlock*>& all_live_heap_blocks, Vector<StackFrameInfo>* out_stack_frames = nullptr);
-    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&, HashTable<HeapBlock*> const& all_live_heap_blocks, Vector<StackFrameInfo>* out_stack_frames = nullptr);
+    void gather_roots(HashMap<Cell*, HeapRoot>&, LiveHeapBlockSet& all_live_heap_blocks, Vector<StackFrameInfo>* out_stack_frames = nullptr);
+    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&, LiveHeapBlockSet const& all_live_heap_blocks, Vector<StackFrameInfo>* out_stack_frames = nullptr);
     void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
-    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, HashTable<HeapBlock*> const& all_live_heap_blocks);
+    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, LiveHeapBlockSet const& all_live_heap_blocks);
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
     void sweep_weak_blocks();
     void run_post_gc_tasks();
+    void update_gc_bytes_threshold(AK::Duration time_spent_collecting);
 
     ALWAYS_INLINE CellAllocator& allocator_for_size(size_t cell_size)
     {
@@ -155,9 +266,14 @@ private:
         }
     }
 
-    static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
-    size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
+    HeapSizingPolicy m_sizing_policy;
+    size_t m_gc_bytes_threshold { m_sizing_policy.minimum_bytes_threshold };
     size_t m_allocated_bytes_since_last_gc { 0 };
+    u64 m_total_allocated_bytes { 0 };
+    size_t m_live_bytes_after_last_gc { 0 };
+    double m_gc_overhead_scale { 1.0 };
+    MonotonicTime m_last_collection_end_time { MonotonicTime::now() };
+    MonotonicTime m_last_block_decommit_time { MonotonicTime::now_coarse() };
 
     bool m_should_collect_on_every_allocation { false };
 
@@ -176,6 +292,12 @@ private:
     bool m_should_gc_when_deferral_ends { false };
 
     bool m_collecting_garbage { false };
+
+    // Only filled in when a collection is asked to print a report, or there is a collection statistics callback.
+    bool m_is_measuring_collection { false };
+    CollectionStatistics m_last_collection_statistics;
+    AK::Function<void(CollectionStatistics const&)> m_collection_statistics_callback;
+
     StackInfo m_stack_info;
     AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> m_gather_embedder_roots;
 
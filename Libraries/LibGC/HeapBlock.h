@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Platform.h>
 #include <AK/StringView.h>
@@ -95,6 +96,10 @@ public:
     bool overrides_must_survive_garbage_collection() const { return m_overrides_must_survive_garbage_collection; }
     bool overrides_finalize() const { return m_overrides_finalize; }
 
+    // NB: This is only kept up to date by sweeping, allocations since the last sweep are not included.
+    size_t live_cell_count_at_last_sweep() const { return m_live_cell_count_at_last_sweep; }
+    void set_live_cell_count_at_last_sweep(Badge<Heap>, size_t count) { m_live_cell_count_at_last_sweep = count; }
+
 private:
     HeapBlock(Heap&, CellAllocator&, size_t cell_size, bool overrides_must_survive_garbage_collection, bool overrides_finalize);
 
@@ -117,6 +122,7 @@ private:
 
     bool m_overrides_must_survive_garbage_collection { false };
     bool m_overrides_finalize { false };
+    u32 m_live_cell_count_at_last_sweep { 0 };
 
     Ptr<FreelistEntry> m_freelist;
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
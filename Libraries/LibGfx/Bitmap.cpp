@@ -9,11 +9,11 @@
 #include <AK/Bitmap.h>
 #include <AK/Checked.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/PixelConversion.h>
 #include <LibGfx/ShareableBitmap.h>
 #include <LibGfx/SkiaUtils.h>
 
 #include <core/SkBitmap.h>
-#include <core/SkColorSpace.h>
 #include <core/SkImage.h>
 #include <core/SkImageInfo.h>
 #include <core/SkPixmap.h>
@@ -349,20 +349,14 @@ void Bitmap::set_alpha_type_destructive(AlphaType alpha_type)
     }
     VERIFY(err == kvImageNoError);
 #else
-    auto color_type = to_skia_color_type(m_format);
-    auto source_alpha = to_skia_alpha_type(m_format, m_alpha_type);
-    auto destination_alpha = to_skia_alpha_type(m_format, alpha_type);
-
-    auto color_space = SkColorSpace::MakeSRGB();
-
-    auto source_info = SkImageInfo::Make(width(), height(), color_type, source_alpha, color_space);
-    auto destination_info = SkImageInfo::Make(width(), height(), color_type, destination_alpha, color_space);
-
-    SkPixmap src_pixmap(source_info, m_data, pitch());
-    SkPixmap dst_pixmap(destination_info, m_data, pitch());
-
-    bool ok = src_pixmap.readPixels(dst_pixmap);
-    VERIFY(ok);
+    auto row_width = static_cast<size_t>(width());
+    for (int y = 0; y < height(); ++y) {
+        Span<RawPixel> row { scanline(y), row_width };
+        if (m_alpha_type == AlphaType::Unpremultiplied)
+            premultiply_alpha(row);
+        else
+            unpremultiply_alpha(row);
+    }
 #endif
     m_alpha_type = alpha_type;
 }
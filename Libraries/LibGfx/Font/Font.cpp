@@ -10,6 +10,7 @@
 #include <AK/Utf16String.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Font/ShapingCache.h>
 #include <LibGfx/Font/TypefaceSkia.h>
 #include <LibGfx/TextLayout.h>
 
@@ -143,23 +144,16 @@ SkFont Font::skia_font(float scale) const
     return sk_font;
 }
 
-Font::ShapingCache::~ShapingCache()
+ShapingFace& Font::shaping_face() const
 {
-    clear();
+    if (!m_shaping_face)
+        m_shaping_face = ShapingCache::the().face_for(*this);
+    return *m_shaping_face;
 }
 
-void Font::ShapingCache::clear()
+void Font::clear_all_shaping_caches()
 {
-    for (auto& it : map) {
-        hb_buffer_destroy(it.value);
-    }
-    map.clear();
-    for (auto& buffer : single_ascii_character_map) {
-        if (buffer) {
-            hb_buffer_destroy(buffer);
-            buffer = nullptr;
-        }
-    }
+    ShapingCache::the().clear();
 }
 
 static bool hb_face_has_table(hb_face_t* face, hb_tag_t tag)
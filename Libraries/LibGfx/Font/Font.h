@@ -19,10 +19,11 @@
 
 class SkFont;
 struct hb_font_t;
-struct hb_buffer_t;
 
 namespace Gfx {
 
+class ShapingFace;
+
 struct FontPixelMetrics {
     float size { 0 };
     float x_height { 0 };
@@ -84,16 +85,15 @@ public:
 
     Font const& bold_variant() const;
     hb_font_t* harfbuzz_font() const;
+    FontVariationSettings const& variations() const { return m_font_variation_settings; }
     ShapeFeatures const& features() const { return m_shape_features; }
 
-    struct ShapingCache {
-        HashMap<Utf16String, hb_buffer_t*> map;
-        hb_buffer_t* single_ascii_character_map[128] { nullptr };
+    // The face that text in this font is shaped with, which is shared with other fonts that shape text the same way.
+    ShapingFace& shaping_face() const;
 
-        ~ShapingCache();
-        void clear();
-    };
-    ShapingCache& shaping_cache() const { return m_shaping_cache; }
+    // Drops the cached shaping results of every font, for when we are running low on memory.
+    // NB: Text is only ever shaped on the main thread, so this must be called from the main thread as well.
+    static void clear_all_shaping_caches();
 
     bool is_emoji_font() const;
 
@@ -101,7 +101,7 @@ private:
     mutable RefPtr<Font const> m_bold_variant;
     mutable hb_font_t* m_harfbuzz_font { nullptr };
 
-    mutable ShapingCache m_shaping_cache;
+    mutable RefPtr<ShapingFace> m_shaping_face;
 
     mutable TriState m_is_emoji_font { TriState::Unknown };
 
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <AK/QuickSort.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/ShapingCache.h>
+
+#include <harfbuzz/hb.h>
+
+namespace Gfx {
+
+ShapingFace::ShapingFace(NonnullRefPtr<Typeface const> typeface, Vector<FontVariationAxis> variations, ShapeFeatures features, Optional<float> pixel_size)
+    : m_typeface(move(typeface))
+    , m_variations(move(variations))
+    , m_features(move(features))
+    , m_pixel_size(pixel_size)
+{
+}
+
+ShapingFace::~ShapingFace()
+{
+    if (m_harfbuzz_font)
+        hb_font_destroy(m_harfbuzz_font);
+}
+
+hb_font_t* ShapingFace::harfbuzz_font() const
+{
+    VERIFY(!is_size_dependent());
+
+    if (!m_harfbuzz_font) {
+        m_harfbuzz_font = hb_font_create(m_typeface->harfbuzz_typeface());
+
+        auto scale = static_cast<int>(m_typeface->units_per_em() * text_shaping_resolution);
+        hb_font_set_scale(m_harfbuzz_font, scale, scale);
+
+        if (!m_variations.is_empty()) {
+            Vector<hb_variation_t> hb_list;
+            hb_list.ensure_capacity(m_variations.size());
+            for (auto const& axis : m_variations)
+                hb_list.unchecked_append(hb_variation_t { axis.tag.to_u32(), axis.value });
+            hb_font_set_variations(m_harfbuzz_font, hb_list.data(), hb_list.size());
+        }
+    }
+    return m_harfbuzz_font;
+}
+
+ShapingCache& ShapingCache::the()
+{
+    static ShapingCache s_the;
+    return s_the;
+}
+
+// HarfBuzz only takes the size of a font into account for the tracking table of AAT fonts.
+static bool typeface_shapes_depending_on_size(Typeface const& typeface)
+{
+    hb_blob_t* blob = hb_face_reference_table(typeface.harfbuzz_typeface(), HB_TAG('t', 'r', 'a', 'k'));
+    auto length = hb_blob_get_length(blob);
+    hb_blob_destroy(blob);
+    return length > 0;
+}
+
+NonnullRefPtr<ShapingFace> ShapingCache::face_for(Font const& font)
+{
+    auto variations = font.variations().to_sorted_list();
+
+    Optional<float> pixel_size;
+    if (typeface_shapes_depending_on_size(font.typeface()))
+        pixel_size = font.pixel_size();
+
+    for (auto& face : m_faces) {
+        if (&face->typeface() == &font.typeface() && face->pixel_size() == pixel_size && face->variations() == variations && face->features() == font.features())
+            return face;
+    }
+
+    auto face = adopt_ref(*new ShapingFace(font.typeface(), move(variations), font.features(), pixel_size));
+    m_faces.append(face);
+    return face;
+}
+
+unsigned ShapingCache::hash_for(ShapingFace const& face, Utf16View const& text, GlyphRun::TextType text_type)
+{
+    return pair_int_hash(pair_int_hash(ptr_hash(&face), text.hash()), to_underlying(text_type));
+}
+
+size_t ShapingCache::size_of_entry(Utf16View const& text, ShapedGlyphs const& glyphs)
+{
+    return sizeof(Key) + sizeof(Entry) + (text.length_in_code_units() * sizeof(char16_t)) + (glyphs.size() * sizeof(ShapedGlyph));
+}
+
+static Optional<char16_t> single_ascii_character(Utf16View const& text)
+{
+    if (text.length_in_code_units() != 1 || text.code_unit_at(0) >= 128)
+        return {};
+    return text.code_unit_at(0);
+}
+
+ShapedGlyphs const* ShapingCache::lookup(ShapingFace& face, Utf16View const& text, GlyphRun::TextType text_type)
+{
+    if (auto character = single_ascii_character(text); character.has_value()) {
+        auto& glyphs = face.m_single_ascii_characters[*character];
+        return glyphs.has_value() ? &glyphs.value() : nullptr;
+    }
+
+    auto it = m_entries.find(hash_for(face, text, text_type), [&](auto& candidate) {
+        return candidate.key.face.ptr() == &face && candidate.key.text_type == text_type && candidate.key.text == text;
+    });
+    if (it == m_entries.end())
+        return nullptr;
+
+    it->value.last_use = ++m_use_counter;
+    return &it->value.glyphs;
+}
+
+ShapedGlyphs const& ShapingCache::insert(ShapingFace& face, Utf16View const& text, GlyphRun::TextType text_type, ShapedGlyphs glyphs)
+{
+    if (auto character = single_ascii_character(text); character.has_value()) {
+        auto& slot = face.m_single_ascii_characters[*character];
+        slot = move(glyphs);
+        return slot.value();
+    }
+
+    // NB: We evict down to three quarters of the capacity at once, so that we don't have to look for the least recently
+    //     used entries again for every entry that is added to a full cache.
+    auto size = size_of_entry(text, glyphs);
+    if (m_size_in_bytes + size > m_capacity_in_bytes) {
+        auto target_size = m_capacity_in_bytes / 4 * 3;
+        evict_until_size_is_at_most(target_size > size ? target_size - size : 0);
+    }
+
+    m_size_in_bytes += size;
+    auto& entry = m_entries.ensure(Key { face, text_type, Utf16String::from_utf16(text) }, [&] {
+        return Entry { .glyphs = move(glyphs), .last_use = 0 };
+    });
+    entry.last_use = ++m_use_counter;
+    return entry.glyphs;
+}
+
+void ShapingCache::set_capacity_in_bytes(size_t capacity)
+{
+    m_capacity_in_bytes = capacity;
+    evict_until_size_is_at_most(capacity);
+}
+
+void ShapingCache::clear()
+{
+    m_entries.clear();
+    m_size_in_bytes = 0;
+
+    for (auto& face : m_faces) {
+        for (auto& glyphs : face->m_single_ascii_characters)
+            glyphs.clear();
+    }
+
+    // Faces that no font refers to anymore can go as well.
+    m_faces.remove_all_matching([](auto const& face) { return face->ref_count() == 1; });
+}
+
+void ShapingCache::evict_until_size_is_at_most(size_t size)
+{
+    if (m_size_in_bytes <= size)
+        return;
+
+    // Find the most recent use up to which entries have to be evicted, so that we can remove them all in one go.
+    struct Use {
+        u64 last_use;
+        size_t size;
+    };
+    Vector<Use> uses;
+    uses.ensure_capacity(m_entries.size());
+    for (auto const& it : m_entries)
+        uses.unchecked_append({ it.value.last_use, size_of_entry(it.key.text, it.value.glyphs) });
+    quick_sort(uses, [](auto const& a, auto const& b) { return a.last_use < b.last_use; });
+
+    u64 last_use_to_evict = 0;
+    auto remaining_size = m_size_in_bytes;
+    for (auto const& use : uses) {
+        if (remaining_size <= size)
+            break;
+        remaining_size -= use.size;
+        last_use_to_evict = use.last_use;
+    }
+
+    m_entries.remove_all_matching([&](auto const& key, auto const& entry) {
+        if (entry.last_use > last_use_to_evict)
+            return false;
+        m_size_in_bytes -= size_of_entry(key.text, entry.glyphs);
+        return true;
+    });
+}
+
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/Utf16String.h>
+#include <AK/Vector.h>
+#include <LibGfx/Font/FontVariationSettings.h>
+#include <LibGfx/Font/Typeface.h>
+#include <LibGfx/ShapeFeature.h>
+#include <LibGfx/TextLayout.h>
+
+struct hb_font_t;
+
+namespace Gfx {
+
+// A glyph as shaped by HarfBuzz. Its metrics are multiplied by text_shaping_resolution, and are in font units, unless
+// the face it was shaped with is size dependent, in which case they are in pixels.
+struct ShapedGlyph {
+    u32 glyph_id { 0 };
+    u32 cluster { 0 };
+    i32 x_advance { 0 };
+    i32 y_advance { 0 };
+    i32 x_offset { 0 };
+    i32 y_offset { 0 };
+};
+
+using ShapedGlyphs = Vector<ShapedGlyph>;
+
+// Everything about a font that affects how its text is shaped. HarfBuzz does not hint, so text is shaped the same way at
+// every size of a typeface, and fonts that only differ in their size share a face. The exception are typefaces that
+// track their text depending on the size, which get a separate face for each size.
+class ShapingFace : public AtomicRefCounted<ShapingFace> {
+public:
+    ShapingFace(NonnullRefPtr<Typeface const>, Vector<FontVariationAxis>, ShapeFeatures, Optional<float> pixel_size);
+    ~ShapingFace();
+
+    Typeface const& typeface() const { return m_typeface; }
+    Vector<FontVariationAxis> const& variations() const { return m_variations; }
+    ShapeFeatures const& features() const { return m_features; }
+
+    // Only size dependent faces have a pixel size, which their text is shaped at.
+    Optional<float> pixel_size() const { return m_pixel_size; }
+    bool is_size_dependent() const { return m_pixel_size.has_value(); }
+
+    // A HarfBuzz font that shapes text in font units, for faces that are not size dependent.
+    hb_font_t* harfbuzz_font() const;
+
+private:
+    friend class ShapingCache;
+
+    NonnullRefPtr<Typeface const> m_typeface;
+    Vector<FontVariationAxis> m_variations;
+    ShapeFeatures m_features;
+    Optional<float> m_pixel_size;
+
+    mutable hb_font_t* m_harfbuzz_font { nullptr };
+
+    // OPTIMIZATION: Single ASCII characters are shaped all the time, so we keep them out of the hash map.
+    Array<Optional<ShapedGlyphs>, 128> m_single_ascii_characters;
+};
+
+// A process-wide cache of shaped text, shared by all fonts with the same shaping face. It is bounded by the memory its
+// entries take up, and evicts the least recently used entries first once it is full.
+// NB: Text is only ever shaped on the main thread, so this must only be used from the main thread as well.
+class ShapingCache {
+public:
+    static ShapingCache& the();
+
+    NonnullRefPtr<ShapingFace> face_for(Font const&);
+
+    // The returned glyphs stay valid until the next call to insert() or clear().
+    ShapedGlyphs const* lookup(ShapingFace&, Utf16View const&, GlyphRun::TextType);
+    ShapedGlyphs const& insert(ShapingFace&, Utf16View const&, GlyphRun::TextType, ShapedGlyphs);
+
+    size_t size_in_bytes() const { return m_size_in_bytes; }
+    size_t capacity_in_bytes() const { return m_capacity_in_bytes; }
+    void set_capacity_in_bytes(size_t);
+
+    void clear();
+
+private:
+    static constexpr size_t DEFAULT_CAPACITY_IN_BYTES = 4 * MiB;
+
+    struct Key {
+        NonnullRefPtr<ShapingFace> face;
+        GlyphRun::TextType text_type;
+        Utf16String text;
+    };
+
+    struct Entry {
+        ShapedGlyphs glyphs;
+        u64 last_use { 0 };
+    };
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key) { return hash_for(*key.face, key.text.utf16_view(), key.text_type); }
+        static bool equals(Key const& a, Key const& b) { return a.face == b.face && a.text_type == b.text_type && a.text == b.text; }
+    };
+
+    static unsigned hash_for(ShapingFace const&, Utf16View const&, GlyphRun::TextType);
+    static size_t size_of_entry(Utf16View const&, ShapedGlyphs const&);
+
+    void evict_until_size_is_at_most(size_t);
+
+    HashMap<Key, Entry, KeyTraits> m_entries;
+    Vector<NonnullRefPtr<ShapingFace>> m_faces;
+    size_t m_size_in_bytes { 0 };
+    size_t m_capacity_in_bytes { DEFAULT_CAPACITY_IN_BYTES };
+    u64 m_use_counter { 0 };
+};
+
+}
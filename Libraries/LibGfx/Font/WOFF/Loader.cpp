@@ -103,6 +103,13 @@ struct [[gnu::packed]] TableRecord {
 static_assert(AssertSize<TableRecord, 16>());
 
 ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes buffer, unsigned int index)
+{
+    auto font_buffer = TRY(decompress(buffer));
+    auto font_data = Gfx::FontData::create_from_byte_buffer(move(font_buffer));
+    return TRY(Gfx::Typeface::try_load_from_font_data(move(font_data), index));
+}
+
+ErrorOr<ByteBuffer> decompress(ReadonlyBytes buffer)
 {
     FixedMemoryStream stream(buffer);
     auto header = TRY(stream.read_value<Header>());
@@ -186,8 +193,7 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes buffer,
     if (header.total_sfnt_size != expected_total_sfnt_size)
         return Error::from_string_literal("Invalid WOFF total sfnt size");
 
-    auto font_data = Gfx::FontData::create_from_byte_buffer(move(font_buffer));
-    return TRY(Gfx::Typeface::try_load_from_font_data(move(font_data), index));
+    return font_buffer;
 }
 
 }
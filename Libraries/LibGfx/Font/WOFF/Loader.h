@@ -16,4 +16,8 @@ namespace WOFF {
 ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_resource(Core::Resource const&, unsigned index = 0);
 ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes bytes, unsigned index = 0);
 
+// Turns a WOFF file back into the SFNT font it was made from. This does not touch any shared state, so it can be done
+// on any thread.
+ErrorOr<ByteBuffer> decompress(ReadonlyBytes);
+
 }
@@ -54,6 +54,14 @@ private:
 };
 
 ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes bytes)
+{
+    auto ttf_buffer = TRY(decompress(bytes));
+    auto font_data = Gfx::FontData::create_from_byte_buffer(move(ttf_buffer));
+    auto input_font = TRY(Gfx::Typeface::try_load_from_font_data(move(font_data)));
+    return input_font;
+}
+
+ErrorOr<ByteBuffer> decompress(ReadonlyBytes bytes)
 {
     auto ttf_buffer = TRY(ByteBuffer::create_uninitialized(0));
     auto output = WOFF2ByteBufferOut { ttf_buffer };
@@ -61,10 +69,7 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes bytes)
     if (!result) {
         return Error::from_string_literal("Failed to convert the WOFF2 font to TTF");
     }
-
-    auto font_data = Gfx::FontData::create_from_byte_buffer(move(ttf_buffer));
-    auto input_font = TRY(Gfx::Typeface::try_load_from_font_data(move(font_data)));
-    return input_font;
+    return ttf_buffer;
 }
 
 }
@@ -15,4 +15,8 @@ namespace WOFF2 {
 
 ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes);
 
+// Turns a WOFF2 file back into the SFNT font it was made from. This does not touch any shared state, so it can be done
+// on any thread.
+ErrorOr<ByteBuffer> decompress(ReadonlyBytes);
+
 }
@@ -11,10 +11,13 @@ namespace Gfx {
 void FontCascadeList::add(NonnullRefPtr<Font const> font)
 {
     m_fonts.append({ move(font), {} });
+    m_code_point_cache = nullptr;
 }
 
 void FontCascadeList::add(NonnullRefPtr<Font const> font, Vector<UnicodeRange> unicode_ranges)
 {
+    m_code_point_cache = nullptr;
+
     if (unicode_ranges.is_empty()) {
         m_fonts.append({ move(font), {} });
         return;
@@ -37,9 +40,31 @@ void FontCascadeList::add(NonnullRefPtr<Font const> font, Vector<UnicodeRange> u
 void FontCascadeList::extend(FontCascadeList const& other)
 {
     m_fonts.extend(other.m_fonts);
+    m_code_point_cache = nullptr;
 }
 
 Gfx::Font const& FontCascadeList::font_for_code_point(u32 code_point) const
+{
+    // OPTIMIZATION: Text is resolved to fonts one code point at a time, and the same code points come up over and over.
+    //               Looking through the fonts for each of them is slow for text that the first font does not cover, such
+    //               as CJK text or emoji, so we remember which font each code point resolved to.
+    if (!m_code_point_cache)
+        m_code_point_cache = make<CodePointCache>();
+
+    auto& cached = (*m_code_point_cache)[code_point % CODE_POINT_CACHE_SIZE];
+    if (cached.code_point == code_point)
+        return *cached.font;
+
+    // NB: Falling back to the last resort font is not cached, as a system fallback font may cover the code point later.
+    auto const* font = find_font_for_code_point(code_point);
+    if (!font)
+        return *m_last_resort_font;
+
+    cached = { code_point, font };
+    return *font;
+}
+
+Font const* FontCascadeList::find_font_for_code_point(u32 code_point) const
 {
     for (auto const& entry : m_fonts) {
         if (entry.range_data.has_value()) {
@@ -47,21 +72,22 @@ Gfx::Font const& FontCascadeList::font_for_code_point(u32 code_point) const
                 continue;
             for (auto const& range : entry.range_data->unicode_ranges) {
                 if (range.contains(code_point) && entry.font->contains_glyph(code_point))
-                    return entry.font;
+                    return entry.font.ptr();
             }
         } else if (entry.font->contains_glyph(code_point)) {
-            return entry.font;
+            return entry.font.ptr();
         }
     }
 
     if (m_system_font_fallback_callback) {
         if (auto fallback = m_system_font_fallback_callback(code_point, first())) {
+            // NB: The cached fonts of other code points stay valid, since fonts are only ever added after the others.
             m_fonts.append({ fallback.release_nonnull(), {} });
-            return *m_fonts.last().font;
+            return m_fonts.last().font.ptr();
         }
     }
 
-    return *m_last_resort_font;
+    return nullptr;
 }
 
 bool FontCascadeList::equals(FontCascadeList const& other) const
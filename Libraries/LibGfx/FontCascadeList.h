@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Function.h>
+#include <AK/OwnPtr.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/UnicodeRange.h>
 
@@ -64,9 +66,19 @@ public:
     }
 
 private:
+    Font const* find_font_for_code_point(u32 code_point) const;
+
     RefPtr<Font const> m_last_resort_font;
     mutable Vector<Entry> m_fonts;
     SystemFontFallbackCallback m_system_font_fallback_callback;
+
+    struct CachedCodePoint {
+        u32 code_point { 0xFFFFFFFF };
+        Font const* font { nullptr };
+    };
+    static constexpr size_t CODE_POINT_CACHE_SIZE = 1024;
+    using CodePointCache = Array<CachedCodePoint, CODE_POINT_CACHE_SIZE>;
+    mutable OwnPtr<CodePointCache> m_code_point_cache;
 };
 
 }
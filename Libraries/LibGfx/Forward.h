@@ -26,6 +26,7 @@ class YUVData;
 class PaletteImpl;
 class Path;
 class ShareableBitmap;
+class ShareableYUVData;
 class SkiaBackendContext;
 struct SystemTheme;
 
@@ -7,6 +7,7 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/Error.h>
+#include <AK/ScopeGuard.h>
 #include <LibGfx/ImageFormats/AVIFLoader.h>
 
 #include <avif/avif.h>
@@ -37,7 +38,10 @@ public:
     size_t repetition_count { 0 };
     ByteBuffer icc_data;
 
-    Vector<ImageFrameDescriptor> frame_descriptors;
+    // OPTIMIZATION: Only the most recently decoded frame is kept around, as holding on to every frame of a long
+    //               animation takes a lot of memory. Frames are decoded on demand instead.
+    Optional<size_t> decoded_frame_index;
+    Optional<ImageFrameDescriptor> decoded_frame;
 
     AVIFLoadingContext() = default;
     ~AVIFLoadingContext()
@@ -98,32 +102,133 @@ static ErrorOr<void> decode_avif_header(AVIFLoadingContext& context)
     return {};
 }
 
-static ErrorOr<void> decode_avif_image(AVIFLoadingContext& context)
+static ErrorOr<ImageFrameDescriptor> decode_avif_image(AVIFLoadingContext& context, size_t index)
 {
     VERIFY(context.state >= AVIFLoadingContext::State::HeaderDecoded);
 
+    // NB: libavif steps to the next frame if that is the one we ask for, and otherwise seeks to the nearest keyframe
+    //     before the frame and decodes forward from there. Either way, we never have to go back to the first frame.
+    if (avifDecoderNthImage(context.decoder, index) != AVIF_RESULT_OK)
+        return Error::from_string_literal("Failed to decode AVIF image");
+
+    auto bitmap_format = context.has_alpha ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888;
+    auto bitmap = TRY(Bitmap::create(bitmap_format, context.size.value()));
+
     avifRGBImage rgb;
-    while (avifDecoderNextImage(context.decoder) == AVIF_RESULT_OK) {
-        auto bitmap_format = context.has_alpha ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888;
-        auto bitmap = TRY(Bitmap::create(bitmap_format, context.size.value()));
+    avifRGBImageSetDefaults(&rgb, context.decoder->image);
+    rgb.pixels = bitmap->scanline_u8(0);
+    rgb.rowBytes = bitmap->pitch();
+    rgb.format = avifRGBFormat::AVIF_RGB_FORMAT_BGRA;
+    rgb.depth = 8;
+
+    avifResult result = avifImageYUVToRGB(context.decoder->image, &rgb);
+    if (result != AVIF_RESULT_OK)
+        return Error::from_string_literal("Conversion from YUV to RGB failed");
+
+    auto duration = context.decoder->imageCount == 1 ? 0 : static_cast<int>(context.decoder->imageTiming.duration * 1000);
+    context.state = AVIFLoadingContext::BitmapDecoded;
+    return ImageFrameDescriptor { bitmap, duration };
+}
 
-        avifRGBImageSetDefaults(&rgb, context.decoder->image);
-        rgb.pixels = bitmap->scanline_u8(0);
-        rgb.rowBytes = bitmap->pitch();
-        rgb.format = avifRGBFormat::AVIF_RGB_FORMAT_BGRA;
-        rgb.depth = 8;
+static Optional<Media::CodingIndependentCodePoints> yuv_cicp_for_avif_image(avifImage const& image)
+{
+    auto matrix_coefficients = static_cast<Media::MatrixCoefficients>(image.matrixCoefficients);
+    auto video_full_range_flag = image.yuvRange == AVIF_RANGE_FULL ? Media::VideoFullRangeFlag::Full : Media::VideoFullRangeFlag::Studio;
+
+    // NB: These are the matrices that Skia can convert with. Skia only has limited range BT.2020 matrices.
+    switch (matrix_coefficients) {
+    case Media::MatrixCoefficients::Unspecified:
+        matrix_coefficients = Media::MatrixCoefficients::BT601;
+        break;
+    case Media::MatrixCoefficients::BT709:
+    case Media::MatrixCoefficients::BT470BG:
+    case Media::MatrixCoefficients::BT601:
+        break;
+    case Media::MatrixCoefficients::BT2020NonConstantLuminance:
+        if (video_full_range_flag == Media::VideoFullRangeFlag::Full)
+            return {};
+        break;
+    default:
+        return {};
+    }
 
-        avifResult result = avifImageYUVToRGB(context.decoder->image, &rgb);
-        if (result != AVIF_RESULT_OK)
-            return Error::from_string_literal("Conversion from YUV to RGB failed");
+    auto color_primaries = static_cast<Media::ColorPrimaries>(image.colorPrimaries);
+    if (color_primaries == Media::ColorPrimaries::Unspecified)
+        color_primaries = Media::ColorPrimaries::BT709;
+    auto transfer_characteristics = static_cast<Media::TransferCharacteristics>(image.transferCharacteristics);
+    if (transfer_characteristics == Media::TransferCharacteristics::Unspecified)
+        transfer_characteristics = Media::TransferCharacteristics::SRGB;
 
-        auto duration = context.decoder->imageCount == 1 ? 0 : static_cast<int>(context.decoder->imageTiming.duration * 1000);
-        context.frame_descriptors.append(ImageFrameDescriptor { bitmap, duration });
+    return Media::CodingIndependentCodePoints { color_primaries, transfer_characteristics, matrix_coefficients, video_full_range_flag };
+}
 
-        context.state = AVIFLoadingContext::BitmapDecoded;
+static ErrorOr<OwnPtr<YUVData>> decode_avif_image_to_yuv(AVIFLoadingContext& context)
+{
+    VERIFY(context.state == AVIFLoadingContext::State::HeaderDecoded);
+
+    auto const& header_image = *context.decoder->image;
+    Media::Subsampling subsampling;
+    switch (header_image.yuvFormat) {
+    case AVIF_PIXEL_FORMAT_YUV444:
+        subsampling = { false, false };
+        break;
+    case AVIF_PIXEL_FORMAT_YUV422:
+        subsampling = { true, false };
+        break;
+    case AVIF_PIXEL_FORMAT_YUV420:
+        subsampling = { true, true };
+        break;
+    default:
+        return nullptr;
     }
 
-    return {};
+    auto cicp = yuv_cicp_for_avif_image(header_image);
+    if (!cicp.has_value())
+        return nullptr;
+
+    // NB: Leave the decoder at the first image, so that the image can still be decoded to RGB afterwards.
+    ScopeGuard reset_guard { [&] { (void)avifDecoderReset(context.decoder); } };
+
+    if (avifDecoderNextImage(context.decoder) != AVIF_RESULT_OK)
+        return Error::from_string_literal("Failed to decode AVIF image");
+
+    auto const& image = *context.decoder->image;
+    auto bit_depth = static_cast<u8>(image.depth);
+    auto size = context.size.value();
+    auto yuv_data = TRY(YUVData::create_shareable(size, bit_depth, subsampling, cicp.value()));
+
+    auto uv_size = subsampling.subsampled_size(size);
+    Bytes planes[] = { yuv_data->y_data(), yuv_data->u_data(), yuv_data->v_data() };
+    IntSize plane_sizes[] = { size, uv_size, uv_size };
+
+    for (size_t plane = 0; plane < 3; ++plane) {
+        auto const* source = image.yuvPlanes[plane];
+        auto source_stride = image.yuvRowBytes[plane];
+        if (source == nullptr)
+            return Error::from_string_literal("AVIF image is missing a YUV plane");
+
+        auto samples_per_row = static_cast<size_t>(plane_sizes[plane].width());
+        auto row_count = static_cast<size_t>(plane_sizes[plane].height());
+        auto destination = planes[plane];
+
+        if (bit_depth > 8) {
+            // Normalize the values to fill the full 16-bit unorm range, like we do for video frames.
+            auto const shift = 16 - bit_depth;
+            auto const inverse_shift = bit_depth - shift;
+
+            for (size_t row = 0; row < row_count; ++row) {
+                auto const* source_row = reinterpret_cast<u16 const*>(source + (row * source_stride));
+                auto* destination_row = reinterpret_cast<u16*>(destination.data() + (row * samples_per_row * sizeof(u16)));
+                for (size_t i = 0; i < samples_per_row; ++i)
+                    destination_row[i] = static_cast<u16>((source_row[i] << shift) | (source_row[i] >> inverse_shift));
+            }
+        } else {
+            for (size_t row = 0; row < row_count; ++row)
+                destination.overwrite(row * samples_per_row, source + (row * source_stride), samples_per_row);
+        }
+    }
+
+    return yuv_data;
 }
 
 IntSize AVIFImageDecoderPlugin::size()
@@ -176,21 +281,36 @@ ErrorOr<ImageFrameDescriptor> AVIFImageDecoderPlugin::frame(size_t index, Option
     if (m_context->state == AVIFLoadingContext::State::Error)
         return Error::from_string_literal("AVIFImageDecoderPlugin: Decoding failed");
 
-    if (m_context->state < AVIFLoadingContext::State::BitmapDecoded) {
-        TRY(decode_avif_image(*m_context));
-        m_context->state = AVIFLoadingContext::State::BitmapDecoded;
-    }
+    if (m_context->decoded_frame_index == index)
+        return m_context->decoded_frame.value();
 
-    if (index >= m_context->frame_descriptors.size())
-        return Error::from_string_literal("AVIFImageDecoderPlugin: Invalid frame index");
-    return m_context->frame_descriptors[index];
+    m_context->decoded_frame = TRY(decode_avif_image(*m_context, index));
+    m_context->decoded_frame_index = index;
+    return m_context->decoded_frame.value();
 }
 
 int AVIFImageDecoderPlugin::frame_duration(size_t index)
 {
-    if (index >= m_context->frame_descriptors.size())
+    if (!is_animated() || index >= frame_count())
+        return 0;
+
+    // NB: The timing of each frame is known from the header, so there is no need to decode the frame for it.
+    avifImageTiming timing;
+    if (avifDecoderNthImageTiming(m_context->decoder, index, &timing) != AVIF_RESULT_OK)
         return 0;
-    return m_context->frame_descriptors[index].duration;
+    return static_cast<int>(timing.duration * 1000);
+}
+
+ErrorOr<OwnPtr<YUVData>> AVIFImageDecoderPlugin::yuv_frame()
+{
+    if (m_context->state != AVIFLoadingContext::State::HeaderDecoded)
+        return nullptr;
+
+    // NB: The YUV planes have no room for alpha, and the YUV data is converted without a color profile.
+    if (is_animated() || m_context->has_alpha || !m_context->icc_data.is_empty())
+        return nullptr;
+
+    return decode_avif_image_to_yuv(*m_context);
 }
 
 ErrorOr<Optional<ReadonlyBytes>> AVIFImageDecoderPlugin::icc_data()
@@ -30,6 +30,8 @@ public:
     virtual int frame_duration(size_t index) override;
     virtual ErrorOr<Optional<ReadonlyBytes>> icc_data() override;
 
+    virtual ErrorOr<OwnPtr<YUVData>> yuv_frame() override;
+
 private:
     AVIFImageDecoderPlugin(ReadonlyBytes, OwnPtr<AVIFLoadingContext>);
 
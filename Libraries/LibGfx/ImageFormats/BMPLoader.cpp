@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/BuiltinWrappers.h>
 #include <AK/ByteString.h>
 #include <AK/Debug.h>
@@ -14,6 +15,7 @@
 #include <AK/Try.h>
 #include <AK/Vector.h>
 #include <LibGfx/ImageFormats/BMPLoader.h>
+#include <LibGfx/PixelConversion.h>
 
 namespace Gfx {
 
@@ -275,6 +277,15 @@ public:
         return read_u16() | (read_u16() << 16);
     }
 
+    ReadonlyBytes read_bytes(size_t count)
+    {
+        VERIFY(m_size_remaining >= count);
+        ReadonlyBytes bytes { m_data_ptr, count };
+        m_size_remaining -= count;
+        m_data_ptr += count;
+        return bytes;
+    }
+
     void drop_bytes(u8 num_bytes)
     {
         VERIFY(m_size_remaining >= num_bytes);
@@ -288,6 +299,7 @@ public:
     bool has_u16() const { return m_size_remaining >= 2; }
     bool has_u24() const { return m_size_remaining >= 3; }
     bool has_u32() const { return m_size_remaining >= 4; }
+    bool has_bytes(size_t count) const { return m_size_remaining >= count; }
 
     size_t remaining() const { return m_size_remaining; }
 
@@ -1378,14 +1390,16 @@ static ErrorOr<void> decode_bmp_pixel_data(BMPLoadingContext& context)
                 break;
             }
             case 8: {
-                if (!streamer.has_u8())
+                // OPTIMIZATION: Byte-aligned pixels are converted for the rest of the row at once.
+                auto count = width - column;
+                if (!streamer.has_bytes(count))
                     return Error::from_string_literal("Cannot read 8 bits");
 
-                u8 byte = streamer.read_u8();
-                if (byte >= context.color_table.size())
+                auto indices = streamer.read_bytes(count);
+                if (any_of(indices, [&](u8 index) { return index >= context.color_table.size(); }))
                     return Error::from_string_literal("Invalid color table index");
-                auto color = context.color_table[byte];
-                context.bitmap->scanline(row)[column++] = color;
+                expand_palette_indices(indices, context.color_table.span(), { context.bitmap->scanline(row) + column, count });
+                column += count;
                 break;
             }
             case 16: {
@@ -1395,32 +1409,37 @@ static ErrorOr<void> decode_bmp_pixel_data(BMPLoadingContext& context)
                 break;
             }
             case 24: {
-                if (!streamer.has_u24())
-                    return Error::from_string_literal("Cannot read 24 bits");
-
-                u32 pixel = streamer.read_u24();
-
                 if (context.is_included_in_ico) {
-                    // 24-bit ICO files already use BGRA8888 format
-                    context.bitmap->scanline(row)[column++] = pixel;
-                } else {
-                    u8 b = (pixel & 0x0000FF);
-                    u8 g = (pixel & 0x00FF00) >> 8;
-                    u8 r = (pixel & 0xFF0000) >> 16;
+                    if (!streamer.has_u24())
+                        return Error::from_string_literal("Cannot read 24 bits");
 
-                    context.bitmap->scanline(row)[column++] = (b << 16) | (g << 8) | r;
+                    // 24-bit ICO files already use BGRA8888 format
+                    context.bitmap->scanline(row)[column++] = streamer.read_u24();
+                    break;
                 }
 
+                auto count = width - column;
+                if (!streamer.has_bytes(count * 3))
+                    return Error::from_string_literal("Cannot read 24 bits");
+
+                convert_bgr888_to_rgbx8888(streamer.read_bytes(count * 3), { context.bitmap->scanline(row) + column, count });
+                column += count;
                 break;
             }
             case 32:
-                if (!streamer.has_u32())
-                    return Error::from_string_literal("Cannot read 32 bits");
                 if (context.dib.info.masks.is_empty()) {
-                    context.bitmap->scanline(row)[column++] = streamer.read_u32();
-                } else {
-                    context.bitmap->scanline(row)[column++] = int_to_scaled_rgb(context, streamer.read_u32());
+                    auto count = width - column;
+                    if (!streamer.has_bytes(count * 4))
+                        return Error::from_string_literal("Cannot read 32 bits");
+
+                    memcpy(context.bitmap->scanline(row) + column, streamer.read_bytes(count * 4).data(), count * 4);
+                    column += count;
+                    break;
                 }
+
+                if (!streamer.has_u32())
+                    return Error::from_string_literal("Cannot read 32 bits");
+                context.bitmap->scanline(row)[column++] = int_to_scaled_rgb(context, streamer.read_u32());
                 break;
             }
         }
@@ -17,6 +17,7 @@
 #include <LibCompress/Lzw.h>
 #include <LibGfx/ImageFormats/GIFLoader.h>
 #include <LibGfx/Painter.h>
+#include <LibGfx/PixelConversion.h>
 
 namespace Gfx {
 
@@ -137,6 +138,30 @@ static void clear_rect(Bitmap& bitmap, IntRect const& rect, Color color)
     }
 }
 
+// A keyframe is a frame which looks the same no matter what the frames before it looked like, so decoding can start there.
+static bool is_keyframe(GIFLoadingContext const& context, size_t frame_index)
+{
+    if (frame_index == 0)
+        return true;
+
+    auto const& image = *context.images[frame_index];
+
+    // NB: Frames that are to be restored to what was underneath them copy the frame buffer before they are drawn, so that
+    //     copy would be missing whatever the earlier frames drew.
+    if (image.disposal_method == GIFImageDescriptor::DisposalMethod::RestorePrevious)
+        return false;
+
+    IntRect screen_rect { 0, 0, context.logical_screen.width, context.logical_screen.height };
+
+    // An opaque frame that covers the entire screen overwrites every pixel.
+    if (!image.transparent && image.rect().contains(screen_rect))
+        return true;
+
+    // A frame after a frame that covers the entire screen and is cleared once disposed starts from a transparent screen.
+    auto const& previous_image = *context.images[frame_index - 1];
+    return previous_image.disposal_method == GIFImageDescriptor::DisposalMethod::RestoreBackground && previous_image.rect().contains(screen_rect);
+}
+
 static ErrorOr<void> decode_frame(GIFLoadingContext& context, size_t frame_index)
 {
     if (frame_index >= context.images.size()) {
@@ -157,6 +182,15 @@ static ErrorOr<void> decode_frame(GIFLoadingContext& context, size_t frame_index
         start_frame = 0;
     }
 
+    // OPTIMIZATION: Start from the last keyframe up to the requested frame rather than decoding every frame in between,
+    //               which matters most when seeking backwards, as that would otherwise start over from the first frame.
+    for (size_t i = frame_index; i > start_frame; --i) {
+        if (is_keyframe(context, i)) {
+            start_frame = i;
+            break;
+        }
+    }
+
     for (size_t i = start_frame; i <= frame_index; ++i) {
         auto& image = context.images.at(i);
 
@@ -196,38 +230,45 @@ static ErrorOr<void> decode_frame(GIFLoadingContext& context, size_t frame_index
 
         auto const& color_map = image->use_global_color_map ? context.logical_screen.color_map : image->color_map;
 
-        int pixel_index = 0;
         int row = 0;
         int interlace_pass = 0;
 
         if (!image->width)
             continue;
 
-        for (auto const& color : decoded_stream.bytes()) {
-            auto c = color_map[color];
+        Array<RawPixel, 256> palette;
+        for (size_t color = 0; color < palette.size(); ++color)
+            palette[color] = color_map[color].value();
 
-            int x = pixel_index % image->width + image->x;
-            int y = row + image->y;
+        Optional<u8> transparent_index;
+        if (image->transparent)
+            transparent_index = image->transparency_index;
 
-            if (context.frame_buffer->rect().contains(x, y) && (!image->transparent || color != image->transparency_index)) {
-                context.frame_buffer->set_pixel(x, y, c);
-            }
+        // Only the part of each row that lies within the frame buffer is drawn.
+        size_t const visible_width = clamp(context.frame_buffer->width() - image->x, 0, static_cast<int>(image->width));
 
-            ++pixel_index;
-            if (pixel_index % image->width == 0) {
-                if (image->interlaced) {
-                    if (interlace_pass < 4) {
-                        if (row + INTERLACE_ROW_STRIDES[interlace_pass] >= image->height) {
-                            ++interlace_pass;
-                            if (interlace_pass < 4)
-                                row = INTERLACE_ROW_OFFSETS[interlace_pass];
-                        } else {
-                            row += INTERLACE_ROW_STRIDES[interlace_pass];
-                        }
+        auto remaining_indices = decoded_stream.bytes();
+        while (!remaining_indices.is_empty()) {
+            auto row_indices = remaining_indices.trim(image->width);
+            remaining_indices = remaining_indices.slice(row_indices.size());
+
+            int y = row + image->y;
+            auto visible_count = min(row_indices.size(), visible_width);
+            if (y < context.frame_buffer->height() && visible_count > 0)
+                expand_palette_indices(row_indices.trim(visible_count), palette.span(), { context.frame_buffer->scanline(y) + image->x, visible_count }, transparent_index);
+
+            if (image->interlaced) {
+                if (interlace_pass < 4) {
+                    if (row + INTERLACE_ROW_STRIDES[interlace_pass] >= image->height) {
+                        ++interlace_pass;
+                        if (interlace_pass < 4)
+                            row = INTERLACE_ROW_OFFSETS[interlace_pass];
+                    } else {
+                        row += INTERLACE_ROW_STRIDES[interlace_pass];
                     }
-                } else {
-                    ++row;
                 }
+            } else {
+                ++row;
             }
         }
 
@@ -16,6 +16,7 @@
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/Size.h>
 #include <LibGfx/VectorGraphic.h>
+#include <LibGfx/YUVData.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
 
 namespace Gfx {
@@ -100,6 +101,10 @@ public:
     virtual ErrorOr<NonnullRefPtr<CMYKBitmap>> cmyk_frame() { VERIFY_NOT_REACHED(); }
     virtual ErrorOr<VectorImageFrameDescriptor> vector_frame(size_t) { VERIFY_NOT_REACHED(); }
 
+    // Override this if the format stores still images as planar YUV. Returns null for images that can't be represented
+    // as shareable YUV data without losing information, such as those with alpha or an ICC profile.
+    virtual ErrorOr<OwnPtr<YUVData>> yuv_frame() { return nullptr; }
+
 protected:
     ImageDecoderPlugin() = default;
 };
@@ -132,6 +137,10 @@ public:
     // Call only if natural_frame_format() == NaturalFrameFormat::Vector.
     ErrorOr<VectorImageFrameDescriptor> vector_frame(size_t index) { return m_plugin->vector_frame(index); }
 
+    // Decodes a still image to planar YUV, leaving the conversion to RGB up to whoever draws it. If this returns null,
+    // the image has to be decoded with frame() instead.
+    ErrorOr<OwnPtr<YUVData>> yuv_frame() { return m_plugin->yuv_frame(); }
+
 private:
     explicit ImageDecoder(NonnullOwnPtr<ImageDecoderPlugin>);
 
@@ -23,6 +23,11 @@ struct JPEGLoadingContext {
     RefPtr<Gfx::Bitmap> rgb_bitmap;
     RefPtr<Gfx::CMYKBitmap> cmyk_bitmap;
 
+    // NB: These are only used while decoding to YUV. They are not locals, as locals that are changed after setjmp() are
+    //     left in an indeterminate state if libjpeg longjmp()s back.
+    OwnPtr<YUVData> yuv_data;
+    Vector<u8> yuv_row_buffer;
+
     ReadonlyBytes data;
     Vector<u8> icc_data;
 
@@ -32,34 +37,23 @@ struct JPEGLoadingContext {
     }
 
     ErrorOr<void> decode();
+    ErrorOr<OwnPtr<YUVData>> decode_yuv();
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+static void handle_jpeg_error(j_common_ptr cinfo)
 {
-    struct jpeg_decompress_struct cinfo;
-    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
-
-    struct JPEGErrorManager jerr;
-    cinfo.err = jpeg_std_error(&jerr);
-
-    jpeg_source_mgr source_manager {};
-
-    if (setjmp(jerr.setjmp_buffer))
-        return Error::from_string_literal("Failed to decode JPEG");
-
-    jerr.error_exit = [](j_common_ptr cinfo) {
-        char buffer[JMSG_LENGTH_MAX];
-        (*cinfo->err->format_message)(cinfo, buffer);
-        dbgln("JPEG error: {}", buffer);
-        longjmp(static_cast<JPEGErrorManager*>(cinfo->err)->setjmp_buffer, 1);
-    };
-
-    jpeg_create_decompress(&cinfo);
+    char buffer[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, buffer);
+    dbgln("JPEG error: {}", buffer);
+    longjmp(static_cast<JPEGErrorManager*>(cinfo->err)->setjmp_buffer, 1);
+}
 
+static void set_up_source_manager(jpeg_decompress_struct& cinfo, jpeg_source_mgr& source_manager, ReadonlyBytes data)
+{
     source_manager.next_input_byte = data.data();
     source_manager.bytes_in_buffer = data.size();
     source_manager.init_source = [](j_decompress_ptr) { };
@@ -76,6 +70,25 @@ ErrorOr<void> JPEGLoadingContext::decode()
     source_manager.term_source = [](j_decompress_ptr) { };
 
     cinfo.src = &source_manager;
+}
+
+ErrorOr<void> JPEGLoadingContext::decode()
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG");
+
+    jerr.error_exit = handle_jpeg_error;
+
+    jpeg_create_decompress(&cinfo);
+    set_up_source_manager(cinfo, source_manager, data);
 
     jpeg_save_markers(&cinfo, JPEG_APP0 + 2, 0xFFFF);
     if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
@@ -89,8 +102,30 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
+    // NB: Images with several scans are decoded in buffered-image mode, which lets us present the scans that did arrive
+    //     when the data is cut off, such as for an image that is still being downloaded.
+    bool const has_multiple_scans = jpeg_has_multiple_scans(&cinfo);
+    if (has_multiple_scans)
+        cinfo.buffered_image = TRUE;
+
     jpeg_start_decompress(&cinfo);
     bool could_read_all_scanlines = true;
+    bool reached_end_of_image = true;
+
+    if (has_multiple_scans) {
+        int status = 0;
+        do {
+            status = jpeg_consume_input(&cinfo);
+        } while (status != JPEG_SUSPENDED && status != JPEG_REACHED_EOI);
+        reached_end_of_image = status == JPEG_REACHED_EOI;
+
+        // A scan that was cut off partway through only refines some of the image, so we present the last complete
+        // scan instead.
+        auto output_scan_number = cinfo.input_scan_number;
+        if (!reached_end_of_image && output_scan_number > 1)
+            --output_scan_number;
+        jpeg_start_output(&cinfo, output_scan_number);
+    }
 
     if (cinfo.out_color_space == JCS_EXT_BGRX) {
         rgb_bitmap = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
@@ -168,6 +203,9 @@ ErrorOr<void> JPEGLoadingContext::decode()
         }
     }
 
+    if (has_multiple_scans)
+        jpeg_finish_output(&cinfo);
+
     JOCTET* icc_data_ptr = nullptr;
     unsigned int icc_data_length = 0;
     if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
@@ -176,7 +214,7 @@ ErrorOr<void> JPEGLoadingContext::decode()
         free(icc_data_ptr);
     }
 
-    if (could_read_all_scanlines)
+    if (could_read_all_scanlines && reached_end_of_image)
         jpeg_finish_decompress(&cinfo);
     else
         jpeg_abort_decompress(&cinfo);
@@ -187,6 +225,118 @@ ErrorOr<void> JPEGLoadingContext::decode()
     return {};
 }
 
+ErrorOr<OwnPtr<YUVData>> JPEGLoadingContext::decode_yuv()
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() {
+        jpeg_destroy_decompress(&cinfo);
+        yuv_row_buffer.clear();
+    } };
+
+    struct JPEGErrorManager jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer)) {
+        yuv_data = nullptr;
+        return Error::from_string_literal("Failed to decode JPEG");
+    }
+
+    jerr.error_exit = handle_jpeg_error;
+
+    jpeg_create_decompress(&cinfo);
+    set_up_source_manager(cinfo, source_manager, data);
+
+    jpeg_save_markers(&cinfo, JPEG_APP0 + 2, 0xFFFF);
+    if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
+        return Error::from_string_literal("Failed to read JPEG header");
+
+    if (cinfo.jpeg_color_space != JCS_YCbCr || cinfo.num_components != 3 || cinfo.data_precision != 8)
+        return nullptr;
+
+    // NB: The YUV data is converted as sRGB, so images with their own color profile have to be converted to RGB here.
+    JOCTET* icc_data_ptr = nullptr;
+    unsigned int icc_data_length = 0;
+    if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
+        free(icc_data_ptr);
+        return nullptr;
+    }
+
+    // The chroma planes must either have the same resolution as the luma plane, or half of it.
+    auto const& luma_component = cinfo.comp_info[0];
+    if (luma_component.h_samp_factor > 2 || luma_component.v_samp_factor > 2)
+        return nullptr;
+    if (cinfo.max_h_samp_factor != luma_component.h_samp_factor || cinfo.max_v_samp_factor != luma_component.v_samp_factor)
+        return nullptr;
+    for (int i = 1; i < 3; ++i) {
+        if (cinfo.comp_info[i].h_samp_factor != 1 || cinfo.comp_info[i].v_samp_factor != 1)
+            return nullptr;
+    }
+    Media::Subsampling subsampling { luma_component.h_samp_factor == 2, luma_component.v_samp_factor == 2 };
+
+    cinfo.out_color_space = JCS_YCbCr;
+    cinfo.raw_data_out = TRUE;
+
+    // NB: This only fails if the data was cut off, in which case the image has to be decoded to RGB to show what arrived.
+    if (!jpeg_start_decompress(&cinfo))
+        return Error::from_string_literal("JPEG data is incomplete");
+
+    IntSize size { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) };
+
+    // JFIF images are stored in full range BT.601 YCbCr, converted from sRGB.
+    Media::CodingIndependentCodePoints cicp { Media::ColorPrimaries::BT709, Media::TransferCharacteristics::SRGB, Media::MatrixCoefficients::BT601, Media::VideoFullRangeFlag::Full };
+    yuv_data = TRY(YUVData::create_shareable(size, 8, subsampling, cicp));
+
+    Bytes planes[3] = { yuv_data->y_data(), yuv_data->u_data(), yuv_data->v_data() };
+    auto uv_size = subsampling.subsampled_size(size);
+    IntSize plane_sizes[3] = { size, uv_size, uv_size };
+
+    // libjpeg writes whole blocks, which may extend past the edges of the planes, so it decodes into rows that are padded
+    // to whole MCUs, which we then copy the planes out of.
+    auto mcu_columns = ceil_div(static_cast<size_t>(cinfo.output_width), static_cast<size_t>(cinfo.max_h_samp_factor * DCTSIZE));
+    size_t row_strides[3];
+    int rows_per_read[3];
+    size_t row_buffer_offsets[3];
+    size_t row_buffer_size = 0;
+    for (int i = 0; i < 3; ++i) {
+        auto const& component = cinfo.comp_info[i];
+        row_strides[i] = mcu_columns * component.h_samp_factor * DCTSIZE;
+        rows_per_read[i] = component.v_samp_factor * DCTSIZE;
+        row_buffer_offsets[i] = row_buffer_size;
+        row_buffer_size += row_strides[i] * rows_per_read[i];
+    }
+    TRY(yuv_row_buffer.try_resize(row_buffer_size));
+
+    JSAMPROW row_pointers[3][2 * DCTSIZE];
+    JSAMPARRAY component_rows[3];
+    for (int i = 0; i < 3; ++i) {
+        for (int row = 0; row < rows_per_read[i]; ++row)
+            row_pointers[i][row] = yuv_row_buffer.data() + row_buffer_offsets[i] + (row * row_strides[i]);
+        component_rows[i] = row_pointers[i];
+    }
+
+    auto const luma_rows_per_read = cinfo.max_v_samp_factor * DCTSIZE;
+    while (cinfo.output_scanline < cinfo.output_height) {
+        auto first_luma_row = cinfo.output_scanline;
+        if (jpeg_read_raw_data(&cinfo, component_rows, luma_rows_per_read) == 0)
+            return Error::from_string_literal("JPEG data is incomplete");
+
+        for (int i = 0; i < 3; ++i) {
+            auto plane_width = static_cast<size_t>(plane_sizes[i].width());
+            auto first_row = static_cast<int>(first_luma_row * cinfo.comp_info[i].v_samp_factor / cinfo.max_v_samp_factor);
+            auto row_count = min(rows_per_read[i], plane_sizes[i].height() - first_row);
+
+            for (int row = 0; row < row_count; ++row)
+                planes[i].overwrite((first_row + row) * plane_width, row_pointers[i][row], plane_width);
+        }
+    }
+
+    jpeg_finish_decompress(&cinfo);
+
+    return move(yuv_data);
+}
+
 JPEGImageDecoderPlugin::JPEGImageDecoderPlugin(NonnullOwnPtr<JPEGLoadingContext> context)
     : m_context(move(context))
 {
@@ -266,6 +416,15 @@ NaturalFrameFormat JPEGImageDecoderPlugin::natural_frame_format() const
     return NaturalFrameFormat::RGB;
 }
 
+ErrorOr<OwnPtr<YUVData>> JPEGImageDecoderPlugin::yuv_frame()
+{
+    // NB: An image that was already decoded to RGB is not worth decoding again.
+    if (m_context->state != JPEGLoadingContext::State::NotDecoded)
+        return nullptr;
+
+    return m_context->decode_yuv();
+}
+
 ErrorOr<NonnullRefPtr<CMYKBitmap>> JPEGImageDecoderPlugin::cmyk_frame()
 {
     if (m_context->state == JPEGLoadingContext::State::NotDecoded)
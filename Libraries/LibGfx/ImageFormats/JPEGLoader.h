@@ -29,6 +29,8 @@ public:
     virtual NaturalFrameFormat natural_frame_format() const override;
     virtual ErrorOr<NonnullRefPtr<CMYKBitmap>> cmyk_frame() override;
 
+    virtual ErrorOr<OwnPtr<YUVData>> yuv_frame() override;
+
 private:
     explicit JPEGImageDecoderPlugin(NonnullOwnPtr<JPEGLoadingContext>);
 
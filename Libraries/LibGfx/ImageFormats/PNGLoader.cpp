@@ -30,6 +30,7 @@ struct PNGLoadingContext {
     u32 frame_count { 0 };
     u32 loop_count { 0 };
     Vector<ImageFrameDescriptor> frame_descriptors;
+    RefPtr<Bitmap> partially_decoded_bitmap;
     Optional<Media::CodingIndependentCodePoints> cicp;
     Optional<ByteBuffer> icc_profile;
     OwnPtr<ExifMetadata> exif_metadata;
@@ -64,8 +65,11 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> PNGImageDecoderPlugin::create(Readonl
         // NOTE: If we didn't fail in initialize(), that means we have size information.
         //       We can create a single-frame bitmap with that size and return it.
         //       This is weird, but kinda matches the behavior of other browsers.
-        auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Premultiplied, decoder->m_context->size));
-        decoder->m_context->frame_descriptors.append({ move(bitmap), 0 });
+        //       If the data was cut off while decoding a single-frame PNG, we show the rows that were decoded so far.
+        auto bitmap = decoder->m_context->partially_decoded_bitmap;
+        if (!bitmap)
+            bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Premultiplied, decoder->m_context->size));
+        decoder->m_context->frame_descriptors.append({ bitmap.release_nonnull(), 0 });
         decoder->m_context->frame_count = 1;
         return decoder;
     }
@@ -256,14 +260,21 @@ ErrorOr<void> PNGLoadingContext::apply_exif_orientation()
 ErrorOr<size_t> PNGLoadingContext::read_frames(png_structp png_ptr, png_infop info_ptr)
 {
     Vector<u8*> row_pointers;
+    auto read_frame_into = [&](Bitmap& frame_bitmap) {
+        row_pointers.resize_and_keep_capacity(frame_bitmap.height());
+        for (auto i = 0; i < frame_bitmap.height(); ++i)
+            row_pointers[i] = frame_bitmap.scanline_u8(i);
+
+        // NB: Unlike png_read_image(), reading each pass into the display rows fills in the pixels of the later passes of
+        //     an interlaced image with their nearest decoded neighbor, so that an image which is cut off still shows
+        //     the passes that did arrive. The final pass overwrites every such pixel.
+        auto pass_count = png_set_interlace_handling(png_ptr);
+        for (auto pass = 0; pass < pass_count; ++pass)
+            png_read_rows(png_ptr, nullptr, row_pointers.data(), frame_bitmap.height());
+    };
     auto decode_frame = [&](IntSize frame_size) -> ErrorOr<NonnullRefPtr<Bitmap>> {
         auto frame_bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Unpremultiplied, frame_size));
-
-        row_pointers.resize_and_keep_capacity(frame_size.height());
-        for (auto i = 0; i < frame_size.height(); ++i)
-            row_pointers[i] = frame_bitmap->scanline_u8(i);
-
-        png_read_image(png_ptr, row_pointers.data());
+        read_frame_into(*frame_bitmap);
         return frame_bitmap;
     };
 
@@ -361,8 +372,11 @@ ErrorOr<size_t> PNGLoadingContext::read_frames(png_structp png_ptr, png_infop in
         frame_count = 1;
         loop_count = 0;
 
-        auto decoded_frame_bitmap = TRY(decode_frame(size));
-        frame_descriptors.append({ move(decoded_frame_bitmap), 0 });
+        // NB: The bitmap is kept in the context while it is being decoded, so that the rows decoded before an error are
+        //     not lost.
+        partially_decoded_bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Unpremultiplied, size));
+        read_frame_into(*partially_decoded_bitmap);
+        frame_descriptors.append({ partially_decoded_bitmap.release_nonnull(), 0 });
     }
     return frame_count;
 }
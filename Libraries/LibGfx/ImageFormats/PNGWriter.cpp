@@ -13,6 +13,25 @@
 
 namespace Gfx {
 
+static int png_filters_for_strategy(PNGFilterStrategy strategy)
+{
+    switch (strategy) {
+    case PNGFilterStrategy::Adaptive:
+        return PNG_ALL_FILTERS;
+    case PNGFilterStrategy::None:
+        return PNG_FILTER_NONE;
+    case PNGFilterStrategy::Sub:
+        return PNG_FILTER_SUB;
+    case PNGFilterStrategy::Up:
+        return PNG_FILTER_UP;
+    case PNGFilterStrategy::Average:
+        return PNG_FILTER_AVG;
+    case PNGFilterStrategy::Paeth:
+        return PNG_FILTER_PAETH;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 struct WriterContext {
     Vector<u8*> row_pointers;
     ByteBuffer png_data;
@@ -44,6 +63,14 @@ ErrorOr<ByteBuffer> PNGWriter::encode(Gfx::Bitmap const& bitmap, Options options
         png_set_iCCP(png_ptr, info_ptr, "embedded profile", 0, options.icc_data->data(), options.icc_data->size());
     }
 
+    if (options.compression_level.has_value()) {
+        VERIFY(*options.compression_level >= 0 && *options.compression_level <= 9);
+        png_set_compression_level(png_ptr, *options.compression_level);
+    }
+
+    if (options.filter_strategy != PNGFilterStrategy::Adaptive)
+        png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, png_filters_for_strategy(options.filter_strategy));
+
     if (bitmap.format() == BitmapFormat::BGRA8888 || bitmap.format() == BitmapFormat::BGRx8888) {
         png_set_bgr(png_ptr);
     }
@@ -13,11 +13,27 @@
 
 namespace Gfx {
 
+enum class PNGFilterStrategy {
+    // Let libpng choose the filter that is likely to compress best for each row.
+    Adaptive,
+    // Use a single filter for every row, which is faster to encode.
+    None,
+    Sub,
+    Up,
+    Average,
+    Paeth,
+};
+
 // This is not a nested struct to work around https://llvm.org/PR36684
 struct PNGWriterOptions {
     // Data for the iCCP chunk.
     // FIXME: Allow writing cICP, sRGB, or gAMA instead too.
     Optional<ReadonlyBytes> icc_data;
+
+    // The zlib compression level, from 0 (fastest) to 9 (smallest). If unset, libpng's default is used.
+    Optional<int> compression_level;
+
+    PNGFilterStrategy filter_strategy { PNGFilterStrategy::Adaptive };
 };
 
 class PNGWriter {
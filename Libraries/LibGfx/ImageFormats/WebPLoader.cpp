@@ -29,6 +29,7 @@ struct WebPLoadingContext {
     IntSize size;
     bool has_alpha;
     bool has_animation;
+    bool is_lossy;
     size_t frame_count;
     size_t loop_count;
     ByteBuffer icc_data;
@@ -81,6 +82,7 @@ static ErrorOr<void> decode_webp_header(WebPLoadingContext& context)
     context.size = IntSize { width, height };
     context.has_animation = webp_bitstream_features.has_animation;
     context.has_alpha = webp_bitstream_features.has_alpha;
+    context.is_lossy = webp_bitstream_features.format == 1;
     context.frame_count = 1;
     context.loop_count = 0;
 
@@ -122,6 +124,12 @@ static ErrorOr<void> decode_webp_header(WebPLoadingContext& context)
     WebPMux* mux = WebPMuxCreate(&webp_data, 0);
     ScopeGuard guard { [=]() { WebPMuxDelete(mux); } };
 
+    // NB: The mux refuses to parse data that is cut off, but we can still decode the part of the image that did arrive.
+    if (!mux && !webp_bitstream_features.has_animation) {
+        context.state = WebPLoadingContext::State::HeaderDecoded;
+        return {};
+    }
+
     uint32_t flag = 0;
     WebPMuxError err = WebPMuxGetFeatures(mux, &flag);
     if (err != WEBP_MUX_OK)
@@ -161,7 +169,8 @@ static ErrorOr<void> ensure_anim_decoder(WebPLoadingContext& context)
     return {};
 }
 
-static ErrorOr<ImageFrameDescriptor> decode_next_webp_animation_frame(WebPLoadingContext& context)
+// Decodes the next frame onto the canvas of the animation decoder, and returns the canvas.
+static ErrorOr<u8 const*> advance_webp_animation(WebPLoadingContext& context, int& duration)
 {
     TRY(ensure_anim_decoder(context));
 
@@ -173,14 +182,22 @@ static ErrorOr<ImageFrameDescriptor> decode_next_webp_animation_frame(WebPLoadin
     if (!WebPAnimDecoderGetNext(context.anim_decoder, &frame_data, &timestamp))
         return Error::from_string_literal("Failed to decode animated frame");
 
+    duration = timestamp - context.anim_old_timestamp;
+    context.anim_old_timestamp = timestamp;
+    ++context.anim_frames_decoded;
+
+    return frame_data;
+}
+
+static ErrorOr<ImageFrameDescriptor> decode_next_webp_animation_frame(WebPLoadingContext& context)
+{
+    int duration = 0;
+    auto const* frame_data = TRY(advance_webp_animation(context, duration));
+
     auto bitmap_format = context.has_alpha ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888;
     auto bitmap = TRY(Bitmap::create(bitmap_format, Gfx::AlphaType::Unpremultiplied, context.size));
     memcpy(bitmap->scanline_u8(0), frame_data, context.size.width() * context.size.height() * 4);
 
-    auto duration = timestamp - context.anim_old_timestamp;
-    context.anim_old_timestamp = timestamp;
-    ++context.anim_frames_decoded;
-
     return ImageFrameDescriptor { bitmap, duration };
 }
 
@@ -192,15 +209,49 @@ static ErrorOr<void> decode_webp_image(WebPLoadingContext& context)
     auto bitmap_format = context.has_alpha ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888;
     auto bitmap = TRY(Bitmap::create(bitmap_format, Gfx::AlphaType::Unpremultiplied, context.size));
 
-    auto image_data = WebPDecodeBGRAInto(context.data.data(), context.data.size(), bitmap->scanline_u8(0), bitmap->data_size(), bitmap->pitch());
-    if (image_data == nullptr)
+    // NB: The incremental decoder decodes as many rows as there is data for, so that an image which is cut off, such as
+    //     one that is still being downloaded, still shows the rows that did arrive.
+    auto* decoder = WebPINewRGB(MODE_BGRA, bitmap->scanline_u8(0), bitmap->data_size(), bitmap->pitch());
+    if (decoder == nullptr)
+        return Error::from_string_literal("Failed to create webp decoder");
+    ScopeGuard guard { [=]() { WebPIDelete(decoder); } };
+
+    auto status = WebPIUpdate(decoder, context.data.data(), context.data.size());
+    if (status == VP8_STATUS_SUSPENDED) {
+        int last_decoded_row = 0;
+        if (WebPIDecGetRGB(decoder, &last_decoded_row, nullptr, nullptr, nullptr) == nullptr || last_decoded_row == 0)
+            return Error::from_string_literal("Failed to decode webp image into bitmap");
+    } else if (status != VP8_STATUS_OK) {
         return Error::from_string_literal("Failed to decode webp image into bitmap");
+    }
 
     context.frame_descriptors.append(ImageFrameDescriptor { bitmap, 0 });
 
     return {};
 }
 
+static ErrorOr<NonnullOwnPtr<YUVData>> decode_webp_image_to_yuv(WebPLoadingContext& context)
+{
+    // Lossy WebP images are always stored as studio range BT.601 YCbCr with 4:2:0 subsampling, converted from sRGB.
+    Media::CodingIndependentCodePoints cicp { Media::ColorPrimaries::BT709, Media::TransferCharacteristics::SRGB, Media::MatrixCoefficients::BT601, Media::VideoFullRangeFlag::Studio };
+    Media::Subsampling subsampling { true, true };
+    auto yuv_data = TRY(YUVData::create_shareable(context.size, 8, subsampling, cicp));
+
+    auto uv_width = subsampling.subsampled_size(context.size).width();
+    auto y_plane = yuv_data->y_data();
+    auto u_plane = yuv_data->u_data();
+    auto v_plane = yuv_data->v_data();
+
+    auto* result = WebPDecodeYUVInto(context.data.data(), context.data.size(),
+        y_plane.data(), y_plane.size(), context.size.width(),
+        u_plane.data(), u_plane.size(), uv_width,
+        v_plane.data(), v_plane.size(), uv_width);
+    if (result == nullptr)
+        return Error::from_string_literal("Failed to decode webp image into YUV planes");
+
+    return yuv_data;
+}
+
 bool WebPImageDecoderPlugin::sniff(ReadonlyBytes data)
 {
     WebPLoadingContext context;
@@ -261,8 +312,11 @@ ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Option
         }
 
         // Skip frames before the requested index.
+        // NB: libwebp has no way to seek, so these still have to be decoded onto its canvas. We can at least avoid
+        //     copying each of them into a bitmap that is thrown away right after.
+        int skipped_duration = 0;
         while (m_context->anim_frames_decoded < index)
-            (void)TRY(decode_next_webp_animation_frame(*m_context));
+            (void)TRY(advance_webp_animation(*m_context, skipped_duration));
 
         // Decode and return the requested frame without caching it.
         return TRY(decode_next_webp_animation_frame(*m_context));
@@ -287,6 +341,22 @@ int WebPImageDecoderPlugin::frame_duration(size_t index)
     return 0;
 }
 
+ErrorOr<OwnPtr<YUVData>> WebPImageDecoderPlugin::yuv_frame()
+{
+    // NB: Lossless images are stored as RGB, and the YUV planes have no room for alpha.
+    if (!m_context->is_lossy || m_context->has_animation || m_context->has_alpha)
+        return nullptr;
+
+    // NB: The YUV data is converted as sRGB, so images with their own color profile have to be converted to RGB here.
+    if (!m_context->icc_data.is_empty())
+        return nullptr;
+
+    if (m_context->state != WebPLoadingContext::State::HeaderDecoded)
+        return nullptr;
+
+    return TRY(decode_webp_image_to_yuv(*m_context));
+}
+
 ErrorOr<Optional<ReadonlyBytes>> WebPImageDecoderPlugin::icc_data()
 {
     if (m_context->state < WebPLoadingContext::State::HeaderDecoded)
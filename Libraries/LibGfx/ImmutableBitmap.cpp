@@ -11,6 +11,7 @@
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibGfx/SkiaUtils.h>
 #include <LibGfx/YUVData.h>
+#include <LibThreading/Mutex.h>
 
 #include <core/SkBitmap.h>
 #include <core/SkCanvas.h>
@@ -42,8 +43,14 @@ struct ImmutableBitmapImpl {
     RefPtr<Gfx::Bitmap> bitmap;
     ColorSpace color_space;
     OwnPtr<YUVData> yuv_data;
+
+    // Downscaled copies of sk_image, each half the size of the one before.
+    Vector<sk_sp<SkImage>> halved_sk_images;
 };
 
+// NB: Display lists may be played back by several threads at once.
+static Threading::Mutex s_halved_sk_images_mutex;
+
 int ImmutableBitmap::width() const
 {
     if (m_impl->yuv_data)
@@ -70,6 +77,10 @@ IntSize ImmutableBitmap::size() const
 
 AlphaType ImmutableBitmap::alpha_type() const
 {
+    // YUV data has no alpha channel.
+    if (m_impl->yuv_data)
+        return AlphaType::Premultiplied;
+
     // We assume premultiplied alpha type for opaque surfaces since that is Skia's preferred alpha type and the
     // effective pixel data is identical between premultiplied and unpremultiplied in that case.
     return m_impl->sk_image->alphaType() == kUnpremul_SkAlphaType ? AlphaType::Unpremultiplied : AlphaType::Premultiplied;
@@ -77,9 +88,58 @@ AlphaType ImmutableBitmap::alpha_type() const
 
 SkImage const* ImmutableBitmap::sk_image() const
 {
+    // YUV data is converted to RGB on the GPU once the image is first needed.
+    if (m_impl->yuv_data) {
+        auto context = SkiaBackendContext::the();
+        if (!context)
+            return nullptr;
+
+        context->lock();
+        ScopeGuard unlock_guard = [&context] { context->unlock(); };
+        (void)ensure_sk_image(*context);
+        return m_impl->sk_image.get();
+    }
+
     return m_impl->sk_image.get();
 }
 
+SkImage const* ImmutableBitmap::sk_image_for_size(IntSize size) const
+{
+    // NB: Only raster images are downscaled here. Halving a texture would need the GPU context, and any copy would
+    //     take up as much texture memory as a mipmap.
+    auto* sk_image = this->sk_image();
+    if (!sk_image || sk_image->isTextureBacked() || size.is_empty())
+        return sk_image;
+
+    auto halved_size = [](IntSize image_size) { return IntSize { ceil_div(image_size.width(), 2), ceil_div(image_size.height(), 2) }; };
+
+    size_t halvings = 0;
+    for (auto image_size = this->size(); image_size.width() >= size.width() * 2 && image_size.height() >= size.height() * 2; image_size = halved_size(image_size))
+        ++halvings;
+    if (halvings == 0)
+        return sk_image;
+
+    Threading::MutexLocker locker(s_halved_sk_images_mutex);
+    auto& halved_sk_images = m_impl->halved_sk_images;
+    while (halved_sk_images.size() < halvings) {
+        auto const& source = halved_sk_images.is_empty() ? m_impl->sk_image : halved_sk_images.last();
+        auto target_size = halved_size({ source->width(), source->height() });
+
+        // Sampling bilinearly halfway between each pair of source pixels averages each 2x2 block of them.
+        SkBitmap sk_bitmap;
+        if (!sk_bitmap.tryAllocPixels(source->imageInfo().makeWH(target_size.width(), target_size.height())))
+            break;
+        if (!source->scalePixels(sk_bitmap.pixmap(), SkSamplingOptions(SkFilterMode::kLinear)))
+            break;
+        sk_bitmap.setImmutable();
+        halved_sk_images.append(sk_bitmap.asImage());
+    }
+
+    if (halved_sk_images.is_empty())
+        return sk_image;
+    return halved_sk_images[min(halvings, halved_sk_images.size()) - 1].get();
+}
+
 static int bytes_per_pixel_for_export_format(ExportFormat format)
 {
     switch (format) {
@@ -189,13 +249,16 @@ ErrorOr<BitmapExportResult> ImmutableBitmap::export_to_byte_buffer(ExportFormat
 
 RefPtr<Gfx::Bitmap const> ImmutableBitmap::bitmap() const
 {
-    if (!m_impl->bitmap && m_impl->sk_image) {
-        auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, { m_impl->sk_image->width(), m_impl->sk_image->height() }));
+    if (m_impl->bitmap)
+        return m_impl->bitmap;
+
+    if (auto const* sk_image = this->sk_image()) {
+        auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, { sk_image->width(), sk_image->height() }));
         auto image_info = SkImageInfo::Make(bitmap->width(), bitmap->height(), kBGRA_8888_SkColorType, kPremul_SkAlphaType, SkColorSpace::MakeSRGB());
         SkPixmap pixmap(image_info, bitmap->begin(), bitmap->pitch());
         if (m_impl->context)
             m_impl->context->lock();
-        m_impl->sk_image->readPixels(pixmap, 0, 0);
+        sk_image->readPixels(m_impl->context ? m_impl->context->sk_context() : nullptr, pixmap, 0, 0);
         if (m_impl->context)
             m_impl->context->unlock();
         m_impl->bitmap = move(bitmap);
@@ -218,6 +281,7 @@ ErrorOr<NonnullRefPtr<ImmutableBitmap>> ImmutableBitmap::create_from_yuv(Nonnull
         .bitmap = nullptr,
         .color_space = {},
         .yuv_data = move(yuv_data),
+        .halved_sk_images = {},
     };
     return adopt_ref(*new ImmutableBitmap(make<ImmutableBitmapImpl>(move(impl))));
 }
@@ -310,6 +374,15 @@ static sk_sp<SkColorSpace> color_space_from_cicp(Media::CodingIndependentCodePoi
 
 bool ImmutableBitmap::ensure_sk_image(SkiaBackendContext& context) const
 {
+    // NB: YUV data is converted on demand from whichever thread first needs the image, so we hold the context's lock
+    //     while checking whether it has been converted already.
+    if (m_impl->yuv_data)
+        context.lock();
+    ScopeGuard unlock_yuv_guard = [&] {
+        if (m_impl->yuv_data)
+            context.unlock();
+    };
+
     if (m_impl->context) {
         VERIFY(m_impl->context.ptr() == &context);
         return true;
@@ -360,7 +433,8 @@ bool ImmutableBitmap::ensure_sk_image(SkiaBackendContext& context) const
 
 Color ImmutableBitmap::get_pixel(int x, int y) const
 {
-    return m_impl->bitmap->get_pixel(x, y);
+    // NB: Bitmaps that were not created from a Gfx::Bitmap are read back into one first.
+    return bitmap()->get_pixel(x, y);
 }
 
 static SkAlphaType to_skia_alpha_type(Gfx::AlphaType alpha_type)
@@ -390,6 +464,7 @@ NonnullRefPtr<ImmutableBitmap> ImmutableBitmap::create(NonnullRefPtr<Bitmap> bit
         .bitmap = move(bitmap),
         .color_space = move(color_space),
         .yuv_data = nullptr,
+        .halved_sk_images = {},
     };
     return adopt_ref(*new ImmutableBitmap(make<ImmutableBitmapImpl>(move(impl))));
 }
@@ -420,6 +495,7 @@ NonnullRefPtr<ImmutableBitmap> ImmutableBitmap::create_snapshot_from_painting_su
         .bitmap = nullptr,
         .color_space = {},
         .yuv_data = nullptr,
+        .halved_sk_images = {},
     };
     return adopt_ref(*new ImmutableBitmap(make<ImmutableBitmapImpl>(move(impl))));
 }
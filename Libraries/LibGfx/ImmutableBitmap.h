@@ -67,6 +67,12 @@ public:
     AlphaType alpha_type() const;
 
     SkImage const* sk_image() const;
+
+    // Returns an image to draw instead of sk_image() when drawing this bitmap at the given size with a filtering
+    // scaling mode. Once that size is less than half of the bitmap's, this is a copy downscaled to at least that size
+    // by repeated halving. The copies are kept for as long as the bitmap, so that downscaled drawing doesn't have to
+    // sample all of the original pixels every time.
+    SkImage const* sk_image_for_size(IntSize) const;
     [[nodiscard]] ErrorOr<BitmapExportResult> export_to_byte_buffer(ExportFormat format, int flags, Optional<int> target_width, Optional<int> target_height) const;
 
     Color get_pixel(int x, int y) const;
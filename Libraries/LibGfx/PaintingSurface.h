@@ -11,6 +11,8 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/RefPtr.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/Point.h>
+#include <LibGfx/Rect.h>
 #include <LibGfx/Size.h>
 #include <LibGfx/SkiaBackendContext.h>
 
@@ -43,8 +45,13 @@ public:
     static NonnullRefPtr<PaintingSurface> create_from_vkimage(NonnullRefPtr<SkiaBackendContext> context, NonnullRefPtr<VulkanImage> vulkan_image, Origin origin);
 #endif
 
-    void read_into_bitmap(Bitmap&);
+    // Reads the pixels of the given bitmap's size starting at the given position, converting them to the bitmap's format
+    // and alpha type. Pixels outside of the surface are left as they are in the bitmap.
+    void read_into_bitmap(Bitmap&, IntPoint source_position = {});
     void write_from_bitmap(Bitmap const&);
+    // Writes the given rectangle of the bitmap to the surface at the given position, converting it from the bitmap's
+    // format and alpha type. Pixels that would end up outside of the surface are skipped.
+    void write_from_bitmap(Bitmap const&, IntRect const& source_rect, IntPoint destination_position);
 
     void notify_content_will_change();
 
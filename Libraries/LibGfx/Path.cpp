@@ -16,4 +16,12 @@ NonnullOwnPtr<Gfx::PathImpl> PathImpl::create()
 
 PathImpl::~PathImpl() = default;
 
+ErrorOr<Path> Path::from_bytes(ReadonlyBytes bytes)
+{
+    Path path;
+    if (!path.impl().read_from_bytes(bytes))
+        return Error::from_string_literal("Invalid path data");
+    return path;
+}
+
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/Forward.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/String.h>
@@ -51,6 +52,9 @@ public:
     virtual NonnullOwnPtr<PathImpl> place_text_along(Utf16View const& text, Font const&) const = 0;
 
     virtual String to_svg_string() const = 0;
+
+    virtual ByteBuffer to_bytes() const = 0;
+    virtual bool read_from_bytes(ReadonlyBytes) = 0;
 };
 
 class Path {
@@ -117,6 +121,10 @@ public:
 
     String to_svg_string() const { return impl().to_svg_string(); }
 
+    // An opaque representation of the path, which can only be restored by from_bytes() with the same path backend.
+    ByteBuffer to_bytes() const { return impl().to_bytes(); }
+    static ErrorOr<Path> from_bytes(ReadonlyBytes);
+
     void transform(Gfx::AffineTransform const& transform) { m_impl = impl().copy_transformed(transform); }
 
     PathImpl& impl() { return *m_impl; }
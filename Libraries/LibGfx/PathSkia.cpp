@@ -261,4 +261,16 @@ String PathImplSkia::to_svg_string() const
     return MUST(String::from_utf8(StringView { svg_string.c_str(), svg_string.size() }));
 }
 
+ByteBuffer PathImplSkia::to_bytes() const
+{
+    auto bytes = MUST(ByteBuffer::create_uninitialized(m_path->writeToMemory(nullptr)));
+    m_path->writeToMemory(bytes.data());
+    return bytes;
+}
+
+bool PathImplSkia::read_from_bytes(ReadonlyBytes bytes)
+{
+    return m_path->readFromMemory(bytes.data(), bytes.size()) == bytes.size();
+}
+
 }
@@ -47,6 +47,9 @@ public:
 
     virtual String to_svg_string() const override;
 
+    virtual ByteBuffer to_bytes() const override;
+    virtual bool read_from_bytes(ReadonlyBytes) override;
+
     SkPath const& sk_path() const { return *m_path; }
     SkPath& sk_path() { return *m_path; }
 
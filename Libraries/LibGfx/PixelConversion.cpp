@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/BitCast.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibGfx/PixelConversion.h>
+
+namespace Gfx {
+
+using namespace AK::SIMD;
+
+static constexpr u8x16 OPAQUE_U8 = { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 };
+static constexpr u16x8 OPAQUE_U16 = { 255, 255, 255, 255, 255, 255, 255, 255 };
+
+// Splits four pixels into two vectors of two pixels each, with a 16-bit lane for each channel.
+ALWAYS_INLINE static void widen(u8x16 pixels, u16x8& low, u16x8& high)
+{
+    low = __builtin_convertvector(__builtin_shufflevector(pixels, pixels, 0, 1, 2, 3, 4, 5, 6, 7), u16x8);
+    high = __builtin_convertvector(__builtin_shufflevector(pixels, pixels, 8, 9, 10, 11, 12, 13, 14, 15), u16x8);
+}
+
+ALWAYS_INLINE static u8x16 narrow(u16x8 low, u16x8 high)
+{
+    auto low_bytes = __builtin_convertvector(low, u8x8);
+    auto high_bytes = __builtin_convertvector(high, u8x8);
+    return __builtin_shufflevector(low_bytes, high_bytes, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+}
+
+// NB: These are exact for any product of two 8-bit values, which lets us avoid an actual division.
+ALWAYS_INLINE static constexpr u32 divide_by_255(u32 value)
+{
+    return (value + 1 + (value >> 8)) >> 8;
+}
+
+ALWAYS_INLINE static u16x8 divide_by_255(u16x8 value)
+{
+    return (value + 1 + (value >> 8)) >> 8;
+}
+
+ALWAYS_INLINE static constexpr u32 divide_by_255_rounded(u32 value)
+{
+    value += 128;
+    return (value + (value >> 8)) >> 8;
+}
+
+ALWAYS_INLINE static u16x8 divide_by_255_rounded(u16x8 value)
+{
+    value += 128;
+    return (value + (value >> 8)) >> 8;
+}
+
+void convert_bgr888_to_rgbx8888(ReadonlyBytes source, Span<RawPixel> destination)
+{
+    VERIFY(source.size() == destination.size() * 3);
+
+    auto const* input = source.data();
+    auto* output = destination.data();
+    size_t count = destination.size();
+    size_t i = 0;
+
+    // NB: Each iteration reads 16 bytes but only converts the first 12, so we stop while 16 bytes are still left.
+    for (; count - i >= 6; i += 4) {
+        auto pixels = load_unaligned<u8x16>(input + i * 3);
+        store_unaligned(output + i, __builtin_shufflevector(pixels, OPAQUE_U8, 2, 1, 0, 16, 5, 4, 3, 16, 8, 7, 6, 16, 11, 10, 9, 16));
+    }
+
+    for (; i < count; ++i) {
+        auto const* pixel = input + i * 3;
+        output[i] = 0xff000000 | (pixel[0] << 16) | (pixel[1] << 8) | pixel[2];
+    }
+}
+
+void convert_cmyk_to_bgrx8888(ReadonlySpan<CMYK> source, Span<RawPixel> destination)
+{
+    static_assert(sizeof(CMYK) == 4);
+    VERIFY(source.size() == destination.size());
+
+    auto const* input = source.data();
+    auto* output = destination.data();
+    size_t count = destination.size();
+    size_t i = 0;
+
+    auto convert = [](u16x8 cmyk) {
+        auto inverted = OPAQUE_U16 - cmyk;
+        auto inverted_k = __builtin_shufflevector(inverted, inverted, 3, 3, 3, 3, 7, 7, 7, 7);
+        auto rgb = divide_by_255(inverted * inverted_k);
+
+        // Cyan, magenta and yellow turn into red, green and blue, which are stored in reverse order.
+        return __builtin_shufflevector(rgb, OPAQUE_U16, 2, 1, 0, 8, 6, 5, 4, 8);
+    };
+
+    for (; i + 4 <= count; i += 4) {
+        u16x8 low;
+        u16x8 high;
+        widen(load_unaligned<u8x16>(input + i), low, high);
+        store_unaligned(output + i, narrow(convert(low), convert(high)));
+    }
+
+    for (; i < count; ++i) {
+        auto const& cmyk = input[i];
+        u32 k = 255 - cmyk.k;
+        output[i] = 0xff000000 | (divide_by_255((255 - cmyk.c) * k) << 16) | (divide_by_255((255 - cmyk.m) * k) << 8) | divide_by_255((255 - cmyk.y) * k);
+    }
+}
+
+void expand_palette_indices(ReadonlyBytes indices, ReadonlySpan<RawPixel> palette, Span<RawPixel> destination, Optional<u8> transparent_index)
+{
+    VERIFY(indices.size() == destination.size());
+
+    // NB: A palette lookup is a gather, which is not worth vectorizing without gather instructions. We still avoid
+    //     checking bounds and transparency for each pixel, which is what made the per-pixel loops of decoders slow.
+    auto const* input = indices.data();
+    auto const* colors = palette.data();
+    auto* output = destination.data();
+    size_t count = destination.size();
+
+    if (!transparent_index.has_value()) {
+        for (size_t i = 0; i < count; ++i)
+            output[i] = colors[input[i]];
+        return;
+    }
+
+    auto transparent = *transparent_index;
+    for (size_t i = 0; i < count; ++i) {
+        if (input[i] != transparent)
+            output[i] = colors[input[i]];
+    }
+}
+
+void premultiply_alpha(Span<RawPixel> pixels)
+{
+    auto* data = pixels.data();
+    size_t count = pixels.size();
+    size_t i = 0;
+
+    auto premultiply = [](u16x8 channels) {
+        // NB: Multiplying the alpha channel by 255 leaves it unchanged.
+        auto alphas = __builtin_shufflevector(channels, OPAQUE_U16, 3, 3, 3, 8, 7, 7, 7, 8);
+        return divide_by_255_rounded(channels * alphas);
+    };
+
+    for (; i + 4 <= count; i += 4) {
+        u16x8 low;
+        u16x8 high;
+        widen(load_unaligned<u8x16>(data + i), low, high);
+        store_unaligned(data + i, narrow(premultiply(low), premultiply(high)));
+    }
+
+    for (; i < count; ++i) {
+        auto pixel = data[i];
+        u32 alpha = pixel >> 24;
+        data[i] = (alpha << 24)
+            | (divide_by_255_rounded(((pixel >> 16) & 0xff) * alpha) << 16)
+            | (divide_by_255_rounded(((pixel >> 8) & 0xff) * alpha) << 8)
+            | divide_by_255_rounded((pixel & 0xff) * alpha);
+    }
+}
+
+static constexpr auto s_unpremultiply_factors = [] {
+    Array<float, 256> factors {};
+    factors[0] = 0.0f;
+    for (size_t alpha = 1; alpha < factors.size(); ++alpha)
+        factors[alpha] = 255.0f / static_cast<float>(alpha);
+    return factors;
+}();
+
+void unpremultiply_alpha(Span<RawPixel> pixels)
+{
+    auto* data = pixels.data();
+    size_t count = pixels.size();
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        auto pixel = load_unaligned<u32x4>(data + i);
+        auto alpha = pixel >> 24;
+
+        // NB: There is no gather instruction to look up the factors with, but they are only four loads per four pixels.
+        f32x4 factor { s_unpremultiply_factors[alpha[0]], s_unpremultiply_factors[alpha[1]], s_unpremultiply_factors[alpha[2]], s_unpremultiply_factors[alpha[3]] };
+
+        auto unpremultiply = [&](u32x4 channel) {
+            auto value = to_u32x4(to_f32x4(channel) * factor + 0.5f);
+
+            // Color channels larger than the alpha channel are invalid, and are clamped rather than left to overflow.
+            auto overflow = bit_cast<u32x4>(value > 255u);
+            return (value & ~overflow) | (overflow & 255u);
+        };
+
+        auto result = (alpha << 24)
+            | (unpremultiply((pixel >> 16) & 0xff) << 16)
+            | (unpremultiply((pixel >> 8) & 0xff) << 8)
+            | unpremultiply(pixel & 0xff);
+        store_unaligned(data + i, result);
+    }
+
+    for (; i < count; ++i) {
+        auto pixel = data[i];
+        u32 alpha = pixel >> 24;
+        auto factor = s_unpremultiply_factors[alpha];
+
+        auto unpremultiply = [&](u32 channel) {
+            return min(static_cast<u32>(static_cast<float>(channel) * factor + 0.5f), 255u);
+        };
+
+        data[i] = (alpha << 24)
+            | (unpremultiply((pixel >> 16) & 0xff) << 16)
+            | (unpremultiply((pixel >> 8) & 0xff) << 8)
+            | unpremultiply(pixel & 0xff);
+    }
+}
+
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Span.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/CMYKBitmap.h>
+
+// Conversions between pixel formats which operate on whole rows of pixels at once, so that they can process several
+// pixels per instruction. The source and destination spans must have the same number of pixels.
+namespace Gfx {
+
+// Converts packed 24-bit pixels stored in blue, green, red byte order into RGBx8888 pixels.
+void convert_bgr888_to_rgbx8888(ReadonlyBytes source, Span<RawPixel> destination);
+
+// Converts CMYK pixels into BGRx8888 pixels with a naive formula, which does not take any color profile into account.
+void convert_cmyk_to_bgrx8888(ReadonlySpan<CMYK> source, Span<RawPixel> destination);
+
+// Looks up each index in the palette, which must have an entry for every index. Pixels whose index is the transparent
+// index are left untouched.
+void expand_palette_indices(ReadonlyBytes indices, ReadonlySpan<RawPixel> palette, Span<RawPixel> destination, Optional<u8> transparent_index = {});
+
+// These convert BGRA8888 and RGBA8888 pixels between unpremultiplied and premultiplied alpha in place.
+void premultiply_alpha(Span<RawPixel>);
+void unpremultiply_alpha(Span<RawPixel>);
+
+}
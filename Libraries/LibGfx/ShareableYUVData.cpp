@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/ShareableYUVData.h>
+#include <LibGfx/YUVData.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibIPC/File.h>
+
+namespace Gfx {
+
+ShareableYUVData::ShareableYUVData(YUVData const& yuv_data)
+    : ShareableYUVData(yuv_data.size(), yuv_data.bit_depth(), yuv_data.subsampling(), yuv_data.cicp(), yuv_data.anonymous_buffer())
+{
+    VERIFY(m_buffer.is_valid());
+}
+
+ShareableYUVData::ShareableYUVData(IntSize size, u8 bit_depth, Media::Subsampling subsampling, Media::CodingIndependentCodePoints cicp, Core::AnonymousBuffer buffer)
+    : m_size(size)
+    , m_bit_depth(bit_depth)
+    , m_subsampling(subsampling)
+    , m_cicp(cicp)
+    , m_buffer(move(buffer))
+{
+}
+
+ErrorOr<NonnullOwnPtr<YUVData>> ShareableYUVData::to_yuv_data() const
+{
+    if (!is_valid())
+        return Error::from_string_literal("ShareableYUVData is invalid");
+    return YUVData::create_with_anonymous_buffer(m_size, m_bit_depth, m_subsampling, m_cicp, m_buffer);
+}
+
+}
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder& encoder, Gfx::ShareableYUVData const& yuv_data)
+{
+    TRY(encoder.encode(yuv_data.is_valid()));
+    if (!yuv_data.is_valid())
+        return {};
+
+    TRY(encoder.encode(TRY(IPC::File::clone_fd(yuv_data.anonymous_buffer().fd()))));
+    TRY(encoder.encode(yuv_data.size()));
+    TRY(encoder.encode(yuv_data.bit_depth()));
+    TRY(encoder.encode(yuv_data.subsampling().x()));
+    TRY(encoder.encode(yuv_data.subsampling().y()));
+
+    auto const& cicp = yuv_data.cicp();
+    TRY(encoder.encode(to_underlying(cicp.color_primaries())));
+    TRY(encoder.encode(to_underlying(cicp.transfer_characteristics())));
+    TRY(encoder.encode(to_underlying(cicp.matrix_coefficients())));
+    TRY(encoder.encode(to_underlying(cicp.video_full_range_flag())));
+    return {};
+}
+
+template<>
+ErrorOr<Gfx::ShareableYUVData> decode(Decoder& decoder)
+{
+    if (auto valid = TRY(decoder.decode<bool>()); !valid)
+        return Gfx::ShareableYUVData {};
+
+    auto anon_file = TRY(decoder.decode<IPC::File>());
+    auto size = TRY(decoder.decode<Gfx::IntSize>());
+
+    auto bit_depth = TRY(decoder.decode<u8>());
+    if (bit_depth == 0 || bit_depth > 16)
+        return Error::from_string_literal("IPC: Invalid Gfx::ShareableYUVData bit depth");
+
+    auto subsampling_x = TRY(decoder.decode<bool>());
+    auto subsampling_y = TRY(decoder.decode<bool>());
+    Media::Subsampling subsampling { subsampling_x, subsampling_y };
+
+    auto color_primaries = static_cast<Media::ColorPrimaries>(TRY(decoder.decode<u8>()));
+    auto transfer_characteristics = static_cast<Media::TransferCharacteristics>(TRY(decoder.decode<u8>()));
+    auto matrix_coefficients = static_cast<Media::MatrixCoefficients>(TRY(decoder.decode<u8>()));
+    auto video_full_range_flag = static_cast<Media::VideoFullRangeFlag>(TRY(decoder.decode<u8>()));
+    Media::CodingIndependentCodePoints cicp { color_primaries, transfer_characteristics, matrix_coefficients, video_full_range_flag };
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_from_anon_fd(anon_file.take_fd(), TRY(Gfx::YUVData::size_in_bytes(size, bit_depth, subsampling))));
+
+    return Gfx::ShareableYUVData { size, bit_depth, subsampling, cicp, move(buffer) };
+}
+
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
+#include <LibIPC/Forward.h>
+#include <LibMedia/Color/CodingIndependentCodePoints.h>
+#include <LibMedia/Subsampling.h>
+
+namespace Gfx {
+
+// Refers to YUV data whose planes are stored in shared memory, so that it can be sent to another process.
+class ShareableYUVData {
+public:
+    ShareableYUVData() = default;
+
+    // The YUV data must have been created shareable.
+    explicit ShareableYUVData(YUVData const&);
+
+    ShareableYUVData(IntSize size, u8 bit_depth, Media::Subsampling, Media::CodingIndependentCodePoints, Core::AnonymousBuffer);
+
+    bool is_valid() const { return m_buffer.is_valid(); }
+
+    IntSize size() const { return m_size; }
+    u8 bit_depth() const { return m_bit_depth; }
+    Media::Subsampling subsampling() const { return m_subsampling; }
+    Media::CodingIndependentCodePoints const& cicp() const { return m_cicp; }
+    Core::AnonymousBuffer const& anonymous_buffer() const { return m_buffer; }
+
+    // Creates YUV data which shares its planes with this.
+    ErrorOr<NonnullOwnPtr<YUVData>> to_yuv_data() const;
+
+private:
+    IntSize m_size;
+    u8 m_bit_depth { 8 };
+    Media::Subsampling m_subsampling;
+    Media::CodingIndependentCodePoints m_cicp;
+    Core::AnonymousBuffer m_buffer;
+};
+
+}
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, Gfx::ShareableYUVData const&);
+
+template<>
+ErrorOr<Gfx::ShareableYUVData> decode(Decoder&);
+
+}
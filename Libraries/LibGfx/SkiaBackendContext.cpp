@@ -9,6 +9,7 @@
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/SkiaBackendContext.h>
 
+#include <core/SkGraphics.h>
 #include <core/SkSurface.h>
 #include <gpu/ganesh/GrDirectContext.h>
 
@@ -52,6 +53,19 @@ RefPtr<SkiaBackendContext> SkiaBackendContext::the()
     return s_the;
 }
 
+void SkiaBackendContext::purge_caches()
+{
+    SkGraphics::PurgeAllCaches();
+
+    if (!s_the)
+        return;
+
+    s_the->lock();
+    if (auto* context = s_the->sk_context())
+        context->freeGpuResources();
+    s_the->unlock();
+}
+
 #ifdef USE_VULKAN
 class SkiaVulkanBackendContext final : public SkiaBackendContext {
     AK_MAKE_NONCOPYABLE(SkiaVulkanBackendContext);
@@ -42,6 +42,10 @@ public:
     static void initialize_gpu_backend();
     static RefPtr<SkiaBackendContext> the();
 
+    // Drops Skia's caches of glyphs and decoded images, along with any GPU resources that are not in use, for when we
+    // are running low on memory.
+    static void purge_caches();
+
     SkiaBackendContext() { }
     virtual ~SkiaBackendContext() { }
 
@@ -7,9 +7,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
+#include <AK/HashFunctions.h>
+#include <AK/HashMap.h>
+#include <AK/Math.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
 #include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/ShapingCache.h>
 #include <LibGfx/Point.h>
 #include <LibGfx/TextLayout.h>
 #include <core/SkFont.h>
@@ -48,36 +53,125 @@ NonnullRefPtr<GlyphRun> GlyphRun::slice(size_t start, size_t length) const
     return adopt_ref(*new GlyphRun(move(sliced_glyphs), m_font, m_text_type, width));
 }
 
-void GlyphRun::ensure_text_blob(float scale) const
+struct TextBlob {
+    sk_sp<SkTextBlob> blob;
+    FloatRect bounds;
+};
+
+static TextBlob create_text_blob(Font const& font, float scale, ReadonlySpan<DrawGlyph> glyphs)
 {
-    if (m_cached_text_blob && m_cached_text_blob->scale == scale)
-        return;
+    auto sk_font = font.skia_font(scale);
 
-    auto sk_font = m_font->skia_font(scale);
-    auto glyph_count = m_glyphs.size();
+    SkTextBlobBuilder builder;
+    auto const& run = builder.allocRunPos(sk_font, glyphs.size());
 
-    m_cached_text_blob = make<CachedTextBlob>();
-    m_cached_text_blob->scale = scale;
+    float font_ascent = font.pixel_metrics().ascent;
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        run.glyphs[i] = glyphs[i].glyph_id;
+        run.pos[i * 2] = glyphs[i].position.x() * scale;
+        run.pos[i * 2 + 1] = (glyphs[i].position.y() + font_ascent) * scale;
+    }
 
-    if (glyph_count == 0)
-        return;
+    TextBlob text_blob { .blob = builder.make(), .bounds = {} };
+    if (text_blob.blob) {
+        auto const& sk_bounds = text_blob.blob->bounds();
+        text_blob.bounds = { sk_bounds.x(), sk_bounds.y(), sk_bounds.width(), sk_bounds.height() };
+    }
+    return text_blob;
+}
 
-    SkTextBlobBuilder builder;
-    auto const& run = builder.allocRunPos(sk_font, glyph_count);
+static bool glyphs_have_same_text_blob(ReadonlySpan<DrawGlyph> a, ReadonlySpan<DrawGlyph> b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].glyph_id != b[i].glyph_id || a[i].position != b[i].position)
+            return false;
+    }
+    return true;
+}
 
-    float font_ascent = m_font->pixel_metrics().ascent;
-    for (size_t i = 0; i < glyph_count; ++i) {
-        run.glyphs[i] = m_glyphs[i].glyph_id;
-        run.pos[i * 2] = m_glyphs[i].position.x() * scale;
-        run.pos[i * 2 + 1] = (m_glyphs[i].position.y() + font_ascent) * scale;
+// Text blobs of glyph runs with the same font, scale, glyphs and glyph positions, shared between the glyph runs created
+// by different layouts. Besides saving us from building the blob again, handing Skia the same blob for the same text
+// every frame lets it reuse what it caches per blob, such as the GPU vertex data that refers to its glyph atlas.
+class TextBlobCache {
+public:
+    static TextBlobCache& the()
+    {
+        static TextBlobCache cache;
+        return cache;
     }
 
-    m_cached_text_blob->blob = builder.make();
+    TextBlob ensure(Font const& font, float scale, ReadonlySpan<DrawGlyph> glyphs)
+    {
+        auto hash = pair_int_hash(ptr_hash(&font), bit_cast<u32>(scale));
+        for (auto const& glyph : glyphs) {
+            hash = pair_int_hash(hash, glyph.glyph_id);
+            hash = pair_int_hash(hash, pair_int_hash(bit_cast<u32>(glyph.position.x()), bit_cast<u32>(glyph.position.y())));
+        }
 
-    if (m_cached_text_blob->blob) {
-        auto const& sk_bounds = m_cached_text_blob->blob->bounds();
-        m_cached_text_blob->bounds = { sk_bounds.x(), sk_bounds.y(), sk_bounds.width(), sk_bounds.height() };
+        auto is_match = [&](auto const& entry) {
+            return entry.key.font.ptr() == &font && entry.key.scale == scale && glyphs_have_same_text_blob(entry.key.glyphs, glyphs);
+        };
+
+        if (auto it = m_current_generation.find(hash, is_match); it != m_current_generation.end())
+            return it->value;
+
+        TextBlob text_blob;
+        if (auto it = m_previous_generation.find(hash, is_match); it != m_previous_generation.end()) {
+            text_blob = it->value;
+            m_previous_generation.remove(it);
+        } else {
+            text_blob = create_text_blob(font, scale, glyphs);
+        }
+
+        // NB: Entries that were not used since the current generation was started are dropped once it fills up, which
+        //     approximates least-recently-used eviction without any bookkeeping on cache hits.
+        if (m_current_generation.size() >= max_entries_per_generation) {
+            m_previous_generation = move(m_current_generation);
+            m_current_generation.clear();
+        }
+
+        m_current_generation.set({ .font = font, .scale = scale, .glyphs = Vector<DrawGlyph> { glyphs }, .hash = hash }, text_blob);
+        return text_blob;
     }
+
+private:
+    static constexpr size_t max_entries_per_generation = 4096;
+
+    struct Key {
+        NonnullRefPtr<Font const> font;
+        float scale { 0 };
+        Vector<DrawGlyph> glyphs;
+        unsigned hash { 0 };
+    };
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key) { return key.hash; }
+        static bool equals(Key const& a, Key const& b)
+        {
+            return a.hash == b.hash && a.font.ptr() == b.font.ptr() && a.scale == b.scale && glyphs_have_same_text_blob(a.glyphs, b.glyphs);
+        }
+    };
+
+    HashMap<Key, TextBlob, KeyTraits> m_current_generation;
+    HashMap<Key, TextBlob, KeyTraits> m_previous_generation;
+};
+
+void GlyphRun::ensure_text_blob(float scale) const
+{
+    if (m_cached_text_blob && m_cached_text_blob->scale == scale)
+        return;
+
+    m_cached_text_blob = make<CachedTextBlob>();
+    m_cached_text_blob->scale = scale;
+
+    if (m_glyphs.is_empty())
+        return;
+
+    auto text_blob = TextBlobCache::the().ensure(*m_font, scale, m_glyphs);
+    m_cached_text_blob->blob = move(text_blob.blob);
+    m_cached_text_blob->bounds = text_blob.bounds;
 }
 
 FloatRect GlyphRun::cached_blob_bounds() const
@@ -94,6 +188,13 @@ SkTextBlob* GlyphRun::cached_skia_text_blob() const
     return m_cached_text_blob->blob.get();
 }
 
+Optional<float> GlyphRun::cached_text_blob_scale() const
+{
+    if (!m_cached_text_blob)
+        return {};
+    return m_cached_text_blob->scale;
+}
+
 Vector<float> GlyphRun::get_glyph_intercepts(float scale, float y_top, float y_bottom) const
 {
     ensure_text_blob(scale);
@@ -151,7 +252,7 @@ Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf16View
     return runs;
 }
 
-static hb_buffer_t* setup_text_shaping(Utf16View const& string, Font const& font, GlyphRun::TextType text_type)
+static ShapedGlyphs shape_text_with_harfbuzz(Utf16View const& string, Font const& font, GlyphRun::TextType text_type)
 {
     hb_buffer_t* buffer = hb_buffer_create();
 
@@ -174,7 +275,8 @@ static hb_buffer_t* setup_text_shaping(Utf16View const& string, Font const& font
         }
     }
 
-    auto* hb_font = font.harfbuzz_font();
+    auto const& face = font.shaping_face();
+    auto* hb_font = face.is_size_dependent() ? font.harfbuzz_font() : face.harfbuzz_font();
     hb_feature_t const* hb_features_data = nullptr;
     Vector<hb_feature_t, 4> hb_features;
     if (!font.features().is_empty()) {
@@ -192,40 +294,58 @@ static hb_buffer_t* setup_text_shaping(Utf16View const& string, Font const& font
 
     hb_shape(hb_font, buffer, hb_features_data, font.features().size());
 
-    return buffer;
+    u32 glyph_count;
+    auto const* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
+    auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
+
+    ShapedGlyphs glyphs;
+    glyphs.ensure_capacity(glyph_count);
+    for (size_t i = 0; i < glyph_count; ++i) {
+        glyphs.unchecked_append({
+            .glyph_id = glyph_info[i].codepoint,
+            .cluster = glyph_info[i].cluster,
+            .x_advance = positions[i].x_advance,
+            .y_advance = positions[i].y_advance,
+            .x_offset = positions[i].x_offset,
+            .y_offset = positions[i].y_offset,
+        });
+    }
+
+    hb_buffer_destroy(buffer);
+    return glyphs;
 }
 
-NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type)
+static ShapedGlyphs const& shaped_glyphs_for(Utf16View const& string, Font const& font, GlyphRun::TextType text_type)
 {
-    auto const& metrics = font.pixel_metrics();
-    auto& shaping_cache = font.shaping_cache();
-
-    // FIXME: The cache currently grows unbounded. We should have some limit and LRU mechanism.
-    auto get_or_create_buffer = [&] -> hb_buffer_t* {
-        if (string.length_in_code_units() == 1) {
-            auto code_unit = string.code_unit_at(0);
-            if (code_unit < 128) {
-                auto*& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
-                if (!cache_slot) {
-                    cache_slot = setup_text_shaping(string, font, text_type);
-                }
-                return cache_slot;
-            }
-        }
-        if (auto it = shaping_cache.map.find(
-                string.hash(), [&](auto& candidate) { return candidate.key == string; });
-            it != shaping_cache.map.end()) {
-            return it->value;
-        }
-        auto* buffer = setup_text_shaping(string, font, text_type);
-        shaping_cache.map.set(Utf16String::from_utf16(string), buffer);
-        return buffer;
+    auto& cache = ShapingCache::the();
+    auto& face = font.shaping_face();
+    if (auto const* glyphs = cache.lookup(face, string, text_type))
+        return *glyphs;
+    return cache.insert(face, string, text_type, shape_text_with_harfbuzz(string, font, text_type));
+}
+
+// Returns a function that converts the metrics of shaped glyphs to pixels. Text that was shaped in font units is rounded
+// to the grid that HarfBuzz would have positioned it on had it been shaped at the size of the font.
+static auto shaped_glyph_metric_to_pixels(Font const& font)
+{
+    float scale = 1;
+    if (!font.shaping_face().is_size_dependent()) {
+        auto units_per_em = static_cast<float>(font.typeface().units_per_em());
+        auto harfbuzz_scale = static_cast<float>(static_cast<int>(font.pixel_size() * text_shaping_resolution));
+        scale = harfbuzz_scale / (units_per_em * text_shaping_resolution);
+    }
+
+    return [scale](i32 metric) {
+        return round_to<i32>(static_cast<float>(metric) * scale) / text_shaping_resolution;
     };
+}
 
-    hb_buffer_t* buffer = get_or_create_buffer();
-    u32 glyph_count;
-    auto const* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
-    auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
+NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type)
+{
+    auto const& metrics = font.pixel_metrics();
+    auto const& glyphs = shaped_glyphs_for(string, font, text_type);
+    auto to_pixels = shaped_glyph_metric_to_pixels(font);
+    size_t glyph_count = glyphs.size();
 
     Vector<DrawGlyph> glyph_run;
     glyph_run.ensure_capacity(glyph_count);
@@ -238,10 +358,10 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
     // A single grapheme may be represented by multiple glyphs, where any of those glyphs are zero-width. We want to
     // assign code unit lengths such that each glyph knows the length of the text it respresents.
     auto glyph_length_in_code_units = [&](auto index) -> size_t {
-        auto starting_offset = glyph_info[index].cluster;
+        auto starting_offset = glyphs[index].cluster;
 
         for (size_t i = index + 1; i < glyph_count; ++i) {
-            if (auto offset = glyph_info[i].cluster; offset != starting_offset)
+            if (auto offset = glyphs[i].cluster; offset != starting_offset)
                 return offset - starting_offset;
         }
 
@@ -249,18 +369,19 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
     };
 
     for (size_t i = 0; i < glyph_count; ++i) {
+        auto const& glyph = glyphs[i];
         auto position = point
             - FloatPoint { 0, metrics.ascent }
-            + FloatPoint { positions[i].x_offset, positions[i].y_offset } / text_shaping_resolution;
+            + FloatPoint { to_pixels(glyph.x_offset), to_pixels(glyph.y_offset) };
 
         glyph_run.unchecked_append({
             .position = position,
             .length_in_code_units = glyph_length_in_code_units(i),
-            .glyph_width = positions[i].x_advance / text_shaping_resolution + letter_spacing,
-            .glyph_id = glyph_info[i].codepoint,
+            .glyph_width = to_pixels(glyph.x_advance) + letter_spacing,
+            .glyph_id = glyph.glyph_id,
         });
 
-        point += FloatPoint { positions[i].x_advance, positions[i].y_advance } / text_shaping_resolution;
+        point += FloatPoint { to_pixels(glyph.x_advance), to_pixels(glyph.y_advance) };
 
         // NOTE: The spec says that we "really should not" apply letter-spacing to the trailing edge of a line but
         //       other browsers do so we will as well. https://drafts.csswg.org/css-text/#example-7880704e
@@ -272,17 +393,14 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 
 float measure_text_width(Utf16View const& string, Font const& font, float letter_spacing)
 {
-    auto* buffer = setup_text_shaping(string, font, GlyphRun::TextType::Common);
+    auto const& glyphs = shaped_glyphs_for(string, font, GlyphRun::TextType::Common);
+    auto to_pixels = shaped_glyph_metric_to_pixels(font);
 
-    u32 glyph_count;
-    auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
-
-    hb_position_t point_x = 0;
-    for (size_t i = 0; i < glyph_count; ++i)
-        point_x += positions[i].x_advance;
+    float width = 0;
+    for (auto const& glyph : glyphs)
+        width += to_pixels(glyph.x_advance);
 
-    hb_buffer_destroy(buffer);
-    return point_x / text_shaping_resolution + glyph_count * letter_spacing;
+    return width + glyphs.size() * letter_spacing;
 }
 
 }
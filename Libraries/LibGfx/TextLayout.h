@@ -56,6 +56,7 @@ public:
 
     FloatRect cached_blob_bounds() const;
     SkTextBlob* cached_skia_text_blob() const;
+    Optional<float> cached_text_blob_scale() const;
 
     [[nodiscard]] Vector<float> get_glyph_intercepts(float scale, float y_top, float y_bottom) const;
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Checked.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibGfx/YUVData.h>
@@ -24,11 +25,20 @@ struct YUVDataImpl {
     u8 bit_depth;
     Media::Subsampling subsampling;
     Media::CodingIndependentCodePoints cicp;
+    YUVData::ChromaLayout chroma_layout { YUVData::ChromaLayout::Planar };
 
     FixedArray<u8> y_buffer;
     FixedArray<u8> u_buffer;
     FixedArray<u8> v_buffer;
 
+    // Shareable YUV data keeps all of its planes in this buffer instead, one after another.
+    Core::AnonymousBuffer anonymous_buffer;
+
+    // The planes, in whichever of the buffers they are stored. Interleaved chroma is stored in the U plane.
+    Bytes y_plane;
+    Bytes u_plane;
+    Bytes v_plane;
+
     // Lazily created when ImmutableBitmap needs it
     mutable Optional<SkYUVAPixmaps> pixmaps;
 
@@ -77,21 +87,25 @@ struct YUVDataImpl {
             return pixmaps.value();
 
         auto skia_size = SkISize::Make(size.width(), size.height());
+        bool interleaved = chroma_layout == YUVData::ChromaLayout::Interleaved;
 
-        // Use Y_U_V plane configuration (3 separate planes)
+        // Use Y_U_V plane configuration (3 separate planes), or Y_UV for interleaved chroma
         auto yuva_info = SkYUVAInfo(
             skia_size,
-            SkYUVAInfo::PlaneConfig::kY_U_V,
+            interleaved ? SkYUVAInfo::PlaneConfig::kY_UV : SkYUVAInfo::PlaneConfig::kY_U_V,
             skia_subsampling(),
             skia_yuv_color_space());
 
         // Determine color type based on bit depth
         SkColorType color_type;
+        SkColorType interleaved_color_type;
         if (bit_depth <= 8) {
             color_type = kAlpha_8_SkColorType;
+            interleaved_color_type = kR8G8_unorm_SkColorType;
         } else {
             // 10/12/16-bit data stored in 16-bit values
             color_type = kA16_unorm_SkColorType;
+            interleaved_color_type = kR16G16_unorm_SkColorType;
         }
 
         // Calculate row bytes for each plane
@@ -111,18 +125,25 @@ struct YUVDataImpl {
         // Create pixmaps from our buffers
         SkPixmap y_pixmap(
             SkImageInfo::Make(size.width(), size.height(), color_type, kOpaque_SkAlphaType),
-            y_buffer.data(),
+            y_plane.data(),
             y_row_bytes);
-        SkPixmap u_pixmap(
-            SkImageInfo::Make(uv_size.width(), uv_size.height(), color_type, kOpaque_SkAlphaType),
-            u_buffer.data(),
-            uv_row_bytes);
-        SkPixmap v_pixmap(
-            SkImageInfo::Make(uv_size.width(), uv_size.height(), color_type, kOpaque_SkAlphaType),
-            v_buffer.data(),
-            uv_row_bytes);
 
-        SkPixmap plane_pixmaps[SkYUVAInfo::kMaxPlanes] = { y_pixmap, u_pixmap, v_pixmap, {} };
+        SkPixmap plane_pixmaps[SkYUVAInfo::kMaxPlanes] = { y_pixmap, {}, {}, {} };
+        if (interleaved) {
+            plane_pixmaps[1] = SkPixmap(
+                SkImageInfo::Make(uv_size.width(), uv_size.height(), interleaved_color_type, kOpaque_SkAlphaType),
+                u_plane.data(),
+                uv_row_bytes * 2);
+        } else {
+            plane_pixmaps[1] = SkPixmap(
+                SkImageInfo::Make(uv_size.width(), uv_size.height(), color_type, kOpaque_SkAlphaType),
+                u_plane.data(),
+                uv_row_bytes);
+            plane_pixmaps[2] = SkPixmap(
+                SkImageInfo::Make(uv_size.width(), uv_size.height(), color_type, kOpaque_SkAlphaType),
+                v_plane.data(),
+                uv_row_bytes);
+        }
 
         pixmaps = SkYUVAPixmaps::FromExternalPixmaps(yuva_info, plane_pixmaps);
         return pixmaps.value();
@@ -131,28 +152,104 @@ struct YUVDataImpl {
 
 }
 
-ErrorOr<NonnullOwnPtr<YUVData>> YUVData::create(IntSize size, u8 bit_depth, Media::Subsampling subsampling, Media::CodingIndependentCodePoints cicp)
+struct PlaneSizes {
+    size_t y_size { 0 };
+    size_t uv_size { 0 };
+};
+
+static ErrorOr<PlaneSizes> plane_sizes(IntSize size, u8 bit_depth, Media::Subsampling subsampling)
 {
     VERIFY(bit_depth <= 16);
+    if (size.is_empty())
+        return Error::from_string_literal("YUVData size is empty");
+
     auto component_size = bit_depth <= 8 ? 1 : 2;
 
-    auto y_buffer_size = static_cast<size_t>(size.width()) * size.height() * component_size;
+    Checked<size_t> y_size = size.width();
+    y_size *= size.height();
+    y_size *= component_size;
 
     auto uv_size = subsampling.subsampled_size(size);
-    auto uv_buffer_size = static_cast<size_t>(uv_size.width()) * uv_size.height() * component_size;
+    Checked<size_t> uv_plane_size = uv_size.width();
+    uv_plane_size *= uv_size.height();
+    uv_plane_size *= component_size;
+
+    if (y_size.has_overflow() || uv_plane_size.has_overflow())
+        return Error::from_string_literal("YUVData size overflow");
+    return PlaneSizes { y_size.value(), uv_plane_size.value() };
+}
 
-    auto y_buffer = TRY(FixedArray<u8>::create(y_buffer_size));
-    auto u_buffer = TRY(FixedArray<u8>::create(uv_buffer_size));
-    auto v_buffer = TRY(FixedArray<u8>::create(uv_buffer_size));
+ErrorOr<size_t> YUVData::size_in_bytes(IntSize size, u8 bit_depth, Media::Subsampling subsampling)
+{
+    auto sizes = TRY(plane_sizes(size, bit_depth, subsampling));
+
+    Checked<size_t> total_size = sizes.uv_size;
+    total_size *= 2;
+    total_size += sizes.y_size;
+    if (total_size.has_overflow())
+        return Error::from_string_literal("YUVData size overflow");
+    return total_size.value();
+}
+
+ErrorOr<NonnullOwnPtr<YUVData>> YUVData::create(IntSize size, u8 bit_depth, Media::Subsampling subsampling, Media::CodingIndependentCodePoints cicp, ChromaLayout chroma_layout)
+{
+    auto sizes = TRY(plane_sizes(size, bit_depth, subsampling));
+    bool interleaved = chroma_layout == ChromaLayout::Interleaved;
+
+    auto y_buffer = TRY(FixedArray<u8>::create(sizes.y_size));
+    auto u_buffer = TRY(FixedArray<u8>::create(interleaved ? sizes.uv_size * 2 : sizes.uv_size));
+    auto v_buffer = TRY(FixedArray<u8>::create(interleaved ? 0 : sizes.uv_size));
+
+    auto y_plane = y_buffer.span();
+    auto u_plane = u_buffer.span();
+    auto v_plane = v_buffer.span();
 
     auto impl = TRY(try_make<Details::YUVDataImpl>(Details::YUVDataImpl {
         .size = size,
         .bit_depth = bit_depth,
         .subsampling = subsampling,
         .cicp = cicp,
+        .chroma_layout = chroma_layout,
         .y_buffer = move(y_buffer),
         .u_buffer = move(u_buffer),
         .v_buffer = move(v_buffer),
+        .anonymous_buffer = {},
+        .y_plane = y_plane,
+        .u_plane = u_plane,
+        .v_plane = v_plane,
+        .pixmaps = {},
+    }));
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) YUVData(move(impl)));
+}
+
+ErrorOr<NonnullOwnPtr<YUVData>> YUVData::create_shareable(IntSize size, u8 bit_depth, Media::Subsampling subsampling, Media::CodingIndependentCodePoints cicp)
+{
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(TRY(size_in_bytes(size, bit_depth, subsampling))));
+    return create_with_anonymous_buffer(size, bit_depth, subsampling, cicp, move(buffer));
+}
+
+ErrorOr<NonnullOwnPtr<YUVData>> YUVData::create_with_anonymous_buffer(IntSize size, u8 bit_depth, Media::Subsampling subsampling, Media::CodingIndependentCodePoints cicp, Core::AnonymousBuffer buffer)
+{
+    auto sizes = TRY(plane_sizes(size, bit_depth, subsampling));
+    if (!buffer.is_valid() || buffer.size() < TRY(size_in_bytes(size, bit_depth, subsampling)))
+        return Error::from_string_literal("YUVData buffer is too small");
+
+    Bytes bytes { buffer.data<u8>(), buffer.size() };
+
+    auto impl = TRY(try_make<Details::YUVDataImpl>(Details::YUVDataImpl {
+        .size = size,
+        .bit_depth = bit_depth,
+        .subsampling = subsampling,
+        .cicp = cicp,
+        .chroma_layout = ChromaLayout::Planar,
+        .y_buffer = {},
+        .u_buffer = {},
+        .v_buffer = {},
+        .anonymous_buffer = move(buffer),
+        .y_plane = bytes.slice(0, sizes.y_size),
+        .u_plane = bytes.slice(sizes.y_size, sizes.uv_size),
+        .v_plane = bytes.slice(sizes.y_size + sizes.uv_size, sizes.uv_size),
         .pixmaps = {},
     }));
 
@@ -186,19 +283,37 @@ Media::CodingIndependentCodePoints const& YUVData::cicp() const
     return m_impl->cicp;
 }
 
+YUVData::ChromaLayout YUVData::chroma_layout() const
+{
+    return m_impl->chroma_layout;
+}
+
 Bytes YUVData::y_data()
 {
-    return m_impl->y_buffer.span();
+    return m_impl->y_plane;
 }
 
 Bytes YUVData::u_data()
 {
-    return m_impl->u_buffer.span();
+    VERIFY(m_impl->chroma_layout == ChromaLayout::Planar);
+    return m_impl->u_plane;
 }
 
 Bytes YUVData::v_data()
 {
-    return m_impl->v_buffer.span();
+    VERIFY(m_impl->chroma_layout == ChromaLayout::Planar);
+    return m_impl->v_plane;
+}
+
+Bytes YUVData::uv_data()
+{
+    VERIFY(m_impl->chroma_layout == ChromaLayout::Interleaved);
+    return m_impl->u_plane;
+}
+
+Core::AnonymousBuffer const& YUVData::anonymous_buffer() const
+{
+    return m_impl->anonymous_buffer;
 }
 
 SkYUVAPixmaps const& YUVData::skia_yuva_pixmaps() const
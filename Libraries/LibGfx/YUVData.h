@@ -9,6 +9,7 @@
 #include <AK/Error.h>
 #include <AK/FixedArray.h>
 #include <AK/NonnullOwnPtr.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibGfx/Size.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
 #include <LibMedia/Subsampling.h>
@@ -28,7 +29,21 @@ struct YUVDataImpl;
 // Not ref-counted - owned directly by ImmutableBitmap via NonnullOwnPtr.
 class YUVData final {
 public:
-    static ErrorOr<NonnullOwnPtr<YUVData>> create(IntSize size, u8 bit_depth, Media::Subsampling, Media::CodingIndependentCodePoints);
+    // Whether the chroma samples are stored in separate U and V planes, or interleaved in a single UV plane, as hardware
+    // video decoders output them.
+    enum class ChromaLayout : u8 {
+        Planar,
+        Interleaved,
+    };
+
+    static ErrorOr<NonnullOwnPtr<YUVData>> create(IntSize size, u8 bit_depth, Media::Subsampling, Media::CodingIndependentCodePoints, ChromaLayout = ChromaLayout::Planar);
+
+    // Stores the planes in shared memory, so that they can be handed to another process without being copied.
+    static ErrorOr<NonnullOwnPtr<YUVData>> create_shareable(IntSize size, u8 bit_depth, Media::Subsampling, Media::CodingIndependentCodePoints);
+    static ErrorOr<NonnullOwnPtr<YUVData>> create_with_anonymous_buffer(IntSize size, u8 bit_depth, Media::Subsampling, Media::CodingIndependentCodePoints, Core::AnonymousBuffer);
+
+    // The number of bytes it takes to store the planes of YUV data with these properties.
+    static ErrorOr<size_t> size_in_bytes(IntSize size, u8 bit_depth, Media::Subsampling);
 
     ~YUVData();
 
@@ -36,12 +51,19 @@ public:
     u8 bit_depth() const;
     Media::Subsampling subsampling() const;
     Media::CodingIndependentCodePoints const& cicp() const;
+    ChromaLayout chroma_layout() const;
 
     // Writable access for decoder to fill buffers after creation
     Bytes y_data();
     Bytes u_data();
     Bytes v_data();
 
+    // The interleaved U and V samples, only for data with an interleaved chroma layout.
+    Bytes uv_data();
+
+    // Returns an invalid buffer unless the planes are stored in shared memory.
+    Core::AnonymousBuffer const& anonymous_buffer() const;
+
     SkYUVAPixmaps const& skia_yuva_pixmaps() const;
 
 private:
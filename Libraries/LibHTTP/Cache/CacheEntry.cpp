@@ -7,10 +7,13 @@
 #include <AK/Debug.h>
 #include <AK/HashFunctions.h>
 #include <AK/ScopeGuard.h>
+#include <LibCore/Directory.h>
 #include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibHTTP/Cache/CacheEntry.h>
 #include <LibHTTP/Cache/CacheIndex.h>
+#include <LibHTTP/Cache/CompressionDictionary.h>
 #include <LibHTTP/Cache/DiskCache.h>
 #include <LibHTTP/Cache/Utilities.h>
 
@@ -114,6 +117,8 @@ CacheEntryWriter::CacheEntryWriter(DiskCache& disk_cache, CacheIndex& index, u64
 {
 }
 
+CacheEntryWriter::~CacheEntryWriter() = default;
+
 ErrorOr<void> CacheEntryWriter::write_status_and_reason(u32 status_code, Optional<String> reason_phrase, HeaderList const& request_headers, HeaderList const& response_headers)
 {
     if (m_marked_for_deletion) {
@@ -144,14 +149,30 @@ ErrorOr<void> CacheEntryWriter::write_status_and_reason(u32 status_code, Optiona
         if (cache_lifetime_status(request_headers, response_headers, freshness_lifetime, current_age) == CacheLifetimeStatus::Expired)
             return Error::from_string_literal("Response has already expired");
 
-        auto unbuffered_file = TRY(Core::File::open(m_path->string(), Core::File::OpenMode::Write));
-        m_file = TRY(Core::OutputBufferedFile::create(move(unbuffered_file)));
+        // NB: Readers may have mapped the data of a previous entry at this path. Unlinking it first ensures we write to a
+        //     new file, rather than changing the data from under them.
+        (void)Core::System::unlink(m_path->string());
+
+        auto unbuffered_file = Core::File::open(m_path->string(), Core::File::OpenMode::Write);
+
+        // The entry's shard directory is only created once the first entry in it is written.
+        if (unbuffered_file.is_error() && unbuffered_file.error().is_errno() && unbuffered_file.error().code() == ENOENT) {
+            TRY(Core::Directory::create(m_path->parent(), Core::Directory::CreateDirectories::Yes));
+            unbuffered_file = Core::File::open(m_path->string(), Core::File::OpenMode::Write);
+        }
+        if (unbuffered_file.is_error())
+            return unbuffered_file.release_error();
+
+        m_file = TRY(Core::OutputBufferedFile::create(unbuffered_file.release_value()));
 
         TRY(m_file->write_value(m_cache_header));
         TRY(m_file->write_until_depleted(m_url));
         if (reason_phrase.has_value())
             TRY(m_file->write_until_depleted(*reason_phrase));
 
+        if (response_headers.contains(USE_AS_DICTIONARY_HEADER))
+            m_dictionary_hasher = Crypto::Hash::SHA256::create();
+
         return {};
     }();
 
@@ -183,6 +204,9 @@ ErrorOr<void> CacheEntryWriter::write_data(ReadonlyBytes data)
         return result.release_error();
     }
 
+    if (m_dictionary_hasher)
+        m_dictionary_hasher->update(data);
+
     m_cache_footer.data_size += data.size();
     return {};
 }
@@ -203,7 +227,11 @@ ErrorOr<void> CacheEntryWriter::flush(NonnullRefPtr<HeaderList> request_headers,
         return result.release_error();
     }
 
-    if (auto result = m_index.create_entry(m_cache_key, m_vary_key, m_url, move(request_headers), move(response_headers), m_cache_footer.data_size, m_request_time, m_response_time); result.is_error()) {
+    ByteString dictionary_hash;
+    if (m_dictionary_hasher)
+        dictionary_hash = ByteString { m_dictionary_hasher->digest().bytes() };
+
+    if (auto result = m_index.create_entry(m_cache_key, m_vary_key, m_url, move(request_headers), move(response_headers), m_cache_footer.data_size, m_request_time, m_response_time, move(dictionary_hash)); result.is_error()) {
         dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[31;1mUnable to flush cache entry for\033[0m {} ({} bytes): {}", m_url, m_cache_footer.data_size, result.error());
         remove();
 
@@ -222,6 +250,21 @@ void CacheEntryWriter::remove_incomplete_entry()
     close_and_destroy_cache_entry();
 }
 
+bool CacheEntryWriter::can_serve(HeaderList const& request_headers, HeaderList const& response_headers) const
+{
+    // The entry is only opened for writing once we know that the response is cacheable.
+    if (!m_file || m_marked_for_deletion)
+        return false;
+
+    if (create_vary_key(request_headers, response_headers) != m_vary_key)
+        return false;
+
+    auto freshness_lifetime = calculate_freshness_lifetime(m_cache_header.status_code, response_headers, m_current_time_offset_for_testing);
+    auto current_age = calculate_age(response_headers, m_request_time, m_response_time, m_current_time_offset_for_testing);
+
+    return cache_lifetime_status(request_headers, response_headers, freshness_lifetime, current_age) == CacheLifetimeStatus::Fresh;
+}
+
 ErrorOr<NonnullOwnPtr<CacheEntryReader>> CacheEntryReader::create(DiskCache& disk_cache, CacheIndex& index, u64 cache_key, u64 vary_key, NonnullRefPtr<HeaderList> response_headers, u64 data_size)
 {
     auto path = path_for_cache_entry(disk_cache.cache_directory(), cache_key, vary_key);
@@ -324,6 +367,55 @@ void CacheEntryReader::send_to(int socket_fd, Function<void(u64)> on_complete, F
     send_without_blocking();
 }
 
+ErrorOr<CacheEntryReader::MappableData> CacheEntryReader::release_data_for_mapping()
+{
+    auto result = [&]() -> ErrorOr<MappableData> {
+        if (m_marked_for_deletion)
+            return Error::from_string_literal("Cache entry has been deleted");
+
+        TRY(read_and_validate_footer());
+        auto fd = TRY(Core::System::dup(m_fd));
+
+        return MappableData { .fd = fd, .offset = m_data_offset, .size = m_data_size };
+    }();
+
+    if (result.is_error()) {
+        dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[31;1mError releasing cache entry data for\033[0m {}: {}", m_url, result.error());
+        remove();
+    } else {
+        m_index.update_last_access_time(m_cache_key, m_vary_key);
+    }
+
+    close_and_destroy_cache_entry();
+    return result;
+}
+
+ErrorOr<ByteBuffer> CacheEntryReader::read_data()
+{
+    auto result = [&]() -> ErrorOr<ByteBuffer> {
+        if (m_marked_for_deletion)
+            return Error::from_string_literal("Cache entry has been deleted");
+
+        auto data = TRY(ByteBuffer::create_uninitialized(m_data_size));
+
+        TRY(m_file->seek(m_data_offset, SeekMode::SetPosition));
+        TRY(m_file->read_until_filled(data));
+        TRY(read_and_validate_footer());
+
+        return data;
+    }();
+
+    if (result.is_error()) {
+        dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[31;1mError reading cache entry data for\033[0m {}: {}", m_url, result.error());
+        remove();
+    } else {
+        m_index.update_last_access_time(m_cache_key, m_vary_key);
+    }
+
+    close_and_destroy_cache_entry();
+    return result;
+}
+
 void CacheEntryReader::send_without_blocking()
 {
     if (m_marked_for_deletion) {
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/Error.h>
 #include <AK/LexicalPath.h>
 #include <AK/Optional.h>
@@ -18,6 +19,12 @@
 #include <LibHTTP/Forward.h>
 #include <LibHTTP/HeaderList.h>
 
+namespace Crypto::Hash {
+
+class SHA256;
+
+}
+
 namespace HTTP {
 
 struct CacheHeader {
@@ -88,18 +95,25 @@ protected:
 class CacheEntryWriter final : public CacheEntry {
 public:
     static ErrorOr<NonnullOwnPtr<CacheEntryWriter>> create(DiskCache&, CacheIndex&, u64 cache_key, String url, UnixDateTime request_time, AK::Duration current_time_offset_for_testing);
-    virtual ~CacheEntryWriter() override = default;
+    virtual ~CacheEntryWriter() override;
 
     ErrorOr<void> write_status_and_reason(u32 status_code, Optional<String> reason_phrase, HeaderList const& request_headers, HeaderList const& response_headers);
     ErrorOr<void> write_data(ReadonlyBytes);
     ErrorOr<void> flush(NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers);
     void remove_incomplete_entry();
 
+    // Whether another request for the same URL would be able to use the response being written without revalidating
+    // it, if the response were already in the cache.
+    bool can_serve(HeaderList const& request_headers, HeaderList const& response_headers) const;
+
 private:
     CacheEntryWriter(DiskCache&, CacheIndex&, u64 cache_key, String url, CacheHeader, UnixDateTime request_time, AK::Duration current_time_offset_for_testing);
 
     OwnPtr<Core::OutputBufferedFile> m_file;
 
+    // Responses that are to be used as compression dictionaries are identified by the hash of their data.
+    OwnPtr<Crypto::Hash::SHA256> m_dictionary_hasher;
+
     UnixDateTime m_request_time;
     UnixDateTime m_response_time;
 
@@ -124,6 +138,21 @@ public:
 
     void send_to(int socket_fd, Function<void(u64 bytes_sent)> on_complete, Function<void(u64 bytes_sent)> on_error);
 
+    // Rather than sending the entry's data, this validates the entry and hands out a file descriptor from which the
+    // data may be mapped directly. In both cases, the entry is closed once its data has been handed out.
+    struct MappableData {
+        int fd { -1 };
+        u64 offset { 0 };
+        u64 size { 0 };
+    };
+    ErrorOr<MappableData> release_data_for_mapping();
+
+    // Reads the entry's data in its entirety. This is meant for small entries that are needed all at once, such as
+    // compression dictionaries. The entry is closed once its data has been read.
+    ErrorOr<ByteBuffer> read_data();
+
+    u64 data_size() const { return m_data_size; }
+
     u32 status_code() const { return m_cache_header.status_code; }
     Optional<String> const& reason_phrase() const { return m_reason_phrase; }
     HeaderList& response_headers() { return m_response_headers; }
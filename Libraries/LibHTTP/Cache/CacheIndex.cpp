@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Debug.h>
+#include <AK/QuickSort.h>
 #include <AK/StringBuilder.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibHTTP/Cache/CacheIndex.h>
@@ -15,6 +17,28 @@ namespace HTTP {
 
 static constexpr u32 CACHE_METADATA_KEY = 12389u;
 
+// Eviction frees space down to this fraction of the maximum cache size, so that it need not run for every new entry.
+static constexpr double EVICTION_LOW_WATER_MARK = 0.9;
+
+// Entries that have been read from the cache since they were written are protected: they are only evicted after every
+// unprotected entry has been, as long as they take up no more than this fraction of the maximum cache size. So a scan of
+// responses that are only ever fetched once, like large media files, can't evict the small assets pages load each time.
+static constexpr double PROTECTED_SEGMENT_FRACTION = 0.8;
+
+// Pending writes are only lost if RequestServer crashes, in which case the index merely forgets some recently written
+// entries and last access times.
+static constexpr int PENDING_WRITES_FLUSH_INTERVAL_MS = 2000;
+
+static Array<LexicalPath, 2> legacy_paths_for_cache_entry(LexicalPath const& cache_directory, u64 cache_key, u64 vary_key)
+{
+    // Up to version 6, entries were stored directly in the cache directory.
+    auto flat_file = vary_key == 0
+        ? ByteString::formatted("{:016x}", cache_key)
+        : ByteString::formatted("{:016x}_{:016x}", cache_key, vary_key);
+
+    return { cache_directory.append(flat_file), path_for_cache_entry(cache_directory, cache_key, vary_key) };
+}
+
 static ByteString serialize_headers(HeaderList const& headers)
 {
     StringBuilder builder;
@@ -73,6 +97,18 @@ ErrorOr<CacheIndex> CacheIndex::create(Database::Database& database, LexicalPath
             dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[31;1mDisk cache version mismatch:\033[0m stored version = {}, new version = {}", cache_version, CACHE_VERSION);
 
         // FIXME: We should more elegantly handle minor changes, i.e. use ALTER TABLE to add fields to CacheIndex.
+        // Entries of older versions may live at paths we no longer know about, so remove their files now rather than
+        // leaving them behind forever.
+        if (auto select_legacy_entries = database.prepare_statement("SELECT cache_key, vary_key FROM CacheIndex;"sv); !select_legacy_entries.is_error()) {
+            database.execute_statement(select_legacy_entries.value(), [&](auto statement_id) {
+                auto cache_key = database.result_column<u64>(statement_id, 0);
+                auto vary_key = database.result_column<u64>(statement_id, 1);
+
+                for (auto const& path : legacy_paths_for_cache_entry(cache_directory, cache_key, vary_key))
+                    (void)FileSystem::remove(path.string(), FileSystem::RecursionMode::Disallowed);
+            });
+        }
+
         auto delete_cache_index_table = TRY(database.prepare_statement("DROP TABLE IF EXISTS CacheIndex;"sv));
         database.execute_statement(delete_cache_index_table, {});
 
@@ -91,37 +127,19 @@ ErrorOr<CacheIndex> CacheIndex::create(Database::Database& database, LexicalPath
             request_time INTEGER,
             response_time INTEGER,
             last_access_time INTEGER,
+            access_count INTEGER,
+            dictionary_hash BLOB,
             PRIMARY KEY(cache_key, vary_key)
         );
     )#"sv));
     database.execute_statement(create_cache_index_table, {});
 
     Statements statements {};
-    statements.insert_entry = TRY(database.prepare_statement("INSERT OR REPLACE INTO CacheIndex VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
+    statements.insert_entry = TRY(database.prepare_statement("INSERT OR REPLACE INTO CacheIndex VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
     statements.remove_entry = TRY(database.prepare_statement("DELETE FROM CacheIndex WHERE cache_key = ? AND vary_key = ?;"sv));
     statements.remove_entries_accessed_since = TRY(database.prepare_statement("DELETE FROM CacheIndex WHERE last_access_time >= ? RETURNING cache_key, vary_key;"sv));
-    statements.select_entries = TRY(database.prepare_statement("SELECT * FROM CacheIndex WHERE cache_key = ?;"sv));
     statements.update_response_headers = TRY(database.prepare_statement("UPDATE CacheIndex SET response_headers = ? WHERE cache_key = ? AND vary_key = ?;"sv));
-    statements.update_last_access_time = TRY(database.prepare_statement("UPDATE CacheIndex SET last_access_time = ? WHERE cache_key = ? AND vary_key = ?;"sv));
-
-    statements.remove_entries_exceeding_cache_limit = TRY(database.prepare_statement(R"#(
-        WITH RankedCacheIndex AS (
-            SELECT
-                cache_key,
-                vary_key,
-                SUM(data_size + OCTET_LENGTH(request_headers) + OCTET_LENGTH(response_headers))
-                    OVER (ORDER BY last_access_time DESC)
-                    AS cumulative_estimated_size
-            FROM CacheIndex
-        )
-        DELETE FROM CacheIndex
-        WHERE (cache_key, vary_key) IN (
-            SELECT cache_key, vary_key
-            FROM RankedCacheIndex
-            WHERE cumulative_estimated_size > ?
-        )
-        RETURNING cache_key, vary_key;
-    )#"sv));
+    statements.update_last_access_time = TRY(database.prepare_statement("UPDATE CacheIndex SET last_access_time = ?, access_count = ? WHERE cache_key = ? AND vary_key = ?;"sv));
 
     statements.estimate_cache_size_accessed_since = TRY(database.prepare_statement(R"#(
         SELECT SUM(data_size + OCTET_LENGTH(request_headers) + OCTET_LENGTH(response_headers))
@@ -138,17 +156,92 @@ ErrorOr<CacheIndex> CacheIndex::create(Database::Database& database, LexicalPath
         .maximum_disk_cache_entry_size = compute_maximum_disk_cache_entry_size(maximum_disk_cache_size),
     };
 
-    return CacheIndex { database, statements, limits };
+    Entries entries;
+
+    auto select_entries = TRY(database.prepare_statement("SELECT * FROM CacheIndex;"sv));
+    database.execute_statement(
+        select_entries,
+        [&](auto statement_id) {
+            int column = 0;
+
+            auto cache_key = database.result_column<u64>(statement_id, column++);
+            auto vary_key = database.result_column<u64>(statement_id, column++);
+            auto url = database.result_column<String>(statement_id, column++);
+            auto request_headers = database.result_column<ByteString>(statement_id, column++);
+            auto response_headers = database.result_column<ByteString>(statement_id, column++);
+            auto data_size = database.result_column<u64>(statement_id, column++);
+            auto request_time = database.result_column<UnixDateTime>(statement_id, column++);
+            auto response_time = database.result_column<UnixDateTime>(statement_id, column++);
+            auto last_access_time = database.result_column<UnixDateTime>(statement_id, column++);
+            auto access_count = database.result_column<u32>(statement_id, column++);
+            auto dictionary_hash = database.result_column<ByteString>(statement_id, column++);
+
+            auto estimated_size = data_size + request_headers.length() + response_headers.length();
+            entries.ensure(cache_key).empend(vary_key, move(url), deserialize_headers(request_headers), deserialize_headers(response_headers), data_size, estimated_size, request_time, response_time, last_access_time, access_count, move(dictionary_hash));
+        });
+
+    return CacheIndex { database, statements, limits, move(entries) };
 }
 
-CacheIndex::CacheIndex(Database::Database& database, Statements statements, Limits limits)
+CacheIndex::CacheIndex(Database::Database& database, Statements statements, Limits limits, Entries entries)
     : m_database(database)
     , m_statements(statements)
+    , m_entries(move(entries))
     , m_limits(limits)
 {
+    for (auto const& [cache_key, entries] : m_entries) {
+        for (auto const& entry : entries) {
+            m_total_estimated_size += entry.estimated_size;
+            register_compression_dictionary(cache_key, entry);
+        }
+    }
 }
 
-ErrorOr<void> CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time)
+CacheIndex::CacheIndex(CacheIndex&& other)
+    : m_database(other.m_database)
+    , m_statements(other.m_statements)
+    , m_entries(move(other.m_entries))
+    , m_compression_dictionaries(move(other.m_compression_dictionaries))
+    , m_pending_writes(move(other.m_pending_writes))
+    , m_limits(other.m_limits)
+    , m_total_estimated_size(exchange(other.m_total_estimated_size, 0))
+{
+    // NB: The other index's timer would flush that index, so we need a timer of our own.
+    if (other.m_pending_writes_timer)
+        other.m_pending_writes_timer->stop();
+    if (!m_pending_writes.is_empty())
+        start_pending_writes_timer();
+}
+
+CacheIndex& CacheIndex::operator=(CacheIndex&& other)
+{
+    if (this == &other)
+        return *this;
+
+    flush_pending_writes();
+
+    m_database = other.m_database;
+    m_statements = other.m_statements;
+    m_entries = move(other.m_entries);
+    m_compression_dictionaries = move(other.m_compression_dictionaries);
+    m_pending_writes = move(other.m_pending_writes);
+    m_limits = other.m_limits;
+    m_total_estimated_size = exchange(other.m_total_estimated_size, 0);
+
+    if (other.m_pending_writes_timer)
+        other.m_pending_writes_timer->stop();
+    if (!m_pending_writes.is_empty())
+        start_pending_writes_timer();
+
+    return *this;
+}
+
+CacheIndex::~CacheIndex()
+{
+    flush_pending_writes();
+}
+
+ErrorOr<void> CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time, ByteString dictionary_hash)
 {
     auto now = UnixDateTime::now();
 
@@ -164,7 +257,8 @@ ErrorOr<void> CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url,
     auto serialized_request_headers = serialize_headers(request_headers);
     auto serialized_response_headers = serialize_headers(response_headers);
 
-    if (data_size + serialized_request_headers.length() + serialized_response_headers.length() > m_limits.maximum_disk_cache_entry_size)
+    auto estimated_size = data_size + serialized_request_headers.length() + serialized_response_headers.length();
+    if (estimated_size > m_limits.maximum_disk_cache_entry_size)
         return Error::from_string_literal("Cache entry size exceeds allowed maximum");
 
     Entry entry {
@@ -173,13 +267,22 @@ ErrorOr<void> CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url,
         .request_headers = move(request_headers),
         .response_headers = move(response_headers),
         .data_size = data_size,
+        .estimated_size = estimated_size,
         .request_time = request_time,
         .response_time = response_time,
         .last_access_time = now,
+        .dictionary_hash = move(dictionary_hash),
     };
 
-    m_database->execute_statement(m_statements.insert_entry, {}, cache_key, vary_key, entry.url, serialized_request_headers, serialized_response_headers, entry.data_size, entry.request_time, entry.response_time, entry.last_access_time);
-    m_entries.ensure(cache_key).append(move(entry));
+    // Replace any entry we might have for the same key, as INSERT OR REPLACE would.
+    delete_entry(cache_key, vary_key);
+
+    m_total_estimated_size += estimated_size;
+
+    auto& entries = m_entries.ensure(cache_key);
+    entries.append(move(entry));
+    register_compression_dictionary(cache_key, entries.last());
+    schedule_pending_write(cache_key, entries.last(), PendingWrite::Insert);
 
     return {};
 }
@@ -190,23 +293,80 @@ void CacheIndex::remove_entry(u64 cache_key, u64 vary_key)
     delete_entry(cache_key, vary_key);
 }
 
+bool CacheIndex::exceeds_cache_limit() const
+{
+    return m_total_estimated_size > m_limits.maximum_disk_cache_size;
+}
+
 void CacheIndex::remove_entries_exceeding_cache_limit(Function<void(u64 cache_key, u64 vary_key)> on_entry_removed)
 {
-    m_database->execute_statement(
-        m_statements.remove_entries_exceeding_cache_limit,
-        [&](auto statement_id) {
-            auto cache_key = m_database->result_column<u64>(statement_id, 0);
-            auto vary_key = m_database->result_column<u64>(statement_id, 1);
-            delete_entry(cache_key, vary_key);
+    if (!exceeds_cache_limit())
+        return;
 
-            if (on_entry_removed)
-                on_entry_removed(cache_key, vary_key);
-        },
-        m_limits.maximum_disk_cache_size);
+    struct EvictionCandidate {
+        u64 cache_key { 0 };
+        u64 vary_key { 0 };
+        u64 estimated_size { 0 };
+        UnixDateTime last_access_time;
+    };
+    Vector<EvictionCandidate> probationary_entries;
+    Vector<EvictionCandidate> protected_entries;
+    u64 protected_size = 0;
+
+    for (auto const& [cache_key, entries] : m_entries) {
+        for (auto const& entry : entries) {
+            EvictionCandidate candidate { cache_key, entry.vary_key, entry.estimated_size, entry.last_access_time };
+
+            if (entry.access_count == 0) {
+                probationary_entries.append(candidate);
+            } else {
+                protected_entries.append(candidate);
+                protected_size += entry.estimated_size;
+            }
+        }
+    }
+
+    auto sort_least_recently_used_first = [](Vector<EvictionCandidate>& candidates) {
+        quick_sort(candidates, [](auto const& lhs, auto const& rhs) { return lhs.last_access_time < rhs.last_access_time; });
+    };
+    sort_least_recently_used_first(probationary_entries);
+    sort_least_recently_used_first(protected_entries);
+
+    auto target_size = static_cast<u64>(static_cast<double>(m_limits.maximum_disk_cache_size) * EVICTION_LOW_WATER_MARK);
+    auto maximum_protected_size = static_cast<u64>(static_cast<double>(m_limits.maximum_disk_cache_size) * PROTECTED_SEGMENT_FRACTION);
+
+    size_t next_probationary_entry = 0;
+    size_t next_protected_entry = 0;
+
+    auto transaction = m_database->begin_transaction();
+
+    while (m_total_estimated_size > target_size) {
+        bool has_probationary_entries = next_probationary_entry < probationary_entries.size();
+        bool has_protected_entries = next_protected_entry < protected_entries.size();
+        if (!has_probationary_entries && !has_protected_entries)
+            break;
+
+        bool evict_protected_entry = !has_probationary_entries || (has_protected_entries && protected_size > maximum_protected_size);
+
+        auto const& candidate = evict_protected_entry
+            ? protected_entries[next_protected_entry++]
+            : probationary_entries[next_probationary_entry++];
+
+        if (evict_protected_entry)
+            protected_size -= candidate.estimated_size;
+
+        m_database->execute_statement(m_statements.remove_entry, {}, candidate.cache_key, candidate.vary_key);
+        delete_entry(candidate.cache_key, candidate.vary_key);
+
+        if (on_entry_removed)
+            on_entry_removed(candidate.cache_key, candidate.vary_key);
+    }
 }
 
 void CacheIndex::remove_entries_accessed_since(UnixDateTime since, Function<void(u64 cache_key, u64 vary_key)> on_entry_removed)
 {
+    flush_pending_writes();
+
     m_database->execute_statement(
         m_statements.remove_entries_accessed_since,
         [&](auto statement_id) {
@@ -226,8 +386,18 @@ void CacheIndex::update_response_headers(u64 cache_key, u64 vary_key, NonnullRef
     if (!entry.has_value())
         return;
 
-    m_database->execute_statement(m_statements.update_response_headers, {}, serialize_headers(response_headers), cache_key, vary_key);
+    auto serialized_response_headers = serialize_headers(response_headers);
+    auto old_serialized_response_headers_size = serialize_headers(entry->response_headers).length();
+
+    m_database->execute_statement(m_statements.update_response_headers, {}, serialized_response_headers, cache_key, vary_key);
     entry->response_headers = move(response_headers);
+
+    // Revalidation may have changed how the dictionary is to be used, or that it is to be used at all.
+    unregister_compression_dictionary(cache_key, vary_key);
+    register_compression_dictionary(cache_key, *entry);
+
+    entry->estimated_size = entry->estimated_size - old_serialized_response_headers_size + serialized_response_headers.length();
+    m_total_estimated_size = m_total_estimated_size - old_serialized_response_headers_size + serialized_response_headers.length();
 }
 
 void CacheIndex::update_last_access_time(u64 cache_key, u64 vary_key)
@@ -236,43 +406,84 @@ void CacheIndex::update_last_access_time(u64 cache_key, u64 vary_key)
     if (!entry.has_value())
         return;
 
-    auto now = UnixDateTime::now();
+    entry->last_access_time = UnixDateTime::now();
+    ++entry->access_count;
+    schedule_pending_write(cache_key, *entry, PendingWrite::UpdateLastAccessTime);
+}
 
-    m_database->execute_statement(m_statements.update_last_access_time, {}, now, cache_key, vary_key);
-    entry->last_access_time = now;
+void CacheIndex::schedule_pending_write(u64 cache_key, Entry& entry, PendingWrite pending_write)
+{
+    // An entry that is yet to be inserted will be inserted with its latest last access time.
+    if (entry.pending_write == PendingWrite::Insert)
+        return;
+
+    if (entry.pending_write == PendingWrite::None)
+        m_pending_writes.append({ cache_key, entry.vary_key });
+    entry.pending_write = pending_write;
+
+    start_pending_writes_timer();
+}
+
+void CacheIndex::start_pending_writes_timer()
+{
+    if (!m_pending_writes_timer) {
+        m_pending_writes_timer = Core::Timer::create_single_shot(PENDING_WRITES_FLUSH_INTERVAL_MS, [this]() {
+            flush_pending_writes();
+        });
+    }
+    if (!m_pending_writes_timer->is_active())
+        m_pending_writes_timer->start();
+}
+
+void CacheIndex::flush_pending_writes()
+{
+    if (m_pending_writes.is_empty())
+        return;
+
+    if (m_pending_writes_timer)
+        m_pending_writes_timer->stop();
+
+    auto transaction = m_database->begin_transaction();
+
+    for (auto const& [cache_key, vary_key] : m_pending_writes) {
+        // The entry may have been removed since its write was scheduled.
+        auto entry = get_entry(cache_key, vary_key);
+        if (!entry.has_value())
+            continue;
+
+        switch (entry->pending_write) {
+        case PendingWrite::None:
+            break;
+        case PendingWrite::Insert:
+            m_database->execute_statement(m_statements.insert_entry, {}, cache_key, vary_key, entry->url, serialize_headers(entry->request_headers), serialize_headers(entry->response_headers), entry->data_size, entry->request_time, entry->response_time, entry->last_access_time, entry->access_count, entry->dictionary_hash);
+            break;
+        case PendingWrite::UpdateLastAccessTime:
+            m_database->execute_statement(m_statements.update_last_access_time, {}, entry->last_access_time, entry->access_count, cache_key, vary_key);
+            break;
+        }
+
+        entry->pending_write = PendingWrite::None;
+    }
+
+    m_pending_writes.clear();
 }
 
 Optional<CacheIndex::Entry const&> CacheIndex::find_entry(u64 cache_key, HeaderList const& request_headers)
 {
-    auto& entries = m_entries.ensure(cache_key, [&]() {
-        Vector<Entry> entries;
-
-        m_database->execute_statement(
-            m_statements.select_entries,
-            [&](auto statement_id) {
-                int column = 1; // Skip the cache_key column.
-
-                auto vary_key = m_database->result_column<u64>(statement_id, column++);
-                auto url = m_database->result_column<String>(statement_id, column++);
-                auto request_headers = m_database->result_column<ByteString>(statement_id, column++);
-                auto response_headers = m_database->result_column<ByteString>(statement_id, column++);
-                auto data_size = m_database->result_column<u64>(statement_id, column++);
-                auto request_time = m_database->result_column<UnixDateTime>(statement_id, column++);
-                auto response_time = m_database->result_column<UnixDateTime>(statement_id, column++);
-                auto last_access_time = m_database->result_column<UnixDateTime>(statement_id, column++);
-
-                entries.empend(vary_key, move(url), deserialize_headers(request_headers), deserialize_headers(response_headers), data_size, request_time, response_time, last_access_time);
-            },
-            cache_key);
-
-        return entries;
-    });
+    auto entries = m_entries.get(cache_key);
+    if (!entries.has_value())
+        return {};
 
-    return find_value(entries, [&](auto const& entry) {
+    return find_value(*entries, [&](auto const& entry) {
         return create_vary_key(request_headers, entry.response_headers) == entry.vary_key;
     });
 }
 
+Optional<CacheIndex::Entry const&> CacheIndex::find_entry(u64 cache_key, u64 vary_key)
+{
+    return get_entry(cache_key, vary_key);
+}
+
 Optional<CacheIndex::Entry&> CacheIndex::get_entry(u64 cache_key, u64 vary_key)
 {
     auto entries = m_entries.get(cache_key);
@@ -288,14 +499,83 @@ void CacheIndex::delete_entry(u64 cache_key, u64 vary_key)
     if (!entries.has_value())
         return;
 
-    entries->remove_first_matching([&](auto const& entry) { return entry.vary_key == vary_key; });
+    entries->remove_first_matching([&](auto const& entry) {
+        if (entry.vary_key != vary_key)
+            return false;
+
+        m_total_estimated_size -= entry.estimated_size;
+        return true;
+    });
 
     if (entries->is_empty())
         m_entries.remove(cache_key);
+
+    unregister_compression_dictionary(cache_key, vary_key);
+}
+
+Optional<CompressionDictionary const&> CacheIndex::find_compression_dictionary(URL::URL const& url, HeaderList const& request_headers)
+{
+    auto request_destination = request_headers.get("Sec-Fetch-Dest"sv);
+    auto request_destination_view = request_destination.map([](auto const& destination) { return destination.view(); });
+
+    CompressionDictionary const* best_dictionary = nullptr;
+    UnixDateTime best_dictionary_response_time;
+
+    // https://www.rfc-editor.org/rfc/rfc9842#name-multiple-matching-dictionar
+    auto takes_precedence = [&](CompressionDictionary const& dictionary, UnixDateTime response_time) {
+        if (!best_dictionary)
+            return true;
+
+        // 1. A dictionary that specifies and matches a match-dest takes precedence over one that does not.
+        if (dictionary.has_match_destinations() != best_dictionary->has_match_destinations())
+            return dictionary.has_match_destinations();
+
+        // 2. Given equivalent destination precedence, the dictionary with the longest match takes precedence.
+        if (dictionary.match_length() != best_dictionary->match_length())
+            return dictionary.match_length() > best_dictionary->match_length();
+
+        // 3. Given equivalent destination and match length precedence, the most recently fetched dictionary takes
+        //    precedence.
+        return response_time > best_dictionary_response_time;
+    };
+
+    for (auto const& dictionary : m_compression_dictionaries) {
+        if (!dictionary.matches(url, request_destination_view))
+            continue;
+
+        auto entry = get_entry(dictionary.cache_key(), dictionary.vary_key());
+        if (!entry.has_value() || !takes_precedence(dictionary, entry->response_time))
+            continue;
+
+        best_dictionary = &dictionary;
+        best_dictionary_response_time = entry->response_time;
+    }
+
+    if (!best_dictionary)
+        return {};
+    return *best_dictionary;
+}
+
+void CacheIndex::register_compression_dictionary(u64 cache_key, Entry const& entry)
+{
+    if (entry.dictionary_hash.is_empty())
+        return;
+
+    if (auto dictionary = CompressionDictionary::create(cache_key, entry.vary_key, entry.url, entry.response_headers, entry.dictionary_hash); dictionary.has_value())
+        m_compression_dictionaries.append(dictionary.release_value());
+}
+
+void CacheIndex::unregister_compression_dictionary(u64 cache_key, u64 vary_key)
+{
+    m_compression_dictionaries.remove_first_matching([&](auto const& dictionary) {
+        return dictionary.cache_key() == cache_key && dictionary.vary_key() == vary_key;
+    });
 }
 
 Requests::CacheSizes CacheIndex::estimate_cache_size_accessed_since(UnixDateTime since)
 {
+    flush_pending_writes();
+
     Requests::CacheSizes sizes;
 
     m_database->execute_statement(
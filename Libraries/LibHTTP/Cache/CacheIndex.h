@@ -11,7 +11,9 @@
 #include <AK/NonnullRawPtr.h>
 #include <AK/Time.h>
 #include <AK/Types.h>
+#include <LibCore/Timer.h>
 #include <LibDatabase/Database.h>
+#include <LibHTTP/Cache/CompressionDictionary.h>
 #include <LibHTTP/HeaderList.h>
 #include <LibRequests/CacheSizes.h>
 
@@ -19,7 +21,16 @@ namespace HTTP {
 
 // The cache index is a SQL database containing metadata about each cache entry. An entry in the index is created once
 // the entire cache entry has been successfully written to disk.
+//
+// The whole index is loaded into memory when it is created, so that lookups never wait on the database. New entries
+// and last access times are written behind, in batched transactions.
 class CacheIndex {
+    enum class PendingWrite : u8 {
+        None,
+        Insert,
+        UpdateLastAccessTime,
+    };
+
     struct Entry {
         u64 vary_key { 0 };
 
@@ -27,21 +38,35 @@ class CacheIndex {
         NonnullRefPtr<HeaderList> request_headers;
         NonnullRefPtr<HeaderList> response_headers;
         u64 data_size { 0 };
+        u64 estimated_size { 0 };
 
         UnixDateTime request_time;
         UnixDateTime response_time;
         UnixDateTime last_access_time;
+        u32 access_count { 0 };
+
+        // The SHA-256 hash of the entry's data, if the response was marked for use as a compression dictionary.
+        ByteString dictionary_hash;
+
+        PendingWrite pending_write { PendingWrite::None };
     };
 
 public:
     static ErrorOr<CacheIndex> create(Database::Database&, LexicalPath const& cache_directory);
 
-    ErrorOr<void> create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time);
+    CacheIndex(CacheIndex&&);
+    CacheIndex& operator=(CacheIndex&&);
+    ~CacheIndex();
+
+    ErrorOr<void> create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time, ByteString dictionary_hash);
     void remove_entry(u64 cache_key, u64 vary_key);
+    bool exceeds_cache_limit() const;
     void remove_entries_exceeding_cache_limit(Function<void(u64 cache_key, u64 vary_key)> on_entry_removed);
     void remove_entries_accessed_since(UnixDateTime, Function<void(u64 cache_key, u64 vary_key)> on_entry_removed);
 
     Optional<Entry const&> find_entry(u64 cache_key, HeaderList const& request_headers);
+    Optional<Entry const&> find_entry(u64 cache_key, u64 vary_key);
+    Optional<CompressionDictionary const&> find_compression_dictionary(URL::URL const&, HeaderList const& request_headers);
 
     void update_response_headers(u64 cache_key, u64 vary_key, NonnullRefPtr<HeaderList>);
     void update_last_access_time(u64 cache_key, u64 vary_key);
@@ -54,9 +79,7 @@ private:
     struct Statements {
         Database::StatementID insert_entry { 0 };
         Database::StatementID remove_entry { 0 };
-        Database::StatementID remove_entries_exceeding_cache_limit { 0 };
         Database::StatementID remove_entries_accessed_since { 0 };
-        Database::StatementID select_entries { 0 };
         Database::StatementID update_response_headers { 0 };
         Database::StatementID update_last_access_time { 0 };
         Database::StatementID estimate_cache_size_accessed_since { 0 };
@@ -68,17 +91,34 @@ private:
         u64 maximum_disk_cache_entry_size { 0 };
     };
 
-    CacheIndex(Database::Database&, Statements, Limits);
+    using Entries = HashMap<u64, Vector<Entry>, IdentityHashTraits<u64>>;
+    CacheIndex(Database::Database&, Statements, Limits, Entries);
 
     Optional<Entry&> get_entry(u64 cache_key, u64 vary_key);
     void delete_entry(u64 cache_key, u64 vary_key);
 
+    void register_compression_dictionary(u64 cache_key, Entry const&);
+    void unregister_compression_dictionary(u64 cache_key, u64 vary_key);
+
+    void schedule_pending_write(u64 cache_key, Entry&, PendingWrite);
+    void start_pending_writes_timer();
+    void flush_pending_writes();
+
     NonnullRawPtr<Database::Database> m_database;
     Statements m_statements;
 
-    HashMap<u64, Vector<Entry>, IdentityHashTraits<u64>> m_entries;
+    Entries m_entries;
+    Vector<CompressionDictionary> m_compression_dictionaries;
+
+    struct PendingWriteKey {
+        u64 cache_key { 0 };
+        u64 vary_key { 0 };
+    };
+    Vector<PendingWriteKey> m_pending_writes;
+    RefPtr<Core::Timer> m_pending_writes_timer;
 
     Limits m_limits;
+    u64 m_total_estimated_size { 0 };
 };
 
 }
@@ -18,6 +18,7 @@ public:
     virtual ~CacheRequest() = default;
 
     virtual bool is_revalidation_request() const = 0;
+    virtual HeaderList const& request_headers() const = 0;
 
     virtual void notify_request_unblocked(Badge<DiskCache>) = 0;
 
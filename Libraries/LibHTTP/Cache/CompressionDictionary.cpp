@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Base64.h>
+#include <AK/CharacterTypes.h>
+#include <AK/GenericLexer.h>
+#include <AK/GenericShorthands.h>
+#include <AK/HashMap.h>
+#include <AK/StringBuilder.h>
+#include <AK/Variant.h>
+#include <LibHTTP/Cache/CompressionDictionary.h>
+#include <LibURL/Parser.h>
+#include <LibURL/Pattern/Pattern.h>
+#include <LibURL/URL.h>
+
+namespace HTTP {
+
+// The longest dictionary ID a client is required to support.
+static constexpr size_t MAXIMUM_DICTIONARY_ID_LENGTH = 1024;
+
+// The subset of structured field values used by the Use-As-Dictionary header. Values of any other type are represented
+// by Empty, as they are not valid for any of its members.
+struct StructuredFieldToken {
+    String value;
+};
+using StructuredFieldValue = Variant<Empty, String, StructuredFieldToken, Vector<String>>;
+
+static void skip_optional_whitespace(GenericLexer& lexer)
+{
+    lexer.ignore_while([](char ch) { return ch == ' ' || ch == '\t'; });
+}
+
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-a-key
+static Optional<StringView> parse_structured_field_key(GenericLexer& lexer)
+{
+    if (!is_ascii_lower_alpha(lexer.peek()) && lexer.peek() != '*')
+        return {};
+
+    return lexer.consume_while([](char ch) {
+        return is_ascii_lower_alpha(ch) || is_ascii_digit(ch) || first_is_one_of(ch, '_', '-', '.', '*');
+    });
+}
+
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-a-string
+static Optional<String> parse_structured_field_string(GenericLexer& lexer)
+{
+    if (!lexer.consume_specific('"'))
+        return {};
+
+    StringBuilder builder;
+
+    while (!lexer.is_eof()) {
+        auto ch = lexer.consume();
+
+        if (ch == '\\') {
+            if (lexer.is_eof())
+                return {};
+
+            auto escaped_ch = lexer.consume();
+            if (escaped_ch != '"' && escaped_ch != '\\')
+                return {};
+
+            builder.append(escaped_ch);
+        } else if (ch == '"') {
+            return MUST(builder.to_string());
+        } else if (ch < 0x20 || ch >= 0x7f) {
+            return {};
+        } else {
+            builder.append(ch);
+        }
+    }
+
+    return {};
+}
+
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-a-bare-item
+static Optional<StructuredFieldValue> parse_structured_field_bare_item(GenericLexer& lexer)
+{
+    auto ch = lexer.peek();
+
+    if (ch == '"') {
+        auto string = parse_structured_field_string(lexer);
+        if (!string.has_value())
+            return {};
+        return StructuredFieldValue { string.release_value() };
+    }
+
+    if (is_ascii_alpha(ch) || ch == '*') {
+        auto token = lexer.consume_while([](char ch) {
+            return is_ascii_alphanumeric(ch) || first_is_one_of(ch, '!', '#', '$', '%', '&', '\'', '*', '+', '-', '.', '^', '_', '`', '|', '~', ':', '/');
+        });
+        return StructuredFieldValue { StructuredFieldToken { MUST(String::from_utf8(token)) } };
+    }
+
+    // Integers, decimals, byte sequences, and booleans are not valid for any member, so we only need to know where
+    // they end.
+    if (ch == '-' || is_ascii_digit(ch)) {
+        lexer.ignore(1);
+        lexer.ignore_while([](char ch) { return ch == '.' || is_ascii_digit(ch); });
+    } else if (ch == '?') {
+        lexer.ignore(1);
+        if (!lexer.consume_specific('0') && !lexer.consume_specific('1'))
+            return {};
+    } else if (ch == ':') {
+        lexer.ignore(1);
+        lexer.ignore_until(':');
+        if (!lexer.consume_specific(':'))
+            return {};
+    } else {
+        return {};
+    }
+
+    return StructuredFieldValue { Empty {} };
+}
+
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-parameters
+static bool skip_structured_field_parameters(GenericLexer& lexer)
+{
+    while (lexer.consume_specific(';')) {
+        lexer.ignore_while([](char ch) { return ch == ' '; });
+
+        if (!parse_structured_field_key(lexer).has_value())
+            return false;
+
+        if (lexer.consume_specific('=') && !parse_structured_field_bare_item(lexer).has_value())
+            return false;
+    }
+
+    return true;
+}
+
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-an-inner-list
+static Optional<StructuredFieldValue> parse_structured_field_inner_list(GenericLexer& lexer)
+{
+    VERIFY(lexer.consume_specific('('));
+
+    Vector<String> strings;
+    bool contains_only_strings = true;
+
+    while (!lexer.is_eof()) {
+        lexer.ignore_while([](char ch) { return ch == ' '; });
+
+        if (lexer.consume_specific(')')) {
+            if (!skip_structured_field_parameters(lexer))
+                return {};
+
+            if (!contains_only_strings)
+                return StructuredFieldValue { Empty {} };
+            return StructuredFieldValue { move(strings) };
+        }
+
+        auto item = parse_structured_field_bare_item(lexer);
+        if (!item.has_value() || !skip_structured_field_parameters(lexer))
+            return {};
+
+        if (auto* string = item->get_pointer<String>())
+            strings.append(move(*string));
+        else
+            contains_only_strings = false;
+
+        if (!first_is_one_of(lexer.peek(), ' ', ')'))
+            return {};
+    }
+
+    return {};
+}
+
+// https://www.rfc-editor.org/rfc/rfc8941#name-parsing-a-dictionary
+static Optional<HashMap<String, StructuredFieldValue>> parse_structured_field_dictionary(StringView header_value)
+{
+    HashMap<String, StructuredFieldValue> dictionary;
+
+    GenericLexer lexer { header_value.trim(" \t"sv) };
+
+    while (!lexer.is_eof()) {
+        auto key = parse_structured_field_key(lexer);
+        if (!key.has_value())
+            return {};
+
+        StructuredFieldValue value;
+
+        if (lexer.consume_specific('=')) {
+            auto member = lexer.peek() == '('
+                ? parse_structured_field_inner_list(lexer)
+                : parse_structured_field_bare_item(lexer);
+            if (!member.has_value())
+                return {};
+
+            value = member.release_value();
+        }
+
+        if (!skip_structured_field_parameters(lexer))
+            return {};
+
+        dictionary.set(MUST(String::from_utf8(*key)), move(value));
+
+        skip_optional_whitespace(lexer);
+        if (lexer.is_eof())
+            break;
+
+        if (!lexer.consume_specific(','))
+            return {};
+
+        skip_optional_whitespace(lexer);
+        if (lexer.is_eof())
+            return {};
+    }
+
+    return dictionary;
+}
+
+Optional<CompressionDictionary> CompressionDictionary::create(u64 cache_key, u64 vary_key, StringView url_string, HeaderList const& response_headers, ByteString hash)
+{
+    auto header_value = response_headers.get(USE_AS_DICTIONARY_HEADER);
+    if (!header_value.has_value())
+        return {};
+
+    // NB: Dictionaries may only be used in secure contexts, so as not to be tampered with in transit.
+    auto url = URL::Parser::basic_parse(url_string);
+    if (!url.has_value() || url->scheme() != "https"sv)
+        return {};
+
+    auto dictionary = parse_structured_field_dictionary(*header_value);
+    if (!dictionary.has_value())
+        return {};
+
+    // https://www.rfc-editor.org/rfc/rfc9842#name-match
+    auto match = dictionary->get("match"sv);
+    if (!match.has_value() || !match->has<String>())
+        return {};
+
+    // https://www.rfc-editor.org/rfc/rfc9842#name-match-dest
+    Vector<String> match_destinations;
+    if (auto match_dest = dictionary->get("match-dest"sv); match_dest.has_value()) {
+        if (!match_dest->has<Vector<String>>())
+            return {};
+        match_destinations = match_dest->get<Vector<String>>();
+    }
+
+    // https://www.rfc-editor.org/rfc/rfc9842#name-id
+    String id;
+    if (auto id_value = dictionary->get("id"sv); id_value.has_value()) {
+        if (!id_value->has<String>() || id_value->get<String>().bytes_as_string_view().length() > MAXIMUM_DICTIONARY_ID_LENGTH)
+            return {};
+        id = id_value->get<String>();
+    }
+
+    // https://www.rfc-editor.org/rfc/rfc9842#name-type
+    if (auto type = dictionary->get("type"sv); type.has_value()) {
+        if (!type->has<StructuredFieldToken>() || type->get<StructuredFieldToken>().value != "raw"sv)
+            return {};
+    }
+
+    // https://www.rfc-editor.org/rfc/rfc9842#name-dictionary-url-matching
+    auto const& match_string = match->get<String>();
+
+    auto pattern = URL::Pattern::Pattern::create(match_string, url->serialize());
+    if (pattern.is_error() || pattern.value().has_regexp_groups())
+        return {};
+
+    auto match_pattern = make<URL::Pattern::Pattern>(pattern.release_value());
+    AvailableDictionary available_dictionary { .cache_key = cache_key, .vary_key = vary_key, .hash = move(hash), .id = move(id) };
+    return CompressionDictionary { move(available_dictionary), url->origin(), match_string, move(match_pattern), move(match_destinations) };
+}
+
+CompressionDictionary::CompressionDictionary(AvailableDictionary available_dictionary, URL::Origin origin, String match, NonnullOwnPtr<URL::Pattern::Pattern> match_pattern, Vector<String> match_destinations)
+    : m_available_dictionary(move(available_dictionary))
+    , m_origin(move(origin))
+    , m_match(move(match))
+    , m_match_pattern(move(match_pattern))
+    , m_match_destinations(move(match_destinations))
+{
+}
+
+CompressionDictionary::CompressionDictionary(CompressionDictionary&&) = default;
+CompressionDictionary& CompressionDictionary::operator=(CompressionDictionary&&) = default;
+CompressionDictionary::~CompressionDictionary() = default;
+
+bool CompressionDictionary::matches(URL::URL const& request_url, Optional<StringView> request_destination) const
+{
+    // 1. If the current client is not a secure context, return false.
+    if (request_url.scheme() != "https"sv)
+        return false;
+
+    // 2. If the origin of the request URL is not the same as the origin of the dictionary URL, return false.
+    if (!request_url.origin().is_same_origin(m_origin))
+        return false;
+
+    // 3. If the dictionary has a match-dest list that does not contain the request's destination, return false.
+    if (!m_match_destinations.is_empty()) {
+        if (!request_destination.has_value())
+            return false;
+        if (!m_match_destinations.contains_slow(*request_destination))
+            return false;
+    }
+
+    // 4. Return the result of matching the request URL against the dictionary's URL pattern.
+    auto result = m_match_pattern->match(request_url, {});
+    return !result.is_error() && result.value().has_value();
+}
+
+// https://www.rfc-editor.org/rfc/rfc9842#name-available-dictionary
+ByteString AvailableDictionary::available_dictionary_header_value() const
+{
+    // The hash is sent as a structured field byte sequence.
+    return ByteString::formatted(":{}:", MUST(encode_base64(hash.bytes())));
+}
+
+// https://www.rfc-editor.org/rfc/rfc9842#name-dictionary-id
+ByteString AvailableDictionary::dictionary_id_header_value() const
+{
+    // The ID is sent as a structured field string.
+    StringBuilder builder;
+    builder.append('"');
+
+    for (auto ch : id.bytes_as_string_view()) {
+        if (ch == '"' || ch == '\\')
+            builder.append('\\');
+        builder.append(ch);
+    }
+
+    builder.append('"');
+    return builder.to_byte_string();
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/StringView.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+#include <LibHTTP/HeaderList.h>
+#include <LibURL/Forward.h>
+#include <LibURL/Origin.h>
+
+namespace URL::Pattern {
+
+class Pattern;
+
+}
+
+namespace HTTP {
+
+constexpr inline auto USE_AS_DICTIONARY_HEADER = "Use-As-Dictionary"sv;
+constexpr inline auto AVAILABLE_DICTIONARY_HEADER = "Available-Dictionary"sv;
+constexpr inline auto DICTIONARY_ID_HEADER = "Dictionary-ID"sv;
+
+// The content coding of a response compressed with Zstandard, using a compression dictionary.
+constexpr inline auto DICTIONARY_COMPRESSED_ZSTD_ENCODING = "dcz"sv;
+
+// What a request needs to know about the dictionary it advertises. The dictionary itself may be evicted from the cache
+// while the request is in flight.
+struct AvailableDictionary {
+    ByteString available_dictionary_header_value() const;
+    ByteString dictionary_id_header_value() const;
+
+    u64 cache_key { 0 };
+    u64 vary_key { 0 };
+
+    // The SHA-256 hash of the dictionary's data.
+    ByteString hash;
+    String id;
+};
+
+// A cached response that its server has marked for use as a compression dictionary, by way of the Use-As-Dictionary
+// response header. Later requests to URLs the dictionary matches advertise it in their Available-Dictionary header, and
+// the server may then send responses that were compressed against it.
+//
+// https://www.rfc-editor.org/rfc/rfc9842
+class CompressionDictionary {
+public:
+    static Optional<CompressionDictionary> create(u64 cache_key, u64 vary_key, StringView url, HeaderList const& response_headers, ByteString hash);
+
+    CompressionDictionary(CompressionDictionary&&);
+    CompressionDictionary& operator=(CompressionDictionary&&);
+    ~CompressionDictionary();
+
+    AvailableDictionary const& available_dictionary() const { return m_available_dictionary; }
+    u64 cache_key() const { return m_available_dictionary.cache_key; }
+    u64 vary_key() const { return m_available_dictionary.vary_key; }
+
+    bool has_match_destinations() const { return !m_match_destinations.is_empty(); }
+    size_t match_length() const { return m_match.bytes_as_string_view().length(); }
+
+    // https://www.rfc-editor.org/rfc/rfc9842#name-dictionary-url-matching
+    bool matches(URL::URL const& request_url, Optional<StringView> request_destination) const;
+
+private:
+    CompressionDictionary(AvailableDictionary, URL::Origin, String match, NonnullOwnPtr<URL::Pattern::Pattern>, Vector<String> match_destinations);
+
+    AvailableDictionary m_available_dictionary;
+
+    URL::Origin m_origin;
+    String m_match;
+    NonnullOwnPtr<URL::Pattern::Pattern> m_match_pattern;
+    Vector<String> m_match_destinations;
+};
+
+}
@@ -112,7 +112,11 @@ Variant<Optional<CacheEntryReader&>, DiskCache::CacheHasOpenEntry> DiskCache::op
     auto serialized_url = serialize_url_for_cache_storage(url);
     auto cache_key = create_cache_key(serialized_url, method, m_partitioned_cache_key);
 
-    if (check_if_cache_has_open_entry(request, cache_key, url, open_mode == OpenMode::Read ? CheckReaderEntries::No : CheckReaderEntries::Yes))
+    // A request that waits for an entry to be written could have used the written response, so long as it would not
+    // have had to revalidate that response.
+    auto may_follow_writer = open_mode == OpenMode::Read && cache_mode != CacheMode::NoCache ? MayFollowWriter::Yes : MayFollowWriter::No;
+
+    if (check_if_cache_has_open_entry(request, cache_key, url, open_mode == OpenMode::Read ? CheckReaderEntries::No : CheckReaderEntries::Yes, may_follow_writer))
         return CacheHasOpenEntry {};
 
     auto index_entry = m_index.find_entry(cache_key, request_headers);
@@ -202,7 +206,7 @@ Variant<Optional<CacheEntryReader&>, DiskCache::CacheHasOpenEntry> DiskCache::op
     return Optional<CacheEntryReader&> { *cache_entry_pointer };
 }
 
-bool DiskCache::check_if_cache_has_open_entry(CacheRequest& request, u64 cache_key, URL::URL const& url, CheckReaderEntries check_reader_entries)
+bool DiskCache::check_if_cache_has_open_entry(CacheRequest& request, u64 cache_key, URL::URL const& url, CheckReaderEntries check_reader_entries, MayFollowWriter may_follow_writer)
 {
     // FIXME: We purposefully do not use the vary key here, as we do not yet have it when creating a CacheEntryWriter
     //        (we can only compute it once we receive the response headers). We could come up with a more sophisticated
@@ -215,7 +219,7 @@ bool DiskCache::check_if_cache_has_open_entry(CacheRequest& request, u64 cache_k
     for (auto const& [open_entry, open_request] : *open_entries) {
         if (is<CacheEntryWriter>(*open_entry)) {
             dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[36;1mDeferring cache entry for\033[0m {} (waiting for existing writer)", url);
-            m_requests_waiting_completion.ensure(cache_key).append(request);
+            m_requests_waiting_completion.ensure(cache_key).append({ request, may_follow_writer });
             return true;
         }
 
@@ -223,7 +227,7 @@ bool DiskCache::check_if_cache_has_open_entry(CacheRequest& request, u64 cache_k
         // request, which may then result in the cache entry being updated or deleted.
         if (check_reader_entries == CheckReaderEntries::Yes || (open_request && open_request->is_revalidation_request())) {
             dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[36;1mDeferring cache entry for\033[0m {} (waiting for existing reader)", url);
-            m_requests_waiting_completion.ensure(cache_key).append(request);
+            m_requests_waiting_completion.ensure(cache_key).append({ request, may_follow_writer });
             return true;
         }
     }
@@ -231,16 +235,79 @@ bool DiskCache::check_if_cache_has_open_entry(CacheRequest& request, u64 cache_k
     return false;
 }
 
-void DiskCache::remove_entries_exceeding_cache_limit()
+Vector<NonnullRawPtr<CacheRequest>> DiskCache::take_requests_able_to_follow(CacheEntryWriter const& cache_entry, HeaderList const& response_headers)
 {
-    m_index.remove_entries_exceeding_cache_limit([&](auto cache_key, auto vary_key) {
-        delete_entry(cache_key, vary_key);
+    Vector<NonnullRawPtr<CacheRequest>> requests;
+
+    auto waiting_requests = m_requests_waiting_completion.get(cache_entry.cache_key());
+    if (!waiting_requests.has_value())
+        return requests;
+
+    waiting_requests->remove_all_matching([&](auto const& waiting_request) {
+        if (!waiting_request.request)
+            return true;
+        if (waiting_request.may_follow_writer == MayFollowWriter::No)
+            return false;
+        if (!cache_entry.can_serve(waiting_request.request->request_headers(), response_headers))
+            return false;
+
+        requests.append(*waiting_request.request);
+        return true;
     });
+
+    if (waiting_requests->is_empty())
+        m_requests_waiting_completion.remove(cache_entry.cache_key());
+
+    if (!requests.is_empty())
+        dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[32;1mFollowing cache entry writer with\033[0m {} waiting request(s)", requests.size());
+
+    return requests;
+}
+
+Optional<AvailableDictionary> DiskCache::find_compression_dictionary(URL::URL const& url, HeaderList const& request_headers)
+{
+    auto dictionary = m_index.find_compression_dictionary(url, request_headers);
+    if (!dictionary.has_value())
+        return {};
+
+    dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[32;1mFound compression dictionary for\033[0m {}", url);
+    return dictionary->available_dictionary();
+}
+
+ErrorOr<ByteBuffer> DiskCache::read_compression_dictionary(AvailableDictionary const& dictionary)
+{
+    auto index_entry = m_index.find_entry(dictionary.cache_key, dictionary.vary_key);
+    if (!index_entry.has_value() || index_entry->dictionary_hash != dictionary.hash)
+        return Error::from_string_literal("Compression dictionary is no longer cached");
+
+    // NB: The reader is not tracked as an open entry. It reads the dictionary synchronously, and a writer replacing the
+    //     entry in the meantime writes to a new file.
+    auto cache_entry = TRY(CacheEntryReader::create(*this, m_index, dictionary.cache_key, dictionary.vary_key, index_entry->response_headers, index_entry->data_size));
+    return cache_entry->read_data();
+}
+
+void DiskCache::remove_entries_exceeding_cache_limit()
+{
+    if (!m_index.exceeds_cache_limit())
+        return;
+
+    // Evict entries once the request that wrote the newest entry is done, rather than making it wait on the removal of
+    // potentially many files.
+    if (!m_eviction_timer) {
+        m_eviction_timer = Core::Timer::create_single_shot(0, [this]() {
+            m_index.remove_entries_exceeding_cache_limit([&](auto cache_key, auto vary_key) {
+                delete_entry(cache_key, vary_key);
+            });
+        });
+    }
+    if (!m_eviction_timer->is_active())
+        m_eviction_timer->start();
 }
 
 void DiskCache::set_maximum_disk_cache_size(u64 maximum_disk_cache_size)
 {
     m_index.set_maximum_disk_cache_size(maximum_disk_cache_size);
+    remove_entries_exceeding_cache_limit();
 }
 
 Requests::CacheSizes DiskCache::estimate_cache_size_accessed_since(UnixDateTime since)
@@ -277,7 +344,7 @@ void DiskCache::cache_entry_closed(Badge<CacheEntry>, CacheEntry const& cache_en
         // does not succeed, we delete the cache entry, and end up here. We must queue the new request outside of that
         // callback, otherwise curl will return CURLM_RECURSIVE_API_CALL error codes.
         Core::deferred_invoke([pending_requests = pending_requests.release_value()]() {
-            for (auto const& request : pending_requests) {
+            for (auto const& [request, _] : pending_requests) {
                 if (request)
                     request->notify_request_unblocked({});
             }
@@ -8,6 +8,7 @@
 
 #include <AK/Error.h>
 #include <AK/LexicalPath.h>
+#include <AK/NonnullRawPtr.h>
 #include <AK/Optional.h>
 #include <AK/StringView.h>
 #include <AK/Time.h>
@@ -17,6 +18,7 @@
 #include <LibHTTP/Cache/CacheEntry.h>
 #include <LibHTTP/Cache/CacheIndex.h>
 #include <LibHTTP/Cache/CacheMode.h>
+#include <LibHTTP/Cache/CompressionDictionary.h>
 #include <LibURL/Forward.h>
 
 namespace HTTP {
@@ -52,6 +54,13 @@ public:
     };
     Variant<Optional<CacheEntryReader&>, CacheHasOpenEntry> open_entry(CacheRequest&, URL::URL const&, StringView method, HeaderList const& request_headers, CacheMode, OpenMode);
 
+    // Requests that are waiting for an entry to be written may instead follow the entry's writer, and be served its
+    // response as it arrives. This takes the waiting requests that would be able to use the response being written.
+    Vector<NonnullRawPtr<CacheRequest>> take_requests_able_to_follow(CacheEntryWriter const&, HeaderList const& response_headers);
+
+    Optional<AvailableDictionary> find_compression_dictionary(URL::URL const&, HeaderList const& request_headers);
+    ErrorOr<ByteBuffer> read_compression_dictionary(AvailableDictionary const&);
+
     void remove_entries_exceeding_cache_limit();
     void set_maximum_disk_cache_size(u64 maximum_disk_cache_size);
 
@@ -69,7 +78,11 @@ private:
         No,
         Yes,
     };
-    bool check_if_cache_has_open_entry(CacheRequest&, u64 cache_key, URL::URL const&, CheckReaderEntries);
+    enum class MayFollowWriter {
+        No,
+        Yes,
+    };
+    bool check_if_cache_has_open_entry(CacheRequest&, u64 cache_key, URL::URL const&, CheckReaderEntries, MayFollowWriter = MayFollowWriter::No);
 
     void delete_entry(u64 cache_key, u64 vary_key);
 
@@ -83,10 +96,17 @@ private:
         WeakPtr<CacheRequest> request;
     };
     HashMap<u64, Vector<OpenCacheEntry, 1>, IdentityHashTraits<u64>> m_open_cache_entries;
-    HashMap<u64, Vector<WeakPtr<CacheRequest>, 1>, IdentityHashTraits<u64>> m_requests_waiting_completion;
+
+    struct WaitingCacheRequest {
+        WeakPtr<CacheRequest> request;
+        MayFollowWriter may_follow_writer { MayFollowWriter::No };
+    };
+    HashMap<u64, Vector<WaitingCacheRequest, 1>, IdentityHashTraits<u64>> m_requests_waiting_completion;
 
     LexicalPath m_cache_directory;
     CacheIndex m_index;
+
+    RefPtr<Core::Timer> m_eviction_timer;
 };
 
 }
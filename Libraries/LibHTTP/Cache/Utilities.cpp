@@ -104,11 +104,15 @@ u64 create_vary_key(HeaderList const& request_headers, HeaderList const& respons
 
 LexicalPath path_for_cache_entry(LexicalPath const& cache_directory, u64 cache_key, u64 vary_key)
 {
+    // Entries are spread over 256 shard directories by the top byte of their cache key, so that no single directory
+    // grows large enough to make creating, opening or removing its files slow.
+    auto shard = ByteString::formatted("{:02x}", cache_key >> 56);
+
     auto file = vary_key == 0
         ? ByteString::formatted("{:016x}", cache_key)
         : ByteString::formatted("{:016x}_{:016x}", cache_key, vary_key);
 
-    return cache_directory.append(file);
+    return cache_directory.append(shard).append(file);
 }
 
 // https://httpwg.org/specs/rfc9111.html#response.cacheability
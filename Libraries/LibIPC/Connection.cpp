@@ -6,10 +6,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
+#include <AK/QuickSort.h>
 #include <AK/Vector.h>
+#include <LibCore/Tracing.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
 #include <LibIPC/Stub.h>
+#include <LibThreading/Mutex.h>
 
 namespace IPC {
 
@@ -34,6 +38,8 @@ bool ConnectionBase::is_open() const
 
 ErrorOr<void> ConnectionBase::post_message(Message const& message)
 {
+    TRACE_EVENT("ipc.send", message.message_name());
+
     auto buffer = TRY(message.encode());
     return post_message(buffer);
 }
@@ -45,11 +51,41 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer& buffer)
     if (!m_transport->is_open())
         return Error::from_string_literal("Trying to post_message during IPC shutdown");
 
+    send_coalesced_messages();
     TRY(buffer.transfer_message(*m_transport));
 
     return {};
 }
 
+void ConnectionBase::post_coalesced_message(i32 message_id, Optional<u64> page_id, MessageBuffer buffer)
+{
+    if (m_coalesced_messages.is_empty()) {
+        deferred_invoke([this] {
+            send_coalesced_messages();
+        });
+    }
+
+    m_coalesced_messages.remove_first_matching([&](auto const& message) {
+        return message.message_id == message_id && message.page_id == page_id;
+    });
+
+    m_coalesced_messages.append({ message_id, page_id, move(buffer) });
+}
+
+void ConnectionBase::send_coalesced_messages()
+{
+    if (m_coalesced_messages.is_empty())
+        return;
+
+    auto messages = move(m_coalesced_messages);
+    if (!m_transport->is_open())
+        return;
+
+    // Coalesced messages silently ignore send failures, like any other async message.
+    for (auto& message : messages)
+        (void)message.buffer.transfer_message(*m_transport);
+}
+
 void ConnectionBase::shutdown()
 {
     m_transport->close();
@@ -72,6 +108,7 @@ void ConnectionBase::handle_messages()
         if (!is_open())
             dbgln("Handling message while connection closed: {}", message->message_name());
 
+        TRACE_EVENT("ipc.receive", message->message_name());
         auto handler_result = m_local_stub.handle(move(message));
         if (handler_result.is_error()) {
             dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
@@ -97,10 +134,10 @@ ConnectionBase::PeerEOF ConnectionBase::drain_messages_from_peer()
 {
     bool parse_error = false;
     auto schedule_shutdown = m_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
-        if (auto message = try_parse_message(raw_message.bytes, raw_message.attachments)) {
+        if (auto message = try_parse_message(raw_message.payload(), raw_message.attachments)) {
             m_unprocessed_messages.append(message.release_nonnull());
         } else {
-            dbgln("Failed to parse IPC message {:hex-dump}", raw_message.bytes);
+            dbgln("Failed to parse IPC message {:hex-dump}", raw_message.payload());
             parse_error = true;
         }
     });
@@ -166,4 +203,60 @@ OwnPtr<IPC::Message> ConnectionBase::wait_for_specific_endpoint_message_impl(u32
     return {};
 }
 
+namespace {
+
+class SynchronousMessageStatistics {
+public:
+    ~SynchronousMessageStatistics()
+    {
+        Threading::MutexLocker locker(m_mutex);
+        if (m_statistics.is_empty())
+            return;
+
+        Vector<StringView> message_names;
+        for (auto const& it : m_statistics)
+            message_names.append(it.key);
+        quick_sort(message_names, [&](auto a, auto b) { return m_statistics.get(a)->total_time > m_statistics.get(b)->total_time; });
+
+        dbgln("Synchronous IPC messages sent by this process, by total time spent waiting:");
+        for (auto message_name : message_names) {
+            auto const& statistic = *m_statistics.get(message_name);
+            dbgln("  {}: {} times, {}us total, {}us average, {}us longest", message_name, statistic.count,
+                statistic.total_time.to_microseconds(), statistic.total_time.to_microseconds() / static_cast<i64>(statistic.count),
+                statistic.longest_time.to_microseconds());
+        }
+    }
+
+    void record(StringView message_name, AK::Duration time)
+    {
+        Threading::MutexLocker locker(m_mutex);
+
+        auto& statistic = m_statistics.ensure(message_name);
+        ++statistic.count;
+        statistic.total_time += time;
+        statistic.longest_time = max(statistic.longest_time, time);
+    }
+
+private:
+    struct Statistic {
+        size_t count { 0 };
+        AK::Duration total_time;
+        AK::Duration longest_time;
+    };
+
+    Threading::Mutex m_mutex;
+    HashMap<StringView, Statistic> m_statistics;
+};
+
+}
+
+void ConnectionBase::record_synchronous_message(char const* message_name, Optional<MonotonicTime> start_time)
+{
+    if (!start_time.has_value())
+        return;
+
+    static SynchronousMessageStatistics statistics;
+    statistics.record({ message_name, strlen(message_name) }, MonotonicTime::now() - *start_time);
+}
+
 }
@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include <AK/Debug.h>
 #include <AK/Forward.h>
 #include <AK/Queue.h>
+#include <AK/Time.h>
 #include <LibCore/EventReceiver.h>
 #include <LibIPC/Attachment.h>
 #include <LibIPC/Forward.h>
@@ -28,6 +30,11 @@ public:
     ErrorOr<void> post_message(Message const&);
     ErrorOr<void> post_message(MessageBuffer&);
 
+    // Only the latest of a coalesced message matters, so it is held back until the end of the current event loop
+    // iteration, replacing any earlier one of the same type (and for the same page) that has not been sent yet.
+    // Posting any other message sends the held back messages first, so messages are never reordered.
+    void post_coalesced_message(i32 message_id, Optional<u64> page_id, MessageBuffer);
+
     void shutdown();
     virtual void die() { }
 
@@ -40,6 +47,17 @@ protected:
     virtual OwnPtr<Message> try_parse_message(ReadonlyBytes, Queue<Attachment>&) = 0;
 
     OwnPtr<IPC::Message> wait_for_specific_endpoint_message_impl(u32 endpoint_magic, int message_id);
+
+    // With SYNC_IPC_DEBUG, every synchronous round-trip is counted and timed per message type, to find the ones that
+    // are worth making asynchronous. The totals are logged when the process exits.
+    static Optional<MonotonicTime> synchronous_message_start_time()
+    {
+        if constexpr (SYNC_IPC_DEBUG)
+            return MonotonicTime::now();
+        return {};
+    }
+    static void record_synchronous_message(char const* message_name, Optional<MonotonicTime> start_time);
+
     void wait_for_transport_to_become_readable();
     enum class PeerEOF {
         No,
@@ -49,12 +67,21 @@ protected:
 
     void handle_messages();
 
+    void send_coalesced_messages();
+
     IPC::Stub& m_local_stub;
 
     NonnullOwnPtr<Transport> m_transport;
 
     Vector<NonnullOwnPtr<Message>> m_unprocessed_messages;
 
+    struct CoalescedMessage {
+        i32 message_id { 0 };
+        Optional<u64> page_id;
+        MessageBuffer buffer;
+    };
+    Vector<CoalescedMessage> m_coalesced_messages;
+
     u32 m_local_endpoint_magic { 0 };
 };
 
@@ -69,18 +96,23 @@ public:
     template<typename RequestType, typename... Args>
     NonnullOwnPtr<typename RequestType::ResponseType> send_sync(Args&&... args)
     {
+        auto start_time = synchronous_message_start_time();
         MUST(post_message(RequestType(forward<Args>(args)...)));
         auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
         VERIFY(response);
+        record_synchronous_message(RequestType::static_message_name(), start_time);
         return response.release_nonnull();
     }
 
     template<typename RequestType, typename... Args>
     OwnPtr<typename RequestType::ResponseType> send_sync_but_allow_failure(Args&&... args)
     {
+        auto start_time = synchronous_message_start_time();
         if (post_message(RequestType(forward<Args>(args)...)).is_error())
             return nullptr;
-        return wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        record_synchronous_message(RequestType::static_message_name(), start_time);
+        return response;
     }
 
 protected:
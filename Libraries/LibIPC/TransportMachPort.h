@@ -57,6 +57,8 @@ public:
     struct Message {
         Vector<u8> bytes;
         Queue<Attachment> attachments;
+
+        ReadonlyBytes payload() const { return bytes; }
     };
     ShouldShutdown read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&&);
 
@@ -48,12 +48,14 @@ ErrorOr<TransportSocket::Paired> TransportSocket::create_paired()
     };
 }
 
-void SendQueue::enqueue_message(ReadonlyBytes header, ReadonlyBytes payload, Vector<int>&& fds)
+bool SendQueue::enqueue_message(ReadonlyBytes header, ReadonlyBytes payload, Vector<int>&& fds)
 {
     Threading::MutexLocker locker(m_mutex);
+    auto was_empty = m_stream.used_buffer_size() == 0 && m_fds.is_empty();
     VERIFY(MUST(m_stream.write_some(header)) == header.size());
     VERIFY(MUST(m_stream.write_some(payload)) == payload.size());
     m_fds.append(fds.data(), fds.size());
+    return was_empty;
 }
 
 SendQueue::BytesAndFds SendQueue::peek(size_t max_bytes)
@@ -161,7 +163,8 @@ intptr_t TransportSocket::io_thread_loop()
         }
 
         if (pollfds[0].revents & POLLOUT) {
-            auto [bytes, fds] = m_send_queue->peek(4096);
+            // Send everything that has been queued up since the last write at once, rather than one message at a time.
+            auto [bytes, fds] = m_send_queue->peek(SOCKET_BUFFER_SIZE);
             if (!bytes.is_empty() || !fds.is_empty()) {
                 ReadonlyBytes remaining = bytes;
                 if (transfer_data(remaining, fds) == TransferState::SocketClosed) {
@@ -259,10 +262,18 @@ static constexpr size_t MAX_UNPROCESSED_BUFFER_SIZE = 128 * MiB;
 // Maximum number of accumulated unprocessed file descriptors before we disconnect the peer
 static constexpr size_t MAX_UNPROCESSED_FDS = 512;
 
+// Payloads that would not fit into the socket buffer are written into shared memory instead. This way they are copied
+// once, rather than being streamed through the socket in chunks and reassembled on the other end.
+static constexpr size_t SHARED_MEMORY_PAYLOAD_THRESHOLD = TransportSocket::SOCKET_BUFFER_SIZE;
+
 struct MessageHeader {
     enum class Type : u8 {
         Payload = 0,
         FileDescriptorAcknowledgement = 1,
+
+        // The payload is the size of a shared memory buffer, which is the last of the message's file descriptors and
+        // contains the actual payload.
+        SharedMemoryPayload = 2,
     };
     Type type { Type::Payload };
     u32 payload_size { 0 };
@@ -271,13 +282,44 @@ struct MessageHeader {
 
 void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<Attachment>& attachments)
 {
-    auto num_fds_to_transfer = attachments.size();
+    if (bytes_to_write.size() >= SHARED_MEMORY_PAYLOAD_THRESHOLD) {
+        auto result = post_message_through_shared_memory(bytes_to_write, attachments);
+        if (!result.is_error())
+            return;
+
+        dbgln("TransportSocket: Failed to send payload through shared memory, sending it through the socket instead: {}", result.error());
+    }
 
     MessageHeader header {
         .type = MessageHeader::Type::Payload,
         .payload_size = static_cast<u32>(bytes_to_write.size()),
-        .fd_count = static_cast<u32>(num_fds_to_transfer),
     };
+    enqueue_message(header, bytes_to_write, attachments);
+}
+
+ErrorOr<void> TransportSocket::post_message_through_shared_memory(ReadonlyBytes payload, Vector<Attachment>& attachments)
+{
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(payload.size()));
+    payload.copy_to({ buffer.data<u8>(), buffer.size() });
+
+    auto fd = TRY(Core::System::dup(buffer.fd()));
+    attachments.append(Attachment::from_fd(fd));
+
+    auto shared_memory_size = static_cast<u32>(payload.size());
+
+    MessageHeader header {
+        .type = MessageHeader::Type::SharedMemoryPayload,
+        .payload_size = sizeof(shared_memory_size),
+    };
+    enqueue_message(header, { &shared_memory_size, sizeof(shared_memory_size) }, attachments);
+
+    return {};
+}
+
+void TransportSocket::enqueue_message(MessageHeader header, ReadonlyBytes payload, Vector<Attachment>& attachments)
+{
+    auto num_fds_to_transfer = attachments.size();
+    header.fd_count = static_cast<u32>(num_fds_to_transfer);
 
     auto raw_fds = Vector<int, 1> {};
     if (num_fds_to_transfer > 0) {
@@ -291,8 +333,10 @@ void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<Atta
         }
     }
 
-    m_send_queue->enqueue_message({ reinterpret_cast<u8 const*>(&header), sizeof(header) }, bytes_to_write, move(raw_fds));
-    wake_io_thread();
+    // OPTIMIZATION: The IO thread keeps writing for as long as the queue is not empty, so it only needs to be woken up
+    //               for the first message in the queue.
+    if (m_send_queue->enqueue_message({ reinterpret_cast<u8 const*>(&header), sizeof(header) }, payload, move(raw_fds)))
+        wake_io_thread();
 }
 
 ErrorOr<void> TransportSocket::send_message(Core::LocalSocket& socket, ReadonlyBytes& bytes_to_write, Vector<int>& unowned_fds)
@@ -344,6 +388,24 @@ TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& byt
     return TransferState::Continue;
 }
 
+static ErrorOr<Core::AnonymousBuffer> map_shared_memory_payload(int fd, size_t size)
+{
+    ArmedScopeGuard close_fd = [&] { (void)Core::System::close(fd); };
+
+    if (size == 0 || size > MAX_MESSAGE_PAYLOAD_SIZE)
+        return Error::from_string_literal("Shared memory payload size is out of bounds");
+
+    // NB: Reading beyond the end of the file through its mapping would crash us, so we make sure that the peer did not
+    //     send a file that is smaller than it claimed.
+    auto stat = TRY(Core::System::fstat(fd));
+    if (stat.st_size < 0 || static_cast<size_t>(stat.st_size) < size)
+        return Error::from_string_literal("Shared memory payload is smaller than its size");
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_from_anon_fd(fd, size));
+    close_fd.disarm();
+    return buffer;
+}
+
 void TransportSocket::read_incoming_messages()
 {
     Vector<NonnullOwnPtr<Message>> batch;
@@ -400,13 +462,20 @@ void TransportSocket::read_incoming_messages()
     while (index + sizeof(MessageHeader) <= m_unprocessed_bytes.size()) {
         MessageHeader header;
         memcpy(&header, m_unprocessed_bytes.data() + index, sizeof(MessageHeader));
-        if (header.type == MessageHeader::Type::Payload) {
+        if (header.type == MessageHeader::Type::Payload || header.type == MessageHeader::Type::SharedMemoryPayload) {
+            auto is_shared_memory_payload = header.type == MessageHeader::Type::SharedMemoryPayload;
+
             if (header.payload_size > MAX_MESSAGE_PAYLOAD_SIZE) {
                 dbgln("TransportSocket: Rejecting message with payload_size {} exceeding limit {}", header.payload_size, MAX_MESSAGE_PAYLOAD_SIZE);
                 m_peer_eof = true;
                 break;
             }
-            if (header.fd_count > MAX_MESSAGE_FD_COUNT) {
+            if (is_shared_memory_payload && (header.payload_size != sizeof(u32) || header.fd_count == 0)) {
+                dbgln("TransportSocket: Rejecting malformed shared memory message with payload_size {} and fd_count {}", header.payload_size, header.fd_count);
+                m_peer_eof = true;
+                break;
+            }
+            if (header.fd_count > MAX_MESSAGE_FD_COUNT + (is_shared_memory_payload ? 1 : 0)) {
                 dbgln("TransportSocket: Rejecting message with fd_count {} exceeding limit {}", header.fd_count, MAX_MESSAGE_FD_COUNT);
                 m_peer_eof = true;
                 break;
@@ -424,9 +493,22 @@ void TransportSocket::read_incoming_messages()
                 m_peer_eof = true;
                 break;
             }
-            for (size_t i = 0; i < header.fd_count; ++i)
+            auto message_fd_count = header.fd_count - (is_shared_memory_payload ? 1 : 0);
+            for (size_t i = 0; i < message_fd_count; ++i)
                 message->attachments.enqueue(m_unprocessed_attachments.dequeue());
-            if (message->bytes.try_append(m_unprocessed_bytes.data() + index + sizeof(MessageHeader), header.payload_size).is_error()) {
+            if (is_shared_memory_payload) {
+                u32 shared_memory_size = 0;
+                memcpy(&shared_memory_size, m_unprocessed_bytes.data() + index + sizeof(MessageHeader), sizeof(shared_memory_size));
+
+                auto shared_memory_fd = m_unprocessed_attachments.dequeue().to_fd();
+                auto shared_memory_payload = map_shared_memory_payload(shared_memory_fd, shared_memory_size);
+                if (shared_memory_payload.is_error()) {
+                    dbgln("TransportSocket: Failed to map shared memory payload of size {}: {}", shared_memory_size, shared_memory_payload.error());
+                    m_peer_eof = true;
+                    break;
+                }
+                message->shared_memory_payload = shared_memory_payload.release_value();
+            } else if (message->bytes.try_append(m_unprocessed_bytes.data() + index + sizeof(MessageHeader), header.payload_size).is_error()) {
                 dbgln("TransportSocket: Failed to allocate message buffer for payload_size {}", header.payload_size);
                 m_peer_eof = true;
                 break;
@@ -9,6 +9,7 @@
 
 #include <AK/MemoryStream.h>
 #include <AK/Queue.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCore/Socket.h>
 #include <LibIPC/Attachment.h>
 #include <LibIPC/AutoCloseFileDescriptor.h>
@@ -18,9 +19,12 @@
 
 namespace IPC {
 
+struct MessageHeader;
+
 class SendQueue : public AtomicRefCounted<SendQueue> {
 public:
-    void enqueue_message(ReadonlyBytes header, ReadonlyBytes payload, Vector<int>&& fds);
+    // Returns whether the queue was empty before the message was added.
+    bool enqueue_message(ReadonlyBytes header, ReadonlyBytes payload, Vector<int>&& fds);
     struct BytesAndFds {
         Vector<u8> bytes;
         Vector<int> fds;
@@ -68,12 +72,20 @@ public:
     struct Message {
         Vector<u8> bytes;
         Queue<Attachment> attachments;
+
+        // Large payloads are received through shared memory rather than through the socket, and are read from it in place.
+        Core::AnonymousBuffer shared_memory_payload;
+
+        ReadonlyBytes payload() const { return shared_memory_payload.is_valid() ? shared_memory_payload.bytes() : bytes.span(); }
     };
     ShouldShutdown read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&&);
 
     ErrorOr<TransportHandle> release_for_transfer();
 
 private:
+    void enqueue_message(MessageHeader, ReadonlyBytes payload, Vector<Attachment>& attachments);
+    ErrorOr<void> post_message_through_shared_memory(ReadonlyBytes payload, Vector<Attachment>& attachments);
+
     enum class TransferState {
         Continue,
         SocketClosed,
@@ -45,6 +45,8 @@ public:
     struct Message {
         Vector<u8> bytes;
         Queue<Attachment> attachments; // always empty, present to avoid OS #ifdefs in Connection.cpp
+
+        ReadonlyBytes payload() const { return bytes; }
     };
     ShouldShutdown read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&&);
 
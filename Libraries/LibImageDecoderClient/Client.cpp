@@ -5,6 +5,8 @@
  */
 
 #include <LibCore/AnonymousBuffer.h>
+#include <LibGfx/ShareableBitmap.h>
+#include <LibGfx/ShareableYUVData.h>
 #include <LibImageDecoderClient/Client.h>
 
 namespace ImageDecoderClient {
@@ -18,12 +20,13 @@ void Client::die()
 {
     verify_event_loop();
     auto pending_promises = move(m_token_promises);
+    m_partial_image_callbacks.clear();
 
     for (auto& promise : pending_promises)
         promise.value->reject(Error::from_string_literal("ImageDecoder disconnected"));
 }
 
-NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, ImageDecoder::DecodePriority priority, bool allow_yuv)
 {
     verify_event_loop();
     auto promise = Core::Promise<DecodedImage>::construct();
@@ -50,11 +53,62 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     i64 request_id = m_next_request_id++;
     m_token_promises.set(request_id, promise);
 
-    async_decode_image(encoded_buffer, ideal_size, mime_type, request_id);
+    async_decode_image(encoded_buffer, ideal_size, mime_type, priority, allow_yuv, request_id);
 
     return promise;
 }
 
+i64 Client::begin_streaming_decode(OnPartialImage on_partial_image, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<ByteString> mime_type, ImageDecoder::DecodePriority priority, bool allow_yuv)
+{
+    verify_event_loop();
+    auto promise = Core::Promise<DecodedImage>::construct();
+    if (on_resolved)
+        promise->on_resolution = move(on_resolved);
+    if (on_rejected)
+        promise->on_rejection = move(on_rejected);
+
+    i64 request_id = m_next_request_id++;
+    m_token_promises.set(request_id, promise);
+    if (on_partial_image)
+        m_partial_image_callbacks.set(request_id, move(on_partial_image));
+
+    async_begin_streaming_decode(request_id, move(mime_type), priority, allow_yuv);
+
+    return request_id;
+}
+
+void Client::append_streaming_decode_data(i64 request_id, ReadonlyBytes encoded_data)
+{
+    verify_event_loop();
+    if (encoded_data.is_empty() || !m_token_promises.contains(request_id))
+        return;
+
+    auto buffer_or_error = ByteBuffer::copy(encoded_data);
+    if (buffer_or_error.is_error()) {
+        cancel_decoding(request_id);
+        if (auto promise = m_token_promises.take(request_id); promise.has_value())
+            promise.value()->reject(buffer_or_error.release_error());
+        return;
+    }
+
+    async_append_streaming_decode_data(request_id, buffer_or_error.release_value());
+}
+
+void Client::finish_streaming_decode(i64 request_id, Optional<Gfx::IntSize> ideal_size)
+{
+    verify_event_loop();
+    if (m_token_promises.contains(request_id))
+        async_finish_streaming_decode(request_id, ideal_size);
+}
+
+void Client::cancel_decoding(i64 request_id)
+{
+    verify_event_loop();
+    m_partial_image_callbacks.remove(request_id);
+    if (m_token_promises.remove(request_id))
+        async_cancel_decoding(request_id);
+}
+
 void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id)
 {
     verify_event_loop();
@@ -62,6 +116,7 @@ void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count,
     VERIFY(!bitmaps.is_empty());
 
     Optional<NonnullRefPtr<Core::Promise<DecodedImage>>> maybe_promise = m_token_promises.take(request_id);
+    m_partial_image_callbacks.remove(request_id);
 
     if (!maybe_promise.has_value()) {
         dbgln("ImageDecoderClient: No pending image with request token {}", request_id);
@@ -98,10 +153,66 @@ void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count,
     promise->resolve(move(image));
 }
 
+// NB: Still images are shared with other clients of the ImageDecoder, so their bitmaps may be read-only.
+void Client::did_decode_still_image(i64 request_id, Gfx::ShareableBitmap bitmap, Gfx::FloatPoint scale, Gfx::ColorSpace color_space)
+{
+    verify_event_loop();
+    Optional<NonnullRefPtr<Core::Promise<DecodedImage>>> maybe_promise = m_token_promises.take(request_id);
+    m_partial_image_callbacks.remove(request_id);
+
+    if (!maybe_promise.has_value()) {
+        dbgln("ImageDecoderClient: No pending image with request token {}", request_id);
+        return;
+    }
+    auto promise = maybe_promise.release_value();
+
+    if (!bitmap.is_valid()) {
+        dbgln("ImageDecoderClient: Invalid bitmap for request {}", request_id);
+        promise->reject(Error::from_string_literal("Invalid bitmap"));
+        return;
+    }
+
+    DecodedImage image;
+    image.scale = scale;
+    image.frame_count = 1;
+    image.color_space = move(color_space);
+    image.frames.empend(*bitmap.bitmap(), 0);
+
+    promise->resolve(move(image));
+}
+
+void Client::did_decode_yuv_image(i64 request_id, Gfx::ShareableYUVData yuv_data, Gfx::FloatPoint scale)
+{
+    verify_event_loop();
+    Optional<NonnullRefPtr<Core::Promise<DecodedImage>>> maybe_promise = m_token_promises.take(request_id);
+    m_partial_image_callbacks.remove(request_id);
+
+    if (!maybe_promise.has_value()) {
+        dbgln("ImageDecoderClient: No pending image with request token {}", request_id);
+        return;
+    }
+    auto promise = maybe_promise.release_value();
+
+    auto yuv_data_or_error = yuv_data.to_yuv_data();
+    if (yuv_data_or_error.is_error()) {
+        dbgln("ImageDecoderClient: Invalid YUV data for request {}: {}", request_id, yuv_data_or_error.error());
+        promise->reject(yuv_data_or_error.release_error());
+        return;
+    }
+
+    DecodedImage image;
+    image.scale = scale;
+    image.frame_count = 1;
+    image.yuv_data = yuv_data_or_error.release_value();
+
+    promise->resolve(move(image));
+}
+
 void Client::did_fail_to_decode_image(i64 request_id, String error_message)
 {
     verify_event_loop();
     Optional<NonnullRefPtr<Core::Promise<DecodedImage>>> maybe_promise = m_token_promises.take(request_id);
+    m_partial_image_callbacks.remove(request_id);
 
     if (!maybe_promise.has_value()) {
         dbgln("ImageDecoderClient: No pending image with request token {}", request_id);
@@ -114,6 +225,30 @@ void Client::did_fail_to_decode_image(i64 request_id, String error_message)
     promise->reject(Error::from_string_literal("Image decoding failed or aborted"));
 }
 
+void Client::did_decode_partial_image(i64 request_id, Gfx::BitmapSequence bitmap_sequence, Gfx::ColorSpace color_space)
+{
+    verify_event_loop();
+    // NB: The callback is taken out of the map while it runs, as it may cancel the request.
+    auto callback = m_partial_image_callbacks.take(request_id);
+    if (!callback.has_value())
+        return;
+
+    DecodedImage image;
+    image.frame_count = 1;
+    image.color_space = move(color_space);
+
+    for (auto& bitmap : bitmap_sequence.bitmaps) {
+        if (bitmap)
+            image.frames.empend(bitmap.release_nonnull(), 0);
+    }
+
+    if (!image.frames.is_empty())
+        (*callback)(image);
+
+    if (m_token_promises.contains(request_id))
+        m_partial_image_callbacks.set(request_id, callback.release_value());
+}
+
 void Client::did_decode_animation_frames(i64 session_id, Gfx::BitmapSequence bitmap_sequence)
 {
     verify_event_loop();
@@ -7,11 +7,13 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <ImageDecoder/DecodePriority.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
+#include <LibGfx/YUVData.h>
 #include <LibIPC/ConnectionToServer.h>
 
 namespace ImageDecoderClient {
@@ -30,6 +32,9 @@ struct DecodedImage {
     Vector<u32> all_durations;
     Gfx::ColorSpace color_space;
     i64 session_id { 0 };
+
+    // Set instead of the frames for still images that were decoded to YUV planes.
+    OwnPtr<Gfx::YUVData> yuv_data;
 };
 
 class Client final
@@ -42,7 +47,18 @@ public:
 
     Client(NonnullOwnPtr<IPC::Transport>);
 
-    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
+    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {}, ImageDecoder::DecodePriority = ImageDecoder::DecodePriority::Normal, bool allow_yuv = false);
+
+    // A streaming decode is fed the encoded data as it arrives. Images decoded from the data so far are passed to the
+    // partial image callback until the final image resolves the promise.
+    //
+    // If YUV is allowed, still images that can be are decoded to YUV planes rather than bitmaps, which have to be drawn
+    // by something that can convert them, such as the GPU. Partial images are always decoded to bitmaps.
+    using OnPartialImage = Function<void(DecodedImage&)>;
+    i64 begin_streaming_decode(OnPartialImage, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<ByteString> mime_type = {}, ImageDecoder::DecodePriority = ImageDecoder::DecodePriority::Normal, bool allow_yuv = false);
+    void append_streaming_decode_data(i64 request_id, ReadonlyBytes);
+    void finish_streaming_decode(i64 request_id, Optional<Gfx::IntSize> ideal_size = {});
+    void cancel_decoding(i64 request_id);
 
     void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count);
     void stop_animation_decode(i64 session_id);
@@ -56,7 +72,10 @@ private:
     virtual void die() override;
 
     virtual void did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id) override;
+    virtual void did_decode_still_image(i64 request_id, Gfx::ShareableBitmap bitmap, Gfx::FloatPoint scale, Gfx::ColorSpace color_space) override;
+    virtual void did_decode_yuv_image(i64 request_id, Gfx::ShareableYUVData yuv_data, Gfx::FloatPoint scale) override;
     virtual void did_fail_to_decode_image(i64 request_id, String error_message) override;
+    virtual void did_decode_partial_image(i64 request_id, Gfx::BitmapSequence bitmap_sequence, Gfx::ColorSpace color_space) override;
 
     virtual void did_decode_animation_frames(i64 session_id, Gfx::BitmapSequence bitmaps) override;
     virtual void did_fail_animation_decode(i64 session_id, String error_message) override;
@@ -64,6 +83,7 @@ private:
     Core::EventLoop* m_creation_event_loop { &Core::EventLoop::current() };
     i64 m_next_request_id { 0 };
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_token_promises;
+    HashMap<i64, OnPartialImage> m_partial_image_callbacks;
 };
 
 }
@@ -9,6 +9,7 @@
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/PropertyAccess.h>
+#include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/ModuleEnvironment.h>
@@ -143,6 +144,7 @@ template<typename InsnType>
 static i64 execute_throwing(Interpreter& interp, u32 pc)
 {
     interp.running_execution_context().program_counter = pc;
+    interp.vm().profiler_safe_point();
     auto* bytecode = interp.current_executable().bytecode.data();
     auto& insn = *reinterpret_cast<InsnType const*>(&bytecode[pc]);
     auto result = insn.execute_impl(interp);
@@ -159,6 +161,7 @@ template<typename InsnType>
 static i64 execute_nonthrowing(Interpreter& interp, u32 pc)
 {
     interp.running_execution_context().program_counter = pc;
+    interp.vm().profiler_safe_point();
     auto* bytecode = interp.current_executable().bytecode.data();
     auto& insn = *reinterpret_cast<InsnType const*>(&bytecode[pc]);
     insn.execute_impl(interp);
@@ -229,6 +232,7 @@ i64 asm_slow_path_jump_strictly_inequals(Interpreter*, u32 pc);
 i64 asm_slow_path_set_lexical_environment(Interpreter*, u32 pc);
 i64 asm_slow_path_postfix_increment(Interpreter*, u32 pc);
 i64 asm_slow_path_get_by_id(Interpreter*, u32 pc);
+i64 asm_slow_path_get_by_id_cached_accessor(Interpreter*, u32 pc);
 i64 asm_slow_path_put_by_id(Interpreter*, u32 pc);
 i64 asm_slow_path_get_by_value(Interpreter*, u32 pc);
 i64 asm_slow_path_get_length(Interpreter*, u32 pc);
@@ -278,6 +282,7 @@ i64 asm_slow_path_loosely_equals(Interpreter*, u32 pc);
 i64 asm_slow_path_loosely_inequals(Interpreter*, u32 pc);
 i64 asm_slow_path_get_callee_and_this(Interpreter*, u32 pc);
 i64 asm_try_put_by_value_typed_array(Interpreter*, u32 pc);
+i64 asm_try_put_by_value_array_element(Interpreter*, u32 pc);
 i64 asm_slow_path_get_private_by_id(Interpreter*, u32 pc);
 i64 asm_slow_path_put_private_by_id(Interpreter*, u32 pc);
 i64 asm_slow_path_instance_of(Interpreter*, u32 pc);
@@ -615,6 +620,34 @@ i64 asm_slow_path_get_by_id(Interpreter* interp, u32 pc)
     return slow_path_throwing<Op::GetById>(*interp, pc);
 }
 
+// Called by the GetById handler when the first cache entry matched, but the cached property is an accessor. The handler
+// has already validated the cache entry, so we can call the getter right away, instead of going through the full
+// property lookup again. This is the common case for IDL attributes on interface prototypes, e.g. node.firstChild.
+i64 asm_slow_path_get_by_id_cached_accessor(Interpreter* interp, u32 pc)
+{
+    bump_slow_path(*interp, pc);
+    interp->running_execution_context().program_counter = pc;
+    interp->vm().profiler_safe_point();
+
+    auto* bytecode = interp->current_executable().bytecode.data();
+    auto& insn = *reinterpret_cast<Op::GetById const*>(&bytecode[pc]);
+    auto base = interp->get(insn.base());
+    auto& cache = *bit_cast<PropertyLookupCache*>(insn.cache());
+    auto& entry = cache.entries[0];
+    cache.statistics.record_hit();
+
+    auto* holder = entry.prototype ? entry.prototype.ptr() : &base.as_object();
+    auto value = holder->get_direct(entry.property_offset);
+    VERIFY(value.is_accessor());
+
+    auto result = call_cached_getter(interp->vm(), value.as_accessor(), base);
+    if (result.is_error()) [[unlikely]]
+        return handle_asm_exception(*interp, pc, result.error_value());
+
+    interp->set(insn.dst(), result.release_value());
+    return static_cast<i64>(pc + sizeof(Op::GetById));
+}
+
 i64 asm_slow_path_put_by_id(Interpreter* interp, u32 pc)
 {
     return slow_path_throwing<Op::PutById>(*interp, pc);
@@ -1066,6 +1099,25 @@ i64 asm_try_get_by_value_typed_array(Interpreter* interp, u32 pc)
     return 0;
 }
 
+// Fast path for PutByValue on holes and appends in Packed/Holey arrays.
+// Returns 0 on success, 1 on miss (fall to slow path).
+i64 asm_try_put_by_value_array_element(Interpreter* interp, u32 pc)
+{
+    auto* bytecode = interp->current_executable().bytecode.data();
+    auto& insn = *reinterpret_cast<Op::PutByValue const*>(&bytecode[pc]);
+
+    auto base = interp->get(insn.base());
+    auto property = interp->get(insn.property());
+    if (!base.is_object() || !property.is_non_negative_int32()) [[unlikely]]
+        return 1;
+
+    auto* array = as_if<Array>(base.as_object());
+    if (!array)
+        return 1;
+
+    return array->try_fast_put_indexed_element(static_cast<u32>(property.as_i32()), interp->get(insn.src())) ? 0 : 1;
+}
+
 // Fast path for PutByValue on typed arrays.
 // Returns 0 on success, 1 on miss (fall to slow path).
 i64 asm_try_put_by_value_typed_array(Interpreter* interp, u32 pc)
@@ -1369,23 +1369,31 @@ handler PutByValue
     branch_ne t0, INDEXED_STORAGE_KIND_PACKED, .not_packed
     # Check index vs array_like_size
     load32 t5, [t3, OBJECT_INDEXED_ARRAY_LIKE_SIZE]
-    branch_ge_unsigned t4, t5, .slow
+    branch_ge_unsigned t4, t5, .try_array_element
     load64 t5, [t3, OBJECT_INDEXED_ELEMENTS]
     load_operand t1, m_src
     store64 [t5, t4, 8], t1
     dispatch_next
 .not_packed:
+    # Arrays without any elements yet start out by appending.
+    branch_eq t0, INDEXED_STORAGE_KIND_NONE, .try_array_element
     branch_ne t0, INDEXED_STORAGE_KIND_HOLEY, .slow
     # Holey arrays need a slot load to distinguish existing elements from holes.
     load32 t5, [t3, OBJECT_INDEXED_ARRAY_LIKE_SIZE]
-    branch_ge_unsigned t4, t5, .slow
+    branch_ge_unsigned t4, t5, .try_array_element
     load64 t5, [t3, OBJECT_INDEXED_ELEMENTS]
     load64 t1, [t5, t4, 8]
     mov t0, EMPTY_TAG_SHIFTED
-    branch_eq t1, t0, .slow
+    branch_eq t1, t0, .try_array_element
     load_operand t1, m_src
     store64 [t5, t4, 8], t1
     dispatch_next
+.try_array_element:
+    # Appends and hole fills on arrays stay out of the generic [[Set]]
+    # path as long as nothing on the prototype chain can observe them.
+    call_interp asm_try_put_by_value_array_element
+    branch_nonzero t0, .slow
+    dispatch_next
 .try_typed_array:
     # t3 = Object*, t4 = index (u32, non-negative)
     # Load cached data pointer (pre-computed: buffer.data() + byte_offset)
@@ -1505,7 +1513,7 @@ handler GetById
     load64 t0, [t5, t0, 8]
     # Check value is not an accessor
     extract_tag t2, t0
-    branch_eq t2, ACCESSOR_TAG, .try_cache
+    branch_eq t2, ACCESSOR_TAG, .cached_accessor
     store_operand m_dst, t0
     dispatch_next
 .proto:
@@ -1525,9 +1533,12 @@ handler GetById
     load64 t0, [t2, t1, 8]
     # Check value is not an accessor
     extract_tag t2, t0
-    branch_eq t2, ACCESSOR_TAG, .try_cache
+    branch_eq t2, ACCESSOR_TAG, .cached_accessor
     store_operand m_dst, t0
     dispatch_next
+.cached_accessor:
+    # entry[0] is valid and holds an accessor, e.g. an IDL attribute: call its getter
+    call_slow_path asm_slow_path_get_by_id_cached_accessor
 .try_cache:
     # Try all cache entries via C++ helper
     call_interp asm_try_get_by_id_cache
@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/BinarySearch.h>
+#include <LibGC/Heap.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/FormatOperand.h>
@@ -20,6 +22,8 @@ namespace JS::Bytecode {
 
 GC_DEFINE_ALLOCATOR(Executable);
 
+bool g_collect_inline_cache_statistics = false;
+
 Executable::Executable(
     Vector<u8> bytecode,
     NonnullOwnPtr<IdentifierTable> identifier_table,
@@ -233,6 +237,80 @@ String Executable::dump_to_string() const
     return output.to_string_without_validation();
 }
 
+static StringView inline_cache_state(PropertyLookupCache const& cache)
+{
+    if (cache.is_megamorphic)
+        return "megamorphic"sv;
+    size_t number_of_shapes = 0;
+    for (auto const& entry : cache.entries) {
+        if (entry.shape)
+            ++number_of_shapes;
+    }
+    if (number_of_shapes == 0)
+        return "uninitialized"sv;
+    if (number_of_shapes == 1)
+        return "monomorphic"sv;
+    return "polymorphic"sv;
+}
+
+template<typename CacheType>
+static CacheType const* find_cache(Vector<CacheType> const& caches, void const* cache)
+{
+    for (auto const& candidate : caches) {
+        if (&candidate == cache)
+            return &candidate;
+    }
+    return nullptr;
+}
+
+void Executable::dump_inline_cache_statistics() const
+{
+    auto const cyan = "\033[36;1m"sv;
+    auto const reset = "\033[0m"sv;
+
+    StringBuilder output;
+    dump_header(output, *this, true);
+    output.append('\n');
+
+    auto append_statistics = [&](StringView kind, StringView state, InlineCacheStatistics const& statistics) {
+        output.appendff("  {}; {} {}, hits: {}, misses: {}{}", cyan, kind, state, statistics.hits, statistics.misses, reset);
+    };
+
+    for (InstructionStreamIterator it(bytecode, this); !it.at_end(); ++it) {
+        output.appendff("  [{:4x}] {}", it.offset(), (*it).to_byte_string(*this));
+        if (auto const* cache = instruction_cache(*it)) {
+            if (auto const* global_variable_cache = find_cache(global_variable_caches, cache)) {
+                auto state = global_variable_cache->has_environment_binding_index ? "environment-binding"sv : inline_cache_state(*global_variable_cache);
+                append_statistics("global"sv, state, global_variable_cache->statistics);
+            } else if (auto const* property_lookup_cache = find_cache(property_lookup_caches, cache)) {
+                append_statistics("property"sv, inline_cache_state(*property_lookup_cache), property_lookup_cache->statistics);
+            } else if (auto const* object_shape_cache = find_cache(object_shape_caches, cache)) {
+                append_statistics("shape"sv, object_shape_cache->shape ? "monomorphic"sv : "uninitialized"sv, object_shape_cache->statistics);
+            }
+        }
+        output.append('\n');
+    }
+
+    warnln("{}", output.string_view());
+}
+
+void dump_inline_cache_statistics(GC::Heap& heap)
+{
+    auto has_recorded_statistics = [](Executable const& executable) {
+        auto has_activity = [](auto const& caches) {
+            return any_of(caches, [](auto const& cache) { return cache.statistics.hits != 0 || cache.statistics.misses != 0; });
+        };
+        return has_activity(executable.property_lookup_caches)
+            || has_activity(executable.global_variable_caches)
+            || has_activity(executable.object_shape_caches);
+    };
+
+    heap.for_each_live_cell([&](GC::Cell* cell) {
+        if (auto const* executable = as_if<Executable>(*cell); executable && has_recorded_statistics(*executable))
+            executable->dump_inline_cache_statistics();
+    });
+}
+
 void Executable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/NonnullOwnPtr.h>
+#include <AK/NumericLimits.h>
 #include <AK/OwnPtr.h>
 #include <AK/String.h>
 #include <AK/Utf16FlyString.h>
@@ -28,6 +29,26 @@
 
 namespace JS::Bytecode {
 
+JS_API extern bool g_collect_inline_cache_statistics;
+
+// Hit and miss counters for a single inline cache.
+// These are only updated while g_collect_inline_cache_statistics is set.
+struct InlineCacheStatistics {
+    u32 hits { 0 };
+    u32 misses { 0 };
+
+    ALWAYS_INLINE void record_hit()
+    {
+        if (g_collect_inline_cache_statistics) [[unlikely]]
+            ++hits;
+    }
+    ALWAYS_INLINE void record_miss()
+    {
+        if (g_collect_inline_cache_statistics) [[unlikely]]
+            ++misses;
+    }
+};
+
 // Represents one polymorphic inline cache used for property lookups.
 struct PropertyLookupCache {
     static constexpr size_t max_number_of_shapes_to_remember = 4;
@@ -48,8 +69,22 @@ struct PropertyLookupCache {
         GC::RawPtr<PrototypeChainValidity> prototype_chain_validity;
     };
 
+    // After this many entries have been pushed out of a full cache, the access site is considered
+    // megamorphic and own property lookups go through the VM-wide MegamorphicPropertyCache instead.
+    static constexpr u8 evictions_until_megamorphic = 4;
+
+    void did_evict_entry()
+    {
+        if (is_megamorphic)
+            return;
+        if (++eviction_count >= evictions_until_megamorphic)
+            is_megamorphic = true;
+    }
+
     void update(Entry::Type type, auto callback)
     {
+        if (types[entries.size() - 1] != Entry::Type::Empty)
+            did_evict_entry();
         // First, move all entries one step back.
         for (size_t i = entries.size() - 1; i >= 1; --i) {
             types[i] = types[i - 1];
@@ -62,6 +97,9 @@ struct PropertyLookupCache {
 
     AK::Array<Entry::Type, max_number_of_shapes_to_remember> types;
     AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+    u8 eviction_count { 0 };
+    bool is_megamorphic { false };
+    InlineCacheStatistics statistics;
 };
 
 // A PropertyLookupCache for use as a static local variable.
@@ -93,6 +131,7 @@ struct TemplateObjectCache {
 struct ObjectShapeCache {
     GC::RawPtr<Shape> shape;
     Vector<u32> property_offsets;
+    InlineCacheStatistics statistics;
 };
 
 struct SourceRecord {
@@ -148,6 +187,19 @@ public:
     u32 number_of_registers { 0 };
     bool is_strict_mode { false };
 
+    // Number of times this executable has been entered, either through run_executable()
+    // or as an inline frame. This is the tier-up signal for anything that wants to spend
+    // extra effort on hot code; it saturates instead of wrapping around.
+    static constexpr u32 hot_invocation_threshold = 1000;
+    u32 invocation_count { 0 };
+
+    ALWAYS_INLINE void did_invoke()
+    {
+        if (invocation_count != NumericLimits<u32>::max()) [[likely]]
+            ++invocation_count;
+    }
+    [[nodiscard]] bool is_hot() const { return invocation_count >= hot_invocation_threshold; }
+
     u32 registers_and_locals_count { 0 };
     u32 registers_and_locals_and_constants_count { 0 };
 
@@ -190,6 +242,9 @@ public:
     void dump() const;
     [[nodiscard]] String dump_to_string() const;
 
+    // Prints the bytecode together with the state and hit/miss counters of each inline cache.
+    void dump_inline_cache_statistics() const;
+
     [[nodiscard]] Operand original_operand_from_raw(u32) const;
 
     virtual void remove_dead_cells(Badge<GC::Heap>) override;
@@ -200,4 +255,7 @@ private:
     HashMap<u32, SourceRange> m_source_range_cache;
 };
 
+// Dumps inline cache statistics for every live executable that has recorded any.
+JS_API void dump_inline_cache_statistics(GC::Heap&);
+
 }
@@ -21,6 +21,7 @@
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayIterator.h>
 #include <LibJS/Runtime/AsyncFromSyncIterator.h>
 #include <LibJS/Runtime/AsyncFromSyncIteratorPrototype.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -308,6 +309,7 @@ ExecutionContext* Interpreter::push_inline_frame(
     //     and global_declarative_environment, since the caller's realm may differ
     //     in cross-realm calls (e.g. iframe <-> parent).
     callee_context->executable = callee_executable;
+    callee_executable.did_invoke();
 
     // Copy constants (memcpy avoids aliasing issues with the scalar loop).
     auto* values = callee_context->registers_and_constants_and_locals_and_arguments();
@@ -431,7 +433,9 @@ void Interpreter::run_bytecode(size_t entry_point)
         return env && env[0] == '1';
     }();
 
-    if (!use_cpp_interpreter && AsmInterpreter::is_available()) {
+    // NB: The assembly interpreter handles inline cache hits without going through the
+    //     counters, so we stick to the C++ interpreter while collecting statistics.
+    if (!use_cpp_interpreter && !g_collect_inline_cache_statistics && AsmInterpreter::is_available()) {
         AsmInterpreter::run(*this, entry_point);
         return;
     }
@@ -516,6 +520,8 @@ void Interpreter::run_bytecode(size_t entry_point)
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
             program_counter = instruction.target().address();
+            // NB: Loops end with an unconditional jump back to their start, so this keeps hot loops visible to the profiler.
+            vm().profiler_safe_point();
             goto start;
         }
 
@@ -831,6 +837,7 @@ ThrowCompletionOr<Value> Interpreter::run_executable(ExecutionContext& context,
     TemporaryChange restore_running_execution_context { m_running_execution_context, &context };
 
     context.executable = executable;
+    executable.did_invoke();
 
     VERIFY(executable.registers_and_locals_count + executable.constants.size() == executable.registers_and_locals_and_constants_count);
     VERIFY(executable.registers_and_locals_and_constants_count <= context.registers_and_constants_and_locals_and_arguments_span().size());
@@ -1038,6 +1045,7 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         // OPTIMIZATION: For global var bindings, if the shape of the global object hasn't changed,
         //               we can use the cached property offset.
         if (&shape == cache.entries[0].shape && (!shape.is_dictionary() || shape.dictionary_generation() == cache.entries[0].shape_dictionary_generation)) {
+            cache.statistics.record_hit();
             auto value = binding_object.get_direct(cache.entries[0].property_offset);
             if (value.is_accessor())
                 return TRY(call(vm, value.as_accessor().getter(), &binding_object));
@@ -1047,6 +1055,7 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         // OPTIMIZATION: For global lexical bindings, if the global declarative environment hasn't changed,
         //               we can use the cached environment binding index.
         if (cache.has_environment_binding_index) {
+            cache.statistics.record_hit();
             if (cache.in_module_environment) {
                 auto module = vm.running_execution_context().script_or_module.get_pointer<GC::Ref<Module>>();
                 return (*module)->environment()->get_binding_value_direct(vm, cache.environment_binding_index);
@@ -1055,6 +1064,7 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         }
     }
 
+    cache.statistics.record_miss();
     cache.environment_serial_number = declarative_record.environment_serial_number();
 
     auto& identifier = interpreter.get_identifier(identifier_index);
@@ -1176,6 +1186,10 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Utf16Fl
             }
         }
 
+        // For holes and appends in arrays:
+        if (auto* array = as_if<Array>(object); array && array->try_fast_put_indexed_element(index, value))
+            return {};
+
         // For typed arrays:
         if (object.is_typed_array()) {
             auto& typed_array = static_cast<TypedArrayBase&>(object);
@@ -1371,6 +1385,15 @@ inline ThrowCompletionOr<GC::Ref<Array>> iterator_to_array(VM& vm, Value iterato
 {
     auto& iterator_record = static_cast<IteratorRecord&>(iterator.as_cell());
 
+    // OPTIMIZATION: Collecting the rest of a packed array from its built-in iterator runs no user code.
+    if (auto* array_iterator = as_if<ArrayIterator>(iterator_object); array_iterator && !iterator_done_property
+        && array_iterator->as_builtin_iterator_if_next_is_not_redefined(iterator_next_method)) {
+        if (auto array = array_iterator->take_remaining_values_of_packed_array(*vm.current_realm())) {
+            interpreter.set(dst(), array);
+            return {};
+        }
+    }
+
     auto array = MUST(Array::create(*vm.current_realm(), 0));
     size_t index = 0;
 
@@ -1384,6 +1407,22 @@ inline ThrowCompletionOr<GC::Ref<Array>> iterator_to_array(VM& vm, Value iterato
     }
 }
 
+// Whether iterating the array with its @@iterator method is known to just produce each of its elements, so that
+// no iterator object needs to be created.
+static bool can_iterate_without_iterator(VM& vm, Array const& array)
+{
+    if (!array.is_simple_packed_array() || !array.default_prototype_chain_intact())
+        return false;
+
+    auto& intrinsics = vm.current_realm()->intrinsics();
+    auto iterator_method = array.get_without_side_effects(vm.well_known_symbol_iterator());
+    if (!iterator_method.is_object() || &iterator_method.as_object() != intrinsics.array_prototype_values_function().ptr())
+        return false;
+
+    auto next_method = intrinsics.array_iterator_prototype()->get_without_side_effects(vm.names.next);
+    return next_method.is_function() && next_method.as_function().is_array_prototype_next_builtin();
+}
+
 inline ThrowCompletionOr<void> append(VM& vm, Value lhs, Value rhs, bool is_spread)
 {
     // Note: This OpCode is used to construct array literals and argument arrays for calls,
@@ -1426,6 +1465,17 @@ inline ThrowCompletionOr<void> append(VM& vm, Value lhs, Value rhs, bool is_spre
     auto& lhs_array = lhs.as_array();
     auto lhs_size = lhs_array.indexed_array_like_size();
 
+    // OPTIMIZATION: Spreading a packed array through the built-in array iterator can't run any user code,
+    //               so append its elements directly instead of allocating an iterator and stepping through it.
+    if (is_spread && rhs.is_object()) {
+        if (auto* rhs_array = as_if<Array>(rhs.as_object()); rhs_array && can_iterate_without_iterator(vm, *rhs_array)) {
+            size_t i = lhs_size;
+            for (auto value : rhs_array->indexed_packed_elements_span())
+                lhs_array.indexed_put(i++, value);
+            return {};
+        }
+    }
+
     if (is_spread) {
         // ...rhs
         size_t i = lhs_size;
@@ -1453,17 +1503,19 @@ public:
     BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(Value) override { return this; }
     ThrowCompletionOr<void> next(VM& vm, bool& done, Value& value) override
     {
+        auto properties = m_properties->keys();
         while (true) {
-            if (m_iterator == m_properties.end()) {
+            if (m_index == properties.size()) {
                 done = true;
                 return {};
             }
 
-            auto const& entry = *m_iterator;
-            ScopeGuard remove_first = [&] { ++m_iterator; };
+            auto const& entry = properties[m_index++];
 
             // If the property is deleted, don't include it (invariant no. 2)
-            if (!TRY(m_object->has_property(entry)))
+            // OPTIMIZATION: If the key list came from the for-in cache and neither the object's shape nor its prototype
+            //               chain has changed since, every key is still present.
+            if (!keys_are_known_to_exist() && !TRY(m_object->has_property(entry)))
                 continue;
 
             done = false;
@@ -1473,29 +1525,62 @@ public:
     }
 
 private:
-    PropertyNameIterator(JS::Realm& realm, GC::Ref<Object> object, Vector<PropertyKey> properties)
+    PropertyNameIterator(JS::Realm& realm, GC::Ref<Object> object, NonnullRefPtr<PropertyNameList const> properties, GC::Ptr<PrototypeChainValidity> prototype_chain_validity)
         : Object(realm, nullptr)
         , m_object(object)
         , m_properties(move(properties))
-        , m_iterator(m_properties.begin())
+        , m_prototype_chain_validity(prototype_chain_validity)
     {
+        if (m_prototype_chain_validity)
+            m_shape = &object->shape();
+    }
+
+    bool keys_are_known_to_exist() const
+    {
+        return m_shape
+            && &m_object->shape() == m_shape
+            && m_prototype_chain_validity->is_valid();
     }
 
     virtual void visit_edges(Visitor& visitor) override
     {
         Base::visit_edges(visitor);
         visitor.visit(m_object);
-        for (auto& key : m_properties)
-            key.visit_edges(visitor);
-        if (!m_iterator.is_end())
-            m_iterator->visit_edges(visitor);
+        m_properties->visit_edges(visitor);
+        visitor.visit(m_shape);
+        visitor.visit(m_prototype_chain_validity);
     }
 
     GC::Ref<Object> m_object;
-    Vector<PropertyKey> m_properties;
-    decltype(m_properties.begin()) m_iterator;
+    NonnullRefPtr<PropertyNameList const> m_properties;
+    size_t m_index { 0 };
+    GC::Ptr<Shape> m_shape;
+    GC::Ptr<PrototypeChainValidity> m_prototype_chain_validity;
 };
 
+// Returns the validity of the object's prototype chain if the for-in key list of the object may be cached (see ForInCache).
+static GC::Ptr<PrototypeChainValidity> cacheable_for_in_prototype_chain_validity(Object& object)
+{
+    auto& shape = object.shape();
+    if (shape.is_dictionary() || !object.eligible_for_own_property_enumeration_fast_path() || object.indexed_real_size() != 0)
+        return nullptr;
+
+    auto* prototype = shape.prototype();
+    if (!prototype)
+        return nullptr;
+    auto validity = prototype->shape().prototype_chain_validity();
+    if (!validity || !validity->is_valid())
+        return nullptr;
+
+    // NB: Indexed properties don't live in the shape, so adding one to a prototype doesn't invalidate the prototype
+    //     chain. We have to check for those every time.
+    for (; prototype; prototype = prototype->shape().prototype()) {
+        if (prototype->is_proxy_object() || !prototype->eligible_for_own_property_enumeration_fast_path() || prototype->indexed_real_size() != 0)
+            return nullptr;
+    }
+    return validity;
+}
+
 GC_DEFINE_ALLOCATOR(PropertyNameIterator);
 
 // 14.7.5.9 EnumerateObjectProperties ( O ), https://tc39.es/ecma262/#sec-enumerate-object-properties
@@ -1514,9 +1599,21 @@ inline ThrowCompletionOr<IteratorRecordImpl> get_object_property_iterator(Interp
     //    9- Property attributes of the target object must be obtained by calling its [[GetOwnProperty]] internal method
 
     auto& vm = interpreter.vm();
+    auto& realm = interpreter.realm();
 
     // Invariant 3 effectively allows the implementation to ignore newly added keys, and we do so (similar to other implementations).
     auto object = TRY(value.to_object(vm));
+
+    // OPTIMIZATION: Objects with the same shape and an unchanged prototype chain enumerate the same keys.
+    auto prototype_chain_validity = cacheable_for_in_prototype_chain_validity(object);
+    if (prototype_chain_validity) {
+        auto& entry = realm.for_in_cache().entry_for(object->shape());
+        if (entry.shape == &object->shape() && entry.prototype_chain_validity == prototype_chain_validity) {
+            auto iterator = realm.create<PropertyNameIterator>(realm, object, *entry.property_names, prototype_chain_validity);
+            return IteratorRecordImpl { .done = false, .iterator = iterator, .next_method = js_undefined() };
+        }
+    }
+
     // Note: While the spec doesn't explicitly require these to be ordered, it says that the values should be retrieved via OwnPropertyKeys,
     //       so we just keep the order consistent anyway.
 
@@ -1565,7 +1662,16 @@ inline ThrowCompletionOr<IteratorRecordImpl> get_object_property_iterator(Interp
         in_prototype_chain = true;
     }
 
-    auto iterator = interpreter.realm().create<PropertyNameIterator>(interpreter.realm(), object, move(properties));
+    auto property_names = adopt_ref(*new PropertyNameList(move(properties)));
+
+    if (prototype_chain_validity) {
+        auto& entry = realm.for_in_cache().entry_for(object->shape());
+        entry.shape = object->shape();
+        entry.prototype_chain_validity = prototype_chain_validity;
+        entry.property_names = property_names;
+    }
+
+    auto iterator = realm.create<PropertyNameIterator>(realm, object, move(property_names), prototype_chain_validity);
     return IteratorRecordImpl { .done = false, .iterator = iterator, .next_method = js_undefined() };
 }
 
@@ -2049,6 +2155,15 @@ ThrowCompletionOr<void> IteratorToArray::execute_impl(Bytecode::Interpreter& int
     auto iterator_done_property = interpreter.get(m_iterator_done_property).as_bool();
     IteratorRecordImpl iterator_record { .done = iterator_done_property, .iterator = iterator_object, .next_method = iterator_next_method };
 
+    // OPTIMIZATION: Collecting the rest of a packed array from its built-in iterator runs no user code.
+    if (auto* array_iterator = as_if<ArrayIterator>(iterator_object); array_iterator && !iterator_done_property
+        && array_iterator->as_builtin_iterator_if_next_is_not_redefined(iterator_next_method)) {
+        if (auto array = array_iterator->take_remaining_values_of_packed_array(*vm.current_realm())) {
+            interpreter.set(dst(), array);
+            return {};
+        }
+    }
+
     auto array = MUST(Array::create(*vm.current_realm(), 0));
     size_t index = 0;
 
@@ -2073,10 +2188,14 @@ void NewObject::execute_impl(Bytecode::Interpreter& interpreter) const
     if (m_cache) {
         auto& cache = *bit_cast<ObjectShapeCache*>(m_cache);
         auto cached_shape = cache.shape.ptr();
-        if (cached_shape) {
+        // NB: Executables can be shared between realms (see CompiledScriptCache), and the cached shape's
+        //     prototype belongs to the realm that created it.
+        if (cached_shape && &cached_shape->realm() == &realm) {
+            cache.statistics.record_hit();
             interpreter.set(dst(), Object::create_with_premade_shape(*cached_shape));
             return;
         }
+        cache.statistics.record_miss();
     }
 
     interpreter.set(dst(), Object::create(realm, realm.intrinsics().object_prototype()));
@@ -2125,9 +2244,11 @@ void InitObjectLiteralProperty::execute_impl(Bytecode::Interpreter& interpreter)
     // Fast path: if we have a cached shape and it matches, write directly to the cached offset
     auto cached_shape = cache.shape.ptr();
     if (cached_shape && &object.shape() == cached_shape && m_property_slot < cache.property_offsets.size()) {
+        cache.statistics.record_hit();
         object.put_direct(cache.property_offsets[m_property_slot], value);
         return;
     }
+    cache.statistics.record_miss();
 
     auto const& property_key = interpreter.current_executable().get_property_key(m_property);
     init_object_literal_property_slow(object, property_key, value, cache, m_property_slot);
@@ -2267,6 +2388,7 @@ ThrowCompletionOr<void> SetGlobal::execute_impl(Bytecode::Interpreter& interpret
         // OPTIMIZATION: For global var bindings, if the shape of the global object hasn't changed,
         //               we can use the cached property offset.
         if (&shape == cache.entries[0].shape && (!shape.is_dictionary() || shape.dictionary_generation() == cache.entries[0].shape_dictionary_generation)) {
+            cache.statistics.record_hit();
             auto value = binding_object.get_direct(cache.entries[0].property_offset);
             if (value.is_accessor())
                 TRY(call(vm, value.as_accessor().setter(), &binding_object, src));
@@ -2278,6 +2400,7 @@ ThrowCompletionOr<void> SetGlobal::execute_impl(Bytecode::Interpreter& interpret
         // OPTIMIZATION: For global lexical bindings, if the global declarative environment hasn't changed,
         //               we can use the cached environment binding index.
         if (cache.has_environment_binding_index) {
+            cache.statistics.record_hit();
             if (cache.in_module_environment) {
                 auto module = vm.running_execution_context().script_or_module.get_pointer<GC::Ref<Module>>();
                 TRY((*module)->environment()->set_mutable_binding_direct(vm, cache.environment_binding_index, src, strict() == Strict::Yes));
@@ -2288,6 +2411,7 @@ ThrowCompletionOr<void> SetGlobal::execute_impl(Bytecode::Interpreter& interpret
         }
     }
 
+    cache.statistics.record_miss();
     cache.environment_serial_number = declarative_record.environment_serial_number();
 
     auto& identifier = interpreter.get_identifier(m_identifier);
@@ -2709,6 +2833,7 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
     case Builtin::MapIteratorPrototypeNext:
     case Builtin::SetIteratorPrototypeNext:
     case Builtin::StringIteratorPrototypeNext:
+    case Builtin::ArrayPrototypePush:
         VERIFY_NOT_REACHED();
     case Builtin::OrdinaryHasInstance:
         VERIFY_NOT_REACHED();
@@ -2767,9 +2892,67 @@ NEVER_INLINE static ThrowCompletionOr<void> execute_call(
     return {};
 }
 
+// OPTIMIZATION: Many call sites the code generator can't turn into CallBuiltin still call a known builtin every time,
+//               e.g. array.push(x) or a Math function stored in a local. Dispatch those directly, without setting up
+//               an execution context for the native function. Returns an empty Optional if the generic call is needed.
+static ThrowCompletionOr<Optional<Value>> try_call_builtin_directly(Bytecode::Interpreter& interpreter, FunctionObject& function, Value this_value, ReadonlySpan<Operand> arguments)
+{
+    auto builtin = function.builtin();
+    if (!builtin.has_value())
+        return Optional<Value> {};
+
+    // NB: The direct paths run in the caller's realm, so builtins from other realms take the generic path.
+    if (function.realm() != &interpreter.realm())
+        return Optional<Value> {};
+
+    switch (*builtin) {
+    case Builtin::MathAbs:
+    case Builtin::MathLog:
+    case Builtin::MathPow:
+    case Builtin::MathExp:
+    case Builtin::MathCeil:
+    case Builtin::MathFloor:
+    case Builtin::MathImul:
+    case Builtin::MathRandom:
+    case Builtin::MathRound:
+    case Builtin::MathSqrt:
+    case Builtin::MathSin:
+    case Builtin::MathCos:
+    case Builtin::MathTan:
+        if (arguments.size() != builtin_argument_count(*builtin))
+            return Optional<Value> {};
+        return TRY(dispatch_builtin_call(interpreter, *builtin, arguments));
+    case Builtin::ArrayPrototypePush: {
+        // Same conditions as the fast path in ArrayPrototype::push().
+        auto* array = this_value.is_object() ? as_if<Array>(this_value.as_object()) : nullptr;
+        if (!array || !array->is_simple_packed_array()
+            || !array->default_prototype_chain_intact()
+            || !array->extensible()
+            || !array->length_is_writable())
+            return Optional<Value> {};
+        for (auto const& argument : arguments)
+            array->indexed_append(interpreter.get(argument));
+        return Value(array->indexed_array_like_size());
+    }
+    default:
+        return Optional<Value> {};
+    }
+}
+
 ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) const
 {
-    return execute_call<CallType::Call>(interpreter, interpreter.get(m_callee), interpreter.get(m_this_value), { m_arguments, m_argument_count }, m_dst, m_expression_string, strict());
+    auto callee = interpreter.get(m_callee);
+    auto this_value = interpreter.get(m_this_value);
+    ReadonlySpan<Operand> arguments { m_arguments, m_argument_count };
+
+    if (callee.is_function()) [[likely]] {
+        if (auto result = TRY(try_call_builtin_directly(interpreter, callee.as_function(), this_value, arguments)); result.has_value()) {
+            interpreter.set(dst(), *result);
+            return {};
+        }
+    }
+
+    return execute_call<CallType::Call>(interpreter, callee, this_value, arguments, m_dst, m_expression_string, strict());
 }
 
 NEVER_INLINE ThrowCompletionOr<void> CallConstruct::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/MegamorphicPropertyCache.h>
+#include <LibJS/Runtime/Shape.h>
+
+namespace JS::Bytecode {
+
+void MegamorphicPropertyCache::remove_dead_entries()
+{
+    for (auto& entry : m_entries) {
+        if (!entry.shape)
+            continue;
+        bool is_dead = entry.shape->state() != Cell::State::Live;
+        if (!is_dead && entry.key->is_symbol())
+            is_dead = entry.key->as_symbol()->state() != Cell::State::Live;
+        if (is_dead)
+            entry = {};
+    }
+}
+
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashFunctions.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/PropertyKey.h>
+
+namespace JS::Bytecode {
+
+// A VM-wide, direct-mapped cache of own property offsets keyed by (Shape, PropertyKey).
+// Property access sites that have seen too many shapes to fit in their PropertyLookupCache
+// go megamorphic and consult this cache instead of doing a full property lookup.
+// Only non-dictionary shapes are cached, since their property offsets never change.
+class MegamorphicPropertyCache {
+public:
+    static constexpr size_t entry_count = 4096;
+
+    MegamorphicPropertyCache()
+    {
+        m_entries.resize(entry_count);
+    }
+
+    Optional<u32> lookup(Shape const& shape, PropertyKey const& key) const
+    {
+        auto const& entry = m_entries[index_for(shape, key)];
+        if (entry.shape != &shape || !entry.key.has_value() || *entry.key != key)
+            return {};
+        return entry.property_offset;
+    }
+
+    void set(Shape& shape, PropertyKey const& key, u32 property_offset)
+    {
+        auto& entry = m_entries[index_for(shape, key)];
+        entry.shape = &shape;
+        entry.key = key;
+        entry.property_offset = property_offset;
+    }
+
+    void remove_dead_entries();
+
+private:
+    struct Entry {
+        GC::RawPtr<Shape> shape;
+        Optional<PropertyKey> key;
+        u32 property_offset { 0 };
+    };
+
+    static size_t index_for(Shape const& shape, PropertyKey const& key)
+    {
+        return pair_int_hash(ptr_hash(&shape), Traits<PropertyKey>::hash(key)) % entry_count;
+    }
+
+    Vector<Entry> m_entries;
+};
+
+}
@@ -69,6 +69,16 @@ ALWAYS_INLINE ThrowCompletionOr<GC::Ref<Object>> base_object_for_get(VM& vm, Val
     return throw_null_or_undefined_property_get(vm, base_value, get_base_identifier, get_property_name);
 }
 
+// Calls the getter of an accessor property that was found through a property lookup cache.
+ALWAYS_INLINE ThrowCompletionOr<Value> call_cached_getter(VM& vm, Accessor& accessor, Value this_value)
+{
+    // NB: The accessor may have lost its getter since it was cached.
+    auto* getter = accessor.getter();
+    if (!getter) [[unlikely]]
+        return js_undefined();
+    return call(vm, *getter, this_value);
+}
+
 template<GetByIdMode mode, typename GetBaseIdentifier, typename GetPropertyName>
 ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_base_identifier, GetPropertyName get_property_name, Value base_value, Value this_value, PropertyLookupCache& cache)
 {
@@ -111,9 +121,10 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
                 return true;
             }();
             if (can_use_cache) [[likely]] {
+                cache.statistics.record_hit();
                 auto value = cached_prototype->get_direct(cache_entry.property_offset);
                 if (value.is_accessor())
-                    return TRY(call(vm, value.as_accessor().getter(), this_value));
+                    return TRY(call_cached_getter(vm, value.as_accessor(), this_value));
                 return value;
             }
         } else if (&shape == cache_entry.shape) {
@@ -126,14 +137,29 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
             }
 
             if (can_use_cache) [[likely]] {
+                cache.statistics.record_hit();
                 auto value = base_obj->get_direct(cache_entry.property_offset);
                 if (value.is_accessor()) {
-                    return TRY(call(vm, value.as_accessor().getter(), this_value));
+                    return TRY(call_cached_getter(vm, value.as_accessor(), this_value));
                 }
                 return value;
             }
         }
     }
+
+    // OPTIMIZATION: Megamorphic sites fall back to the VM-wide cache of own property offsets.
+    if (cache.is_megamorphic && !shape.is_dictionary()) {
+        if (auto property_offset = vm.megamorphic_property_cache().lookup(shape, get_property_name()); property_offset.has_value()) {
+            cache.statistics.record_hit();
+            auto value = base_obj->get_direct(*property_offset);
+            if (value.is_accessor())
+                return TRY(call_cached_getter(vm, value.as_accessor(), this_value));
+            return value;
+        }
+    }
+
+    cache.statistics.record_miss();
+
     GC::Ptr<PrototypeChainValidity> prototype_chain_validity;
     if (shape.prototype())
         prototype_chain_validity = shape.prototype()->shape().prototype_chain_validity();
@@ -146,13 +172,17 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
     // property with the same name into the object itself.
     if (&shape == &base_obj->shape()) {
         auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
+            if (cache.entries[cache.entries.size() - 1].shape)
+                cache.did_evict_entry();
             for (size_t i = cache.entries.size() - 1; i >= 1; --i) {
                 cache.entries[i] = cache.entries[i - 1];
             }
             cache.entries[0] = {};
             return cache.entries[0];
         };
-        if (cacheable_metadata.type == CacheableGetPropertyMetadata::Type::GetOwnProperty) {
+        if (cacheable_metadata.type == CacheableGetPropertyMetadata::Type::GetOwnProperty && cache.is_megamorphic && !shape.is_dictionary()) {
+            vm.megamorphic_property_cache().set(shape, get_property_name(), cacheable_metadata.property_offset.value());
+        } else if (cacheable_metadata.type == CacheableGetPropertyMetadata::Type::GetOwnProperty) {
             auto& entry = get_cache_slot();
             entry.shape = shape;
             entry.property_offset = cacheable_metadata.property_offset.value();
@@ -263,6 +293,7 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                     if (can_use_cache) [[likely]] {
                         auto value_in_prototype = cached_prototype->get_direct(cache.property_offset);
                         if (value_in_prototype.is_accessor()) [[unlikely]] {
+                            caches->statistics.record_hit();
                             (void)TRY(call(vm, value_in_prototype.as_accessor().setter(), this_value, value));
                             return {};
                         }
@@ -280,6 +311,7 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                             break;
                     }
 
+                    caches->statistics.record_hit();
                     auto value_in_object = object->get_direct(cache.property_offset);
                     if (value_in_object.is_accessor()) [[unlikely]] {
                         (void)TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
@@ -311,6 +343,7 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                     auto cached_prototype_chain_validity = cache.prototype_chain_validity.ptr();
                     if (cached_prototype_chain_validity && !cached_prototype_chain_validity->is_valid()) [[unlikely]]
                         break;
+                    caches->statistics.record_hit();
                     object->unsafe_set_shape(*cached_shape);
                     object->put_direct(cache.property_offset, value);
                     return {};
@@ -319,6 +352,7 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                     VERIFY_NOT_REACHED();
                 }
             }
+            caches->statistics.record_miss();
         }
 
         CacheableSetPropertyMetadata cacheable_metadata;
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <LibJS/CompiledScriptCache.h>
+
+namespace JS {
+
+static u32 hash_for(SourceCode const& source_code, size_t line_number_offset)
+{
+    return pair_int_hash(pair_int_hash(source_code.code_view().hash(), source_code.filename().hash()), u64_hash(line_number_offset));
+}
+
+bool CompiledScriptCache::is_cacheable(SourceCode const& source_code)
+{
+    return !source_code.code_view().contains(u'`');
+}
+
+CompiledScriptCache::Entry* CompiledScriptCache::find(SourceCode const& source_code, size_t line_number_offset, u32 hash)
+{
+    for (auto& entry : m_entries) {
+        if (entry.hash != hash || entry.line_number_offset != line_number_offset)
+            continue;
+        if (entry.source_code->filename() != source_code.filename())
+            continue;
+        if (entry.source_code->code_view() != source_code.code_view())
+            continue;
+        return &entry;
+    }
+    return nullptr;
+}
+
+Optional<RustIntegration::ScriptResult> CompiledScriptCache::lookup(SourceCode const& source_code, size_t line_number_offset)
+{
+    if (m_entries.is_empty())
+        return {};
+
+    auto* entry = find(source_code, line_number_offset, hash_for(source_code, line_number_offset));
+    if (!entry)
+        return {};
+
+    entry->last_use = ++m_use_counter;
+    return entry->result;
+}
+
+void CompiledScriptCache::insert(NonnullRefPtr<SourceCode const> source_code, size_t line_number_offset, RustIntegration::ScriptResult const& result)
+{
+    auto size = source_code->length_in_code_units();
+    if (m_capacity_in_code_units == 0 || size > m_capacity_in_code_units || !is_cacheable(*source_code))
+        return;
+
+    auto hash = hash_for(*source_code, line_number_offset);
+    if (auto* entry = find(*source_code, line_number_offset, hash)) {
+        entry->last_use = ++m_use_counter;
+        return;
+    }
+
+    evict_until_size_is_at_most(m_capacity_in_code_units - size);
+
+    m_entries.append({
+        .source_code = move(source_code),
+        .line_number_offset = line_number_offset,
+        .hash = hash,
+        .last_use = ++m_use_counter,
+        .result = result,
+    });
+    m_size_in_code_units += size;
+}
+
+void CompiledScriptCache::set_capacity_in_code_units(size_t capacity)
+{
+    m_capacity_in_code_units = capacity;
+    evict_until_size_is_at_most(capacity);
+}
+
+void CompiledScriptCache::clear()
+{
+    m_entries.clear();
+    m_size_in_code_units = 0;
+}
+
+void CompiledScriptCache::evict_until_size_is_at_most(size_t size)
+{
+    while (m_size_in_code_units > size) {
+        size_t least_recently_used = 0;
+        for (size_t i = 1; i < m_entries.size(); ++i) {
+            if (m_entries[i].last_use < m_entries[least_recently_used].last_use)
+                least_recently_used = i;
+        }
+        m_size_in_code_units -= m_entries[least_recently_used].source_code->length_in_code_units();
+        m_entries.remove(least_recently_used);
+    }
+}
+
+}
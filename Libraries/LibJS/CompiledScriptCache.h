@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibJS/Export.h>
+#include <LibJS/RustIntegration.h>
+#include <LibJS/SourceCode.h>
+
+namespace JS {
+
+// An in-memory cache of compiled classic scripts, keyed by their source text, filename and line number offset.
+// A hit lets a script that is loaded again (e.g. the same framework bundle after a navigation) skip parsing and
+// bytecode generation entirely. Entries keep their bytecode alive, so the cache is bounded by the total length of
+// the cached source text, and the least recently used scripts are evicted first. The cache is disabled (has a
+// capacity of zero) until an embedder opts in with set_capacity_in_code_units().
+class JS_API CompiledScriptCache {
+public:
+
+    // Scripts containing template literals are never cached, since tagged templates cache their template
+    // objects in the executable, and those must not be shared between realms or separately parsed scripts.
+    static bool is_cacheable(SourceCode const&);
+
+    Optional<RustIntegration::ScriptResult> lookup(SourceCode const&, size_t line_number_offset);
+    void insert(NonnullRefPtr<SourceCode const>, size_t line_number_offset, RustIntegration::ScriptResult const&);
+
+    size_t capacity_in_code_units() const { return m_capacity_in_code_units; }
+    void set_capacity_in_code_units(size_t);
+
+    void clear();
+
+private:
+    struct Entry {
+        NonnullRefPtr<SourceCode const> source_code;
+        size_t line_number_offset { 0 };
+        u32 hash { 0 };
+        u64 last_use { 0 };
+        RustIntegration::ScriptResult result;
+    };
+
+    Entry* find(SourceCode const&, size_t line_number_offset, u32 hash);
+    void evict_until_size_is_at_most(size_t);
+
+    Vector<Entry> m_entries;
+    size_t m_size_in_code_units { 0 };
+    size_t m_capacity_in_code_units { 0 };
+    u64 m_use_counter { 0 };
+};
+
+}
@@ -297,6 +297,34 @@ ThrowCompletionOr<Optional<PropertyDescriptor>> Array::internal_get_own_property
     return Object::internal_get_own_property(property_key);
 }
 
+bool Array::try_fast_put_indexed_element(u32 index, Value value)
+{
+    if (m_is_proxy_target || may_interfere_with_indexed_property_access())
+        return false;
+
+    auto storage_kind = indexed_storage_kind();
+    if (storage_kind == IndexedStorageKind::Dictionary)
+        return false;
+
+    auto size = indexed_array_like_size();
+    if (index > size)
+        return false;
+
+    // Existing own elements are plain writable data properties.
+    if (index < size && (storage_kind == IndexedStorageKind::Packed || indexed_has(index))) {
+        indexed_put(index, value);
+        return true;
+    }
+
+    // Holes and appends define a new own property, so [[Set]] would consult the prototype chain,
+    // [[Extensible]] and (for appends) the writability of "length".
+    if (!extensible() || (index == size && !m_length_writable) || !default_prototype_chain_intact())
+        return false;
+
+    indexed_put(index, value);
+    return true;
+}
+
 bool Array::default_prototype_chain_intact() const
 {
     auto const& intrinsics = m_realm->intrinsics();
@@ -71,6 +71,12 @@ public:
             && indexed_storage_kind() == IndexedStorageKind::Packed;
     }
 
+    // OPTIMIZATION: Stores value directly into non-dictionary element storage when that is
+    //               indistinguishable from [[Set]]: the index is an existing element, a hole,
+    //               or the next append position, and nothing can intercept the store.
+    //               Returns false if the caller has to take the generic path.
+    bool try_fast_put_indexed_element(u32 index, Value value);
+
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
 protected:
@@ -8,6 +8,7 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/ArrayBufferConstructor.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/TypedArray.h>
 
 namespace JS {
@@ -58,6 +59,74 @@ void ArrayBuffer::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_detach_key);
+    if (m_waiter_lists) {
+        for (auto& it : *m_waiter_lists) {
+            for (auto& waiter : it.value)
+                visitor.visit(waiter.promise_capability);
+        }
+    }
+}
+
+// 25.4.3.8 AddWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-addwaiter
+void ArrayBuffer::add_waiter(size_t byte_index, Waiter waiter)
+{
+    VERIFY(is_shared_array_buffer());
+    if (!m_waiter_lists)
+        m_waiter_lists = make<HashMap<size_t, Vector<Waiter>>>();
+
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+    // 2. Assert: There is no Waiter Record in WL.[[Waiters]] whose [[PromiseCapability]] field is waiterRecord.[[PromiseCapability]] and whose [[AgentSignifier]] field is waiterRecord.[[AgentSignifier]].
+    // 3. Append waiterRecord to WL.[[Waiters]].
+    m_waiter_lists->ensure(byte_index).append(move(waiter));
+}
+
+// 25.4.3.9 RemoveWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-removewaiter
+bool ArrayBuffer::remove_waiter(size_t byte_index, u64 waiter_id)
+{
+    if (!m_waiter_lists)
+        return false;
+    auto it = m_waiter_lists->find(byte_index);
+    if (it == m_waiter_lists->end())
+        return false;
+
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+    // 2. Assert: WL.[[Waiters]] contains waiterRecord.
+    // 3. Remove waiterRecord from WL.[[Waiters]].
+    auto removed = it->value.remove_first_matching([&](auto const& waiter) { return waiter.id == waiter_id; });
+    if (it->value.is_empty())
+        m_waiter_lists->remove(it);
+    return removed;
+}
+
+// 25.4.3.10 RemoveWaiters ( WL, c ), https://tc39.es/ecma262/#sec-removewaiters
+Vector<ArrayBuffer::Waiter> ArrayBuffer::remove_waiters(size_t byte_index, double count)
+{
+    if (!m_waiter_lists)
+        return {};
+    auto it = m_waiter_lists->find(byte_index);
+    if (it == m_waiter_lists->end())
+        return {};
+
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+    // 2. Let len be the number of elements in WL.[[Waiters]].
+    auto length = it->value.size();
+
+    // 3. Let n be min(c, len).
+    auto n = count < static_cast<double>(length) ? static_cast<size_t>(count) : length;
+
+    // 4. Let L be a List whose elements are the first n elements of WL.[[Waiters]].
+    Vector<Waiter> waiters;
+    waiters.ensure_capacity(n);
+    for (size_t i = 0; i < n; ++i)
+        waiters.unchecked_append(it->value[i]);
+
+    // 5. Remove the first n elements of WL.[[Waiters]].
+    it->value.remove(0, n);
+    if (it->value.is_empty())
+        m_waiter_lists->remove(it);
+
+    // 6. Return L.
+    return waiters;
 }
 
 // 6.2.9.1 CreateByteDataBlock ( size ), https://tc39.es/ecma262/#sec-createbytedatablock
@@ -8,6 +8,8 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
 #include <AK/Variant.h>
 #include <LibGC/WeakHashSet.h>
 #include <LibJS/Export.h>
@@ -137,6 +139,18 @@ public:
         return true;
     }
 
+    // Waiter Record of an Atomics.waitAsync() call, https://tc39.es/ecma262/#sec-waiter-record
+    struct Waiter {
+        u64 id { 0 };
+        GC::Ref<PromiseCapability> promise_capability;
+    };
+
+    // NB: These stand in for the agent cluster's WaiterList Records. A shared data block never leaves the agent that
+    //     created it (it is copied when serialized), so the buffer can hold the waiter lists of its own block.
+    void add_waiter(size_t byte_index, Waiter);
+    bool remove_waiter(size_t byte_index, u64 waiter_id);
+    Vector<Waiter> remove_waiters(size_t byte_index, double count);
+
     enum Order {
         SeqCst,
         Unordered
@@ -159,6 +173,7 @@ private:
     DataBlock m_data_block;
     Optional<size_t> m_max_byte_length;
     GC::WeakHashSet<TypedArrayBase> m_cached_views;
+    OwnPtr<HashMap<size_t, Vector<Waiter>>> m_waiter_lists;
 
     // The various detach related members of ArrayBuffer are not used by any ECMA262 functionality,
     // but are required to be available for the use of various harnesses like the Test262 test runner.
@@ -50,6 +50,27 @@ BuiltinIterator* ArrayIterator::as_builtin_iterator_if_next_is_not_redefined(Val
     return nullptr;
 }
 
+GC::Ptr<Array> ArrayIterator::take_remaining_values_of_packed_array(Realm& realm)
+{
+    if (m_iteration_kind != Object::PropertyKind::Value || !m_array.is_object())
+        return nullptr;
+
+    auto* array = as_if<Array>(m_array.as_object());
+    if (!array || !array->is_simple_packed_array())
+        return nullptr;
+
+    auto elements = array->indexed_packed_elements_span();
+    if (m_index > elements.size())
+        return nullptr;
+
+    auto result = Array::create_from(realm, elements.slice(m_index));
+
+    // Leave the iterator in the state the final call to next() would have.
+    m_index = elements.size();
+    m_array = js_undefined();
+    return result;
+}
+
 ThrowCompletionOr<void> ArrayIterator::next(VM& vm, bool& done, Value& value)
 {
     // 1. Let O be the this value.
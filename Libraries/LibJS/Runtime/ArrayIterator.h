@@ -24,6 +24,10 @@ public:
     BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(Value next_method) override;
     ThrowCompletionOr<void> next(VM&, bool& done, Value& value) override;
 
+    // OPTIMIZATION: If this iterates the values of a packed array, stepping through the rest of it can't run any
+    //               user code. Returns a new array of the remaining values and finishes the iteration, or nullptr.
+    GC::Ptr<Array> take_remaining_values_of_packed_array(Realm&);
+
 private:
     ArrayIterator(Value array, Object::PropertyKind iteration_kind, Object& prototype);
 
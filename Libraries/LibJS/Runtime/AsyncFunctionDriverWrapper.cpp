@@ -10,6 +10,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
+#include <LibJS/Runtime/PromiseReaction.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -119,12 +120,20 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
 
     // 4. Let onFulfilled be CreateBuiltinFunction(fulfilledClosure, 1, "", « »).
     // 6. Let onRejected be CreateBuiltinFunction(rejectedClosure, 1, "", « »).
-    if (!m_on_settled)
+    // OPTIMIZATION: The closures behave the same for every await in this function, and so do the reactions that
+    //               PerformPromiseThen would create for them. We create both reactions the first time we get here and
+    //               reuse them for every subsequent await, so that awaiting a pending promise only allocates the
+    //               reaction job once it settles.
+    if (!m_on_settled) {
         m_on_settled = NativeFunction::create(realm, move(settled_closure), 1);
+        auto on_settled_job_callback = vm.host_make_job_callback(*m_on_settled);
+        m_on_fulfilled_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Fulfill, {}, on_settled_job_callback);
+        m_on_rejected_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, {}, on_settled_job_callback);
+    }
 
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
     m_current_promise = as<Promise>(promise_object);
-    m_current_promise->perform_then(m_on_settled, m_on_settled, {});
+    m_current_promise->perform_then(*m_on_fulfilled_reaction, *m_on_rejected_reaction);
 
     // NOTE: None of these are necessary. 8-12 are handled by step d of the above lambdas.
     // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
@@ -238,6 +247,8 @@ void AsyncFunctionDriverWrapper::visit_edges(Cell::Visitor& visitor)
     if (m_suspended_execution_context)
         m_suspended_execution_context->visit_edges(visitor);
     visitor.visit(m_on_settled);
+    visitor.visit(m_on_fulfilled_reaction);
+    visitor.visit(m_on_rejected_reaction);
 }
 
 }
@@ -37,6 +37,8 @@ private:
     OwnPtr<ExecutionContext> m_suspended_execution_context;
 
     GC::Ptr<NativeFunction> m_on_settled;
+    GC::Ptr<PromiseReaction> m_on_fulfilled_reaction;
+    GC::Ptr<PromiseReaction> m_on_rejected_reaction;
     bool m_is_initial_execution { true };
 };
 
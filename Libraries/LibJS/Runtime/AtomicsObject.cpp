@@ -16,9 +16,12 @@
 #include <AK/ByteBuffer.h>
 #include <AK/Endian.h>
 #include <AK/TypeCasts.h>
+#include <LibCore/System.h>
+#include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/AtomicsObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -146,6 +149,65 @@ enum class WaitMode {
     Async,
 };
 
+// 25.4.3.12 NotifyWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-notifywaiter
+static void notify_waiter(VM& vm, PromiseCapability const& promise_capability, StringView result)
+{
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+    // 2. If waiterRecord.[[PromiseCapability]] is blocking, then
+    //     a. Wake the agent whose signifier is waiterRecord.[[AgentSignifier]] from suspension.
+    //     b. NOTE: This causes the agent to resume execution in SuspendThisAgent.
+    // NB: Blocking waiters are never added to a waiter list, see DoWait.
+
+    // 3. Else if AgentSignifier() is waiterRecord.[[AgentSignifier]], then
+    //     a. Let promiseCapability be waiterRecord.[[PromiseCapability]].
+    //     b. Perform ! Call(promiseCapability.[[Resolve]], undefined, « waiterRecord.[[Result]] »).
+    // NB: Waiters always belong to the surrounding agent, since shared data blocks don't leave it.
+    MUST(call(vm, *promise_capability.resolve(), js_undefined(), PrimitiveString::create(vm, result)));
+
+    // 4. Else,
+    //     a. Perform EnqueueResolveInAgentJob(waiterRecord.[[AgentSignifier]], waiterRecord.[[PromiseCapability]], waiterRecord.[[Result]]).
+    // 5. Return unused.
+}
+
+// 25.4.3.16 EnqueueAtomicsWaitAsyncTimeoutJob ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-enqueueatomicswaitasynctimeoutjob
+static void enqueue_atomics_wait_async_timeout_job(VM& vm, ArrayBuffer& buffer, size_t byte_index_in_buffer, ArrayBuffer::Waiter const& waiter, double timeout)
+{
+    // 1. Let timeoutJob be a new Job Abstract Closure with no parameters that captures WL and waiterRecord and performs the following steps when called:
+    auto timeout_job = GC::create_function(vm.heap(), [&vm, buffer = GC::Ref<ArrayBuffer> { buffer }, byte_index_in_buffer, waiter_id = waiter.id, promise_capability = waiter.promise_capability]() {
+        // a. Perform EnterCriticalSection(WL).
+        // b. If WL.[[Waiters]] contains waiterRecord, then
+        //     i. Let timeOfJobExecution be the time value (UTC) identifying the current time.
+        //     ii. Assert: ℝ(timeOfJobExecution) ≥ waiterRecord.[[TimeoutTime]] (ignoring potential non-monotonicity of time values).
+        //     iii. Set waiterRecord.[[Result]] to "timed-out".
+        //     iv. Perform RemoveWaiter(WL, waiterRecord).
+        if (buffer->remove_waiter(byte_index_in_buffer, waiter_id)) {
+            // v. Perform NotifyWaiter(WL, waiterRecord).
+            notify_waiter(vm, *promise_capability, "timed-out"sv);
+        }
+
+        // c. Perform LeaveCriticalSection(WL).
+        // d. Return unused.
+    });
+
+    // 2. Let now be the time value (UTC) identifying the current time.
+    // 3. Let currentRealm be the current Realm Record.
+    auto& current_realm = *vm.current_realm();
+
+    // 4. Perform HostEnqueueTimeoutJob(timeoutJob, currentRealm, 𝔽(waiterRecord.[[TimeoutTime]]) - now).
+    vm.host_enqueue_timeout_job(timeout_job, current_realm, timeout);
+
+    // 5. Return unused.
+}
+
+static GC::Ref<Object> create_wait_result_object(VM& vm, bool is_async, Value value)
+{
+    auto& realm = *vm.current_realm();
+    auto result_object = Object::create(realm, realm.intrinsics().object_prototype());
+    MUST(result_object->create_data_property_or_throw(vm.names.async, Value { is_async }));
+    MUST(result_object->create_data_property_or_throw(vm.names.value, value));
+    return result_object;
+}
+
 // 25.4.3.14 DoWait ( mode, typedArray, index, value, timeout ), https://tc39.es/ecma262/#sec-dowait
 static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& typed_array, Value index, Value expected_value, Value timeout_value)
 {
@@ -189,12 +251,97 @@ static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& t
     if (mode == WaitMode::Sync && !agent_can_suspend(vm))
         return vm.throw_completion<TypeError>(ErrorType::AgentCannotSuspend);
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)value;
-    (void)timeout;
+    // 11. Let block be buffer.[[ArrayBufferData]].
+    // 12. Let offset be typedArray.[[ByteOffset]].
+    // 13. Let byteIndexInBuffer be (i × elementSize) + offset.
+    // NB: ValidateAtomicAccess has already given us byteIndexInBuffer.
+
+    // 14. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    // 15. If mode is sync, then
+    //     a. Let promiseCapability be blocking.
+    //     b. Let resultObject be undefined.
+    // 16. Else,
+    //     a. Let promiseCapability be ! NewPromiseCapability(%Promise%).
+    //     b. Let resultObject be OrdinaryObjectCreate(%Object.prototype%).
+    // NB: The result object is created below, once we know what goes into it.
+
+    // 17. Perform EnterCriticalSection(WL).
+    // NB: Shared data blocks are copied when they are serialized, so no other agent can access this memory.
+
+    // 18. Let elementType be TypedArrayElementType(typedArray).
+    // 19. Let w be GetValueFromBuffer(buffer, byteIndexInBuffer, elementType, true, seq-cst).
+    i64 current_value = 0;
+    if (array_type_name == vm.names.BigInt64Array.as_string())
+        current_value = MUST(buffer->get_value<i64>(byte_index_in_buffer, true, ArrayBuffer::Order::SeqCst).to_bigint_int64(vm));
+    else
+        current_value = MUST(buffer->get_value<i32>(byte_index_in_buffer, true, ArrayBuffer::Order::SeqCst).to_i32(vm));
+
+    // 20. If v ≠ w, then
+    if (value != current_value) {
+        // a. Perform LeaveCriticalSection(WL).
+        // b. If mode is sync, return "not-equal".
+        if (mode == WaitMode::Sync)
+            return PrimitiveString::create(vm, "not-equal"_string);
+
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "not-equal").
+        // e. Return resultObject.
+        return create_wait_result_object(vm, false, PrimitiveString::create(vm, "not-equal"_string));
+    }
+
+    // 21. If t = 0 and mode is async, then
+    if (timeout == 0 && mode == WaitMode::Async) {
+        // a. NOTE: There is no special handling of synchronous immediate timeouts. Asynchronous immediate timeouts have special handling in order to fail fast and avoid unnecessary Promise jobs.
+        // b. Perform LeaveCriticalSection(WL).
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "timed-out").
+        // e. Return resultObject.
+        return create_wait_result_object(vm, false, PrimitiveString::create(vm, "timed-out"_string));
+    }
+
+    // 22. Let thisAgent be AgentSignifier().
+    // 23. Let now be the time value (UTC) identifying the current time.
+    // 24. Let additionalTimeout be an implementation-defined non-negative mathematical value.
+    // 25. Let timeoutTime be ℝ(now) + t + additionalTimeout.
+    // 26. NOTE: When t is +∞, timeoutTime is also +∞.
+
+    // 27. Let waiterRecord be a new Waiter Record { [[AgentSignifier]]: thisAgent, [[PromiseCapability]]: promiseCapability, [[TimeoutTime]]: timeoutTime, [[Result]]: "ok" }.
+    // 28. Perform AddWaiter(WL, waiterRecord).
+    // 29. If mode is sync, then
+    //     a. Perform SuspendThisAgent(WL, waiterRecord).
+    // NB: Only another agent with access to this memory could wake a blocking waiter, and there is no such agent (see
+    //     step 17). So instead of adding a waiter record that nothing will ever notify, we stay suspended until the
+    //     timeout is reached. Without a timeout, that means forever, as it would in any engine where no agent ever
+    //     calls Atomics.notify().
+    if (mode == WaitMode::Sync) {
+        while (isinf(timeout))
+            (void)Core::System::sleep_ms(NumericLimits<u32>::max());
+        for (auto remaining = timeout; remaining > 0; remaining -= NumericLimits<u32>::max())
+            (void)Core::System::sleep_ms(static_cast<u32>(ceil(min(remaining, static_cast<double>(NumericLimits<u32>::max())))));
+
+        // 32. If mode is sync, return waiterRecord.[[Result]].
+        return PrimitiveString::create(vm, "timed-out"_string);
+    }
+
+    auto& realm = *vm.current_realm();
+    auto promise_capability = MUST(new_promise_capability(vm, realm.intrinsics().promise_constructor()));
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    static u64 s_next_waiter_id = 0;
+    ArrayBuffer::Waiter waiter { .id = ++s_next_waiter_id, .promise_capability = promise_capability };
+    buffer->add_waiter(byte_index_in_buffer, waiter);
+
+    // 30. Else if timeoutTime is finite, then
+    if (!isinf(timeout)) {
+        // a. Perform EnqueueAtomicsWaitAsyncTimeoutJob(WL, waiterRecord).
+        enqueue_atomics_wait_async_timeout_job(vm, *buffer, byte_index_in_buffer, waiter, timeout);
+    }
+
+    // 31. Perform LeaveCriticalSection(WL).
+
+    // 33. Perform ! CreateDataPropertyOrThrow(resultObject, "async", true).
+    // 34. Perform ! CreateDataPropertyOrThrow(resultObject, "value", promiseCapability.[[Promise]]).
+    // 35. Return resultObject.
+    return create_wait_result_object(vm, true, promise_capability->promise());
 }
 
 template<typename T, typename AtomicFunction>
@@ -582,12 +729,24 @@ JS_DEFINE_NATIVE_FUNCTION(AtomicsObject::notify)
     if (!buffer->is_shared_array_buffer())
         return Value { 0 };
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)count;
+    // 7. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    // NB: The waiter lists of a shared data block are held by its buffer, see ArrayBuffer::add_waiter.
     (void)block;
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 8. Perform EnterCriticalSection(WL).
+    // 9. Let S be RemoveWaiters(WL, c).
+    auto waiters = buffer->remove_waiters(byte_index_in_buffer, count);
+
+    // 10. For each element W of S, do
+    for (auto const& waiter : waiters) {
+        // a. Perform NotifyWaiter(WL, W).
+        notify_waiter(vm, *waiter.promise_capability, "ok"sv);
+    }
+
+    // 11. Perform LeaveCriticalSection(WL).
+    // 12. Let n be the number of elements in S.
+    // 13. Return 𝔽(n).
+    return Value { static_cast<double>(waiters.size()) };
 }
 
 // 25.4.16 Atomics.xor ( typedArray, index, value ), https://tc39.es/ecma262/#sec-atomics.xor
@@ -12,8 +12,8 @@
 #include <LibJS/Runtime/Completion.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
 #include <LibJS/Runtime/Intl/NumberFormat.h>
-#include <LibJS/Runtime/Intl/NumberFormatConstructor.h>
 
 namespace JS {
 
@@ -81,8 +81,6 @@ JS_DEFINE_NATIVE_FUNCTION(BigIntPrototype::to_string)
 // 20.3.1 BigInt.prototype.toLocaleString ( [ locales [ , options ] ] ), https://tc39.es/ecma402/#sup-bigint.prototype.tolocalestring
 JS_DEFINE_NATIVE_FUNCTION(BigIntPrototype::to_locale_string)
 {
-    auto& realm = *vm.current_realm();
-
     auto locales = vm.argument(0);
     auto options = vm.argument(1);
 
@@ -90,7 +88,8 @@ JS_DEFINE_NATIVE_FUNCTION(BigIntPrototype::to_locale_string)
     auto bigint = TRY(this_bigint_value(vm, vm.this_value()));
 
     // 2. Let numberFormat be ? Construct(%NumberFormat%, « locales, options »).
-    auto* number_format = static_cast<Intl::NumberFormat*>(TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)).ptr());
+    // OPTIMIZATION: The NumberFormat is reused from an earlier call when constructing it is unobservable.
+    auto number_format = TRY(Intl::number_format_for_to_locale_string(vm, locales, options));
 
     // 3. Return ? FormatNumeric(numberFormat, x).
     auto formatted = Intl::format_numeric(*number_format, Value(bigint));
@@ -44,6 +44,7 @@ namespace JS {
     P(asIntN)                                \
     P(assert)                                \
     P(assign)                                \
+    P(async)                                 \
     P(asUintN)                               \
     P(at)                                    \
     P(atan)                                  \
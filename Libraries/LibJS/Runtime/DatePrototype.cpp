@@ -20,6 +20,7 @@
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Intl/DateTimeFormat.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatConstructor.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
 #include <LibJS/Runtime/Temporal/AbstractOperations.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
 #include <LibJS/Runtime/Temporal/TimeZone.h>
@@ -991,8 +992,6 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_json)
 // 20.4.2 Date.prototype.toLocaleDateString ( [ locales [ , options ] ] ), https://tc39.es/ecma402/#sup-date.prototype.tolocaledatestring
 JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_date_string)
 {
-    auto& realm = *vm.current_realm();
-
     auto locales = vm.argument(0);
     auto options = vm.argument(1);
 
@@ -1004,7 +1003,8 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_date_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "date", "date").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Date, Intl::OptionDefaults::Date));
+    // OPTIMIZATION: The DateTimeFormat is reused from an earlier call when creating it is unobservable.
+    auto date_format = TRY(Intl::date_time_format_for_to_locale_string(vm, locales, options, Intl::OptionRequired::Date, Intl::OptionDefaults::Date));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
     auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
@@ -1015,8 +1015,6 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_date_string)
 // 20.4.1 Date.prototype.toLocaleString ( [ locales [ , options ] ] ), https://tc39.es/ecma402/#sup-date.prototype.tolocalestring
 JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_string)
 {
-    auto& realm = *vm.current_realm();
-
     auto locales = vm.argument(0);
     auto options = vm.argument(1);
 
@@ -1028,7 +1026,8 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "any", "all").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Any, Intl::OptionDefaults::All));
+    // OPTIMIZATION: The DateTimeFormat is reused from an earlier call when creating it is unobservable.
+    auto date_format = TRY(Intl::date_time_format_for_to_locale_string(vm, locales, options, Intl::OptionRequired::Any, Intl::OptionDefaults::All));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
     auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
@@ -1039,8 +1038,6 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_string)
 // 20.4.3 Date.prototype.toLocaleTimeString ( [ locales [ , options ] ] ), https://tc39.es/ecma402/#sup-date.prototype.tolocaletimestring
 JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_time_string)
 {
-    auto& realm = *vm.current_realm();
-
     auto locales = vm.argument(0);
     auto options = vm.argument(1);
 
@@ -1052,7 +1049,8 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_time_string)
         return PrimitiveString::create(vm, "Invalid Date"_string);
 
     // 3. Let timeFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "time", "time").
-    auto time_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Time, Intl::OptionDefaults::Time));
+    // OPTIMIZATION: The DateTimeFormat is reused from an earlier call when creating it is unobservable.
+    auto time_format = TRY(Intl::date_time_format_for_to_locale_string(vm, locales, options, Intl::OptionRequired::Time, Intl::OptionDefaults::Time));
 
     // 4. Return ? FormatDateTime(timeFormat, x).
     auto formatted = TRY(Intl::format_date_time(vm, time_format, time));
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/ForInCache.h>
+#include <LibJS/Runtime/Shape.h>
+
+namespace JS {
+
+void ForInCache::visit_edges(GC::Cell::Visitor& visitor)
+{
+    for (auto& entry : m_entries) {
+        visitor.visit(entry.shape);
+        visitor.visit(entry.prototype_chain_validity);
+        if (entry.property_names)
+            entry.property_names->visit_edges(visitor);
+    }
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/PropertyKey.h>
+
+namespace JS {
+
+// The keys a for-in loop visits, in order. Shared between the realm's ForInCache and the iterators created from it.
+class PropertyNameList final : public RefCounted<PropertyNameList> {
+public:
+    explicit PropertyNameList(Vector<PropertyKey> keys)
+        : m_keys(move(keys))
+    {
+    }
+
+    ReadonlySpan<PropertyKey> keys() const { return m_keys; }
+
+    void visit_edges(GC::Cell::Visitor& visitor) const
+    {
+        for (auto const& key : m_keys)
+            key.visit_edges(visitor);
+    }
+
+private:
+    Vector<PropertyKey> m_keys;
+};
+
+// A small direct-mapped cache of the for-in key lists of recently enumerated objects, keyed by their shape.
+//
+// An entry is only created for an object with a non-dictionary shape, without indexed properties, and whose prototype
+// chain consists solely of ordinary objects without indexed properties. It stays valid for as long as the prototype
+// chain validity of the object's prototype does, which covers any property being added to, removed from or
+// reconfigured on a prototype, or a prototype being swapped out.
+class ForInCache {
+public:
+    static constexpr size_t entry_count = 64;
+
+    struct Entry {
+        GC::Ptr<Shape> shape;
+        GC::Ptr<PrototypeChainValidity> prototype_chain_validity;
+        RefPtr<PropertyNameList const> property_names;
+    };
+
+    Entry& entry_for(Shape const& shape)
+    {
+        return m_entries[(reinterpret_cast<FlatPtr>(&shape) >> 5) % entry_count];
+    }
+
+    void visit_edges(GC::Cell::Visitor&);
+
+private:
+    AK::Array<Entry, entry_count> m_entries;
+};
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/Intl/Collator.h>
+#include <LibJS/Runtime/Intl/CollatorConstructor.h>
+#include <LibJS/Runtime/Intl/DateTimeFormat.h>
+#include <LibJS/Runtime/Intl/DateTimeFormatConstructor.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
+#include <LibJS/Runtime/Intl/NumberFormat.h>
+#include <LibJS/Runtime/Intl/NumberFormatConstructor.h>
+#include <LibJS/Runtime/Intrinsics.h>
+
+namespace JS::Intl {
+
+// Constructing an Intl object is unobservable if there are no options to read and the locales are either undefined or
+// a single string, as CanonicalizeLocaleList does not invoke any user code for those. The resulting object then only
+// depends on that locale string (and on the system time zone, for date-time formats).
+static Optional<FormatterCacheKey> cache_key_for(Value locales, Value options)
+{
+    if (!options.is_undefined())
+        return {};
+    if (locales.is_undefined())
+        return FormatterCacheKey {};
+    if (locales.is_string())
+        return FormatterCacheKey { .locale = locales.as_string().utf8_string() };
+    return {};
+}
+
+ThrowCompletionOr<GC::Ref<NumberFormat>> number_format_for_to_locale_string(VM& vm, Value locales, Value options)
+{
+    auto& realm = *vm.current_realm();
+
+    auto key = cache_key_for(locales, options);
+    if (key.has_value()) {
+        if (auto number_format = realm.intrinsics().number_format_cache().find(*key))
+            return *number_format;
+    }
+
+    // Let numberFormat be ? Construct(%NumberFormat%, « locales, options »).
+    auto number_format = as<NumberFormat>(*TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)));
+
+    if (key.has_value())
+        realm.intrinsics().number_format_cache().insert(key.release_value(), number_format);
+    return number_format;
+}
+
+ThrowCompletionOr<GC::Ref<DateTimeFormat>> date_time_format_for_to_locale_string(VM& vm, Value locales, Value options, OptionRequired required, OptionDefaults defaults)
+{
+    auto& realm = *vm.current_realm();
+
+    auto key = cache_key_for(locales, options);
+    if (key.has_value()) {
+        key->time_zone = system_time_zone_identifier();
+        key->variant = static_cast<u8>((to_underlying(required) << 4) | to_underlying(defaults));
+
+        if (auto date_time_format = realm.intrinsics().date_time_format_cache().find(*key))
+            return *date_time_format;
+    }
+
+    // Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, required, defaults).
+    auto date_time_format = TRY(create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, required, defaults));
+
+    if (key.has_value())
+        realm.intrinsics().date_time_format_cache().insert(key.release_value(), date_time_format);
+    return date_time_format;
+}
+
+ThrowCompletionOr<GC::Ref<Collator>> collator_for_locale_compare(VM& vm, Value locales, Value options)
+{
+    auto& realm = *vm.current_realm();
+
+    auto key = cache_key_for(locales, options);
+    if (key.has_value()) {
+        if (!key->locale.has_value())
+            return realm.intrinsics().default_collator();
+        if (auto collator = realm.intrinsics().collator_cache().find(*key))
+            return *collator;
+    }
+
+    // Let collator be ? Construct(%Collator%, « locales, options »).
+    auto collator = as<Collator>(*TRY(construct(vm, realm.intrinsics().intl_collator_constructor(), locales, options)));
+
+    if (key.has_value())
+        realm.intrinsics().collator_cache().insert(key.release_value(), collator);
+    return collator;
+}
+
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+
+namespace JS::Intl {
+
+enum class OptionRequired;
+enum class OptionDefaults;
+
+struct FormatterCacheKey {
+    Optional<String> locale;
+    Optional<String> time_zone;
+    u8 variant { 0 };
+
+    bool operator==(FormatterCacheKey const&) const = default;
+};
+
+// A small most-recently-used cache of Intl objects that the locale-sensitive methods of built-in prototypes (e.g.
+// Number.prototype.toLocaleString) construct internally. Those objects are never exposed to script, so when their
+// construction is unobservable, one object can serve many calls.
+template<typename T>
+class FormatterCache {
+public:
+    static constexpr size_t max_entries = 16;
+
+    GC::Ptr<T> find(FormatterCacheKey const& key)
+    {
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            if (m_entries[i].key != key)
+                continue;
+
+            auto object = m_entries[i].object;
+            if (i != 0) {
+                auto entry = m_entries.take(i);
+                m_entries.prepend(move(entry));
+            }
+            return object;
+        }
+        return nullptr;
+    }
+
+    void insert(FormatterCacheKey key, GC::Ref<T> object)
+    {
+        if (m_entries.size() == max_entries)
+            m_entries.take_last();
+        m_entries.prepend({ move(key), object });
+    }
+
+    void visit_edges(GC::Cell::Visitor& visitor)
+    {
+        for (auto& entry : m_entries)
+            visitor.visit(entry.object);
+    }
+
+private:
+    struct Entry {
+        FormatterCacheKey key;
+        GC::Ref<T> object;
+    };
+    Vector<Entry, max_entries> m_entries;
+};
+
+ThrowCompletionOr<GC::Ref<NumberFormat>> number_format_for_to_locale_string(VM&, Value locales, Value options);
+ThrowCompletionOr<GC::Ref<DateTimeFormat>> date_time_format_for_to_locale_string(VM&, Value locales, Value options, OptionRequired, OptionDefaults);
+ThrowCompletionOr<GC::Ref<Collator>> collator_for_locale_compare(VM&, Value locales, Value options);
+
+}
@@ -47,6 +47,7 @@
 #include <LibJS/Runtime/Intl/Collator.h>
 #include <LibJS/Runtime/Intl/CollatorConstructor.h>
 #include <LibJS/Runtime/Intl/CollatorPrototype.h>
+#include <LibJS/Runtime/Intl/DateTimeFormat.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatConstructor.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatPrototype.h>
 #include <LibJS/Runtime/Intl/DisplayNamesConstructor.h>
@@ -58,6 +59,7 @@
 #include <LibJS/Runtime/Intl/ListFormatPrototype.h>
 #include <LibJS/Runtime/Intl/LocaleConstructor.h>
 #include <LibJS/Runtime/Intl/LocalePrototype.h>
+#include <LibJS/Runtime/Intl/NumberFormat.h>
 #include <LibJS/Runtime/Intl/NumberFormatConstructor.h>
 #include <LibJS/Runtime/Intl/NumberFormatPrototype.h>
 #include <LibJS/Runtime/Intl/PluralRulesConstructor.h>
@@ -205,11 +207,15 @@ GC::Ref<Intrinsics> Intrinsics::create(Realm& realm)
     return *intrinsics;
 }
 
-static Vector<GC::Root<SharedFunctionInstanceData>> parse_builtin_file(unsigned char const* script_text, VM& vm)
+static Vector<GC::Root<SharedFunctionInstanceData>> const& parse_builtin_file(unsigned char const* script_text, VM& vm)
 {
-    auto rust_compilation = RustIntegration::compile_builtin_file(script_text, vm);
-    VERIFY(rust_compilation.has_value());
-    return move(rust_compilation.value());
+    // NB: Each file is compiled once per VM and shared between realms, instead of for every function that is
+    //     looked up from it in every realm.
+    return vm.compiled_builtin_files().ensure(script_text, [&] {
+        auto rust_compilation = RustIntegration::compile_builtin_file(script_text, vm);
+        VERIFY(rust_compilation.has_value());
+        return rust_compilation.release_value();
+    });
 }
 
 void Intrinsics::initialize_intrinsics(Realm& realm)
@@ -525,6 +531,9 @@ void Intrinsics::visit_edges(Visitor& visitor)
 #undef __JS_ENUMERATE
 
     visitor.visit(m_default_collator);
+    m_collator_cache.visit_edges(visitor);
+    m_date_time_format_cache.visit_edges(visitor);
+    m_number_format_cache.visit_edges(visitor);
 
 #define __JS_ENUMERATE(snake_name, functionName, length) \
     visitor.visit(m_##snake_name##_abstract_operation_function);
@@ -549,7 +558,7 @@ GC::Ref<Intl::Collator> Intrinsics::default_collator()
     GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_abstract_operation_function()                                                                                                              \
     {                                                                                                                                                                                                           \
         if (!m_##snake_name##_abstract_operation_function) {                                                                                                                                                    \
-            auto shared_data_list = parse_builtin_file(ABSTRACT_OPERATIONS, m_realm->vm());                                                                                                                     \
+            auto const& shared_data_list = parse_builtin_file(ABSTRACT_OPERATIONS, m_realm->vm());                                                                                                              \
             auto it = shared_data_list.find_if([](auto const& shared_data) {                                                                                                                                    \
                 return shared_data->m_name == #functionName##sv;                                                                                                                                                \
             });                                                                                                                                                                                                 \
@@ -565,7 +574,7 @@ JS_ENUMERATE_NATIVE_JAVASCRIPT_BACKED_ABSTRACT_OPERATIONS
     GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_array_constructor_function()                                                                                                              \
     {                                                                                                                                                                                                          \
         if (!m_##snake_name##_array_constructor_function) {                                                                                                                                                    \
-            auto shared_data_list = parse_builtin_file(ARRAY_CONSTRUCTOR, m_realm->vm());                                                                                                                      \
+            auto const& shared_data_list = parse_builtin_file(ARRAY_CONSTRUCTOR, m_realm->vm());                                                                                                               \
             auto it = shared_data_list.find_if([](auto const& shared_data) {                                                                                                                                   \
                 return shared_data->m_name == #functionName##sv;                                                                                                                                               \
             });                                                                                                                                                                                                \
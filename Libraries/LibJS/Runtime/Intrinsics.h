@@ -11,6 +11,7 @@
 #include <LibJS/Export.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
 
 namespace JS {
 
@@ -143,6 +144,10 @@ public:
 
     [[nodiscard]] GC::Ref<Intl::Collator> default_collator();
 
+    Intl::FormatterCache<Intl::Collator>& collator_cache() { return m_collator_cache; }
+    Intl::FormatterCache<Intl::DateTimeFormat>& date_time_format_cache() { return m_date_time_format_cache; }
+    Intl::FormatterCache<Intl::NumberFormat>& number_format_cache() { return m_number_format_cache; }
+
 #define __JS_ENUMERATE(snake_name, functionName, length) \
     GC::Ref<NativeJavaScriptBackedFunction> snake_name##_abstract_operation_function();
     JS_ENUMERATE_NATIVE_JAVASCRIPT_BACKED_ABSTRACT_OPERATIONS
@@ -290,6 +295,10 @@ private:
 #undef __JS_ENUMERATE
 
     GC::Ptr<Intl::Collator> m_default_collator;
+
+    Intl::FormatterCache<Intl::Collator> m_collator_cache;
+    Intl::FormatterCache<Intl::DateTimeFormat> m_date_time_format_cache;
+    Intl::FormatterCache<Intl::NumberFormat> m_number_format_cache;
 };
 
 void add_restricted_function_properties(FunctionObject&, Realm&);
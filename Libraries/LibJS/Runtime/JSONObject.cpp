@@ -22,6 +22,7 @@
 #include <LibJS/Runtime/NumberObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/RawJSONObject.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/StringObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -141,11 +142,17 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::stringify)
 // Returns true if a value was serialized, false if the value was undefined (should be omitted).
 ThrowCompletionOr<bool> JSONObject::serialize_json_property(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder)
 {
-    auto& builder = state.builder;
-
     // 1. Let value be ? Get(holder, key).
     auto value = TRY(holder->get(key));
 
+    return serialize_json_property_value(vm, state, key, holder, value);
+}
+
+// Steps 2 onwards of SerializeJSONProperty, for callers that have already performed Get(holder, key).
+ThrowCompletionOr<bool> JSONObject::serialize_json_property_value(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder, Value value)
+{
+    auto& builder = state.builder;
+
     // 2. If Type(value) is Object or BigInt, then
     if (value.is_object() || value.is_bigint()) {
         // a. Let toJSON be ? GetV(value, "toJSON").
@@ -258,6 +265,43 @@ static void write_indent(StringBuilder& builder, StringView gap, size_t depth)
         builder.append(gap);
 }
 
+JSONObject::SerializationPlan const* JSONObject::serialization_plan_for(StringifyState& state, Object& object)
+{
+    if (state.property_list.has_value())
+        return nullptr;
+
+    // The plan stands in for EnumerableOwnProperties(), so the object must keep all of its own properties in its shape.
+    if (!object.eligible_for_own_property_enumeration_fast_path() || object.has_intrinsic_accessors())
+        return nullptr;
+    if (object.indexed_storage_kind() != IndexedStorageKind::None)
+        return nullptr;
+
+    // Dictionary shapes are mutated in place, so they can't be used to key a plan.
+    auto& shape = object.shape();
+    if (shape.is_dictionary())
+        return nullptr;
+
+    if (auto it = state.serialization_plans.find(&shape); it != state.serialization_plans.end())
+        return it->value.ptr();
+
+    auto plan = make<SerializationPlan>();
+    plan->shape = GC::make_root(shape);
+    for (auto const& [property_key, metadata] : shape.property_table()) {
+        if (!property_key.is_string() || !metadata.attributes.is_enumerable())
+            continue;
+        if (metadata.attributes.is_unimplemented())
+            return nullptr;
+
+        StringBuilder quoted_key;
+        quote_json_string(quoted_key, property_key.to_string());
+        plan->properties.append({ property_key, metadata.offset, quoted_key.to_string_without_validation() });
+    }
+
+    auto const* plan_pointer = plan.ptr();
+    state.serialization_plans.set(&shape, move(plan));
+    return plan_pointer;
+}
+
 // 25.5.2.4 SerializeJSONObject ( state, value ), https://tc39.es/ecma262/#sec-serializejsonobject
 ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
 {
@@ -272,7 +316,10 @@ ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState
     size_t position_after_open_brace = builder.length();
     bool first = true;
 
-    auto process_property = [&](PropertyKey const& key) -> ThrowCompletionOr<void> {
+    auto const* plan = serialization_plan_for(state, object);
+    Shape const* planned_shape = plan ? plan->shape.ptr() : nullptr;
+
+    auto process_property = [&](PropertyKey const& key, SerializationPlan::Property const* planned_property = nullptr) -> ThrowCompletionOr<void> {
         if (key.is_symbol())
             return {};
 
@@ -292,13 +339,26 @@ ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState
         }
 
         // Write key and colon
-        quote_json_string(builder, key.to_string());
+        if (planned_property)
+            builder.append(planned_property->quoted_key);
+        else
+            quote_json_string(builder, key.to_string());
         builder.append(':');
         if (!state.gap.is_empty())
             builder.append(' ');
 
         // Serialize value
-        bool wrote_value = TRY(serialize_json_property(vm, state, key, &object));
+        bool wrote_value = false;
+        if (planned_property) {
+            // NOTE: Serializing earlier properties may have run user code that reshaped the object.
+            //       As long as the shape is unchanged, the planned slot still holds the own data property.
+            auto value = &object.shape() == planned_shape ? object.get_direct(planned_property->offset) : js_special_empty_value();
+            if (value.is_special_empty_value() || value.is_accessor())
+                value = TRY(object.get(key));
+            wrote_value = TRY(serialize_json_property_value(vm, state, key, &object, value));
+        } else {
+            wrote_value = TRY(serialize_json_property(vm, state, key, &object));
+        }
 
         if (wrote_value) {
             first = false;
@@ -309,7 +369,10 @@ ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState
         return {};
     };
 
-    if (state.property_list.has_value()) {
+    if (plan) {
+        for (auto const& property : plan->properties)
+            TRY(process_property(property.key, &property));
+    } else if (state.property_list.has_value()) {
         auto property_list = state.property_list.value();
         for (auto& property : property_list)
             TRY(process_property(property));
@@ -577,7 +640,31 @@ static ALWAYS_INLINE ThrowCompletionOr<void> ensure_simdjson_fully_parsed(VM& vm
     return {};
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_value(VM&, simdjson::ondemand::value);
+// State shared by all the values parsed by a single JSON.parse() call.
+struct JSONParseState {
+    explicit JSONParseState(GC::Heap& heap)
+        : pending_values(heap)
+    {
+    }
+
+    // Object keys, keyed by their raw (still escaped) JSON text. JSON documents tend to repeat the same handful of
+    // keys many times, so this saves unescaping and interning each occurrence separately.
+    HashMap<StringView, PropertyKey> property_keys;
+
+    // Keys and values of the objects that are currently being parsed, innermost object last.
+    Vector<PropertyKey> pending_keys;
+    GC::RootVector<Value> pending_values;
+};
+
+// The shape that the previous object in the same array ended up with. Sibling objects in an array very often have the
+// same keys in the same order, and those can then be created with that shape directly instead of transitioning to it
+// one property at a time.
+struct JSONShapePrediction {
+    GC::Ptr<Shape> shape;
+    Vector<PropertyKey> keys;
+};
+
+static ThrowCompletionOr<Value> parse_simdjson_value(VM&, JSONParseState&, simdjson::ondemand::value, JSONShapePrediction* = nullptr);
 
 template<typename T>
 static ThrowCompletionOr<Value> parse_simdjson_number(VM& vm, T& value, StringView raw_sv)
@@ -640,7 +727,7 @@ static ThrowCompletionOr<Value> parse_simdjson_string(VM& vm, T& value)
 }
 
 template<typename T>
-static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, T& value)
+static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, JSONParseState& state, T& value)
 {
     auto& realm = *vm.current_realm();
 
@@ -650,12 +737,13 @@ static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, T& value)
 
     auto array = MUST(Array::create(realm, 0));
     size_t index = 0;
+    JSONShapePrediction element_shape_prediction;
 
     for (auto element : simdjson_array) {
         simdjson::ondemand::value element_value;
         if (element.get(element_value))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto parsed = TRY(parse_simdjson_value(vm, element_value));
+        auto parsed = TRY(parse_simdjson_value(vm, state, element_value, &element_shape_prediction));
         array->define_direct_property(index++, parsed, default_attributes);
     }
 
@@ -663,8 +751,29 @@ static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, T& value)
     return array;
 }
 
+static ThrowCompletionOr<PropertyKey> parse_simdjson_key(VM& vm, JSONParseState& state, simdjson::ondemand::field& field)
+{
+    // Use escaped_key() to get the raw JSON key (with escapes), then unescape ourselves
+    std::string_view raw_key_view;
+    if (field.escaped_key().get(raw_key_view))
+        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+
+    // NB: The raw key points into the padded input, which outlives the parse.
+    StringView raw_key { raw_key_view.data(), raw_key_view.size() };
+    if (auto it = state.property_keys.find(raw_key); it != state.property_keys.end())
+        return it->value;
+
+    auto unescaped_key = unescape_json_string(raw_key);
+    if (!unescaped_key.has_value())
+        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+
+    PropertyKey property_key { unescaped_key.release_value() };
+    state.property_keys.set(raw_key, property_key);
+    return property_key;
+}
+
 template<typename T>
-static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, T& value)
+static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, JSONParseState& state, T& value, JSONShapePrediction* shape_prediction)
 {
     auto& realm = *vm.current_realm();
 
@@ -672,28 +781,51 @@ static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, T& value)
     if (value.get_object().get(simdjson_object))
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
 
-    auto object = Object::create(realm, realm.intrinsics().object_prototype());
+    // NB: Values are collected on the (rooted) pending stack first, so that the object can be created with its final
+    //     shape once all keys are known.
+    auto const first_pending = state.pending_values.size();
 
     for (auto field : simdjson_object) {
-        // Use escaped_key() to get the raw JSON key (with escapes), then unescape ourselves
-        std::string_view raw_key;
-        if (field.escaped_key().get(raw_key))
-            return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto unescaped_key = unescape_json_string({ raw_key.data(), raw_key.size() });
-        if (!unescaped_key.has_value())
-            return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+        auto property_key = TRY(parse_simdjson_key(vm, state, field));
         simdjson::ondemand::value field_value;
         if (field.value().get(field_value))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto parsed = TRY(parse_simdjson_value(vm, field_value));
-        object->define_direct_property(unescaped_key.release_value(), parsed, default_attributes);
+        auto parsed = TRY(parse_simdjson_value(vm, state, field_value));
+        state.pending_keys.append(move(property_key));
+        state.pending_values.append(parsed);
     }
 
     TRY(ensure_simdjson_fully_parsed(vm, value));
-    return object;
+
+    auto keys = state.pending_keys.span().slice(first_pending);
+    auto values = state.pending_values.span().slice(first_pending);
+
+    GC::Ptr<Object> object;
+
+    // OPTIMIZATION: If this object has the same keys in the same order as its previous sibling, it gets the same shape.
+    if (shape_prediction && shape_prediction->shape && shape_prediction->keys.span() == keys) {
+        object = Object::create_with_premade_shape(*shape_prediction->shape);
+        for (size_t i = 0; i < values.size(); ++i)
+            object->put_direct(i, values[i]);
+    } else {
+        object = Object::create(realm, realm.intrinsics().object_prototype());
+        for (size_t i = 0; i < keys.size(); ++i)
+            object->define_direct_property(keys[i], values[i], default_attributes);
+
+        // NB: Only shapes that hold every key exactly once, at the offset matching its position, can be predicted.
+        //     That excludes objects with duplicate keys or array index keys, and dictionary shapes.
+        if (shape_prediction && !object->shape().is_dictionary() && object->shape().property_count() == keys.size()) {
+            shape_prediction->shape = &object->shape();
+            shape_prediction->keys = Vector<PropertyKey> { keys };
+        }
+    }
+
+    state.pending_keys.shrink(first_pending);
+    state.pending_values.shrink(first_pending);
+    return Value { object };
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, simdjson::ondemand::value value)
+static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONParseState& state, simdjson::ondemand::value value, JSONShapePrediction* shape_prediction)
 {
     simdjson::ondemand::json_type type;
     if (value.type().get(type))
@@ -716,9 +848,9 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, simdjson::ondemand:
     case simdjson::ondemand::json_type::string:
         return parse_simdjson_string(vm, value);
     case simdjson::ondemand::json_type::array:
-        return parse_simdjson_array(vm, value);
+        return parse_simdjson_array(vm, state, value);
     case simdjson::ondemand::json_type::object:
-        return parse_simdjson_object(vm, value);
+        return parse_simdjson_object(vm, state, value, shape_prediction);
     case simdjson::ondemand::json_type::unknown:
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
     }
@@ -726,7 +858,7 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, simdjson::ondemand:
     VERIFY_NOT_REACHED();
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, simdjson::ondemand::document& document)
+static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, JSONParseState& state, simdjson::ondemand::document& document)
 {
     simdjson::ondemand::json_type type;
     if (document.type().get(type))
@@ -760,9 +892,9 @@ static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, simdjson::ondema
     case simdjson::ondemand::json_type::string:
         return parse_simdjson_string(vm, document);
     case simdjson::ondemand::json_type::array:
-        return parse_simdjson_array(vm, document);
+        return parse_simdjson_array(vm, state, document);
     case simdjson::ondemand::json_type::object:
-        return parse_simdjson_object(vm, document);
+        return parse_simdjson_object(vm, state, document, nullptr);
     case simdjson::ondemand::json_type::unknown:
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
     }
@@ -794,7 +926,8 @@ ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = TRY(parse_simdjson_document(vm, document));
+    JSONParseState state { vm.heap() };
+    auto result = TRY(parse_simdjson_document(vm, state, document));
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibGC/Root.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/Object.h>
 
@@ -28,6 +31,19 @@ public:
 private:
     explicit JSONObject(Realm&);
 
+    // The enumerable string-keyed properties of a shape in enumeration order, with their keys already quoted.
+    // Objects sharing a shape (e.g. records built by the same constructor or literal) reuse one plan per stringify.
+    struct SerializationPlan {
+        struct Property {
+            PropertyKey key;
+            u32 offset { 0 };
+            String quoted_key;
+        };
+
+        GC::Root<Shape> shape;
+        Vector<Property> properties;
+    };
+
     struct StringifyState {
         GC::Ptr<FunctionObject> replacer_function;
         HashTable<GC::Ptr<Object>> seen_objects;
@@ -35,10 +51,13 @@ private:
         String gap;
         Optional<Vector<Utf16String>> property_list;
         StringBuilder builder;
+        HashMap<Shape const*, NonnullOwnPtr<SerializationPlan>> serialization_plans;
     };
 
     // Stringify helpers
     static ThrowCompletionOr<bool> serialize_json_property(VM&, StringifyState&, PropertyKey const& key, Object* holder);
+    static ThrowCompletionOr<bool> serialize_json_property_value(VM&, StringifyState&, PropertyKey const& key, Object* holder, Value);
+    static SerializationPlan const* serialization_plan_for(StringifyState&, Object&);
     static ThrowCompletionOr<void> serialize_json_object(VM&, StringifyState&, Object&);
     static ThrowCompletionOr<void> serialize_json_array(VM&, StringifyState&, Object&);
     static void quote_json_string(StringBuilder&, Utf16View const&);
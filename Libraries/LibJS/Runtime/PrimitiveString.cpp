@@ -25,8 +25,24 @@ namespace JS {
 // Longer strings are not cached to avoid excessive hashing and lookup costs.
 static constexpr size_t MAX_LENGTH_FOR_STRING_CACHE = 256;
 
+// Concatenations of flat strings that produce at most this many code units are performed eagerly, since joining them
+// is cheaper than allocating a rope and resolving it later.
+static constexpr size_t MAX_LENGTH_FOR_EAGER_CONCATENATION = 16;
+
 GC_DEFINE_ALLOCATOR(PrimitiveString);
 GC_DEFINE_ALLOCATOR(RopeString);
+GC_DEFINE_ALLOCATOR(SubstringString);
+
+static size_t utf16_length_of_utf8(StringView string)
+{
+    if (string.is_ascii())
+        return string.length();
+
+    size_t length = 0;
+    for (auto code_point : Utf8View { string })
+        length += code_point > 0xffff ? 2 : 1;
+    return length;
+}
 
 GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, Utf16String const& string)
 {
@@ -127,9 +143,67 @@ GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, PrimitiveString& lhs, P
     if (rhs_empty)
         return lhs;
 
+    bool lhs_is_flat = !lhs.m_is_rope && !lhs.m_is_substring;
+    bool rhs_is_flat = !rhs.m_is_rope && !rhs.m_is_substring;
+
+    if (lhs_is_flat && rhs_is_flat) {
+        if (lhs.has_utf16_string() && rhs.has_utf16_string()) {
+            auto lhs_string = lhs.utf16_string_view();
+            auto rhs_string = rhs.utf16_string_view();
+            auto length = lhs_string.length_in_code_units() + rhs_string.length_in_code_units();
+
+            if (length <= MAX_LENGTH_FOR_EAGER_CONCATENATION) {
+                StringBuilder builder(StringBuilder::Mode::UTF16, length);
+                builder.append(lhs_string);
+                builder.append(rhs_string);
+                return create(vm, builder.to_utf16_string());
+            }
+        } else if (lhs.has_utf8_string() && rhs.has_utf8_string()) {
+            auto lhs_string = lhs.utf8_string_view();
+            auto rhs_string = rhs.utf8_string_view();
+            auto length = lhs_string.length() + rhs_string.length();
+
+            // NOTE: A surrogate pair split across the two strings has to be joined, which is left to rope resolution.
+            //       Surrogates encoded as UTF-8 are 3 bytes starting with 0xED.
+            bool may_split_surrogate_pair = lhs_string.length() >= 3
+                && static_cast<u8>(lhs_string[lhs_string.length() - 3]) == 0xed
+                && static_cast<u8>(rhs_string[0]) == 0xed;
+
+            if (length <= MAX_LENGTH_FOR_EAGER_CONCATENATION && !may_split_surrogate_pair) {
+                StringBuilder builder(length);
+                builder.append(lhs_string);
+                builder.append(rhs_string);
+                return create(vm, builder.to_string_without_validation());
+            }
+        }
+    }
+
     return vm.heap().allocate<RopeString>(lhs, rhs);
 }
 
+GC::Ref<PrimitiveString> PrimitiveString::create_substring(VM& vm, PrimitiveString& base, size_t start, size_t length)
+{
+    VERIFY(start + length <= base.length_in_utf16_code_units());
+
+    if (start == 0 && length == base.length_in_utf16_code_units())
+        return base;
+
+    // Short substrings are copied right away, so they can be deduplicated through the string cache and don't keep
+    // a potentially much larger base string alive.
+    if (length <= MAX_LENGTH_FOR_STRING_CACHE)
+        return create(vm, base.utf16_string_view().substring_view(start, length));
+
+    // Substrings of unresolved substrings refer to the underlying string directly, so chains of slices stay shallow.
+    if (base.m_is_substring) {
+        auto const& base_substring = static_cast<SubstringString const&>(base);
+        return vm.heap().allocate<SubstringString>(*base_substring.m_base, base_substring.m_start + start, length);
+    }
+
+    // Resolve the base string to UTF-16 now, so the substring can view into its storage.
+    (void)base.utf16_string_view();
+    return vm.heap().allocate<SubstringString>(base, start, length);
+}
+
 PrimitiveString::PrimitiveString(Utf16String string)
     : m_utf16_string(move(string))
 {
@@ -159,8 +233,8 @@ void PrimitiveString::finalize()
 
 bool PrimitiveString::is_empty() const
 {
-    if (m_is_rope) {
-        // NOTE: We never make an empty rope string.
+    if (m_is_rope || m_is_substring) {
+        // NOTE: We never make an empty rope string or substring.
         return false;
     }
 
@@ -173,7 +247,7 @@ bool PrimitiveString::is_empty() const
 
 String PrimitiveString::utf8_string() const
 {
-    resolve_rope_if_needed(EncodingPreference::UTF8);
+    resolve_if_needed(EncodingPreference::UTF8);
 
     if (!has_utf8_string()) {
         VERIFY(has_utf16_string());
@@ -197,7 +271,7 @@ StringView PrimitiveString::utf8_string_view() const
 
 Utf16String PrimitiveString::utf16_string() const
 {
-    resolve_rope_if_needed(EncodingPreference::UTF16);
+    resolve_if_needed(EncodingPreference::UTF16);
 
     if (!has_utf16_string()) {
         VERIFY(has_utf8_string());
@@ -216,6 +290,12 @@ Utf16View PrimitiveString::utf16_string_view() const
 
 size_t PrimitiveString::length_in_utf16_code_units() const
 {
+    // NOTE: Ropes and substrings know their length without having to be resolved.
+    if (m_is_rope)
+        return static_cast<RopeString const&>(*this).length_in_utf16_code_units();
+    if (m_is_substring)
+        return static_cast<SubstringString const&>(*this).m_length;
+
     return utf16_string_view().length_in_code_units();
 }
 
@@ -252,13 +332,63 @@ ThrowCompletionOr<Optional<Value>> PrimitiveString::get(VM& vm, PropertyKey cons
     return create(vm, string.substring_view(index.as_index(), 1));
 }
 
-void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) const
+void PrimitiveString::resolve_if_needed(EncodingPreference preference) const
 {
-    if (!m_is_rope)
+    if (m_is_rope) {
+        auto const& rope_string = static_cast<RopeString const&>(*this);
+        rope_string.resolve(preference);
         return;
+    }
+
+    if (m_is_substring) {
+        auto const& substring = static_cast<SubstringString const&>(*this);
+        substring.resolve();
+    }
+}
+
+size_t RopeString::length_in_utf16_code_units_of_piece(PrimitiveString const& piece)
+{
+    VERIFY(!piece.m_is_rope);
 
-    auto const& rope_string = static_cast<RopeString const&>(*this);
-    rope_string.resolve(preference);
+    if (piece.m_is_substring)
+        return static_cast<SubstringString const&>(piece).m_length;
+    if (piece.has_utf16_string())
+        return piece.m_utf16_string->length_in_code_units();
+    return utf16_length_of_utf8(piece.m_utf8_string->bytes_as_string_view());
+}
+
+size_t RopeString::length_in_utf16_code_units() const
+{
+    if (m_length_in_utf16_code_units.has_value())
+        return *m_length_in_utf16_code_units;
+
+    auto cached_length = [](PrimitiveString const& piece) -> Optional<size_t> {
+        if (piece.m_is_rope)
+            return static_cast<RopeString const&>(piece).m_length_in_utf16_code_units;
+        return length_in_utf16_code_units_of_piece(piece);
+    };
+
+    // NOTE: Like resolve(), this walks the rope without recursion. Every rope visited caches its length, so asking
+    //       for the length of a string that is being appended to in a loop only looks at the newly added pieces.
+    Vector<RopeString const*, 2> stack;
+    stack.append(this);
+    while (!stack.is_empty()) {
+        auto const& rope = *stack.last();
+        auto lhs_length = cached_length(*rope.m_lhs);
+        auto rhs_length = cached_length(*rope.m_rhs);
+
+        if (!lhs_length.has_value())
+            stack.append(&static_cast<RopeString const&>(*rope.m_lhs));
+        if (!rhs_length.has_value())
+            stack.append(&static_cast<RopeString const&>(*rope.m_rhs));
+        if (!lhs_length.has_value() || !rhs_length.has_value())
+            continue;
+
+        rope.m_length_in_utf16_code_units = *lhs_length + *rhs_length;
+        stack.take_last();
+    }
+
+    return *m_length_in_utf16_code_units;
 }
 
 void RopeString::resolve(EncodingPreference preference) const
@@ -284,10 +414,12 @@ void RopeString::resolve(EncodingPreference preference) const
             continue;
         }
 
-        if (current->has_utf8_string())
-            approximate_length += current->utf8_string_view().length();
         if (preference == EncodingPreference::UTF16)
-            length_in_utf16_code_units += current->length_in_utf16_code_units();
+            length_in_utf16_code_units += length_in_utf16_code_units_of_piece(*current);
+        else if (current->has_utf8_string())
+            approximate_length += current->utf8_string_view().length();
+        else
+            approximate_length += length_in_utf16_code_units_of_piece(*current);
         pieces.append(current);
     }
 
@@ -297,7 +429,9 @@ void RopeString::resolve(EncodingPreference preference) const
         StringBuilder builder(StringBuilder::Mode::UTF16, length_in_utf16_code_units);
 
         for (auto const* current : pieces) {
-            if (current->has_utf16_string())
+            if (current->m_is_substring)
+                builder.append(static_cast<SubstringString const&>(*current).view());
+            else if (current->has_utf16_string())
                 builder.append(current->utf16_string_view());
             else
                 builder.append(current->utf8_string_view());
@@ -394,4 +528,34 @@ void RopeString::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_rhs);
 }
 
+SubstringString::SubstringString(GC::Ref<PrimitiveString> base, size_t start, size_t length)
+    : PrimitiveString(SubstringTag::Substring)
+    , m_base(base)
+    , m_start(start)
+    , m_length(length)
+{
+    VERIFY(!base->m_is_rope && !base->m_is_substring);
+    VERIFY(base->has_utf16_string());
+}
+
+SubstringString::~SubstringString() = default;
+
+void SubstringString::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_base);
+}
+
+Utf16View SubstringString::view() const
+{
+    return m_base->utf16_string_view().substring_view(m_start, m_length);
+}
+
+void SubstringString::resolve() const
+{
+    m_utf16_string = Utf16String::from_utf16(view());
+    m_is_substring = false;
+    m_base = nullptr;
+}
+
 }
@@ -37,6 +37,10 @@ public:
 
     [[nodiscard]] static GC::Ref<PrimitiveString> create(VM&, PrimitiveString&, PrimitiveString&);
 
+    // Creates the substring of the given string at the given UTF-16 code unit range. Long substrings share the
+    // storage of the base string until they are resolved.
+    [[nodiscard]] static GC::Ref<PrimitiveString> create_substring(VM&, PrimitiveString& base, size_t start, size_t length);
+
     [[nodiscard]] static GC::Ref<PrimitiveString> create_from_unsigned_integer(VM&, u64);
 
     virtual ~PrimitiveString() override;
@@ -67,7 +71,14 @@ protected:
     {
     }
 
+    enum class SubstringTag { Substring };
+    explicit PrimitiveString(SubstringTag)
+        : m_is_substring(true)
+    {
+    }
+
     mutable bool m_is_rope { false };
+    mutable bool m_is_substring { false };
 
     mutable Optional<String> m_utf8_string;
     mutable Optional<Utf16String> m_utf16_string;
@@ -79,13 +90,14 @@ protected:
 
 private:
     friend class RopeString;
+    friend class SubstringString;
 
     virtual void finalize() override;
 
     explicit PrimitiveString(Utf16String);
     explicit PrimitiveString(String);
 
-    void resolve_rope_if_needed(EncodingPreference) const;
+    void resolve_if_needed(EncodingPreference) const;
 };
 
 class RopeString final : public PrimitiveString {
@@ -104,8 +116,35 @@ private:
 
     void resolve(EncodingPreference) const;
 
+    size_t length_in_utf16_code_units() const;
+    static size_t length_in_utf16_code_units_of_piece(PrimitiveString const&);
+
     mutable GC::Ptr<PrimitiveString> m_lhs;
     mutable GC::Ptr<PrimitiveString> m_rhs;
+    mutable Optional<size_t> m_length_in_utf16_code_units;
+};
+
+class SubstringString final : public PrimitiveString {
+    GC_CELL(SubstringString, PrimitiveString);
+    GC_DECLARE_ALLOCATOR(SubstringString);
+
+public:
+    virtual ~SubstringString() override;
+
+private:
+    friend class PrimitiveString;
+    friend class RopeString;
+
+    explicit SubstringString(GC::Ref<PrimitiveString> base, size_t start, size_t length);
+
+    virtual void visit_edges(Visitor&) override;
+
+    Utf16View view() const;
+    void resolve() const;
+
+    mutable GC::Ptr<PrimitiveString> m_base;
+    size_t m_start { 0 };
+    size_t m_length { 0 };
 };
 
 }
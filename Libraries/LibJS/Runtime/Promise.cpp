@@ -324,6 +324,28 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
     // 8. Let rejectReaction be the PromiseReaction { [[Capability]]: resultCapability, [[Type]]: Reject, [[Handler]]: onRejectedJobCallback }.
     auto reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, result_capability, move(on_rejected_job_callback));
 
+    perform_then(fulfill_reaction, reject_reaction);
+
+    // 13. If resultCapability is undefined, then
+    if (result_capability == nullptr) {
+        // a. Return undefined.
+        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: No result PromiseCapability, returning undefined", this);
+        return js_undefined();
+    }
+
+    // 14. Else,
+    //     a. Return resultCapability.[[Promise]].
+    dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Returning Promise @ {} from result PromiseCapability @ {}", this, result_capability->promise().ptr(), result_capability.ptr());
+    return result_capability->promise();
+}
+
+// 27.2.5.4.1 PerformPromiseThen ( promise, onFulfilled, onRejected [ , resultCapability ] ), https://tc39.es/ecma262/#sec-performpromisethen
+// NB: Steps 9-12 of PerformPromiseThen, for callers that already hold the fulfill and reject reactions. A PromiseReaction
+//     is never mutated once created, so callers that react to many promises the same way may reuse the same pair.
+void Promise::perform_then(GC::Ref<PromiseReaction> fulfill_reaction, GC::Ref<PromiseReaction> reject_reaction)
+{
+    auto& vm = this->vm();
+
     switch (m_state) {
     // 9. If promise.[[PromiseState]] is pending, then
     case Promise::State::Pending:
@@ -342,7 +364,7 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
 
         // b. Let fulfillJob be NewPromiseReactionJob(fulfillReaction, value).
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: State is State::Fulfilled, creating PromiseJob for PromiseReaction @ {} with argument {}", this, fulfill_reaction.ptr(), value);
-        auto [fulfill_job, realm] = create_promise_reaction_job(vm, fulfill_reaction, value);
+        auto [fulfill_job, realm] = create_promise_reaction_job(vm, *fulfill_reaction, value);
 
         // c. Perform HostEnqueuePromiseJob(fulfillJob.[[Job]], fulfillJob.[[Realm]]).
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Enqueuing job @ {} in realm {}", this, &fulfill_job, realm.ptr());
@@ -375,18 +397,6 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
 
     // 12. Set promise.[[PromiseIsHandled]] to true.
     m_is_handled = true;
-
-    // 13. If resultCapability is undefined, then
-    if (result_capability == nullptr) {
-        // a. Return undefined.
-        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: No result PromiseCapability, returning undefined", this);
-        return js_undefined();
-    }
-
-    // 14. Else,
-    //     a. Return resultCapability.[[Promise]].
-    dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Returning Promise @ {} from result PromiseCapability @ {}", this, result_capability->promise().ptr(), result_capability.ptr());
-    return result_capability->promise();
 }
 
 void Promise::visit_edges(Cell::Visitor& visitor)
@@ -109,6 +109,7 @@ void Realm::visit_edges(Visitor& visitor)
     visitor.visit(m_global_declarative_environment);
     if (m_host_defined)
         m_host_defined->visit_edges(visitor);
+    m_for_in_cache.visit_edges(visitor);
 }
 
 }
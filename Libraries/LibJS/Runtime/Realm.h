@@ -17,6 +17,7 @@
 #include <LibJS/Bytecode/Builtins.h>
 #include <LibJS/Export.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/ForInCache.h>
 #include <LibJS/Runtime/Intrinsics.h>
 #include <LibJS/Runtime/Value.h>
 
@@ -73,6 +74,8 @@ public:
 
     HashTable<GC::RawPtr<Shape>>& all_prototype_shapes() { return m_all_prototype_shapes; }
 
+    ForInCache& for_in_cache() { return m_for_in_cache; }
+
 private:
     Realm() = default;
 
@@ -85,6 +88,8 @@ private:
     OwnPtr<HostDefined> m_host_defined;                               // [[HostDefined]]
 
     HashTable<GC::RawPtr<Shape>> m_all_prototype_shapes;
+
+    ForInCache m_for_in_cache;
 };
 
 }
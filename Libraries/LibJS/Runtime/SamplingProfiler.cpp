@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+
+namespace JS {
+
+static constexpr u32 root_node_id = 0;
+
+SamplingProfiler::SamplingProfiler(VM& vm, AK::Duration interval)
+    : m_vm(vm)
+    , m_interval(interval)
+    , m_start_time(MonotonicTime::now())
+    , m_end_time(m_start_time)
+    , m_next_sample_time(m_start_time)
+{
+    m_frames.append({ .function_name = "(root)"_string, .url = {} });
+    m_nodes.append({ .frame_id = 0 });
+}
+
+void SamplingProfiler::stop()
+{
+    m_end_time = MonotonicTime::now();
+}
+
+Optional<u32> SamplingProfiler::frame_id_for(ExecutionContext& context)
+{
+    GC::Cell const* key = context.executable.ptr();
+    if (!key)
+        key = context.function.ptr();
+    if (!key)
+        return {};
+
+    if (auto it = m_frame_ids.find(key); it != m_frame_ids.end())
+        return it->value;
+
+    Frame frame;
+    if (context.function)
+        frame.function_name = context.function->name_for_call_stack().to_utf8();
+
+    if (auto executable = context.executable) {
+        if (frame.function_name.is_empty())
+            frame.function_name = executable->name.view().to_utf8_but_should_be_ported_to_utf16();
+        frame.url = executable->source_code->filename();
+
+        // NB: The .cpuprofile format uses zero-based line and column numbers for call frames.
+        if (!executable->source_map.is_empty()) {
+            auto const& source_range = executable->get_source_range(executable->source_map.first().bytecode_offset);
+            frame.line_number = static_cast<i32>(source_range.start.line) - 1;
+            frame.column_number = static_cast<i32>(source_range.start.column) - 1;
+        }
+        m_executables.append(GC::make_root(*executable));
+    } else {
+        m_native_functions.append(GC::make_root(*context.function));
+    }
+
+    if (frame.function_name.is_empty())
+        frame.function_name = "(anonymous)"_string;
+
+    auto frame_id = static_cast<u32>(m_frames.size());
+    m_frames.append(move(frame));
+    m_frame_ids.set(key, frame_id);
+    return frame_id;
+}
+
+u32 SamplingProfiler::child_node_for(u32 parent_node_id, u32 frame_id)
+{
+    auto key = (static_cast<u64>(parent_node_id) << 32) | frame_id;
+    if (auto it = m_child_node_ids.find(key); it != m_child_node_ids.end())
+        return it->value;
+
+    auto node_id = static_cast<u32>(m_nodes.size());
+    m_nodes.append({ .frame_id = frame_id });
+    m_nodes[parent_node_id].children.append(node_id);
+    m_child_node_ids.set(key, node_id);
+    return node_id;
+}
+
+void SamplingProfiler::take_sample(MonotonicTime now)
+{
+    auto node_id = root_node_id;
+    ExecutionContext* leaf_context = nullptr;
+
+    for (auto* context : m_vm.execution_context_stack()) {
+        auto frame_id = frame_id_for(*context);
+        if (!frame_id.has_value())
+            continue;
+        node_id = child_node_for(node_id, *frame_id);
+        leaf_context = context;
+    }
+
+    auto& node = m_nodes[node_id];
+    ++node.hit_count;
+
+    // NB: Position ticks use one-based line numbers, unlike call frames.
+    if (leaf_context && leaf_context->executable && !leaf_context->executable->source_map.is_empty()) {
+        auto const& source_range = leaf_context->executable->get_source_range(leaf_context->program_counter);
+        ++node.line_ticks.ensure(source_range.start.line, [] { return 0u; });
+    }
+
+    m_samples.append(node_id);
+    m_sample_times.append(now);
+}
+
+JsonObject SamplingProfiler::to_cpuprofile() const
+{
+    JsonArray nodes;
+    nodes.ensure_capacity(m_nodes.size());
+
+    for (size_t node_id = 0; node_id < m_nodes.size(); ++node_id) {
+        auto const& node = m_nodes[node_id];
+        auto const& frame = m_frames[node.frame_id];
+
+        // https://chromedevtools.github.io/devtools-protocol/tot/Runtime/#type-CallFrame
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, frame.function_name);
+        call_frame.set("scriptId"sv, "0"sv);
+        call_frame.set("url"sv, frame.url);
+        call_frame.set("lineNumber"sv, frame.line_number);
+        call_frame.set("columnNumber"sv, frame.column_number);
+
+        JsonArray children;
+        for (auto child : node.children)
+            children.must_append(child + 1);
+
+        JsonArray position_ticks;
+        for (auto const& [line, ticks] : node.line_ticks) {
+            JsonObject position_tick;
+            position_tick.set("line"sv, line);
+            position_tick.set("ticks"sv, ticks);
+            position_ticks.must_append(move(position_tick));
+        }
+
+        // https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-ProfileNode
+        // NB: Node IDs in the .cpuprofile format must be positive.
+        JsonObject profile_node;
+        profile_node.set("id"sv, node_id + 1);
+        profile_node.set("callFrame"sv, move(call_frame));
+        profile_node.set("hitCount"sv, node.hit_count);
+        profile_node.set("children"sv, move(children));
+        profile_node.set("positionTicks"sv, move(position_ticks));
+        nodes.must_append(move(profile_node));
+    }
+
+    JsonArray samples;
+    JsonArray time_deltas;
+    samples.ensure_capacity(m_samples.size());
+    time_deltas.ensure_capacity(m_samples.size());
+
+    auto previous_time = m_start_time;
+    for (size_t i = 0; i < m_samples.size(); ++i) {
+        samples.must_append(m_samples[i] + 1);
+        time_deltas.must_append((m_sample_times[i] - previous_time).to_microseconds());
+        previous_time = m_sample_times[i];
+    }
+
+    auto end_time = max(m_end_time, previous_time);
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, m_start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, end_time.nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile;
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/Noncopyable.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibGC/Root.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+
+namespace JS {
+
+// Records the JavaScript call stack at a fixed interval, and exports the result in the .cpuprofile format understood
+// by Chrome DevTools and most other JavaScript profile viewers.
+//
+// NB: Samples are not taken from a signal handler, as the execution context stack can't be walked safely from one.
+//     Instead, the VM calls sample_if_due() at its profiler safe points: whenever an execution context is pushed, and
+//     whenever either interpreter leaves its fast path for an instruction. The leaf frame is attributed to the source
+//     line of the last program counter the interpreter stored in its execution context.
+class JS_API SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static constexpr AK::Duration default_interval = AK::Duration::from_microseconds(1000);
+
+    SamplingProfiler(VM&, AK::Duration interval);
+
+    void sample_if_due()
+    {
+        auto now = MonotonicTime::now();
+        if (now < m_next_sample_time)
+            return;
+        take_sample(now);
+        m_next_sample_time = now + m_interval;
+    }
+
+    void stop();
+
+    size_t sample_count() const { return m_samples.size(); }
+
+    // https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-Profile
+    JsonObject to_cpuprofile() const;
+
+private:
+    struct Frame {
+        String function_name;
+        String url;
+        i32 line_number { -1 };
+        i32 column_number { -1 };
+    };
+
+    struct Node {
+        u32 frame_id { 0 };
+        u32 hit_count { 0 };
+        Vector<u32> children;
+        HashMap<u32, u32> line_ticks;
+    };
+
+    NEVER_INLINE void take_sample(MonotonicTime now);
+    Optional<u32> frame_id_for(ExecutionContext&);
+    u32 child_node_for(u32 parent_node_id, u32 frame_id);
+
+    VM& m_vm;
+    AK::Duration m_interval;
+    MonotonicTime m_start_time;
+    MonotonicTime m_end_time;
+    MonotonicTime m_next_sample_time;
+
+    Vector<Frame> m_frames;
+    HashMap<GC::Cell const*, u32> m_frame_ids;
+
+    // NB: Frames are identified by the executable or native function they describe, so we keep those alive for as
+    //     long as the profile is, to prevent their addresses from being reused by another cell.
+    Vector<GC::Root<Bytecode::Executable>> m_executables;
+    Vector<GC::Root<FunctionObject>> m_native_functions;
+
+    Vector<Node> m_nodes;
+    HashMap<u64, u32> m_child_node_ids;
+
+    Vector<u32> m_samples;
+    Vector<MonotonicTime> m_sample_times;
+};
+
+}
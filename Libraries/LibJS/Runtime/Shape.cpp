@@ -15,6 +15,119 @@ namespace JS {
 GC_DEFINE_ALLOCATOR(Shape);
 GC_DEFINE_ALLOCATOR(PrototypeChainValidity);
 
+NonnullRefPtr<PropertyTable> PropertyTable::clone_prefix(u32 count) const
+{
+    VERIFY(count <= m_entries.size());
+    auto table = create();
+    table->m_entries.ensure_capacity(count);
+    for (u32 i = 0; i < count; ++i)
+        table->m_entries.unchecked_append(m_entries[i]);
+    table->rebuild_index();
+    return table;
+}
+
+u32 PropertyTable::home_slot(PropertyKey const& key) const
+{
+    return Traits<PropertyKey>::hash(key) & (m_index.size() - 1);
+}
+
+Optional<u32> PropertyTable::find(PropertyKey const& key, u32 count) const
+{
+    if (m_index.is_empty()) {
+        for (u32 i = 0; i < count; ++i) {
+            if (m_entries[i].key == key)
+                return i;
+        }
+        return {};
+    }
+
+    u32 mask = m_index.size() - 1;
+    for (auto slot = home_slot(key); m_index[slot] != 0; slot = (slot + 1) & mask) {
+        auto entry_index = m_index[slot] - 1;
+        if (m_entries[entry_index].key != key)
+            continue;
+        // Entries past `count` belong to shapes further down the transition chain.
+        if (entry_index >= count)
+            return {};
+        return entry_index;
+    }
+    return {};
+}
+
+void PropertyTable::append(PropertyKey const& key, PropertyMetadata metadata)
+{
+    m_entries.append({ key, metadata });
+    if (m_entries.size() <= max_entries_without_index)
+        return;
+    // Keep the index at most half full, so that probe sequences stay short.
+    if (m_entries.size() * 2 > m_index.size()) {
+        rebuild_index();
+        return;
+    }
+    insert_into_index(m_entries.size() - 1);
+}
+
+void PropertyTable::remove_at(u32 index)
+{
+    // Removing the most recently added property is common (e.g. objects used as stacks or scratch maps),
+    // and doesn't disturb the position of any other entry.
+    if (index == m_entries.size() - 1) {
+        if (!m_index.is_empty())
+            remove_from_index(index);
+        m_entries.take_last();
+        return;
+    }
+
+    auto removed_offset = m_entries[index].value.offset;
+    m_entries.remove(index);
+    for (auto& entry : m_entries) {
+        VERIFY(entry.value.offset != removed_offset);
+        if (entry.value.offset > removed_offset)
+            --entry.value.offset;
+    }
+    rebuild_index();
+}
+
+void PropertyTable::insert_into_index(u32 entry_index)
+{
+    u32 mask = m_index.size() - 1;
+    for (auto slot = home_slot(m_entries[entry_index].key);; slot = (slot + 1) & mask) {
+        if (m_index[slot] == 0) {
+            m_index[slot] = entry_index + 1;
+            return;
+        }
+    }
+}
+
+void PropertyTable::remove_from_index(u32 entry_index)
+{
+    u32 mask = m_index.size() - 1;
+    auto slot = home_slot(m_entries[entry_index].key);
+    while (m_index[slot] != entry_index + 1)
+        slot = (slot + 1) & mask;
+    m_index[slot] = 0;
+
+    // Re-insert the rest of the probe cluster, so that nothing after the emptied slot becomes unreachable.
+    for (slot = (slot + 1) & mask; m_index[slot] != 0; slot = (slot + 1) & mask) {
+        auto displaced_entry_index = m_index[slot] - 1;
+        m_index[slot] = 0;
+        insert_into_index(displaced_entry_index);
+    }
+}
+
+void PropertyTable::rebuild_index()
+{
+    m_index.clear();
+    if (m_entries.size() <= max_entries_without_index)
+        return;
+    size_t capacity = 16;
+    while (capacity < m_entries.size() * 2)
+        capacity *= 2;
+    m_index.resize(capacity);
+    for (u32 i = 0; i < m_entries.size(); ++i)
+        insert_into_index(i);
+}
+
 Shape::~Shape() = default;
 
 void Shape::finalize()
@@ -31,9 +144,8 @@ GC::Ref<Shape> Shape::create_dictionary_transition()
     new_shape->m_prototype = m_prototype;
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
     ensure_property_table();
-    new_shape->ensure_property_table();
-    (*new_shape->m_property_table) = *m_property_table;
-    new_shape->m_property_count = new_shape->m_property_table->size();
+    new_shape->m_property_table = m_property_table->clone_prefix(m_property_count);
+    new_shape->m_property_count = m_property_count;
     return new_shape;
 }
 
@@ -179,9 +291,6 @@ void Shape::visit_edges(Cell::Visitor& visitor)
     if (m_property_key.has_value())
         m_property_key->visit_edges(visitor);
 
-    // NOTE: We don't need to mark the keys in the property table, since they are guaranteed
-    //       to also be marked by the chain of shapes leading up to this one.
-
     visitor.ignore(m_prototype_transitions);
 
     // FIXME: The forward transition keys should be weak, but we have to mark them for now in case they go stale.
@@ -199,8 +308,8 @@ void Shape::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_prototype_chain_validity);
 
     if (m_property_table) {
-        for (auto& it : *m_property_table)
-            it.key.visit_edges(visitor);
+        for (auto& entry : m_property_table->entries(m_property_count))
+            entry.key.visit_edges(visitor);
     }
 }
 
@@ -208,62 +317,81 @@ Optional<PropertyMetadata> Shape::lookup(PropertyKey const& property_key) const
 {
     if (m_property_count == 0)
         return {};
-    auto property = property_table().get(property_key);
-    if (!property.has_value())
+    ensure_property_table();
+    auto index = m_property_table->find(property_key, m_property_count);
+    if (!index.has_value())
         return {};
-    return property;
+    return m_property_table->entry_at(*index).value;
 }
 
-FLATTEN OrderedHashMap<PropertyKey, PropertyMetadata> const& Shape::property_table() const
+FLATTEN ReadonlySpan<PropertyTableEntry> Shape::property_table() const
 {
     ensure_property_table();
-    return *m_property_table;
+    return m_property_table->entries(m_property_count);
 }
 
 void Shape::ensure_property_table() const
 {
     if (m_property_table)
         return;
-    m_property_table = make<OrderedHashMap<PropertyKey, PropertyMetadata>>();
 
-    u32 next_offset = 0;
+    bool only_put_transitions = true;
+    Shape const* shape_with_table = nullptr;
 
     Vector<Shape const&, 64> transition_chain;
-    transition_chain.append(*this);
-    for (auto shape = m_previous; shape; shape = shape->m_previous) {
-        if (shape->m_property_table) {
-            *m_property_table = *shape->m_property_table;
-            next_offset = shape->m_property_count;
+    for (auto const* shape = this; shape; shape = shape->m_previous.ptr()) {
+        if (shape != this && shape->m_property_table) {
+            shape_with_table = shape;
             break;
         }
+        if (shape->m_property_key.has_value() && shape->m_transition_type != TransitionType::Put)
+            only_put_transitions = false;
         transition_chain.append(*shape);
     }
 
+    u32 next_offset = 0;
+    if (shape_with_table) {
+        // If only new properties were added since the nearest shape with a table, and no other shape has appended
+        // to that table yet, we can append to it in place and share it instead of copying all of its entries.
+        auto& table = *shape_with_table->m_property_table;
+        if (only_put_transitions && table.size() == shape_with_table->m_property_count)
+            m_property_table = table;
+        else
+            m_property_table = table.clone_prefix(shape_with_table->m_property_count);
+        next_offset = shape_with_table->m_property_count;
+    } else {
+        m_property_table = PropertyTable::create();
+    }
+
+    auto& table = *m_property_table;
     for (auto const& shape : transition_chain.in_reverse()) {
         if (!shape.m_property_key.has_value()) {
             // Ignore prototype transitions as they don't affect the key map.
             continue;
         }
         if (shape.m_transition_type == TransitionType::Put) {
-            m_property_table->set(*shape.m_property_key, { next_offset++, shape.m_attributes });
+            table.append(*shape.m_property_key, { next_offset++, shape.m_attributes });
         } else if (shape.m_transition_type == TransitionType::Configure) {
-            auto it = m_property_table->find(*shape.m_property_key);
-            VERIFY(it != m_property_table->end());
-            it->value.attributes = shape.m_attributes;
+            auto index = table.find(*shape.m_property_key, table.size());
+            VERIFY(index.has_value());
+            table.entry_at(*index).value.attributes = shape.m_attributes;
         } else if (shape.m_transition_type == TransitionType::Delete) {
-            auto remove_it = m_property_table->find(*shape.m_property_key);
-            VERIFY(remove_it != m_property_table->end());
-            auto removed_offset = remove_it->value.offset;
-            m_property_table->remove(remove_it);
-            for (auto& it : *m_property_table) {
-                if (it.value.offset > removed_offset)
-                    --it.value.offset;
-            }
+            auto index = table.find(*shape.m_property_key, table.size());
+            VERIFY(index.has_value());
+            table.remove_at(*index);
             --next_offset;
         }
     }
 }
 
+void Shape::ensure_unique_property_table()
+{
+    ensure_property_table();
+    // Tables may be shared with other shapes along the transition chain, so copy before changing anything in place.
+    if (m_property_table->ref_count() > 1 || m_property_table->size() != m_property_count)
+        m_property_table = m_property_table->clone_prefix(m_property_count);
+}
+
 GC::Ref<Shape> Shape::create_delete_transition(PropertyKey const& property_key)
 {
     if (auto existing_shape = get_or_prune_cached_delete_transition(property_key))
@@ -279,23 +407,26 @@ GC::Ref<Shape> Shape::create_delete_transition(PropertyKey const& property_key)
 void Shape::add_property_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
 {
     invalidate_prototype_if_needed_for_change_without_transition();
-    ensure_property_table();
-    if (m_property_table->set(property_key, { m_property_count, attributes }) == AK::HashSetResult::InsertedNewEntry) {
-        VERIFY(m_property_count < NumericLimits<u32>::max());
-        ++m_property_count;
+    ensure_unique_property_table();
+    if (auto index = m_property_table->find(property_key, m_property_count); index.has_value()) {
+        m_property_table->entry_at(*index).value.attributes = attributes;
         ++m_dictionary_generation;
+        return;
     }
+    VERIFY(m_property_count < NumericLimits<u32>::max());
+    m_property_table->append(property_key, { m_property_count, attributes });
+    ++m_property_count;
+    ++m_dictionary_generation;
 }
 
 void Shape::set_property_attributes_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
 {
     invalidate_prototype_if_needed_for_change_without_transition();
     VERIFY(is_dictionary());
-    VERIFY(m_property_table);
-    auto it = m_property_table->find(property_key);
-    VERIFY(it != m_property_table->end());
-    it->value.attributes = attributes;
-    m_property_table->set(property_key, it->value);
+    ensure_unique_property_table();
+    auto index = m_property_table->find(property_key, m_property_count);
+    VERIFY(index.has_value());
+    m_property_table->entry_at(*index).value.attributes = attributes;
     ++m_dictionary_generation;
 }
 
@@ -303,13 +434,11 @@ void Shape::remove_property_without_transition(PropertyKey const& property_key,
 {
     invalidate_prototype_if_needed_for_change_without_transition();
     VERIFY(is_dictionary());
-    VERIFY(m_property_table);
-    if (m_property_table->remove(property_key))
+    ensure_unique_property_table();
+    if (auto index = m_property_table->find(property_key, m_property_count); index.has_value()) {
+        VERIFY(m_property_table->entry_at(*index).value.offset == offset);
+        m_property_table->remove_at(*index);
         --m_property_count;
-    for (auto& it : *m_property_table) {
-        VERIFY(it.value.offset != offset);
-        if (it.value.offset > offset)
-            --it.value.offset;
     }
     ++m_dictionary_generation;
 }
@@ -323,9 +452,8 @@ GC::Ref<Shape> Shape::clone_for_prototype()
     new_shape->m_is_prototype_shape = true;
     new_shape->m_prototype = m_prototype;
     ensure_property_table();
-    new_shape->ensure_property_table();
-    (*new_shape->m_property_table) = *m_property_table;
-    new_shape->m_property_count = new_shape->m_property_table->size();
+    new_shape->m_property_table = m_property_table->clone_prefix(m_property_count);
+    new_shape->m_property_count = m_property_count;
     new_shape->m_prototype_chain_validity = heap().allocate<PrototypeChainValidity>();
     return new_shape;
 }
@@ -9,6 +9,8 @@
 
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
 #include <AK/StringView.h>
 #include <AK/Weakable.h>
 #include <LibGC/Weak.h>
@@ -27,6 +29,49 @@ struct PropertyMetadata {
     PropertyAttributes attributes { 0 };
 };
 
+struct PropertyTableEntry {
+    PropertyKey key;
+    PropertyMetadata value;
+};
+
+// An insertion-ordered map of property keys to their metadata. Entries are kept in a flat vector, and once there
+// are more than a handful of them, an open-addressed index of entry positions is kept alongside for lookups.
+// A chain of shapes that only ever adds properties shares a single table, with each shape seeing the entries
+// up to its own property count.
+class PropertyTable : public RefCounted<PropertyTable> {
+public:
+    static NonnullRefPtr<PropertyTable> create() { return adopt_ref(*new PropertyTable); }
+
+    [[nodiscard]] NonnullRefPtr<PropertyTable> clone_prefix(u32 count) const;
+
+    [[nodiscard]] u32 size() const { return m_entries.size(); }
+    [[nodiscard]] ReadonlySpan<PropertyTableEntry> entries(u32 count) const { return m_entries.span().trim(count); }
+
+    PropertyTableEntry& entry_at(u32 index) { return m_entries[index]; }
+    PropertyTableEntry const& entry_at(u32 index) const { return m_entries[index]; }
+
+    // Returns the position of the entry for the given key, if it is among the first `count` entries.
+    [[nodiscard]] Optional<u32> find(PropertyKey const&, u32 count) const;
+
+    void append(PropertyKey const&, PropertyMetadata);
+    void remove_at(u32 index);
+
+private:
+    PropertyTable() = default;
+
+    static constexpr size_t max_entries_without_index = 8;
+
+    [[nodiscard]] u32 home_slot(PropertyKey const&) const;
+    void insert_into_index(u32 entry_index);
+    void remove_from_index(u32 entry_index);
+    void rebuild_index();
+
+    Vector<PropertyTableEntry> m_entries;
+
+    // Entry position + 1 for each occupied slot, 0 for empty ones. Empty while the table is small.
+    Vector<u32> m_index;
+};
+
 struct TransitionKey {
     PropertyKey property_key;
     PropertyAttributes attributes { 0 };
@@ -101,7 +146,7 @@ public:
     Object const* prototype() const { return m_prototype; }
 
     Optional<PropertyMetadata> lookup(PropertyKey const&) const;
-    OrderedHashMap<PropertyKey, PropertyMetadata> const& property_table() const;
+    ReadonlySpan<PropertyTableEntry> property_table() const;
     u32 property_count() const { return m_property_count; }
 
     void set_prototype_without_transition(Object* new_prototype);
@@ -124,6 +169,7 @@ private:
     [[nodiscard]] GC::Ptr<Shape> get_or_prune_cached_delete_transition(PropertyKey const&);
 
     void ensure_property_table() const;
+    void ensure_unique_property_table();
 
     PropertyAttributes m_attributes { 0 };
     TransitionType m_transition_type { TransitionType::Invalid };
@@ -133,7 +179,7 @@ private:
 
     GC::Ref<Realm> m_realm;
 
-    mutable OwnPtr<OrderedHashMap<PropertyKey, PropertyMetadata>> m_property_table;
+    mutable RefPtr<PropertyTable> m_property_table;
 
     OwnPtr<HashMap<TransitionKey, GC::Weak<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<GC::Ptr<Object>, GC::Weak<Shape>>> m_prototype_transitions;
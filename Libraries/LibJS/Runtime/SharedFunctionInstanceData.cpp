@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibGC/Heap.h>
 #include <LibJS/Runtime/SharedFunctionInstanceData.h>
 #include <LibJS/RustIntegration.h>
 
@@ -59,6 +60,32 @@ void SharedFunctionInstanceData::finalize()
     m_rust_function_ast = nullptr;
 }
 
+void SharedFunctionInstanceData::dump_lazy_compilation_statistics(GC::Heap& heap)
+{
+    size_t function_count = 0;
+    size_t compiled_function_count = 0;
+    size_t uncompiled_function_count = 0;
+    size_t uncompiled_source_code_units = 0;
+
+    heap.for_each_live_cell([&](GC::Cell* cell) {
+        auto const* shared_data = as_if<SharedFunctionInstanceData>(*cell);
+        if (!shared_data)
+            return;
+        ++function_count;
+        if (shared_data->m_executable) {
+            ++compiled_function_count;
+        } else if (shared_data->m_rust_function_ast) {
+            ++uncompiled_function_count;
+            uncompiled_source_code_units += shared_data->m_source_text.length_in_code_units();
+        }
+    });
+
+    dbgln("Lazy compilation statistics");
+    dbgln("    Functions: {}", function_count);
+    dbgln("    Compiled: {}", compiled_function_count);
+    dbgln("    Never called: {} ({} code units of source text with a retained AST)", uncompiled_function_count, uncompiled_source_code_units);
+}
+
 void SharedFunctionInstanceData::clear_compile_inputs()
 {
     VERIFY(m_executable);
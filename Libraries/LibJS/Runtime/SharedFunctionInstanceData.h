@@ -139,6 +139,10 @@ public:
 
     void clear_compile_inputs();
 
+    // Prints how many live functions have been compiled to bytecode, and how many (and how much source text)
+    // are still waiting for their first call while holding on to their parsed AST.
+    static void dump_lazy_compilation_statistics(GC::Heap&);
+
 private:
     virtual void visit_edges(Visitor&) override;
 };
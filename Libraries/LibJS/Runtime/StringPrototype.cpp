@@ -20,6 +20,7 @@
 #include <LibJS/Runtime/Intl/Collator.h>
 #include <LibJS/Runtime/Intl/CollatorCompareFunction.h>
 #include <LibJS/Runtime/Intl/CollatorConstructor.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
 #include <LibJS/Runtime/PrimitiveString.h>
 #include <LibJS/Runtime/RegExpObject.h>
 #include <LibJS/Runtime/RegExpPrototype.h>
@@ -636,7 +637,8 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::locale_compare)
         }
         collator = realm.intrinsics().default_collator();
     } else {
-        collator = TRY(construct(vm, realm.intrinsics().intl_collator_constructor(), locales, options));
+        // OPTIMIZATION: The Collator is reused from an earlier call when constructing it is unobservable.
+        collator = TRY(Intl::collator_for_locale_compare(vm, locales, options));
     }
 
     // 5. Return CompareStrings(collator, S, thatValue).
@@ -1147,7 +1149,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::slice)
         return PrimitiveString::create(vm, String {});
 
     // 13. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, string->utf16_string_view().substring_view(int_start, int_end - int_start));
+    return PrimitiveString::create_substring(vm, *string, int_start, int_end - int_start);
 }
 
 // 22.1.3.23 String.prototype.split ( separator, limit ), https://tc39.es/ecma262/#sec-string.prototype.split
@@ -1345,7 +1347,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substring)
     size_t to = max(final_start, final_end);
 
     // 10. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, string->utf16_string_view().substring_view(from, to - from));
+    return PrimitiveString::create_substring(vm, *string, from, to - from);
 }
 
 enum class TargetCase {
@@ -1588,7 +1590,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substr)
         return PrimitiveString::create(vm, String {});
 
     // 11. Return the substring of S from intStart to intEnd.
-    return PrimitiveString::create(vm, string->utf16_string_view().substring_view(int_start, int_end - int_start));
+    return PrimitiveString::create_substring(vm, *string, int_start, int_end - int_start);
 }
 
 // B.2.2.2.1 CreateHTML ( string, tag, attribute, value ), https://tc39.es/ecma262/#sec-createhtml
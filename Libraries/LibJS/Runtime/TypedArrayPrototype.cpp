@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/SIMDExtras.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -14,6 +15,7 @@
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/TypedArrayPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <math.h>
 
 namespace JS {
 
@@ -503,6 +505,19 @@ inline void fast_typed_array_fill(TypedArrayBase& typed_array, u32 begin, u32 en
         *(slot++) = value;
 }
 
+template<typename T>
+static void fast_typed_array_fill_with_value(VM& vm, TypedArrayBase& typed_array, u32 begin, u32 end, Value value)
+{
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+
+    AK::Array<u8, sizeof(UnderlyingBufferDataType)> raw_bytes;
+    numeric_to_raw_bytes<T>(vm, value, true, raw_bytes);
+
+    UnderlyingBufferDataType raw_value;
+    __builtin_memcpy(&raw_value, raw_bytes.data(), sizeof(raw_value));
+    fast_typed_array_fill<UnderlyingBufferDataType>(typed_array, begin, end, raw_value);
+}
+
 // 23.2.3.9 %TypedArray%.prototype.fill ( value [ , start [ , end ] ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.fill
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
 {
@@ -571,51 +586,19 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
     // 17. Set final to min(final, len).
     final = min(final, length);
 
-    if (value.is_int32()) {
-        switch (typed_array->kind()) {
-        case TypedArrayBase::Kind::Uint8Array:
-            fast_typed_array_fill<u8>(*typed_array, k, final, static_cast<u8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint16Array:
-            fast_typed_array_fill<u16>(*typed_array, k, final, static_cast<u16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint32Array:
-            fast_typed_array_fill<u32>(*typed_array, k, final, static_cast<u32>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int8Array:
-            fast_typed_array_fill<i8>(*typed_array, k, final, static_cast<i8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int16Array:
-            fast_typed_array_fill<i16>(*typed_array, k, final, static_cast<i16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int32Array:
-            fast_typed_array_fill<i32>(*typed_array, k, final, value.as_i32());
-            return typed_array;
-        case TypedArrayBase::Kind::Uint8ClampedArray:
-            fast_typed_array_fill<u8>(*typed_array, k, final, clamp(value.as_i32(), 0, 255));
-            return typed_array;
-        default:
-            // FIXME: Support more TypedArray kinds.
-            break;
-        }
-    }
-
     // 18. Repeat, while k < final,
-    while (k < final) {
-        // a. Let Pk be ! ToString(𝔽(k)).
-        // b. Perform ! Set(O, Pk, value, true).
-        CanonicalIndex canonical_index { CanonicalIndex::Type::Index, k };
-        switch (typed_array->kind()) {
+    //     a. Let Pk be ! ToString(𝔽(k)).
+    //     b. Perform ! Set(O, Pk, value, true).
+    //     c. Set k to k + 1.
+    // OPTIMIZATION: value has already been converted, so every element ends up with the same raw bytes. Encode them
+    //               once and fill the buffer directly.
+    switch (typed_array->kind()) {
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
     case TypedArrayBase::Kind::ClassName:                                           \
-        (void)typed_array_set_element<Type>(*typed_array, canonical_index, value);  \
+        fast_typed_array_fill_with_value<Type>(vm, *typed_array, k, final, value);  \
         break;
-            JS_ENUMERATE_TYPED_ARRAYS
+        JS_ENUMERATE_TYPED_ARRAYS
 #undef __JS_ENUMERATE
-        }
-
-        // c. Set k to k + 1.
-        ++k;
     }
 
     // 19. Return O.
@@ -871,6 +854,209 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::for_each)
     return js_undefined();
 }
 
+template<typename T>
+struct SIMDVectorFor;
+
+template<>
+struct SIMDVectorFor<u8> {
+    using Type = AK::SIMD::u8x16;
+};
+
+template<>
+struct SIMDVectorFor<i8> {
+    using Type = AK::SIMD::i8x16;
+};
+
+template<>
+struct SIMDVectorFor<u16> {
+    using Type = AK::SIMD::u16x8;
+};
+
+template<>
+struct SIMDVectorFor<i16> {
+    using Type = AK::SIMD::i16x8;
+};
+
+template<>
+struct SIMDVectorFor<u32> {
+    using Type = AK::SIMD::u32x4;
+};
+
+template<>
+struct SIMDVectorFor<i32> {
+    using Type = AK::SIMD::i32x4;
+};
+
+template<>
+struct SIMDVectorFor<float> {
+    using Type = AK::SIMD::f32x4;
+};
+
+template<>
+struct SIMDVectorFor<double> {
+    using Type = AK::SIMD::f64x2;
+};
+
+template<typename MaskType>
+ALWAYS_INLINE static bool any_lane_set(MaskType mask)
+{
+    auto bits = bit_cast<AK::SIMD::u64x2>(mask);
+    return (bits[0] | bits[1]) != 0;
+}
+
+// NB: These compare with ==, so +0 matches -0 and NaN never matches, just like IsStrictlyEqual.
+template<typename T>
+static i64 find_first_element(T const* elements, u32 begin, u32 end, T needle)
+{
+    using VectorType = typename SIMDVectorFor<T>::Type;
+    constexpr u32 lanes = AK::SIMD::vector_length<VectorType>;
+
+    VectorType needles = VectorType {} + needle;
+    u32 i = begin;
+    for (; end - i >= lanes; i += lanes) {
+        if (any_lane_set(AK::SIMD::load_unaligned<VectorType>(elements + i) == needles))
+            break;
+    }
+    for (; i < end; ++i) {
+        if (elements[i] == needle)
+            return i;
+    }
+    return -1;
+}
+
+template<typename T>
+static i64 find_last_element(T const* elements, u32 begin, u32 end, T needle)
+{
+    using VectorType = typename SIMDVectorFor<T>::Type;
+    constexpr u32 lanes = AK::SIMD::vector_length<VectorType>;
+
+    VectorType needles = VectorType {} + needle;
+    u32 i = end;
+    for (; i - begin >= lanes; i -= lanes) {
+        if (any_lane_set(AK::SIMD::load_unaligned<VectorType>(elements + i - lanes) == needles))
+            break;
+    }
+    while (i > begin) {
+        --i;
+        if (elements[i] == needle)
+            return i;
+    }
+    return -1;
+}
+
+template<typename T>
+static i64 find_first_nan_element(T const* elements, u32 begin, u32 end)
+{
+    using VectorType = typename SIMDVectorFor<T>::Type;
+    constexpr u32 lanes = AK::SIMD::vector_length<VectorType>;
+
+    u32 i = begin;
+    for (; end - i >= lanes; i += lanes) {
+        auto chunk = AK::SIMD::load_unaligned<VectorType>(elements + i);
+        if (any_lane_set(chunk != chunk))
+            break;
+    }
+    for (; i < end; ++i) {
+        if (isnan(elements[i]))
+            return i;
+    }
+    return -1;
+}
+
+// Returns the element of type T that is numerically equal to number, if there is one.
+template<typename T>
+static Optional<T> element_with_exact_value(double number)
+{
+    if (isnan(number))
+        return {};
+
+    if constexpr (IsFloatingPoint<T>) {
+        if (!isinf(number) && fabs(number) > static_cast<double>(NumericLimits<T>::max()))
+            return {};
+    } else {
+        if (number < static_cast<double>(NumericLimits<T>::min()) || number > static_cast<double>(NumericLimits<T>::max()))
+            return {};
+    }
+
+    auto element = static_cast<T>(number);
+    if (static_cast<double>(element) != number)
+        return {};
+    return element;
+}
+
+enum class SearchDirection {
+    Forward,
+    Backward,
+};
+
+enum class NaNMatches {
+    No,
+    Yes,
+};
+
+template<typename T>
+static i64 search_elements(u8 const* data, u32 begin, u32 end, double number, SearchDirection direction, NaNMatches nan_matches)
+{
+    auto const* elements = reinterpret_cast<T const*>(data);
+
+    if constexpr (IsFloatingPoint<T>) {
+        // SameValueZero treats NaN as equal to itself, which only includes() uses, so this only needs to search forward.
+        if (isnan(number))
+            return nan_matches == NaNMatches::Yes ? find_first_nan_element(elements, begin, end) : -1;
+    }
+
+    auto needle = element_with_exact_value<T>(number);
+    if (!needle.has_value())
+        return -1;
+
+    if (direction == SearchDirection::Forward)
+        return find_first_element(elements, begin, end, *needle);
+    return find_last_element(elements, begin, end, *needle);
+}
+
+// OPTIMIZATION: Searches the element storage directly for a Number, instead of doing Get() and a Value comparison for
+//               every index. Elements in [begin, end) that are no longer in bounds read as undefined, which never
+//               matches a Number, so only the part of the range that is still in bounds has to be searched.
+//               Returns -1 if there is no match, or an empty Optional if the caller has to use the generic loop.
+static Optional<i64> fast_typed_array_search(TypedArrayBase& typed_array, Value search_element, u32 begin, u32 end, SearchDirection direction, NaNMatches nan_matches)
+{
+    if (!search_element.is_number() || typed_array.content_type() != TypedArrayBase::ContentType::Number)
+        return {};
+
+    auto typed_array_record = make_typed_array_with_buffer_witness_record(typed_array, ArrayBuffer::Order::Unordered);
+    if (is_typed_array_out_of_bounds(typed_array_record))
+        return -1;
+
+    end = min(end, typed_array_length(typed_array_record));
+    if (begin >= end)
+        return -1;
+
+    auto const* data = typed_array.viewed_array_buffer()->buffer().data() + typed_array.byte_offset();
+    auto number = search_element.as_double();
+
+    switch (typed_array.kind()) {
+    case TypedArrayBase::Kind::Uint8Array:
+    case TypedArrayBase::Kind::Uint8ClampedArray:
+        return search_elements<u8>(data, begin, end, number, direction, nan_matches);
+    case TypedArrayBase::Kind::Int8Array:
+        return search_elements<i8>(data, begin, end, number, direction, nan_matches);
+    case TypedArrayBase::Kind::Uint16Array:
+        return search_elements<u16>(data, begin, end, number, direction, nan_matches);
+    case TypedArrayBase::Kind::Int16Array:
+        return search_elements<i16>(data, begin, end, number, direction, nan_matches);
+    case TypedArrayBase::Kind::Uint32Array:
+        return search_elements<u32>(data, begin, end, number, direction, nan_matches);
+    case TypedArrayBase::Kind::Int32Array:
+        return search_elements<i32>(data, begin, end, number, direction, nan_matches);
+    case TypedArrayBase::Kind::Float32Array:
+        return search_elements<float>(data, begin, end, number, direction, nan_matches);
+    case TypedArrayBase::Kind::Float64Array:
+        return search_elements<double>(data, begin, end, number, direction, nan_matches);
+    default:
+        return {};
+    }
+}
+
 // 23.2.3.16 %TypedArray%.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
 {
@@ -923,6 +1109,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
         k = relative_k;
     }
 
+    if (auto result = fast_typed_array_search(*typed_array, search_element, k, length, SearchDirection::Forward, NaNMatches::Yes); result.has_value())
+        return Value { *result >= 0 };
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let elementK be ! Get(O, ! ToString(𝔽(k))).
@@ -992,6 +1181,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
         k = relative_k;
     }
 
+    if (auto result = fast_typed_array_search(*typed_array, search_element, k, length, SearchDirection::Forward, NaNMatches::No); result.has_value())
+        return Value { static_cast<double>(*result) };
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1129,6 +1321,11 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::last_index_of)
         k = relative_k;
     }
 
+    if (k >= 0) {
+        if (auto result = fast_typed_array_search(*typed_array, search_element, 0, static_cast<u32>(k) + 1, SearchDirection::Backward, NaNMatches::No); result.has_value())
+            return Value { static_cast<double>(*result) };
+    }
+
     // 9. Repeat, while k ≥ 0,
     while (k >= 0) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1527,6 +1724,29 @@ static ThrowCompletionOr<void> set_typed_array_from_typed_array(VM& vm, TypedArr
 }
 
 // 23.2.3.26.2 SetTypedArrayFromArrayLike ( target, targetOffset, source ), https://tc39.es/ecma262/#sec-settypedarrayfromarraylike
+// Copies the leading elements of a packed array that can be converted without side effects, and returns how many
+// elements were copied.
+template<typename T>
+static size_t fast_set_typed_array_from_packed_array(VM& vm, TypedArrayBase& target, size_t target_offset, Array const& source, size_t source_length)
+{
+    using UnderlyingBufferDataType = Conditional<IsSame<ClampedU8, T>, u8, T>;
+
+    auto source_elements = source.indexed_packed_elements_span();
+    auto count = min(source_length, source_elements.size());
+    bool const is_bigint = target.content_type() == TypedArrayBase::ContentType::BigInt;
+
+    auto* data = target.viewed_array_buffer()->buffer().data() + target.byte_offset() + target_offset * sizeof(UnderlyingBufferDataType);
+
+    size_t k = 0;
+    for (; k < count; ++k) {
+        auto value = source_elements[k];
+        if (is_bigint ? !value.is_bigint() : !value.is_number())
+            break;
+        numeric_to_raw_bytes<T>(vm, value, true, Bytes { data + k * sizeof(UnderlyingBufferDataType), sizeof(UnderlyingBufferDataType) });
+    }
+    return k;
+}
+
 static ThrowCompletionOr<void> set_typed_array_from_array_like(VM& vm, TypedArrayBase& target, double target_offset, Value source)
 {
     // 1. Let targetRecord be MakeTypedArrayWithBufferWitnessRecord(target, seq-cst)
@@ -1562,6 +1782,20 @@ static ThrowCompletionOr<void> set_typed_array_from_array_like(VM& vm, TypedArra
     // 8. Let k be 0.
     size_t k = 0;
 
+    // OPTIMIZATION: Numbers (and BigInts for BigInt arrays) in a packed array can be stored without going through Get()
+    //               and TypedArraySetElement(), as converting them can't run user code. We fall back to the generic
+    //               loop below at the first element that needs a conversion with side effects.
+    if (auto* source_array = as_if<Array>(*source_object); source_array && source_array->is_simple_packed_array()) {
+        switch (target.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type)                                                     \
+    case TypedArrayBase::Kind::ClassName:                                                                                               \
+        k = fast_set_typed_array_from_packed_array<Type>(vm, target, static_cast<size_t>(target_offset), *source_array, source_length); \
+        break;
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+        }
+    }
+
     // 9. Repeat, while k < srcLength,
     while (k < source_length) {
         // a. Let Pk be ! ToString(𝔽(k)).
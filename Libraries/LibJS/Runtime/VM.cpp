@@ -16,6 +16,7 @@
 #include <LibFileSystem/FileSystem.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/CompiledScriptCache.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
@@ -29,6 +30,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
 #include <LibJS/Runtime/VM.h>
@@ -79,9 +81,11 @@ VM::VM(ErrorMessages error_messages)
 {
     s_the = this;
     m_bytecode_interpreter = make<Bytecode::Interpreter>();
+    m_compiled_script_cache = make<CompiledScriptCache>();
 
-    m_heap.register_sweep_callback([] {
+    m_heap.register_sweep_callback([this] {
         Bytecode::StaticPropertyLookupCache::sweep_all();
+        m_megamorphic_property_cache.remove_dead_entries();
     });
 
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
@@ -122,6 +126,11 @@ VM::VM(ErrorMessages error_messages)
         return m_promise_jobs.is_empty();
     };
 
+    // NB: Without an event loop, there is nothing to run timeout jobs, so Atomics.waitAsync() only ever resolves
+    //     through Atomics.notify(). Hosts with an event loop override this.
+    host_enqueue_timeout_job = [](GC::Ref<GC::Function<void()>>, Realm&, double) {
+    };
+
     host_make_job_callback = [](FunctionObject& function_object) {
         return make_job_callback(function_object);
     };
@@ -801,6 +810,23 @@ void VM::load_imported_module(ImportedModuleReferrer referrer, ModuleRequest con
     finish_loading_imported_module(referrer, module_request, payload, module);
 }
 
+void VM::start_sampling_profiler(AK::Duration interval)
+{
+    m_sampling_profiler = make<SamplingProfiler>(*this, interval);
+}
+
+OwnPtr<SamplingProfiler> VM::stop_sampling_profiler()
+{
+    if (m_sampling_profiler)
+        m_sampling_profiler->stop();
+    return move(m_sampling_profiler);
+}
+
+void VM::take_profiler_sample_if_due()
+{
+    m_sampling_profiler->sample_if_due();
+}
+
 Vector<StackTraceElement> VM::stack_trace() const
 {
     Vector<StackTraceElement> stack_trace;
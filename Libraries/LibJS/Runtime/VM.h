@@ -19,6 +19,7 @@
 #include <LibGC/Function.h>
 #include <LibGC/Heap.h>
 #include <LibGC/RootVector.h>
+#include <LibJS/Bytecode/MegamorphicPropertyCache.h>
 #include <LibJS/CyclicModule.h>
 #include <LibJS/Export.h>
 #include <LibJS/ModuleLoading.h>
@@ -34,7 +35,9 @@
 
 namespace JS {
 
+class CompiledScriptCache;
 class Identifier;
+class SamplingProfiler;
 struct BindingPattern;
 
 enum class HandledByHost {
@@ -64,6 +67,12 @@ public:
     GC::Heap& heap() const { return const_cast<GC::Heap&>(m_heap); }
 
     Bytecode::Interpreter& bytecode_interpreter() { return *m_bytecode_interpreter; }
+    Bytecode::MegamorphicPropertyCache& megamorphic_property_cache() { return m_megamorphic_property_cache; }
+    CompiledScriptCache& compiled_script_cache() { return *m_compiled_script_cache; }
+
+    // The builtin JavaScript implementation files are compiled once per VM. Every realm creates its own function
+    // objects, but they all share the same function data, and thereby the same lazily generated bytecode.
+    HashMap<unsigned char const*, Vector<GC::Root<SharedFunctionInstanceData>>>& compiled_builtin_files() { return m_compiled_builtin_files; }
 
     void dump_backtrace() const;
 
@@ -128,12 +137,14 @@ public:
             return throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
         }
         m_execution_context_stack.append(&context);
+        profiler_safe_point();
         return {};
     }
 
     void push_execution_context(ExecutionContext& context)
     {
         m_execution_context_stack.append(&context);
+        profiler_safe_point();
     }
 
     void pop_execution_context()
@@ -271,6 +282,15 @@ public:
     void clear_execution_context_stack();
     void restore_execution_context_stack();
 
+    // Records the JavaScript call stack every `interval` until the profiler is stopped again, see SamplingProfiler.
+    void start_sampling_profiler(AK::Duration interval);
+    OwnPtr<SamplingProfiler> stop_sampling_profiler();
+    ALWAYS_INLINE void profiler_safe_point()
+    {
+        if (m_sampling_profiler) [[unlikely]]
+            take_profiler_sample_if_due();
+    }
+
     // Do not call this method unless you are sure this is the only and first module to be loaded in this vm.
     ThrowCompletionOr<void> link_and_eval_module(Badge<Bytecode::Interpreter>, SourceTextModule& module);
 
@@ -300,12 +320,15 @@ public:
     Function<ThrowCompletionOr<void>(Realm&, NonnullOwnPtr<ExecutionContext>, ShadowRealm&)> host_initialize_shadow_realm;
     Function<Crypto::SignedBigInteger(Object const& global)> host_system_utc_epoch_nanoseconds;
     Function<bool()> host_promise_job_queue_is_empty;
+    Function<void(GC::Ref<GC::Function<void()>>, Realm&, double milliseconds)> host_enqueue_timeout_job;
 
     [[nodiscard]] Vector<StackTraceElement> stack_trace() const;
 
 private:
     using ErrorMessages = AK::Array<Utf16String, to_underlying(ErrorMessage::__Count)>;
 
+    NEVER_INLINE void take_profiler_sample_if_due();
+
     struct WellKnownSymbols {
 #define __JS_ENUMERATE(SymbolName, snake_name) \
     GC::Ptr<Symbol> snake_name;
@@ -370,6 +393,10 @@ private:
     OwnPtr<Agent> m_agent;
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
+    Bytecode::MegamorphicPropertyCache m_megamorphic_property_cache;
+    OwnPtr<CompiledScriptCache> m_compiled_script_cache;
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+    HashMap<unsigned char const*, Vector<GC::Root<SharedFunctionInstanceData>>> m_compiled_builtin_files;
 
     bool m_dynamic_imports_allowed { false };
 };
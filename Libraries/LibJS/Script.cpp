@@ -5,6 +5,7 @@
  */
 
 #include <LibJS/Bytecode/Executable.h>
+#include <LibJS/CompiledScriptCache.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/SharedFunctionInstanceData.h>
@@ -23,25 +24,37 @@ GC_DEFINE_ALLOCATOR(Script);
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
-    auto rust_compilation = RustIntegration::compile_script(source_text, realm, filename, line_number_offset);
-    if (!rust_compilation.has_value())
-        return Vector<ParserError> {};
-    if (rust_compilation->is_error())
-        return rust_compilation->release_error();
-    return realm.heap().allocate<Script>(realm, filename, move(rust_compilation->value()), host_defined);
+    auto source_code = SourceCode::create(
+        String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(),
+        Utf16String::from_utf8(source_text));
+
+    if (auto script = create_from_compilation_cache(source_code, realm, host_defined, line_number_offset))
+        return script.as_nonnull();
+
+    auto* parsed = RustIntegration::parse_program(source_code->utf16_data(), source_code->length_in_code_units(), RustIntegration::ProgramType::Script, line_number_offset);
+    return create_from_parsed(parsed, move(source_code), realm, host_defined, line_number_offset);
 }
 
-Result<GC::Ref<Script>, Vector<ParserError>> Script::create_from_parsed(FFI::ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm, HostDefined* host_defined)
+Result<GC::Ref<Script>, Vector<ParserError>> Script::create_from_parsed(FFI::ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm& realm, HostDefined* host_defined, size_t line_number_offset)
 {
     auto filename = source_code->filename();
-    auto rust_compilation = RustIntegration::compile_parsed_script(parsed, move(source_code), realm);
+    auto rust_compilation = RustIntegration::compile_parsed_script(parsed, source_code, realm);
     if (!rust_compilation.has_value())
         return Vector<ParserError> {};
     if (rust_compilation->is_error())
         return rust_compilation->release_error();
+    realm.vm().compiled_script_cache().insert(move(source_code), line_number_offset, rust_compilation->value());
     return realm.heap().allocate<Script>(realm, filename, move(rust_compilation->value()), host_defined);
 }
 
+GC::Ptr<Script> Script::create_from_compilation_cache(SourceCode const& source_code, Realm& realm, HostDefined* host_defined, size_t line_number_offset)
+{
+    auto result = realm.vm().compiled_script_cache().lookup(source_code, line_number_offset);
+    if (!result.has_value())
+        return nullptr;
+    return realm.heap().allocate<Script>(realm, source_code.filename(), result.release_value(), host_defined);
+}
+
 Script::Script(Realm& realm, StringView filename, RustIntegration::ScriptResult&& result, HostDefined* host_defined)
     : m_realm(realm)
     , m_executable(result.executable)
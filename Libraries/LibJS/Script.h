@@ -54,7 +54,11 @@ public:
 
     virtual ~Script() override;
     static Result<GC::Ref<Script>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1);
-    static Result<GC::Ref<Script>, Vector<ParserError>> create_from_parsed(FFI::ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm&, HostDefined* = nullptr);
+    static Result<GC::Ref<Script>, Vector<ParserError>> create_from_parsed(FFI::ParsedProgram* parsed, NonnullRefPtr<SourceCode const> source_code, Realm&, HostDefined* = nullptr, size_t line_number_offset = 1);
+
+    // Creates a script that shares the bytecode of an earlier compilation of the same source, if the VM's
+    // CompiledScriptCache has one. Returns nullptr on a cache miss, in which case the caller has to parse.
+    static GC::Ptr<Script> create_from_compilation_cache(SourceCode const&, Realm&, HostDefined* = nullptr, size_t line_number_offset = 1);
 
     Realm& realm() { return *m_realm; }
     Vector<LoadedModuleRequest>& loaded_modules() { return m_loaded_modules; }
@@ -12,43 +12,129 @@
 #include "FFmpegHelpers.h"
 #include "FFmpegVideoDecoder.h"
 
+extern "C" {
+#include <libavutil/hwcontext.h>
+}
+
 namespace Media::FFmpeg {
 
-static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
+struct PixelFormatProperties {
+    u8 bit_depth;
+    Subsampling subsampling;
+    Gfx::YUVData::ChromaLayout chroma_layout { Gfx::YUVData::ChromaLayout::Planar };
+};
+
+static Optional<PixelFormatProperties> pixel_format_properties(int format)
+{
+    using enum Gfx::YUVData::ChromaLayout;
+
+    switch (format) {
+    case AV_PIX_FMT_YUV420P:
+    case AV_PIX_FMT_YUVJ420P:
+        return PixelFormatProperties { 8, { true, true } };
+    case AV_PIX_FMT_YUV420P10:
+        return PixelFormatProperties { 10, { true, true } };
+    case AV_PIX_FMT_YUV420P12:
+        return PixelFormatProperties { 12, { true, true } };
+    case AV_PIX_FMT_YUV422P:
+    case AV_PIX_FMT_YUVJ422P:
+        return PixelFormatProperties { 8, { true, false } };
+    case AV_PIX_FMT_YUV422P10:
+        return PixelFormatProperties { 10, { true, false } };
+    case AV_PIX_FMT_YUV422P12:
+        return PixelFormatProperties { 12, { true, false } };
+    case AV_PIX_FMT_YUV444P:
+    case AV_PIX_FMT_YUVJ444P:
+        return PixelFormatProperties { 8, { false, false } };
+    case AV_PIX_FMT_YUV444P10:
+        return PixelFormatProperties { 10, { false, false } };
+    case AV_PIX_FMT_YUV444P12:
+        return PixelFormatProperties { 12, { false, false } };
+    // Hardware decoders output interleaved chroma, which is what their frames are transferred to system memory as.
+    case AV_PIX_FMT_NV12:
+        return PixelFormatProperties { 8, { true, true }, Interleaved };
+    case AV_PIX_FMT_P010:
+        return PixelFormatProperties { 10, { true, true }, Interleaved };
+    default:
+        return {};
+    }
+}
+
+static AVHWDeviceType preferred_hardware_device_type()
 {
+#if defined(AK_OS_MACOS)
+    return AV_HWDEVICE_TYPE_VIDEOTOOLBOX;
+#elif defined(AK_OS_WINDOWS)
+    return AV_HWDEVICE_TYPE_D3D11VA;
+#elif defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+    return AV_HWDEVICE_TYPE_VAAPI;
+#else
+    return AV_HWDEVICE_TYPE_NONE;
+#endif
+}
+
+static AVPixelFormat hardware_pixel_format(AVCodec const* codec, AVHWDeviceType device_type)
+{
+    for (int i = 0;; i++) {
+        auto const* config = avcodec_get_hw_config(codec, i);
+        if (!config)
+            return AV_PIX_FMT_NONE;
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) != 0 && config->device_type == device_type)
+            return config->pix_fmt;
+    }
+}
+
+static AVPixelFormat negotiate_output_format(AVCodecContext* codec_context, AVPixelFormat const* formats)
+{
+    // NB: We only let the hardware decode 4:2:0 content, since that is the only chroma subsampling that hardware frames
+    //     are transferred to system memory with for every device type.
+    if (codec_context->hw_device_ctx) {
+        auto device_type = reinterpret_cast<AVHWDeviceContext const*>(codec_context->hw_device_ctx->data)->type;
+        auto hardware_format = hardware_pixel_format(codec_context->codec, device_type);
+        auto software_format = pixel_format_properties(codec_context->sw_pix_fmt);
+        bool hardware_can_decode = software_format.has_value() && software_format->bit_depth <= 10 && software_format->subsampling.x() && software_format->subsampling.y();
+
+        if (hardware_can_decode) {
+            for (auto const* format = formats; *format >= 0; format++) {
+                if (*format == hardware_format)
+                    return *format;
+            }
+        }
+    }
+
     while (*formats >= 0) {
-        switch (*formats) {
-        case AV_PIX_FMT_YUV420P:
-        case AV_PIX_FMT_YUV420P10:
-        case AV_PIX_FMT_YUV420P12:
-        case AV_PIX_FMT_YUV422P:
-        case AV_PIX_FMT_YUV422P10:
-        case AV_PIX_FMT_YUV422P12:
-        case AV_PIX_FMT_YUV444P:
-        case AV_PIX_FMT_YUV444P10:
-        case AV_PIX_FMT_YUV444P12:
-        case AV_PIX_FMT_YUVJ420P:
-        case AV_PIX_FMT_YUVJ422P:
-        case AV_PIX_FMT_YUVJ444P:
+        if (pixel_format_properties(*formats).has_value())
             return *formats;
-        default:
-            break;
-        }
         formats++;
     }
     return AV_PIX_FMT_NONE;
 }
 
+// Decoding falls back to software whenever the device can't be created, or doesn't support the codec or the content.
+static void try_enable_hardware_decoding(AVCodecContext* codec_context, AVCodec const* codec)
+{
+    auto device_type = preferred_hardware_device_type();
+    if (device_type == AV_HWDEVICE_TYPE_NONE || hardware_pixel_format(codec, device_type) == AV_PIX_FMT_NONE)
+        return;
+
+    AVBufferRef* device_context = nullptr;
+    if (av_hwdevice_ctx_create(&device_context, device_type, nullptr, nullptr, 0) < 0)
+        return;
+    codec_context->hw_device_ctx = device_context;
+}
+
 DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create(CodecID codec_id, ReadonlyBytes codec_initialization_data)
 {
     AVCodecContext* codec_context = nullptr;
     AVPacket* packet = nullptr;
     AVFrame* frame = nullptr;
+    AVFrame* transfer_frame = nullptr;
     ArmedScopeGuard memory_guard {
         [&] {
             avcodec_free_context(&codec_context);
             av_packet_free(&packet);
             av_frame_free(&frame);
+            av_frame_free(&transfer_frame);
         }
     };
 
@@ -62,6 +148,7 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
         return DecoderError::format(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg codec context for codec {}", codec_id);
 
     codec_context->get_format = negotiate_output_format;
+    try_enable_hardware_decoding(codec_context, codec);
     codec_context->time_base = { 1, 1'000'000 };
     codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
 
@@ -88,14 +175,19 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     if (!frame)
         return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
 
+    transfer_frame = av_frame_alloc();
+    if (!transfer_frame)
+        return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
+
     memory_guard.disarm();
-    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame));
+    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame, transfer_frame));
 }
 
-FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame)
+FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame, AVFrame* transfer_frame)
     : m_codec_context(codec_context)
     , m_packet(packet)
     , m_frame(frame)
+    , m_transfer_frame(transfer_frame)
 {
 }
 
@@ -103,6 +195,7 @@ FFmpegVideoDecoder::~FFmpegVideoDecoder()
 {
     av_packet_free(&m_packet);
     av_frame_free(&m_frame);
+    av_frame_free(&m_transfer_frame);
     avcodec_free_context(&m_codec_context);
 }
 
@@ -150,11 +243,21 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
 
     switch (result) {
     case 0: {
-        auto color_primaries = static_cast<ColorPrimaries>(m_frame->color_primaries);
-        auto transfer_characteristics = static_cast<TransferCharacteristics>(m_frame->color_trc);
-        auto matrix_coefficients = static_cast<MatrixCoefficients>(m_frame->colorspace);
+        auto* frame = m_frame;
+        if (m_frame->hw_frames_ctx) {
+            av_frame_unref(m_transfer_frame);
+            if (av_hwframe_transfer_data(m_transfer_frame, m_frame, 0) < 0)
+                return DecoderError::with_description(DecoderErrorCategory::Unknown, "Failed to transfer hardware frame to system memory"sv);
+            if (av_frame_copy_props(m_transfer_frame, m_frame) < 0)
+                return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to copy hardware frame properties"sv);
+            frame = m_transfer_frame;
+        }
+
+        auto color_primaries = static_cast<ColorPrimaries>(frame->color_primaries);
+        auto transfer_characteristics = static_cast<TransferCharacteristics>(frame->color_trc);
+        auto matrix_coefficients = static_cast<MatrixCoefficients>(frame->colorspace);
         auto color_range = [&] {
-            switch (m_frame->color_range) {
+            switch (frame->color_range) {
             case AVColorRange::AVCOL_RANGE_MPEG:
                 return VideoFullRangeFlag::Studio;
             case AVColorRange::AVCOL_RANGE_JPEG:
@@ -184,81 +287,59 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
             break;
         }
 
-        size_t bit_depth = [&] {
-            switch (m_frame->format) {
-            case AV_PIX_FMT_YUV420P:
-            case AV_PIX_FMT_YUV422P:
-            case AV_PIX_FMT_YUV444P:
-            case AV_PIX_FMT_YUVJ420P:
-            case AV_PIX_FMT_YUVJ422P:
-            case AV_PIX_FMT_YUVJ444P:
-                return 8;
-            case AV_PIX_FMT_YUV420P10:
-            case AV_PIX_FMT_YUV422P10:
-            case AV_PIX_FMT_YUV444P10:
-                return 10;
-            case AV_PIX_FMT_YUV420P12:
-            case AV_PIX_FMT_YUV422P12:
-            case AV_PIX_FMT_YUV444P12:
-                return 12;
-            default:
-                VERIFY_NOT_REACHED();
-            }
-        }();
+        auto format_properties = pixel_format_properties(frame->format);
+        if (!format_properties.has_value())
+            return DecoderError::format(DecoderErrorCategory::NotImplemented, "Unsupported FFmpeg pixel format {}", frame->format);
+        size_t bit_depth = format_properties->bit_depth;
+        auto subsampling = format_properties->subsampling;
+        auto chroma_layout = format_properties->chroma_layout;
+        bool is_interleaved = chroma_layout == Gfx::YUVData::ChromaLayout::Interleaved;
 
-        auto subsampling = [&]() -> Subsampling {
-            switch (m_frame->format) {
-            case AV_PIX_FMT_YUV420P:
-            case AV_PIX_FMT_YUV420P10:
-            case AV_PIX_FMT_YUV420P12:
-            case AV_PIX_FMT_YUVJ420P:
-                return { true, true };
-            case AV_PIX_FMT_YUV422P:
-            case AV_PIX_FMT_YUV422P10:
-            case AV_PIX_FMT_YUV422P12:
-            case AV_PIX_FMT_YUVJ422P:
-                return { true, false };
-            case AV_PIX_FMT_YUV444P:
-            case AV_PIX_FMT_YUV444P10:
-            case AV_PIX_FMT_YUV444P12:
-            case AV_PIX_FMT_YUVJ444P:
-                return { false, false };
-            default:
-                VERIFY_NOT_REACHED();
-            }
-        }();
+        auto size = Gfx::Size<u32> { frame->width, frame->height };
+        auto gfx_size = Gfx::IntSize { frame->width, frame->height };
 
-        auto size = Gfx::Size<u32> { m_frame->width, m_frame->height };
-        auto gfx_size = Gfx::IntSize { m_frame->width, m_frame->height };
+        auto timestamp = AK::Duration::from_microseconds(frame->pts);
+        auto duration = AK::Duration::from_microseconds(frame->duration);
 
-        auto timestamp = AK::Duration::from_microseconds(m_frame->pts);
-        auto duration = AK::Duration::from_microseconds(m_frame->duration);
-
-        auto yuv_data = DECODER_TRY_ALLOC(Gfx::YUVData::create(gfx_size, bit_depth, subsampling, cicp));
+        auto yuv_data = DECODER_TRY_ALLOC(Gfx::YUVData::create(gfx_size, bit_depth, subsampling, cicp, chroma_layout));
 
         auto y_plane_size = size.to_type<size_t>();
         auto uv_plane_size = subsampling.subsampled_size(size).to_type<size_t>();
 
-        Bytes buffers[] = { yuv_data->y_data(), yuv_data->u_data(), yuv_data->v_data() };
-        Gfx::Size<size_t> plane_sizes[] = { y_plane_size, uv_plane_size, uv_plane_size };
+        // NB: Interleaved chroma planes have two samples per chroma pixel.
+        Vector<Bytes, 3> buffers;
+        Vector<Gfx::Size<size_t>, 3> plane_sizes;
+        buffers.append(yuv_data->y_data());
+        plane_sizes.append(y_plane_size);
+        if (is_interleaved) {
+            buffers.append(yuv_data->uv_data());
+            plane_sizes.append({ uv_plane_size.width() * 2, uv_plane_size.height() });
+        } else {
+            buffers.append(yuv_data->u_data());
+            buffers.append(yuv_data->v_data());
+            plane_sizes.append(uv_plane_size);
+            plane_sizes.append(uv_plane_size);
+        }
 
-        for (u32 plane = 0; plane < 3; plane++) {
-            VERIFY(m_frame->linesize[plane] != 0);
-            if (m_frame->linesize[plane] < 0)
+        for (u32 plane = 0; plane < buffers.size(); plane++) {
+            VERIFY(frame->linesize[plane] != 0);
+            if (frame->linesize[plane] < 0)
                 return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
 
             auto plane_size = plane_sizes[plane];
-            auto const* source = m_frame->data[plane];
+            auto const* source = frame->data[plane];
             VERIFY(source != nullptr);
             auto destination = buffers[plane];
 
             if (bit_depth > 8) {
                 // For 10/12-bit content, normalize values to fill the full 16-bit unorm range.
                 // Use bit replication: (value << shift) | (value >> inverse_shift)
-                auto const shift = 16 - bit_depth;
-                auto const inverse_shift = bit_depth - shift;
+                // Interleaved formats already store their values in the most significant bits, which leaves only the
+                // replication of the most significant bits into the least significant ones.
+                auto const shift = is_interleaved ? 0 : 16 - bit_depth;
+                auto const inverse_shift = is_interleaved ? bit_depth : bit_depth - (16 - bit_depth);
                 auto samples_per_row = plane_size.width();
-                auto source_stride = m_frame->linesize[plane];
+                auto source_stride = frame->linesize[plane];
 
                 for (size_t row = 0; row < plane_size.height(); row++) {
                     auto const* src_row = reinterpret_cast<u16 const*>(source + (row * source_stride));
@@ -268,12 +349,12 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
                 }
             } else {
                 auto output_line_size = plane_size.width();
-                VERIFY(output_line_size <= static_cast<size_t>(m_frame->linesize[plane]));
+                VERIFY(output_line_size <= static_cast<size_t>(frame->linesize[plane]));
 
                 auto* dest_ptr = destination.data();
                 for (size_t row = 0; row < plane_size.height(); row++) {
                     memcpy(dest_ptr, source, output_line_size);
-                    source += m_frame->linesize[plane];
+                    source += frame->linesize[plane];
                     dest_ptr += output_line_size;
                 }
             }
@@ -11,7 +11,10 @@
 namespace Media {
 
 static constexpr u64 PRECEDING_DATA_SIZE = 1 * KiB;
-static constexpr u64 FORWARD_REQUEST_THRESHOLD = 1 * MiB;
+static constexpr u64 DEFAULT_FORWARD_REQUEST_THRESHOLD = 1 * MiB;
+static constexpr u64 MIN_FORWARD_REQUEST_THRESHOLD = 256 * KiB;
+static constexpr u64 MAX_FORWARD_REQUEST_THRESHOLD = 32 * MiB;
+static constexpr AK::Duration THROUGHPUT_MEASUREMENT_INTERVAL = AK::Duration::from_milliseconds(250);
 static constexpr AK::Duration CURSOR_ACTIVE_TIME = AK::Duration::from_milliseconds(50);
 
 NonnullRefPtr<IncrementallyPopulatedStream> IncrementallyPopulatedStream::create_empty()
@@ -60,6 +63,8 @@ void IncrementallyPopulatedStream::add_chunk_at(u64 offset, ReadonlyBytes data)
 
     Threading::MutexLocker locker { m_mutex };
 
+    record_received_data_while_locked(MonotonicTime::now_coarse(), offset, data.size());
+
     auto previous_chunk_iter = m_chunks.find_largest_not_above_iterator(offset);
 
     // Add a new chunk to the collection if there are none.
@@ -137,6 +142,8 @@ void IncrementallyPopulatedStream::begin_new_request_while_locked(u64 position)
 
     m_currently_requested_position = position;
     m_last_chunk_end = position;
+    m_request_start_time = MonotonicTime::now_coarse();
+    m_awaiting_first_chunk_of_request = true;
 
     if (m_expected_size.has_value() && position >= m_expected_size.value())
         return;
@@ -150,6 +157,53 @@ void IncrementallyPopulatedStream::begin_new_request_while_locked(u64 position)
     });
 }
 
+// Exponentially weighted moving average, which follows changes in the measured values without jumping around with them.
+static i64 update_average(i64 average, i64 sample)
+{
+    if (average == 0)
+        return sample;
+    return ((average * 7) + sample) / 8;
+}
+
+void IncrementallyPopulatedStream::record_received_data_while_locked(MonotonicTime now, u64 offset, u64 size)
+{
+    if (m_awaiting_first_chunk_of_request && offset == m_currently_requested_position) {
+        m_awaiting_first_chunk_of_request = false;
+        m_average_request_latency_in_microseconds = update_average(m_average_request_latency_in_microseconds, (now - m_request_start_time).to_microseconds());
+
+        // NB: The time spent waiting for the response says nothing about the throughput, so we start measuring it anew.
+        m_throughput_window_start = now;
+        m_throughput_window_size = 0;
+        return;
+    }
+
+    if (!m_throughput_window_start.has_value()) {
+        m_throughput_window_start = now;
+        return;
+    }
+
+    m_throughput_window_size += size;
+    auto elapsed = now - *m_throughput_window_start;
+    if (elapsed < THROUGHPUT_MEASUREMENT_INTERVAL)
+        return;
+
+    auto bytes_per_second = static_cast<i64>(m_throughput_window_size * 1'000'000 / elapsed.to_microseconds());
+    m_average_bytes_per_second = update_average(m_average_bytes_per_second, bytes_per_second);
+    m_throughput_window_start = now;
+    m_throughput_window_size = 0;
+}
+
+u64 IncrementallyPopulatedStream::forward_request_threshold_while_locked() const
+{
+    // NB: Waiting for the current request to reach a position takes as long as the data before it takes to arrive, while
+    //     a new request takes about as long as its latency. So we only start a new request for positions that are
+    //     further ahead of the current request than the data that arrives during that latency.
+    if (m_average_bytes_per_second == 0 || m_average_request_latency_in_microseconds == 0)
+        return DEFAULT_FORWARD_REQUEST_THRESHOLD;
+    auto threshold = static_cast<u64>(m_average_bytes_per_second * m_average_request_latency_in_microseconds / 1'000'000);
+    return clamp(threshold, MIN_FORWARD_REQUEST_THRESHOLD, MAX_FORWARD_REQUEST_THRESHOLD);
+}
+
 static u64 adjust_request_position(u64 position)
 {
     if (position > PRECEDING_DATA_SIZE)
@@ -165,8 +219,9 @@ bool IncrementallyPopulatedStream::check_if_data_is_available_or_begin_request_w
 
     VERIFY(position >= chunk->offset());
 
-    auto potential_request_position = adjust_request_position(position);
-    potential_request_position = max(chunk->end(), position);
+    // NB: Demuxers tend to read a little before the position they seek to, so we request some data before it as well to
+    //     avoid having to start another request for that.
+    auto potential_request_position = max(chunk->end(), adjust_request_position(position));
     for (size_t i = 0; i < m_cursors.size(); i++) {
         auto const& other_cursor = m_cursors[i];
         if (now >= other_cursor.m_active_timeout && !other_cursor.m_blocked)
@@ -180,7 +235,7 @@ bool IncrementallyPopulatedStream::check_if_data_is_available_or_begin_request_w
             potential_request_position = other_cursor.m_position;
         }
     }
-    if (m_currently_requested_position > potential_request_position || potential_request_position > m_last_chunk_end + FORWARD_REQUEST_THRESHOLD)
+    if (m_currently_requested_position > potential_request_position || potential_request_position > m_last_chunk_end + forward_request_threshold_while_locked())
         begin_new_request_while_locked(potential_request_position);
 
     u64 end = position + length;
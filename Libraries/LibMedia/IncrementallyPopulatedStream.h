@@ -108,6 +108,8 @@ private:
     void begin_new_request_while_locked(u64 position);
     bool check_if_data_is_available_or_begin_request_while_locked(MonotonicTime now, u64 position, u64 length);
     size_t read_from_chunks_while_locked(u64 position, Bytes& bytes) const;
+    void record_received_data_while_locked(MonotonicTime now, u64 offset, u64 size);
+    u64 forward_request_threshold_while_locked() const;
 
     mutable Threading::Mutex m_mutex;
     Vector<Cursor&> m_cursors;
@@ -121,6 +123,15 @@ private:
     DataRequestCallback m_data_request_callback;
     u64 m_currently_requested_position { 0 };
     u64 m_last_chunk_end { 0 };
+
+    // Measurements of how fast data arrives, which decide whether we wait for a position that the current request will
+    // reach eventually, or start a new request at that position instead.
+    MonotonicTime m_request_start_time { MonotonicTime::now_coarse() };
+    bool m_awaiting_first_chunk_of_request { false };
+    i64 m_average_request_latency_in_microseconds { 0 };
+    Optional<MonotonicTime> m_throughput_window_start;
+    u64 m_throughput_window_size { 0 };
+    i64 m_average_bytes_per_second { 0 };
 };
 
 }
@@ -494,6 +494,10 @@ void VideoDataProvider::ThreadData::push_data_and_decode_some_frames()
         }
     };
 
+    // NB: We only measure the time spent in the decoder, not the time spent waiting for data or for space in the queue.
+    AK::Duration decode_time;
+    Optional<AK::Duration> frame_duration;
+
     auto sample_result = m_demuxer->get_next_sample_for_track(m_track);
     if (sample_result.is_error()) {
         if (sample_result.error().category() == DecoderErrorCategory::EndOfStream) {
@@ -505,8 +509,11 @@ void VideoDataProvider::ThreadData::push_data_and_decode_some_frames()
     } else {
         auto coded_frame = sample_result.release_value();
         dispatch_frame_end_time(coded_frame);
+        frame_duration = coded_frame.duration();
 
+        auto decode_start_time = MonotonicTime::now();
         auto decode_result = m_decoder->receive_coded_data(coded_frame.timestamp(), coded_frame.duration(), coded_frame.data());
+        decode_time += MonotonicTime::now() - decode_start_time;
         if (decode_result.is_error()) {
             set_error_and_wait_for_seek(decode_result.release_error());
             return;
@@ -514,7 +521,9 @@ void VideoDataProvider::ThreadData::push_data_and_decode_some_frames()
     }
 
     while (true) {
+        auto decode_start_time = MonotonicTime::now();
         auto frame_result = m_decoder->get_decoded_frame(m_track.video_data().cicp);
+        decode_time += MonotonicTime::now() - decode_start_time;
         if (frame_result.is_error()) {
             if (frame_result.error().category() == DecoderErrorCategory::NeedsMoreInput)
                 break;
@@ -556,6 +565,29 @@ void VideoDataProvider::ThreadData::push_data_and_decode_some_frames()
             queue_frame(frame);
         }
     }
+
+    if (frame_duration.has_value())
+        update_queue_max_size(decode_time, *frame_duration);
+}
+
+void VideoDataProvider::ThreadData::update_queue_max_size(AK::Duration decode_time, AK::Duration frame_duration)
+{
+    auto frame_duration_in_microseconds = frame_duration.to_microseconds();
+    if (frame_duration_in_microseconds <= 0)
+        return;
+
+    auto decode_time_in_microseconds = decode_time.to_microseconds();
+    if (m_average_decode_time_in_microseconds == 0)
+        m_average_decode_time_in_microseconds = decode_time_in_microseconds;
+    else
+        m_average_decode_time_in_microseconds = ((m_average_decode_time_in_microseconds * 7) + decode_time_in_microseconds) / 8;
+
+    // NB: Some frames take much longer to decode than others, keyframes in particular. The more of each frame's duration
+    //     decoding takes on average, the more frames we keep queued up so that playback can get past the slow frames
+    //     without running out of frames to display. Decoders that keep up easily stay at the minimum queue size, so
+    //     that we don't hold on to more decoded frames than needed.
+    auto additional_frames = static_cast<size_t>(((m_average_decode_time_in_microseconds * 4) + frame_duration_in_microseconds - 1) / frame_duration_in_microseconds);
+    m_queue_max_size = min(MIN_QUEUE_SIZE + additional_frames, QUEUE_CAPACITY);
 }
 
 bool VideoDataProvider::ThreadData::is_blocked() const
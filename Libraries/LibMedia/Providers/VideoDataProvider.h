@@ -94,6 +94,7 @@ private:
         void process_seek_on_main_thread(u32 seek_id, Callback);
         void resolve_seek(u32 seek_id, AK::Duration const& timestamp);
         void push_data_and_decode_some_frames();
+        void update_queue_max_size(AK::Duration decode_time, AK::Duration frame_duration);
         bool is_blocked() const;
 
         [[nodiscard]] Threading::MutexLocker take_lock() const { return Threading::MutexLocker(m_mutex); }
@@ -121,7 +122,9 @@ private:
 
         RefPtr<MediaTimeProvider> m_time_provider;
 
-        size_t m_queue_max_size { 4 };
+        static constexpr size_t MIN_QUEUE_SIZE = 4;
+        size_t m_queue_max_size { MIN_QUEUE_SIZE };
+        i64 m_average_decode_time_in_microseconds { 0 };
         ImageQueue m_queue;
         FrameEndTimeHandler m_duration_change_handler;
         ErrorHandler m_error_handler;
@@ -13,6 +13,8 @@
 #include <AK/DisjointChunks.h>
 #include <AK/Forward.h>
 #include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <AK/Trie.h>
 #include <AK/Types.h>
 #include <AK/Utf16FlyString.h>
@@ -854,32 +856,60 @@ private:
     static size_t s_next_checkpoint_serial_id;
 };
 
-class REGEX_API FlatByteCode : public ByteCodeBase {
+// The final, immutable form of a pattern's bytecode. Copies share the same storage, so that a compiled pattern can be
+// handed out from the parser cache without duplicating its bytecode and string tables.
+class REGEX_API FlatByteCode {
 public:
+    FlatByteCode()
+        : m_storage(adopt_ref(*new Storage))
+    {
+    }
+
     static FlatByteCode from(ByteCode&& bytecode)
     {
-        FlatByteCode flat_bytecode;
+        auto storage = adopt_ref(*new Storage);
         if (!bytecode.is_empty())
-            flat_bytecode.m_data = move(static_cast<DisjointChunks<ByteCodeValueType>&>(bytecode).first_chunk());
-        flat_bytecode.m_string_table = move(bytecode.m_string_table);
-        flat_bytecode.m_u16_string_table = move(bytecode.m_u16_string_table);
-        flat_bytecode.m_string_set_table = move(bytecode.m_string_set_table);
-        flat_bytecode.m_group_name_mappings = move(bytecode.m_group_name_mappings);
-        return flat_bytecode;
+            storage->m_data = move(static_cast<DisjointChunks<ByteCodeValueType>&>(bytecode).first_chunk());
+        storage->m_string_table = move(bytecode.m_string_table);
+        storage->m_u16_string_table = move(bytecode.m_u16_string_table);
+        storage->m_string_set_table = move(bytecode.m_string_set_table);
+        storage->m_group_name_mappings = move(bytecode.m_group_name_mappings);
+        return FlatByteCode { move(storage) };
     }
 
-    Span<ByteCodeValueType const> flat_data() const { return m_data.span(); }
-    auto& at(size_t index) { return m_data.data()[index]; }
-    auto const& at(size_t index) const { return m_data.data()[index]; }
-    auto& operator[](size_t index) { return m_data.data()[index]; }
-    auto const& operator[](size_t index) const { return m_data.data()[index]; }
-    auto size() const { return m_data.size(); }
+    FlyString get_string(size_t index) const { return m_storage->get_string(index); }
+    auto const& string_table() const { return m_storage->string_table(); }
+
+    auto get_u16_string(size_t index) const { return m_storage->get_u16_string(index); }
+    auto const& u16_string_table() const { return m_storage->u16_string_table(); }
+
+    auto const& string_set_table() const { return m_storage->string_set_table(); }
+
+    Optional<size_t> get_group_name_index(size_t group_index) const { return m_storage->get_group_name_index(group_index); }
+
+    Span<ByteCodeValueType const> flat_data() const { return m_storage->m_data.span(); }
+    auto const& at(size_t index) const { return m_storage->m_data.data()[index]; }
+    auto const& operator[](size_t index) const { return m_storage->m_data.data()[index]; }
+    auto size() const { return m_storage->m_data.size(); }
 
-    auto begin() const { return m_data.begin(); }
-    auto end() const { return m_data.end(); }
+    auto begin() const { return m_storage->m_data.begin(); }
+    auto end() const { return m_storage->m_data.end(); }
 
 private:
-    Vector<ByteCodeValueType> m_data;
+    struct Storage final
+        : public RefCounted<Storage>
+        , public ByteCodeBase {
+        friend class FlatByteCode;
+
+        Vector<ByteCodeValueType> m_data;
+    };
+
+    explicit FlatByteCode(NonnullRefPtr<Storage const> storage)
+        : m_storage(move(storage))
+    {
+    }
+
+    NonnullRefPtr<Storage const> m_storage;
 };
 
 #define ENUMERATE_EXECUTION_RESULTS                                                     \
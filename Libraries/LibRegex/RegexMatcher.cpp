@@ -8,6 +8,7 @@
 #include <AK/BumpAllocator.h>
 #include <AK/ByteString.h>
 #include <AK/Debug.h>
+#include <AK/GenericShorthands.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
 #include <LibRegex/RegexParser.h>
@@ -1303,8 +1304,11 @@ Regex<Parser>::Regex(ByteString pattern, typename ParserTraits<Parser>::OptionsT
     : pattern_value(move(pattern))
     , parser_result(ByteCode {})
 {
-    if (auto cache_entry = s_parser_cache<Parser>.get({ pattern_value, regex_options }); cache_entry.has_value()) {
+    CacheKey<Parser> cache_key { pattern_value, regex_options };
+    if (auto cache_entry = s_parser_cache<Parser>.take(cache_key); cache_entry.has_value()) {
+        // NB: The cache is evicted from the front, so move the entry to the back to keep recently used patterns around.
         parser_result = cache_entry.value();
+        s_parser_cache<Parser>.set(move(cache_key), cache_entry.release_value());
     } else {
         regex::Lexer lexer(pattern_value);
 
@@ -1315,7 +1319,7 @@ Regex<Parser>::Regex(ByteString pattern, typename ParserTraits<Parser>::OptionsT
         run_optimization_passes();
 
         if (parser_result.error == regex::Error::NoError)
-            cache_parse_result<Parser>(parser_result, { pattern_value, regex_options });
+            cache_parse_result<Parser>(parser_result, cache_key);
     }
 
     if (parser_result.error == regex::Error::NoError)
@@ -1387,6 +1391,61 @@ ByteString Regex<Parser>::error_string(Optional<ByteString> message) const
     return eb.to_byte_string();
 }
 
+// Setting up an NFA search costs about as much as a few attempts of the backtracking matcher, so short inputs are left to it.
+static constexpr size_t nfa_minimum_input_length = 256;
+
+// Patterns that can be searched for as an NFA are only left to the backtracking matcher for this many operations, which
+// keeps pathological patterns like /(a+)+b/ from taking exponential time.
+static constexpr size_t backtracking_operation_budget = 100'000;
+
+// Returns the code unit offset of the next occurrence of `prefix` in `view`, starting at `code_unit_offset`.
+static Optional<size_t> find_literal_prefix(Utf16View const& view, ReadonlySpan<u16> prefix, size_t code_unit_offset)
+{
+    auto first_code_unit = static_cast<char16_t>(prefix.first());
+    auto const length = view.length_in_code_units();
+
+    for (;;) {
+        auto offset = view.find_code_unit_offset(first_code_unit, code_unit_offset);
+        if (!offset.has_value() || *offset + prefix.size() > length)
+            return {};
+
+        bool matches = true;
+        for (size_t i = 1; i < prefix.size(); ++i) {
+            if (view.code_unit_at(*offset + i) != prefix[i]) {
+                matches = false;
+                break;
+            }
+        }
+        if (matches)
+            return offset;
+
+        code_unit_offset = *offset + 1;
+    }
+}
+
+static bool is_in_starting_ranges(ReadonlySpan<CharRange> ranges, u32 code_point, bool insensitive)
+{
+    if (insensitive)
+        code_point = to_ascii_lowercase(code_point);
+
+    return binary_search(ranges, code_point, nullptr, [insensitive](auto needle, CharRange range) {
+        auto upper_case_needle = needle;
+        auto lower_case_needle = needle;
+        if (insensitive) {
+            upper_case_needle = to_ascii_uppercase(needle);
+            lower_case_needle = to_ascii_lowercase(needle);
+        }
+
+        if (lower_case_needle >= range.from && lower_case_needle <= range.to)
+            return 0;
+        if (upper_case_needle >= range.from && upper_case_needle <= range.to)
+            return 0;
+        if (lower_case_needle > range.to || upper_case_needle > range.to)
+            return 1;
+        return -1;
+    });
+}
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -1460,21 +1519,33 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
 
-    auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
-        auto upper_case_needle = needle;
-        auto lower_case_needle = needle;
-        if (insensitive) {
-            upper_case_needle = to_ascii_uppercase(needle);
-            lower_case_needle = to_ascii_lowercase(needle);
-        }
+    auto const& literal_prefix = m_pattern->parser_result.optimization_data.literal_prefix;
+    auto can_skip_to_literal_prefix = !literal_prefix.is_empty() && continue_search && !only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Insensitive);
 
-        if (lower_case_needle >= range.from && lower_case_needle <= range.to)
-            return 0;
-        if (upper_case_needle >= range.from && upper_case_needle <= range.to)
-            return 0;
-        if (lower_case_needle > range.to || upper_case_needle > range.to)
-            return 1;
-        return -1;
+    // The NFA program only applies to the flags it was compiled for.
+    NFAProgram const* nfa_program = nullptr;
+    if (auto const& program = m_pattern->parser_result.optimization_data.nfa_program; program.has_value()) {
+        if (program->unicode == unicode && program->insensitive == input.regex_options.has_flag_set(AllFlags::Insensitive)
+            && !input.regex_options.has_flag_set(AllFlags::MatchNotBeginOfLine) && !input.regex_options.has_flag_set(AllFlags::MatchNotEndOfLine))
+            nfa_program = &*program;
+    }
+
+    auto prepare_state_for_attempt = [&](size_t view_index) {
+        state.string_position = view_index;
+        if (input.view.unicode()) {
+            if (view_index < input.view.length())
+                state.string_position_in_code_units = input.view.code_unit_offset_of(view_index);
+            else
+                state.string_position_in_code_units = input.view.length_in_code_units();
+        } else {
+            state.string_position_in_code_units = view_index;
+        }
+        state.instruction_position = 0;
+        state.repetition_marks.clear();
+        state.modifier_stack.clear();
+        state.current_options = input.regex_options;
+        state.string_position_before_rseek = NumericLimits<size_t>::max();
+        state.string_position_in_code_units_before_rseek = NumericLimits<size_t>::max();
     };
 
     for (auto const& view : views) {
@@ -1537,6 +1608,21 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
                     break;
             }
 
+            // OPTIMIZATION: Skip ahead to the next occurrence of the literal prefix, as a match can't start anywhere else.
+            if (can_skip_to_literal_prefix && view.is_u16_view()) {
+                if (view_index == view_length)
+                    break;
+                auto const& u16_view = view.u16_view();
+                auto code_unit_index = view.unicode() ? u16_view.code_unit_offset_of(view_index) : view_index;
+                auto prefix_offset = find_literal_prefix(u16_view, literal_prefix, code_unit_index);
+                if (!prefix_offset.has_value())
+                    break;
+                if (view.unicode())
+                    view_index += u16_view.substring_view(code_unit_index, *prefix_offset - code_unit_index).length_in_code_points();
+                else
+                    view_index = *prefix_offset;
+            }
+
             // FIXME: More performant would be to know the remaining minimum string
             //        length needed to match from the current position onwards within
             //        the vm. Add new OpCode for MinMatchLengthFromSp with the value of
@@ -1547,38 +1633,51 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
 
-            auto const insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
-            if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
-                auto ranges = insensitive ? m_pattern->parser_result.optimization_data.starting_ranges_insensitive.span() : starting_ranges.span();
-                auto code_unit_index = input.view.unicode() ? input.view.code_unit_offset_of(view_index) : view_index;
-                auto ch = input.view.unicode_aware_code_point_at(code_unit_index);
-                if (insensitive)
-                    ch = to_ascii_lowercase(ch);
+            input.column = match_count;
+            input.match_index = match_count;
 
-                if (!binary_search(ranges, ch, nullptr, compare_range))
-                    goto done_matching;
+            // OPTIMIZATION: Search the rest of the view in one pass if the pattern was compiled as an NFA. This finds the
+            //               same match as trying every remaining position in turn, and sets view_index to its start.
+            Optional<ExecuteResult> nfa_result;
+            if (nfa_program && view.is_u16_view() && (view_length - view_index >= nfa_minimum_input_length || operations >= backtracking_operation_budget)) {
+                nfa_result = execute_nfa(*nfa_program, input, state, view_index, !continue_search || only_start_of_line, operations);
+                if (!nfa_result.has_value())
+                    nfa_program = nullptr;
             }
 
-            input.column = match_count;
-            input.match_index = match_count;
+            if (!nfa_result.has_value()) {
+                auto const insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
+                if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
+                    auto ranges = insensitive ? m_pattern->parser_result.optimization_data.starting_ranges_insensitive.span() : starting_ranges.span();
+                    auto code_unit_index = input.view.unicode() ? input.view.code_unit_offset_of(view_index) : view_index;
+                    auto ch = input.view.unicode_aware_code_point_at(code_unit_index);
+                    if (!is_in_starting_ranges(ranges, ch, insensitive))
+                        goto done_matching;
+                }
 
-            state.string_position = view_index;
-            if (input.view.unicode()) {
-                if (view_index < view_length)
-                    state.string_position_in_code_units = input.view.code_unit_offset_of(view_index);
-                else
-                    state.string_position_in_code_units = input.view.length_in_code_units();
+                prepare_state_for_attempt(view_index);
+            }
+
+            ExecuteResult result;
+            if (nfa_result.has_value()) {
+                result = *nfa_result;
             } else {
-                state.string_position_in_code_units = view_index;
+                result = execute(input, state, operations, nfa_program && view.is_u16_view() ? backtracking_operation_budget : NumericLimits<size_t>::max());
+
+                // The backtracking matcher is taking too long, so continue the search as an NFA, in linear time.
+                if (result == ExecuteResult::ExceededOperationBudget) {
+                    nfa_result = execute_nfa(*nfa_program, input, state, view_index, !continue_search || only_start_of_line, operations);
+                    if (nfa_result.has_value()) {
+                        result = *nfa_result;
+                    } else {
+                        nfa_program = nullptr;
+                        prepare_state_for_attempt(view_index);
+                        result = execute(input, state, operations);
+                    }
+                }
             }
-            state.instruction_position = 0;
-            state.repetition_marks.clear();
-            state.modifier_stack.clear();
-            state.current_options = input.regex_options;
-            state.string_position_before_rseek = NumericLimits<size_t>::max();
-            state.string_position_in_code_units_before_rseek = NumericLimits<size_t>::max();
 
-            if (auto const result = execute(input, state, operations); result == ExecuteResult::Matched) {
+            if (result == ExecuteResult::Matched) {
                 succeeded = true;
 
                 if (input.regex_options.has_flag_set(AllFlags::MatchNotEndOfLine) && state.string_position == input.view.length()) {
@@ -1749,7 +1848,7 @@ private:
 };
 
 template<class Parser>
-Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations) const
+Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations, size_t operation_budget) const
 {
     if (m_pattern->parser_result.optimization_data.pure_substring_search.has_value() && input.view.is_u16_view()) {
         // Yay, we can do a simple substring search!
@@ -1804,7 +1903,8 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
         OpCodeId id = (data_size <= ip)
             ? OpCodeId::Exit
             : static_cast<OpCodeId>(data[ip]);
-        ++operations;
+        if (++operations > operation_budget)
+            return ExecuteResult::ExceededOperationBudget;
 
         ExecutionResult result;
         size_t current_opcode_size;
@@ -1921,6 +2021,337 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
     VERIFY_NOT_REACHED();
 }
 
+template<class Parser>
+Optional<typename Matcher<Parser>::ExecuteResult> Matcher<Parser>::execute_nfa(NFAProgram const& program, MatchInput const& input, MatchState& state, size_t& view_index, bool anchored, size_t& operations) const
+{
+    // Threads that passed different checkpoints at the current position can't be merged, but there are rarely more than
+    // a few of those. If there are, leave the search to the backtracking matcher.
+    static constexpr size_t max_unmerged_threads = 256;
+
+    auto const& bytecode = m_pattern->parser_result.bytecode.template get<FlatByteCode>();
+    auto const* data = bytecode.flat_data().data();
+    auto const data_size = bytecode.size();
+    auto const& instructions = program.instructions;
+    auto const& optimization_data = m_pattern->parser_result.optimization_data;
+
+    auto const& view = input.view;
+    auto const view_length = view.length();
+    auto const capture_group_count = state.capture_group_count;
+    auto const match_length_minimum = m_pattern->parser_result.match_length_minimum;
+    auto const insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
+    auto const multiline = input.regex_options.has_flag_set(AllFlags::Multiline);
+    auto const& literal_prefix = optimization_data.literal_prefix;
+    auto const can_skip_to_literal_prefix = !literal_prefix.is_empty() && !insensitive && !anchored;
+
+    struct Thread {
+        u32 instruction;
+        u32 captures;
+        size_t start;
+    };
+
+    struct Visit {
+        u32 instruction;
+        u64 checkpoints;
+    };
+
+    // The threads at one position, in the order the backtracking matcher would try them. Each thread refers to
+    // capture_group_count consecutive entries in `captures`.
+    struct ThreadList {
+        Vector<Thread> threads;
+        Vector<Match> captures;
+        Vector<u32> visited_generation;
+        Vector<u64> visited_checkpoints;
+        Vector<Visit> unmerged_visits;
+        u32 generation { 0 };
+
+        void reset()
+        {
+            threads.clear_with_capacity();
+            captures.clear_with_capacity();
+            unmerged_visits.clear_with_capacity();
+            ++generation;
+        }
+    };
+
+    ThreadList lists[2];
+    for (auto& list : lists) {
+        list.visited_generation.resize_with_default_value(instructions.size(), 0);
+        list.visited_checkpoints.resize_with_default_value(instructions.size(), 0);
+        list.reset();
+    }
+    auto* current = &lists[0];
+    auto* next = &lists[1];
+
+    bool has_too_many_unmerged_threads = false;
+    auto visit = [&](ThreadList& list, u32 instruction, u64 checkpoints) {
+        if (list.visited_generation[instruction] != list.generation) {
+            list.visited_generation[instruction] = list.generation;
+            list.visited_checkpoints[instruction] = checkpoints;
+            return true;
+        }
+        if (list.visited_checkpoints[instruction] == checkpoints)
+            return false;
+        for (auto const& unmerged_visit : list.unmerged_visits) {
+            if (unmerged_visit.instruction == instruction && unmerged_visit.checkpoints == checkpoints)
+                return false;
+        }
+        if (list.unmerged_visits.size() == max_unmerged_threads) {
+            has_too_many_unmerged_threads = true;
+            return false;
+        }
+        list.unmerged_visits.append({ instruction, checkpoints });
+        return true;
+    };
+
+    auto copy_captures = [&](Vector<Match>& to, Vector<Match> const& from, u32 index) -> u32 {
+        auto new_index = static_cast<u32>(to.size());
+        to.ensure_capacity(to.size() + capture_group_count);
+        for (size_t i = 0; i < capture_group_count; ++i)
+            to.unchecked_append(from[index + i]);
+        return new_index;
+    };
+
+    MatchState scratch_state { capture_group_count, input.regex_options };
+    auto evaluate = [&](size_t ip, size_t position, size_t position_in_code_units) {
+        scratch_state.instruction_position = ip;
+        scratch_state.string_position = position;
+        scratch_state.string_position_in_code_units = position_in_code_units;
+        auto id = static_cast<OpCodeId>(data[ip]);
+        return execute_instruction(id, data, data_size, bytecode, input, scratch_state).result == ExecutionResult::Continue;
+    };
+
+    struct Frame {
+        u32 instruction;
+        u32 captures;
+        u64 checkpoints;
+    };
+    Vector<Frame> frames;
+
+    // Follows the non-consuming instructions from `instruction`, and adds a thread for every consuming instruction
+    // (or match) that is reached.
+    auto add_threads = [&](ThreadList& list, u32 instruction, u32 captures, size_t start, size_t position, size_t position_in_code_units) {
+        frames.append({ instruction, captures, 0 });
+        while (!frames.is_empty()) {
+            auto frame = frames.take_last();
+            auto const& nfa_instruction = instructions[frame.instruction];
+            auto next_instruction = frame.instruction + 1;
+            ++operations;
+
+            // NB: The checkpoints a thread passed don't matter anymore once it consumes a character.
+            auto is_consuming = first_is_one_of(nfa_instruction.type, NFAInstruction::Type::Compare, NFAInstruction::Type::CompareChar, NFAInstruction::Type::Match);
+            if (!visit(list, frame.instruction, is_consuming ? 0 : frame.checkpoints))
+                continue;
+
+            switch (nfa_instruction.type) {
+            case NFAInstruction::Type::Compare:
+            case NFAInstruction::Type::CompareChar:
+            case NFAInstruction::Type::Match:
+                list.threads.append({ frame.instruction, frame.captures, start });
+                break;
+            case NFAInstruction::Type::Assertion:
+                if (evaluate(nfa_instruction.argument, position, position_in_code_units))
+                    frames.append({ next_instruction, frame.captures, frame.checkpoints });
+                break;
+            case NFAInstruction::Type::Jump:
+                frames.append({ nfa_instruction.target, frame.captures, frame.checkpoints });
+                break;
+            case NFAInstruction::Type::Fork:
+                frames.append({ nfa_instruction.alternative, frame.captures, frame.checkpoints });
+                frames.append({ nfa_instruction.target, frame.captures, frame.checkpoints });
+                break;
+            case NFAInstruction::Type::Checkpoint:
+                frames.append({ next_instruction, frame.captures, frame.checkpoints | (1ull << nfa_instruction.argument) });
+                break;
+            case NFAInstruction::Type::JumpNonEmpty: {
+                auto is_empty = (frame.checkpoints & (1ull << nfa_instruction.argument)) != 0;
+                if (!is_empty) {
+                    if (nfa_instruction.form != OpCodeId::Jump)
+                        frames.append({ nfa_instruction.alternative, frame.captures, frame.checkpoints });
+                    frames.append({ nfa_instruction.target, frame.captures, frame.checkpoints });
+                } else if (nfa_instruction.form != OpCodeId::Jump || position == view_length) {
+                    frames.append({ next_instruction, frame.captures, frame.checkpoints });
+                }
+                break;
+            }
+            case NFAInstruction::Type::FailIfEmpty:
+                if (!(frame.checkpoints & (1ull << nfa_instruction.argument)))
+                    frames.append({ next_instruction, frame.captures, frame.checkpoints });
+                break;
+            case NFAInstruction::Type::ClearCaptureGroup: {
+                auto new_captures = copy_captures(list.captures, list.captures, frame.captures);
+                list.captures[new_captures + nfa_instruction.argument - 1].reset();
+                frames.append({ next_instruction, new_captures, frame.checkpoints });
+                break;
+            }
+            case NFAInstruction::Type::SaveLeftCaptureGroup: {
+                auto new_captures = copy_captures(list.captures, list.captures, frame.captures);
+                list.captures[new_captures + nfa_instruction.argument - 1].left_column = position;
+                frames.append({ next_instruction, new_captures, frame.checkpoints });
+                break;
+            }
+            case NFAInstruction::Type::SaveRightCaptureGroup:
+            case NFAInstruction::Type::SaveRightNamedCaptureGroup: {
+                // NB: This mirrors how the backtracking matcher executes these instructions.
+                auto group_index = nfa_instruction.argument - 1;
+                auto const& existing_capture = list.captures[frame.captures + group_index];
+                auto start_position = existing_capture.left_column;
+                if (position < start_position)
+                    break;
+
+                auto length = position - start_position;
+                auto keeps_existing_capture = start_position < existing_capture.column;
+                if (length == 0 && !existing_capture.view.is_null() && existing_capture.view.length() > 0) {
+                    auto existing_end_position = existing_capture.global_offset - input.global_offset + existing_capture.view.length();
+                    if (existing_end_position == position)
+                        keeps_existing_capture = true;
+                }
+                if (keeps_existing_capture) {
+                    frames.append({ next_instruction, frame.captures, frame.checkpoints });
+                    break;
+                }
+
+                auto captured_text = view.substring_view(start_position, length);
+                auto new_captures = copy_captures(list.captures, list.captures, frame.captures);
+                if (nfa_instruction.type == NFAInstruction::Type::SaveRightNamedCaptureGroup)
+                    list.captures[new_captures + group_index] = { captured_text, nfa_instruction.name_index, input.line, start_position, input.global_offset + start_position };
+                else
+                    list.captures[new_captures + group_index] = { captured_text, input.line, start_position, input.global_offset + start_position };
+                frames.append({ next_instruction, new_captures, frame.checkpoints });
+                break;
+            }
+            }
+        }
+    };
+
+    auto can_start_match_at = [&](size_t position, size_t position_in_code_units) {
+        if (anchored && position != view_index)
+            return false;
+        if (multiline && position == view_length)
+            return false;
+        if (match_length_minimum && match_length_minimum > view_length - position)
+            return false;
+        if (auto const& starting_ranges = optimization_data.starting_ranges; !starting_ranges.is_empty()) {
+            if (position == view_length)
+                return false;
+            auto ranges = insensitive ? optimization_data.starting_ranges_insensitive.span() : starting_ranges.span();
+            if (!is_in_starting_ranges(ranges, view.unicode_aware_code_point_at(position_in_code_units), insensitive))
+                return false;
+        }
+        return true;
+    };
+
+    size_t position = view_index;
+    size_t position_in_code_units = position;
+    if (view.unicode())
+        position_in_code_units = position < view_length ? view.code_unit_offset_of(position) : view.length_in_code_units();
+
+    Optional<size_t> match_start;
+    size_t match_end = 0;
+    size_t match_end_in_code_units = 0;
+    Vector<Match> match_captures;
+
+    for (;;) {
+        // NB: A thread that starts here has a lower priority than any thread that started earlier, and there's no
+        //     point in looking for matches that start after one we've already found.
+        if (!match_start.has_value() && can_start_match_at(position, position_in_code_units)) {
+            auto captures = static_cast<u32>(current->captures.size());
+            for (size_t i = 0; i < capture_group_count; ++i)
+                current->captures.append({});
+            add_threads(*current, 0, captures, position, position, position_in_code_units);
+        }
+        if (has_too_many_unmerged_threads)
+            return {};
+
+        if (current->threads.is_empty() && (match_start.has_value() || anchored || position == view_length))
+            break;
+
+        // OPTIMIZATION: If no thread is left, skip ahead to where the next one could start.
+        if (current->threads.is_empty() && can_skip_to_literal_prefix) {
+            auto const& u16_view = view.u16_view();
+            auto prefix_offset = find_literal_prefix(u16_view, literal_prefix, position_in_code_units + 1);
+            if (!prefix_offset.has_value())
+                break;
+            if (view.unicode())
+                position += u16_view.substring_view(position_in_code_units, *prefix_offset - position_in_code_units).length_in_code_points();
+            else
+                position = *prefix_offset;
+            position_in_code_units = *prefix_offset;
+            current->reset();
+            continue;
+        }
+
+        auto is_at_end = position == view_length;
+        size_t next_position_in_code_units = position_in_code_units + 1;
+        if (!is_at_end && view.unicode())
+            next_position_in_code_units = position_in_code_units + view.length_of_code_point(view.code_point_at(position_in_code_units));
+
+        for (auto const& thread : current->threads) {
+            auto const& nfa_instruction = instructions[thread.instruction];
+            if (nfa_instruction.type == NFAInstruction::Type::Match) {
+                // Threads after this one have a lower priority, so they can't produce a better match.
+                match_start = thread.start;
+                match_end = position;
+                match_end_in_code_units = position_in_code_units;
+                match_captures.clear_with_capacity();
+                copy_captures(match_captures, current->captures, thread.captures);
+                break;
+            }
+            if (is_at_end)
+                continue;
+
+            ++operations;
+            bool matched;
+            if (nfa_instruction.type == NFAInstruction::Type::CompareChar) {
+                scratch_state.string_position = position;
+                scratch_state.string_position_in_code_units = position_in_code_units;
+                bool inverse_matched = false;
+                compare_char(input, scratch_state, nfa_instruction.argument, false, inverse_matched);
+                matched = scratch_state.string_position == position + 1;
+            } else {
+                matched = evaluate(nfa_instruction.argument, position, position_in_code_units);
+            }
+            if (!matched)
+                continue;
+            if (scratch_state.string_position != position + 1 || scratch_state.string_position_in_code_units != next_position_in_code_units)
+                return {};
+
+            auto captures = copy_captures(next->captures, current->captures, thread.captures);
+            add_threads(*next, thread.instruction + 1, captures, thread.start, position + 1, next_position_in_code_units);
+            if (has_too_many_unmerged_threads)
+                return {};
+        }
+
+        if (is_at_end)
+            break;
+
+        swap(current, next);
+        next->reset();
+        ++position;
+        position_in_code_units = next_position_in_code_units;
+    }
+
+    if (!match_start.has_value())
+        return ExecuteResult::DidNotMatchAndNoFurtherPossibleMatchesInView;
+
+    view_index = *match_start;
+    state.string_position = match_end;
+    state.string_position_in_code_units = match_end_in_code_units;
+
+    if (capture_group_count > 0) {
+        if (input.match_index >= state.capture_group_matches_size()) {
+            state.flat_capture_group_matches.ensure_capacity((input.match_index + 1) * capture_group_count);
+            for (size_t i = state.capture_group_matches_size(); i <= input.match_index; ++i)
+                for (size_t j = 0; j < capture_group_count; ++j)
+                    state.flat_capture_group_matches.append({});
+        }
+        auto groups = state.mutable_capture_group_matches(input.match_index);
+        for (size_t i = 0; i < capture_group_count; ++i)
+            groups[i] = match_captures[i];
+    }
+
+    return ExecuteResult::Matched;
+}
+
 template class Matcher<PosixBasicParser>;
 template class Regex<PosixBasicParser>;
 
@@ -13,6 +13,7 @@
 
 #include <AK/Forward.h>
 #include <AK/GenericLexer.h>
+#include <AK/NumericLimits.h>
 #include <AK/Vector.h>
 #include <ctype.h>
 
@@ -75,8 +76,11 @@ private:
         DidNotMatch,
         Matched,
         DidNotMatchAndNoFurtherPossibleMatchesInView,
+        ExceededOperationBudget,
     };
-    ExecuteResult execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+    ExecuteResult execute(MatchInput const& input, MatchState& state, size_t& operations, size_t operation_budget = NumericLimits<size_t>::max()) const;
+    // Returns an empty Optional if the search has to be left to the backtracking matcher after all.
+    Optional<ExecuteResult> execute_nfa(NFAProgram const&, MatchInput const&, MatchState&, size_t& view_index, bool anchored, size_t& operations) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
@@ -241,6 +245,7 @@ private:
     void attempt_rewrite_dot_star_sequences_as_seek(BasicBlockList const&);
     void rewrite_simple_compares(BasicBlockList const&);
     void fill_optimization_data(BasicBlockList const&);
+    void attempt_compile_as_nfa();
 };
 
 // free standing functions for match, search and has_match
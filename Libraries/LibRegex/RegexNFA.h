@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "RegexByteCode.h"
+
+#include <AK/Types.h>
+#include <AK/Vector.h>
+
+namespace regex {
+
+// The bytecode of a pattern without backreferences, lookarounds, bounded repetitions or modifiers, rewritten so that
+// it can be simulated as an NFA (a "Pike VM") instead of being run by the backtracking matcher.
+//
+// Every consuming instruction matches exactly one character, so all threads advance through the input in lockstep,
+// and threads that reach the same instruction at the same position are merged (keeping the one the backtracking
+// matcher would have tried first). This makes a search linear in the length of the input, instead of restarting the
+// matcher at every position and potentially backtracking over the same input many times.
+struct NFAInstruction {
+    enum class Type : u8 {
+        // Consumes a character if the Compare or CompareSimple instruction at `argument` in the bytecode matches it.
+        Compare,
+        // Consumes a character if it is the code point (or code unit, outside of Unicode mode) in `argument`.
+        CompareChar,
+        // Continues if the CheckBegin, CheckEnd or CheckBoundary instruction at `argument` in the bytecode holds.
+        Assertion,
+        Jump,
+        // Continues at `target`, and then at `alternative`.
+        Fork,
+        Checkpoint,
+        // Continues at `target` (and then at `alternative`, if `form` is a fork) if a character has been consumed since
+        // the checkpoint in `argument` was passed.
+        JumpNonEmpty,
+        FailIfEmpty,
+        ClearCaptureGroup,
+        SaveLeftCaptureGroup,
+        SaveRightCaptureGroup,
+        SaveRightNamedCaptureGroup,
+        Match,
+    };
+
+    Type type;
+    OpCodeId form { OpCodeId::Jump };
+    ByteCodeValueType argument { 0 };
+    ByteCodeValueType name_index { 0 };
+    u32 target { 0 };
+    u32 alternative { 0 };
+};
+
+struct NFAProgram {
+    // Each thread keeps track of the checkpoints it passed at the current position in a 64-bit mask.
+    static constexpr size_t max_checkpoints = 64;
+
+    Vector<NFAInstruction> instructions;
+
+    // The program is only valid for the flags it was compiled for, as compared strings are split into characters.
+    bool unicode { false };
+    bool insensitive { false };
+};
+
+}
@@ -14,6 +14,7 @@
 #include <AK/Stack.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Trie.h>
+#include <AK/UnicodeUtils.h>
 #include <AK/Vector.h>
 #include <LibRegex/Regex.h>
 #include <LibRegex/RegexBytecodeStreamOptimizer.h>
@@ -372,6 +373,9 @@ void Regex<Parser>::run_optimization_passes()
     rewrite_simple_compares(blocks);
 
     fill_optimization_data(split_basic_blocks(parser_result.bytecode.template get<ByteCode>()));
+
+    // Patterns that don't need backtracking can be searched for as an NFA instead.
+    attempt_compile_as_nfa();
 }
 
 struct StaticallyInterpretedCompares {
@@ -543,6 +547,7 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
             for (auto const& range : parser_result.optimization_data.starting_ranges)
                 dbgln("  - starting range: {}-{}", range.from, range.to);
             dbgln("; - only start of line: {}", parser_result.optimization_data.only_start_of_line);
+            dbgln("; - literal prefix length: {}", parser_result.optimization_data.literal_prefix.size());
         }
     };
 
@@ -551,6 +556,53 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
     auto const* flat_data = flat.data();
 
     auto block = blocks.first();
+
+    // Every match has to start with the literal characters that are compared before the first branch, which lets the
+    // matcher skip ahead to where they occur in the input.
+    if (!parser_result.options.has_flag_set(AllFlags::Insensitive)) {
+        auto& literal_prefix = parser_result.optimization_data.literal_prefix;
+        auto append_to_prefix = [&](u32 code_point) {
+            // NB: A lone surrogate could match half of a surrogate pair, so we stop before those.
+            if (is_unicode_surrogate(code_point))
+                return false;
+            (void)UnicodeUtils::code_point_to_utf16(code_point, [&](auto code_unit) {
+                literal_prefix.append(code_unit);
+            });
+            return true;
+        };
+
+        auto extend_prefix = [&](OpCodeId id, size_t ip) {
+            if (id == OpCodeId::Compare && flat_data[ip + OpArgs::Compare::arguments_count] != 1)
+                return false;
+            auto fc = flat_compares_at(flat_data, ip, id == OpCodeId::CompareSimple);
+            if (fc.size() != 1)
+                return false;
+            if (fc.first().type == CharacterCompareType::Char)
+                return append_to_prefix(fc.first().value);
+            if (fc.first().type != CharacterCompareType::String)
+                return false;
+            auto string = bytecode.get_u16_string(fc.first().value);
+            if (string.is_empty())
+                return false;
+            for (auto code_point : string.view()) {
+                if (!append_to_prefix(code_point))
+                    return false;
+            }
+            return true;
+        };
+
+        for (size_t ip = block.start; ip < block.end;) {
+            auto id = static_cast<OpCodeId>(flat_data[ip]);
+            if (id == OpCodeId::Compare || id == OpCodeId::CompareSimple) {
+                if (!extend_prefix(id, ip))
+                    break;
+            } else if (!first_is_one_of(id, OpCodeId::Checkpoint, OpCodeId::ClearCaptureGroup, OpCodeId::SaveLeftCaptureGroup)) {
+                break;
+            }
+            ip += opcode_size(id, flat_data, ip);
+        }
+    }
+
     for (size_t ip = block.start; ip < block.end;) {
         auto id = static_cast<OpCodeId>(flat_data[ip]);
         auto sz = opcode_size(id, flat_data, ip);
@@ -615,6 +667,276 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
     }
 }
 
+static bool compares_match_a_single_character(Vector<CompareTypeAndValuePair> const& compares)
+{
+    for (auto const& compare : compares) {
+        switch (compare.type) {
+        case CharacterCompareType::Inverse:
+        case CharacterCompareType::TemporaryInverse:
+        case CharacterCompareType::AnyChar:
+        case CharacterCompareType::Char:
+        case CharacterCompareType::CharClass:
+        case CharacterCompareType::CharRange:
+        case CharacterCompareType::LookupTable:
+        case CharacterCompareType::Property:
+        case CharacterCompareType::GeneralCategory:
+        case CharacterCompareType::Script:
+        case CharacterCompareType::ScriptExtension:
+        case CharacterCompareType::And:
+        case CharacterCompareType::Or:
+        case CharacterCompareType::EndAndOr:
+        case CharacterCompareType::Subtract:
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename Parser>
+void Regex<Parser>::attempt_compile_as_nfa()
+{
+    static constexpr size_t max_instructions = 1024;
+
+    auto& bytecode = parser_result.bytecode.get<ByteCode>();
+    auto flat = bytecode.flat_data();
+    auto const* flat_data = flat.data();
+    auto const flat_size = flat.size();
+
+    NFAProgram program;
+    program.unicode = parser_result.options.has_flag_set(AllFlags::Unicode) || parser_result.options.has_flag_set(AllFlags::UnicodeSets);
+    program.insensitive = parser_result.options.has_flag_set(AllFlags::Insensitive);
+    auto& instructions = program.instructions;
+
+    struct PendingTargets {
+        size_t instruction;
+        ssize_t target_ip;
+        ssize_t alternative_ip;
+    };
+    Vector<PendingTargets> pending_targets;
+    HashMap<size_t, u32> instruction_for_ip;
+    HashMap<ByteCodeValueType, u32> checkpoint_slots;
+    bool has_forks = false;
+
+    auto checkpoint_slot = [&](ByteCodeValueType id) -> Optional<u32> {
+        if (auto slot = checkpoint_slots.get(id); slot.has_value())
+            return slot;
+        if (checkpoint_slots.size() == NFAProgram::max_checkpoints)
+            return {};
+        auto slot = static_cast<u32>(checkpoint_slots.size());
+        checkpoint_slots.set(id, slot);
+        return slot;
+    };
+
+    for (size_t ip = 0; ip < flat_size;) {
+        auto id = static_cast<OpCodeId>(flat_data[ip]);
+        auto size = opcode_size(id, flat_data, ip);
+        auto next_ip = static_cast<ssize_t>(ip + size);
+
+        instruction_for_ip.set(ip, static_cast<u32>(instructions.size()));
+
+        switch (id) {
+        case OpCodeId::Compare:
+        case OpCodeId::CompareSimple: {
+            auto compares = flat_compares_at(flat_data, ip, id == OpCodeId::CompareSimple);
+            if (compares.size() == 1 && compares.first().type == CharacterCompareType::String) {
+                // NB: Outside of Unicode mode, a case-insensitive string compare only folds ASCII characters, so we
+                //     can only split strings into single character compares if they don't contain anything else.
+                auto string = bytecode.get_u16_string(compares.first().value);
+                auto view = string.view();
+                if (view.is_empty() || (program.insensitive && (program.unicode || !view.is_ascii())))
+                    return;
+                if (program.unicode) {
+                    for (auto code_point : view)
+                        instructions.append({ .type = NFAInstruction::Type::CompareChar, .argument = code_point });
+                } else {
+                    for (size_t i = 0; i < view.length_in_code_units(); ++i)
+                        instructions.append({ .type = NFAInstruction::Type::CompareChar, .argument = view.code_unit_at(i) });
+                }
+                break;
+            }
+            if (!compares_match_a_single_character(compares))
+                return;
+            instructions.append({ .type = NFAInstruction::Type::Compare, .argument = ip });
+            break;
+        }
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+            instructions.append({ .type = NFAInstruction::Type::Assertion, .argument = ip });
+            break;
+        case OpCodeId::Jump: {
+            auto offset = static_cast<ssize_t>(flat_data[ip + OpArgs::Jump::offset]);
+            pending_targets.append({ instructions.size(), next_ip + offset, -1 });
+            instructions.append({ .type = NFAInstruction::Type::Jump });
+            break;
+        }
+        // NB: The optimizer only rewrites forks into ForkReplace* forks when the backtracking states they discard can
+        //     never lead to a match, so they behave like plain forks here.
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay: {
+            auto offset = static_cast<ssize_t>(flat_data[ip + OpArgs::Jump::offset]);
+            auto prefers_jump = id == OpCodeId::ForkJump || id == OpCodeId::ForkReplaceJump;
+            if (prefers_jump)
+                pending_targets.append({ instructions.size(), next_ip + offset, next_ip });
+            else
+                pending_targets.append({ instructions.size(), next_ip, next_ip + offset });
+            instructions.append({ .type = NFAInstruction::Type::Fork });
+            has_forks = true;
+            break;
+        }
+        case OpCodeId::JumpNonEmpty: {
+            auto offset = static_cast<ssize_t>(flat_data[ip + OpArgs::JumpNonEmpty::offset]);
+            auto slot = checkpoint_slot(flat_data[ip + OpArgs::JumpNonEmpty::checkpoint]);
+            if (!slot.has_value())
+                return;
+
+            auto form = static_cast<OpCodeId>(flat_data[ip + OpArgs::JumpNonEmpty::form]);
+            switch (form) {
+            case OpCodeId::Jump:
+                pending_targets.append({ instructions.size(), next_ip + offset, -1 });
+                break;
+            case OpCodeId::ForkJump:
+            case OpCodeId::ForkReplaceJump:
+                form = OpCodeId::ForkJump;
+                pending_targets.append({ instructions.size(), next_ip + offset, next_ip });
+                break;
+            case OpCodeId::ForkStay:
+            case OpCodeId::ForkReplaceStay:
+                form = OpCodeId::ForkStay;
+                pending_targets.append({ instructions.size(), next_ip, next_ip + offset });
+                break;
+            default:
+                return;
+            }
+            instructions.append({ .type = NFAInstruction::Type::JumpNonEmpty, .form = form, .argument = *slot });
+            has_forks = true;
+            break;
+        }
+        case OpCodeId::Checkpoint:
+        case OpCodeId::FailIfEmpty: {
+            auto slot = checkpoint_slot(flat_data[ip + OpArgs::Checkpoint::id]);
+            if (!slot.has_value())
+                return;
+            auto type = id == OpCodeId::Checkpoint ? NFAInstruction::Type::Checkpoint : NFAInstruction::Type::FailIfEmpty;
+            instructions.append({ .type = type, .argument = *slot });
+            break;
+        }
+        case OpCodeId::ClearCaptureGroup:
+            instructions.append({ .type = NFAInstruction::Type::ClearCaptureGroup, .argument = flat_data[ip + OpArgs::ClearCaptureGroup::id] });
+            break;
+        case OpCodeId::SaveLeftCaptureGroup:
+            instructions.append({ .type = NFAInstruction::Type::SaveLeftCaptureGroup, .argument = flat_data[ip + OpArgs::SaveLeftCaptureGroup::id] });
+            break;
+        case OpCodeId::SaveRightCaptureGroup:
+            instructions.append({ .type = NFAInstruction::Type::SaveRightCaptureGroup, .argument = flat_data[ip + OpArgs::SaveRightCaptureGroup::id] });
+            break;
+        case OpCodeId::SaveRightNamedCaptureGroup:
+            instructions.append({
+                .type = NFAInstruction::Type::SaveRightNamedCaptureGroup,
+                .argument = flat_data[ip + OpArgs::SaveRightNamedCaptureGroup::id],
+                .name_index = flat_data[ip + OpArgs::SaveRightNamedCaptureGroup::name_index],
+            });
+            break;
+        default:
+            // Anything else needs the backtracking matcher.
+            return;
+        }
+
+        if (instructions.size() > max_instructions)
+            return;
+        ip += size;
+    }
+
+    // A straight sequence of compares is matched just as quickly by the backtracking matcher.
+    if (!has_forks)
+        return;
+
+    // NB: Running off the end of the bytecode is how the backtracking matcher reports a match.
+    auto match_instruction = static_cast<u32>(instructions.size());
+    instructions.append({ .type = NFAInstruction::Type::Match });
+
+    auto resolve = [&](ssize_t target_ip) -> Optional<u32> {
+        if (target_ip < 0)
+            return {};
+        if (static_cast<size_t>(target_ip) >= flat_size)
+            return match_instruction;
+        return instruction_for_ip.get(target_ip);
+    };
+
+    for (auto const& pending : pending_targets) {
+        auto& instruction = instructions[pending.instruction];
+        auto target = resolve(pending.target_ip);
+        if (!target.has_value())
+            return;
+        instruction.target = *target;
+        if (pending.alternative_ip >= 0) {
+            auto alternative = resolve(pending.alternative_ip);
+            if (!alternative.has_value())
+                return;
+            instruction.alternative = *alternative;
+        }
+    }
+
+    // Threads only remember which checkpoints they passed at the current position, so make sure that every checkpoint
+    // is passed on all paths that lead to an instruction that checks it.
+    Vector<u64> passed_checkpoints;
+    passed_checkpoints.resize_with_default_value(instructions.size(), NumericLimits<u64>::max());
+    passed_checkpoints[0] = 0;
+
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (size_t i = 0; i < instructions.size(); ++i) {
+            auto const& instruction = instructions[i];
+            auto passed = passed_checkpoints[i];
+            if (instruction.type == NFAInstruction::Type::Checkpoint)
+                passed |= 1ull << instruction.argument;
+
+            auto flow_to = [&](u32 successor) {
+                auto new_passed = passed_checkpoints[successor] & passed;
+                if (new_passed != passed_checkpoints[successor]) {
+                    passed_checkpoints[successor] = new_passed;
+                    changed = true;
+                }
+            };
+
+            switch (instruction.type) {
+            case NFAInstruction::Type::Match:
+                break;
+            case NFAInstruction::Type::Jump:
+                flow_to(instruction.target);
+                break;
+            case NFAInstruction::Type::Fork:
+                flow_to(instruction.target);
+                flow_to(instruction.alternative);
+                break;
+            case NFAInstruction::Type::JumpNonEmpty:
+                flow_to(instruction.target);
+                if (instruction.form != OpCodeId::Jump)
+                    flow_to(instruction.alternative);
+                flow_to(i + 1);
+                break;
+            default:
+                flow_to(i + 1);
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < instructions.size(); ++i) {
+        auto const& instruction = instructions[i];
+        if (instruction.type != NFAInstruction::Type::JumpNonEmpty && instruction.type != NFAInstruction::Type::FailIfEmpty)
+            continue;
+        if (!(passed_checkpoints[i] & (1ull << instruction.argument)))
+            return;
+    }
+
+    parser_result.optimization_data.nfa_program = move(program);
+}
+
 template<typename Parser>
 typename Regex<Parser>::BasicBlockList Regex<Parser>::split_basic_blocks(ByteCode const& bytecode)
 {
@@ -9,6 +9,7 @@
 #include "RegexByteCode.h"
 #include "RegexError.h"
 #include "RegexLexer.h"
+#include "RegexNFA.h"
 #include "RegexOptions.h"
 
 #include <AK/FlyString.h>
@@ -69,6 +70,10 @@ public:
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
             bool only_start_of_line = false;
+            // If populated, every match starts with these code units (and the pattern is case-sensitive).
+            Vector<u16> literal_prefix;
+            // If populated, searches may use this instead of the backtracking matcher.
+            Optional<NFAProgram> nfa_program;
         } optimization_data {};
     };
 
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibRequests/BatchedRequest.h>
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder& encoder, Requests::BatchedRequest const& request)
+{
+    TRY(encoder.encode(request.request_id));
+    TRY(encoder.encode(request.method));
+    TRY(encoder.encode(request.url));
+    TRY(encoder.encode(request.header_indices));
+    TRY(encoder.encode(request.request_body));
+    TRY(encoder.encode(request.cache_mode));
+    TRY(encoder.encode(request.include_credentials));
+    TRY(encoder.encode(request.proxy_data));
+    TRY(encoder.encode(request.priority));
+    return {};
+}
+
+template<>
+ErrorOr<Requests::BatchedRequest> decode(Decoder& decoder)
+{
+    auto request_id = TRY(decoder.decode<u64>());
+    auto method = TRY(decoder.decode<ByteString>());
+    auto url = TRY(decoder.decode<URL::URL>());
+    auto header_indices = TRY(decoder.decode<Vector<u32>>());
+    auto request_body = TRY(decoder.decode<ByteBuffer>());
+    auto cache_mode = TRY(decoder.decode<HTTP::CacheMode>());
+    auto include_credentials = TRY(decoder.decode<HTTP::Cookie::IncludeCredentials>());
+    auto proxy_data = TRY(decoder.decode<Core::ProxyData>());
+    auto priority = TRY(decoder.decode<RequestServer::RequestPriority>());
+
+    return Requests::BatchedRequest {
+        .request_id = request_id,
+        .method = move(method),
+        .url = move(url),
+        .header_indices = move(header_indices),
+        .request_body = move(request_body),
+        .cache_mode = cache_mode,
+        .include_credentials = include_credentials,
+        .proxy_data = move(proxy_data),
+        .priority = priority,
+    };
+}
+
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/Vector.h>
+#include <LibCore/Proxy.h>
+#include <LibHTTP/Cache/CacheMode.h>
+#include <LibHTTP/Cookie/IncludeCredentials.h>
+#include <LibIPC/Forward.h>
+#include <LibURL/URL.h>
+#include <RequestServer/RequestPriority.h>
+
+namespace Requests {
+
+// A request that is started as part of a batch of requests. Rather than carrying its own headers, it refers to headers
+// in the batch's header table, which holds each distinct header only once. Headers that nearly every request has, like
+// User-Agent, Accept-Language or Cookie, are thus only sent once per batch.
+struct BatchedRequest {
+    u64 request_id { 0 };
+    ByteString method;
+    URL::URL url;
+    Vector<u32> header_indices;
+    ByteBuffer request_body;
+    HTTP::CacheMode cache_mode { HTTP::CacheMode::Default };
+    HTTP::Cookie::IncludeCredentials include_credentials { HTTP::Cookie::IncludeCredentials::Yes };
+    Core::ProxyData proxy_data;
+    RequestServer::RequestPriority priority { RequestServer::RequestPriority::Medium };
+};
+
+}
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, Requests::BatchedRequest const&);
+
+template<>
+ErrorOr<Requests::BatchedRequest> decode(Decoder&);
+
+}
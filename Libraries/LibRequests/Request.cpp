@@ -5,6 +5,7 @@
  */
 
 #include <LibCore/File.h>
+#include <LibCore/System.h>
 #include <LibRequests/Request.h>
 #include <LibRequests/RequestClient.h>
 
@@ -43,6 +44,11 @@ bool Request::stop()
     return m_client->stop_request({}, *this);
 }
 
+void Request::set_priority(RequestServer::RequestPriority priority)
+{
+    m_client->set_request_priority({}, *this, priority);
+}
+
 void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
 {
     // If the request was stopped while this IPC was in-flight, just bail.
@@ -73,6 +79,18 @@ void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_
     };
 
     on_finish = [this, on_buffered_request_finished = move(on_buffered_request_finished)](auto total_size, auto& timing_info, auto network_error) {
+        if (m_internal_buffered_data->mapped_payload) {
+            on_buffered_request_finished(
+                total_size,
+                timing_info,
+                network_error,
+                m_internal_buffered_data->response_headers,
+                m_internal_buffered_data->response_code,
+                m_internal_buffered_data->reason_phrase,
+                m_internal_buffered_data->mapped_payload_bytes);
+            return;
+        }
+
         auto output_buffer = ByteBuffer::create_uninitialized(m_internal_buffered_data->payload_stream.used_buffer_size()).release_value_but_fixme_should_propagate_errors();
         m_internal_buffered_data->payload_stream.read_until_filled(output_buffer).release_value_but_fixme_should_propagate_errors();
 
@@ -125,6 +143,32 @@ void Request::did_request_certificates(Badge<RequestClient>)
     }
 }
 
+void Request::did_receive_cached_response(Badge<RequestClient>, int fd, u64 offset, u64 size)
+{
+    // If the request was stopped while this IPC was in-flight, just bail.
+    if (!m_internal_stream_data) {
+        (void)Core::System::close(fd);
+        return;
+    }
+
+    auto mapped_file = Core::MappedFile::map_from_fd_and_close(fd, "cached response"sv);
+    if (mapped_file.is_error() || offset > mapped_file.value()->bytes().size() || size > mapped_file.value()->bytes().size() - offset) {
+        dbgln("Request: Unable to map cached response for request {}", m_request_id);
+        m_internal_stream_data->failed_to_map_cached_response = true;
+        return;
+    }
+
+    auto bytes = mapped_file.value()->bytes().slice(offset, size);
+
+    if (m_mode == Mode::Buffered && m_internal_buffered_data->payload_stream.used_buffer_size() == 0) {
+        m_internal_buffered_data->mapped_payload = mapped_file.release_value();
+        m_internal_buffered_data->mapped_payload_bytes = bytes;
+        return;
+    }
+
+    m_internal_stream_data->on_data_available(bytes);
+}
+
 void Request::set_up_internal_stream_data(DataReceived on_data_available)
 {
     VERIFY(!m_internal_stream_data);
@@ -142,6 +186,8 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
 
         m_internal_stream_data->total_size = total_size;
         m_internal_stream_data->network_error = network_error;
+        if (m_internal_stream_data->failed_to_map_cached_response && !network_error.has_value())
+            m_internal_stream_data->network_error = NetworkError::CacheReadFailed;
         m_internal_stream_data->timing_info = timing_info;
         m_internal_stream_data->request_done = true;
         m_internal_stream_data->on_finish();
@@ -158,7 +204,9 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
         }
     };
 
-    m_internal_stream_data->read_notifier->on_activation = [this, on_data_available = move(on_data_available)]() {
+    m_internal_stream_data->on_data_available = move(on_data_available);
+
+    m_internal_stream_data->read_notifier->on_activation = [this]() {
         static constexpr size_t buffer_size = 256 * KiB;
         static char buffer[buffer_size];
 
@@ -177,7 +225,7 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
             if (read_bytes.is_empty())
                 break;
 
-            on_data_available(read_bytes);
+            m_internal_stream_data->on_data_available(read_bytes);
         } while (true);
 
         if (m_internal_stream_data->read_stream->is_eof())
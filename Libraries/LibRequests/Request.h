@@ -13,10 +13,12 @@
 #include <AK/OwnPtr.h>
 #include <AK/RefCounted.h>
 #include <AK/WeakPtr.h>
+#include <LibCore/MappedFile.h>
 #include <LibCore/Notifier.h>
 #include <LibHTTP/HeaderList.h>
 #include <LibRequests/NetworkError.h>
 #include <LibRequests/RequestTimingInfo.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Requests {
 
@@ -59,6 +61,7 @@ public:
     u64 id() const { return m_request_id; }
     int fd() const { return m_fd; }
     bool stop();
+    void set_priority(RequestServer::RequestPriority);
 
     using BufferedRequestFinished = Function<void(u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error, NonnullRefPtr<HTTP::HeaderList> response_headers, Optional<u32> response_code, Optional<String> reason_phrase, ReadonlyBytes payload)>;
 
@@ -79,6 +82,7 @@ public:
     void did_finish(Badge<RequestClient>, u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error);
     void did_receive_headers(Badge<RequestClient>, NonnullRefPtr<HTTP::HeaderList> response_headers, Optional<u32> response_code, Optional<String> const& reason_phrase);
     void did_request_certificates(Badge<RequestClient>);
+    void did_receive_cached_response(Badge<RequestClient>, int fd, u64 offset, u64 size);
 
     RefPtr<Core::Notifier>& write_notifier(Badge<RequestClient>) { return m_write_notifier; }
     void set_request_fd(Badge<RequestClient>, int fd);
@@ -110,6 +114,11 @@ private:
         NonnullRefPtr<HTTP::HeaderList> response_headers;
         Optional<u32> response_code;
         Optional<String> reason_phrase;
+
+        // A cached response is handed to the callback straight from its mapping, rather than being copied into the
+        // payload stream.
+        OwnPtr<Core::MappedFile> mapped_payload;
+        ReadonlyBytes mapped_payload_bytes;
     };
 
     struct InternalStreamData {
@@ -117,8 +126,10 @@ private:
 
         OwnPtr<ReadStream> read_stream;
         RefPtr<Core::Notifier> read_notifier;
+        DataReceived on_data_available;
         u32 total_size { 0 };
         Optional<NetworkError> network_error;
+        bool failed_to_map_cached_response { false };
         bool request_done { false };
         RequestTimingInfo timing_info;
         Function<void()> on_finish {};
@@ -29,30 +29,103 @@ void RequestClient::die()
         promise->reject(Error::from_string_literal("RequestServer process died"));
 
     m_requests.clear();
+    m_pending_requests.clear();
+    m_pending_request_header_table.clear();
+    m_pending_request_header_indices.clear();
     m_pending_cache_size_estimations.clear();
 }
 
-RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, Optional<HTTP::HeaderList const&> request_headers, ReadonlyBytes request_body, HTTP::CacheMode cache_mode, HTTP::Cookie::IncludeCredentials include_credentials, Core::ProxyData const& proxy_data)
+RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, Optional<HTTP::HeaderList const&> request_headers, ReadonlyBytes request_body, HTTP::CacheMode cache_mode, HTTP::Cookie::IncludeCredentials include_credentials, Core::ProxyData const& proxy_data, RequestServer::RequestPriority priority)
 {
     auto request_id = m_next_request_id++;
     auto headers = request_headers.map([](auto const& headers) { return headers.headers().span(); }).value_or({});
 
-    IPCProxy::async_start_request(request_id, method, url, headers, request_body, cache_mode, include_credentials, proxy_data);
+    // OPTIMIZATION: Pages start many requests at once, usually with mostly the same headers. Rather than sending each
+    //               of them in its own message, hold on to them until we return to the event loop, and then send them
+    //               all in one message, in which every distinct header is only sent once.
+    BatchedRequest pending_request {
+        .request_id = request_id,
+        .method = method,
+        .url = url,
+        .header_indices = {},
+        .request_body = MUST(ByteBuffer::copy(request_body)),
+        .cache_mode = cache_mode,
+        .include_credentials = include_credentials,
+        .proxy_data = proxy_data,
+        .priority = priority,
+    };
+
+    pending_request.header_indices.ensure_capacity(headers.size());
+    for (auto const& header : headers) {
+        auto header_index = m_pending_request_header_indices.ensure(header, [&] {
+            m_pending_request_header_table.append(header);
+            return static_cast<u32>(m_pending_request_header_table.size() - 1);
+        });
+        pending_request.header_indices.unchecked_append(header_index);
+    }
+
+    if (m_pending_requests.is_empty())
+        deferred_invoke([this] { send_pending_requests(); });
+    m_pending_requests.append(move(pending_request));
+
     auto request = Request::create_from_id({}, *this, request_id);
     m_requests.set(request_id, request);
     return request;
 }
 
+void RequestClient::send_pending_requests()
+{
+    if (m_pending_requests.is_empty())
+        return;
+
+    auto header_table = move(m_pending_request_header_table);
+    auto pending_requests = move(m_pending_requests);
+    m_pending_request_header_indices.clear();
+
+    if (pending_requests.size() == 1) {
+        auto& request = pending_requests.first();
+
+        Vector<HTTP::Header> headers;
+        headers.ensure_capacity(request.header_indices.size());
+        for (auto header_index : request.header_indices)
+            headers.unchecked_append(header_table[header_index]);
+
+        IPCProxy::async_start_request(request.request_id, request.method, request.url, headers, request.request_body, request.cache_mode, request.include_credentials, request.proxy_data, request.priority);
+        return;
+    }
+
+    IPCProxy::async_start_requests(header_table, pending_requests);
+}
+
 bool RequestClient::stop_request(Badge<Request>, Request& request)
 {
     if (!m_requests.contains(request.id()))
         return false;
+    send_pending_requests();
     return IPCProxy::stop_request(request.id());
 }
 
+void RequestClient::set_request_priority(Badge<Request>, Request& request, RequestServer::RequestPriority priority)
+{
+    if (!m_requests.contains(request.id()))
+        return;
+
+    // If the request has not been sent to RequestServer yet, it will simply be sent with its new priority.
+    auto pending_request = m_pending_requests.find_if([&](auto const& pending_request) {
+        return pending_request.request_id == request.id();
+    });
+    if (!pending_request.is_end()) {
+        pending_request->priority = priority;
+        return;
+    }
+
+    async_set_request_priority(request.id(), priority);
+}
+
 void RequestClient::ensure_connection(URL::URL const& url, RequestServer::CacheLevel cache_level)
 {
     auto request_id = m_next_request_id++;
+    send_pending_requests();
     async_ensure_connection(request_id, url, cache_level);
 }
 
@@ -60,6 +133,7 @@ bool RequestClient::set_certificate(Badge<Request>, Request& request, ByteString
 {
     if (!m_requests.contains(request.id()))
         return false;
+    send_pending_requests();
     return IPCProxy::set_certificate(request.id(), move(certificate), move(key));
 }
 
@@ -93,6 +167,14 @@ void RequestClient::request_started(u64 request_id, IPC::File response_file)
     request.value()->set_request_fd({}, response_fd);
 }
 
+void RequestClient::cached_response_available(u64 request_id, IPC::File response_file, u64 offset, u64 size)
+{
+    if (auto request = m_requests.get(request_id); request.has_value())
+        (*request)->did_receive_cached_response({}, response_file.take_fd(), offset, size);
+    else
+        warnln("Received cached response for non-existent request {}", request_id);
+}
+
 void RequestClient::request_finished(u64 request_id, u64 total_size, RequestTimingInfo timing_info, Optional<NetworkError> network_error)
 {
     if (RefPtr<Request> request = m_requests.get(request_id).value_or(nullptr)) {
@@ -11,6 +11,7 @@
 #include <LibHTTP/Cookie/IncludeCredentials.h>
 #include <LibHTTP/HeaderList.h>
 #include <LibIPC/ConnectionToServer.h>
+#include <LibRequests/BatchedRequest.h>
 #include <LibRequests/CacheSizes.h>
 #include <LibRequests/RequestTimingInfo.h>
 #include <LibRequests/WebSocket.h>
@@ -33,8 +34,9 @@ public:
     explicit RequestClient(NonnullOwnPtr<IPC::Transport>);
     virtual ~RequestClient() override;
 
-    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, Optional<HTTP::HeaderList const&> request_headers = {}, ReadonlyBytes request_body = {}, HTTP::CacheMode = HTTP::CacheMode::Default, HTTP::Cookie::IncludeCredentials = HTTP::Cookie::IncludeCredentials::Yes, Core::ProxyData const& = {});
+    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, Optional<HTTP::HeaderList const&> request_headers = {}, ReadonlyBytes request_body = {}, HTTP::CacheMode = HTTP::CacheMode::Default, HTTP::Cookie::IncludeCredentials = HTTP::Cookie::IncludeCredentials::Yes, Core::ProxyData const& = {}, RequestServer::RequestPriority = RequestServer::RequestPriority::Medium);
     bool stop_request(Badge<Request>, Request&);
+    void set_request_priority(Badge<Request>, Request&, RequestServer::RequestPriority);
     void ensure_connection(URL::URL const&, RequestServer::CacheLevel);
 
     bool set_certificate(Badge<Request>, Request&, ByteString, ByteString);
@@ -49,7 +51,10 @@ public:
 private:
     virtual void die() override;
 
+    void send_pending_requests();
+
     virtual void request_started(u64 request_id, IPC::File) override;
+    virtual void cached_response_available(u64 request_id, IPC::File, u64 offset, u64 size) override;
     virtual void request_finished(u64 request_id, u64, RequestTimingInfo, Optional<NetworkError>) override;
     virtual void headers_became_available(u64 request_id, Vector<HTTP::Header>, Optional<u32>, Optional<String>) override;
 
@@ -70,6 +75,16 @@ private:
     HashMap<u64, RefPtr<Request>> m_requests;
     u64 m_next_request_id { 0 };
 
+    struct HeaderTraits : public DefaultTraits<HTTP::Header> {
+        static unsigned hash(HTTP::Header const& header) { return pair_int_hash(header.name.hash(), header.value.hash()); }
+        static bool equals(HTTP::Header const& a, HTTP::Header const& b) { return a.name == b.name && a.value == b.value; }
+    };
+
+    // Requests started since the last time we returned to the event loop, which are sent to RequestServer together.
+    Vector<BatchedRequest> m_pending_requests;
+    Vector<HTTP::Header> m_pending_request_header_table;
+    HashMap<HTTP::Header, u32, HeaderTraits> m_pending_request_header_indices;
+
     HashMap<u64, NonnullRefPtr<WebSocket>> m_websockets;
     u64 m_next_websocket_id { 0 };
 
@@ -8,16 +8,45 @@
  */
 
 #include <AK/BinarySearch.h>
+#include <AK/CharacterTypes.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibTextCodec/LookupTables.h>
 
+#include <simdutf.h>
+
 namespace TextCodec {
 
 static constexpr u32 replacement_code_point = 0xfffd;
 
+static size_t length_of_ascii_prefix(ReadonlyBytes bytes)
+{
+    auto result = simdutf::validate_ascii_with_errors(reinterpret_cast<char const*>(bytes.data()), bytes.size());
+    return result.error == simdutf::SUCCESS ? bytes.size() : result.count;
+}
+
+// OPTIMIZATION: Decoders of single-byte encodings map each byte to a code point on its own. Text in these encodings tends
+//               to be made up of long runs of ASCII, which we look for with SIMD and append to the output all at once.
+template<typename DecodeNonASCIIByte>
+static ErrorOr<String> decode_single_byte_encoding(StringView input, DecodeNonASCIIByte decode_non_ascii_byte)
+{
+    StringBuilder builder(input.length());
+    auto bytes = input.bytes();
+
+    while (!bytes.is_empty()) {
+        auto ascii_length = length_of_ascii_prefix(bytes);
+        TRY(builder.try_append(StringView { bytes.trim(ascii_length) }));
+        bytes = bytes.slice(ascii_length);
+
+        for (; !bytes.is_empty() && !is_ascii(bytes[0]); bytes = bytes.slice(1))
+            TRY(builder.try_append_code_point(decode_non_ascii_byte(bytes[0])));
+    }
+
+    return builder.to_string_without_validation();
+}
+
 namespace {
 
 Latin1Decoder s_latin1_decoder;
@@ -347,6 +376,11 @@ bool Decoder::validate(StringView input)
 
 ErrorOr<String> Decoder::to_utf8(StringView input)
 {
+    // OPTIMIZATION: Input that consists only of ASCII decodes to itself with ASCII compatible encodings, and is
+    //               already valid UTF-8.
+    if (is_ascii_compatible() && length_of_ascii_prefix(input.bytes()) == input.length())
+        return String::from_utf8_without_validation(input.bytes());
+
     StringBuilder builder(input.length());
     TRY(process(input, [&builder](u32 c) { return builder.try_append_code_point(c); }));
     return builder.to_string_without_validation();
@@ -408,6 +442,11 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    return decode_single_byte_encoding(input, [](u8 byte) -> u32 { return byte; });
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -456,20 +495,21 @@ ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<
 }
 
 // https://encoding.spec.whatwg.org/#x-user-defined-decoder
-ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+static u32 convert_x_user_defined_to_utf8(u8 ch)
 {
-    auto convert_x_user_defined_to_utf8 = [](u8 ch) -> u32 {
-        // 2. If byte is an ASCII byte, return a code point whose value is byte.
-        // https://infra.spec.whatwg.org/#ascii-byte
-        // An ASCII byte is a byte in the range 0x00 (NUL) to 0x7F (DEL), inclusive.
-        // NOTE: This doesn't check for ch >= 0x00, as that would always be true due to being unsigned.
-        if (ch <= 0x7f)
-            return ch;
-
-        // 3. Return a code point whose value is 0xF780 + byte − 0x80.
-        return 0xF780 + ch - 0x80;
-    };
+    // 2. If byte is an ASCII byte, return a code point whose value is byte.
+    // https://infra.spec.whatwg.org/#ascii-byte
+    // An ASCII byte is a byte in the range 0x00 (NUL) to 0x7F (DEL), inclusive.
+    // NOTE: This doesn't check for ch >= 0x00, as that would always be true due to being unsigned.
+    if (ch <= 0x7f)
+        return ch;
+
+    // 3. Return a code point whose value is 0xF780 + byte − 0x80.
+    return 0xF780 + ch - 0x80;
+}
 
+ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
     for (auto ch : input) {
         TRY(on_code_point(convert_x_user_defined_to_utf8(ch)));
     }
@@ -479,6 +519,11 @@ ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<vo
     return {};
 }
 
+ErrorOr<String> XUserDefinedDecoder::to_utf8(StringView input)
+{
+    return decode_single_byte_encoding(input, convert_x_user_defined_to_utf8);
+}
+
 // https://encoding.spec.whatwg.org/#single-byte-decoder
 template<Integral ArrayType>
 ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
@@ -502,6 +547,12 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+ErrorOr<String> SingleByteDecoder<ArrayType>::to_utf8(StringView input)
+{
+    return decode_single_byte_encoding(input, [this](u8 byte) -> u32 { return m_translation_table[byte - 0x80]; });
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
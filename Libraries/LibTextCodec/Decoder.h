@@ -25,6 +25,9 @@ public:
 protected:
     virtual ~Decoder() = default;
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) = 0;
+
+    // Whether every ASCII byte that is not part of a multi-byte sequence decodes to the code point with its value.
+    virtual bool is_ascii_compatible() const { return true; }
 };
 
 class TEXTCODEC_API UTF8Decoder final : public Decoder {
@@ -61,6 +64,7 @@ public:
     }
 
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<String> to_utf8(StringView) override;
 
 private:
     Array<ArrayType, 128> m_translation_table;
@@ -70,18 +74,23 @@ class TEXTCODEC_API Latin1Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+    virtual ErrorOr<String> to_utf8(StringView) override;
 };
 
 class TEXTCODEC_API PDFDocEncodingDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+
+private:
+    virtual bool is_ascii_compatible() const override { return false; }
 };
 
 class TEXTCODEC_API XUserDefinedDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+    virtual ErrorOr<String> to_utf8(StringView) override;
 };
 
 class TEXTCODEC_API GB18030Decoder final : public Decoder {
@@ -102,6 +111,9 @@ public:
 class TEXTCODEC_API ISO2022JPDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+private:
+    virtual bool is_ascii_compatible() const override { return false; }
 };
 
 class TEXTCODEC_API ShiftJISDecoder final : public Decoder {
@@ -118,6 +130,9 @@ class TEXTCODEC_API ReplacementDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView input) override { return input.is_empty(); }
+
+private:
+    virtual bool is_ascii_compatible() const override { return false; }
 };
 
 // This will return a decoder for the exact name specified, skipping get_standardized_encoding.
@@ -18,6 +18,7 @@
 #include <LibCore/EventReceiver.h>
 #include <LibCore/Promise.h>
 #include <LibThreading/Forward.h>
+#include <LibThreading/ThreadPool.h>
 
 namespace Threading {
 
@@ -51,16 +52,21 @@ public:
     // It is not used to synchronize access to any other state (m_result), so relaxed atomics are fine.
     void cancel() { m_canceled.store(true, AK::MemoryOrder::memory_order_relaxed); }
     // If your action is long-running, you should periodically check the cancel state and possibly return early.
+    // An action that is canceled before it starts is not run at all.
     bool is_canceled() const { return m_canceled.load(AK::MemoryOrder::memory_order_relaxed); }
 
 private:
-    BackgroundAction(ESCAPING Function<ErrorOr<Result>(BackgroundAction&)> action, ESCAPING Function<void(Result)> on_complete, ESCAPING Function<void(Error)> on_error = {})
+    // Actions are run one after another on the background thread, unless they are given a thread pool priority. Those
+    // are run on the shared thread pool instead, where several of them may run at once.
+    BackgroundAction(ESCAPING Function<ErrorOr<Result>(BackgroundAction&)> action, ESCAPING Function<void(Result)> on_complete, ESCAPING Function<void(Error)> on_error = {}, Optional<ThreadPool::Priority> thread_pool_priority = {})
         : m_action(move(action))
         , m_on_complete(move(on_complete))
         , m_on_error(move(on_error))
     {
-        enqueue_work([self = NonnullRefPtr(*this), origin_event_loop = Core::EventLoop::current_weak()]() mutable {
-            auto result = self->m_action(*self);
+        auto work = [self = NonnullRefPtr(*this), origin_event_loop = Core::EventLoop::current_weak()]() mutable {
+            Optional<ErrorOr<Result>> result;
+            if (!self->is_canceled())
+                result = self->m_action(*self);
 
             auto event_loop = origin_event_loop->take();
             if (!event_loop) {
@@ -70,19 +76,24 @@ private:
             event_loop->deferred_invoke([self = move(self), result = move(result)]() mutable {
                 auto const canceled = self->m_canceled.load(AK::MemoryOrder::memory_order_relaxed);
 
-                if (canceled)
+                if (canceled || !result.has_value())
                     return;
 
-                if (result.is_error()) {
+                if (result->is_error()) {
                     if (self->m_on_error)
-                        self->m_on_error(result.release_error());
+                        self->m_on_error(result->release_error());
                     return;
                 }
 
                 if (self->m_on_complete)
-                    self->m_on_complete(result.release_value());
+                    self->m_on_complete(result->release_value());
             });
-        });
+        };
+
+        if (thread_pool_priority.has_value())
+            ThreadPool::the().submit(move(work), *thread_pool_priority);
+        else
+            enqueue_work(move(work));
     }
 
     Function<ErrorOr<Result>(BackgroundAction&)> m_action;
@@ -38,6 +38,9 @@ public:
     void lock();
     void unlock();
 
+    // Locks the mutex if no other thread holds it, without waiting for it otherwise.
+    [[nodiscard]] bool try_lock();
+
 private:
     pthread_mutex_t m_mutex;
     unsigned m_lock_count { 0 };
@@ -70,6 +73,14 @@ ALWAYS_INLINE void Mutex::lock()
     m_lock_count++;
 }
 
+ALWAYS_INLINE bool Mutex::try_lock()
+{
+    if (pthread_mutex_trylock(&m_mutex) != 0)
+        return false;
+    m_lock_count++;
+    return true;
+}
+
 ALWAYS_INLINE void Mutex::unlock()
 {
     VERIFY(m_lock_count > 0);
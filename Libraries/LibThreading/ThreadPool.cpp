@@ -4,13 +4,21 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/System.h>
 #include <LibThreading/ThreadPool.h>
 
-static constexpr size_t THREAD_COUNT = 4;
+static constexpr size_t MINIMUM_THREAD_COUNT = 2;
+static constexpr size_t MAXIMUM_THREAD_COUNT = 8;
 static constexpr size_t THREAD_STACK_SIZE = 8 * MiB;
 
 namespace Threading {
 
+struct CurrentWorker {
+    ThreadPool const* pool { nullptr };
+    size_t index { 0 };
+};
+static thread_local CurrentWorker s_current_worker;
+
 ThreadPool& ThreadPool::the()
 {
     static ThreadPool* instance = new ThreadPool;
@@ -19,37 +27,183 @@ ThreadPool& ThreadPool::the()
 
 ThreadPool::ThreadPool()
 {
-    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+    // Leave a core for the thread that is submitting work.
+    auto thread_count = clamp(static_cast<size_t>(Core::System::hardware_concurrency()) - 1, MINIMUM_THREAD_COUNT, MAXIMUM_THREAD_COUNT);
+
+    // NB: All workers must exist before any of them start, as they steal from one another.
+    for (size_t i = 0; i < thread_count; ++i)
+        m_workers.append(make<Worker>());
+
+    for (size_t i = 0; i < thread_count; ++i) {
         auto name = ByteString::formatted("Pool/{}", i);
-        auto thread = Thread::construct(name, [this]() -> intptr_t {
-            return worker_thread_func();
+        auto thread = Thread::construct(name, [this, i]() -> intptr_t {
+            return worker_thread_func(i);
         });
         thread->set_stack_size(THREAD_STACK_SIZE);
         thread->start();
-        m_threads.append(move(thread));
+        m_workers[i]->thread = move(thread);
     }
 }
 
-intptr_t ThreadPool::worker_thread_func()
+bool ThreadPool::is_current_thread_a_worker() const
+{
+    return s_current_worker.pool == this;
+}
+
+intptr_t ThreadPool::worker_thread_func(size_t worker_index)
 {
+    s_current_worker = { this, worker_index };
+
     while (true) {
-        Function<void()> work;
+        auto epoch = m_work_epoch.load(AK::memory_order_seq_cst);
 
-        {
-            MutexLocker locker(m_mutex);
-            m_condition.wait_while([this] { return m_work_queue.is_empty(); });
-            work = m_work_queue.dequeue();
+        if (auto* task = find_task(worker_index)) {
+            run_task(task);
+            continue;
         }
 
-        work();
+        MutexLocker locker(m_sleep_mutex);
+
+        m_sleeping_worker_count.fetch_add(1, AK::memory_order_seq_cst);
+        m_sleep_condition.wait_while([&] { return m_work_epoch.load(AK::memory_order_seq_cst) == epoch; });
+        m_sleeping_worker_count.fetch_sub(1, AK::memory_order_seq_cst);
+    }
+}
+
+void ThreadPool::submit(Function<void()> work, Priority priority)
+{
+    auto* task = new Task(move(work));
+
+    if (priority == Priority::Normal && is_current_thread_a_worker()) {
+        m_workers[s_current_worker.index]->deque.push(task);
+    } else {
+        auto& queue = m_injection_queues[to_underlying(priority)];
+
+        MutexLocker locker(queue.mutex);
+        queue.tasks.enqueue(task);
+        queue.size.fetch_add(1, AK::memory_order_release);
+    }
+
+    notify_worker();
+}
+
+void ThreadPool::notify_worker()
+{
+    m_work_epoch.fetch_add(1, AK::memory_order_seq_cst);
+
+    // OPTIMIZATION: Busy workers will find the task on their own, so we only need the mutex to wake a sleeping worker.
+    if (m_sleeping_worker_count.load(AK::memory_order_seq_cst) == 0)
+        return;
+
+    MutexLocker locker(m_sleep_mutex);
+    m_sleep_condition.signal();
+}
+
+bool ThreadPool::run_pending_task()
+{
+    Optional<size_t> worker_index;
+    if (is_current_thread_a_worker())
+        worker_index = s_current_worker.index;
+
+    auto* task = find_task(worker_index);
+    if (!task)
+        return false;
+
+    run_task(task);
+    return true;
+}
+
+ThreadPool::Task* ThreadPool::find_task(Optional<size_t> worker_index)
+{
+    if (auto* task = dequeue_injected_task(Priority::High))
+        return task;
+
+    if (worker_index.has_value()) {
+        if (auto* task = m_workers[*worker_index]->deque.pop())
+            return task;
     }
+
+    if (auto* task = dequeue_injected_task(Priority::Normal))
+        return task;
+
+    // Start with the worker after ourselves, so that thieves spread out over the other workers.
+    auto first_victim = worker_index.map([](auto index) { return index + 1; }).value_or(0);
+
+    for (size_t i = 0; i < m_workers.size(); ++i) {
+        auto victim = (first_victim + i) % m_workers.size();
+        if (victim == worker_index)
+            continue;
+
+        if (auto* task = m_workers[victim]->deque.steal())
+            return task;
+    }
+
+    return dequeue_injected_task(Priority::Low);
+}
+
+ThreadPool::Task* ThreadPool::dequeue_injected_task(Priority priority)
+{
+    auto& queue = m_injection_queues[to_underlying(priority)];
+
+    // OPTIMIZATION: Avoid contending on the queue's mutex when it is empty, which is most of the time.
+    if (queue.size.load(AK::memory_order_acquire) == 0)
+        return nullptr;
+
+    MutexLocker locker(queue.mutex);
+    if (queue.tasks.is_empty())
+        return nullptr;
+
+    queue.size.fetch_sub(1, AK::memory_order_relaxed);
+    return queue.tasks.dequeue();
 }
 
-void ThreadPool::submit(Function<void()> work)
+void ThreadPool::run_task(Task* task)
 {
+    (*task)();
+    delete task;
+}
+
+TaskGroup::TaskGroup(ThreadPool& pool, ThreadPool::Priority priority)
+    : m_pool(pool)
+    , m_priority(priority)
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    wait();
+}
+
+void TaskGroup::spawn(Function<void()> work)
+{
+    {
+        MutexLocker locker(m_mutex);
+        m_pending_task_count.fetch_add(1, AK::memory_order_relaxed);
+    }
+
+    m_pool.submit([this, work = move(work)]() {
+        work();
+
+        MutexLocker locker(m_mutex);
+        if (m_pending_task_count.fetch_sub(1, AK::memory_order_release) == 1)
+            m_condition.broadcast();
+    },
+        m_priority);
+}
+
+void TaskGroup::wait()
+{
+    // Workers help run pending tasks rather than block, as the tasks we are waiting on may be queued behind us. Other
+    // threads block, so that they do not end up running unrelated work.
+    if (m_pool.is_current_thread_a_worker()) {
+        while (m_pending_task_count.load(AK::memory_order_acquire) != 0) {
+            if (!m_pool.run_pending_task())
+                break;
+        }
+    }
+
     MutexLocker locker(m_mutex);
-    m_work_queue.enqueue(move(work));
-    m_condition.signal();
+    m_condition.wait_while([&] { return m_pending_task_count.load(AK::memory_order_relaxed) != 0; });
 }
 
 }
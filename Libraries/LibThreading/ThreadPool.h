@@ -6,30 +6,125 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/Queue.h>
 #include <AK/Vector.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
+#include <LibThreading/WorkStealingDeque.h>
 
 namespace Threading {
 
+// A pool of worker threads which each have their own deque of tasks. Tasks that a worker submits are pushed onto its
+// own deque, and are run most recent first. Workers without tasks of their own steal the oldest tasks of other workers.
+// Tasks submitted from outside of the pool are shared between the workers through a queue for each priority.
 class ThreadPool {
 public:
+    enum class Priority : u8 {
+        High,   // Run before any other pending task.
+        Normal, // Run before any Low priority task.
+        Low,    // Only run once there are no other pending tasks.
+    };
+
     static ThreadPool& the();
 
-    void submit(Function<void()>);
+    void submit(Function<void()>, Priority = Priority::Normal);
+
+    // Calls the callback once for each index from 0 up to the count, spreading the calls over the pool's workers and
+    // the calling thread. Returns once all of the calls have returned.
+    template<typename Callback>
+    void parallel_for(size_t count, Callback const&, Priority = Priority::Normal);
+
+    size_t worker_count() const { return m_workers.size(); }
+    bool is_current_thread_a_worker() const;
+
+    // Runs one pending task on the calling thread, for workers that would otherwise block while waiting on other tasks.
+    // Returns false if no task was pending.
+    bool run_pending_task();
 
 private:
+    using Task = Function<void()>;
+
+    struct Worker {
+        WorkStealingDeque<Task> deque;
+        RefPtr<Thread> thread;
+    };
+
+    struct InjectionQueue {
+        Mutex mutex;
+        Queue<Task*> tasks;
+        Atomic<size_t> size { 0 };
+    };
+
     ThreadPool();
 
-    intptr_t worker_thread_func();
+    intptr_t worker_thread_func(size_t worker_index);
+
+    Task* find_task(Optional<size_t> worker_index);
+    Task* dequeue_injected_task(Priority);
+    static void run_task(Task*);
+
+    void notify_worker();
+
+    Vector<NonnullOwnPtr<Worker>> m_workers;
+    InjectionQueue m_injection_queues[3];
+
+    // Workers go to sleep once they cannot find any task to run. Every submitted task bumps the epoch, so that a worker
+    // which was about to go to sleep notices the task.
+    Mutex m_sleep_mutex;
+    ConditionVariable m_sleep_condition { m_sleep_mutex };
+    Atomic<u64> m_work_epoch { 0 };
+    Atomic<size_t> m_sleeping_worker_count { 0 };
+};
+
+// A set of tasks which may be waited on together. A worker waiting on a task group runs pending tasks in the meantime,
+// so that tasks may spawn and wait on further tasks without exhausting the pool.
+class TaskGroup {
+    AK_MAKE_NONCOPYABLE(TaskGroup);
+    AK_MAKE_NONMOVABLE(TaskGroup);
 
+public:
+    explicit TaskGroup(ThreadPool& = ThreadPool::the(), ThreadPool::Priority = ThreadPool::Priority::Normal);
+    ~TaskGroup();
+
+    void spawn(Function<void()>);
+    void wait();
+
+private:
+    ThreadPool& m_pool;
+    ThreadPool::Priority m_priority { ThreadPool::Priority::Normal };
+
+    // NB: The count is only changed while holding the mutex, so that a waiter cannot destroy the group while the last
+    //     of its tasks is still signaling the condition.
     Mutex m_mutex;
     ConditionVariable m_condition { m_mutex };
-    Queue<Function<void()>> m_work_queue;
-    Vector<NonnullRefPtr<Thread>> m_threads;
+    Atomic<size_t> m_pending_task_count { 0 };
 };
 
+template<typename Callback>
+void ThreadPool::parallel_for(size_t count, Callback const& callback, Priority priority)
+{
+    if (count == 0)
+        return;
+
+    auto chunk_count = min(count, worker_count() + 1);
+
+    auto run_chunk = [&](size_t chunk_index) {
+        auto end = count * (chunk_index + 1) / chunk_count;
+        for (auto index = count * chunk_index / chunk_count; index < end; ++index)
+            callback(index);
+    };
+
+    TaskGroup group { *this, priority };
+
+    for (size_t chunk_index = 1; chunk_index < chunk_count; ++chunk_index)
+        group.spawn([&run_chunk, chunk_index] { run_chunk(chunk_index); });
+
+    run_chunk(0);
+    group.wait();
+}
+
 }
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+
+namespace Threading {
+
+// A Chase-Lev deque, with the memory orderings from "Correct and Efficient Work-Stealing for Weak Memory Models" by
+// Lê et al. Its owning thread pushes and pops items at the bottom of the deque, while any other thread may steal items
+// from its top. Neither end takes a lock.
+//
+// https://fzn.fr/readings/ppopp13.pdf
+template<typename T>
+class WorkStealingDeque {
+    AK_MAKE_NONCOPYABLE(WorkStealingDeque);
+    AK_MAKE_NONMOVABLE(WorkStealingDeque);
+
+public:
+    explicit WorkStealingDeque(size_t initial_capacity = 64)
+    {
+        VERIFY(is_power_of_two(initial_capacity));
+
+        auto buffer = make<Buffer>(initial_capacity);
+        m_buffer.store(buffer.ptr(), AK::memory_order_relaxed);
+        m_buffers.append(move(buffer));
+    }
+
+    // May only be called by the owning thread.
+    void push(T* item)
+    {
+        auto bottom = m_bottom.load(AK::memory_order_relaxed);
+        auto top = m_top.load(AK::memory_order_acquire);
+        auto* buffer = m_buffer.load(AK::memory_order_relaxed);
+
+        if (bottom - top > static_cast<i64>(buffer->capacity()) - 1)
+            buffer = grow(*buffer, top, bottom);
+
+        buffer->put(bottom, item);
+        AK::atomic_thread_fence(AK::memory_order_release);
+        m_bottom.store(bottom + 1, AK::memory_order_relaxed);
+    }
+
+    // May only be called by the owning thread. Returns the most recently pushed item, or null if the deque is empty.
+    T* pop()
+    {
+        auto bottom = m_bottom.load(AK::memory_order_relaxed) - 1;
+        auto* buffer = m_buffer.load(AK::memory_order_relaxed);
+        m_bottom.store(bottom, AK::memory_order_relaxed);
+        AK::atomic_thread_fence(AK::memory_order_seq_cst);
+        auto top = m_top.load(AK::memory_order_relaxed);
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, AK::memory_order_relaxed);
+            return nullptr;
+        }
+
+        auto* item = buffer->get(bottom);
+
+        // This is the last item, so we race against thieves for it.
+        if (top == bottom) {
+            if (!m_top.compare_exchange_strong(top, top + 1, AK::memory_order_seq_cst))
+                item = nullptr;
+            m_bottom.store(bottom + 1, AK::memory_order_relaxed);
+        }
+
+        return item;
+    }
+
+    // May be called by any thread. Returns the least recently pushed item, or null if the deque is empty or another
+    // thread took the item first.
+    T* steal()
+    {
+        auto top = m_top.load(AK::memory_order_acquire);
+        AK::atomic_thread_fence(AK::memory_order_seq_cst);
+        auto bottom = m_bottom.load(AK::memory_order_acquire);
+
+        if (top >= bottom)
+            return nullptr;
+
+        auto* item = m_buffer.load(AK::memory_order_acquire)->get(top);
+        if (!m_top.compare_exchange_strong(top, top + 1, AK::memory_order_seq_cst))
+            return nullptr;
+
+        return item;
+    }
+
+    // This is only a snapshot, which may be out of date by the time it is used.
+    bool is_empty() const
+    {
+        return m_top.load(AK::memory_order_relaxed) >= m_bottom.load(AK::memory_order_relaxed);
+    }
+
+private:
+    class Buffer {
+        AK_MAKE_NONCOPYABLE(Buffer);
+        AK_MAKE_NONMOVABLE(Buffer);
+
+    public:
+        explicit Buffer(size_t capacity)
+            : m_mask(capacity - 1)
+            , m_slots(new Atomic<T*>[capacity])
+        {
+        }
+
+        ~Buffer() { delete[] m_slots; }
+
+        size_t capacity() const { return m_mask + 1; }
+
+        T* get(i64 index) const { return m_slots[index & m_mask].load(AK::memory_order_relaxed); }
+        void put(i64 index, T* item) { m_slots[index & m_mask].store(item, AK::memory_order_relaxed); }
+
+    private:
+        size_t m_mask { 0 };
+        Atomic<T*>* m_slots { nullptr };
+    };
+
+    Buffer* grow(Buffer const& buffer, i64 top, i64 bottom)
+    {
+        auto new_buffer = make<Buffer>(buffer.capacity() * 2);
+        for (auto index = top; index < bottom; ++index)
+            new_buffer->put(index, buffer.get(index));
+
+        auto* new_buffer_pointer = new_buffer.ptr();
+        m_buffer.store(new_buffer_pointer, AK::memory_order_release);
+
+        // NB: Thieves may still be reading from the previous buffers, so they are only freed along with the deque.
+        m_buffers.append(move(new_buffer));
+        return new_buffer_pointer;
+    }
+
+    Atomic<i64> m_top { 0 };
+    Atomic<i64> m_bottom { 0 };
+    Atomic<Buffer*> m_buffer { nullptr };
+
+    Vector<NonnullOwnPtr<Buffer>> m_buffers;
+};
+
+}
@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
+#include <AK/AnyOf.h>
 #include <AK/ByteString.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
@@ -705,11 +707,119 @@ static String remove_ascii_tab_or_newline(StringView input)
     return MUST(output.to_string());
 }
 
+static bool contains_code_points_to_percent_encode(StringView input, PercentEncodeSet percent_encode_set)
+{
+    return any_of(input, [&](char character) {
+        return code_point_is_in_percent_encode_set(static_cast<u8>(character), percent_encode_set);
+    });
+}
+
+// OPTIMIZATION: Most URLs that pages resolve are absolute http(s) URLs made up of nothing but ASCII characters that
+//               don't need to be percent-encoded. For those, the basic URL parser ends up splitting the input into its
+//               components as they are, so we do that directly instead of running the state machine. Anything that is
+//               not that simple returns an empty Optional, and has to go through the state machine.
+static Optional<URL> parse_simple_http_url(StringView input)
+{
+    String scheme;
+    if (input.starts_with("http://"sv))
+        scheme = "http"_string;
+    else if (input.starts_with("https://"sv))
+        scheme = "https"_string;
+    else
+        return {};
+    input = input.substring_view(scheme.bytes().size() + 3);
+
+    // NB: Credentials, IPv6 addresses, percent-encoded hosts and backslashes all end up here.
+    auto authority_length = input.find_any_of("/?#"sv).value_or(input.length());
+    auto authority = input.substring_view(0, authority_length);
+    input = input.substring_view(authority_length);
+
+    auto host_length = authority.find(':').value_or(authority.length());
+    auto host_input = authority.substring_view(0, host_length);
+    if (host_input.is_empty() || !all_of(host_input, [](char character) { return is_ascii_alphanumeric(character) || character == '.' || character == '-'; }))
+        return {};
+
+    Optional<u16> port;
+    if (host_length < authority.length()) {
+        auto port_input = authority.substring_view(host_length + 1);
+        if (!port_input.is_empty()) {
+            if (!all_of(port_input, is_ascii_digit))
+                return {};
+            port = port_input.to_number<u16>();
+            if (!port.has_value())
+                return {};
+        }
+    }
+
+    // NB: The host parser lowercases the host, and parses it as an IPv4 address if it ends in a number.
+    auto host = Parser::parse_host(host_input);
+    if (!host.has_value())
+        return {};
+
+    auto path_length = input.find_any_of("?#"sv).value_or(input.length());
+    auto path_input = input.substring_view(0, path_length);
+    input = input.substring_view(path_length);
+
+    Vector<String> paths;
+    if (path_input.is_empty()) {
+        paths.append(String {});
+    } else {
+        VERIFY(path_input.starts_with('/'));
+        // NB: Special URLs treat backslashes as path separators.
+        if (path_input.contains('\\') || contains_code_points_to_percent_encode(path_input, PercentEncodeSet::Path))
+            return {};
+
+        // NB: Every slash starts a new segment, including a trailing one.
+        while (path_input.starts_with('/')) {
+            path_input = path_input.substring_view(1);
+            auto segment_length = path_input.find('/').value_or(path_input.length());
+            auto segment = path_input.substring_view(0, segment_length);
+            if (is_single_dot_path_segment(segment) || is_double_dot_path_segment(segment))
+                return {};
+            paths.append(String::from_utf8_without_validation(segment.bytes()));
+            path_input = path_input.substring_view(segment_length);
+        }
+    }
+
+    Optional<String> query;
+    if (input.starts_with('?')) {
+        auto query_length = input.find('#').value_or(input.length());
+        auto query_input = input.substring_view(1, query_length - 1);
+        if (contains_code_points_to_percent_encode(query_input, PercentEncodeSet::SpecialQuery))
+            return {};
+        query = String::from_utf8_without_validation(query_input.bytes());
+        input = input.substring_view(query_length);
+    }
+
+    Optional<String> fragment;
+    if (input.starts_with('#')) {
+        auto fragment_input = input.substring_view(1);
+        if (contains_code_points_to_percent_encode(fragment_input, PercentEncodeSet::Fragment))
+            return {};
+        fragment = String::from_utf8_without_validation(fragment_input.bytes());
+    }
+
+    URL url;
+    url.set_scheme(move(scheme));
+    url.set_host(host.release_value());
+    url.set_port(port);
+    url.set_raw_paths(move(paths));
+    url.set_query(move(query));
+    url.set_fragment(move(fragment));
+    return url;
+}
+
 // https://url.spec.whatwg.org/#concept-basic-url-parser
 Optional<URL> Parser::basic_parse(StringView raw_input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding)
 {
     dbgln_if(URL_PARSER_DEBUG, "URL::Parser::basic_parse: Parsing '{}'", raw_input);
 
+    // NB: Neither the base URL nor the encoding make a difference for the URLs the fast path accepts.
+    if (!url && !state_override.has_value()) {
+        if (auto simple_url = parse_simple_http_url(raw_input); simple_url.has_value())
+            return simple_url.release_value();
+    }
+
     size_t start_index = 0;
     size_t end_index = raw_input.length();
 
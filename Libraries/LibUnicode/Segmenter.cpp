@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf32View.h>
 #include <LibUnicode/CharacterTypes.h>
@@ -13,6 +16,7 @@
 
 #include <unicode/brkiter.h>
 #include <unicode/utext.h>
+#include <unicode/utf16.h>
 #include <unicode/utf8.h>
 
 namespace Unicode {
@@ -72,6 +76,11 @@ public:
         m_length = text.length_in_code_units();
     }
 
+    virtual void set_segmented_text(Utf16String text) override
+    {
+        m_length = text.length_in_code_units();
+    }
+
     virtual size_t current_boundary() override
     {
         return m_current;
@@ -174,6 +183,33 @@ public:
         m_segmenter->setText(m_segmented_text.get<icu::UnicodeString>());
     }
 
+    virtual void set_segmented_text(Utf16String text) override
+    {
+        UErrorCode status = U_ZERO_ERROR;
+
+        // NB: We hold on to the string, so ICU can read its storage directly instead of us having to copy or transcode
+        //     the text first. This keeps re-segmenting the text after every edit cheap, since ICU only finds boundaries
+        //     on demand.
+        m_segmented_text = move(text);
+        auto const& string = m_segmented_text.get<Utf16String>();
+
+        UText utext = UTEXT_INITIALIZER;
+        if (string.has_ascii_storage()) {
+            // NB: ASCII is a subset of UTF-8, and its indices are the same as those of the equivalent UTF-16 text.
+            auto view = string.ascii_view();
+            utext_openUTF8(&utext, view.characters_without_null_termination(), static_cast<i64>(view.length()), &status);
+        } else {
+            auto span = string.utf16_view().utf16_span();
+            utext_openUChars(&utext, span.data(), static_cast<i64>(span.size()), &status);
+        }
+        verify_icu_success(status);
+
+        m_segmenter->setText(&utext, status);
+        verify_icu_success(status);
+
+        utext_close(&utext);
+    }
+
     virtual size_t current_boundary() override
     {
         return m_segmenter->current();
@@ -286,6 +322,15 @@ private:
 
                 return text.getChar32Start(icu_boundary);
             },
+            [&](Utf16String const& text) {
+                if (boundary >= text.length_in_code_units())
+                    return static_cast<i32>(text.length_in_code_units());
+                if (text.has_ascii_storage())
+                    return icu_boundary;
+
+                U16_SET_CP_START(text.utf16_view().utf16_span().data(), 0, icu_boundary);
+                return icu_boundary;
+            },
             [](Empty) -> i32 { VERIFY_NOT_REACHED(); });
     }
 
@@ -305,7 +350,7 @@ private:
     }
 
     NonnullOwnPtr<icu::BreakIterator> m_segmenter;
-    Variant<Empty, String, icu::UnicodeString> m_segmented_text;
+    Variant<Empty, String, icu::UnicodeString, Utf16String> m_segmented_text;
 };
 
 NonnullOwnPtr<Segmenter> Segmenter::create(SegmenterGranularity segmenter_granularity)
@@ -315,6 +360,15 @@ NonnullOwnPtr<Segmenter> Segmenter::create(SegmenterGranularity segmenter_granul
 
 NonnullOwnPtr<Segmenter> Segmenter::create(StringView locale, SegmenterGranularity segmenter_granularity)
 {
+    // OPTIMIZATION: Creating a break iterator makes ICU look up and load the break rules for the locale, which is a lot
+    //               slower than cloning an existing break iterator. So we keep one break iterator per locale and
+    //               granularity around on each thread, and clone new segmenters from those.
+    static thread_local Array<HashMap<String, NonnullOwnPtr<icu::BreakIterator>>, 4> s_break_iterators;
+
+    auto& break_iterators = s_break_iterators[to_underlying(segmenter_granularity)];
+    if (auto break_iterator = break_iterators.get(locale); break_iterator.has_value())
+        return make<SegmenterImpl>(adopt_own(*break_iterator.value()->clone()), segmenter_granularity);
+
     UErrorCode status = U_ZERO_ERROR;
 
     auto locale_data = LocaleData::for_locale(locale);
@@ -336,7 +390,8 @@ NonnullOwnPtr<Segmenter> Segmenter::create(StringView locale, SegmenterGranulari
 
     verify_icu_success(status);
 
-    return make<SegmenterImpl>(segmenter.release_nonnull(), segmenter_granularity);
+    auto& break_iterator = break_iterators.ensure(MUST(String::from_utf8(locale)), [&] { return segmenter.release_nonnull(); });
+    return make<SegmenterImpl>(adopt_own(*break_iterator->clone()), segmenter_granularity);
 }
 
 NonnullOwnPtr<Segmenter> Segmenter::create_for_ascii_grapheme(size_t length)
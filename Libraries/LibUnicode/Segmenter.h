@@ -37,6 +37,7 @@ public:
 
     virtual void set_segmented_text(String) = 0;
     virtual void set_segmented_text(Utf16View const&) = 0;
+    virtual void set_segmented_text(Utf16String) = 0;
 
     virtual size_t current_boundary() = 0;
 
@@ -463,6 +463,14 @@ public:
     {
         MemoryInstance instance { type };
 
+        // OPTIMIZATION: Growing a memory may have to reallocate it and copy everything over. Memories that declare their
+        //               maximum size get all of it reserved up front, so that they always grow in place and their data
+        //               never moves. Allocations this large are backed by pages that are only committed once they're
+        //               touched, so this only costs address space until the memory actually grows.
+        //               If reserving fails, we'll simply grow the memory as needed.
+        if (auto max = type.limits().max(); max.has_value() && *max <= Constants::max_reserved_memory_size / Constants::page_size)
+            (void)instance.m_data.try_ensure_capacity(*max * Constants::page_size);
+
         if (!instance.grow(type.limits().min() * Constants::page_size, GrowType::No))
             return Error::from_string_literal("Failed to grow to requested size");
 
@@ -713,7 +721,7 @@ public:
     explicit AbstractMachine() = default;
 
     // Validate a module; permanently sets the module's validity status.
-    ErrorOr<void, ValidationError> validate(Module&);
+    static ErrorOr<void, ValidationError> validate(Module&);
     // Load and instantiate a module, and link it into this interpreter.
     InstantiationResult instantiate(Module const&, Vector<ExternValue>);
     Result invoke(FunctionAddress, Vector<Value>);
@@ -62,6 +62,52 @@ constexpr auto regname = [](auto regnum) -> ByteString {
     return ByteString::formatted("reg{}", to_underlying(regnum));
 };
 
+// Counts how often each pair of opcodes is executed back to back on this thread, and prints the most frequent pairs when
+// the thread exits. This is meant to find the sequences that are worth fusing into synthetic instructions.
+class OpcodePairProfile {
+public:
+    static OpcodePairProfile& the()
+    {
+        thread_local OpcodePairProfile s_the;
+        return s_the;
+    }
+
+    void record(OpCode opcode)
+    {
+        if (m_previous_opcode.has_value())
+            ++m_counts.ensure(*m_previous_opcode).ensure(opcode);
+        m_previous_opcode = opcode;
+    }
+
+    ~OpcodePairProfile()
+    {
+        if (m_counts.is_empty())
+            return;
+
+        struct Pair {
+            OpCode first;
+            OpCode second;
+            u64 count;
+        };
+        Vector<Pair> pairs;
+        for (auto const& [first, counts] : m_counts) {
+            for (auto const& [second, count] : counts)
+                pairs.append({ first, second, count });
+        }
+        quick_sort(pairs, [](auto const& a, auto const& b) { return a.count > b.count; });
+
+        warnln("Most frequently executed opcode pairs:");
+        for (size_t i = 0; i < min(pairs.size(), max_printed_pairs); ++i)
+            warnln("{:>12} {} -> {}", pairs[i].count, instruction_name(pairs[i].first), instruction_name(pairs[i].second));
+    }
+
+private:
+    static constexpr size_t max_printed_pairs = 50;
+
+    HashMap<OpCode, HashMap<OpCode, u64>> m_counts;
+    Optional<OpCode> m_previous_opcode;
+};
+
 template<typename T>
 struct ConvertToRaw {
     T operator()(T value)
@@ -124,11 +170,14 @@ struct ConvertToRaw<double> {
         }                                                                                     \
     } while (0)
 
-#define LOG_INSN                          \
-    do {                                  \
-        if constexpr (WASM_TRACE_DEBUG) { \
-            LOG_INSN_UNGUARDED;           \
-        }                                 \
+#define LOG_INSN                                                    \
+    do {                                                            \
+        if constexpr (WASM_TRACE_DEBUG) {                           \
+            LOG_INSN_UNGUARDED;                                     \
+        }                                                           \
+        if constexpr (WASM_OPCODE_PAIR_PROFILE_DEBUG) {             \
+            OpcodePairProfile::the().record(instruction->opcode()); \
+        }                                                           \
     } while (0)
 
 #define LOAD_ADDRESSES() auto addresses = addresses_ptr[short_ip.current_ip_value]
@@ -1397,6 +1446,46 @@ HANDLE_INSTRUCTION(synthetic_i32_andconstlocal)
     TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
+HANDLE_INSTRUCTION(synthetic_i32_orconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitOr {}(configuration.local(instruction->local_index()).to<i32>(), instruction->arguments().unsafe_get<i32>())), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i32_xorconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitXor {}(configuration.local(instruction->local_index()).to<i32>(), instruction->arguments().unsafe_get<i32>())), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i32_shlconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitShiftLeft {}(configuration.local(instruction->local_index()).to<u32>(), static_cast<u32>(instruction->arguments().unsafe_get<i32>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i32_shruconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitShiftRight {}(configuration.local(instruction->local_index()).to<u32>(), static_cast<u32>(instruction->arguments().unsafe_get<i32>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i32_shrsconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitShiftRight {}(configuration.local(instruction->local_index()).to<i32>(), static_cast<u32>(instruction->arguments().unsafe_get<i32>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
 HANDLE_INSTRUCTION(synthetic_i32_sub2local)
 {
     LOG_INSN;
@@ -1539,6 +1628,46 @@ HANDLE_INSTRUCTION(synthetic_i64_andconstlocal)
     TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
+HANDLE_INSTRUCTION(synthetic_i64_orconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitOr {}(configuration.local(instruction->local_index()).to<i64>(), instruction->arguments().unsafe_get<i64>())), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i64_xorconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitXor {}(configuration.local(instruction->local_index()).to<i64>(), instruction->arguments().unsafe_get<i64>())), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i64_shlconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitShiftLeft {}(configuration.local(instruction->local_index()).to<u64>(), static_cast<u64>(instruction->arguments().unsafe_get<i64>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i64_shruconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitShiftRight {}(configuration.local(instruction->local_index()).to<u64>(), static_cast<u64>(instruction->arguments().unsafe_get<i64>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(synthetic_i64_shrsconstlocal)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    configuration.push_to_destination<source_address_mix>(Value(Operators::BitShiftRight {}(configuration.local(instruction->local_index()).to<i64>(), static_cast<u64>(instruction->arguments().unsafe_get<i64>()))), addresses.destination);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
 HANDLE_INSTRUCTION(synthetic_i64_sub2local)
 {
     LOG_INSN;
@@ -1924,6 +2053,39 @@ HANDLE_INSTRUCTION(synthetic_br_if_nostack)
     TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
+HANDLE_INSTRUCTION(synthetic_br_if_i32_eqz_nostack)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    // i32.eqz; br_if -> branch if the value is zero.
+    auto value = configuration.take_source<source_address_mix>(0, addresses.sources).template to<i32>();
+    short_ip.current_ip_value = interpreter.branch_to_label<false>(configuration, instruction->arguments().unsafe_get<Instruction::BranchArgs>().label, short_ip.current_ip_value, value == 0).value();
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+#define HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(name, type, op)                                                                                 \
+    HANDLE_INSTRUCTION(synthetic_br_if_i32_##name##_nostack)                                                                                 \
+    {                                                                                                                                        \
+        LOG_INSN;                                                                                                                            \
+        LOAD_ADDRESSES();                                                                                                                    \
+        auto rhs = configuration.take_source<source_address_mix>(0, addresses.sources).template to<type>();                                  \
+        auto lhs = configuration.take_source<source_address_mix>(1, addresses.sources).template to<type>();                                  \
+        auto const& label = instruction->arguments().unsafe_get<Instruction::BranchArgs>().label;                                            \
+        short_ip.current_ip_value = interpreter.branch_to_label<false>(configuration, label, short_ip.current_ip_value, lhs op rhs).value(); \
+        TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));                                                               \
+    }
+
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(eq, i32, ==)
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(ne, i32, !=)
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(lts, i32, <)
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(ltu, u32, <)
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(gts, i32, >)
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(gtu, u32, >)
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(les, i32, <=)
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(leu, u32, <=)
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(ges, i32, >=)
+HANDLE_SPECIALIZED_BR_IF_I32_COMPARE(geu, u32, >=)
+
 HANDLE_INSTRUCTION(br_table)
 {
     LOG_INSN;
@@ -5607,6 +5769,20 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
         }
     };
 
+    // `local.get a; *.const b; op` -> `op_constlocal a b`.
+    // Replace the previous two ops with noops, and add op_constlocal.
+    auto const make_const_local_synthetic = [&](OpCode synthetic_op, auto const_value) {
+        set_default_dispatch(nop, result.dispatches.size() - 1);
+        set_default_dispatch(nop, result.dispatches.size() - 2);
+        result.extra_instruction_storage.unchecked_append(Instruction(
+            synthetic_op,
+            local_index_0,
+            const_value));
+
+        set_default_dispatch(result.extra_instruction_storage.unsafe_last());
+        pattern_state = InsnPatternState::Nothing;
+    };
+
     for (auto& instruction : expression.instructions()) {
         if (instruction.opcode() == Instructions::call) {
             auto& function = functions[instruction.arguments().get<FunctionIndex>().value()];
@@ -5863,6 +6039,23 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
                 pattern_state = InsnPatternState::I32ConstGetLocal;
                 break;
             }
+            // NB: Shifts are not commutative, so unlike the operations below, they can only be fused when the local
+            //     comes first.
+            if (instruction.opcode() == Instructions::i32_shl) {
+                // `local.get a; i32.const b; i32.shl` -> `i32.shl_constlocal a b`.
+                make_const_local_synthetic(Instructions::synthetic_i32_shlconstlocal, i32_const_value);
+                continue;
+            }
+            if (instruction.opcode() == Instructions::i32_shru) {
+                // `local.get a; i32.const b; i32.shr_u` -> `i32.shru_constlocal a b`.
+                make_const_local_synthetic(Instructions::synthetic_i32_shruconstlocal, i32_const_value);
+                continue;
+            }
+            if (instruction.opcode() == Instructions::i32_shrs) {
+                // `local.get a; i32.const b; i32.shr_s` -> `i32.shrs_constlocal a b`.
+                make_const_local_synthetic(Instructions::synthetic_i32_shrsconstlocal, i32_const_value);
+                continue;
+            }
             [[fallthrough]];
         case InsnPatternState::I32ConstGetLocal:
             if (instruction.opcode() == Instructions::i32_const) {
@@ -5897,6 +6090,14 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
                 set_default_dispatch(result.extra_instruction_storage.unsafe_last());
                 pattern_state = InsnPatternState::Nothing;
                 continue;
+            } else if (instruction.opcode() == Instructions::i32_or) {
+                // `i32.const a; local.get b; i32.or` -> `i32.or_constlocal b a`.
+                make_const_local_synthetic(Instructions::synthetic_i32_orconstlocal, i32_const_value);
+                continue;
+            } else if (instruction.opcode() == Instructions::i32_xor) {
+                // `i32.const a; local.get b; i32.xor` -> `i32.xor_constlocal b a`.
+                make_const_local_synthetic(Instructions::synthetic_i32_xorconstlocal, i32_const_value);
+                continue;
             } else {
                 pattern_state = InsnPatternState::Nothing;
             }
@@ -5943,6 +6144,23 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
                 pattern_state = InsnPatternState::I64ConstGetLocal;
                 break;
             }
+            // NB: Shifts are not commutative, so unlike the operations below, they can only be fused when the local
+            //     comes first.
+            if (instruction.opcode() == Instructions::i64_shl) {
+                // `local.get a; i64.const b; i64.shl` -> `i64.shl_constlocal a b`.
+                make_const_local_synthetic(Instructions::synthetic_i64_shlconstlocal, i64_const_value);
+                continue;
+            }
+            if (instruction.opcode() == Instructions::i64_shru) {
+                // `local.get a; i64.const b; i64.shr_u` -> `i64.shru_constlocal a b`.
+                make_const_local_synthetic(Instructions::synthetic_i64_shruconstlocal, i64_const_value);
+                continue;
+            }
+            if (instruction.opcode() == Instructions::i64_shrs) {
+                // `local.get a; i64.const b; i64.shr_s` -> `i64.shrs_constlocal a b`.
+                make_const_local_synthetic(Instructions::synthetic_i64_shrsconstlocal, i64_const_value);
+                continue;
+            }
             [[fallthrough]];
         case InsnPatternState::I64ConstGetLocal:
             if (instruction.opcode() == Instructions::i64_const) {
@@ -5977,6 +6195,14 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
                 set_default_dispatch(result.extra_instruction_storage.unsafe_last());
                 pattern_state = InsnPatternState::Nothing;
                 continue;
+            } else if (instruction.opcode() == Instructions::i64_or) {
+                // `i64.const a; local.get b; i64.or` -> `i64.or_constlocal b a`.
+                make_const_local_synthetic(Instructions::synthetic_i64_orconstlocal, i64_const_value);
+                continue;
+            } else if (instruction.opcode() == Instructions::i64_xor) {
+                // `i64.const a; local.get b; i64.xor` -> `i64.xor_constlocal b a`.
+                make_const_local_synthetic(Instructions::synthetic_i64_xorconstlocal, i64_const_value);
+                continue;
             } else {
                 pattern_state = InsnPatternState::Nothing;
             }
@@ -5985,6 +6211,57 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
         set_default_dispatch(instruction);
     }
 
+    // `i32.<compare>; br_if l` -> `br.if.i32.<compare>.nostack l`, if the branch does not need to adjust the stack.
+    // NB: Only blocks, loops and their ends can be branch targets, so nothing can jump in between the two instructions.
+    for (size_t i = 1; i < result.dispatches.size(); ++i) {
+        auto const& branch = *result.dispatches[i].instruction;
+        if (branch.opcode() != Instructions::br_if || branch.arguments().get<Instruction::BranchArgs>().has_stack_adjustment)
+            continue;
+
+        Optional<OpCode> fused_opcode;
+        switch (result.dispatches[i - 1].instruction->opcode().value()) {
+        case Instructions::i32_eqz.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_eqz_nostack;
+            break;
+        case Instructions::i32_eq.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_eq_nostack;
+            break;
+        case Instructions::i32_ne.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_ne_nostack;
+            break;
+        case Instructions::i32_lts.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_lts_nostack;
+            break;
+        case Instructions::i32_ltu.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_ltu_nostack;
+            break;
+        case Instructions::i32_gts.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_gts_nostack;
+            break;
+        case Instructions::i32_gtu.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_gtu_nostack;
+            break;
+        case Instructions::i32_les.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_les_nostack;
+            break;
+        case Instructions::i32_leu.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_leu_nostack;
+            break;
+        case Instructions::i32_ges.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_ges_nostack;
+            break;
+        case Instructions::i32_geu.value():
+            fused_opcode = Instructions::synthetic_br_if_i32_geu_nostack;
+            break;
+        default:
+            continue;
+        }
+
+        set_default_dispatch(nop, i - 1);
+        result.extra_instruction_storage.unchecked_append(Instruction(*fused_opcode, branch.arguments()));
+        set_default_dispatch(result.extra_instruction_storage.unsafe_last(), i);
+    }
+
     // Remove all nops (that were either added by the above patterns or were already present in the original instructions),
     // and adjust jumps accordingly.
     RedBlackTree<size_t, Empty> nops_to_remove;
@@ -696,15 +696,30 @@ struct VectorIntegerBinaryOp {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
-        Op op;
 
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(first[i], second[i]);
-        }
+        // OPTIMIZATION: Operations that are the same on every lane map directly onto native vector instructions.
+        //               Arithmetic is done on unsigned lanes, so that it wraps around on overflow as required.
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply, BitAnd, BitOr, BitXor>) {
+            using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+            return bit_cast<u128>(Op {}(bit_cast<UnsignedVectorType>(lhs), bit_cast<UnsignedVectorType>(rhs)));
+        } else if constexpr (IsOneOf<Op, Minimum, Maximum>) {
+            VectorType first_is_selected;
+            if constexpr (IsSame<Op, Minimum>)
+                first_is_selected = bit_cast<VectorType>(first < second);
+            else
+                first_is_selected = bit_cast<VectorType>(first > second);
+            return bit_cast<u128>((first & first_is_selected) | (second & ~first_is_selected));
+        } else {
+            VectorType result;
+            Op op;
 
-        return bit_cast<u128>(result);
+            // FIXME: Find a way to not loop here
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(first[i], second[i]);
+            }
+
+            return bit_cast<u128>(result);
+        }
     }
 
     static StringView name()
@@ -893,12 +908,21 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(first[i], second[i]);
+
+        // OPTIMIZATION: These are the same IEEE 754 operations on every lane, which map directly onto native vector
+        //               instructions.
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>) {
+            return bit_cast<u128>(Op {}(first, second));
+        } else if constexpr (IsSame<Op, Divide>) {
+            return bit_cast<u128>(first / second);
+        } else {
+            VectorType result;
+            Op op;
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(first[i], second[i]);
+            }
+            return bit_cast<u128>(result);
         }
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
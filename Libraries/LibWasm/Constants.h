@@ -62,6 +62,7 @@ static constexpr auto minimum_stack_space_to_keep_free = 256 * KiB; // Note: Val
 static constexpr auto max_allowed_executed_instructions_per_call = 256 * 1024 * 1024;
 static constexpr auto max_allowed_vector_size = 500 * MiB;
 static constexpr auto max_allowed_table_size = 1024 * 1024;
+static constexpr auto max_reserved_memory_size = 1 * GiB; // Note: Only address space, pages are committed as the memory grows.
 static constexpr auto max_allowed_function_locals_per_type = 42069; // Note: VERY arbitrary.
 
 // Messages used by the host
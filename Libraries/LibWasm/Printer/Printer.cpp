@@ -1367,5 +1367,26 @@ HashMap<Wasm::OpCode, ByteString> Wasm::Names::instruction_names {
     { Instructions::synthetic_i64_shru2local, "synthetic:i64.shru2local" },
     { Instructions::synthetic_i64_shrs2local, "synthetic:i64.shrs2local" },
     { Instructions::synthetic_local_seti64_const, "synthetic:local.seti64_const" },
+    { Instructions::synthetic_i32_orconstlocal, "synthetic:i32.or_const_local" },
+    { Instructions::synthetic_i32_xorconstlocal, "synthetic:i32.xor_const_local" },
+    { Instructions::synthetic_i32_shlconstlocal, "synthetic:i32.shl_const_local" },
+    { Instructions::synthetic_i32_shruconstlocal, "synthetic:i32.shru_const_local" },
+    { Instructions::synthetic_i32_shrsconstlocal, "synthetic:i32.shrs_const_local" },
+    { Instructions::synthetic_i64_orconstlocal, "synthetic:i64.orconstlocal" },
+    { Instructions::synthetic_i64_xorconstlocal, "synthetic:i64.xorconstlocal" },
+    { Instructions::synthetic_i64_shlconstlocal, "synthetic:i64.shlconstlocal" },
+    { Instructions::synthetic_i64_shruconstlocal, "synthetic:i64.shruconstlocal" },
+    { Instructions::synthetic_i64_shrsconstlocal, "synthetic:i64.shrsconstlocal" },
+    { Instructions::synthetic_br_if_i32_eqz_nostack, "synthetic:br.if.i32.eqz.nostack" },
+    { Instructions::synthetic_br_if_i32_eq_nostack, "synthetic:br.if.i32.eq.nostack" },
+    { Instructions::synthetic_br_if_i32_ne_nostack, "synthetic:br.if.i32.ne.nostack" },
+    { Instructions::synthetic_br_if_i32_lts_nostack, "synthetic:br.if.i32.lts.nostack" },
+    { Instructions::synthetic_br_if_i32_ltu_nostack, "synthetic:br.if.i32.ltu.nostack" },
+    { Instructions::synthetic_br_if_i32_gts_nostack, "synthetic:br.if.i32.gts.nostack" },
+    { Instructions::synthetic_br_if_i32_gtu_nostack, "synthetic:br.if.i32.gtu.nostack" },
+    { Instructions::synthetic_br_if_i32_les_nostack, "synthetic:br.if.i32.les.nostack" },
+    { Instructions::synthetic_br_if_i32_leu_nostack, "synthetic:br.if.i32.leu.nostack" },
+    { Instructions::synthetic_br_if_i32_ges_nostack, "synthetic:br.if.i32.ges.nostack" },
+    { Instructions::synthetic_br_if_i32_geu_nostack, "synthetic:br.if.i32.geu.nostack" },
 };
 HashMap<ByteString, Wasm::OpCode> Wasm::Names::instructions_by_name;
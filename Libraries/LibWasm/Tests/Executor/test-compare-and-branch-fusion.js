@@ -0,0 +1,71 @@
+// `i32.<compare>; br_if` fusion must keep the operand order and the signedness of the comparison
+
+const bin = readBinaryWasmFile("Fixtures/Modules/compare-and-branch-fusion.wasm");
+const module = parseWebAssemblyModule(bin);
+
+test("i32.eqz; br_if", () => {
+    const fn = module.getExport("br_if_eqz");
+    expect(module.invoke(fn, 0)).toBe(1);
+    expect(module.invoke(fn, 1)).toBe(0);
+    expect(module.invoke(fn, -1)).toBe(0);
+});
+
+test("i32.eq; br_if and i32.ne; br_if", () => {
+    const eq = module.getExport("br_if_eq");
+    const ne = module.getExport("br_if_ne");
+    expect(module.invoke(eq, 5, 5)).toBe(1);
+    expect(module.invoke(eq, 5, 6)).toBe(0);
+    expect(module.invoke(ne, 5, 5)).toBe(0);
+    expect(module.invoke(ne, 5, 6)).toBe(1);
+});
+
+test("signed comparisons; br_if", () => {
+    const lt = module.getExport("br_if_lt_s");
+    const gt = module.getExport("br_if_gt_s");
+    const le = module.getExport("br_if_le_s");
+    const ge = module.getExport("br_if_ge_s");
+    expect(module.invoke(lt, -1, 1)).toBe(1);
+    expect(module.invoke(lt, 1, -1)).toBe(0);
+    expect(module.invoke(lt, 5, 5)).toBe(0);
+    expect(module.invoke(gt, -1, 1)).toBe(0);
+    expect(module.invoke(gt, 1, -1)).toBe(1);
+    expect(module.invoke(gt, 5, 5)).toBe(0);
+    expect(module.invoke(le, -1, 1)).toBe(1);
+    expect(module.invoke(le, 1, -1)).toBe(0);
+    expect(module.invoke(le, 5, 5)).toBe(1);
+    expect(module.invoke(ge, -1, 1)).toBe(0);
+    expect(module.invoke(ge, 1, -1)).toBe(1);
+    expect(module.invoke(ge, 5, 5)).toBe(1);
+});
+
+test("unsigned comparisons; br_if", () => {
+    const lt = module.getExport("br_if_lt_u");
+    const gt = module.getExport("br_if_gt_u");
+    const le = module.getExport("br_if_le_u");
+    const ge = module.getExport("br_if_ge_u");
+    // -1 is the largest unsigned value.
+    expect(module.invoke(lt, -1, 1)).toBe(0);
+    expect(module.invoke(lt, 1, -1)).toBe(1);
+    expect(module.invoke(lt, 5, 5)).toBe(0);
+    expect(module.invoke(gt, -1, 1)).toBe(1);
+    expect(module.invoke(gt, 1, -1)).toBe(0);
+    expect(module.invoke(gt, 5, 5)).toBe(0);
+    expect(module.invoke(le, -1, 1)).toBe(0);
+    expect(module.invoke(le, 1, -1)).toBe(1);
+    expect(module.invoke(le, 5, 5)).toBe(1);
+    expect(module.invoke(ge, -1, 1)).toBe(1);
+    expect(module.invoke(ge, 1, -1)).toBe(0);
+    expect(module.invoke(ge, 5, 5)).toBe(1);
+});
+
+test("loop back edge", () => {
+    const fn = module.getExport("count_up_to");
+    expect(module.invoke(fn, 10)).toBe(10);
+    expect(module.invoke(fn, 0)).toBe(1);
+});
+
+test("i32.eqz; br_if with a value on the stack", () => {
+    const fn = module.getExport("br_if_eqz_with_value");
+    expect(module.invoke(fn, 0)).toBe(7);
+    expect(module.invoke(fn, 1)).toBe(9);
+});
@@ -0,0 +1,73 @@
+// `local.get; *.const; op` and `*.const; local.get; op` fusion must keep the operand order
+
+const bin = readBinaryWasmFile("Fixtures/Modules/const-local-fusion.wasm");
+const module = parseWebAssemblyModule(bin);
+
+test("local.get; i32.const; i32.shl", () => {
+    const fn = module.getExport("i32_local_const_shl");
+    expect(module.invoke(fn, 0x12345678)).toBe(0x23456780);
+    expect(module.invoke(fn, 1)).toBe(16);
+});
+
+test("local.get; i32.const; i32.shr_u", () => {
+    const fn = module.getExport("i32_local_const_shr_u");
+    expect(module.invoke(fn, -1)).toBe(15);
+    expect(module.invoke(fn, 0x10000000)).toBe(1);
+});
+
+test("local.get; i32.const; i32.shr_s", () => {
+    const fn = module.getExport("i32_local_const_shr_s");
+    expect(module.invoke(fn, -0x10000000)).toBe(-1);
+    expect(module.invoke(fn, 0x70000000)).toBe(7);
+});
+
+test("i32.const; local.get; i32.shr_u uses the constant as the value to shift", () => {
+    const fn = module.getExport("i32_const_local_shr_u");
+    // 28 >>> 2 = 7
+    expect(module.invoke(fn, 2)).toBe(7);
+    // 28 >>> 0 = 28
+    expect(module.invoke(fn, 0)).toBe(28);
+});
+
+test("i32.const; local.get; i32.or", () => {
+    const fn = module.getExport("i32_const_local_or");
+    expect(module.invoke(fn, 0x0f)).toBe(0xff);
+});
+
+test("local.get; i32.const; i32.xor", () => {
+    const fn = module.getExport("i32_local_const_xor");
+    expect(module.invoke(fn, 0x0f)).toBe(0xf0);
+});
+
+test("local.get; local.get; i32.const; i32.shl uses the second local", () => {
+    const fn = module.getExport("i32_local_local_const_shl_add");
+    // 1 + (2 << 3) = 17
+    expect(module.invoke(fn, 1, 2)).toBe(17);
+    // 2 + (1 << 3) = 10
+    expect(module.invoke(fn, 2, 1)).toBe(10);
+});
+
+test("local.get; i64.const; i64.shl", () => {
+    const fn = module.getExport("i64_local_const_shl");
+    expect(module.invoke(fn, 3n)).toBe(3298534883328n);
+});
+
+test("local.get; i64.const; i64.shr_u", () => {
+    const fn = module.getExport("i64_local_const_shr_u");
+    expect(module.invoke(fn, -1n)).toBe(15n);
+});
+
+test("local.get; i64.const; i64.shr_s", () => {
+    const fn = module.getExport("i64_local_const_shr_s");
+    expect(module.invoke(fn, -0x1000000000000000n)).toBe(-1n);
+});
+
+test("i64.const; local.get; i64.xor", () => {
+    const fn = module.getExport("i64_const_local_xor");
+    expect(module.invoke(fn, 0x0fn)).toBe(0xf0n);
+});
+
+test("local.get; i64.const; i64.or", () => {
+    const fn = module.getExport("i64_local_const_or");
+    expect(module.invoke(fn, 0x0fn)).toBe(0xffn);
+});
@@ -0,0 +1,174 @@
+(module
+  ;; local.get 0; i32.eqz; br_if 0
+  ;; Expected: 1 if the branch is taken, 0 otherwise
+  (func (export "br_if_eqz") (param i32) (result i32)
+    block
+      local.get 0
+      i32.eqz
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.eq; br_if 0
+  (func (export "br_if_eq") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.eq
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.ne; br_if 0
+  (func (export "br_if_ne") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.ne
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.lt_s; br_if 0
+  (func (export "br_if_lt_s") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.lt_s
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.lt_u; br_if 0
+  (func (export "br_if_lt_u") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.lt_u
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.gt_s; br_if 0
+  (func (export "br_if_gt_s") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.gt_s
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.gt_u; br_if 0
+  (func (export "br_if_gt_u") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.gt_u
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.le_s; br_if 0
+  (func (export "br_if_le_s") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.le_s
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.le_u; br_if 0
+  (func (export "br_if_le_u") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.le_u
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.ge_s; br_if 0
+  (func (export "br_if_ge_s") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.ge_s
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; local.get 0; local.get 1; i32.ge_u; br_if 0
+  (func (export "br_if_ge_u") (param i32 i32) (result i32)
+    block
+      local.get 0
+      local.get 1
+      i32.ge_u
+      br_if 0
+      i32.const 0
+      return
+    end
+    i32.const 1
+  )
+
+  ;; A loop whose back edge is `local.get; local.get; i32.lt_u; br_if 0`
+  ;; Expected: max(param0, 1) for non-negative param0
+  (func (export "count_up_to") (param i32) (result i32)
+    (local i32)
+    loop
+      local.get 1
+      i32.const 1
+      i32.add
+      local.set 1
+      local.get 1
+      local.get 0
+      i32.lt_u
+      br_if 0
+    end
+    local.get 1
+  )
+
+  ;; A branch that carries a value has to adjust the stack, so it must not be fused
+  ;; Expected: 7 if param0 is zero, 9 otherwise
+  (func (export "br_if_eqz_with_value") (param i32) (result i32)
+    block (result i32)
+      i32.const 7
+      local.get 0
+      i32.eqz
+      br_if 0
+      drop
+      i32.const 9
+    end
+  )
+)
@@ -0,0 +1,99 @@
+(module
+  ;; local.get 0; i32.const 4; i32.shl
+  ;; Expected: param0 << 4
+  (func (export "i32_local_const_shl") (param i32) (result i32)
+    local.get 0
+    i32.const 4
+    i32.shl
+  )
+
+  ;; local.get 0; i32.const 28; i32.shr_u
+  ;; Expected: param0 >>> 28  (shifts are non-commutative, tests operand order)
+  (func (export "i32_local_const_shr_u") (param i32) (result i32)
+    local.get 0
+    i32.const 28
+    i32.shr_u
+  )
+
+  ;; local.get 0; i32.const 28; i32.shr_s
+  ;; Expected: param0 >> 28
+  (func (export "i32_local_const_shr_s") (param i32) (result i32)
+    local.get 0
+    i32.const 28
+    i32.shr_s
+  )
+
+  ;; i32.const 28; local.get 0; i32.shr_u
+  ;; Expected: 28 >>> param0  (must not be fused with the operands swapped)
+  (func (export "i32_const_local_shr_u") (param i32) (result i32)
+    i32.const 28
+    local.get 0
+    i32.shr_u
+  )
+
+  ;; i32.const X; local.get 0; i32.or
+  ;; Expected: X | param0
+  (func (export "i32_const_local_or") (param i32) (result i32)
+    i32.const 0xF0
+    local.get 0
+    i32.or
+  )
+
+  ;; local.get 0; i32.const X; i32.xor
+  ;; Expected: param0 ^ X
+  (func (export "i32_local_const_xor") (param i32) (result i32)
+    local.get 0
+    i32.const 0xFF
+    i32.xor
+  )
+
+  ;; local.get 0; local.get 1; i32.const 3; i32.shl; i32.add
+  ;; Expected: param0 + (param1 << 3)
+  (func (export "i32_local_local_const_shl_add") (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.const 3
+    i32.shl
+    i32.add
+  )
+
+  ;; local.get 0; i64.const 40; i64.shl
+  ;; Expected: param0 << 40
+  (func (export "i64_local_const_shl") (param i64) (result i64)
+    local.get 0
+    i64.const 40
+    i64.shl
+  )
+
+  ;; local.get 0; i64.const 60; i64.shr_u
+  ;; Expected: param0 >>> 60
+  (func (export "i64_local_const_shr_u") (param i64) (result i64)
+    local.get 0
+    i64.const 60
+    i64.shr_u
+  )
+
+  ;; local.get 0; i64.const 60; i64.shr_s
+  ;; Expected: param0 >> 60
+  (func (export "i64_local_const_shr_s") (param i64) (result i64)
+    local.get 0
+    i64.const 60
+    i64.shr_s
+  )
+
+  ;; i64.const X; local.get 0; i64.xor
+  ;; Expected: X ^ param0
+  (func (export "i64_const_local_xor") (param i64) (result i64)
+    i64.const 0xFF
+    local.get 0
+    i64.xor
+  )
+
+  ;; local.get 0; i64.const X; i64.or
+  ;; Expected: param0 | X
+  (func (export "i64_local_const_or") (param i64) (result i64)
+    local.get 0
+    i64.const 0xF0
+    i64.or
+  )
+)
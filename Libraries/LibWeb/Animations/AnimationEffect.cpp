@@ -786,7 +786,7 @@ void AnimationEffect::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_associated_animation);
 }
 
-static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_for_animated_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& new_properties)
+static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_for_animated_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& new_properties, Vector<CSS::PropertyID>& changed_properties)
 {
     CSS::RequiredInvalidationAfterStyleChange invalidation;
     auto old_and_new_properties = MUST(Bitmap::create(CSS::number_of_longhand_properties, 0));
@@ -802,6 +802,8 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_f
         auto const* new_value = new_properties.get(property_id).value_or({});
         if (!old_value && !new_value)
             continue;
+        if (!old_value || !new_value || !old_value->equals(*new_value))
+            changed_properties.append(property_id);
         invalidation |= compute_property_invalidation(property_id, old_value, new_value);
     }
     return invalidation;
@@ -815,13 +817,36 @@ AnimationUpdateContext::~AnimationUpdateContext()
             continue;
         auto& element = it.key;
         GC::Ref<DOM::Element> target = element.element();
-        auto invalidation = compute_required_invalidation_for_animated_properties(it.value->animated_properties_before_update, style->animated_property_values());
+        Vector<CSS::PropertyID> changed_properties;
+        auto invalidation = compute_required_invalidation_for_animated_properties(it.value->animated_properties_before_update, style->animated_property_values(), changed_properties);
 
         if (invalidation.is_none())
             continue;
 
+        // OPTIMIZATION: If none of the changed properties are inherited by default (as is the case for transform and
+        //               opacity animations), only descendants that explicitly inherit one of them can be affected.
+        bool any_changed_property_is_inherited_by_default = false;
+        for (auto property_id : changed_properties) {
+            if (CSS::is_inherited_property(property_id)) {
+                any_changed_property_is_inherited_by_default = true;
+                break;
+            }
+        }
+        auto explicitly_inherits_any_changed_property = [&](DOM::Element const& element) {
+            auto computed_properties = element.computed_properties();
+            if (!computed_properties)
+                return false;
+            for (auto property_id : changed_properties) {
+                if (computed_properties->is_property_inherited(property_id))
+                    return true;
+            }
+            return false;
+        };
+
         // Traversal of the subtree is necessary to update the animated properties inherited from the target element.
         target->for_each_in_subtree_of_type<DOM::Element>([&](auto& element) {
+            if (!any_changed_property_is_inherited_by_default && !explicitly_inherits_any_changed_property(element))
+                return TraversalDecision::SkipChildrenAndContinue;
             auto element_invalidation = element.recompute_inherited_style();
             if (element_invalidation.is_none())
                 return TraversalDecision::SkipChildrenAndContinue;
@@ -9,6 +9,7 @@
  */
 
 #include <LibGC/DeferGC.h>
+#include <LibJS/CompiledScriptCache.h>
 #include <LibJS/Module.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/Environment.h>
@@ -45,6 +46,7 @@
 #include <LibWeb/HTML/Scripting/WorkerAgent.h>
 #include <LibWeb/HTML/ShadowRealmGlobalScope.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
 #include <LibWeb/HTML/WindowProxy.h>
 #include <LibWeb/HTML/WorkletGlobalScope.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -92,6 +94,8 @@ static NonnullOwnPtr<JS::Agent> create_agent(GC::Heap& heap, AgentType type)
     VERIFY_NOT_REACHED();
 }
 
+static constexpr size_t compiled_script_cache_capacity_in_code_units = 16 * MiB;
+
 void initialize_main_thread_vm(AgentType type)
 {
     VERIFY(!s_main_thread_vm);
@@ -99,6 +103,10 @@ void initialize_main_thread_vm(AgentType type)
     s_main_thread_vm = JS::VM::create();
     s_main_thread_vm->set_agent(create_agent(s_main_thread_vm->heap(), type));
 
+    // Keep the bytecode of recently run classic scripts around, so that loading the same scripts again
+    // (e.g. after navigating between pages of the same site) doesn't have to parse and compile them again.
+    s_main_thread_vm->compiled_script_cache().set_capacity_in_code_units(compiled_script_cache_capacity_in_code_units);
+
     s_main_thread_vm->on_unimplemented_property_access = [](auto const& object, auto const& property_key) {
         dbgln("FIXME: Unimplemented IDL interface: '{}.{}'", object.class_name(), property_key.to_string());
     };
@@ -336,6 +344,30 @@ void initialize_main_thread_vm(AgentType type)
         return HTML::main_thread_event_loop().microtask_queue_empty();
     };
 
+    // 8.1.6.6 HostEnqueueTimeoutJob(timeoutJob, realm, milliseconds), https://html.spec.whatwg.org/multipage/webappapis.html#hostenqueuetimeoutjob
+    s_main_thread_vm->host_enqueue_timeout_job = [](GC::Ref<GC::Function<void()>> timeout_job, JS::Realm& realm, double milliseconds) {
+        // 1. Let global be realm's global object.
+        auto& global = realm.global_object();
+
+        // 2. Let timeoutStep be an algorithm step which queues a global task on the JavaScript engine task source given global to perform timeoutJob().
+        auto timeout_step = [&global, &realm, timeout_job] {
+            HTML::queue_global_task(HTML::Task::Source::JavaScriptEngine, global, GC::create_function(s_main_thread_vm->heap(), [&realm, timeout_job] {
+                // NB: The job resolves a promise, which needs an execution context to call the resolving function in.
+                HTML::prepare_to_run_script(realm);
+                timeout_job->function()();
+                HTML::clean_up_after_running_script(realm);
+            }));
+        };
+
+        // 3. Run steps after a timeout given global, "JavaScript", milliseconds, and timeoutStep.
+        // FIXME: Support timeouts in global scopes that don't have timers of their own (e.g. shadow realms and worklets).
+        auto* window_or_worker = as_if<HTML::WindowOrWorkerGlobalScopeMixin>(global);
+        if (!window_or_worker)
+            return;
+        auto timeout = milliseconds >= NumericLimits<i32>::max() ? NumericLimits<i32>::max() : static_cast<i32>(ceil(milliseconds));
+        window_or_worker->run_steps_after_a_timeout(timeout, move(timeout_step));
+    };
+
     // 8.1.5.4.4 HostMakeJobCallback(callable), https://html.spec.whatwg.org/multipage/webappapis.html#hostmakejobcallback
     // https://whatpr.org/html/9893/webappapis.html#hostmakejobcallback
     s_main_thread_vm->host_make_job_callback = [](JS::FunctionObject& callable) -> GC::Ref<JS::JobCallback> {
@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <AK/CopyOnWrite.h>
 #include <AK/FlyString.h>
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
+#include <AK/RefCounted.h>
 #include <LibGfx/FontCascadeList.h>
 #include <LibGfx/ScalingMode.h>
 #include <LibWeb/CSS/CalculatedOr.h>
@@ -515,56 +517,56 @@ public:
 
     AspectRatio aspect_ratio() const { return m_noninherited.aspect_ratio; }
     Float float_() const { return m_noninherited.float_; }
-    Length border_spacing_horizontal() const { return m_inherited.border_spacing_horizontal; }
-    Length border_spacing_vertical() const { return m_inherited.border_spacing_vertical; }
-    CaptionSide caption_side() const { return m_inherited.caption_side; }
-    Color caret_color() const { return m_inherited.caret_color; }
+    Length border_spacing_horizontal() const { return m_inherited->border_spacing_horizontal; }
+    Length border_spacing_vertical() const { return m_inherited->border_spacing_vertical; }
+    CaptionSide caption_side() const { return m_inherited->caption_side; }
+    Color caret_color() const { return m_inherited->caret_color; }
     Clear clear() const { return m_noninherited.clear; }
     Clip clip() const { return m_noninherited.clip; }
-    ColorInterpolation color_interpolation() const { return m_inherited.color_interpolation; }
-    PreferredColorScheme color_scheme() const { return m_inherited.color_scheme; }
-    ContentVisibility content_visibility() const { return m_inherited.content_visibility; }
-    Vector<CursorData> const& cursor() const { return m_inherited.cursor; }
+    ColorInterpolation color_interpolation() const { return m_inherited->color_interpolation; }
+    PreferredColorScheme color_scheme() const { return m_inherited->color_scheme; }
+    ContentVisibility content_visibility() const { return m_inherited->content_visibility; }
+    Vector<CursorData> const& cursor() const { return m_inherited->cursor; }
     ContentData const& content() const { return m_noninherited.content; }
-    PointerEvents pointer_events() const { return m_inherited.pointer_events; }
+    PointerEvents pointer_events() const { return m_inherited->pointer_events; }
     Display display() const { return m_noninherited.display; }
     Display display_before_box_type_transformation() const { return m_noninherited.display_before_box_type_transformation; }
     Optional<int> const& z_index() const { return m_noninherited.z_index; }
-    Variant<Length, double> tab_size() const { return m_inherited.tab_size; }
-    TextAlign text_align() const { return m_inherited.text_align; }
-    TextJustify text_justify() const { return m_inherited.text_justify; }
-    TextIndentData const& text_indent() const { return m_inherited.text_indent; }
-    TextWrapMode text_wrap_mode() const { return m_inherited.text_wrap_mode; }
-    CSSPixels text_underline_offset() const { return m_inherited.text_underline_offset; }
-    TextUnderlinePosition text_underline_position() const { return m_inherited.text_underline_position; }
+    Variant<Length, double> tab_size() const { return m_inherited->tab_size; }
+    TextAlign text_align() const { return m_inherited->text_align; }
+    TextJustify text_justify() const { return m_inherited->text_justify; }
+    TextIndentData const& text_indent() const { return m_inherited->text_indent; }
+    TextWrapMode text_wrap_mode() const { return m_inherited->text_wrap_mode; }
+    CSSPixels text_underline_offset() const { return m_inherited->text_underline_offset; }
+    TextUnderlinePosition text_underline_position() const { return m_inherited->text_underline_position; }
     Vector<TextDecorationLine> const& text_decoration_line() const { return m_noninherited.text_decoration_line; }
     TextDecorationThickness const& text_decoration_thickness() const { return m_noninherited.text_decoration_thickness; }
-    TextDecorationSkipInk text_decoration_skip_ink() const { return m_inherited.text_decoration_skip_ink; }
+    TextDecorationSkipInk text_decoration_skip_ink() const { return m_inherited->text_decoration_skip_ink; }
     TextDecorationStyle text_decoration_style() const { return m_noninherited.text_decoration_style; }
     Color text_decoration_color() const { return m_noninherited.text_decoration_color; }
-    TextTransform text_transform() const { return m_inherited.text_transform; }
+    TextTransform text_transform() const { return m_inherited->text_transform; }
     TextOverflow text_overflow() const { return m_noninherited.text_overflow; }
-    Vector<ShadowData> const& text_shadow() const { return m_inherited.text_shadow; }
+    Vector<ShadowData> const& text_shadow() const { return m_inherited->text_shadow; }
     Positioning position() const { return m_noninherited.position; }
-    WhiteSpaceCollapse white_space_collapse() const { return m_inherited.white_space_collapse; }
+    WhiteSpaceCollapse white_space_collapse() const { return m_inherited->white_space_collapse; }
     WhiteSpaceTrimData white_space_trim() const { return m_noninherited.white_space_trim; }
-    WordBreak word_break() const { return m_inherited.word_break; }
-    CSSPixels const& word_spacing() const { return m_inherited.word_spacing; }
-    CSSPixels letter_spacing() const { return m_inherited.letter_spacing; }
+    WordBreak word_break() const { return m_inherited->word_break; }
+    CSSPixels const& word_spacing() const { return m_inherited->word_spacing; }
+    CSSPixels letter_spacing() const { return m_inherited->letter_spacing; }
     FlexDirection flex_direction() const { return m_noninherited.flex_direction; }
     FlexWrap flex_wrap() const { return m_noninherited.flex_wrap; }
     FlexBasis const& flex_basis() const { return m_noninherited.flex_basis; }
     float flex_grow() const { return m_noninherited.flex_grow; }
     float flex_shrink() const { return m_noninherited.flex_shrink; }
     int order() const { return m_noninherited.order; }
-    Optional<Color> accent_color() const { return m_inherited.accent_color; }
+    Optional<Color> accent_color() const { return m_inherited->accent_color; }
     AlignContent align_content() const { return m_noninherited.align_content; }
     AlignItems align_items() const { return m_noninherited.align_items; }
     AlignSelf align_self() const { return m_noninherited.align_self; }
     Appearance appearance() const { return m_noninherited.appearance; }
     float opacity() const { return m_noninherited.opacity; }
-    Visibility visibility() const { return m_inherited.visibility; }
-    ImageRendering image_rendering() const { return m_inherited.image_rendering; }
+    Visibility visibility() const { return m_inherited->visibility; }
+    ImageRendering image_rendering() const { return m_inherited->image_rendering; }
     JustifyContent justify_content() const { return m_noninherited.justify_content; }
     JustifySelf justify_self() const { return m_noninherited.justify_self; }
     JustifyItems justify_items() const { return m_noninherited.justify_items; }
@@ -594,15 +596,15 @@ public:
     Size const& column_width() const { return m_noninherited.column_width; }
     Size const& column_height() const { return m_noninherited.column_height; }
     Variant<LengthPercentage, NormalGap> const& row_gap() const { return m_noninherited.row_gap; }
-    BorderCollapse border_collapse() const { return m_inherited.border_collapse; }
-    EmptyCells empty_cells() const { return m_inherited.empty_cells; }
+    BorderCollapse border_collapse() const { return m_inherited->border_collapse; }
+    EmptyCells empty_cells() const { return m_inherited->empty_cells; }
     GridTemplateAreas const& grid_template_areas() const { return m_noninherited.grid_template_areas; }
     ObjectFit object_fit() const { return m_noninherited.object_fit; }
     Position object_position() const { return m_noninherited.object_position; }
-    Direction direction() const { return m_inherited.direction; }
-    Optional<BaselineMetric> dominant_baseline() const { return m_inherited.dominant_baseline; }
+    Direction direction() const { return m_inherited->direction; }
+    Optional<BaselineMetric> dominant_baseline() const { return m_inherited->dominant_baseline; }
     UnicodeBidi unicode_bidi() const { return m_noninherited.unicode_bidi; }
-    WritingMode writing_mode() const { return m_inherited.writing_mode; }
+    WritingMode writing_mode() const { return m_inherited->writing_mode; }
     UserSelect user_select() const { return m_noninherited.user_select; }
     Isolation isolation() const { return m_noninherited.isolation; }
     Containment const& contain() const { return m_noninherited.contain; }
@@ -631,38 +633,38 @@ public:
     Overflow overflow_x() const { return m_noninherited.overflow_x; }
     Overflow overflow_y() const { return m_noninherited.overflow_y; }
 
-    Color color() const { return m_inherited.color; }
+    Color color() const { return m_inherited->color; }
     Color background_color() const { return m_noninherited.background_color; }
     BackgroundBox background_color_clip() const { return m_noninherited.background_color_clip; }
     Vector<BackgroundLayerData> const& background_layers() const { return m_noninherited.background_layers; }
 
-    Color webkit_text_fill_color() const { return m_inherited.webkit_text_fill_color; }
-
-    ListStyleType const& list_style_type() const { return m_inherited.list_style_type; }
-    ListStylePosition list_style_position() const { return m_inherited.list_style_position; }
-
-    Optional<SVGPaint> const& fill() const { return m_inherited.fill; }
-    FillRule fill_rule() const { return m_inherited.fill_rule; }
-    Optional<SVGPaint> const& stroke() const { return m_inherited.stroke; }
-    float fill_opacity() const { return m_inherited.fill_opacity; }
-    Vector<Variant<LengthPercentage, float>> const& stroke_dasharray() const { return m_inherited.stroke_dasharray; }
-    LengthPercentage const& stroke_dashoffset() const { return m_inherited.stroke_dashoffset; }
-    StrokeLinecap stroke_linecap() const { return m_inherited.stroke_linecap; }
-    StrokeLinejoin stroke_linejoin() const { return m_inherited.stroke_linejoin; }
-    double stroke_miterlimit() const { return m_inherited.stroke_miterlimit; }
-    float stroke_opacity() const { return m_inherited.stroke_opacity; }
-    LengthPercentage const& stroke_width() const { return m_inherited.stroke_width; }
+    Color webkit_text_fill_color() const { return m_inherited->webkit_text_fill_color; }
+
+    ListStyleType const& list_style_type() const { return m_inherited->list_style_type; }
+    ListStylePosition list_style_position() const { return m_inherited->list_style_position; }
+
+    Optional<SVGPaint> const& fill() const { return m_inherited->fill; }
+    FillRule fill_rule() const { return m_inherited->fill_rule; }
+    Optional<SVGPaint> const& stroke() const { return m_inherited->stroke; }
+    float fill_opacity() const { return m_inherited->fill_opacity; }
+    Vector<Variant<LengthPercentage, float>> const& stroke_dasharray() const { return m_inherited->stroke_dasharray; }
+    LengthPercentage const& stroke_dashoffset() const { return m_inherited->stroke_dashoffset; }
+    StrokeLinecap stroke_linecap() const { return m_inherited->stroke_linecap; }
+    StrokeLinejoin stroke_linejoin() const { return m_inherited->stroke_linejoin; }
+    double stroke_miterlimit() const { return m_inherited->stroke_miterlimit; }
+    float stroke_opacity() const { return m_inherited->stroke_opacity; }
+    LengthPercentage const& stroke_width() const { return m_inherited->stroke_width; }
     Color stop_color() const { return m_noninherited.stop_color; }
     float stop_opacity() const { return m_noninherited.stop_opacity; }
-    TextAnchor text_anchor() const { return m_inherited.text_anchor; }
+    TextAnchor text_anchor() const { return m_inherited->text_anchor; }
     RefPtr<AbstractImageStyleValue const> mask_image() const { return m_noninherited.mask_image; }
     Optional<MaskReference> const& mask() const { return m_noninherited.mask; }
     MaskType mask_type() const { return m_noninherited.mask_type; }
     Optional<ClipPathReference> const& clip_path() const { return m_noninherited.clip_path; }
-    ClipRule clip_rule() const { return m_inherited.clip_rule; }
+    ClipRule clip_rule() const { return m_inherited->clip_rule; }
     Color flood_color() const { return m_noninherited.flood_color; }
     float flood_opacity() const { return m_noninherited.flood_opacity; }
-    PaintOrderList paint_order() const { return m_inherited.paint_order; }
+    PaintOrderList paint_order() const { return m_inherited->paint_order; }
 
     LengthPercentage const& cx() const { return m_noninherited.cx; }
     LengthPercentage const& cy() const { return m_noninherited.cy; }
@@ -682,12 +684,12 @@ public:
     Optional<CSSPixels> const& perspective() const { return m_noninherited.perspective; }
     Position const& perspective_origin() const { return m_noninherited.perspective_origin; }
 
-    Gfx::FontCascadeList const& font_list() const { return *m_inherited.font_list; }
-    CSSPixels font_size() const { return m_inherited.font_size; }
-    double font_weight() const { return m_inherited.font_weight; }
-    Optional<FlyString> font_language_override() const { return m_inherited.font_language_override; }
-    HashMap<FlyString, double> font_variation_settings() const { return m_inherited.font_variation_settings; }
-    CSSPixels line_height() const { return m_inherited.line_height; }
+    Gfx::FontCascadeList const& font_list() const { return *m_inherited->font_list; }
+    CSSPixels font_size() const { return m_inherited->font_size; }
+    double font_weight() const { return m_inherited->font_weight; }
+    Optional<FlyString> font_language_override() const { return m_inherited->font_language_override; }
+    HashMap<FlyString, double> font_variation_settings() const { return m_inherited->font_variation_settings; }
+    CSSPixels line_height() const { return m_inherited->line_height; }
     Time transition_delay() const { return m_noninherited.transition_delay; }
 
     Color outline_color() const { return m_noninherited.outline_color; }
@@ -697,13 +699,13 @@ public:
 
     TableLayout table_layout() const { return m_noninherited.table_layout; }
 
-    QuotesData quotes() const { return m_inherited.quotes; }
+    QuotesData quotes() const { return m_inherited->quotes; }
 
-    MathShift math_shift() const { return m_inherited.math_shift; }
-    MathStyle math_style() const { return m_inherited.math_style; }
-    int math_depth() const { return m_inherited.math_depth; }
+    MathShift math_shift() const { return m_inherited->math_shift; }
+    MathStyle math_style() const { return m_inherited->math_style; }
+    int math_depth() const { return m_inherited->math_depth; }
 
-    ScrollbarColorData scrollbar_color() const { return m_inherited.scrollbar_color; }
+    ScrollbarColorData scrollbar_color() const { return m_inherited->scrollbar_color; }
     ScrollbarWidth scrollbar_width() const { return m_noninherited.scrollbar_width; }
     Resize resize() const { return m_noninherited.resize; }
     WillChange const& will_change() const { return m_noninherited.will_change; }
@@ -780,7 +782,20 @@ protected:
         float stroke_opacity { InitialValues::stroke_opacity() };
     };
 
-    InheritedValues m_inherited;
+    // NB: Inherited values are shared between a box and the anonymous boxes and wrappers that inherit from it, and are
+    //     only copied once one of them sets a value of its own.
+    struct SharedInheritedValues final
+        : public RefCounted<SharedInheritedValues>
+        , public InheritedValues {
+        NonnullRefPtr<SharedInheritedValues> clone() const
+        {
+            auto clone = adopt_ref(*new SharedInheritedValues);
+            static_cast<InheritedValues&>(*clone) = *this;
+            return clone;
+        }
+    };
+
+    AK::CopyOnWrite<SharedInheritedValues> m_inherited;
 
     struct NonInheritedValues {
         AspectRatio aspect_ratio { InitialValues::aspect_ratio() };
@@ -939,53 +954,53 @@ public:
     }
 
     void set_aspect_ratio(AspectRatio aspect_ratio) { m_noninherited.aspect_ratio = move(aspect_ratio); }
-    void set_caret_color(Color caret_color) { m_inherited.caret_color = caret_color; }
-    void set_font_list(NonnullRefPtr<Gfx::FontCascadeList const> font_list) { m_inherited.font_list = move(font_list); }
-    void set_font_size(CSSPixels font_size) { m_inherited.font_size = font_size; }
-    void set_font_weight(double font_weight) { m_inherited.font_weight = font_weight; }
-    void set_font_language_override(Optional<FlyString> font_language_override) { m_inherited.font_language_override = move(font_language_override); }
-    void set_font_variation_settings(HashMap<FlyString, double> value) { m_inherited.font_variation_settings = move(value); }
-    void set_line_height(CSSPixels line_height) { m_inherited.line_height = line_height; }
-    void set_border_spacing_horizontal(Length border_spacing_horizontal) { m_inherited.border_spacing_horizontal = move(border_spacing_horizontal); }
-    void set_border_spacing_vertical(Length border_spacing_vertical) { m_inherited.border_spacing_vertical = move(border_spacing_vertical); }
-    void set_caption_side(CaptionSide caption_side) { m_inherited.caption_side = caption_side; }
-    void set_color(Color color) { m_inherited.color = color; }
-    void set_color_interpolation(ColorInterpolation color_interpolation) { m_inherited.color_interpolation = color_interpolation; }
-    void set_color_scheme(PreferredColorScheme color_scheme) { m_inherited.color_scheme = color_scheme; }
+    void set_caret_color(Color caret_color) { m_inherited->caret_color = caret_color; }
+    void set_font_list(NonnullRefPtr<Gfx::FontCascadeList const> font_list) { m_inherited->font_list = move(font_list); }
+    void set_font_size(CSSPixels font_size) { m_inherited->font_size = font_size; }
+    void set_font_weight(double font_weight) { m_inherited->font_weight = font_weight; }
+    void set_font_language_override(Optional<FlyString> font_language_override) { m_inherited->font_language_override = move(font_language_override); }
+    void set_font_variation_settings(HashMap<FlyString, double> value) { m_inherited->font_variation_settings = move(value); }
+    void set_line_height(CSSPixels line_height) { m_inherited->line_height = line_height; }
+    void set_border_spacing_horizontal(Length border_spacing_horizontal) { m_inherited->border_spacing_horizontal = move(border_spacing_horizontal); }
+    void set_border_spacing_vertical(Length border_spacing_vertical) { m_inherited->border_spacing_vertical = move(border_spacing_vertical); }
+    void set_caption_side(CaptionSide caption_side) { m_inherited->caption_side = caption_side; }
+    void set_color(Color color) { m_inherited->color = color; }
+    void set_color_interpolation(ColorInterpolation color_interpolation) { m_inherited->color_interpolation = color_interpolation; }
+    void set_color_scheme(PreferredColorScheme color_scheme) { m_inherited->color_scheme = color_scheme; }
     void set_clip(Clip const& clip) { m_noninherited.clip = clip; }
     void set_content(ContentData const& content) { m_noninherited.content = content; }
-    void set_content_visibility(ContentVisibility content_visibility) { m_inherited.content_visibility = content_visibility; }
-    void set_cursor(Vector<CursorData> cursor) { m_inherited.cursor = move(cursor); }
-    void set_image_rendering(ImageRendering value) { m_inherited.image_rendering = value; }
-    void set_pointer_events(PointerEvents value) { m_inherited.pointer_events = value; }
+    void set_content_visibility(ContentVisibility content_visibility) { m_inherited->content_visibility = content_visibility; }
+    void set_cursor(Vector<CursorData> cursor) { m_inherited->cursor = move(cursor); }
+    void set_image_rendering(ImageRendering value) { m_inherited->image_rendering = value; }
+    void set_pointer_events(PointerEvents value) { m_inherited->pointer_events = value; }
     void set_background_color(Color color) { m_noninherited.background_color = color; }
     void set_background_color_clip(BackgroundBox box) { m_noninherited.background_color_clip = box; }
     void set_background_layers(Vector<BackgroundLayerData>&& layers) { m_noninherited.background_layers = move(layers); }
     void set_float(Float value) { m_noninherited.float_ = value; }
     void set_clear(Clear value) { m_noninherited.clear = value; }
     void set_z_index(Optional<int> value) { m_noninherited.z_index = move(value); }
-    void set_tab_size(Variant<Length, double> value) { m_inherited.tab_size = move(value); }
-    void set_text_align(TextAlign text_align) { m_inherited.text_align = text_align; }
-    void set_text_justify(TextJustify text_justify) { m_inherited.text_justify = text_justify; }
+    void set_tab_size(Variant<Length, double> value) { m_inherited->tab_size = move(value); }
+    void set_text_align(TextAlign text_align) { m_inherited->text_align = text_align; }
+    void set_text_justify(TextJustify text_justify) { m_inherited->text_justify = text_justify; }
     void set_text_decoration_line(Vector<TextDecorationLine> value) { m_noninherited.text_decoration_line = move(value); }
     void set_text_decoration_thickness(TextDecorationThickness value) { m_noninherited.text_decoration_thickness = move(value); }
-    void set_text_decoration_skip_ink(TextDecorationSkipInk value) { m_inherited.text_decoration_skip_ink = value; }
+    void set_text_decoration_skip_ink(TextDecorationSkipInk value) { m_inherited->text_decoration_skip_ink = value; }
     void set_text_decoration_style(TextDecorationStyle value) { m_noninherited.text_decoration_style = value; }
     void set_text_decoration_color(Color value) { m_noninherited.text_decoration_color = value; }
-    void set_text_transform(TextTransform value) { m_inherited.text_transform = value; }
-    void set_text_shadow(Vector<ShadowData>&& value) { m_inherited.text_shadow = move(value); }
-    void set_text_indent(TextIndentData value) { m_inherited.text_indent = move(value); }
-    void set_text_wrap_mode(TextWrapMode value) { m_inherited.text_wrap_mode = value; }
+    void set_text_transform(TextTransform value) { m_inherited->text_transform = value; }
+    void set_text_shadow(Vector<ShadowData>&& value) { m_inherited->text_shadow = move(value); }
+    void set_text_indent(TextIndentData value) { m_inherited->text_indent = move(value); }
+    void set_text_wrap_mode(TextWrapMode value) { m_inherited->text_wrap_mode = value; }
     void set_text_overflow(TextOverflow value) { m_noninherited.text_overflow = value; }
-    void set_text_underline_offset(CSSPixels value) { m_inherited.text_underline_offset = value; }
-    void set_text_underline_position(TextUnderlinePosition value) { m_inherited.text_underline_position = value; }
-    void set_webkit_text_fill_color(Color value) { m_inherited.webkit_text_fill_color = value; }
+    void set_text_underline_offset(CSSPixels value) { m_inherited->text_underline_offset = value; }
+    void set_text_underline_position(TextUnderlinePosition value) { m_inherited->text_underline_position = value; }
+    void set_webkit_text_fill_color(Color value) { m_inherited->webkit_text_fill_color = value; }
     void set_position(Positioning position) { m_noninherited.position = position; }
-    void set_white_space_collapse(WhiteSpaceCollapse value) { m_inherited.white_space_collapse = value; }
+    void set_white_space_collapse(WhiteSpaceCollapse value) { m_inherited->white_space_collapse = value; }
     void set_white_space_trim(WhiteSpaceTrimData value) { m_noninherited.white_space_trim = value; }
-    void set_word_spacing(CSSPixels value) { m_inherited.word_spacing = value; }
-    void set_word_break(WordBreak value) { m_inherited.word_break = value; }
-    void set_letter_spacing(CSSPixels value) { m_inherited.letter_spacing = value; }
+    void set_word_spacing(CSSPixels value) { m_inherited->word_spacing = value; }
+    void set_word_break(WordBreak value) { m_inherited->word_break = value; }
+    void set_letter_spacing(CSSPixels value) { m_inherited->letter_spacing = value; }
     void set_width(Size const& width) { m_noninherited.width = width; }
     void set_min_width(Size const& width) { m_noninherited.min_width = width; }
     void set_max_width(Size const& width) { m_noninherited.max_width = width; }
@@ -998,8 +1013,8 @@ public:
     void set_overflow_clip_margin(LengthBox const& overflow_clip_margin) { m_noninherited.overflow_clip_margin = overflow_clip_margin; }
     void set_overflow_x(Overflow value) { m_noninherited.overflow_x = value; }
     void set_overflow_y(Overflow value) { m_noninherited.overflow_y = value; }
-    void set_list_style_type(ListStyleType value) { m_inherited.list_style_type = move(value); }
-    void set_list_style_position(ListStylePosition value) { m_inherited.list_style_position = move(value); }
+    void set_list_style_type(ListStyleType value) { m_inherited->list_style_type = move(value); }
+    void set_list_style_position(ListStylePosition value) { m_inherited->list_style_position = move(value); }
     void set_display(Display value) { m_noninherited.display = value; }
     void set_display_before_box_type_transformation(Display value) { m_noninherited.display_before_box_type_transformation = value; }
     void set_backdrop_filter(Filter const& backdrop_filter) { m_noninherited.backdrop_filter = backdrop_filter; }
@@ -1042,7 +1057,7 @@ public:
     void set_flex_grow(float value) { m_noninherited.flex_grow = value; }
     void set_flex_shrink(float value) { m_noninherited.flex_shrink = value; }
     void set_order(int value) { m_noninherited.order = value; }
-    void set_accent_color(Color value) { m_inherited.accent_color = value; }
+    void set_accent_color(Color value) { m_inherited->accent_color = value; }
     void set_align_content(AlignContent value) { m_noninherited.align_content = value; }
     void set_align_items(AlignItems value) { m_noninherited.align_items = value; }
     void set_align_self(AlignSelf value) { m_noninherited.align_self = value; }
@@ -1063,7 +1078,7 @@ public:
     void set_translate(RefPtr<TransformationStyleValue const> value) { m_noninherited.translate = move(value); }
     void set_box_sizing(BoxSizing value) { m_noninherited.box_sizing = value; }
     void set_vertical_align(Variant<VerticalAlign, LengthPercentage> value) { m_noninherited.vertical_align = move(value); }
-    void set_visibility(Visibility value) { m_inherited.visibility = value; }
+    void set_visibility(Visibility value) { m_inherited->visibility = value; }
     void set_grid_auto_columns(GridTrackSizeList value) { m_noninherited.grid_auto_columns = move(value); }
     void set_grid_auto_rows(GridTrackSizeList value) { m_noninherited.grid_auto_rows = move(value); }
     void set_grid_template_columns(GridTrackSizeList value) { m_noninherited.grid_template_columns = move(value); }
@@ -1078,19 +1093,19 @@ public:
     void set_column_width(Size const& column_width) { m_noninherited.column_width = column_width; }
     void set_column_height(Size const& column_height) { m_noninherited.column_height = column_height; }
     void set_row_gap(Variant<LengthPercentage, NormalGap> const& row_gap) { m_noninherited.row_gap = row_gap; }
-    void set_border_collapse(BorderCollapse const border_collapse) { m_inherited.border_collapse = border_collapse; }
-    void set_empty_cells(EmptyCells const empty_cells) { m_inherited.empty_cells = empty_cells; }
+    void set_border_collapse(BorderCollapse const border_collapse) { m_inherited->border_collapse = border_collapse; }
+    void set_empty_cells(EmptyCells const empty_cells) { m_inherited->empty_cells = empty_cells; }
     void set_grid_template_areas(GridTemplateAreas grid_template_areas) { m_noninherited.grid_template_areas = move(grid_template_areas); }
     void set_grid_auto_flow(GridAutoFlow grid_auto_flow) { m_noninherited.grid_auto_flow = grid_auto_flow; }
     void set_transition_delay(Time const& transition_delay) { m_noninherited.transition_delay = transition_delay; }
     void set_table_layout(TableLayout value) { m_noninherited.table_layout = value; }
-    void set_quotes(QuotesData value) { m_inherited.quotes = move(value); }
+    void set_quotes(QuotesData value) { m_inherited->quotes = move(value); }
     void set_object_fit(ObjectFit value) { m_noninherited.object_fit = value; }
     void set_object_position(Position value) { m_noninherited.object_position = move(value); }
-    void set_direction(Direction value) { m_inherited.direction = value; }
-    void set_dominant_baseline(Optional<BaselineMetric> value) { m_inherited.dominant_baseline = value; }
+    void set_direction(Direction value) { m_inherited->direction = value; }
+    void set_dominant_baseline(Optional<BaselineMetric> value) { m_inherited->dominant_baseline = value; }
     void set_unicode_bidi(UnicodeBidi value) { m_noninherited.unicode_bidi = value; }
-    void set_writing_mode(WritingMode value) { m_inherited.writing_mode = value; }
+    void set_writing_mode(WritingMode value) { m_inherited->writing_mode = value; }
     void set_user_select(UserSelect value) { m_noninherited.user_select = value; }
     void set_isolation(Isolation value) { m_noninherited.isolation = value; }
     void set_contain(Containment value) { m_noninherited.contain = move(value); }
@@ -1099,20 +1114,20 @@ public:
     void set_view_transition_name(Optional<FlyString> value) { m_noninherited.view_transition_name = move(value); }
     void set_touch_action(TouchActionData value) { m_noninherited.touch_action = value; }
 
-    void set_fill(SVGPaint value) { m_inherited.fill = move(value); }
-    void set_stroke(SVGPaint value) { m_inherited.stroke = move(value); }
-    void set_fill_rule(FillRule value) { m_inherited.fill_rule = value; }
-    void set_fill_opacity(float value) { m_inherited.fill_opacity = value; }
-    void set_stroke_dasharray(Vector<Variant<LengthPercentage, float>> value) { m_inherited.stroke_dasharray = move(value); }
-    void set_stroke_dashoffset(LengthPercentage value) { m_inherited.stroke_dashoffset = move(value); }
-    void set_stroke_linecap(StrokeLinecap value) { m_inherited.stroke_linecap = move(value); }
-    void set_stroke_linejoin(StrokeLinejoin value) { m_inherited.stroke_linejoin = move(value); }
-    void set_stroke_miterlimit(double value) { m_inherited.stroke_miterlimit = value; }
-    void set_stroke_opacity(float value) { m_inherited.stroke_opacity = value; }
-    void set_stroke_width(LengthPercentage value) { m_inherited.stroke_width = move(value); }
+    void set_fill(SVGPaint value) { m_inherited->fill = move(value); }
+    void set_stroke(SVGPaint value) { m_inherited->stroke = move(value); }
+    void set_fill_rule(FillRule value) { m_inherited->fill_rule = value; }
+    void set_fill_opacity(float value) { m_inherited->fill_opacity = value; }
+    void set_stroke_dasharray(Vector<Variant<LengthPercentage, float>> value) { m_inherited->stroke_dasharray = move(value); }
+    void set_stroke_dashoffset(LengthPercentage value) { m_inherited->stroke_dashoffset = move(value); }
+    void set_stroke_linecap(StrokeLinecap value) { m_inherited->stroke_linecap = move(value); }
+    void set_stroke_linejoin(StrokeLinejoin value) { m_inherited->stroke_linejoin = move(value); }
+    void set_stroke_miterlimit(double value) { m_inherited->stroke_miterlimit = value; }
+    void set_stroke_opacity(float value) { m_inherited->stroke_opacity = value; }
+    void set_stroke_width(LengthPercentage value) { m_inherited->stroke_width = move(value); }
     void set_stop_color(Color value) { m_noninherited.stop_color = value; }
     void set_stop_opacity(float value) { m_noninherited.stop_opacity = value; }
-    void set_text_anchor(TextAnchor value) { m_inherited.text_anchor = value; }
+    void set_text_anchor(TextAnchor value) { m_inherited->text_anchor = value; }
     void set_outline_color(Color value) { m_noninherited.outline_color = value; }
     void set_outline_offset(Length value) { m_noninherited.outline_offset = move(value); }
     void set_outline_style(OutlineStyle value) { m_noninherited.outline_style = value; }
@@ -1121,11 +1136,11 @@ public:
     void set_mask_type(MaskType value) { m_noninherited.mask_type = value; }
     void set_mask_image(AbstractImageStyleValue const& value) { m_noninherited.mask_image = value; }
     void set_clip_path(ClipPathReference value) { m_noninherited.clip_path = move(value); }
-    void set_clip_rule(ClipRule value) { m_inherited.clip_rule = value; }
+    void set_clip_rule(ClipRule value) { m_inherited->clip_rule = value; }
     void set_flood_color(Color value) { m_noninherited.flood_color = value; }
     void set_flood_opacity(float value) { m_noninherited.flood_opacity = value; }
     void set_shape_rendering(ShapeRendering value) { m_noninherited.shape_rendering = value; }
-    void set_paint_order(PaintOrderList value) { m_inherited.paint_order = value; }
+    void set_paint_order(PaintOrderList value) { m_inherited->paint_order = value; }
 
     void set_cx(LengthPercentage cx) { m_noninherited.cx = move(cx); }
     void set_cy(LengthPercentage cy) { m_noninherited.cy = move(cy); }
@@ -1135,11 +1150,11 @@ public:
     void set_x(LengthPercentage x) { m_noninherited.x = move(x); }
     void set_y(LengthPercentage y) { m_noninherited.y = move(y); }
 
-    void set_math_shift(MathShift value) { m_inherited.math_shift = value; }
-    void set_math_style(MathStyle value) { m_inherited.math_style = value; }
-    void set_math_depth(int value) { m_inherited.math_depth = value; }
+    void set_math_shift(MathShift value) { m_inherited->math_shift = value; }
+    void set_math_style(MathStyle value) { m_inherited->math_style = value; }
+    void set_math_depth(int value) { m_inherited->math_depth = value; }
 
-    void set_scrollbar_color(ScrollbarColorData value) { m_inherited.scrollbar_color = move(value); }
+    void set_scrollbar_color(ScrollbarColorData value) { m_inherited->scrollbar_color = move(value); }
     void set_scrollbar_width(ScrollbarWidth value) { m_noninherited.scrollbar_width = value; }
     void set_resize(Resize value) { m_noninherited.resize = value; }
 
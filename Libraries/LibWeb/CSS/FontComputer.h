@@ -11,6 +11,7 @@
 #pragma once
 
 #include <LibGC/CellAllocator.h>
+#include <LibGfx/Font/FontSupport.h>
 #include <LibGfx/FontCascadeList.h>
 #include <LibWeb/CSS/Fetch.h>
 #include <LibWeb/CSS/FontFeatureData.h>
@@ -80,9 +81,10 @@ public:
 private:
     virtual void visit_edges(Visitor&) override;
 
-    ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_load_font(Fetch::Infrastructure::Response const&, ByteBuffer const&);
+    static Optional<Gfx::FontFormat> font_format_for(Fetch::Infrastructure::Response const&, ByteBuffer const&);
 
     void font_did_load_or_fail(RefPtr<Gfx::Typeface const>);
+    void font_did_fail_to_decode();
 
     GC::Ref<FontComputer> m_font_computer;
     RuleOrDeclaration m_rule_or_declaration;
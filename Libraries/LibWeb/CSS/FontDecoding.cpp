@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Endian.h>
+#include <AK/HashMap.h>
+#include <LibCore/EventLoop.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibGfx/Font/WOFF/Loader.h>
+#include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibWeb/CSS/FontDecoding.h>
+
+namespace Web::CSS {
+
+namespace {
+
+struct DecodedFontKey {
+    Crypto::Hash::SHA256::DigestType digest;
+    Optional<Gfx::FontFormat> format;
+
+    bool operator==(DecodedFontKey const&) const = default;
+};
+
+struct DecodedFontKeyTraits : public DefaultTraits<DecodedFontKey> {
+    static unsigned hash(DecodedFontKey const& key)
+    {
+        // NB: The digest is already uniformly distributed, so any part of it makes for a good hash.
+        unsigned digest_hash = 0;
+        __builtin_memcpy(&digest_hash, key.digest.data, sizeof(digest_hash));
+        return pair_int_hash(digest_hash, key.format.has_value() ? to_underlying(*key.format) + 1 : 0);
+    }
+};
+
+// NB: Fonts are only ever loaded on the main thread, so this must only be used from the main thread as well.
+class DecodedFontCache {
+public:
+    static DecodedFontCache& the()
+    {
+        static DecodedFontCache s_the;
+        return s_the;
+    }
+
+    RefPtr<Gfx::Typeface const> get(DecodedFontKey const& key)
+    {
+        auto it = m_fonts.find(key);
+        if (it == m_fonts.end())
+            return nullptr;
+        it->value.last_use = ++m_use_counter;
+        return it->value.typeface;
+    }
+
+    void set(DecodedFontKey const& key, NonnullRefPtr<Gfx::Typeface const> typeface, size_t size_in_bytes)
+    {
+        if (size_in_bytes > capacity_in_bytes || m_fonts.contains(key))
+            return;
+
+        while (m_size_in_bytes + size_in_bytes > capacity_in_bytes) {
+            auto least_recently_used = m_fonts.begin();
+            for (auto it = m_fonts.begin(); it != m_fonts.end(); ++it) {
+                if (it->value.last_use < least_recently_used->value.last_use)
+                    least_recently_used = it;
+            }
+            m_size_in_bytes -= least_recently_used->value.size_in_bytes;
+            m_fonts.remove(least_recently_used);
+        }
+
+        m_size_in_bytes += size_in_bytes;
+        m_fonts.set(key, { move(typeface), size_in_bytes, ++m_use_counter });
+    }
+
+private:
+    static constexpr size_t capacity_in_bytes = 32 * MiB;
+
+    struct DecodedFont {
+        NonnullRefPtr<Gfx::Typeface const> typeface;
+        size_t size_in_bytes { 0 };
+        u64 last_use { 0 };
+    };
+
+    HashMap<DecodedFontKey, DecodedFont, DecodedFontKeyTraits> m_fonts;
+    size_t m_size_in_bytes { 0 };
+    u64 m_use_counter { 0 };
+};
+
+}
+
+// NB: A TrueType or OpenType font starts with its version instead, which is never one of these.
+static constexpr u32 woff_signature = 0x774F4646;  // 'wOFF'
+static constexpr u32 woff2_signature = 0x774F4632; // 'wOF2'
+
+static Gfx::FontFormat detect_font_format(ReadonlyBytes bytes)
+{
+    if (bytes.size() < sizeof(u32))
+        return Gfx::FontFormat::OpenType;
+
+    u32 signature = 0;
+    __builtin_memcpy(&signature, bytes.data(), sizeof(signature));
+    signature = AK::convert_between_host_and_big_endian(signature);
+
+    if (signature == woff_signature)
+        return Gfx::FontFormat::WOFF;
+    if (signature == woff2_signature)
+        return Gfx::FontFormat::WOFF2;
+    return Gfx::FontFormat::OpenType;
+}
+
+static ErrorOr<NonnullRefPtr<Gfx::Typeface const>> load_typeface(DecodedFontKey const& key, ErrorOr<ByteBuffer> sfnt)
+{
+    if (sfnt.is_error())
+        return sfnt.release_error();
+
+    auto size_in_bytes = sfnt.value().size();
+    auto font_data = Gfx::FontData::create_from_byte_buffer(sfnt.release_value());
+    NonnullRefPtr<Gfx::Typeface const> typeface = TRY(Gfx::Typeface::try_load_from_font_data(move(font_data)));
+    DecodedFontCache::the().set(key, typeface, size_in_bytes);
+    return typeface;
+}
+
+void decode_font(ByteBuffer bytes, Optional<Gfx::FontFormat> format, FontDecodingCallback on_decoded)
+{
+    DecodedFontKey key { Crypto::Hash::SHA256::hash(bytes), format };
+    if (auto typeface = DecodedFontCache::the().get(key)) {
+        on_decoded(typeface.release_nonnull());
+        return;
+    }
+
+    auto actual_format = format.value_or_lazy_evaluated([&] { return detect_font_format(bytes); });
+
+    // NB: There is nothing to decompress for fonts that are not WOFF or WOFF2, so they are loaded right away.
+    // FIXME: Parse the typeface on the thread pool as well, once creating Skia typefaces is safe to do off the main thread.
+    if (actual_format != Gfx::FontFormat::WOFF && actual_format != Gfx::FontFormat::WOFF2) {
+        on_decoded(load_typeface(key, move(bytes)));
+        return;
+    }
+
+    // NB: The callback is heap-allocated so that if the event loop is destroyed while decoding, we leak it (and any
+    //     GC::Root objects it captures) rather than destroying them on the worker thread.
+    auto* callback = new FontDecodingCallback(move(on_decoded));
+    auto event_loop_weak = Core::EventLoop::current_weak();
+
+    Threading::ThreadPool::the().submit([bytes = move(bytes), actual_format, key, callback, event_loop_weak = move(event_loop_weak)]() mutable {
+        auto sfnt = actual_format == Gfx::FontFormat::WOFF ? WOFF::decompress(bytes) : WOFF2::decompress(bytes);
+        bytes.clear();
+
+        auto origin = event_loop_weak->take();
+        if (!origin)
+            return;
+        origin->deferred_invoke([key, sfnt = move(sfnt), callback]() mutable {
+            (*callback)(load_typeface(key, move(sfnt)));
+            delete callback;
+        });
+    });
+}
+
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <LibGfx/Font/FontSupport.h>
+#include <LibGfx/Font/Typeface.h>
+
+namespace Web::CSS {
+
+using FontDecodingCallback = Function<void(ErrorOr<NonnullRefPtr<Gfx::Typeface const>>)>;
+
+// Decodes a web font of the given format, or of any format we support if the format is not known. WOFF and WOFF2 fonts
+// are decompressed on the thread pool, after which `on_decoded` is called on the main thread.
+// Decoded fonts are kept in a process-wide cache keyed by the hash of their contents, so that documents which load the
+// same font again, for example after a navigation, get it right away without decompressing it again.
+void decode_font(ByteBuffer, Optional<Gfx::FontFormat>, FontDecodingCallback on_decoded);
+
+}
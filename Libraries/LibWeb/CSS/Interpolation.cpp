@@ -10,6 +10,7 @@
  */
 
 #include "Interpolation.h"
+#include <AK/Array.h>
 #include <AK/IntegralMath.h>
 #include <LibWeb/CSS/PropertyID.h>
 #include <LibWeb/CSS/PropertyNameAndID.h>
@@ -65,6 +66,18 @@ static T interpolate_raw(T from, T to, float delta, Optional<AcceptedTypeRange>
     return static_cast<AK::Detail::RemoveCVReference<T>>(from + (to - from) * delta);
 }
 
+// OPTIMIZATION: Building a calculation context allocates, and we need one for every animated property on every
+//               animation frame, so we only build the one for each longhand property once.
+static CalculationContext const& calculation_context_for_animated_property(PropertyID property_id)
+{
+    VERIFY(property_id >= first_longhand_property_id && property_id <= last_longhand_property_id);
+    static Array<Optional<CalculationContext>, number_of_longhand_properties> s_calculation_contexts;
+    auto& calculation_context = s_calculation_contexts[to_underlying(property_id) - to_underlying(first_longhand_property_id)];
+    if (!calculation_context.has_value())
+        calculation_context = CalculationContext::for_property(PropertyNameAndID::from_id(property_id));
+    return *calculation_context;
+}
+
 static NonnullRefPtr<StyleValue const> with_keyword_values_resolved(DOM::Element& element, PropertyID property_id, StyleValue const& value)
 {
     if (value.is_guaranteed_invalid()) {
@@ -667,7 +680,7 @@ ValueComparingRefPtr<StyleValue const> interpolate_property(DOM::Element& elemen
     auto from = with_keyword_values_resolved(element, property_id, a_from);
     auto to = with_keyword_values_resolved(element, property_id, a_to);
 
-    auto calculation_context = CalculationContext::for_property(PropertyNameAndID::from_id(property_id));
+    auto const& calculation_context = calculation_context_for_animated_property(property_id);
 
     auto animation_type = animation_type_from_longhand_property(property_id);
     switch (animation_type) {
@@ -1861,16 +1874,28 @@ static RefPtr<StyleValue const> interpolate_value_impl(DOM::Element& element, Ca
         // Interpolation of <integer> is defined as Vresult = round((1 - p) × VA + p × VB);
         // that is, interpolation happens in the real number space as for <number>s, and the result is converted to an <integer> by rounding to the nearest integer.
         auto interpolated_value = interpolate_raw(from.as_integer().integer(), to.as_integer().integer(), delta, calculation_context.accepted_type_ranges.get(ValueType::Integer));
+        if (interpolated_value == from.as_integer().integer())
+            return from;
+        if (interpolated_value == to.as_integer().integer())
+            return to;
         return IntegerStyleValue::create(interpolated_value);
     }
     case StyleValue::Type::Length: {
         auto const& from_length = from.as_length().length();
         auto const& to_length = to.as_length().length();
         auto interpolated_value = interpolate_raw(from_length.raw_value(), to_length.raw_value(), delta, calculation_context.accepted_type_ranges.get(ValueType::Length));
+        if (interpolated_value == from_length.raw_value())
+            return from;
+        if (interpolated_value == to_length.raw_value() && to_length.unit() == from_length.unit())
+            return to;
         return LengthStyleValue::create(Length(interpolated_value, from_length.unit()));
     }
     case StyleValue::Type::Number: {
         auto interpolated_value = interpolate_raw(from.as_number().number(), to.as_number().number(), delta, calculation_context.accepted_type_ranges.get(ValueType::Number));
+        if (interpolated_value == from.as_number().number())
+            return from;
+        if (interpolated_value == to.as_number().number())
+            return to;
         return NumberStyleValue::create(interpolated_value);
     }
     case StyleValue::Type::OpenTypeTagged: {
@@ -1885,6 +1910,10 @@ static RefPtr<StyleValue const> interpolate_value_impl(DOM::Element& element, Ca
     }
     case StyleValue::Type::Percentage: {
         auto interpolated_value = interpolate_raw(from.as_percentage().percentage().value(), to.as_percentage().percentage().value(), delta, calculation_context.accepted_type_ranges.get(ValueType::Percentage));
+        if (interpolated_value == from.as_percentage().percentage().value())
+            return from;
+        if (interpolated_value == to.as_percentage().percentage().value())
+            return to;
         return PercentageStyleValue::create(Percentage(interpolated_value));
     }
     case StyleValue::Type::Position: {
@@ -2497,7 +2526,7 @@ static RefPtr<StyleValue const> composite_mixed_value(StyleValue const& underlyi
 
 RefPtr<StyleValue const> composite_value(PropertyID property_id, StyleValue const& underlying_value, StyleValue const& animated_value, Bindings::CompositeOperation composite_operation)
 {
-    auto calculation_context = CalculationContext::for_property(PropertyNameAndID::from_id(property_id));
+    auto const& calculation_context = calculation_context_for_animated_property(property_id);
 
     auto composite_dimension_value = [](StyleValue const& underlying_value, StyleValue const& animated_value) -> Optional<double> {
         auto const& underlying_dimension = as<DimensionStyleValue>(underlying_value);
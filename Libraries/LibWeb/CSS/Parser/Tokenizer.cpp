@@ -295,6 +295,42 @@ U32Triplet Tokenizer::peek_triplet() const
     return values;
 }
 
+// OPTIMIZATION: Consumes the ASCII code points at the front of the input for which `predicate` holds, by looking at
+//               the UTF-8 bytes directly instead of decoding and consuming them one at a time. Most style sheets are
+//               almost entirely ASCII, so this lets the hot loops of the tokenizer skip over whole runs of input.
+//               Returns the consumed code points.
+template<typename Predicate>
+StringView Tokenizer::consume_ascii_code_points_while(Predicate predicate)
+{
+    auto const* bytes = m_utf8_view.bytes();
+    auto length = m_utf8_view.byte_length();
+    auto start = current_byte_offset();
+
+    auto end = start;
+    auto position = m_position;
+    auto previous_position = m_prev_position;
+    while (end < length && is_ascii(bytes[end]) && predicate(bytes[end])) {
+        previous_position = position;
+        if (is_newline(bytes[end])) {
+            position.line++;
+            position.column = 0;
+        } else {
+            position.column++;
+        }
+        ++end;
+    }
+
+    if (end == start)
+        return {};
+
+    // NB: Leave the previous code point pointing at the last one we consumed, so that it can be reconsumed.
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(end - 1);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(end);
+    m_prev_position = previous_position;
+    m_position = position;
+    return { reinterpret_cast<char const*>(bytes) + start, end - start };
+}
+
 U32Twin Tokenizer::start_of_input_stream_twin()
 {
     U32Twin twin;
@@ -451,13 +487,7 @@ Number Tokenizer::consume_a_number()
     }
 
     // 3. While the next input code point is a digit, consume it and append it to repr.
-    for (;;) {
-        auto digits = peek_code_point();
-        if (!is_digit(digits))
-            break;
-
-        repr.append_code_point(next_code_point());
-    }
+    repr.append(consume_ascii_code_points_while([](u32 code_point) { return is_digit(code_point); }));
 
     // 4. If the next 2 input code points are U+002E FULL STOP (.) followed by a digit, then:
     auto maybe_number = peek_twin();
@@ -471,13 +501,7 @@ Number Tokenizer::consume_a_number()
         type = Number::Type::Number;
 
         // 4. While the next input code point is a digit, consume it and append it to repr.
-        for (;;) {
-            auto digit = peek_code_point();
-            if (!is_digit(digit))
-                break;
-
-            repr.append_code_point(next_code_point());
-        }
+        repr.append(consume_ascii_code_points_while([](u32 code_point) { return is_digit(code_point); }));
     }
 
     // 5. If the next 2 or 3 input code points are U+0045 LATIN CAPITAL LETTER E (E) or
@@ -504,13 +528,7 @@ Number Tokenizer::consume_a_number()
         type = Number::Type::Number;
 
         // 4. While the next input code point is a digit, consume it and append it to repr.
-        for (;;) {
-            auto digits = peek_code_point();
-            if (!is_digit(digits))
-                break;
-
-            repr.append_code_point(next_code_point());
-        }
+        repr.append(consume_ascii_code_points_while([](u32 code_point) { return is_digit(code_point); }));
     }
 
     // 6. Convert repr to a number, and set the value to the returned value.
@@ -542,8 +560,16 @@ FlyString Tokenizer::consume_an_ident_sequence()
     // If that is the intended use, ensure that the stream starts with an ident sequence before
     // calling this algorithm.
 
+    auto ascii_name_code_points = consume_ascii_code_points_while([](u32 code_point) { return is_ident_code_point(code_point); });
+
+    // OPTIMIZATION: If the ident sequence consisted only of ASCII name code points, there's no need to build it up
+    //               code point by code point.
+    if (auto next_input = peek_code_point(); !is_ident_code_point(next_input) && !is_reverse_solidus(next_input))
+        return FlyString::from_utf8_without_validation(ascii_name_code_points.bytes());
+
     // Let result initially be an empty string.
     StringBuilder result;
+    result.append(ascii_name_code_points);
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
@@ -702,9 +728,8 @@ void Tokenizer::consume_the_remnants_of_a_bad_url()
 
 void Tokenizer::consume_as_much_whitespace_as_possible()
 {
-    while (is_whitespace(peek_code_point())) {
-        (void)next_code_point();
-    }
+    // NB: All whitespace code points are ASCII.
+    (void)consume_ascii_code_points_while([](u32 code_point) { return is_whitespace(code_point); });
 }
 
 void Tokenizer::reconsume_current_input_code_point()
@@ -945,6 +970,8 @@ start:
     (void)next_code_point();
 
     for (;;) {
+        (void)consume_ascii_code_points_while([](u32 code_point) { return !is_asterisk(code_point); });
+
         auto twin_inner = peek_twin();
         if (is_eof(twin_inner.first) || is_eof(twin_inner.second)) {
             log_parse_error();
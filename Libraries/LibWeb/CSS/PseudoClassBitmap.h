@@ -38,6 +38,15 @@ public:
         return (m_bits[word_index] & (1LLU << bit_index)) != 0;
     }
 
+    bool is_empty() const
+    {
+        for (auto word : m_bits) {
+            if (word != 0)
+                return false;
+        }
+        return true;
+    }
+
     void operator|=(PseudoClassBitmap const& other)
     {
         for (size_t i = 0; i < word_count; ++i)
@@ -126,6 +126,54 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     collect_ancestor_hashes();
 
     m_can_use_fast_matches = can_selector_use_fast_matches(*this);
+    if (m_can_use_fast_matches)
+        compile_fast_match_program();
+}
+
+void Selector::compile_fast_match_program()
+{
+    for (auto const& compound_selector : m_compound_selectors.in_reverse()) {
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            FastMatchStep step { .type = FastMatchStep::Type::Other, .simple_selector = &simple_selector };
+            switch (simple_selector.type) {
+            case SimpleSelector::Type::TagName:
+                step.type = FastMatchStep::Type::TagName;
+                step.name = simple_selector.qualified_name().name.name;
+                step.lowercase_name = simple_selector.qualified_name().name.lowercase_name;
+                step.needs_namespace_check = simple_selector.qualified_name().namespace_type != SimpleSelector::QualifiedName::NamespaceType::Any;
+                break;
+            case SimpleSelector::Type::Universal:
+                step.type = FastMatchStep::Type::Universal;
+                step.needs_namespace_check = simple_selector.qualified_name().namespace_type != SimpleSelector::QualifiedName::NamespaceType::Any;
+                break;
+            case SimpleSelector::Type::Class:
+                step.type = FastMatchStep::Type::Class;
+                step.name = simple_selector.name();
+                break;
+            case SimpleSelector::Type::Id:
+                step.type = FastMatchStep::Type::Id;
+                step.name = simple_selector.name();
+                break;
+            default:
+                break;
+            }
+            m_fast_match_program.append(move(step));
+        }
+
+        switch (compound_selector.combinator) {
+        case Combinator::None:
+            m_fast_match_program.append({ .type = FastMatchStep::Type::Match });
+            break;
+        case Combinator::Descendant:
+            m_fast_match_program.append({ .type = FastMatchStep::Type::Descendant });
+            break;
+        case Combinator::ImmediateChild:
+            m_fast_match_program.append({ .type = FastMatchStep::Type::ImmediateChild });
+            break;
+        default:
+            VERIFY_NOT_REACHED();
+        }
+    }
 }
 
 void Selector::collect_ancestor_hashes()
@@ -226,7 +226,31 @@ public:
 
     auto const& ancestor_hashes() const { return m_ancestor_hashes; }
 
+    // The compound selectors of a selector that can use fast matching, flattened into a linear program that is run
+    // from the subject compound leftwards. The simple selectors of each compound are followed by the combinator that
+    // leads to the next compound, and the program ends in a Match step.
+    struct FastMatchStep {
+        enum class Type : u8 {
+            TagName,
+            Universal,
+            Class,
+            Id,
+            // Matched through the generic code path for `simple_selector`, e.g. attribute selectors and pseudo-classes.
+            Other,
+            Descendant,
+            ImmediateChild,
+            Match,
+        };
+
+        Type type;
+        bool needs_namespace_check { false };
+        SimpleSelector const* simple_selector { nullptr };
+        FlyString name;
+        FlyString lowercase_name;
+    };
+
     bool can_use_fast_matches() const { return m_can_use_fast_matches; }
+    ReadonlySpan<FastMatchStep> fast_match_program() const { return m_fast_match_program; }
     bool can_use_ancestor_filter() const { return m_can_use_ancestor_filter; }
 
     size_t sibling_invalidation_distance() const;
@@ -248,8 +272,10 @@ private:
     PseudoClassBitmap m_contained_pseudo_classes;
 
     void collect_ancestor_hashes();
+    void compile_fast_match_program();
 
     Array<u32, 8> m_ancestor_hashes;
+    Vector<FastMatchStep> m_fast_match_program;
 };
 
 String serialize_a_group_of_selectors(SelectorList const& selectors);
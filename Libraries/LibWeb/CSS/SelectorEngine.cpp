@@ -1345,67 +1345,92 @@ static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& si
     }
 }
 
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
-{
-    for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, element, shadow_host, context))
-            return false;
-    }
-    return true;
-}
-
 bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_match, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    DOM::Element const* current = &element_to_match;
+    using StepType = CSS::Selector::FastMatchStep::Type;
+
+    auto program = selector.fast_match_program();
+    auto const& document = element_to_match.document();
+    auto const is_html_document = document.document_type() == DOM::Document::Type::HTML;
+    // Class selectors are matched case insensitively in quirks mode.
+    // See: https://drafts.csswg.org/selectors-4/#class-html
+    auto const class_case_sensitivity = document.in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
+
+    auto step_matches = [&](CSS::Selector::FastMatchStep const& step, DOM::Element const& element) {
+        // NB: None of the simple selectors supported here may match the shadow host from within its shadow tree.
+        if (shadow_host && &element == shadow_host.ptr())
+            return false;
 
-    ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
+        switch (step.type) {
+        case StepType::TagName:
+            // https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
+            // When comparing a CSS element type selector to the names of HTML elements in HTML documents, the CSS element type selector must first be converted to ASCII lowercase. The
+            // same selector when compared to other elements must be compared according to its original case. In both cases, to match the values must be identical to each other (and therefore
+            // the comparison is case sensitive).
+            if (is_html_document && element.namespace_uri() == Namespace::HTML) {
+                if (step.lowercase_name != element.local_name())
+                    return false;
+            } else if (step.name != element.local_name()) {
+                // NOTE: Any other elements are either SVG, XHTML or MathML, all of which are case-sensitive.
+                return false;
+            }
+            [[fallthrough]];
+        case StepType::Universal:
+            return !step.needs_namespace_check || matches_namespace(step.simple_selector->qualified_name(), element, context.style_sheet_for_rule);
+        case StepType::Class:
+            return element.has_class(step.name, class_case_sensitivity);
+        case StepType::Id:
+            return step.name == element.id();
+        case StepType::Other:
+            return fast_matches_simple_selector(*step.simple_selector, element, shadow_host, context);
+        default:
+            VERIFY_NOT_REACHED();
+        }
+    };
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), *current, shadow_host, context))
-        return false;
+    DOM::Element const* current = &element_to_match;
+    size_t step_index = 0;
 
-    // NOTE: If we fail after following a child combinator, we may need to backtrack
-    //       to the last matched descendant. We store the state here.
-    struct {
-        GC::Ptr<DOM::Element const> element;
-        ssize_t compound_selector_index = 0;
-    } backtrack_state;
+    // NOTE: If a compound fails to match after following child combinators, we resume at the compound following the
+    //       innermost descendant combinator, this time trying to match it against the next ancestor. Matching any
+    //       compounds further to the left against higher ancestors can only give them fewer, not more options.
+    Optional<size_t> descendant_step_index;
+    DOM::Element const* descendant_element = nullptr;
 
     for (;;) {
-        // NOTE: There should always be a leftmost compound selector without combinator that kicks us out of this loop.
-        VERIFY(compound_selector_index >= 0);
-
-        auto const* compound_selector = &selector.compound_selectors()[compound_selector_index];
-
-        switch (compound_selector->combinator) {
-        case CSS::Selector::Combinator::None:
+        auto const& step = program[step_index];
+        switch (step.type) {
+        case StepType::Match:
             return true;
-        case CSS::Selector::Combinator::Descendant:
-            backtrack_state = { current->parent_element(), compound_selector_index };
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
-            for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, *current, shadow_host, context))
-                    break;
-            }
+        case StepType::Descendant:
+            current = current->parent_element();
             if (!current)
                 return false;
-            break;
-        case CSS::Selector::Combinator::ImmediateChild:
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+            descendant_step_index = ++step_index;
+            descendant_element = current;
+            continue;
+        case StepType::ImmediateChild:
             current = current->parent_element();
             if (!current)
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, *current, shadow_host, context)) {
-                if (backtrack_state.element) {
-                    current = backtrack_state.element;
-                    compound_selector_index = backtrack_state.compound_selector_index;
-                    continue;
-                }
-                return false;
-            }
-            break;
+            ++step_index;
+            continue;
         default:
-            VERIFY_NOT_REACHED();
+            break;
         }
+
+        if (step_matches(step, *current)) {
+            ++step_index;
+            continue;
+        }
+
+        if (!descendant_step_index.has_value())
+            return false;
+        current = descendant_element->parent_element();
+        if (!current)
+            return false;
+        descendant_element = current;
+        step_index = *descendant_step_index;
     }
 }
 
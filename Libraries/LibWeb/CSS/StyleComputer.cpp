@@ -144,6 +144,8 @@ void StyleComputer::visit_edges(Visitor& visitor)
         m_cached_line_height_computation_context->visit_edges(visitor);
     if (m_cached_generic_computation_context.has_value())
         m_cached_generic_computation_context->visit_edges(visitor);
+    for (auto const& it : m_style_sharing_candidates)
+        visitor.visit(it.value.element);
 }
 
 Optional<String> StyleComputer::user_agent_style_sheet_source(StringView name)
@@ -243,6 +245,40 @@ bool StyleComputer::invalidation_property_used_in_has_selector(InvalidationSet::
     return false;
 }
 
+bool StyleComputer::insertion_or_removal_may_affect_has_selectors(DOM::Node const& subtree_root, StyleScope const& style_scope) const
+{
+    auto const* style_invalidation_data = style_scope.m_style_invalidation_data.ptr();
+    if (!style_invalidation_data || style_invalidation_data->has_selectors_may_depend_on_any_element)
+        return true;
+
+    auto element_is_used_in_has_selectors = [&](DOM::Element const& element) {
+        if (style_invalidation_data->tag_names_used_in_has_selectors.contains(element.lowercased_local_name()))
+            return true;
+        if (auto const& id = element.id(); id.has_value() && style_invalidation_data->ids_used_in_has_selectors.contains(*id))
+            return true;
+        for (auto const& class_name : element.class_names()) {
+            if (style_invalidation_data->class_names_used_in_has_selectors.contains(class_name))
+                return true;
+        }
+        bool has_attribute_used_in_has_selectors = false;
+        element.for_each_attribute([&](FlyString const& name, String const&) {
+            if (!has_attribute_used_in_has_selectors)
+                has_attribute_used_in_has_selectors = style_invalidation_data->attribute_names_used_in_has_selectors.contains(name.to_ascii_lowercase());
+        });
+        return has_attribute_used_in_has_selectors;
+    };
+
+    bool may_affect_has_selectors = false;
+    subtree_root.for_each_in_inclusive_subtree_of_type<DOM::Element>([&](DOM::Element const& element) {
+        if (element_is_used_in_has_selectors(element)) {
+            may_affect_has_selectors = true;
+            return TraversalDecision::Break;
+        }
+        return TraversalDecision::Continue;
+    });
+    return may_affect_has_selectors;
+}
+
 Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractElement abstract_element, CascadeOrigin cascade_origin, PseudoClassBitmap& attempted_pseudo_class_matches, Optional<FlyString const> qualified_layer_name) const
 {
     auto const& root_node = abstract_element.element().root();
@@ -256,7 +292,12 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
     else if (shadow_root)
         shadow_host = shadow_root->host();
 
-    Vector<MatchingRule const&, 512> rules_to_run;
+    // NB: The scratch storage is moved out while in use, so that a reentrant call would simply start with a fresh one.
+    auto rules_to_run = move(m_candidate_rules_scratch);
+    rules_to_run.clear_with_capacity();
+    ScopeGuard return_scratch_storage = [&] {
+        m_candidate_rules_scratch = move(rules_to_run);
+    };
 
     auto add_rule_to_run = [&](MatchingRule const& rule_to_run) {
         // FIXME: This needs to be revised when adding support for the ::shadow selector, as it needs to cross shadow boundaries.
@@ -285,7 +326,7 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
         if (selector.can_use_ancestor_filter() && should_reject_with_ancestor_filter(selector))
             return;
 
-        rules_to_run.unchecked_append(rule_to_run);
+        rules_to_run.unchecked_append(&rule_to_run);
     };
 
     auto add_rules_to_run = [&](Vector<MatchingRule> const& rules) {
@@ -358,7 +399,9 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
     Vector<MatchingRule const*> matching_rules;
     matching_rules.ensure_capacity(rules_to_run.size());
 
-    for (auto const& rule_to_run : rules_to_run) {
+    for (auto const* candidate_rule : rules_to_run) {
+        auto const& rule_to_run = *candidate_rule;
+
         // NOTE: When matching an element that is itself a shadow host against a rule from
         //       outside its own shadow root, we must not use the element as the shadow host
         //       for traversal (which would confine traversal to the element itself).
@@ -1228,6 +1271,59 @@ StyleComputer::MatchingRuleSet StyleComputer::build_matching_rule_set(DOM::Abstr
     return matching_rule_set;
 }
 
+// NB: An element can only reuse the matching rules of a sibling if no selector in the style scope could tell the two
+//     apart. Since siblings share all of their ancestors, we get there by requiring identical tag names and class
+//     attributes, no other attributes, no sibling combinators, and no pseudo-class having been looked at while
+//     matching the sibling. The rest of the cascade (presentational hints, inline style, animations) is still per
+//     element.
+bool StyleComputer::can_share_matching_rules(DOM::AbstractElement abstract_element, StyleScope const& style_scope) const
+{
+    if (!m_style_sharing_enabled || abstract_element.pseudo_element().has_value())
+        return false;
+
+    // Elements in shadow trees can be matched by rules from other style scopes, so we leave them alone.
+    if (&style_scope != &m_document->style_scope() || style_scope.have_sibling_combinators())
+        return false;
+
+    auto const& element = abstract_element.element();
+    if (!element.parent_element() || element.use_pseudo_element().has_value() || element.is_shadow_host() || element.assigned_slot_internal())
+        return false;
+
+    auto attribute_count = element.attribute_list_size();
+    return attribute_count == 0 || (attribute_count == 1 && element.has_attribute(HTML::AttributeNames::class_));
+}
+
+Optional<StyleComputer::MatchingRuleSet> StyleComputer::matching_rule_set_shared_with_sibling(DOM::AbstractElement abstract_element, StyleScope const& style_scope) const
+{
+    if (!can_share_matching_rules(abstract_element, style_scope))
+        return {};
+
+    auto const& element = abstract_element.element();
+    auto it = m_style_sharing_candidates.find(element.parent_element().ptr());
+    if (it == m_style_sharing_candidates.end())
+        return {};
+
+    auto const& candidate = it->value;
+    auto const& sibling = *candidate.element;
+    if (candidate.rule_cache_generation != style_scope.rule_cache_generation()
+        || sibling.parent_element() != element.parent_element()
+        || sibling.local_name() != element.local_name()
+        || sibling.namespace_uri() != element.namespace_uri()
+        || sibling.get_attribute(HTML::AttributeNames::class_) != element.get_attribute(HTML::AttributeNames::class_))
+        return {};
+
+    return candidate.matching_rule_set;
+}
+
+void StyleComputer::remember_matching_rule_set_for_style_sharing(DOM::AbstractElement abstract_element, StyleScope const& style_scope, MatchingRuleSet const& matching_rule_set) const
+{
+    if (!can_share_matching_rules(abstract_element, style_scope))
+        return;
+
+    auto const& element = abstract_element.element();
+    m_style_sharing_candidates.set(element.parent_element().ptr(), StyleSharingCandidate { element, style_scope.rule_cache_generation(), matching_rule_set });
+}
+
 // https://www.w3.org/TR/css-cascade/#cascading
 // https://drafts.csswg.org/css-cascade-5/#layering
 GC::Ref<CascadedProperties> StyleComputer::compute_cascaded_values(DOM::AbstractElement abstract_element, bool did_match_any_pseudo_element_rules, ComputeStyleMode mode, MatchingRuleSet const& matching_rule_set) const
@@ -1782,7 +1878,16 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
-    auto matching_rule_set = build_matching_rule_set(abstract_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode, style_scope);
+    auto matching_rule_set = [&] {
+        if (mode == ComputeStyleMode::Normal) {
+            if (auto shared_matching_rule_set = matching_rule_set_shared_with_sibling(abstract_element, style_scope); shared_matching_rule_set.has_value())
+                return shared_matching_rule_set.release_value();
+        }
+        auto rule_set = build_matching_rule_set(abstract_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode, style_scope);
+        if (mode == ComputeStyleMode::Normal && attempted_pseudo_class_matches.is_empty())
+            remember_matching_rule_set_for_style_sharing(abstract_element, style_scope, rule_set);
+        return rule_set;
+    }();
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
         // NOTE: If we're computing style for a pseudo-element, we look for a number of reasons to bail early.
@@ -2160,6 +2265,10 @@ static Optional<SimplifiedSelectorForBucketing> is_roundabout_selector_bucketabl
         return SimplifiedSelectorForBucketing { inner_simple_selector.type, inner_simple_selector.qualified_name().name.lowercase_name };
     }
 
+    if (inner_simple_selector.type == CSS::Selector::SimpleSelector::Type::Attribute) {
+        return SimplifiedSelectorForBucketing { inner_simple_selector.type, inner_simple_selector.attribute().qualified_name.name.lowercase_name };
+    }
+
     return {};
 }
 
@@ -2227,7 +2336,7 @@ void StyleComputer::compute_custom_properties(ComputedProperties&, DOM::Abstract
 
     OrderedHashMap<FlyString, StyleProperty> resolved_own;
     for (auto const& [name, style_property] : data->own_values()) {
-        auto resolved_value = compute_value_of_custom_property(abstract_element, name);
+        auto resolved_value = compute_value_of_own_custom_property(abstract_element, *data, name, *style_property.value);
         if (parent_data) {
             auto const* parent_property = parent_data->get(name);
             if (parent_property && resolved_value->equals(*parent_property->value))
@@ -2251,6 +2360,73 @@ void StyleComputer::compute_custom_properties(ComputedProperties&, DOM::Abstract
         CustomPropertyData::create(move(resolved_own), parent_data ? move(parent_data) : data->parent()));
 }
 
+// Collects the names of the custom properties referred to by the var() functions in the given component values,
+// including those nested in other functions or in var() fallbacks. Returns false if a var() doesn't start with a plain
+// custom property name.
+static bool collect_custom_properties_referenced_by_var(Vector<Parser::ComponentValue> const& values, Vector<FlyString>& names)
+{
+    for (auto const& value : values) {
+        if (value.is_block()) {
+            if (!collect_custom_properties_referenced_by_var(value.block().value, names))
+                return false;
+            continue;
+        }
+        if (!value.is_function())
+            continue;
+
+        auto const& function = value.function();
+        if (function.name.equals_ignoring_ascii_case("var"sv)) {
+            size_t index = 0;
+            while (index < function.value.size() && function.value[index].is(Parser::Token::Type::Whitespace))
+                ++index;
+            if (index == function.value.size() || !function.value[index].is(Parser::Token::Type::Ident))
+                return false;
+            names.append(function.value[index].token().ident());
+        }
+        if (!collect_custom_properties_referenced_by_var(function.value, names))
+            return false;
+    }
+    return true;
+}
+
+NonnullRefPtr<StyleValue const> StyleComputer::compute_value_of_own_custom_property(DOM::AbstractElement abstract_element, CustomPropertyData const& data, FlyString const& name, StyleValue const& value) const
+{
+    // NB: attr(), if() and inherit() depend on more than the element's custom properties, and registered custom
+    //     properties compute their value against the element itself.
+    if (!m_style_sharing_enabled
+        || !value.is_unresolved()
+        || !value.as_unresolved().includes_var_function()
+        || value.as_unresolved().includes_attr_function()
+        || value.as_unresolved().includes_if_function()
+        || value.as_unresolved().includes_inherit_function()
+        || abstract_element.document().get_registered_custom_property(name).has_value())
+        return compute_value_of_custom_property(abstract_element, name);
+
+    auto& resolutions = m_custom_property_resolutions.ensure(&value, [&] {
+        CustomPropertyResolutions resolutions { .value = value, .referenced_custom_properties = {}, .resolved_values = {} };
+        Vector<FlyString> referenced_custom_properties;
+        if (collect_custom_properties_referenced_by_var(value.as_unresolved().values(), referenced_custom_properties))
+            resolutions.referenced_custom_properties = move(referenced_custom_properties);
+        return resolutions;
+    });
+
+    // If the value refers to any custom property declared on the element itself, its resolution is specific to it.
+    if (!resolutions.referenced_custom_properties.has_value())
+        return compute_value_of_custom_property(abstract_element, name);
+    for (auto const& referenced_name : *resolutions.referenced_custom_properties) {
+        if (data.own_values().contains(referenced_name))
+            return compute_value_of_custom_property(abstract_element, name);
+    }
+
+    auto inherited_data = data.parent();
+    if (auto it = resolutions.resolved_values.find(inherited_data.ptr()); it != resolutions.resolved_values.end())
+        return it->value.resolved_value;
+
+    auto resolved_value = compute_value_of_custom_property(abstract_element, name);
+    resolutions.resolved_values.set(inherited_data.ptr(), ResolvedCustomPropertyValue { inherited_data, resolved_value });
+    return resolved_value;
+}
+
 static CSSPixels line_width_keyword_to_css_pixels(Keyword keyword)
 {
     // https://drafts.csswg.org/css-backgrounds/#typedef-line-width
@@ -2916,6 +3092,17 @@ void StyleComputer::pop_ancestor(DOM::Element const& element)
     for_each_element_hash(element, [&](u32 hash) {
         m_ancestor_filter->decrement(hash);
     });
+
+    // NB: Once we leave an element, its children may change before we see them again.
+    if (m_style_sharing_enabled)
+        m_style_sharing_candidates.remove(&element);
+}
+
+void StyleComputer::set_style_sharing_enabled(bool enabled)
+{
+    m_style_sharing_enabled = enabled;
+    m_style_sharing_candidates.clear();
+    m_custom_property_resolutions.clear();
 }
 
 void RuleCache::add_rule(MatchingRule const& matching_rule, Optional<PseudoElement> pseudo_element, bool contains_root_pseudo_class)
@@ -2987,6 +3174,13 @@ void RuleCache::add_rule(MatchingRule const& matching_rule, Optional<PseudoEleme
                 return;
             }
         }
+        // NOTE: Selectors like `:is/where([foo])` are bucketed as attribute selectors for `foo`.
+        for (auto const& simple_selector : matching_rule.selector.compound_selectors().last().simple_selectors) {
+            if (auto simplified = is_roundabout_selector_bucketable_as_something_simpler(simple_selector); simplified.has_value() && simplified->type == Selector::SimpleSelector::Type::Attribute) {
+                rules_by_attribute_name.ensure(simplified->name).append(matching_rule);
+                return;
+            }
+        }
         other_rules.append(matching_rule);
     }
 }
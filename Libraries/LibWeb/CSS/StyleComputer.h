@@ -15,6 +15,7 @@
 #include <LibWeb/CSS/CSSKeyframesRule.h>
 #include <LibWeb/CSS/CSSStyleDeclaration.h>
 #include <LibWeb/CSS/CascadeOrigin.h>
+#include <LibWeb/CSS/CustomPropertyData.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/CSS/StyleInvalidationData.h>
@@ -99,6 +100,10 @@ public:
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
+    // While enabled, elements may reuse the matching rules of a preceding sibling instead of running selector matching
+    // again. This is only safe during a tree traversal that pushes each element as an ancestor before its children.
+    void set_style_sharing_enabled(bool);
+
     [[nodiscard]] GC::Ref<ComputedProperties> create_document_style() const;
 
     [[nodiscard]] GC::Ref<ComputedProperties> compute_style(DOM::AbstractElement, Optional<bool&> did_change_custom_properties = {}) const;
@@ -109,6 +114,7 @@ public:
 
     NonnullRefPtr<InvalidationPlan> invalidation_plan_for_properties(Vector<InvalidationSet::Property> const&, StyleScope const&) const;
     bool invalidation_property_used_in_has_selector(InvalidationSet::Property const&, StyleScope const&) const;
+    bool insertion_or_removal_may_affect_has_selectors(DOM::Node const& subtree_root, StyleScope const&) const;
 
     static CSSPixels default_user_font_size();
     static CSSPixels absolute_size_mapping(AbsoluteSize, CSSPixels default_font_size);
@@ -164,9 +170,20 @@ private:
 
     [[nodiscard]] MatchingRuleSet build_matching_rule_set(DOM::AbstractElement, PseudoClassBitmap& attempted_pseudo_class_matches, bool& did_match_any_pseudo_element_rules, ComputeStyleMode, StyleScope const&) const;
 
+    struct StyleSharingCandidate {
+        GC::Ref<DOM::Element const> element;
+        u64 rule_cache_generation { 0 };
+        MatchingRuleSet matching_rule_set;
+    };
+
+    [[nodiscard]] bool can_share_matching_rules(DOM::AbstractElement, StyleScope const&) const;
+    [[nodiscard]] Optional<MatchingRuleSet> matching_rule_set_shared_with_sibling(DOM::AbstractElement, StyleScope const&) const;
+    void remember_matching_rule_set_for_style_sharing(DOM::AbstractElement, StyleScope const&, MatchingRuleSet const&) const;
+
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_style_impl(DOM::AbstractElement, ComputeStyleMode, Optional<bool&> did_change_custom_properties, StyleScope const&) const;
     [[nodiscard]] GC::Ref<CascadedProperties> compute_cascaded_values(DOM::AbstractElement, bool did_match_any_pseudo_element_rules, ComputeStyleMode, MatchingRuleSet const&) const;
     void compute_custom_properties(ComputedProperties&, DOM::AbstractElement) const;
+    [[nodiscard]] NonnullRefPtr<StyleValue const> compute_value_of_own_custom_property(DOM::AbstractElement, CustomPropertyData const&, FlyString const& name, StyleValue const&) const;
     void start_needed_transitions(ComputedProperties const& old_style, ComputedProperties& new_style, DOM::AbstractElement) const;
     void resolve_effective_overflow_values(ComputedProperties&) const;
     void transform_box_type_if_needed(ComputedProperties&, DOM::AbstractElement) const;
@@ -210,6 +227,29 @@ private:
 
     OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
     OwnPtr<SelectorEngine::HasResultCache> m_has_result_cache;
+
+    // Scratch storage for the candidate rules of collect_matching_rules(), kept around so that its capacity can be
+    // reused for every element and cascade origin during a style update.
+    mutable Vector<MatchingRule const*> m_candidate_rules_scratch;
+
+    // The most recently styled eligible child of each ancestor on the current traversal path, keyed by that ancestor.
+    mutable HashMap<DOM::Element const*, StyleSharingCandidate> m_style_sharing_candidates;
+    bool m_style_sharing_enabled { false };
+
+    // A custom property whose value only refers to custom properties its element inherits resolves to the same value
+    // on every element that inherits the same custom property data, so we remember what it resolved to during a style
+    // update, keyed by the inherited data.
+    struct ResolvedCustomPropertyValue {
+        RefPtr<CustomPropertyData const> inherited_data;
+        NonnullRefPtr<StyleValue const> resolved_value;
+    };
+    struct CustomPropertyResolutions {
+        NonnullRefPtr<StyleValue const> value;
+        // The custom properties the value refers to with var(), or empty if we can't tell which ones those are.
+        Optional<Vector<FlyString>> referenced_custom_properties;
+        HashMap<CustomPropertyData const*, ResolvedCustomPropertyValue> resolved_values;
+    };
+    mutable HashMap<StyleValue const*, CustomPropertyResolutions> m_custom_property_resolutions;
 };
 
 inline bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
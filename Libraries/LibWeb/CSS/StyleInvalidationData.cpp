@@ -63,6 +63,62 @@ static void for_each_consecutive_simple_selector_group(Selector const& selector,
         callback(simple_selectors, combinator, is_rightmost);
 }
 
+static bool is_pseudo_class_tracked_for_has_invalidation(PseudoClass pseudo_class)
+{
+    return first_is_one_of(pseudo_class,
+        PseudoClass::Enabled,
+        PseudoClass::Disabled,
+        PseudoClass::Defined,
+        PseudoClass::PlaceholderShown,
+        PseudoClass::Checked,
+        PseudoClass::Required,
+        PseudoClass::Optional,
+        PseudoClass::Link,
+        PseudoClass::AnyLink,
+        PseudoClass::LocalLink,
+        PseudoClass::Default);
+}
+
+// Inserting or removing a subtree can only change the result of a relative selector like `.a > .b` if one of the
+// elements in that subtree matches one of its compound selectors, as long as every compound contains an id, class, tag
+// name or attribute, and nothing in it depends on the element's position among its siblings.
+static void check_whether_has_argument_depends_on_any_element(Selector const& relative_selector, StyleInvalidationData& style_invalidation_data)
+{
+    auto simple_selector_names_element = [](Selector::SimpleSelector const& simple_selector) {
+        return first_is_one_of(simple_selector.type,
+            Selector::SimpleSelector::Type::Id,
+            Selector::SimpleSelector::Type::Class,
+            Selector::SimpleSelector::Type::TagName,
+            Selector::SimpleSelector::Type::Attribute);
+    };
+
+    for (auto const& compound_selector : relative_selector.compound_selectors()) {
+        if (first_is_one_of(compound_selector.combinator, Selector::Combinator::NextSibling, Selector::Combinator::SubsequentSibling, Selector::Combinator::Column)) {
+            style_invalidation_data.has_selectors_may_depend_on_any_element = true;
+            return;
+        }
+
+        bool names_element = false;
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            if (simple_selector_names_element(simple_selector)) {
+                names_element = true;
+                continue;
+            }
+            if (simple_selector.type == Selector::SimpleSelector::Type::Universal)
+                continue;
+            if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass && is_pseudo_class_tracked_for_has_invalidation(simple_selector.pseudo_class().type))
+                continue;
+            style_invalidation_data.has_selectors_may_depend_on_any_element = true;
+            return;
+        }
+
+        if (!names_element) {
+            style_invalidation_data.has_selectors_may_depend_on_any_element = true;
+            return;
+        }
+    }
+}
+
 static void collect_properties_used_in_has(Selector::SimpleSelector const& selector, StyleInvalidationData& style_invalidation_data, bool in_has)
 {
     switch (selector.type) {
@@ -88,23 +144,11 @@ static void collect_properties_used_in_has(Selector::SimpleSelector const& selec
     }
     case Selector::SimpleSelector::Type::PseudoClass: {
         auto const& pseudo_class = selector.pseudo_class();
-        switch (pseudo_class.type) {
-        case PseudoClass::Enabled:
-        case PseudoClass::Disabled:
-        case PseudoClass::Defined:
-        case PseudoClass::PlaceholderShown:
-        case PseudoClass::Checked:
-        case PseudoClass::Required:
-        case PseudoClass::Optional:
-        case PseudoClass::Link:
-        case PseudoClass::AnyLink:
-        case PseudoClass::LocalLink:
-        case PseudoClass::Default:
-            if (in_has)
-                style_invalidation_data.pseudo_classes_used_in_has_selectors.set(pseudo_class.type);
-            break;
-        default:
-            break;
+        if (in_has && is_pseudo_class_tracked_for_has_invalidation(pseudo_class.type))
+            style_invalidation_data.pseudo_classes_used_in_has_selectors.set(pseudo_class.type);
+        if (pseudo_class.type == PseudoClass::Has) {
+            for (auto const& child_selector : pseudo_class.argument_selector_list)
+                check_whether_has_argument_depends_on_any_element(*child_selector, style_invalidation_data);
         }
         for (auto const& child_selector : pseudo_class.argument_selector_list) {
             for (auto const& compound_selector : child_selector->compound_selectors()) {
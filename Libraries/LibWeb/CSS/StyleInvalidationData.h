@@ -70,6 +70,10 @@ struct StyleInvalidationData {
     HashTable<FlyString> tag_names_used_in_has_selectors;
     HashTable<PseudoClass> pseudo_classes_used_in_has_selectors;
 
+    // Set if inserting or removing an element could change the result of a :has() selector even if none of the ids,
+    // classes, attribute names and tag names above are involved, e.g. `:has(> :first-child)` or `:has(+ *)`.
+    bool has_selectors_may_depend_on_any_element { false };
+
     void build_invalidation_sets_for_selector(Selector const& selector);
 };
 
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/GenericShorthands.h>
 #include <LibCore/ReportTime.h>
 #include <LibWeb/CSS/CSSImportRule.h>
 #include <LibWeb/CSS/CSSKeyframesRule.h>
@@ -94,6 +95,7 @@ void StyleScope::build_rule_cache()
 
     m_selector_insights = make<SelectorInsights>();
     m_style_invalidation_data = make<StyleInvalidationData>();
+    ++m_rule_cache_generation;
 
     if (auto user_style_source = document().page().user_style(); user_style_source.has_value()) {
         m_user_style_sheet = GC::make_root(parse_css_stylesheet(CSS::Parser::ParsingParams(document()), user_style_source.value()));
@@ -111,6 +113,34 @@ void StyleScope::build_rule_cache()
     make_rule_cache_for_cascade_origin(CascadeOrigin::Author, *m_selector_insights);
     make_rule_cache_for_cascade_origin(CascadeOrigin::User, *m_selector_insights);
     make_rule_cache_for_cascade_origin(CascadeOrigin::UserAgent, *m_selector_insights);
+
+    if constexpr (LIBWEB_CSS_DEBUG) {
+        // NB: Rules in the fallback bucket are tried against every element, so we want to keep an eye on its size.
+        auto dump_bucket_sizes = [](StringView name, RuleCaches const& rule_caches) {
+            size_t by_id = 0, by_class = 0, by_tag_name = 0, by_attribute_name = 0, by_pseudo_element = 0, fallback = 0;
+            auto count = [&](RuleCache const& rule_cache) {
+                for (auto const& it : rule_cache.rules_by_id)
+                    by_id += it.value.size();
+                for (auto const& it : rule_cache.rules_by_class)
+                    by_class += it.value.size();
+                for (auto const& it : rule_cache.rules_by_tag_name)
+                    by_tag_name += it.value.size();
+                for (auto const& it : rule_cache.rules_by_attribute_name)
+                    by_attribute_name += it.value.size();
+                for (auto const& rules : rule_cache.rules_by_pseudo_element)
+                    by_pseudo_element += rules.size();
+                fallback += rule_cache.other_rules.size();
+            };
+            count(rule_caches.main);
+            for (auto const& it : rule_caches.by_layer)
+                count(*it.value);
+            dbgln("{} rule cache: {} by id, {} by class, {} by tag name, {} by attribute name, {} by pseudo-element, {} in the fallback bucket",
+                name, by_id, by_class, by_tag_name, by_attribute_name, by_pseudo_element, fallback);
+        };
+        dump_bucket_sizes("Author"sv, *m_author_rule_cache);
+        dump_bucket_sizes("User"sv, *m_user_rule_cache);
+        dump_bucket_sizes("User agent"sv, *m_user_agent_rule_cache);
+    }
 }
 
 void StyleScope::invalidate_rule_cache()
@@ -353,6 +383,8 @@ void StyleScope::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin
 void StyleScope::collect_selector_insights(Selector const& selector, SelectorInsights& insights)
 {
     for (auto const& compound_selector : selector.compound_selectors()) {
+        if (first_is_one_of(compound_selector.combinator, Selector::Combinator::NextSibling, Selector::Combinator::SubsequentSibling))
+            insights.has_sibling_combinators = true;
         for (auto const& simple_selector : compound_selector.simple_selectors) {
             if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass) {
                 if (simple_selector.pseudo_class().type == PseudoClass::Has) {
@@ -462,6 +494,12 @@ bool StyleScope::have_has_selectors() const
     return m_selector_insights->has_has_selectors;
 }
 
+bool StyleScope::have_sibling_combinators() const
+{
+    build_rule_cache_if_needed();
+    return m_selector_insights->has_sibling_combinators;
+}
+
 DOM::Document& StyleScope::document() const
 {
     return m_node->document();
@@ -44,10 +44,11 @@ struct MatchingRule {
 };
 
 struct RuleCache {
-    HashMap<FlyString, Vector<MatchingRule>> rules_by_id;
-    HashMap<FlyString, Vector<MatchingRule>> rules_by_class;
-    HashMap<FlyString, Vector<MatchingRule>> rules_by_tag_name;
-    HashMap<FlyString, Vector<MatchingRule>, AK::ASCIICaseInsensitiveFlyStringTraits> rules_by_attribute_name;
+    // NB: These are looked up for every element we compute the style of, mostly with names that aren't in them.
+    GroupedHashMap<FlyString, Vector<MatchingRule>> rules_by_id;
+    GroupedHashMap<FlyString, Vector<MatchingRule>> rules_by_class;
+    GroupedHashMap<FlyString, Vector<MatchingRule>> rules_by_tag_name;
+    GroupedHashMap<FlyString, Vector<MatchingRule>, AK::ASCIICaseInsensitiveFlyStringTraits> rules_by_attribute_name;
     Array<Vector<MatchingRule>, to_underlying(CSS::PseudoElement::KnownPseudoElementCount)> rules_by_pseudo_element;
     Vector<MatchingRule> root_rules;
     Vector<MatchingRule> slotted_rules;
@@ -71,6 +72,7 @@ struct RuleCaches {
 
 struct SelectorInsights {
     bool has_has_selectors { false };
+    bool has_sibling_combinators { false };
 };
 
 class StyleScope {
@@ -102,6 +104,10 @@ public:
 
     [[nodiscard]] bool may_have_has_selectors() const;
     [[nodiscard]] bool have_has_selectors() const;
+    [[nodiscard]] bool have_sibling_combinators() const;
+
+    // Incremented whenever the rule caches are rebuilt, which invalidates any MatchingRule pointer into them.
+    [[nodiscard]] u64 rule_cache_generation() const { return m_rule_cache_generation; }
 
     void for_each_active_css_style_sheet(Function<void(CSS::CSSStyleSheet&)> const& callback) const;
 
@@ -124,6 +130,8 @@ public:
     GC::WeakHashSet<DOM::Node> m_pending_nodes_for_style_invalidation_due_to_presence_of_has;
 
     GC::Ref<DOM::Node> m_node;
+
+    u64 m_rule_cache_generation { 0 };
 };
 
 }
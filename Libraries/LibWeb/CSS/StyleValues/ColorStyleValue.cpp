@@ -21,13 +21,8 @@ namespace Web::CSS {
 
 ValueComparingNonnullRefPtr<ColorStyleValue const> ColorStyleValue::create_from_color(Color color, ColorSyntax color_syntax, Optional<FlyString> name)
 {
-    return RGBColorStyleValue::create(
-        NumberStyleValue::create(color.red()),
-        NumberStyleValue::create(color.green()),
-        NumberStyleValue::create(color.blue()),
-        NumberStyleValue::create(color.alpha() / 255.0),
-        color_syntax,
-        name);
+    // OPTIMIZATION: Colors like these repeat all over stylesheets, so they are interned.
+    return RGBColorStyleValue::create_interned(color, color_syntax, move(name));
 }
 
 Optional<double> ColorStyleValue::resolve_hue(StyleValue const& style_value, CalculationResolutionContext const& resolution_context)
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <LibWeb/CSS/StyleValues/StyleValue.h>
+#include <LibWeb/CSS/StyleValues/StyleValueInternTable.h>
 
 namespace Web::CSS {
 
@@ -14,8 +15,9 @@ class IntegerStyleValue final : public StyleValue {
 public:
     static ValueComparingNonnullRefPtr<IntegerStyleValue const> create(i32 value)
     {
-        return adopt_ref(*new (nothrow) IntegerStyleValue(value));
+        return InternTable::the().ensure(value, [value] { return adopt_ref(*new (nothrow) IntegerStyleValue(value)); });
     }
+    virtual ~IntegerStyleValue() override { InternTable::the().remove(m_value, *this); }
 
     i32 integer() const { return m_value; }
 
@@ -34,6 +36,8 @@ public:
     virtual bool is_computationally_independent() const override { return true; }
 
 private:
+    using InternTable = StyleValueInternTable<i32, IntegerStyleValue>;
+
     explicit IntegerStyleValue(i32 value)
         : StyleValue(Type::Integer)
         , m_value(value)
@@ -19,6 +19,22 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<KeywordStyleValue const> KeywordStyleValue::create(Keyword keyword)
+{
+    // OPTIMIZATION: A keyword is all there is to a KeywordStyleValue, so every keyword has a single instance that is
+    //               created the first time it is needed, and shared by every use of it from then on.
+    static Vector<RefPtr<KeywordStyleValue const>> instances;
+
+    auto index = to_underlying(keyword);
+    if (index >= instances.size())
+        instances.resize(index + 1);
+
+    auto& instance = instances[index];
+    if (!instance)
+        instance = adopt_ref(*new (nothrow) KeywordStyleValue(keyword));
+    return *instance;
+}
+
 void KeywordStyleValue::serialize(StringBuilder& builder, SerializationMode) const
 {
     builder.append(string_from_keyword(keyword()));
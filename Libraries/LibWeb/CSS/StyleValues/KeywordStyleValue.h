@@ -16,33 +16,7 @@ namespace Web::CSS {
 
 class KeywordStyleValue : public StyleValueWithDefaultOperators<KeywordStyleValue> {
 public:
-    static ValueComparingNonnullRefPtr<KeywordStyleValue const> create(Keyword keyword)
-    {
-        switch (keyword) {
-        case Keyword::Inherit: {
-            static ValueComparingNonnullRefPtr<KeywordStyleValue const> const inherit_instance = adopt_ref(*new (nothrow) KeywordStyleValue(Keyword::Inherit));
-            return inherit_instance;
-        }
-        case Keyword::Initial: {
-            static ValueComparingNonnullRefPtr<KeywordStyleValue const> const initial_instance = adopt_ref(*new (nothrow) KeywordStyleValue(Keyword::Initial));
-            return initial_instance;
-        }
-        case Keyword::Revert: {
-            static ValueComparingNonnullRefPtr<KeywordStyleValue const> const revert_instance = adopt_ref(*new (nothrow) KeywordStyleValue(Keyword::Revert));
-            return revert_instance;
-        }
-        case Keyword::RevertLayer: {
-            static ValueComparingNonnullRefPtr<KeywordStyleValue const> const revert_layer_instance = adopt_ref(*new (nothrow) KeywordStyleValue(Keyword::RevertLayer));
-            return revert_layer_instance;
-        }
-        case Keyword::Unset: {
-            static ValueComparingNonnullRefPtr<KeywordStyleValue const> const unset_instance = adopt_ref(*new (nothrow) KeywordStyleValue(Keyword::Unset));
-            return unset_instance;
-        }
-        default:
-            return adopt_ref(*new (nothrow) KeywordStyleValue(keyword));
-        }
-    }
+    static ValueComparingNonnullRefPtr<KeywordStyleValue const> create(Keyword);
     virtual ~KeywordStyleValue() override = default;
 
     Keyword keyword() const { return m_keyword; }
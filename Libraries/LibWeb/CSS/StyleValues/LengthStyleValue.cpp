@@ -13,17 +13,14 @@ namespace Web::CSS {
 
 ValueComparingNonnullRefPtr<LengthStyleValue const> LengthStyleValue::create(Length const& length)
 {
-    if (length.is_px()) {
-        if (length.raw_value() == 0) {
-            static auto value = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(0)));
-            return value;
-        }
-        if (length.raw_value() == 1) {
-            static auto value = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(1)));
-            return value;
-        }
-    }
-    return adopt_ref(*new (nothrow) LengthStyleValue(length));
+    // OPTIMIZATION: Stylesheets and absolutized values repeat the same few lengths over and over, so they share a single
+    //               instance for as long as one is in use.
+    return InternTable::the().ensure(intern_key(length), [&length] { return adopt_ref(*new (nothrow) LengthStyleValue(length)); });
+}
+
+LengthStyleValue::~LengthStyleValue()
+{
+    InternTable::the().remove(intern_key(m_length), *this);
 }
 
 ValueComparingNonnullRefPtr<StyleValue const> LengthStyleValue::absolutized(ComputationContext const& computation_context) const
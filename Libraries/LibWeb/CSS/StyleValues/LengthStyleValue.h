@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <AK/BitCast.h>
 #include <LibWeb/CSS/Length.h>
 #include <LibWeb/CSS/StyleValues/DimensionStyleValue.h>
+#include <LibWeb/CSS/StyleValues/StyleValueInternTable.h>
 #include <LibWeb/Export.h>
 
 namespace Web::CSS {
@@ -18,7 +20,7 @@ namespace Web::CSS {
 class WEB_API LengthStyleValue final : public DimensionStyleValue {
 public:
     static ValueComparingNonnullRefPtr<LengthStyleValue const> create(Length const&);
-    virtual ~LengthStyleValue() override = default;
+    virtual ~LengthStyleValue() override;
 
     Length const& length() const { return m_length; }
     virtual double raw_value() const override { return m_length.raw_value(); }
@@ -32,6 +34,20 @@ public:
     bool equals(StyleValue const& other) const override;
 
 private:
+    // NB: Lengths are interned by the bits of their value, so that NaN can be found again and -0 stays distinct from 0.
+    struct InternKey {
+        u64 value_bits { 0 };
+        LengthUnit unit;
+
+        bool operator==(InternKey const&) const = default;
+    };
+    struct InternKeyTraits : public DefaultTraits<InternKey> {
+        static unsigned hash(InternKey const& key) { return pair_int_hash(u64_hash(key.value_bits), to_underlying(key.unit)); }
+    };
+    using InternTable = StyleValueInternTable<InternKey, LengthStyleValue, InternKeyTraits>;
+
+    static InternKey intern_key(Length const& length) { return { bit_cast<u64>(length.raw_value()), length.unit() }; }
+
     explicit LengthStyleValue(Length const& length)
         : DimensionStyleValue(Type::Length)
         , m_length(length)
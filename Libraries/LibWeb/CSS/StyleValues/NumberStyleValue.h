@@ -9,7 +9,9 @@
 
 #pragma once
 
+#include <AK/BitCast.h>
 #include <LibWeb/CSS/StyleValues/StyleValue.h>
+#include <LibWeb/CSS/StyleValues/StyleValueInternTable.h>
 
 namespace Web::CSS {
 
@@ -17,8 +19,9 @@ class NumberStyleValue final : public StyleValue {
 public:
     static ValueComparingNonnullRefPtr<NumberStyleValue const> create(double value)
     {
-        return adopt_ref(*new (nothrow) NumberStyleValue(value));
+        return InternTable::the().ensure(bit_cast<u64>(value), [value] { return adopt_ref(*new (nothrow) NumberStyleValue(value)); });
     }
+    virtual ~NumberStyleValue() override { InternTable::the().remove(bit_cast<u64>(m_value), *this); }
 
     double number() const { return m_value; }
 
@@ -37,6 +40,9 @@ public:
     virtual bool is_computationally_independent() const override { return true; }
 
 private:
+    // NB: Numbers are interned by their bits, so that NaN can be found again and -0 stays distinct from 0.
+    using InternTable = StyleValueInternTable<u64, NumberStyleValue>;
+
     explicit NumberStyleValue(double value)
         : StyleValue(Type::Number)
         , m_value(value)
@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <AK/BitCast.h>
 #include <LibWeb/CSS/Percentage.h>
 #include <LibWeb/CSS/StyleValues/DimensionStyleValue.h>
+#include <LibWeb/CSS/StyleValues/StyleValueInternTable.h>
 
 namespace Web::CSS {
 
@@ -18,9 +20,9 @@ class PercentageStyleValue final : public DimensionStyleValue {
 public:
     static ValueComparingNonnullRefPtr<PercentageStyleValue const> create(Percentage percentage)
     {
-        return adopt_ref(*new (nothrow) PercentageStyleValue(move(percentage)));
+        return InternTable::the().ensure(bit_cast<u64>(percentage.value()), [&percentage] { return adopt_ref(*new (nothrow) PercentageStyleValue(move(percentage))); });
     }
-    virtual ~PercentageStyleValue() override = default;
+    virtual ~PercentageStyleValue() override { InternTable::the().remove(bit_cast<u64>(m_percentage.value()), *this); }
 
     Percentage const& percentage() const { return m_percentage; }
     virtual double raw_value() const override { return m_percentage.value(); }
@@ -39,6 +41,8 @@ public:
     virtual bool is_computationally_independent() const override { return true; }
 
 private:
+    using InternTable = StyleValueInternTable<u64, PercentageStyleValue>;
+
     PercentageStyleValue(Percentage&& percentage)
         : DimensionStyleValue(Type::Percentage)
         , m_percentage(percentage)
@@ -14,6 +14,28 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<RGBColorStyleValue const> RGBColorStyleValue::create_interned(Color color, ColorSyntax color_syntax, Optional<FlyString> name)
+{
+    InternKey key { color, color_syntax, move(name) };
+    return InternTable::the().ensure(key, [&key] {
+        auto value = adopt_ref(*new (nothrow) RGBColorStyleValue(
+            NumberStyleValue::create(key.color.red()),
+            NumberStyleValue::create(key.color.green()),
+            NumberStyleValue::create(key.color.blue()),
+            NumberStyleValue::create(key.color.alpha() / 255.0),
+            key.color_syntax,
+            key.name));
+        value->m_interned_color = key.color;
+        return value;
+    });
+}
+
+RGBColorStyleValue::~RGBColorStyleValue()
+{
+    if (m_interned_color.has_value())
+        InternTable::the().remove({ *m_interned_color, color_syntax(), m_properties.name }, *this);
+}
+
 Optional<Color> RGBColorStyleValue::to_color(ColorResolutionContext color_resolution_context) const
 {
     auto resolve_rgb_to_u8 = [&color_resolution_context](StyleValue const& style_value) -> Optional<u8> {
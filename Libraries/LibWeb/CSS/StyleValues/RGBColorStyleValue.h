@@ -9,6 +9,7 @@
 #include <LibWeb/CSS/StyleValues/ColorStyleValue.h>
 #include <LibWeb/CSS/StyleValues/ComputationContext.h>
 #include <LibWeb/CSS/StyleValues/NumberStyleValue.h>
+#include <LibWeb/CSS/StyleValues/StyleValueInternTable.h>
 
 namespace Web::CSS {
 
@@ -22,7 +23,12 @@ public:
 
         return adopt_ref(*new (nothrow) RGBColorStyleValue(move(r), move(g), move(b), alpha.release_nonnull(), color_syntax, name));
     }
-    virtual ~RGBColorStyleValue() override = default;
+
+    // Returns the instance that is shared by every use of a color that is fully known when parsing, like hex and named
+    // colors.
+    static ValueComparingNonnullRefPtr<RGBColorStyleValue const> create_interned(Color, ColorSyntax, Optional<FlyString> name);
+
+    virtual ~RGBColorStyleValue() override;
 
     StyleValue const& r() const { return *m_properties.r; }
     StyleValue const& g() const { return *m_properties.g; }
@@ -45,6 +51,24 @@ public:
     }
 
 private:
+    struct InternKey {
+        Color color;
+        ColorSyntax color_syntax;
+        Optional<FlyString> name;
+
+        bool operator==(InternKey const&) const = default;
+    };
+    struct InternKeyTraits : public DefaultTraits<InternKey> {
+        static unsigned hash(InternKey const& key)
+        {
+            auto hash = pair_int_hash(key.color.value(), to_underlying(key.color_syntax));
+            if (key.name.has_value())
+                hash = pair_int_hash(hash, key.name->hash());
+            return hash;
+        }
+    };
+    using InternTable = StyleValueInternTable<InternKey, RGBColorStyleValue, InternKeyTraits>;
+
     RGBColorStyleValue(ValueComparingNonnullRefPtr<StyleValue const> r, ValueComparingNonnullRefPtr<StyleValue const> g, ValueComparingNonnullRefPtr<StyleValue const> b, ValueComparingNonnullRefPtr<StyleValue const> alpha, ColorSyntax color_syntax, Optional<FlyString> name = {})
         : ColorStyleValue(ColorType::RGB, color_syntax)
         , m_properties { .r = move(r), .g = move(g), .b = move(b), .alpha = move(alpha), .name = name }
@@ -59,6 +83,9 @@ private:
         Optional<FlyString> name;
         bool operator==(Properties const&) const = default;
     } m_properties;
+
+    // The color this was interned as, if it was.
+    Optional<Color> m_interned_color;
 };
 
 }
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/ValueComparingRefPtr.h>
+
+namespace Web::CSS {
+
+// Hash-conses immutable style values: while a value exists for a key, creating a value for that key again returns the
+// existing instance. Repeated values then share their memory, and comparing them is usually a pointer comparison.
+//
+// The table does not keep its values alive, so every value that is interned must remove itself when it is destroyed.
+template<typename Key, typename T, typename KeyTraits = Traits<Key>>
+class StyleValueInternTable {
+    AK_MAKE_NONCOPYABLE(StyleValueInternTable);
+    AK_MAKE_NONMOVABLE(StyleValueInternTable);
+
+public:
+    static StyleValueInternTable& the()
+    {
+        // NB: The table is never destroyed, as values held by other statics may still remove themselves at exit.
+        static auto& table = *new StyleValueInternTable;
+        return table;
+    }
+
+    template<typename Callback>
+    ValueComparingNonnullRefPtr<T const> ensure(Key const& key, Callback create)
+    {
+        if (auto it = m_values.find(key); it != m_values.end())
+            return *it->value;
+
+        // NB: The returned iterator is not kept across creating the value, as that may intern or destroy other values.
+        ValueComparingNonnullRefPtr<T const> value = create();
+        m_values.set(key, value.ptr());
+        return value;
+    }
+
+    void remove(Key const& key, T const& value)
+    {
+        if (auto it = m_values.find(key); it != m_values.end() && it->value == &value)
+            m_values.remove(it);
+    }
+
+private:
+    StyleValueInternTable() = default;
+
+    HashMap<Key, T const*, KeyTraits> m_values;
+};
+
+}
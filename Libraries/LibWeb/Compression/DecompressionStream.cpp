@@ -22,6 +22,8 @@ namespace Web::Compression {
 
 GC_DEFINE_ALLOCATOR(DecompressionStream);
 
+static constexpr size_t decompressed_piece_size = 64 * KiB;
+
 // https://compression.spec.whatwg.org/#dom-decompressionstream-decompressionstream
 WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct_impl(JS::Realm& realm, Bindings::CompressionFormat format)
 {
@@ -115,31 +117,46 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::
 
     // 2. Let buffer be the result of decompressing chunk with ds's format and context. If this results in an error,
     //    then throw a TypeError.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
+    auto maybe_written = [&]() -> ErrorOr<void> {
         auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
         TRY(m_input_stream->write_until_depleted(move(chunk_buffer)));
-
-        auto decompressed = TRY(ByteBuffer::create_uninitialized(4096));
-        auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
-            return TRY(decompressor->read_some(decompressed.bytes())).size();
-        }));
-        return decompressed.slice(0, size);
+        return {};
     }();
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", maybe_buffer.error())) };
-
-    auto buffer = maybe_buffer.release_value();
+    if (maybe_written.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", maybe_written.error())) };
 
     // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
     // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
     // 5. For each Uint8Array array, enqueue array in ds's transform.
-    m_transform->enqueue(array);
+    // NB: We decompress straight into the buffers of the pieces rather than into one buffer that we split afterwards.
+    //     This way, all of the chunk's output is enqueued right away, instead of only what fits into a single buffer
+    //     with the rest being held back until the stream is flushed.
+    while (true) {
+        auto maybe_piece = [&]() -> ErrorOr<ByteBuffer> {
+            auto piece = TRY(ByteBuffer::create_uninitialized(decompressed_piece_size));
+            auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
+                return TRY(decompressor->read_some_of_available_input(piece.bytes())).size();
+            }));
+
+            // NB: Don't keep a mostly unused buffer alive for as long as the piece is.
+            if (size < decompressed_piece_size / 2)
+                return ByteBuffer::copy(piece.bytes().trim(size));
+
+            piece.trim(size, false);
+            return piece;
+        }();
+        if (maybe_piece.is_error())
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", maybe_piece.error())) };
+
+        auto piece = maybe_piece.release_value();
+        if (piece.is_empty())
+            break;
+
+        auto array_buffer = JS::ArrayBuffer::create(realm, move(piece));
+        auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+        m_transform->enqueue(array);
+    }
+
     return {};
 }
 
@@ -273,6 +273,16 @@ static WebIDL::ExceptionOr<void> validate_jwk_key_ops(JS::Realm& realm, Bindings
     return {};
 }
 
+// Performs an operation that could have been performed on the thread pool right away, for callers that need its result
+// as part of a larger operation.
+static WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> perform_background_operation(JS::Realm& realm, BackgroundOperation const& operation)
+{
+    auto result = operation();
+    if (result.is_error())
+        return WebIDL::OperationError::create(realm, result.release_error());
+    return JS::ArrayBuffer::create(realm, result.release_value());
+}
+
 static WebIDL::ExceptionOr<ByteBuffer> generate_random_key(JS::VM& vm, u16 const size_in_bits)
 {
     auto key_buffer = TRY_OR_THROW_OOM(vm, ByteBuffer::create_uninitialized(size_in_bits / 8));
@@ -3810,7 +3820,7 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> HKDF::import_key(AlgorithmParams const&,
 }
 
 // https://w3c.github.io/webcrypto/#sha-operations-digest
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+WebIDL::ExceptionOr<BackgroundOperation> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer data)
 {
     auto& algorithm_name = algorithm.name;
 
@@ -3833,15 +3843,17 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const&
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", algorithm_name));
     }
 
-    ::Crypto::Hash::Manager hash { hash_kind };
-    hash.update(data);
+    return BackgroundOperation { [hash_kind, data = move(data)] -> ErrorOr<ByteBuffer, Utf16String> {
+        ::Crypto::Hash::Manager hash { hash_kind };
+        hash.update(data);
 
-    auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
-    if (result_buffer.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to create result buffer"_utf16);
+        auto digest = hash.digest();
+        auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+        if (result_buffer.is_error())
+            return "Failed to create result buffer"_utf16;
 
-    return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
+        return result_buffer.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#ecdsa-operations-generate-key
@@ -6937,6 +6949,12 @@ WebIDL::ExceptionOr<JS::Value> HKDF::get_key_length(AlgorithmParams const&)
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations-derive-bits
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+{
+    auto operation = TRY(derive_bits_in_background(params, key, length_optional));
+    return perform_background_operation(m_realm, *operation);
+}
+
+WebIDL::ExceptionOr<Optional<BackgroundOperation>> PBKDF2::derive_bits_in_background(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
 {
     auto& realm = *m_realm;
     auto const& normalized_algorithm = static_cast<PBKDF2Params const&>(params);
@@ -6975,15 +6993,17 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParam
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", hash_algorithm));
     }());
 
-    ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
-    auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+    return Optional<BackgroundOperation> { [hash_kind, password = move(password), salt = move(salt), iterations, derived_key_length_bytes] -> ErrorOr<ByteBuffer, Utf16String> {
+        ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
+        auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
 
-    // 5. If the key derivation operation fails, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(realm, "Failed to derive key"_utf16);
+        // 5. If the key derivation operation fails, then throw an OperationError.
+        if (maybe_result.is_error())
+            return "Failed to derive key"_utf16;
 
-    // 6. Return result
-    return JS::ArrayBuffer::create(realm, maybe_result.release_value());
+        // 6. Return result
+        return maybe_result.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations-get-key-length
@@ -9664,6 +9684,12 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> Argon2::import_key(AlgorithmParams const
 
 // https://wicg.github.io/webcrypto-modern-algos/#argon2-operations-derive-bits
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> Argon2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length)
+{
+    auto operation = TRY(derive_bits_in_background(params, key, length));
+    return perform_background_operation(m_realm, *operation);
+}
+
+WebIDL::ExceptionOr<Optional<BackgroundOperation>> Argon2::derive_bits_in_background(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length)
 {
     auto const& normalized_algorithm = static_cast<Argon2Params const&>(params);
     // 1. If length is null, or is less than 32 (4*8), then throw an OperationError.
@@ -9686,53 +9712,58 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> Argon2::derive_bits(AlgorithmParam
     if (normalized_algorithm.passes == 0)
         return WebIDL::OperationError::create(m_realm, "Invalid passes"_utf16);
 
-    auto const algorithm = [&]() {
+    auto const type = [&]() {
         // 6 => If the name member of normalizedAlgorithm is a case-sensitive string match for "Argon2d":
         //      Let type be 0.
         if (normalized_algorithm.name == "Argon2d")
-            return ::Crypto::Hash::Argon2(::Crypto::Hash::Argon2Type::Argon2d);
+            return ::Crypto::Hash::Argon2Type::Argon2d;
         //   => If the name member of normalizedAlgorithm is a case-sensitive string match for "Argon2i":
         //      Let type be 1.
         if (normalized_algorithm.name == "Argon2i")
-            return ::Crypto::Hash::Argon2(::Crypto::Hash::Argon2Type::Argon2i);
+            return ::Crypto::Hash::Argon2Type::Argon2i;
         //   => If the name member of normalizedAlgorithm is a case-sensitive string match for "Argon2id":
         //      Let type be 2.
         if (normalized_algorithm.name == "Argon2id")
-            return ::Crypto::Hash::Argon2(::Crypto::Hash::Argon2Type::Argon2id);
+            return ::Crypto::Hash::Argon2Type::Argon2id;
 
         VERIFY_NOT_REACHED();
     }();
 
     // 7. Let secretValue be the secretValue member of normalizedAlgorithm, if present.
-    auto const& secret_value = normalized_algorithm.secret_value;
+    auto secret_value = normalized_algorithm.secret_value;
 
     // 8. Let associatedData be the associatedData member of normalizedAlgorithm, if present.
-    auto const& associated_data = normalized_algorithm.associated_data;
-
-    // 9. Let result be the result of performing the Argon2 function defined in Section 3 of [RFC9106] using the
-    //    password represented by [[handle]] internal slot of key as the message, P, the nonce attribute of
-    //    normalizedAlgorithm as the nonce, S, the value of the parallelism attribute of normalizedAlgorithm as the
-    //    degree of parallelism, p, the value of the memory attribute of normalizedAlgorithm as the memory size, m, the
-    //    value of the passes attribute of normalizedAlgorithm as the number of passes, t, 0x13 as the version number,
-    //    v, secretValue (if present) as the secret value, K, associatedData (if present) as the associated data, X, type
-    //    as the type, y, and length divided by 8 as the tag length, T.
+    auto associated_data = normalized_algorithm.associated_data;
+
     VERIFY(key->handle().has<ByteBuffer>());
-    auto const maybe_result = algorithm.derive_key(
-        key->handle().get<ByteBuffer>(),
-        normalized_algorithm.nonce,
-        normalized_algorithm.parallelism,
-        normalized_algorithm.memory,
-        normalized_algorithm.passes,
-        0x13,
-        secret_value.map([](auto const& value) { return value.span(); }),
-        associated_data.map([](auto const& value) { return value.span(); }),
-        length.value() / 8);
-
-    // 10. If the key derivation operation fails, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(m_realm, Utf16String::formatted("Hashing function failed: {}", maybe_result.error()));
+    auto password = key->handle().get<ByteBuffer>();
 
-    return JS::ArrayBuffer::create(m_realm, maybe_result.value());
+    return Optional<BackgroundOperation> { [type, password = move(password), nonce = normalized_algorithm.nonce, parallelism = normalized_algorithm.parallelism, memory = normalized_algorithm.memory, passes = normalized_algorithm.passes, secret_value = move(secret_value), associated_data = move(associated_data), tag_length = length.value() / 8] -> ErrorOr<ByteBuffer, Utf16String> {
+        // 9. Let result be the result of performing the Argon2 function defined in Section 3 of [RFC9106] using the
+        //    password represented by [[handle]] internal slot of key as the message, P, the nonce attribute of
+        //    normalizedAlgorithm as the nonce, S, the value of the parallelism attribute of normalizedAlgorithm as the
+        //    degree of parallelism, p, the value of the memory attribute of normalizedAlgorithm as the memory size, m, the
+        //    value of the passes attribute of normalizedAlgorithm as the number of passes, t, 0x13 as the version number,
+        //    v, secretValue (if present) as the secret value, K, associatedData (if present) as the associated data, X, type
+        //    as the type, y, and length divided by 8 as the tag length, T.
+        auto const algorithm = ::Crypto::Hash::Argon2(type);
+        auto maybe_result = algorithm.derive_key(
+            password,
+            nonce,
+            parallelism,
+            memory,
+            passes,
+            0x13,
+            secret_value.map([](auto const& value) { return value.span(); }),
+            associated_data.map([](auto const& value) { return value.span(); }),
+            tag_length);
+
+        // 10. If the key derivation operation fails, then throw an OperationError.
+        if (maybe_result.is_error())
+            return Utf16String::formatted("Hashing function failed: {}", maybe_result.error());
+
+        return maybe_result.release_value();
+    } };
 }
 
 // https://wicg.github.io/webcrypto-modern-algos/#argon2-operations-get-key-length
@@ -9743,46 +9774,49 @@ WebIDL::ExceptionOr<JS::Value> Argon2::get_key_length(AlgorithmParams const&)
 }
 
 // https://wicg.github.io/webcrypto-modern-algos/#cshake-operations-digest
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> CShake::digest(AlgorithmParams const& params, ByteBuffer const& data)
+WebIDL::ExceptionOr<BackgroundOperation> CShake::digest(AlgorithmParams const& params, ByteBuffer data)
 {
     auto const& normalized_algorithm = static_cast<CShakeParams const&>(params);
 
     // 1. Let outputLength be the outputLength member of normalizedAlgorithm.
-    auto const& output_length = normalized_algorithm.output_length;
+    auto output_length = normalized_algorithm.output_length;
 
     // 2. Let functionName be the functionName member of normalizedAlgorithm if present or the empty octet string otherwise.
-    auto const& function_name = normalized_algorithm.function_name;
+    auto function_name = normalized_algorithm.function_name;
 
     // 3. Let customization be the customization member of normalizedAlgorithm if present or the empty octet string otherwise.
-    auto const& customization = normalized_algorithm.customization;
+    auto customization = normalized_algorithm.customization;
 
-    auto const algorithm = [&]() {
+    auto const kind = [&]() {
         // 4. If the name member of normalizedAlgorithm is a case-sensitive string match for "cSHAKE128":
         if (normalized_algorithm.name == "cSHAKE128"sv)
-            return ::Crypto::Hash::SHAKE(::Crypto::Hash::SHAKEKind::CSHAKE128);
+            return ::Crypto::Hash::SHAKEKind::CSHAKE128;
         // 4. If the name member of normalizedAlgorithm is a case-sensitive string match for "cSHAKE256":
         if (normalized_algorithm.name == "cSHAKE256"sv)
-            return ::Crypto::Hash::SHAKE(::Crypto::Hash::SHAKEKind::CSHAKE256);
+            return ::Crypto::Hash::SHAKEKind::CSHAKE256;
         VERIFY_NOT_REACHED();
     }();
 
-    // 4. Let result be the result of performing the cSHAKE128/cSHAKE256 function defined in Section 3 of [NIST-SP800-185]
-    // using message as the X input parameter,
-    // outputLength as the L input parameter,
-    // functionName as the N input parameter,
-    // and customization as the S input parameter.
-    auto maybe_result = algorithm.digest(
-        data,
-        output_length,
-        customization.map([](auto const& value) { return value.span(); }),
-        function_name.map([](auto const& value) { return value.span(); }));
-
-    // 5. If performing the operation results in an error, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(m_realm, Utf16String::formatted("Hash function failed: {}", maybe_result.error()));
+    return BackgroundOperation { [kind, data = move(data), output_length, function_name = move(function_name), customization = move(customization)] -> ErrorOr<ByteBuffer, Utf16String> {
+        // 4. Let result be the result of performing the cSHAKE128/cSHAKE256 function defined in Section 3 of [NIST-SP800-185]
+        // using message as the X input parameter,
+        // outputLength as the L input parameter,
+        // functionName as the N input parameter,
+        // and customization as the S input parameter.
+        auto const algorithm = ::Crypto::Hash::SHAKE(kind);
+        auto maybe_result = algorithm.digest(
+            data,
+            output_length,
+            customization.map([](auto const& value) { return value.span(); }),
+            function_name.map([](auto const& value) { return value.span(); }));
+
+        // 5. If performing the operation results in an error, then throw an OperationError.
+        if (maybe_result.is_error())
+            return Utf16String::formatted("Hash function failed: {}", maybe_result.error());
 
-    // 6. Return result.
-    return JS::ArrayBuffer::create(m_realm, maybe_result.release_value());
+        // 6. Return result.
+        return maybe_result.release_value();
+    } };
 }
 
 AeadParams::~AeadParams() = default;
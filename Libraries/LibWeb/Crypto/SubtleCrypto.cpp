@@ -8,10 +8,13 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/QuickSort.h>
+#include <LibCore/EventLoop.h>
 #include <LibCrypto/Hash/HashManager.h>
+#include <LibGC/Root.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SubtleCryptoPrototype.h>
@@ -30,6 +33,45 @@ static void normalize_key_usages(Vector<Bindings::KeyUsage>& key_usages)
 {
     quick_sort(key_usages);
 }
+
+// Performs the operation on the thread pool, then queues a global task on the crypto task source, given realm's global
+// object, to resolve promise with an ArrayBuffer containing the result, or to reject it with an OperationError.
+static void perform_on_thread_pool_and_settle_promise(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise, BackgroundOperation operation)
+{
+    struct PendingPromise {
+        GC::Root<JS::Realm> realm;
+        GC::Root<WebIDL::Promise> promise;
+    };
+
+    // NB: The roots are heap-allocated so that if the event loop is destroyed while the operation is running, we leak
+    //     them rather than destroying them on the worker thread.
+    auto* pending_promise = new PendingPromise { GC::make_root(realm), GC::make_root(promise) };
+    auto event_loop_weak = Core::EventLoop::current_weak();
+
+    Threading::ThreadPool::the().submit([operation = move(operation), pending_promise, event_loop_weak = move(event_loop_weak)]() mutable {
+        auto result = operation();
+        operation = nullptr;
+
+        auto origin = event_loop_weak->take();
+        if (!origin)
+            return;
+        origin->deferred_invoke([pending_promise, result = move(result)]() mutable {
+            auto& realm = *pending_promise->realm;
+            GC::Ref promise = *pending_promise->promise;
+            delete pending_promise;
+
+            HTML::queue_global_task(HTML::Task::Source::Crypto, realm.global_object(), GC::create_function(realm.heap(), [&realm, promise, result = move(result)]() mutable {
+                HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+                if (result.is_error()) {
+                    WebIDL::reject_promise(realm, promise, WebIDL::OperationError::create(realm, result.release_error()));
+                    return;
+                }
+                WebIDL::resolve_promise(realm, promise, JS::ArrayBuffer::create(realm, result.release_value()));
+            }));
+        });
+    });
+}
 struct RegisteredAlgorithm {
     NonnullOwnPtr<AlgorithmMethods> (*create_methods)(JS::Realm&) = nullptr;
     JS::ThrowCompletionOr<NonnullOwnPtr<AlgorithmParams>> (*parameter_from_value)(JS::VM&, JS::Value) = nullptr;
@@ -315,7 +357,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
     auto promise = WebIDL::create_promise(realm);
 
     // 7. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &global, &heap, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &global, &heap, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() mutable -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::No);
 
         // 8. If the following steps or referenced procedures say to throw an error, queue a global task on the
@@ -328,7 +370,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
         };
 
         // 9. Let digest be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
-        auto digest = algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer);
+        auto digest = algorithm_object.methods->digest(*algorithm_object.parameter, move(data_buffer));
 
         if (digest.is_exception()) {
             throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), digest.release_error()).release_value());
@@ -336,13 +378,10 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
         }
 
         // 10. Queue a global task on the crypto task source, given realm's global object, to perform the remaining steps.
-        HTML::queue_global_task(HTML::Task::Source::Crypto, global, GC::create_function(heap, [&realm, promise, digest_bytes = digest.release_value()] {
-            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-
-            // 11. Let result be the result of creating an ArrayBuffer in realm, containing digest.
-            // 12. Resolve promise with result.
-            WebIDL::resolve_promise(realm, promise, digest_bytes);
-        }));
+        // 11. Let result be the result of creating an ArrayBuffer in realm, containing digest.
+        // 12. Resolve promise with result.
+        // NB: Hashing large amounts of data takes a while, so the digest is computed on the thread pool.
+        perform_on_thread_pool_and_settle_promise(realm, promise, digest.release_value());
     }));
 
     return promise;
@@ -732,6 +771,17 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_bits(AlgorithmIdentifier algorithm
             return;
         }
 
+        // NB: Some key derivation functions are slow by design, so those derive the bits on the thread pool.
+        auto operation = normalized_algorithm.methods->derive_bits_in_background(*normalized_algorithm.parameter, base_key, length_optional);
+        if (operation.is_error()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), operation.release_error()).release_value());
+            return;
+        }
+        if (auto background_operation = operation.release_value(); background_operation.has_value()) {
+            perform_on_thread_pool_and_settle_promise(realm, promise, background_operation.release_value());
+            return;
+        }
+
         // 9. Let result be the result of creating an ArrayBuffer containing the result of performing the derive bits operation specified by normalizedAlgorithm using baseKey, algorithm and length.
         auto result = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
         if (result.is_error()) {
@@ -130,6 +130,9 @@ WebIDL::ExceptionOr<void> CharacterData::replace_data(size_t offset, size_t coun
     if (m_data == old_data)
         return {};
 
+    // NB: Whether a text node is exposed in the accessibility tree depends on whether it is only whitespace.
+    set_needs_accessibility_tree_update();
+
     // NB: Called during DOM text mutation, layout is stale.
     if (auto* text_node = as_if<Layout::TextNode>(unsafe_layout_node())) {
         // NOTE: Since the text node's data has changed, we need to invalidate the text for rendering.
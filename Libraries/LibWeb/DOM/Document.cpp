@@ -22,6 +22,7 @@
 #include <AK/Time.h>
 #include <AK/Utf8View.h>
 #include <LibCore/Timer.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/RootVector.h>
 #include <LibHTTP/Cookie/Cookie.h>
 #include <LibHTTP/Cookie/ParsedCookie.h>
@@ -153,6 +154,7 @@
 #include <LibWeb/HTML/Parser/HTMLParser.h>
 #include <LibWeb/HTML/PolicyContainers.h>
 #include <LibWeb/HTML/PopStateEvent.h>
+#include <LibWeb/HTML/PreloadedResources.h>
 #include <LibWeb/HTML/Scripting/Agent.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
@@ -595,6 +597,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_active_favicon);
     visitor.visit(m_browsing_context);
     visitor.visit(m_focused_area);
+    visitor.visit(m_accessibility_tree);
     visitor.visit(m_active_element);
     visitor.visit(m_target_element);
     visitor.visit(m_implementation);
@@ -619,8 +622,11 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_selection);
     visitor.visit(m_first_base_element_with_href_in_tree_order);
     visitor.visit(m_first_base_element_with_target_in_tree_order);
+    visitor.visit(m_map_of_preloaded_resources);
     visitor.visit(m_parser);
     visitor.visit(m_lazy_load_intersection_observer);
+    visitor.visit(m_animated_image_intersection_observer);
+    visitor.visit(m_loading_image_intersection_observer);
     visitor.visit(m_visual_viewport);
     visitor.visit(m_latest_entry);
     visitor.visit(m_default_timeline);
@@ -1245,6 +1251,13 @@ GC::Ptr<HTML::HTMLBaseElement> Document::first_base_element_with_target_in_tree_
     return m_first_base_element_with_target_in_tree_order;
 }
 
+HTML::PreloadedResources& Document::map_of_preloaded_resources()
+{
+    if (!m_map_of_preloaded_resources)
+        m_map_of_preloaded_resources = realm().create<HTML::PreloadedResources>();
+    return *m_map_of_preloaded_resources;
+}
+
 // https://html.spec.whatwg.org/multipage/urls-and-fetching.html#respond-to-base-url-changes
 void Document::respond_to_base_url_changes()
 {
@@ -1328,8 +1341,26 @@ Optional<URL::URL> Document::encoding_parse_url(StringView url) const
     // 4. Let baseURL be environment's base URL, if environment is a Document object; otherwise environment's API base URL.
     auto base_url = this->base_url();
 
+    // OPTIMIZATION: Pages tend to resolve the same handful of URLs over and over again, e.g. while matching links or
+    //               loading images, so we remember the results for the current base URL and encoding.
+    if (m_parsed_url_cache.encoding != encoding || m_parsed_url_cache.base_url != base_url || m_parsed_url_cache.urls.size() >= parsed_url_cache_capacity) {
+        m_parsed_url_cache.urls.clear();
+        m_parsed_url_cache.encoding = encoding;
+    }
+    // NB: Equal base URLs are usually shared, which makes the comparison above cheap the next time around.
+    m_parsed_url_cache.base_url = base_url;
+
+    if (auto parsed_url = m_parsed_url_cache.urls.get(url); parsed_url.has_value())
+        return parsed_url.release_value();
+
     // 5. Return the result of applying the URL parser to url, with baseURL and encoding.
-    return DOMURL::parse(url, base_url, encoding);
+    auto parsed_url = DOMURL::parse(url, base_url, encoding);
+
+    // NB: Blob URLs carry the blob URL entry they resolved to at the time of parsing, which can be revoked later on.
+    if (!parsed_url.has_value() || parsed_url->scheme() != "blob"sv)
+        m_parsed_url_cache.urls.set(String::from_utf8_without_validation(url.bytes()), parsed_url);
+
+    return parsed_url;
 }
 
 // https://html.spec.whatwg.org/multipage/urls-and-fetching.html#encoding-parsing-and-serializing-a-url
@@ -1484,6 +1515,8 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (layout_is_up_to_date())
         return;
 
+    TRACE_EVENT("layout", "Document::update_layout");
+
     auto svg_roots_to_relayout = move(m_svg_roots_needing_relayout);
 
     // NOTE: If this is a document hosting <template> contents, layout is unnecessary.
@@ -1748,6 +1781,8 @@ void Document::update_style()
     if (!browsing_context())
         return;
 
+    TRACE_EVENT("style", "Document::update_style");
+
     update_animated_style_if_needed();
 
     // Associated with each top-level browsing context is a current transition generation that is incremented on each
@@ -1784,7 +1819,9 @@ void Document::update_style()
     // FIXME: We don't need to rebuild this cache on every style update, just if a @counter-style rule has changed.
     build_counter_style_cache();
 
+    style_computer().set_style_sharing_enabled(true);
     auto invalidation = update_style_recursively(*this, style_computer(), false, false, false);
+    style_computer().set_style_sharing_enabled(false);
     if (!invalidation.is_none())
         invalidate_display_list();
 
@@ -2763,6 +2800,12 @@ void Document::set_focused_area(GC::Ptr<Node> node)
 
     GC::Ptr old_focused_area = m_focused_area;
 
+    // NB: Focused elements are always exposed in the accessibility tree.
+    if (old_focused_area)
+        old_focused_area->set_needs_accessibility_tree_update();
+    if (node)
+        node->set_needs_accessibility_tree_update();
+
     if (auto* old_focused_element = as_if<Element>(old_focused_area.ptr()))
         old_focused_element->did_lose_focus();
 
@@ -4564,6 +4607,31 @@ void Document::make_unsalvageable([[maybe_unused]] String reason)
     set_salvageable(false);
 }
 
+// NB: This decides whether we keep the document alive in its session history entry when it is unloaded, so that
+//     traversing back to it doesn't have to fetch, parse and run it again.
+bool Document::can_be_stored_in_bfcache() const
+{
+    if (!m_salvageable || is_initial_about_blank())
+        return false;
+
+    // NB: Documents that are still loading would have to resume fetching their resources on reactivation.
+    if (m_readiness != HTML::DocumentReadyState::Complete)
+        return false;
+
+    // NB: Child navigables would need their nested histories to be restored as well, which isn't supported yet.
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_top_level_traversable() || !navigable->child_navigables().is_empty())
+        return false;
+
+    // NB: Like other engines, we don't keep documents that listen for unload events, as their listeners would never
+    //     run. Event sources would keep their connections open while the document isn't displayed.
+    auto const& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+    if (window.has_event_listener(HTML::EventNames::unload) || window.has_registered_event_sources())
+        return false;
+
+    return true;
+}
+
 struct DocumentLifecycleState : public GC::Cell {
     GC_CELL(DocumentLifecycleState, GC::Cell);
     GC_DECLARE_ALLOCATOR(DocumentLifecycleState);
@@ -4756,7 +4824,7 @@ void Document::unload(GC::Ptr<Document>)
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history
     //    entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    auto intend_to_store_in_bfcache = can_be_stored_in_bfcache();
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *HTML::relevant_agent(*this).event_loop;
@@ -4807,16 +4875,25 @@ void Document::unload(GC::Ptr<Document>)
 
     // FIXME: 15. Set oldDocument's suspension time to the current high resolution time given document's relevant global object.
 
-    // FIXME: 16. Set oldDocument's suspended timer handles to the result of getting the keys for the map of active timers.
+    // 16. Set oldDocument's suspended timer handles to the result of getting the keys for the map of active timers.
+    // NB: We stop the timers instead, and let them pick up where they left off when the document is reactivated.
+    if (m_salvageable)
+        as<HTML::Window>(relevant_global_object(*this)).suspend_active_timers();
 
     // FIXME: 17. Set oldDocument's has been scrolled by the user to false.
 
-    // FIXME: 18. Run any unloading document cleanup steps for oldDocument that are defined by this specification and other
+    // 18. Run any unloading document cleanup steps for oldDocument that are defined by this specification and other
     //     applicable specifications.
+    // NB: Destroying the document below runs these as well, so we only run them here for documents that we keep.
+    if (m_salvageable)
+        run_unloading_cleanup_steps();
 
     // 19. If oldDocument's salvageable state is false, then destroy oldDocument.
     if (!m_salvageable)
         destroy();
+    // NB: Otherwise, it stays alive in its session history entry until our traversable evicts it from the bfcache.
+    else if (auto navigable = this->navigable())
+        navigable->traversable_navigable()->store_document_in_bfcache(*this);
 
     // 20. Decrease oldDocument's unload counter by 1.
     m_unload_counter -= 1;
@@ -4916,7 +4993,10 @@ bool Document::is_allowed_to_use_feature(PolicyControlledFeature feature) const
 
 void Document::did_stop_being_active_document_in_navigable()
 {
-    tear_down_layout_tree();
+    // NB: Documents that are kept in the bfcache hold on to their layout tree and display list, so that they can be
+    //     shown again right away when they are reactivated.
+    if (!m_salvageable)
+        tear_down_layout_tree();
 
     if (!m_has_fired_document_became_inactive) {
         m_has_fired_document_became_inactive = true;
@@ -4968,11 +5048,19 @@ GC::Ref<DOM::Document> Document::appropriate_template_contents_owner_document()
     return *this;
 }
 
+GC::Ref<AccessibilityTreeNode> Document::accessibility_tree()
+{
+    if (!m_accessibility_tree || needs_accessibility_tree_update() || child_needs_accessibility_tree_update()) {
+        m_accessibility_tree = AccessibilityTreeNode::create(this, nullptr);
+        build_accessibility_tree(*m_accessibility_tree);
+    }
+    return *m_accessibility_tree;
+}
+
 String Document::dump_accessibility_tree_as_json()
 {
     StringBuilder builder;
-    auto accessibility_tree = AccessibilityTreeNode::create(this, nullptr);
-    build_accessibility_tree(*&accessibility_tree);
+    auto accessibility_tree = this->accessibility_tree();
     auto json = MUST(JsonObjectSerializer<>::try_create(builder));
 
     // Empty document
@@ -5048,6 +5136,10 @@ void Document::make_active()
         m_needs_to_call_page_did_load = false;
     }
 
+    // NB: A document that is reactivated from the bfcache has already notified its observers that it became inactive,
+    //     and does so again once it stops being active anew.
+    m_has_fired_document_became_inactive = false;
+
     notify_each_document_observer([&](auto const& document_observer) {
         return document_observer.document_became_active();
     });
@@ -5185,10 +5277,11 @@ void Document::queue_an_intersection_observer_entry(IntersectionObserver::Inters
 }
 
 // https://www.w3.org/TR/intersection-observer/#compute-the-intersection
-static CSSPixelRect compute_intersection(GC::Ref<Element> target, IntersectionObserver::IntersectionObserver const& observer, Painting::PaintableBox const* root_paintable, CSSPixelRect const& root_bounds)
+static CSSPixelRect compute_intersection(GC::Ref<Element> target, CSSPixelRect const& target_bounding_box, IntersectionObserver::IntersectionObserver const& observer, Painting::PaintableBox const* root_paintable, CSSPixelRect const& root_bounds)
 {
     // 1. Let intersectionRect be the result of getting the bounding box for target.
-    auto intersection_rect = target->get_bounding_client_rect();
+    // NB: The caller has already gotten the bounding box for target.
+    auto intersection_rect = target_bounding_box;
 
     // 2. Let container be the containing block of target.
     // 3. While container is not root:
@@ -5256,6 +5349,10 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
     // NOTE: We make a copy of the intersection observers list to avoid modifying it while iterating.
     auto intersection_observers = GC::RootVector { heap(), m_intersection_observers.values() };
 
+    // NB: No script runs while we update the observations, so a target's bounding box is the same for every observer
+    //     that observes it.
+    HashMap<GC::Ref<Element>, CSSPixelRect> target_bounding_boxes;
+
     for (auto& observer : intersection_observers) {
         // 1. Let rootBounds be observer’s root intersection rectangle.
         auto root_bounds = observer->root_intersection_rectangle();
@@ -5292,11 +5389,19 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
             // NOTE: Check if target has a layout node is not in the spec but required to match other browsers.
             if (target->layout_node() && (is_implicit_root || &target->document() == &intersection_root_node->document()) && !(root_is_element && !target->is_descendant_of(*intersection_root_node))) {
                 // 4. Set targetRect to the DOMRectReadOnly obtained by getting the bounding box for target.
-                target_rect = target->get_bounding_client_rect();
+                target_rect = target_bounding_boxes.ensure(target, [&] { return target->get_bounding_client_rect(); });
+
+                // NB: We determine isIntersecting (step 8) first, so that we can skip computing the intersection below.
+                is_intersecting = target_rect.edge_adjacent_intersects(root_bounds);
 
                 // 5. Let intersectionRect be the result of running the compute the intersection algorithm on target and
                 //    observer’s intersection root.
-                intersection_rect = compute_intersection(target, *observer, root_paintable, root_bounds);
+                // OPTIMIZATION: The intersection ends up being intersected with rootBounds, which leaves an empty
+                //               rectangle if targetRect doesn't touch rootBounds. Pages that observe lots of elements
+                //               usually have most of them far outside of the root, so we skip walking their containing
+                //               block chains.
+                if (is_intersecting)
+                    intersection_rect = compute_intersection(target, target_rect, *observer, root_paintable, root_bounds);
 
                 // 6. Let targetArea be targetRect’s area.
                 auto target_area = target_rect.width() * target_rect.height();
@@ -5306,7 +5411,7 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
 
                 // 8. Let isIntersecting be true if targetRect and rootBounds intersect or are edge-adjacent, even if the
                 //    intersection has zero area (because rootBounds or targetRect have zero area).
-                is_intersecting = target_rect.edge_adjacent_intersects(root_bounds);
+                // NB: This was done above.
 
                 // 9. If targetArea is non-zero, let intersectionRatio be intersectionArea divided by targetArea.
                 //    Otherwise, let intersectionRatio be 1 if isIntersecting is true, or 0 if isIntersecting is false.
@@ -5418,9 +5523,13 @@ void Document::start_intersection_observing_a_lazy_loading_element(Element& elem
             return JS::js_undefined();
         });
 
-        // FIXME: The options is an IntersectionObserverInit dictionary with the following dictionary members: «[ "rootMargin" → lazy load root margin ]»
+        // The options is an IntersectionObserverInit dictionary with the following dictionary members: «[ "rootMargin" → lazy load root margin ]»
         // Spec Note: This allows for fetching the image during scrolling, when it does not yet — but is about to — intersect the viewport.
+        // NB: The lazy load root margin is implementation-defined. Like other engines, we start fetching lazy loading
+        //     elements once they are within a few screens of the viewport, so that they have usually arrived by the time
+        //     they are scrolled into view.
         auto options = IntersectionObserver::IntersectionObserverInit {};
+        options.root_margin = "1250px"_string;
 
         auto wrapped_callback = realm.heap().allocate<WebIDL::CallbackType>(callback, realm);
         m_lazy_load_intersection_observer = IntersectionObserver::IntersectionObserver::construct_impl(realm, wrapped_callback, options).release_value_but_fixme_should_propagate_errors();
@@ -5444,6 +5553,77 @@ void Document::stop_intersection_observing_a_lazy_loading_element(Element& eleme
     m_lazy_load_intersection_observer->unobserve(element);
 }
 
+void Document::start_intersection_observing_an_animated_image(HTML::HTMLImageElement& image)
+{
+    VERIFY(&image.document() == this);
+
+    if (!m_animated_image_intersection_observer) {
+        auto& realm = this->realm();
+        auto callback = JS::NativeFunction::create(realm, Utf16FlyString {}, [](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
+            auto& entries = as<JS::Array>(vm.argument(0).as_object());
+            auto entries_length = MUST(MUST(entries.get(vm.names.length)).to_length(vm));
+
+            for (size_t i = 0; i < entries_length; ++i) {
+                auto property_key = JS::PropertyKey { i };
+                auto& entry = as<IntersectionObserver::IntersectionObserverEntry>(entries.get_without_side_effects(property_key).as_object());
+                as<HTML::HTMLImageElement>(*entry.target()).set_visible_in_viewport(entry.is_intersecting());
+            }
+
+            return JS::js_undefined();
+        });
+
+        auto options = IntersectionObserver::IntersectionObserverInit {};
+        auto wrapped_callback = realm.heap().allocate<WebIDL::CallbackType>(callback, realm);
+        m_animated_image_intersection_observer = IntersectionObserver::IntersectionObserver::construct_impl(realm, wrapped_callback, options).release_value_but_fixme_should_propagate_errors();
+    }
+
+    m_animated_image_intersection_observer->observe(image);
+}
+
+void Document::stop_intersection_observing_an_animated_image(HTML::HTMLImageElement& image)
+{
+    if (m_animated_image_intersection_observer)
+        m_animated_image_intersection_observer->unobserve(image);
+}
+
+void Document::start_intersection_observing_a_loading_image(HTML::HTMLImageElement& image)
+{
+    VERIFY(&image.document() == this);
+
+    if (!m_loading_image_intersection_observer) {
+        auto& realm = this->realm();
+        auto callback = JS::NativeFunction::create(realm, Utf16FlyString {}, [this](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
+            auto& entries = as<JS::Array>(vm.argument(0).as_object());
+            auto entries_length = MUST(MUST(entries.get(vm.names.length)).to_length(vm));
+
+            for (size_t i = 0; i < entries_length; ++i) {
+                auto property_key = JS::PropertyKey { i };
+                auto& entry = as<IntersectionObserver::IntersectionObserverEntry>(entries.get_without_side_effects(property_key).as_object());
+                if (!entry.is_intersecting())
+                    continue;
+
+                auto& image = as<HTML::HTMLImageElement>(*entry.target());
+                stop_intersection_observing_a_loading_image(image);
+                image.loading_image_became_visible();
+            }
+
+            return JS::js_undefined();
+        });
+
+        auto options = IntersectionObserver::IntersectionObserverInit {};
+        auto wrapped_callback = realm.heap().allocate<WebIDL::CallbackType>(callback, realm);
+        m_loading_image_intersection_observer = IntersectionObserver::IntersectionObserver::construct_impl(realm, wrapped_callback, options).release_value_but_fixme_should_propagate_errors();
+    }
+
+    m_loading_image_intersection_observer->observe(image);
+}
+
+void Document::stop_intersection_observing_a_loading_image(HTML::HTMLImageElement& image)
+{
+    if (m_loading_image_intersection_observer)
+        m_loading_image_intersection_observer->unobserve(image);
+}
+
 // https://html.spec.whatwg.org/multipage/semantics.html#shared-declarative-refresh-steps
 void Document::shared_declarative_refresh_steps(StringView input, GC::Ptr<HTML::HTMLMetaElement const> meta_element)
 {
@@ -5762,11 +5942,66 @@ void Document::update_for_history_step_application(GC::Ref<HTML::SessionHistoryE
     // 9. Otherwise, if documentsEntryChanged is false and doNotReactivate is false, then:
     // NOTE: This is for bfcache restoration
     if (!documents_entry_changed && !do_not_reactivate) {
-        // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+        // 1. Assert: entriesForNavigationAPI is given.
+        VERIFY(entries_for_navigation_api.has_value());
+
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate(entry, *entries_for_navigation_api);
     }
 }
 
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate(GC::Ref<HTML::SessionHistoryEntry>, Vector<GC::Ref<HTML::SessionHistoryEntry>> const&)
+{
+    auto& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+
+    // FIXME: 1. For each formControl of form controls in document with an autofill field name of "off", invoke the reset
+    //           algorithm for formControl.
+
+    // 2. If document's suspended timer handles is not empty:
+    //    1. Assert: document's suspension time is not zero.
+    //    2. Let suspendDuration be the current high resolution time minus document's suspension time.
+    //    3. Let activeTimers be document's relevant global object's map of active timers.
+    //    4. For each handle in document's suspended timer handles, if activeTimers[handle] exists, then increase
+    //       activeTimers[handle] by suspendDuration.
+    // 3. Set document's suspended timer handles to an empty list.
+    // NB: Our timers were stopped when the document was unloaded, so we start them again instead.
+    window.resume_suspended_timers();
+
+    // FIXME: 4. Update the navigation API entries for reactivation given document's relevant global object's navigation API,
+    //           entriesForNavigationAPI, and reactivatedEntry.
+
+    // AD-HOC: The viewport may have been resized while the document was in the bfcache, in which case its layout is
+    //         stale. Otherwise, its display list can be painted again as it is.
+    auto viewport_size = viewport_rect().size().to_type<int>();
+    if (m_last_viewport_size != viewport_size) {
+        invalidate_style(StyleInvalidationReason::NavigableSetViewportSize);
+        set_needs_media_query_evaluation();
+        set_needs_layout_update(SetNeedsLayoutReason::NavigableSetViewportSize);
+        set_needs_repaint();
+    } else {
+        set_needs_repaint(InvalidateDisplayList::No);
+    }
+
+    // 5. If document's current document readiness is "complete", and document's page showing is false:
+    if (m_readiness == HTML::DocumentReadyState::Complete && !m_page_showing) {
+        // 1. Set document's page showing to true.
+        m_page_showing = true;
+
+        // FIXME: 2. Set document's has been revealed to false.
+
+        // 3. Update the visibility state of document to "visible".
+        update_the_visibility_state(HTML::VisibilityState::Visible);
+
+        // 4. Fire a page transition event named pageshow at document's relevant global object with true.
+        window.fire_a_page_transition_event(HTML::EventNames::pageshow, true);
+    }
+
+    // AD-HOC: Let the UI know about the title of the document we went back to, as it isn't parsed again.
+    if (auto navigable = this->navigable())
+        navigable->traversable_navigable()->page().client().page_did_change_title(title());
+}
+
 HashMap<URL::URL, GC::Ptr<HTML::SharedResourceRequest>>& Document::shared_resource_requests()
 {
     return m_shared_resource_requests;
@@ -7301,6 +7536,18 @@ void Document::invalidate_display_list()
     }
 }
 
+void Document::release_paint_caches()
+{
+    if (auto* viewport_paintable = unsafe_paintable()) {
+        viewport_paintable->for_each_in_inclusive_subtree_of_type<Painting::PaintableBox>([](auto& paintable_box) {
+            paintable_box.invalidate_paint_cache();
+            return TraversalDecision::Continue;
+        });
+    }
+
+    invalidate_display_list();
+}
+
 RefPtr<Painting::DisplayList> Document::cached_display_list() const
 {
     return m_cached_display_list;
@@ -7311,6 +7558,8 @@ RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig co
     if (m_cached_display_list && m_cached_display_list_paint_config == config)
         return m_cached_display_list;
 
+    TRACE_EVENT("paint", "Document::record_display_list");
+
     update_paint_and_hit_testing_properties_if_needed();
     VERIFY(paintable());
 
@@ -7364,6 +7613,8 @@ RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig co
         highlighted_node()->paintable()->paint_inspector_overlay(context);
     }
 
+    display_list->remove_redundant_commands();
+
     m_cached_display_list = display_list;
     m_cached_display_list_paint_config = config;
 
@@ -35,8 +35,10 @@
 #include <LibWeb/HTML/NavigationType.h>
 #include <LibWeb/HTML/PaintConfig.h>
 #include <LibWeb/HTML/SandboxingFlagSet.h>
+#include <LibWeb/HTML/SpeculationRules.h>
 #include <LibWeb/HTML/VisibilityState.h>
 #include <LibWeb/InvalidateDisplayList.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
 #include <LibWeb/TrustedTypes/InjectionSink.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -254,8 +256,18 @@ public:
     void update_base_element(Badge<HTML::HTMLBaseElement>);
     GC::Ptr<HTML::HTMLBaseElement> first_base_element_with_href_in_tree_order() const;
     GC::Ptr<HTML::HTMLBaseElement> first_base_element_with_target_in_tree_order() const;
+
+    // https://html.spec.whatwg.org/multipage/links.html#map-of-preloaded-resources
+    HTML::PreloadedResources& map_of_preloaded_resources();
     void respond_to_base_url_changes();
 
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#document-sr-sets
+    Vector<HTML::SpeculationRuleSet>& speculation_rule_sets() { return m_speculation_rule_sets; }
+    HashTable<URL::URL>& speculatively_prefetched_urls() { return m_speculatively_prefetched_urls; }
+
+    // https://w3c.github.io/long-animation-frames/#current-frame-timing-info
+    Optional<LongAnimationFrames::FrameTimingInfo>& current_frame_timing_info() { return m_current_frame_timing_info; }
+
     String url_string() const { return m_url.to_string(); }
     String document_uri() const { return url_string(); }
 
@@ -732,6 +744,7 @@ public:
 
     void did_stop_being_active_document_in_navigable();
 
+    GC::Ref<AccessibilityTreeNode> accessibility_tree();
     String dump_accessibility_tree_as_json();
 
     void make_active();
@@ -740,6 +753,8 @@ public:
 
     void make_unsalvageable(String reason);
 
+    bool can_be_stored_in_bfcache() const;
+
     HTML::ListOfAvailableImages& list_of_available_images();
     HTML::ListOfAvailableImages const& list_of_available_images() const;
 
@@ -754,6 +769,12 @@ public:
     void start_intersection_observing_a_lazy_loading_element(Element&);
     void stop_intersection_observing_a_lazy_loading_element(Element&);
 
+    void start_intersection_observing_an_animated_image(HTML::HTMLImageElement&);
+    void stop_intersection_observing_an_animated_image(HTML::HTMLImageElement&);
+
+    void start_intersection_observing_a_loading_image(HTML::HTMLImageElement&);
+    void stop_intersection_observing_a_loading_image(HTML::HTMLImageElement&);
+
     void shared_declarative_refresh_steps(StringView input, GC::Ptr<HTML::HTMLMetaElement const> meta_element = nullptr);
 
     struct TopOfTheDocument { };
@@ -766,6 +787,9 @@ public:
 
     void update_for_history_step_application(GC::Ref<HTML::SessionHistoryEntry>, bool do_not_reactivate, size_t script_history_length, size_t script_history_index, Optional<Bindings::NavigationType> navigation_type, Optional<Vector<GC::Ref<HTML::SessionHistoryEntry>>> entries_for_navigation_api = {}, GC::Ptr<HTML::SessionHistoryEntry> previous_entry_for_activation = {}, bool update_navigation_api = true);
 
+    // https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+    void reactivate(GC::Ref<HTML::SessionHistoryEntry>, Vector<GC::Ref<HTML::SessionHistoryEntry>> const& entries_for_navigation_api);
+
     HashMap<URL::URL, GC::Ptr<HTML::SharedResourceRequest>>& shared_resource_requests();
 
     void restore_the_history_object_state(GC::Ref<HTML::SessionHistoryEntry> entry);
@@ -908,6 +932,10 @@ public:
 
     void invalidate_display_list();
 
+    // Drops the display list and paint commands that are cached for this document, for when we are running low on
+    // memory. They are recorded again the next time the document is painted.
+    void release_paint_caches();
+
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& line_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
@@ -1154,6 +1182,10 @@ private:
 
     HTML::FocusTrigger m_last_focus_trigger { HTML::FocusTrigger::Other };
 
+    // NB: The accessibility tree that was last built for this document. Only the parts of it that changed since are
+    //     built again, see Node::build_accessibility_tree().
+    GC::Ptr<AccessibilityTreeNode> m_accessibility_tree;
+
     GC::Ptr<Element> m_active_element;
     GC::Ptr<Element> m_target_element;
 
@@ -1294,6 +1326,15 @@ private:
     GC::Ptr<HTML::HTMLBaseElement> m_first_base_element_with_href_in_tree_order;
     GC::Ptr<HTML::HTMLBaseElement> m_first_base_element_with_target_in_tree_order;
 
+    GC::Ptr<HTML::PreloadedResources> m_map_of_preloaded_resources;
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#document-sr-sets
+    Vector<HTML::SpeculationRuleSet> m_speculation_rule_sets;
+    HashTable<URL::URL> m_speculatively_prefetched_urls;
+
+    // https://w3c.github.io/long-animation-frames/#current-frame-timing-info
+    Optional<LongAnimationFrames::FrameTimingInfo> m_current_frame_timing_info;
+
     // https://html.spec.whatwg.org/multipage/images.html#list-of-available-images
     GC::Ptr<HTML::ListOfAvailableImages> m_list_of_available_images;
 
@@ -1310,6 +1351,13 @@ private:
     // Each Document has a lazy load intersection observer, initially set to null but can be set to an IntersectionObserver instance.
     GC::Ptr<IntersectionObserver::IntersectionObserver> m_lazy_load_intersection_observer;
 
+    // AD-HOC: Animated images are paused while they are outside the viewport, which this observer tells them about.
+    GC::Ptr<IntersectionObserver::IntersectionObserver> m_animated_image_intersection_observer;
+
+    // AD-HOC: Images are fetched and decoded ahead of others once they are in the viewport, which this observer tells
+    //         them about while they are loading.
+    GC::Ptr<IntersectionObserver::IntersectionObserver> m_loading_image_intersection_observer;
+
     ResizeObserver::ResizeObserver::ResizeObserversList m_resize_observers;
 
     // https://html.spec.whatwg.org/multipage/semantics.html#will-declaratively-refresh
@@ -1399,6 +1447,14 @@ private:
     Optional<HTML::PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
 
+    struct ParsedURLCache {
+        URL::URL base_url;
+        String encoding;
+        HashMap<String, Optional<URL::URL>> urls;
+    };
+    static constexpr size_t parsed_url_cache_capacity = 512;
+    mutable ParsedURLCache m_parsed_url_cache;
+
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_line_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
@@ -148,26 +148,37 @@ void Element::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_inline_style);
     visitor.visit(m_class_list);
     visitor.visit(m_shadow_root);
-    visitor.visit(m_part_list);
     visitor.visit(m_custom_element_definition);
-    visitor.visit(m_custom_state_set);
     visitor.visit(m_cascaded_properties);
     visitor.visit(m_computed_properties);
-    visitor.visit(m_computed_style_map_cache);
-    visitor.visit(m_attribute_style_map);
+    if (m_rare_data)
+        m_rare_data->visit_edges(visitor);
     if (m_pseudo_element_data) {
         for (auto& pseudo_element : *m_pseudo_element_data) {
             visitor.visit(pseudo_element.value);
         }
     }
-    if (m_registered_intersection_observers) {
-        for (auto& registered_intersection_observers : *m_registered_intersection_observers)
-            visitor.visit(registered_intersection_observers.observer);
-    }
     if (m_counters_set)
         m_counters_set->visit_edges(visitor);
 }
 
+void Element::ElementRareData::visit_edges(Cell::Visitor& visitor)
+{
+    visitor.visit(attribute_style_map);
+    visitor.visit(part_list);
+    visitor.visit(custom_state_set);
+    visitor.visit(computed_style_map_cache);
+    for (auto& registered_intersection_observer : registered_intersection_observers)
+        visitor.visit(registered_intersection_observer.observer);
+}
+
+Element::ElementRareData& Element::ensure_rare_data()
+{
+    if (!m_rare_data)
+        m_rare_data = make<ElementRareData>();
+    return *m_rare_data;
+}
+
 // https://dom.spec.whatwg.org/#dom-element-getattribute
 Optional<String> Element::get_attribute(FlyString const& name) const
 {
@@ -834,7 +845,7 @@ void Element::run_attribute_change_steps(FlyString const& local_name, Optional<S
 
     if (old_value != value) {
         invalidate_style_after_attribute_change(local_name, old_value, value);
-        document().bump_dom_tree_version();
+        bump_dom_tree_version();
     }
 }
 
@@ -1052,9 +1063,10 @@ GC::Ref<DOMTokenList> Element::part_list()
 {
     // The part attribute’s getter must return a DOMTokenList object whose associated element is the context object and
     // whose associated attribute’s local name is part.
-    if (!m_part_list)
-        m_part_list = DOMTokenList::create(*this, HTML::AttributeNames::part);
-    return *m_part_list;
+    auto& rare_data = ensure_rare_data();
+    if (!rare_data.part_list)
+        rare_data.part_list = DOMTokenList::create(*this, HTML::AttributeNames::part);
+    return *rare_data.part_list;
 }
 
 // https://dom.spec.whatwg.org/#valid-shadow-host-name
@@ -1082,9 +1094,9 @@ WebIDL::ExceptionOr<void> Element::attach_a_shadow_root(Bindings::ShadowRootMode
         return WebIDL::NotSupportedError::create(realm(), "Element's local name is not a valid shadow host name"_utf16);
 
     // 3. If element’s local name is a valid custom element name, or element’s is value is not null, then:
-    if (HTML::is_valid_custom_element_name(local_name()) || m_is_value.has_value()) {
+    if (HTML::is_valid_custom_element_name(local_name()) || is_value().has_value()) {
         // 1. Let definition be the result of looking up a custom element definition given element’s node document, its namespace, its local name, and its is value.
-        auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), m_is_value);
+        auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), is_value());
 
         // 2. If definition is not null and definition’s disable shadow is true, then throw a "NotSupportedError" DOMException.
         if (definition && definition->disable_shadow())
@@ -1329,16 +1341,17 @@ GC::Ref<CSS::CSSStyleProperties> Element::style_for_bindings()
 
 GC::Ref<CSS::StylePropertyMap> Element::attribute_style_map()
 {
-    if (!m_attribute_style_map)
-        m_attribute_style_map = CSS::StylePropertyMap::create(realm(), style_for_bindings());
-    return *m_attribute_style_map;
+    auto& rare_data = ensure_rare_data();
+    if (!rare_data.attribute_style_map)
+        rare_data.attribute_style_map = CSS::StylePropertyMap::create(realm(), style_for_bindings());
+    return *rare_data.attribute_style_map;
 }
 
 void Element::set_inline_style(GC::Ptr<CSS::CSSStyleProperties> style)
 {
     m_inline_style = style;
-    if (m_attribute_style_map)
-        m_attribute_style_map = nullptr;
+    if (m_rare_data)
+        m_rare_data->attribute_style_map = nullptr;
     set_needs_style_update(true);
 }
 
@@ -3267,8 +3280,8 @@ JS::ThrowCompletionOr<void> Element::upgrade_element(GC::Ref<HTML::CustomElement
         m_custom_element_definition = nullptr;
 
         // 2. Empty element's custom element reaction queue.
-        if (m_custom_element_reaction_queue)
-            m_custom_element_reaction_queue->clear();
+        if (auto* reaction_queue = custom_element_reaction_queue())
+            reaction_queue->clear();
 
         // 3. Rethrow the exception (thus terminating this algorithm).
         return maybe_exception.release_error();
@@ -3295,7 +3308,7 @@ JS::ThrowCompletionOr<void> Element::upgrade_element(GC::Ref<HTML::CustomElement
 void Element::try_to_upgrade()
 {
     // 1. Let definition be the result of looking up a custom element definition given element's node document, element's namespace, element's local name, and element's is value.
-    auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), m_is_value);
+    auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), is_value());
 
     // 2. If definition is not null, then enqueue a custom element upgrade reaction given element and definition.
     if (definition)
@@ -3337,7 +3350,7 @@ void Element::setup_custom_element_from_constructor(HTML::CustomElementDefinitio
     m_custom_element_definition = custom_element_definition;
 
     // 7.8. Set element's is value to is value.
-    m_is_value = is_value;
+    set_is_value(is_value);
 }
 
 void Element::set_prefix(Optional<FlyString> value)
@@ -3701,11 +3714,9 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
 
     // 5. If the contentVisibilityAuto dictionary member of options is true and an ancestor of this in the flat tree
     //    skips its contents due to content-visibility: auto, return false.
-    // FIXME: Currently we do not skip any content if content-visibility is auto: https://drafts.csswg.org/css-contain-2/#proximity-to-the-viewport
-    auto const skipped_contents_due_to_content_visibility_auto = false;
-    if (options->content_visibility_auto && skipped_contents_due_to_content_visibility_auto) {
+    if (options->content_visibility_auto) {
         for (auto* element = flat_tree_parent_element(); element; element = element->flat_tree_parent_element()) {
-            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto)
+            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto && element->skips_its_contents())
                 return false;
         }
     }
@@ -3727,8 +3738,10 @@ void Element::determine_proximity_to_the_viewport()
     // viewport soon. A margin of 50% is suggested as a reasonable default.
     viewport_rect.inflate(viewport_rect.width(), viewport_rect.height());
     // FIXME: We don't have paint containment or the overflow clip edge yet, so this is just using the absolute rect for now.
-    if (paintable_box()->absolute_rect().intersects(viewport_rect))
+    if (paintable_box()->absolute_rect().intersects(viewport_rect)) {
         m_proximity_to_the_viewport = ProximityToTheViewport::CloseToTheViewport;
+        return;
+    }
 
     // FIXME: If a filter (see [FILTER-EFFECTS-1]) with non local effects includes the element as part of its input, the user
     //        agent should also treat the element as relevant to the user when the filter’s output can affect the rendering
@@ -3759,7 +3772,7 @@ bool Element::is_relevant_to_the_user()
         return true;
 
     // Either the element or its contents are selected, where selection is described in the selection API.
-    if (document().get_selection()->contains_node(*this, true))
+    if (auto selection = document().get_selection(); selection && selection->contains_node(*this, true))
         return true;
 
     bool has_relevant_contents = false;
@@ -3933,24 +3946,22 @@ bool Element::id_reference_exists(String const& id_reference) const
 
 void Element::register_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, IntersectionObserver::IntersectionObserverRegistration registration)
 {
-    if (!m_registered_intersection_observers)
-        m_registered_intersection_observers = make<Vector<IntersectionObserver::IntersectionObserverRegistration>>();
-    m_registered_intersection_observers->append(move(registration));
+    ensure_rare_data().registered_intersection_observers.append(move(registration));
 }
 
 void Element::unregister_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, GC::Ref<IntersectionObserver::IntersectionObserver> observer)
 {
-    if (!m_registered_intersection_observers)
+    if (!m_rare_data)
         return;
-    m_registered_intersection_observers->remove_first_matching([&observer](IntersectionObserver::IntersectionObserverRegistration const& entry) {
+    m_rare_data->registered_intersection_observers.remove_first_matching([&observer](IntersectionObserver::IntersectionObserverRegistration const& entry) {
         return entry.observer == observer;
     });
 }
 
 IntersectionObserver::IntersectionObserverRegistration& Element::get_intersection_observer_registration(Badge<DOM::Document>, IntersectionObserver::IntersectionObserver const& observer)
 {
-    VERIFY(m_registered_intersection_observers);
-    auto registration_iterator = m_registered_intersection_observers->find_if([&observer](IntersectionObserver::IntersectionObserverRegistration const& entry) {
+    VERIFY(m_rare_data);
+    auto registration_iterator = m_rare_data->registered_intersection_observers.find_if([&observer](IntersectionObserver::IntersectionObserverRegistration const& entry) {
         return entry.observer.ptr() == &observer;
     });
     VERIFY(!registration_iterator.is_end());
@@ -4334,16 +4345,16 @@ void Element::attribute_changed(FlyString const& local_name, Optional<String> co
             return TraversalDecision::Continue;
         });
     } else if (local_name == HTML::AttributeNames::part) {
-        m_parts.clear();
+        auto& rare_data = ensure_rare_data();
+        rare_data.parts.clear();
         if (!value_or_empty.is_empty()) {
             auto new_parts = value_or_empty.bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace);
-            m_parts.clear();
-            m_parts.ensure_capacity(new_parts.size());
+            rare_data.parts.ensure_capacity(new_parts.size());
             for (auto& new_part : new_parts)
-                m_parts.unchecked_append(MUST(FlyString::from_utf8(new_part)));
+                rare_data.parts.unchecked_append(MUST(FlyString::from_utf8(new_part)));
         }
-        if (m_part_list)
-            m_part_list->associated_attribute_changed(value_or_empty);
+        if (rare_data.part_list)
+            rare_data.part_list->associated_attribute_changed(value_or_empty);
     }
 
     // https://html.spec.whatwg.org/multipage/common-dom-interfaces.html#reflecting-content-attributes-in-idl-attributes:concept-element-attributes-change-ext
@@ -4369,18 +4380,32 @@ void Element::attribute_changed(FlyString const& local_name, Optional<String> co
 #undef __ENUMERATE_ARIA_ATTRIBUTE
 }
 
+Optional<String> const& Element::is_value() const
+{
+    static Optional<String> const no_is_value;
+    return m_rare_data ? m_rare_data->is_value : no_is_value;
+}
+
+void Element::set_is_value(Optional<String> const& is)
+{
+    if (m_rare_data || is.has_value())
+        ensure_rare_data().is_value = is;
+}
+
 auto Element::ensure_custom_element_reaction_queue() -> CustomElementReactionQueue&
 {
-    if (!m_custom_element_reaction_queue)
-        m_custom_element_reaction_queue = make<CustomElementReactionQueue>();
-    return *m_custom_element_reaction_queue;
+    auto& rare_data = ensure_rare_data();
+    if (!rare_data.custom_element_reaction_queue)
+        rare_data.custom_element_reaction_queue = make<CustomElementReactionQueue>();
+    return *rare_data.custom_element_reaction_queue;
 }
 
 HTML::CustomStateSet& Element::ensure_custom_state_set()
 {
-    if (!m_custom_state_set)
-        m_custom_state_set = HTML::CustomStateSet::create(realm(), *this);
-    return *m_custom_state_set;
+    auto& rare_data = ensure_rare_data();
+    if (!rare_data.custom_state_set)
+        rare_data.custom_state_set = HTML::CustomStateSet::create(realm(), *this);
+    return *rare_data.custom_state_set;
 }
 
 CSS::StyleSheetList& Element::document_or_shadow_root_style_sheets()
@@ -4732,12 +4757,13 @@ GC::Ref<CSS::StylePropertyMapReadOnly> Element::computed_style_map()
     //
     // NOTE: In practice, since the values are "hidden" behind a .get() method call, UAs can delay computing anything
     //    until a given property is actually requested.
-    if (m_computed_style_map_cache == nullptr) {
-        m_computed_style_map_cache = CSS::StylePropertyMapReadOnly::create_computed_style(realm(), AbstractElement { *this });
+    auto& rare_data = ensure_rare_data();
+    if (rare_data.computed_style_map_cache == nullptr) {
+        rare_data.computed_style_map_cache = CSS::StylePropertyMapReadOnly::create_computed_style(realm(), AbstractElement { *this });
     }
 
     // 2. Return this’s [[computedStyleMapCache]] internal slot.
-    return *m_computed_style_map_cache;
+    return *rare_data.computed_style_map_cache;
 }
 
 double Element::ensure_css_random_base_value(CSS::RandomCachingKey const& random_caching_key)
@@ -4747,7 +4773,7 @@ double Element::ensure_css_random_base_value(CSS::RandomCachingKey const& random
     if (!random_caching_key.element_id.has_value())
         return document().ensure_element_shared_css_random_base_value(random_caching_key);
 
-    return m_element_specific_css_random_base_value_cache.ensure(random_caching_key, []() {
+    return ensure_rare_data().element_specific_css_random_base_value_cache.ensure(random_caching_key, []() {
         static XorShift128PlusRNG random_number_generator;
         return random_number_generator.get();
     });
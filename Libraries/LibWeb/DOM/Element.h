@@ -192,7 +192,7 @@ public:
 
     GC::Ref<DOMTokenList> class_list();
     GC::Ref<DOMTokenList> part_list();
-    ReadonlySpan<FlyString> part_names() const { return m_parts; }
+    ReadonlySpan<FlyString> part_names() const { return m_rare_data ? m_rare_data->parts.span() : ReadonlySpan<FlyString> {}; }
 
     WebIDL::ExceptionOr<GC::Ref<ShadowRoot>> attach_shadow(ShadowRootInit init);
     WebIDL::ExceptionOr<void> attach_a_shadow_root(Bindings::ShadowRootMode mode, bool clonable, bool serializable, bool delegates_focus, Bindings::SlotAssignmentMode slot_assignment);
@@ -407,11 +407,11 @@ public:
     void enqueue_a_custom_element_callback_reaction(FlyString const& callback_name, GC::RootVector<JS::Value> arguments);
 
     using CustomElementReactionQueue = Vector<Variant<CustomElementUpgradeReaction, CustomElementCallbackReaction>>;
-    CustomElementReactionQueue* custom_element_reaction_queue() { return m_custom_element_reaction_queue; }
-    CustomElementReactionQueue const* custom_element_reaction_queue() const { return m_custom_element_reaction_queue; }
+    CustomElementReactionQueue* custom_element_reaction_queue() { return m_rare_data ? m_rare_data->custom_element_reaction_queue.ptr() : nullptr; }
+    CustomElementReactionQueue const* custom_element_reaction_queue() const { return m_rare_data ? m_rare_data->custom_element_reaction_queue.ptr() : nullptr; }
     CustomElementReactionQueue& ensure_custom_element_reaction_queue();
 
-    GC::Ptr<HTML::CustomStateSet const> custom_state_set() const { return m_custom_state_set; }
+    GC::Ptr<HTML::CustomStateSet const> custom_state_set() const { return m_rare_data ? m_rare_data->custom_state_set : nullptr; }
     HTML::CustomStateSet& ensure_custom_state_set();
 
     JS::ThrowCompletionOr<void> upgrade_element(GC::Ref<HTML::CustomElementDefinition> custom_element_definition);
@@ -420,8 +420,8 @@ public:
     bool is_defined() const;
     bool is_custom() const;
 
-    Optional<String> const& is_value() const { return m_is_value; }
-    void set_is_value(Optional<String> const& is) { m_is_value = is; }
+    Optional<String> const& is_value() const;
+    void set_is_value(Optional<String> const&);
 
     void set_custom_element_state(CustomElementState);
     void setup_custom_element_from_constructor(HTML::CustomElementDefinition& custom_element_definition, Optional<String> const& is_value);
@@ -490,6 +490,10 @@ public:
     // https://drafts.csswg.org/css-contain-2/#skips-its-contents
     bool skips_its_contents();
 
+    // Whether the layout tree was last built without this element's contents.
+    bool contents_skipped_in_layout_tree() const { return m_contents_skipped_in_layout_tree; }
+    void set_contents_skipped_in_layout_tree(bool value) { m_contents_skipped_in_layout_tree = value; }
+
     bool matches_enabled_pseudo_class() const;
     bool matches_disabled_pseudo_class() const;
     bool matches_checked_pseudo_class() const;
@@ -635,10 +639,8 @@ private:
 
     GC::Ptr<NamedNodeMap> m_attributes;
     GC::Ptr<CSS::CSSStyleProperties> m_inline_style;
-    GC::Ptr<CSS::StylePropertyMap> m_attribute_style_map;
     GC::Ptr<DOMTokenList> m_class_list;
     GC::Ptr<ShadowRoot> m_shadow_root;
-    GC::Ptr<DOMTokenList> m_part_list;
 
     GC::Ptr<CSS::CascadedProperties> m_cascaded_properties;
     GC::Ptr<CSS::ComputedProperties> m_computed_properties;
@@ -651,34 +653,49 @@ private:
     Optional<CSS::PseudoElement> m_use_pseudo_element;
 
     Vector<FlyString> m_classes;
-    Vector<FlyString> m_parts;
     Optional<Dir> m_dir;
 
     Optional<FlyString> m_id;
     Optional<FlyString> m_name;
 
-    // https://html.spec.whatwg.org/multipage/custom-elements.html#custom-element-reaction-queue
-    // All elements have an associated custom element reaction queue, initially empty. Each item in the custom element reaction queue is of one of two types:
-    // NOTE: See the structs at the top of this header.
-    OwnPtr<CustomElementReactionQueue> m_custom_element_reaction_queue;
-
     // https://dom.spec.whatwg.org/#concept-element-custom-element-definition
     GC::Ptr<HTML::CustomElementDefinition> m_custom_element_definition;
 
-    // https://dom.spec.whatwg.org/#concept-element-is-value
-    Optional<String> m_is_value;
+    // NB: State that only a few elements ever need, kept out of line so that it doesn't take up space in every element.
+    struct ElementRareData {
+        GC::Ptr<CSS::StylePropertyMap> attribute_style_map;
+        GC::Ptr<DOMTokenList> part_list;
+        Vector<FlyString> parts;
+
+        // https://html.spec.whatwg.org/multipage/custom-elements.html#custom-element-reaction-queue
+        // All elements have an associated custom element reaction queue, initially empty. Each item in the custom element reaction queue is of one of two types:
+        // NOTE: See the structs at the top of this header.
+        OwnPtr<CustomElementReactionQueue> custom_element_reaction_queue;
+
+        // https://dom.spec.whatwg.org/#concept-element-is-value
+        Optional<String> is_value;
 
-    // https://html.spec.whatwg.org/multipage/custom-elements.html#states-set
-    GC::Ptr<HTML::CustomStateSet> m_custom_state_set;
+        // https://html.spec.whatwg.org/multipage/custom-elements.html#states-set
+        GC::Ptr<HTML::CustomStateSet> custom_state_set;
 
-    // https://www.w3.org/TR/intersection-observer/#dom-element-registeredintersectionobservers-slot
-    // Element objects have an internal [[RegisteredIntersectionObservers]] slot, which is initialized to an empty list.
-    OwnPtr<Vector<IntersectionObserver::IntersectionObserverRegistration>> m_registered_intersection_observers;
+        // https://www.w3.org/TR/intersection-observer/#dom-element-registeredintersectionobservers-slot
+        // Element objects have an internal [[RegisteredIntersectionObservers]] slot, which is initialized to an empty list.
+        Vector<IntersectionObserver::IntersectionObserverRegistration> registered_intersection_observers;
+
+        // https://drafts.css-houdini.org/css-typed-om-1/#dom-element-computedstylemapcache-slot
+        // Every Element has a [[computedStyleMapCache]] internal slot, initially set to null, which caches the result of
+        // the computedStyleMap() method when it is first called.
+        GC::Ptr<CSS::StylePropertyMapReadOnly> computed_style_map_cache;
+
+        // https://drafts.csswg.org/css-values-5/#random-caching
+        HashMap<CSS::RandomCachingKey, double> element_specific_css_random_base_value_cache;
+
+        void visit_edges(Cell::Visitor&);
+    };
 
-    // https://drafts.css-houdini.org/css-typed-om-1/#dom-element-computedstylemapcache-slot
-    // Every Element has a [[computedStyleMapCache]] internal slot, initially set to null, which caches the result of
-    // the computedStyleMap() method when it is first called.
-    GC::Ptr<CSS::StylePropertyMapReadOnly> m_computed_style_map_cache;
+    ElementRareData& ensure_rare_data();
+
+    OwnPtr<ElementRareData> m_rare_data;
 
     CSSPixelPoint m_scroll_offset;
 
@@ -702,6 +719,20 @@ private:
     bool m_affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator : 1 { false };
     bool m_fullscreen_flag : 1 { false };
 
+    // https://w3c.github.io/webappsec-csp/#is-element-nonceable
+    // AD-HOC: We need to know the element had a duplicate attribute when it was created from the HTML parser.
+    //         However, there currently isn't any specified way to do this, so we store a flag on the token, which is
+    //         then passed down to here. This is used by Content Security Policy to disable the nonce attribute if this
+    //         flag is set.
+    bool m_had_duplicate_attribute_during_tokenization : 1 { false };
+
+    bool m_contents_skipped_in_layout_tree : 1 { false };
+
+    // https://drafts.csswg.org/css-view-transitions-1/#captured-in-a-view-transition
+    bool m_captured_in_a_view_transition : 1 { false };
+
+    bool m_is_contained_in_list_subtree : 1 { false };
+
     size_t m_sibling_invalidation_distance { 0 };
 
     OwnPtr<CSS::CountersSet> m_counters_set;
@@ -711,26 +742,11 @@ private:
 
     mutable Optional<String> m_lang_value;
 
-    // https://w3c.github.io/webappsec-csp/#is-element-nonceable
-    // AD-HOC: We need to know the element had a duplicate attribute when it was created from the HTML parser.
-    //         However, there currently isn't any specified way to do this, so we store a flag on the token, which is
-    //         then passed down to here. This is used by Content Security Policy to disable the nonce attribute if this
-    //         flag is set.
-    bool m_had_duplicate_attribute_during_tokenization { false };
-
     // https://dom.spec.whatwg.org/#concept-element-custom-element-state
     CustomElementState m_custom_element_state { CustomElementState::Undefined };
 
     // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
     ProximityToTheViewport m_proximity_to_the_viewport { ProximityToTheViewport::NotDetermined };
-
-    // https://drafts.csswg.org/css-view-transitions-1/#captured-in-a-view-transition
-    bool m_captured_in_a_view_transition { false };
-
-    bool m_is_contained_in_list_subtree { false };
-
-    // https://drafts.csswg.org/css-values-5/#random-caching
-    HashMap<CSS::RandomCachingKey, double> m_element_specific_css_random_base_value_cache;
 };
 
 template<>
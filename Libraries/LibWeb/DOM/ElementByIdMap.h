@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/Forward.h>
 
@@ -31,7 +32,7 @@ private:
         GC::Weak<Element> cached_first_element;
         Vector<GC::Weak<Element>> elements;
     };
-    mutable HashMap<FlyString, MapEntry> m_map;
+    mutable GroupedHashMap<FlyString, MapEntry> m_map;
 };
 
 }
@@ -92,6 +92,10 @@ Vector<GC::Root<DOMEventListener>> EventTarget::event_listener_list()
     return list;
 }
 
+// The number of event listeners of each type in all event targets' event listener lists. Targets that are collected
+// while they still have listeners keep theirs counted, so this may overestimate, but never underestimates.
+static HashMap<FlyString, size_t> s_event_listener_count_by_type;
+
 // https://dom.spec.whatwg.org/#concept-flatten-options
 static bool flatten_event_listener_options(Variant<EventListenerOptions, bool> const& options)
 {
@@ -227,8 +231,10 @@ void EventTarget::add_an_event_listener(DOMEventListener& listener)
             && entry->callback->callback().callback == listener.callback->callback().callback
             && entry->capture == listener.capture;
     });
-    if (it == event_listener_list.end())
+    if (it == event_listener_list.end()) {
         event_listener_list.append(listener);
+        s_event_listener_count_by_type.ensure(listener.type, [] { return 0; })++;
+    }
 
     // 6. If listener’s signal is not null, then add the following abort steps to it:
     if (listener.signal) {
@@ -280,7 +286,13 @@ void EventTarget::remove_an_event_listener(DOMEventListener& listener)
     // 2. Set listener’s removed to true and remove listener from eventTarget’s event listener list.
     listener.removed = true;
     VERIFY(m_data);
-    m_data->event_listener_list.remove_first_matching([&](auto& entry) { return entry.ptr() == &listener; });
+    if (!m_data->event_listener_list.remove_first_matching([&](auto& entry) { return entry.ptr() == &listener; }))
+        return;
+
+    auto count = s_event_listener_count_by_type.find(listener.type);
+    VERIFY(count != s_event_listener_count_by_type.end());
+    if (--count->value == 0)
+        s_event_listener_count_by_type.remove(count);
 }
 
 // https://dom.spec.whatwg.org/#dom-eventtarget-dispatchevent
@@ -871,6 +883,11 @@ bool EventTarget::has_event_listeners() const
     return m_data && !m_data->event_listener_list.is_empty();
 }
 
+bool EventTarget::may_have_event_listener_of_type_anywhere(FlyString const& type)
+{
+    return s_event_listener_count_by_type.contains(type);
+}
+
 bool EventTarget::has_activation_behavior() const
 {
     return false;
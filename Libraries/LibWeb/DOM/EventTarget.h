@@ -60,6 +60,10 @@ public:
     bool has_event_listener(FlyString const& type) const;
     bool has_event_listeners() const;
 
+    // Returns false if no event target in this process has an event listener of the given type, which lets event
+    // dispatch skip walking the tree for types nobody listens to.
+    static bool may_have_event_listener_of_type_anywhere(FlyString const& type);
+
     virtual bool is_universal_global_scope_mixin() const { return false; }
 
 protected:
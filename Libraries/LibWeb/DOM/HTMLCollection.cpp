@@ -73,26 +73,40 @@ void HTMLCollection::update_name_to_element_mappings_if_needed() const
     }
 }
 
-void HTMLCollection::update_cache_if_needed() const
+void HTMLCollection::update_cache_if_needed(Optional<size_t> index) const
 {
-    // Nothing to do, the DOM hasn't updated since we last built the cache.
-    if (m_cached_dom_tree_version == root()->document().dom_tree_version())
+    // NB: The cache only needs to be rebuilt if something in our subtree changed since we last built it.
+    if (auto version = m_root->subtree_dom_tree_version(); m_cached_subtree_dom_tree_version != version) {
+        m_cached_elements.clear();
+        m_cached_elements_are_complete = false;
+        m_cached_name_to_element_mappings = nullptr;
+        m_cached_subtree_dom_tree_version = version;
+    }
+
+    if (m_cached_elements_are_complete)
         return;
 
-    m_cached_elements.clear();
-    m_cached_name_to_element_mappings = nullptr;
-    if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree_of_type<Element>([&](auto& element) {
-            if (m_filter(element))
-                m_cached_elements.append(element);
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child_of_type<Element>([&](auto& element) {
-            if (m_filter(element))
-                m_cached_elements.append(element);
-            return IterationDecision::Continue;
-        });
+    // NB: A sorted collection has to be built all at once.
+    if (m_sort)
+        index = {};
+    if (index.has_value() && *index < m_cached_elements.size())
+        return;
+
+    auto next_node = [&](Node const& node) -> Node const* {
+        if (m_scope == Scope::Descendants)
+            return node.next_in_pre_order(m_root.ptr());
+        return node.next_sibling();
+    };
+
+    // NB: The cached elements are in tree order until the collection is complete, so we can resume after the last one.
+    auto const* node = m_cached_elements.is_empty() ? m_root->first_child() : next_node(*m_cached_elements.last());
+    for (; node; node = next_node(*node)) {
+        auto const* element = as_if<Element>(*node);
+        if (!element || !m_filter(*element))
+            continue;
+        m_cached_elements.append(const_cast<Element&>(*element));
+        if (index.has_value() && *index < m_cached_elements.size())
+            return;
     }
 
     if (m_sort) {
@@ -101,7 +115,7 @@ void HTMLCollection::update_cache_if_needed() const
         });
     }
 
-    m_cached_dom_tree_version = root()->document().dom_tree_version();
+    m_cached_elements_are_complete = true;
 }
 
 GC::RootVector<GC::Ref<Element>> HTMLCollection::collect_matching_elements() const
@@ -125,7 +139,7 @@ size_t HTMLCollection::length() const
 Element* HTMLCollection::item(size_t index) const
 {
     // The item(index) method steps are to return the indexth element in the collection. If there is no indexth element in the collection, then the method must return null.
-    update_cache_if_needed();
+    update_cache_if_needed(index);
     if (index >= m_cached_elements.size())
         return nullptr;
     return m_cached_elements[index];
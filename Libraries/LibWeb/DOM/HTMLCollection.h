@@ -56,11 +56,14 @@ protected:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
-    void update_cache_if_needed() const;
+    // NB: Without an index, the whole collection is cached. Otherwise, only as much as needed to get to the indexth
+    //     element, so that e.g. repeatedly taking the first element of a collection while removing it stays cheap.
+    void update_cache_if_needed(Optional<size_t> index = {}) const;
     void update_name_to_element_mappings_if_needed() const;
 
-    mutable u64 m_cached_dom_tree_version { 0 };
+    mutable Optional<u64> m_cached_subtree_dom_tree_version;
     mutable Vector<GC::Weak<Element>> m_cached_elements;
+    mutable bool m_cached_elements_are_complete { false };
     mutable OwnPtr<OrderedHashMap<FlyString, GC::Weak<Element>>> m_cached_name_to_element_mappings;
 
     GC::Ref<ParentNode> m_root;
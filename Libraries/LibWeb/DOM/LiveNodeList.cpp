@@ -35,23 +35,37 @@ void LiveNodeList::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_root);
 }
 
-GC::RootVector<Node*> LiveNodeList::collection() const
+void LiveNodeList::update_cache_if_needed(Optional<size_t> index) const
 {
-    GC::RootVector<Node*> nodes(heap());
-    if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree([&](auto& node) {
-            if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child([&](auto& node) {
-            if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
-            return IterationDecision::Continue;
-        });
+    // NB: The cache only needs to be rebuilt if something in our subtree changed since we last built it.
+    if (auto version = m_root->subtree_dom_tree_version(); m_cached_subtree_dom_tree_version != version) {
+        m_cached_nodes.clear();
+        m_cached_nodes_are_complete = false;
+        m_cached_subtree_dom_tree_version = version;
+    }
+
+    if (m_cached_nodes_are_complete)
+        return;
+    if (index.has_value() && *index < m_cached_nodes.size())
+        return;
+
+    auto next_node = [&](Node const& node) -> Node const* {
+        if (m_scope == Scope::Descendants)
+            return node.next_in_pre_order(m_root.ptr());
+        return node.next_sibling();
+    };
+
+    // NB: The cached nodes are in tree order, so we can resume after the last one.
+    auto const* node = m_cached_nodes.is_empty() ? m_root->first_child() : next_node(*m_cached_nodes.last());
+    for (; node; node = next_node(*node)) {
+        if (!m_filter(*node))
+            continue;
+        m_cached_nodes.append(const_cast<Node&>(*node));
+        if (index.has_value() && *index < m_cached_nodes.size())
+            return;
     }
-    return nodes;
+
+    m_cached_nodes_are_complete = true;
 }
 
 Node* LiveNodeList::first_matching(Function<bool(Node const&)> const& filter) const
@@ -80,17 +94,18 @@ Node* LiveNodeList::first_matching(Function<bool(Node const&)> const& filter) co
 // https://dom.spec.whatwg.org/#dom-nodelist-length
 u32 LiveNodeList::length() const
 {
-    return collection().size();
+    update_cache_if_needed();
+    return m_cached_nodes.size();
 }
 
 // https://dom.spec.whatwg.org/#dom-nodelist-item
 Node const* LiveNodeList::item(u32 index) const
 {
     // The item(index) method must return the indexth node in the collection. If there is no indexth node in the collection, then the method must return null.
-    auto nodes = collection();
-    if (index >= nodes.size())
+    update_cache_if_needed(index);
+    if (index >= m_cached_nodes.size())
         return nullptr;
-    return nodes[index];
+    return m_cached_nodes[index].ptr();
 }
 
 }
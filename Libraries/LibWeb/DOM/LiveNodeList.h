@@ -12,8 +12,6 @@
 
 namespace Web::DOM {
 
-// FIXME: Just like HTMLCollection, LiveNodeList currently does no caching.
-
 class LiveNodeList : public NodeList {
     WEB_NON_IDL_PLATFORM_OBJECT(LiveNodeList, NodeList);
     GC_DECLARE_ALLOCATOR(LiveNodeList);
@@ -38,7 +36,12 @@ protected:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
-    GC::RootVector<Node*> collection() const;
+    // NB: Without an index, the whole list is cached. Otherwise, only as much as needed to get to the indexth node.
+    void update_cache_if_needed(Optional<size_t> index = {}) const;
+
+    mutable Optional<u64> m_cached_subtree_dom_tree_version;
+    mutable Vector<GC::Weak<Node>> m_cached_nodes;
+    mutable bool m_cached_nodes_are_complete { false };
 
     GC::Ref<Node const> m_root;
     Function<bool(Node const&)> m_filter;
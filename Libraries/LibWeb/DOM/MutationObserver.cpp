@@ -8,7 +8,9 @@
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Bindings/MutationObserverPrototype.h>
 #include <LibWeb/DOM/MutationObserver.h>
+#include <LibWeb/DOM/MutationType.h>
 #include <LibWeb/DOM/Node.h>
+#include <LibWeb/DOM/StaticNodeList.h>
 #include <LibWeb/HTML/Scripting/SimilarOriginWindowAgent.h>
 
 namespace Web::DOM {
@@ -42,7 +44,38 @@ void MutationObserver::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_callback);
-    visitor.visit(m_record_queue);
+    for (auto& record : m_record_queue) {
+        visitor.visit(record.target);
+        visitor.visit(record.added_nodes);
+        visitor.visit(record.removed_nodes);
+        visitor.visit(record.previous_sibling);
+        visitor.visit(record.next_sibling);
+    }
+}
+
+bool QueuedMutationRecord::can_be_coalesced_with(QueuedMutationRecord const& other) const
+{
+    // NB: Tree mutation records always differ in the nodes they add or remove, so only attribute and character data
+    //     records are coalesced. Without an old value, which is the usual case unless attributeOldValue or
+    //     characterDataOldValue were requested, these only differ in their target and attribute.
+    if (type == MutationType::childList)
+        return false;
+    return type == other.type
+        && target == other.target
+        && attribute_name == other.attribute_name
+        && attribute_namespace == other.attribute_namespace
+        && old_value == other.old_value;
+}
+
+void MutationObserver::enqueue_record(Badge<Node>, QueuedMutationRecord record)
+{
+    // OPTIMIZATION: A record that is identical to the last record in the queue is not queued again, as repeatedly
+    //               changing the same attribute or text would otherwise fill the queue with copies of one record.
+    if (!m_record_queue.is_empty() && m_record_queue.last().can_be_coalesced_with(record)) {
+        ++m_record_queue.last().count;
+        return;
+    }
+    m_record_queue.append(move(record));
 }
 
 // https://dom.spec.whatwg.org/#dom-mutationobserver-observe
@@ -142,8 +175,33 @@ Vector<GC::Root<MutationRecord>> MutationObserver::take_records()
 {
     // 1. Let records be a clone of this’s record queue.
     Vector<GC::Root<MutationRecord>> records;
-    for (auto& record : m_record_queue)
-        records.append(*record);
+    for (auto const& queued_record : m_record_queue) {
+        auto& realm = queued_record.target->realm();
+
+        auto to_node_list = [&](Vector<GC::Ref<Node>> const& nodes) {
+            Vector<GC::Root<Node>> rooted_nodes;
+            rooted_nodes.ensure_capacity(nodes.size());
+            for (auto node : nodes)
+                rooted_nodes.unchecked_append(node);
+            return StaticNodeList::create(realm, move(rooted_nodes));
+        };
+
+        Optional<String> attribute_name;
+        if (queued_record.attribute_name.has_value())
+            attribute_name = queued_record.attribute_name->to_string();
+        Optional<String> attribute_namespace;
+        if (queued_record.attribute_namespace.has_value())
+            attribute_namespace = queued_record.attribute_namespace->to_string();
+
+        auto record = MutationRecord::create(realm, queued_record.type, *queued_record.target,
+            *to_node_list(queued_record.added_nodes), *to_node_list(queued_record.removed_nodes),
+            queued_record.previous_sibling, queued_record.next_sibling, attribute_name, attribute_namespace, queued_record.old_value);
+
+        // AD-HOC: Coalesced records are handed out as the same MutationRecord object, which can be told apart from
+        //         separate records only by their identity, as all of its attributes are read-only.
+        for (size_t i = 0; i < queued_record.count; ++i)
+            records.append(record);
+    }
 
     // 2. Empty this’s record queue.
     m_record_queue.clear();
@@ -25,6 +25,25 @@ struct MutationObserverInit {
     Optional<Vector<String>> attribute_filter;
 };
 
+// NB: A mutation record in a mutation observer's record queue. Its MutationRecord object is only created once the
+//     record is handed out to script.
+struct QueuedMutationRecord {
+    bool can_be_coalesced_with(QueuedMutationRecord const&) const;
+
+    FlyString type;
+    GC::Ref<Node const> target;
+    Vector<GC::Ref<Node>> added_nodes;
+    Vector<GC::Ref<Node>> removed_nodes;
+    GC::Ptr<Node> previous_sibling;
+    GC::Ptr<Node> next_sibling;
+    Optional<FlyString> attribute_name;
+    Optional<FlyString> attribute_namespace;
+    Optional<String> old_value;
+
+    // NB: The number of consecutive, identical records this entry stands for.
+    size_t count { 1 };
+};
+
 // https://dom.spec.whatwg.org/#mutationobserver
 class MutationObserver final : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(MutationObserver, Bindings::PlatformObject);
@@ -43,10 +62,7 @@ public:
 
     WebIDL::CallbackType& callback() { return *m_callback; }
 
-    void enqueue_record(Badge<Node>, GC::Ref<MutationRecord> mutation_record)
-    {
-        m_record_queue.append(*mutation_record);
-    }
+    void enqueue_record(Badge<Node>, QueuedMutationRecord);
 
 private:
     MutationObserver(JS::Realm&, GC::Ptr<WebIDL::CallbackType>);
@@ -62,7 +78,7 @@ private:
     Vector<GC::Weak<Node>> m_node_list;
 
     // https://dom.spec.whatwg.org/#concept-mo-queue
-    Vector<GC::Ref<MutationRecord>> m_record_queue;
+    Vector<QueuedMutationRecord> m_record_queue;
 };
 
 // https://dom.spec.whatwg.org/#registered-observer
@@ -124,16 +124,24 @@ void Node::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     TreeNode::visit_edges(visitor);
     visitor.visit(m_document);
-    visitor.visit(m_child_nodes);
 
     visitor.visit(m_layout_node);
     visitor.visit(m_paintable);
 
-    if (m_registered_observer_list) {
-        visitor.visit(*m_registered_observer_list);
+    if (m_rare_data) {
+        visitor.visit(m_rare_data->registered_observer_list);
+        visitor.visit(m_rare_data->child_nodes);
+        visitor.visit(m_rare_data->accessibility_tree_node);
     }
 }
 
+Node::NodeRareData& Node::ensure_rare_data()
+{
+    if (!m_rare_data)
+        m_rare_data = make<NodeRareData>();
+    return *m_rare_data;
+}
+
 // https://dom.spec.whatwg.org/#dom-node-baseuri
 String Node::base_uri() const
 {
@@ -239,7 +247,7 @@ WebIDL::ExceptionOr<void> Node::set_text_content(Optional<Utf16String> const& ma
         set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeSetTextContent);
     }
 
-    document().bump_dom_tree_version();
+    bump_dom_tree_version();
     return {};
 }
 
@@ -443,7 +451,9 @@ void Node::invalidate_style(StyleInvalidationReason reason)
 
     auto& style_scope = root().is_shadow_root() ? static_cast<ShadowRoot&>(root()).style_scope() : document().style_scope();
 
-    if (style_scope.may_have_has_selectors()) {
+    // NB: A subtree being inserted or removed can only affect :has() selectors that could match one of its elements.
+    auto is_structural_change = reason == StyleInvalidationReason::NodeInsertBefore || reason == StyleInvalidationReason::NodeRemove;
+    if (style_scope.may_have_has_selectors() && (!is_structural_change || document().style_computer().insertion_or_removal_may_affect_has_selectors(*this, style_scope))) {
         if (reason == StyleInvalidationReason::NodeRemove) {
             if (auto* parent = parent_or_shadow_host(); parent) {
                 style_scope.schedule_ancestors_style_invalidation_due_to_presence_of_has(*parent);
@@ -738,6 +748,10 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
     else
         previous_sibling = last_child();
 
+    // NB: Inserting the children of a fragment (e.g. when setting innerHTML) is a batch of its own.
+    auto& style_invalidator = document().style_invalidator();
+    style_invalidator.begin_insertion_batch();
+
     // 7. For each node in nodes, in tree order:
     // FIXME: In tree order
     for (auto& node_to_insert : nodes) {
@@ -780,7 +794,11 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
         // 6. Run assign slottables for a tree with node’s root.
         assign_slottables_for_a_tree(node_to_insert->root());
 
-        node_to_insert->invalidate_style(StyleInvalidationReason::NodeInsertBefore);
+        // OPTIMIZATION: Within an insertion batch, appended elements are invalidated together once it ends.
+        if (auto* element = as_if<Element>(*node_to_insert); element && !child && document().style_invalidator().is_in_insertion_batch())
+            document().style_invalidator().defer_invalidation_for_appended_element(*element);
+        else
+            node_to_insert->invalidate_style(StyleInvalidationReason::NodeInsertBefore);
 
         // 7. For each shadow-including inclusive descendant inclusiveDescendant of node, in shadow-including tree order:
         node_to_insert->for_each_shadow_including_inclusive_descendant([&](Node& inclusive_descendant) {
@@ -809,6 +827,8 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
         });
     }
 
+    style_invalidator.end_insertion_batch();
+
     // 8. If suppressObservers is false, then queue a tree mutation record for parent with nodes, « », previousSibling,
     //    and child.
     if (!suppress_observers) {
@@ -860,7 +880,7 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
     //       an ordinal value (default from constructor).
     // FIXME: This will not work if the child or the parent is not an element. Is insert_before even possible in this situation?
 
-    document().bump_dom_tree_version();
+    bump_dom_tree_version();
 }
 
 // https://dom.spec.whatwg.org/#concept-node-pre-insert
@@ -1067,9 +1087,10 @@ void Node::remove(bool suppress_observers)
     //     observer whose observer is registered’s observer, options is registered’s options, and source is registered
     //     to node’s registered observer list.
     for (auto* inclusive_ancestor = parent; inclusive_ancestor; inclusive_ancestor = inclusive_ancestor->parent()) {
-        if (!inclusive_ancestor->m_registered_observer_list)
+        auto const* registered_observer_list = inclusive_ancestor->registered_observer_list();
+        if (!registered_observer_list)
             continue;
-        for (auto& registered : *inclusive_ancestor->m_registered_observer_list) {
+        for (auto& registered : *registered_observer_list) {
             if (registered->options().subtree) {
                 auto transient_observer = TransientRegisteredObserver::create(registered->observer(), registered->options(), registered);
                 add_registered_observer(move(transient_observer));
@@ -1087,7 +1108,7 @@ void Node::remove(bool suppress_observers)
     ChildrenChangedMetadata metadata { ChildrenChangedMetadata::Type::Removal, *this };
     parent->children_changed(metadata);
 
-    document().bump_dom_tree_version();
+    parent->bump_dom_tree_version();
 }
 
 // https://dom.spec.whatwg.org/#concept-node-replace
@@ -1435,7 +1456,8 @@ WebIDL::ExceptionOr<void> Node::move_node(Node& new_parent, Node* child)
     // 26. Queue a tree mutation record for newParent with « node », « », newPreviousSibling, and child.
     new_parent.queue_tree_mutation_record({ *this }, {}, new_previous_sibling, child);
 
-    document().bump_dom_tree_version();
+    old_parent->bump_dom_tree_version();
+    new_parent.bump_dom_tree_version();
 
     return {};
 }
@@ -1583,6 +1605,29 @@ WebIDL::ExceptionOr<GC::Ref<Node>> Node::clone_node_binding(bool subtree)
     return clone_node(nullptr, subtree);
 }
 
+void Node::bump_dom_tree_version()
+{
+    document().bump_dom_tree_version();
+
+    // NB: Subtree versions are drawn from a single counter for all documents, so that a subtree adopted into another
+    //     document can't go back to a version that was already seen for it.
+    static u64 s_last_subtree_dom_tree_version = 0;
+    auto version = ++s_last_subtree_dom_tree_version;
+    for (auto* node = this; node; node = node->parent())
+        node->m_subtree_dom_tree_version = version;
+
+    // NB: The DOM tree version is bumped for changes to this node's children and attributes, which may both change how
+    //     this node is exposed in the accessibility tree.
+    set_needs_accessibility_tree_update();
+}
+
+void Node::set_needs_accessibility_tree_update()
+{
+    m_needs_accessibility_tree_update = true;
+    for (auto* ancestor = parent(); ancestor && !ancestor->m_child_needs_accessibility_tree_update; ancestor = ancestor->parent())
+        ancestor->m_child_needs_accessibility_tree_update = true;
+}
+
 void Node::set_document(Badge<Document>, Document& document)
 {
     set_document(document);
@@ -1714,11 +1759,13 @@ GC::Ptr<Node> Node::editing_host()
 void Node::set_layout_node(Badge<Layout::Node>, GC::Ref<Layout::Node> layout_node)
 {
     m_layout_node = layout_node;
+    set_needs_accessibility_tree_update();
 }
 
 void Node::detach_layout_node(Badge<Layout::TreeBuilder>)
 {
     m_layout_node = nullptr;
+    set_needs_accessibility_tree_update();
 }
 
 EventTarget* Node::get_parent(Event const&)
@@ -1892,12 +1939,13 @@ Slottable Node::as_slottable()
 
 GC::Ref<NodeList> Node::child_nodes()
 {
-    if (!m_child_nodes) {
-        m_child_nodes = LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Children, [](auto&) {
+    auto& rare_data = ensure_rare_data();
+    if (!rare_data.child_nodes) {
+        rare_data.child_nodes = LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Children, [](auto&) {
             return true;
         });
     }
-    return *m_child_nodes;
+    return *rare_data.child_nodes;
 }
 
 Vector<GC::Root<Node>> Node::children_as_vector() const
@@ -2767,9 +2815,10 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
     // 2. Let nodes be the inclusive ancestors of target.
     // 3. For each node of nodes, and then for each registered of node’s registered observer list:
     for (auto* node = this; node; node = node->parent()) {
-        if (!node->m_registered_observer_list)
+        auto const* registered_observer_list = node->registered_observer_list();
+        if (!registered_observer_list)
             continue;
-        for (auto& registered_observer : *node->m_registered_observer_list) {
+        for (auto& registered_observer : *registered_observer_list) {
             // 1. Let options be registered’s options.
             auto& options = registered_observer->options();
 
@@ -2803,22 +2852,32 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
     if (interested_observers.is_empty() && !page.listen_for_dom_mutations())
         return;
 
-    // FIXME: The MutationRecord constructor should take an Optional<FlyString> attribute name and namespace
-    Optional<String> string_attribute_name;
-    if (attribute_name.has_value())
-        string_attribute_name = attribute_name->to_string();
-    Optional<String> string_attribute_namespace;
-    if (attribute_namespace.has_value())
-        string_attribute_namespace = attribute_namespace->to_string();
-
-    auto added_nodes_list = StaticNodeList::create(realm(), move(added_nodes));
-    auto removed_nodes_list = StaticNodeList::create(realm(), move(removed_nodes));
+    auto to_node_vector = [](Vector<GC::Root<Node>> const& nodes) {
+        Vector<GC::Ref<Node>> result;
+        result.ensure_capacity(nodes.size());
+        for (auto const& node : nodes)
+            result.unchecked_append(*node);
+        return result;
+    };
+    auto added_node_vector = to_node_vector(added_nodes);
+    auto removed_node_vector = to_node_vector(removed_nodes);
 
     // 4. For each observer → mappedOldValue of interestedObservers:
     for (auto& [observer, mapped_old_value] : interested_observers) {
         // 1. Let record be a new MutationRecord object with its type set to type, target set to target, attributeName set to name, attributeNamespace set to namespace, oldValue set to mappedOldValue,
         //    addedNodes set to addedNodes, removedNodes set to removedNodes, previousSibling set to previousSibling, and nextSibling set to nextSibling.
-        auto record = MutationRecord::create(realm(), type, *this, added_nodes_list, removed_nodes_list, previous_sibling, next_sibling, string_attribute_name, string_attribute_namespace, mapped_old_value);
+        // NB: The MutationRecord object itself is only created once the record is handed out to script.
+        QueuedMutationRecord record {
+            .type = type,
+            .target = *this,
+            .added_nodes = added_node_vector,
+            .removed_nodes = removed_node_vector,
+            .previous_sibling = previous_sibling,
+            .next_sibling = next_sibling,
+            .attribute_name = attribute_name,
+            .attribute_namespace = attribute_namespace,
+            .old_value = mapped_old_value,
+        };
 
         // 2. Enqueue record to observer’s record queue.
         observer->enqueue_record({}, move(record));
@@ -2831,8 +2890,15 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
     Bindings::queue_mutation_observer_microtask();
 
     // AD-HOC: Notify the UI if it is interested in DOM mutations (i.e. for DevTools).
-    if (page.listen_for_dom_mutations())
+    if (page.listen_for_dom_mutations()) {
+        Optional<String> string_attribute_name;
+        if (attribute_name.has_value())
+            string_attribute_name = attribute_name->to_string();
+
+        auto added_nodes_list = StaticNodeList::create(realm(), move(added_nodes));
+        auto removed_nodes_list = StaticNodeList::create(realm(), move(removed_nodes));
         page.client().page_did_mutate_dom(type, *this, added_nodes_list, removed_nodes_list, previous_sibling, next_sibling, string_attribute_name);
+    }
 }
 
 // https://dom.spec.whatwg.org/#queue-a-tree-mutation-record
@@ -2869,13 +2935,31 @@ void Node::remove_child_impl(GC::Ref<Node> node)
 
 void Node::build_accessibility_tree(AccessibilityTreeNode& parent)
 {
+    // OPTIMIZATION: If neither this node nor any of its descendants has changed since this node was last built, the node
+    //               that was built for it is still up to date, so only the changed parts of the tree are built again.
+    if (!m_needs_accessibility_tree_update && !m_child_needs_accessibility_tree_update && m_rare_data && m_rare_data->accessibility_tree_node) {
+        parent.append_child(m_rare_data->accessibility_tree_node);
+        return;
+    }
+    m_needs_accessibility_tree_update = false;
+    m_child_needs_accessibility_tree_update = false;
+    if (m_rare_data)
+        m_rare_data->accessibility_tree_node = nullptr;
+
     if (is_uninteresting_whitespace_node())
         return;
 
     if (is_document()) {
         auto* document = static_cast<DOM::Document*>(this);
         auto* document_element = document->document_element();
-        if (document_element && document_element->include_in_accessibility_tree()) {
+        if (!document_element)
+            return;
+
+        // NB: The document element is built as the root of the tree, so it is never reused on its own.
+        document_element->m_needs_accessibility_tree_update = false;
+        document_element->m_child_needs_accessibility_tree_update = false;
+
+        if (document_element->include_in_accessibility_tree()) {
             parent.set_value(document_element);
             if (document_element->has_child_nodes())
                 document_element->for_each_child([&parent](DOM::Node& child) {
@@ -2891,6 +2975,7 @@ void Node::build_accessibility_tree(AccessibilityTreeNode& parent)
 
         if (element->include_in_accessibility_tree()) {
             auto current_node = AccessibilityTreeNode::create(&document(), this);
+            ensure_rare_data().accessibility_tree_node = current_node;
             parent.append_child(current_node);
             if (has_child_nodes()) {
                 for_each_child([&current_node](DOM::Node& child) {
@@ -2905,7 +2990,9 @@ void Node::build_accessibility_tree(AccessibilityTreeNode& parent)
             });
         }
     } else if (is_text()) {
-        parent.append_child(AccessibilityTreeNode::create(&document(), this));
+        auto current_node = AccessibilityTreeNode::create(&document(), this);
+        ensure_rare_data().accessibility_tree_node = current_node;
+        parent.append_child(current_node);
         if (has_child_nodes()) {
             for_each_child([&parent](DOM::Node& child) {
                 child.build_accessibility_tree(parent);
@@ -3390,9 +3477,7 @@ Optional<StringView> Node::first_valid_id(StringView value, Document const& docu
 
 void Node::add_registered_observer(RegisteredObserver& registered_observer)
 {
-    if (!m_registered_observer_list)
-        m_registered_observer_list = make<Vector<GC::Ref<RegisteredObserver>>>();
-    m_registered_observer_list->append(registered_observer);
+    ensure_rare_data().registered_observer_list.append(registered_observer);
 }
 
 bool Node::has_inclusive_ancestor_with_display_none()
@@ -3410,6 +3495,9 @@ bool Node::has_inclusive_ancestor_with_display_none()
 
 bool Node::has_inclusive_ancestor_with_event_listener(FlyString const& type) const
 {
+    if (!may_have_event_listener_of_type_anywhere(type))
+        return false;
+
     for (auto const* ancestor = this; ancestor; ancestor = ancestor->parent_or_shadow_host()) {
         if (ancestor->has_event_listener(type))
             return true;
@@ -70,6 +70,7 @@ enum class SetNeedsLayoutReason {
 [[nodiscard]] StringView to_string(SetNeedsLayoutReason);
 
 #define ENUMERATE_SET_NEEDS_LAYOUT_TREE_UPDATE_REASONS(X) \
+    X(ContentVisibilityAutoRelevanceChange)               \
     X(ElementSetInnerHTML)                                \
     X(ElementSetShadowRoot)                               \
     X(DetailsElementOpenedOrClosed)                       \
@@ -349,6 +350,17 @@ public:
     void invalidate_style(StyleInvalidationReason);
     void invalidate_style(StyleInvalidationReason, Vector<CSS::InvalidationSet::Property> const&, StyleInvalidationOptions);
 
+    // NB: Set when this node has to be built again the next time its document's accessibility tree is built, because it
+    //     changed in a way that may change whether or how it is exposed in that tree.
+    [[nodiscard]] bool needs_accessibility_tree_update() const { return m_needs_accessibility_tree_update; }
+    [[nodiscard]] bool child_needs_accessibility_tree_update() const { return m_child_needs_accessibility_tree_update; }
+    void set_needs_accessibility_tree_update();
+
+    // AD-HOC: This number changes whenever Document::dom_tree_version() is bumped for a change to this node's inclusive
+    //         descendants, so that caches that only depend on this node's subtree survive changes elsewhere.
+    u64 subtree_dom_tree_version() const { return m_subtree_dom_tree_version; }
+    void bump_dom_tree_version();
+
     void set_document(Badge<Document>, Document&);
     void set_document(Badge<NamedNodeMap>, Document&);
 
@@ -394,8 +406,8 @@ public:
 
     size_t length() const;
 
-    auto& registered_observer_list() { return m_registered_observer_list; }
-    auto const& registered_observer_list() const { return m_registered_observer_list; }
+    Vector<GC::Ref<RegisteredObserver>>* registered_observer_list() { return m_rare_data ? &m_rare_data->registered_observer_list : nullptr; }
+    Vector<GC::Ref<RegisteredObserver>> const* registered_observer_list() const { return m_rare_data ? &m_rare_data->registered_observer_list : nullptr; }
 
     void add_registered_observer(RegisteredObserver&);
 
@@ -475,19 +487,20 @@ protected:
     GC::Ptr<Layout::Node> m_layout_node;
     GC::Ptr<Painting::Paintable> m_paintable;
     NodeType m_type { NodeType::INVALID };
-    bool m_needs_layout_tree_update { false };
-    bool m_child_needs_layout_tree_update { false };
+    bool m_needs_layout_tree_update : 1 { false };
+    bool m_child_needs_layout_tree_update : 1 { false };
 
-    bool m_needs_style_update { false };
-    bool m_child_needs_style_update { false };
-    bool m_entire_subtree_needs_style_update { false };
-    bool m_in_editable_subtree { false };
+    bool m_needs_style_update : 1 { false };
+    bool m_child_needs_style_update : 1 { false };
+    bool m_entire_subtree_needs_style_update : 1 { false };
+    bool m_in_editable_subtree : 1 { false };
+
+    bool m_needs_accessibility_tree_update : 1 { false };
+    bool m_child_needs_accessibility_tree_update : 1 { false };
 
     UniqueNodeID m_unique_id;
 
-    // https://dom.spec.whatwg.org/#registered-observer-list
-    // "Nodes have a strong reference to registered observers in their registered observer list." https://dom.spec.whatwg.org/#garbage-collection
-    OwnPtr<Vector<GC::Ref<RegisteredObserver>>> m_registered_observer_list;
+    u64 m_subtree_dom_tree_version { 0 };
 
     void build_accessibility_tree(AccessibilityTreeNode& parent);
 
@@ -504,7 +517,21 @@ private:
 
     static Optional<StringView> first_valid_id(StringView, Document const&);
 
-    GC::Ptr<NodeList> m_child_nodes;
+    // NB: State that only a few nodes ever need, kept out of line so that it doesn't take up space in every node.
+    struct NodeRareData {
+        // https://dom.spec.whatwg.org/#registered-observer-list
+        // "Nodes have a strong reference to registered observers in their registered observer list." https://dom.spec.whatwg.org/#garbage-collection
+        Vector<GC::Ref<RegisteredObserver>> registered_observer_list;
+
+        GC::Ptr<NodeList> child_nodes;
+
+        // NB: The node that was built for this node the last time its document's accessibility tree was built.
+        GC::Ptr<AccessibilityTreeNode> accessibility_tree_node;
+    };
+
+    NodeRareData& ensure_rare_data();
+
+    OwnPtr<NodeRareData> m_rare_data;
 };
 
 }
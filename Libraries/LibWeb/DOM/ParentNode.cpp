@@ -43,6 +43,65 @@ static bool contains_named_namespace(CSS::SelectorList const& selectors)
     return false;
 }
 
+// OPTIMIZATION: An element can only match a selector if it has the ID, the classes and the type of the selector's
+//               rightmost compound selector. We pick the most selective of those, and check it before running the
+//               selector engine on an element.
+struct SubjectFilter {
+    enum class Type : u8 {
+        None,
+        Id,
+        Class,
+        TagName,
+    };
+
+    Type type { Type::None };
+    FlyString name {};
+};
+
+static SubjectFilter subject_filter_for_selector(CSS::Selector const& selector)
+{
+    SubjectFilter filter;
+    for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+        switch (simple_selector.type) {
+        case CSS::Selector::SimpleSelector::Type::Id:
+            return { SubjectFilter::Type::Id, simple_selector.name() };
+        case CSS::Selector::SimpleSelector::Type::Class:
+            if (filter.type != SubjectFilter::Type::Class)
+                filter = { SubjectFilter::Type::Class, simple_selector.name() };
+            break;
+        case CSS::Selector::SimpleSelector::Type::TagName:
+            if (filter.type == SubjectFilter::Type::None)
+                filter = { SubjectFilter::Type::TagName, simple_selector.qualified_name().name.lowercase_name };
+            break;
+        case CSS::Selector::SimpleSelector::Type::PseudoElement:
+            // NB: The subject of selectors like ::part() is not the element the rightmost compound selector describes.
+            return {};
+        default:
+            break;
+        }
+    }
+    return filter;
+}
+
+static bool element_may_match_subject_filter(Element const& element, SubjectFilter const& filter, Document const& document)
+{
+    switch (filter.type) {
+    case SubjectFilter::Type::None:
+        return true;
+    case SubjectFilter::Type::Id:
+        return element.id() == filter.name;
+    case SubjectFilter::Type::Class:
+        // Class selectors are matched case insensitively in quirks mode.
+        return element.has_class(filter.name, document.in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive);
+    case SubjectFilter::Type::TagName:
+        // NB: Only HTML elements in HTML documents are compared against the lowercased type selector.
+        if (element.namespace_uri() != Namespace::HTML || document.document_type() != Document::Type::HTML)
+            return true;
+        return element.local_name() == filter.name;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 enum class ReturnMatches {
     First,
     All,
@@ -84,12 +143,43 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
 
     auto const& selectors = *selectors_ptr;
 
+    Vector<SubjectFilter, 4> subject_filters;
+    subject_filters.ensure_capacity(selectors.size());
+    for (auto const& selector : selectors)
+        subject_filters.unchecked_append(subject_filter_for_selector(selector));
+
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     GC::Ptr<Element> single_result;
     Vector<GC::Root<Node>> results;
+
+    // OPTIMIZATION: If every match must have a given ID, we only need to look at the elements with that ID, which
+    //               connected documents and shadow roots keep track of.
+    if (selectors.size() == 1 && subject_filters[0].type == SubjectFilter::Type::Id && node.is_connected()) {
+        auto& root = node.root();
+        auto& element_by_id = root.is_shadow_root() ? static_cast<ShadowRoot&>(root).element_by_id() : document.element_by_id();
+        element_by_id.for_each_element_with_id(subject_filters[0].name, node, [&](Element& element) {
+            if (single_result || !element.is_descendant_of(node))
+                return;
+            SelectorEngine::MatchContext context;
+            if (!SelectorEngine::matches(selectors[0], element, nullptr, context, {}, node))
+                return;
+            if (return_matches == ReturnMatches::First)
+                single_result = &element;
+            else
+                results.append(element);
+        });
+
+        if (return_matches == ReturnMatches::First)
+            return { single_result };
+        return { StaticNodeList::create(node.realm(), move(results)) };
+    }
+
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
     node.for_each_in_subtree_of_type<Element>([&](auto& element) {
-        for (auto const& selector : selectors) {
+        for (size_t i = 0; i < selectors.size(); ++i) {
+            auto const& selector = selectors[i];
+            if (!element_may_match_subject_filter(element, subject_filters[i], document))
+                continue;
             SelectorEngine::MatchContext context;
             if (SelectorEngine::matches(selector, element, nullptr, context, {}, node)) {
                 if (return_matches == ReturnMatches::First) {
@@ -5,6 +5,8 @@
  */
 
 #include <AK/ScopeGuard.h>
+#include <LibWeb/CSS/StyleScope.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/DOM/ShadowRoot.h>
@@ -24,14 +26,78 @@ void StyleInvalidator::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     for (auto const& it : m_pending_invalidations)
         visitor.visit(it.key);
+    visitor.visit(m_appended_elements);
 }
 
 void StyleInvalidator::invalidate(Node& node)
 {
+    invalidate_appended_elements();
     perform_pending_style_invalidations(node, false);
     m_pending_invalidations.clear();
 }
 
+void StyleInvalidator::end_insertion_batch()
+{
+    VERIFY(m_insertion_batch_depth > 0);
+    if (--m_insertion_batch_depth == 0)
+        invalidate_appended_elements();
+}
+
+// Equivalent to invalidating the style of each element appended to parent in turn, but walking parent's ancestors and
+// children only once.
+static void invalidate_style_for_elements_appended_to(Node& parent, ReadonlySpan<GC::Ref<Element>> elements)
+{
+    auto& document = parent.document();
+    if (document.needs_full_style_update())
+        return;
+
+    // NB: Insertions that may affect :has() selectors need the full treatment.
+    auto& root = parent.root();
+    auto& style_scope = root.is_shadow_root() ? static_cast<ShadowRoot&>(root).style_scope() : document.style_scope();
+    if (style_scope.may_have_has_selectors()) {
+        for (auto& element : elements)
+            element->invalidate_style(StyleInvalidationReason::NodeInsertBefore);
+        return;
+    }
+
+    for (Node* ancestor = &parent; ancestor; ancestor = ancestor->parent_or_shadow_host()) {
+        if (ancestor->entire_subtree_needs_style_update())
+            return;
+    }
+
+    for (auto& element : elements)
+        element->set_entire_subtree_needs_style_update(true);
+
+    // NB: Every element was the last child when it was appended, so only preceding siblings can depend on it.
+    for (auto* sibling = parent.last_child(); sibling; sibling = sibling->previous_sibling()) {
+        if (auto* element = as_if<Element>(sibling); element && element->affected_by_backward_structural_changes())
+            element->set_entire_subtree_needs_style_update(true);
+    }
+
+    for (Node* ancestor = &parent; ancestor; ancestor = ancestor->parent_or_shadow_host())
+        ancestor->set_child_needs_style_update(true);
+}
+
+void StyleInvalidator::invalidate_appended_elements()
+{
+    if (m_appended_elements.is_empty())
+        return;
+
+    // NB: Parents are visited in the order their first element was appended in, which usually puts ancestors first, so
+    //     that their descendants find them already marked for an entire subtree update.
+    OrderedHashMap<GC::Ref<Node>, Vector<GC::Ref<Element>>> elements_by_parent;
+    for (auto& element : m_appended_elements) {
+        // NB: Elements that have been removed since were invalidated along with their former siblings.
+        if (auto* parent = element->parent()) {
+            elements_by_parent.ensure(*parent, [] { return Vector<GC::Ref<Element>> {}; }).append(element);
+        }
+    }
+    m_appended_elements.clear();
+
+    for (auto& it : elements_by_parent)
+        invalidate_style_for_elements_appended_to(it.key, it.value);
+}
+
 bool StyleInvalidator::enqueue_invalidation_plan(Node& node, StyleInvalidationReason reason, CSS::InvalidationPlan const& plan)
 {
     if (plan.is_empty())
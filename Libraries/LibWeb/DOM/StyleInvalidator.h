@@ -20,7 +20,17 @@ class StyleInvalidator : public GC::Cell {
 public:
     void invalidate(Node& node);
     bool enqueue_invalidation_plan(Node&, StyleInvalidationReason, CSS::InvalidationPlan const&);
-    bool has_pending_invalidations() const { return !m_pending_invalidations.is_empty(); }
+    bool has_pending_invalidations() const { return !m_pending_invalidations.is_empty() || !m_appended_elements.is_empty(); }
+
+    // OPTIMIZATION: Invalidating an appended element walks all of its ancestors and preceding siblings, which adds up
+    //               when the parser appends thousands of them one at a time. Within an insertion batch, appended
+    //               elements are only queued, and invalidated together (once per parent) when the outermost batch
+    //               ends or style is next updated.
+    void begin_insertion_batch() { ++m_insertion_batch_depth; }
+    void end_insertion_batch();
+    bool is_in_insertion_batch() const { return m_insertion_batch_depth > 0; }
+    void defer_invalidation_for_appended_element(Element& element) { m_appended_elements.append(element); }
+    void invalidate_appended_elements();
 
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
@@ -37,6 +47,9 @@ private:
 
     HashMap<GC::Ref<Node>, Vector<PendingDescendantInvalidation>> m_pending_invalidations;
     Vector<PendingDescendantInvalidation> m_active_descendant_invalidations;
+
+    Vector<GC::Ref<Element>> m_appended_elements;
+    size_t m_insertion_batch_depth { 0 };
 };
 
 }
@@ -128,10 +128,7 @@ void FetchedDataReceiver::pull_bytes_into_stream()
     //           is suspended, resume the fetch.
 
     // 2. Wait until buffer is not empty.
-    // NB: It would be nice to avoid a copy here, but ReadableStream::pull_from_bytes currently requires an allocated
-    //     ByteBuffer to create a JS::ArrayBuffer.
-    auto bytes = copy_unpulled_bytes();
-    VERIFY(!bytes.is_empty());
+    VERIFY(!buffer_is_eof());
 
     // 3. Queue a fetch task to run the following steps, with fetchParams’s task destination.
     VERIFY(!m_has_unfulfilled_promise);
@@ -140,14 +137,19 @@ void FetchedDataReceiver::pull_bytes_into_stream()
     Infrastructure::queue_fetch_task(
         m_fetch_params->controller(),
         m_fetch_params->task_destination(),
-        GC::create_function(heap(), [this, bytes = move(bytes), pending_promise = m_pending_promise]() mutable {
+        GC::create_function(heap(), [this, pending_promise = m_pending_promise]() mutable {
             m_has_unfulfilled_promise = false;
             VERIFY(m_lifecycle_state == LifecycleState::Receiving || m_lifecycle_state == LifecycleState::CompletePending);
 
             HTML::TemporaryExecutionContext execution_context { m_stream->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
             // 1. Pull from bytes buffer into stream.
-            if (auto result = m_stream->pull_from_bytes(move(bytes)); result.is_error()) {
+            // NB: The bytes are pulled straight out of our buffer when the task runs rather than copied out of it when
+            //     the task is queued. This picks up any bytes that arrived in the meantime, and lets a BYOB reader's
+            //     buffer be filled without an intermediate copy. Bytes that did not fit into a BYOB reader's buffer
+            //     stay in our buffer for the next pull.
+            auto result = m_stream->pull_from_bytes(unpulled_bytes());
+            if (result.is_error()) {
                 auto throw_completion = Bindings::exception_to_throw_completion(m_stream->vm(), result.release_error());
 
                 dbgln("FetchedDataReceiver: Stream error pulling bytes");
@@ -155,6 +157,7 @@ void FetchedDataReceiver::pull_bytes_into_stream()
 
                 return;
             }
+            m_pulled_bytes += result.value();
 
             // 2. If stream is errored, then terminate fetchParams’s controller.
             if (m_stream->is_errored())
@@ -190,12 +193,4 @@ void FetchedDataReceiver::close_stream()
     }
 }
 
-ByteBuffer FetchedDataReceiver::copy_unpulled_bytes()
-{
-    auto bytes = MUST(m_buffer.slice(m_pulled_bytes, m_buffer.size() - m_pulled_bytes));
-    m_pulled_bytes += bytes.size();
-
-    return bytes;
-}
-
 }
@@ -43,7 +43,7 @@ private:
     void close_stream();
 
     bool buffer_is_eof() const { return m_pulled_bytes == m_buffer.size(); }
-    ByteBuffer copy_unpulled_bytes();
+    ReadonlyBytes unpulled_bytes() const { return m_buffer.bytes().slice(m_pulled_bytes); }
 
     GC::Ref<Infrastructure::FetchParams const> m_fetch_params;
     GC::Ptr<Fetch::Infrastructure::Response const> m_response;
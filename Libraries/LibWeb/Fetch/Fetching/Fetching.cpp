@@ -50,6 +50,7 @@
 #include <LibWeb/FileAPI/BlobURLStore.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/Navigable.h>
+#include <LibWeb/HTML/PreloadedResources.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
@@ -154,6 +155,64 @@ static void store_response_in_cache(HTTP::MemoryCache& http_cache, Infrastructur
     http_cache.create_entry(request.current_url(), request.method(), request.header_list(), request.request_time(), response.status(), response.status_message(), response.header_list());
 }
 
+static RequestServer::RequestPriority internal_priority_for_request(Infrastructure::Request const& request)
+{
+    using Destination = Infrastructure::Request::Destination;
+    using RequestServer::RequestPriority;
+
+    auto priority = [&] {
+        // Speculative fetches are only ever useful later, if at all.
+        if (request.initiator().has_value() && request.initiator()->is_one_of(Infrastructure::Request::Initiator::Prefetch, Infrastructure::Request::Initiator::Prerender))
+            return RequestPriority::Lowest;
+
+        // Nothing can be rendered until render-blocking resources, stylesheets and documents have loaded.
+        if (request.render_blocking())
+            return RequestPriority::Highest;
+
+        // Requests without a destination come from fetch() or XMLHttpRequest, which scripts are usually waiting on.
+        if (!request.destination().has_value())
+            return RequestPriority::High;
+
+        switch (*request.destination()) {
+        case Destination::Document:
+        case Destination::Frame:
+        case Destination::IFrame:
+        case Destination::Style:
+            return RequestPriority::Highest;
+        case Destination::Font:
+        case Destination::Script:
+        case Destination::Worker:
+        case Destination::SharedWorker:
+        case Destination::ServiceWorker:
+            return RequestPriority::High;
+        case Destination::Audio:
+        case Destination::Track:
+        case Destination::Video:
+            return RequestPriority::Low;
+        case Destination::Image:
+            // NB: Images that turn out to be in the viewport are raised to high priority once layout has found them there.
+        default:
+            return RequestPriority::Medium;
+        }
+    }();
+
+    // Honor the priority hint given by the fetchpriority attribute or the priority option of fetch().
+    switch (request.priority()) {
+    case Infrastructure::Request::Priority::High:
+        if (priority != RequestPriority::Highest)
+            priority = static_cast<RequestPriority>(to_underlying(priority) - 1);
+        break;
+    case Infrastructure::Request::Priority::Low:
+        if (priority != RequestPriority::Lowest)
+            priority = static_cast<RequestPriority>(to_underlying(priority) + 1);
+        break;
+    case Infrastructure::Request::Priority::Auto:
+        break;
+    }
+
+    return priority;
+}
+
 // https://fetch.spec.whatwg.org/#concept-fetch
 GC::Ref<Infrastructure::FetchController> fetch(JS::Realm& realm, Infrastructure::Request& request, Infrastructure::FetchAlgorithms const& algorithms, UseParallelQueue use_parallel_queue)
 {
@@ -230,11 +289,11 @@ GC::Ref<Infrastructure::FetchController> fetch(JS::Realm& realm, Infrastructure:
             fetch_params->set_preloaded_response_candidate(response);
         });
 
-        // FIXME: 3. Let foundPreloadedResource be the result of invoking consume a preloaded resource for request’s
+        // 3. Let foundPreloadedResource be the result of invoking consume a preloaded resource for request’s
         //    window, given request’s URL, request’s destination, request’s mode, request’s credentials mode,
         //    request’s integrity metadata, and onPreloadedResponseAvailable.
-        auto found_preloaded_resource = false;
-        (void)on_preloaded_response_available;
+        auto& window = as<HTML::Window>(request.client()->global_object());
+        auto found_preloaded_resource = window.associated_document().map_of_preloaded_resources().consume(request.url(), request.destination(), request.mode(), request.credentials_mode(), request.integrity_metadata(), on_preloaded_response_available);
 
         // 4. If foundPreloadedResource is true and fetchParams’s preloaded response candidate is null, then set
         //    fetchParams’s preloaded response candidate to "pending".
@@ -304,6 +363,8 @@ GC::Ref<Infrastructure::FetchController> fetch(JS::Realm& realm, Infrastructure:
     //     implementation-defined object.
     // NOTE: The user-agent-defined object could encompass stream weight and dependency for HTTP/2, and equivalent
     //       information used to prioritize dispatch and processing of HTTP/1 fetches.
+    if (!request.internal_priority().has_value())
+        request.set_internal_priority(Infrastructure::Request::InternalPriority { .priority = internal_priority_for_request(request) });
 
     // 14. If request is a subresource request, then:
     if (request.is_subresource_request()) {
@@ -446,9 +507,15 @@ GC::Ptr<PendingResponse> main_fetch(JS::Realm& realm, Infrastructure::FetchParam
         // -> fetchParams’s preloaded response candidate is not null
         if (!fetch_params.preloaded_response_candidate().has<Empty>()) {
             // 1. Wait until fetchParams’s preloaded response candidate is not "pending".
-            HTML::main_thread_event_loop().spin_until(GC::create_function(vm.heap(), [&] {
-                return !fetch_params.preloaded_response_candidate().has<Infrastructure::FetchParams::PreloadedResponseCandidatePendingTag>();
-            }));
+            // NB: Rather than spinning the event loop, which could run tasks while the HTML parser is in the middle of
+            //     inserting an element, we hand out a pending response that is resolved once the candidate is set.
+            if (fetch_params.preloaded_response_candidate().has<Infrastructure::FetchParams::PreloadedResponseCandidatePendingTag>()) {
+                auto pending_response = PendingResponse::create(vm, request);
+                fetch_params.set_on_preloaded_response_candidate_available(GC::create_function(vm.heap(), [pending_response](GC::Ref<Infrastructure::Response> response) {
+                    pending_response->resolve(response);
+                }));
+                return pending_response;
+            }
 
             // 2. Assert: fetchParams’s preloaded response candidate is a response.
             VERIFY(fetch_params.preloaded_response_candidate().has<GC::Ref<Infrastructure::Response>>());
@@ -1680,8 +1747,10 @@ GC::Ref<PendingResponse> http_network_or_cache_fetch(JS::Realm& realm, Infrastru
         // 13. Append the Fetch metadata headers for httpRequest.
         append_fetch_metadata_headers_for_request(*http_request);
 
-        // 14. FIXME: If httpRequest’s initiator is "prefetch", then set a structured field value
+        // 14. If httpRequest’s initiator is "prefetch", then set a structured field value
         //     given (`Sec-Purpose`, the token prefetch) in httpRequest’s header list.
+        if (http_request->initiator() == Infrastructure::Request::Initiator::Prefetch)
+            http_request->header_list()->set({ "Sec-Purpose"sv, "prefetch"sv });
 
         // 15. If httpRequest’s header list does not contain `User-Agent`, then user agents should append
         //     (`User-Agent`, default `User-Agent` value) to httpRequest’s header list.
@@ -2068,6 +2137,8 @@ GC::Ref<PendingResponse> nonstandard_resource_loader_file_or_http_network_fetch(
     load_request.set_cache_mode(request->cache_mode());
     load_request.set_include_credentials(include_credentials);
     load_request.set_initiator_type(request->initiator_type());
+    if (auto const& internal_priority = request->internal_priority(); internal_priority.has_value())
+        load_request.set_priority(internal_priority->priority);
 
     if (auto const* body = request->body().get_pointer<GC::Ref<Infrastructure::Body>>()) {
         (*body)->source().visit(
@@ -39,6 +39,22 @@ void FetchController::set_pending_request(RefPtr<Requests::Request> const& reque
     m_pending_request = request;
 }
 
+void FetchController::raise_priority(RequestServer::RequestPriority priority)
+{
+    if (!m_fetch_params || m_state != State::Ongoing)
+        return;
+
+    // NB: The more urgent a priority is, the lower its value.
+    auto request = m_fetch_params->request();
+    if (auto const& internal_priority = request->internal_priority(); internal_priority.has_value() && internal_priority->priority <= priority)
+        return;
+
+    request->set_internal_priority(Request::InternalPriority { .priority = priority });
+
+    if (m_pending_request)
+        m_pending_request->set_priority(priority);
+}
+
 void FetchController::set_report_timing_steps(Function<void(JS::Object&)> report_timing_steps)
 {
     m_report_timing_steps = GC::create_function(vm().heap(), move(report_timing_steps));
@@ -20,6 +20,7 @@
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 #include <LibWeb/HTML/StructuredSerializeTypes.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Web::Fetch::Infrastructure {
 
@@ -54,6 +55,9 @@ public:
     void set_fetch_params(Badge<FetchParams>, GC::Ref<FetchParams> fetch_params) { m_fetch_params = fetch_params; }
 
     void set_pending_request(RefPtr<Requests::Request> const&);
+
+    // Makes the fetch at least as urgent as the given priority, including the network request that may be in flight.
+    void raise_priority(RequestServer::RequestPriority);
     void set_inner_fetch_controller(GC::Ref<FetchController>);
 
     void stop_fetch();
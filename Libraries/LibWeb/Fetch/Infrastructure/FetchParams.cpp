@@ -56,6 +56,14 @@ void FetchParams::visit_edges(JS::Cell::Visitor& visitor)
         visitor.visit(m_task_destination.get<GC::Ref<JS::Object>>());
     if (m_preloaded_response_candidate.has<GC::Ref<Response>>())
         visitor.visit(m_preloaded_response_candidate.get<GC::Ref<Response>>());
+    visitor.visit(m_on_preloaded_response_candidate_available);
+}
+
+void FetchParams::set_preloaded_response_candidate(PreloadedResponseCandidate preloaded_response_candidate)
+{
+    m_preloaded_response_candidate = move(preloaded_response_candidate);
+    if (auto const* response = m_preloaded_response_candidate.get_pointer<GC::Ref<Response>>(); response && m_on_preloaded_response_candidate_available)
+        exchange(m_on_preloaded_response_candidate_available, nullptr)->function()(*response);
 }
 
 // https://fetch.spec.whatwg.org/#fetch-params-aborted
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Forward.h>
+#include <LibGC/Function.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
@@ -48,7 +49,11 @@ public:
 
     [[nodiscard]] PreloadedResponseCandidate& preloaded_response_candidate() { return m_preloaded_response_candidate; }
     [[nodiscard]] PreloadedResponseCandidate const& preloaded_response_candidate() const { return m_preloaded_response_candidate; }
-    void set_preloaded_response_candidate(PreloadedResponseCandidate preloaded_response_candidate) { m_preloaded_response_candidate = move(preloaded_response_candidate); }
+    void set_preloaded_response_candidate(PreloadedResponseCandidate);
+
+    // NB: Called once the preloaded response candidate is set to a response, so that main fetch can wait for a
+    //     "pending" candidate without blocking.
+    void set_on_preloaded_response_candidate_available(GC::Ptr<GC::Function<void(GC::Ref<Response>)>> callback) const { m_on_preloaded_response_candidate_available = callback; }
 
     [[nodiscard]] bool is_aborted() const;
     [[nodiscard]] bool is_canceled() const;
@@ -103,6 +108,8 @@ private:
     // preloaded response candidate (default null)
     //     Null, "pending", or a response.
     PreloadedResponseCandidate m_preloaded_response_candidate;
+
+    mutable GC::Ptr<GC::Function<void(GC::Ref<Response>)>> m_on_preloaded_response_candidate_available;
 };
 
 }
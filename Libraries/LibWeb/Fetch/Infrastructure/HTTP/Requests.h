@@ -26,6 +26,7 @@
 #include <LibWeb/Export.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Web::Fetch::Infrastructure {
 
@@ -154,7 +155,10 @@ public:
     };
 
     // Members are implementation-defined
-    struct InternalPriority { };
+    struct InternalPriority {
+        // The priority RequestServer schedules the request's network fetch with.
+        RequestServer::RequestPriority priority { RequestServer::RequestPriority::Medium };
+    };
 
     using BodyType = Variant<Empty, ByteBuffer, GC::Ref<Body>>;
     using OriginType = Variant<Origin, URL::Origin>;
@@ -213,6 +217,9 @@ public:
     [[nodiscard]] Priority const& priority() const { return m_priority; }
     void set_priority(Priority priority) { m_priority = priority; }
 
+    [[nodiscard]] Optional<InternalPriority> const& internal_priority() const { return m_internal_priority; }
+    void set_internal_priority(Optional<InternalPriority> internal_priority) { m_internal_priority = move(internal_priority); }
+
     [[nodiscard]] OriginType const& origin() const { return m_origin; }
     void set_origin(OriginType origin) { m_origin = move(origin); }
 
@@ -825,6 +825,7 @@ class Path2D;
 class Plugin;
 class PluginArray;
 class PopoverTargetAttributes;
+class PreloadedResources;
 class PromiseRejectionEvent;
 class RadioNodeList;
 class SelectedFile;
@@ -975,6 +976,14 @@ struct LayoutState;
 
 }
 
+namespace Web::LongAnimationFrames {
+
+class PerformanceLongAnimationFrameTiming;
+
+struct FrameTimingInfo;
+
+}
+
 namespace Web::MathML {
 
 class MathMLElement;
@@ -1078,6 +1087,8 @@ namespace Web::Platform {
 
 class Timer;
 
+struct DecodedImage;
+
 }
 
 namespace Web::ReferrerPolicy {
@@ -1104,6 +1115,14 @@ class PerformanceResourceTiming;
 
 }
 
+namespace Web::Scheduling {
+
+class Scheduler;
+
+struct SchedulerPostTaskOptions;
+
+}
+
 namespace Web::Selection {
 
 class Selection;
@@ -1126,6 +1145,8 @@ struct SerialPortInfo;
 
 namespace Web::ServiceWorker {
 
+class Cache;
+class CacheStorage;
 class ServiceWorker;
 class ServiceWorkerContainer;
 class ServiceWorkerRegistration;
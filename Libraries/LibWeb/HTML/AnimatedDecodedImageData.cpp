@@ -80,6 +80,9 @@ GC::Ref<AnimatedDecodedImageData> AnimatedDecodedImageData::create(
     install_frame_delivery_callback();
     session_registry().set(session_id, data.ptr());
 
+    data->mark_as_used();
+    enforce_buffered_frames_byte_budget();
+
     return data;
 }
 
@@ -127,8 +130,88 @@ AnimatedDecodedImageData::BufferSlot& AnimatedDecodedImageData::evict_oldest_slo
     return *oldest;
 }
 
+AnimatedDecodedImageData::BufferSlot* AnimatedDecodedImageData::oldest_discardable_slot()
+{
+    BufferSlot* oldest = nullptr;
+    for (auto& slot : m_buffer_slots) {
+        // NB: The frame that is being displayed stays alive through m_last_displayed_bitmap, so discarding it would not
+        //     free anything.
+        if (!slot.bitmap || slot.bitmap == m_last_displayed_bitmap)
+            continue;
+        if (!oldest || slot.generation < oldest->generation)
+            oldest = &slot;
+    }
+    return oldest;
+}
+
+void AnimatedDecodedImageData::discard_slot(BufferSlot& slot)
+{
+    slot = {};
+}
+
+static size_t frame_byte_size(Gfx::ImmutableBitmap const& bitmap)
+{
+    return static_cast<size_t>(bitmap.width()) * bitmap.height() * sizeof(Gfx::RawPixel);
+}
+
+size_t AnimatedDecodedImageData::buffered_frames_byte_size() const
+{
+    size_t size = 0;
+    for (auto const& slot : m_buffer_slots) {
+        if (slot.bitmap)
+            size += frame_byte_size(*slot.bitmap);
+    }
+    return size;
+}
+
+void AnimatedDecodedImageData::mark_as_used() const
+{
+    static u64 s_use_counter = 0;
+    m_last_use = ++s_use_counter;
+}
+
+void AnimatedDecodedImageData::enforce_buffered_frames_byte_budget()
+{
+    size_t total_size = 0;
+    for (auto const& it : session_registry()) {
+        if (auto data = it.value)
+            total_size += data->buffered_frames_byte_size();
+    }
+
+    while (total_size > BUFFERED_FRAMES_BYTE_BUDGET) {
+        // Drop the oldest frame of the animation that was displayed least recently and still has frames to spare.
+        AnimatedDecodedImageData* least_recently_used = nullptr;
+        BufferSlot* slot_to_discard = nullptr;
+        for (auto const& it : session_registry()) {
+            auto* data = it.value.ptr();
+            if (!data || (least_recently_used && data->m_last_use >= least_recently_used->m_last_use))
+                continue;
+            if (auto* slot = data->oldest_discardable_slot()) {
+                least_recently_used = data;
+                slot_to_discard = slot;
+            }
+        }
+
+        if (!slot_to_discard)
+            break;
+
+        total_size -= frame_byte_size(*slot_to_discard->bitmap);
+        least_recently_used->discard_slot(*slot_to_discard);
+    }
+}
+
+void AnimatedDecodedImageData::discard_buffered_frames()
+{
+    for (auto& slot : m_buffer_slots) {
+        if (slot.bitmap && slot.bitmap != m_last_displayed_bitmap)
+            discard_slot(slot);
+    }
+}
+
 RefPtr<Gfx::ImmutableBitmap> AnimatedDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize) const
 {
+    mark_as_used();
+
     if (frame_index >= m_frame_count)
         return m_last_displayed_bitmap;
 
@@ -194,12 +277,16 @@ void AnimatedDecodedImageData::receive_frames(Vector<NonnullRefPtr<Gfx::Bitmap>>
         slot.bitmap = Gfx::ImmutableBitmap::create(*bitmaps[i], m_color_space);
         slot.generation = ++m_write_generation;
     }
+
+    enforce_buffered_frames_byte_budget();
 }
 
 size_t AnimatedDecodedImageData::notify_frame_advanced(size_t caller_frame_index)
 {
     // We own the frame progression. Only advance when a caller reports
     // the expected next frame (this deduplicates multiple callers per tick).
+    mark_as_used();
+
     size_t expected_next = (m_current_frame_index + 1) % m_frame_count;
     if (caller_frame_index == expected_next) {
         m_current_frame_index = expected_next;
@@ -50,6 +50,7 @@ public:
     virtual void paint(DisplayListRecordingContext&, size_t frame_index, Gfx::IntRect dst_rect, Gfx::IntRect clip_rect, Gfx::ScalingMode) const override;
 
     virtual size_t notify_frame_advanced(size_t caller_frame_index) override;
+    virtual void discard_buffered_frames() override;
 
     void receive_frames(Vector<NonnullRefPtr<Gfx::Bitmap>>, u32 start_frame_index);
 
@@ -64,6 +65,11 @@ private:
     static constexpr u32 BUFFER_POOL_SIZE = 8;
     static constexpr u32 REQUEST_BATCH_SIZE = 4;
 
+    // The frames buffered by all animations in this process together may not take up more memory than this. Once they
+    // do, frames are dropped from the animations that were displayed least recently.
+    static constexpr size_t BUFFERED_FRAMES_BYTE_BUDGET = 128 * MiB;
+    static void enforce_buffered_frames_byte_budget();
+
     struct BufferSlot {
         Optional<u32> frame_index;
         RefPtr<Gfx::ImmutableBitmap> bitmap;
@@ -80,6 +86,10 @@ private:
 
     BufferSlot const* find_slot(u32 frame_index) const;
     BufferSlot& evict_oldest_slot();
+    BufferSlot* oldest_discardable_slot();
+    void discard_slot(BufferSlot&);
+    size_t buffered_frames_byte_size() const;
+    void mark_as_used() const;
     void maybe_request_more_frames(size_t current_frame_index);
 
     i64 m_session_id;
@@ -92,6 +102,7 @@ private:
     Array<BufferSlot, BUFFER_POOL_SIZE> m_buffer_slots;
     mutable RefPtr<Gfx::ImmutableBitmap> m_last_displayed_bitmap;
     u64 m_write_generation { 0 };
+    mutable u64 m_last_use { 0 };
     bool m_request_in_flight { false };
     u32 m_current_frame_index { 0 };
     u32 m_last_requested_start_frame { 0 };
@@ -15,6 +15,8 @@
 #include <LibGfx/Filter.h>
 #include <LibGfx/FontCascadeList.h>
 #include <LibGfx/PaintStyle.h>
+#include <LibGfx/Path.h>
+#include <LibGfx/WindingRule.h>
 #include <LibWeb/Bindings/CanvasRenderingContext2DPrototype.h>
 #include <LibWeb/CSS/Length.h>
 #include <LibWeb/CSS/StyleValues/StyleValue.h>
@@ -146,4 +148,8 @@ private:
     bool m_context_lost { false };
 };
 
+Gfx::Path::CapStyle to_gfx_cap(Bindings::CanvasLineCap const&);
+Gfx::Path::JoinStyle to_gfx_join(Bindings::CanvasLineJoin const&);
+Gfx::WindingRule parse_fill_rule(StringView fill_rule);
+
 }
@@ -210,6 +210,12 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::draw_image_internal(CanvasIm
 
 void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
 {
+    // OPTIMIZATION: Skia only records the drawing operations and executes them all at once when the canvas is presented,
+    //               so a repaint needs to be scheduled only by the first draw since the last presentation. This keeps
+    //               pages that draw many times per frame from walking the paintables for every single draw.
+    if (canvas_element().canvas_content_is_dirty())
+        return;
+
     // FIXME: Make use of the rect to reduce the invalidated area when possible.
     canvas_element().set_canvas_content_dirty();
     canvas_element().set_needs_repaint(InvalidateDisplayList::No);
@@ -243,11 +249,19 @@ void CanvasRenderingContext2D::allocate_painting_surface_if_needed()
     // FIXME: implement context attribute .color_space
     // FIXME: implement context attribute .color_type
     // FIXME: implement context attribute .desynchronized
-    // FIXME: implement context attribute .will_read_frequently
 
     auto color_type = m_context_attributes.alpha ? Gfx::BitmapFormat::BGRA8888 : Gfx::BitmapFormat::BGRx8888;
-
-    m_surface = Gfx::PaintingSurface::create_with_size(canvas_element().bitmap_size_for_canvas(), color_type, Gfx::AlphaType::Premultiplied);
+    auto size = canvas_element().bitmap_size_for_canvas();
+
+    // https://html.spec.whatwg.org/multipage/canvas.html#concept-canvas-will-read-frequently
+    // When a CanvasRenderingContext2D object's will read frequently is true, the user agent may optimize the canvas
+    // for readback operations.
+    // NB: Pixels are read from a CPU-backed surface without waiting for the GPU and copying them back from it, so we
+    //     keep such a canvas on the CPU.
+    if (m_context_attributes.will_read_frequently)
+        m_surface = Gfx::PaintingSurface::wrap_bitmap(MUST(Gfx::Bitmap::create(color_type, Gfx::AlphaType::Premultiplied, size)));
+    else
+        m_surface = Gfx::PaintingSurface::create_with_size(size, color_type, Gfx::AlphaType::Premultiplied);
     m_painter = nullptr;
 
     // https://html.spec.whatwg.org/multipage/canvas.html#the-canvas-settings:concept-canvas-alpha
@@ -383,33 +397,6 @@ void CanvasRenderingContext2D::begin_path()
     path().clear();
 }
 
-static Gfx::Path::CapStyle to_gfx_cap(Bindings::CanvasLineCap const& cap_style)
-{
-    switch (cap_style) {
-    case Bindings::CanvasLineCap::Butt:
-        return Gfx::Path::CapStyle::Butt;
-    case Bindings::CanvasLineCap::Round:
-        return Gfx::Path::CapStyle::Round;
-    case Bindings::CanvasLineCap::Square:
-        return Gfx::Path::CapStyle::Square;
-    }
-    VERIFY_NOT_REACHED();
-}
-
-static Gfx::Path::JoinStyle to_gfx_join(Bindings::CanvasLineJoin const& join_style)
-{
-    switch (join_style) {
-    case Bindings::CanvasLineJoin::Round:
-        return Gfx::Path::JoinStyle::Round;
-    case Bindings::CanvasLineJoin::Bevel:
-        return Gfx::Path::JoinStyle::Bevel;
-    case Bindings::CanvasLineJoin::Miter:
-        return Gfx::Path::JoinStyle::Miter;
-    }
-
-    VERIFY_NOT_REACHED();
-}
-
 // https://html.spec.whatwg.org/multipage/canvas.html#the-canvas-settings:concept-canvas-alpha
 Gfx::Color CanvasRenderingContext2D::clear_color() const
 {
@@ -452,16 +439,6 @@ void CanvasRenderingContext2D::stroke(Path2D const& path)
     stroke_internal(path.path());
 }
 
-static Gfx::WindingRule parse_fill_rule(StringView fill_rule)
-{
-    if (fill_rule == "evenodd"sv)
-        return Gfx::WindingRule::EvenOdd;
-    if (fill_rule == "nonzero"sv)
-        return Gfx::WindingRule::Nonzero;
-    dbgln("Unrecognized fillRule for CRC2D.fill() - this problem goes away once we pass an enum instead of a string");
-    return Gfx::WindingRule::Nonzero;
-}
-
 void CanvasRenderingContext2D::fill_internal(Gfx::Path const& path, Gfx::WindingRule winding_rule)
 {
     auto* painter = this->painter();
@@ -544,9 +521,9 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
 
     // NOTE: We don't attempt to create the underlying bitmap here; if it doesn't exist, it's like copying only transparent black pixels (which is a no-op).
-    if (!canvas_element().surface())
+    auto surface = canvas_element().surface();
+    if (!surface)
         return image_data;
-    auto const snapshot = Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*canvas_element().surface());
 
     // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
     auto source_rect = Gfx::Rect { x, y, abs_width, abs_height };
@@ -557,17 +534,17 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     if (width < 0 || height < 0) {
         source_rect = source_rect.translated(min(width, 0), min(height, 0));
     }
-    auto source_rect_intersected = source_rect.intersected(snapshot->rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
     // NOTE: Internally we must use premultiplied alpha, but ImageData should hold unpremultiplied alpha. This conversion
     //       might result in a loss of precision, but is according to spec.
     //       See: https://html.spec.whatwg.org/multipage/canvas.html#premultiplied-alpha-and-the-2d-rendering-context
-    VERIFY(snapshot->alpha_type() == Gfx::AlphaType::Premultiplied);
     VERIFY(image_data->bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
 
-    auto painter = Gfx::Painter::create(image_data->bitmap());
-    painter->draw_bitmap(image_data->bitmap().rect().to_type<float>(), *snapshot, source_rect_intersected, Gfx::ScalingMode::NearestNeighbor, {}, 1, Gfx::CompositingAndBlendingOperator::SourceOver);
+    // OPTIMIZATION: Only the source rectangle is read back from the surface, which converts it to unpremultiplied alpha
+    //               along the way. This avoids copying the whole output bitmap, which for a GPU-backed canvas means
+    //               reading all of it back from the GPU.
+    surface->read_into_bitmap(image_data->bitmap(), source_rect.location());
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
     // NOTE: No-op, already done during creation.
@@ -581,8 +558,9 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_image_data(ImageData& im
 {
     // The putImageData(imageData, dx, dy) method steps are to put pixels from an ImageData onto a bitmap,
     // given imageData, this's output bitmap, dx, dy, 0, 0, imageData's width, and imageData's height.
-    if (auto* painter = this->painter())
-        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *painter, dx, dy, 0, 0, image_data.width(), image_data.height()));
+    allocate_painting_surface_if_needed();
+    if (auto surface = canvas_element().surface())
+        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *surface, dx, dy, 0, 0, image_data.width(), image_data.height()));
 
     return {};
 }
@@ -593,14 +571,15 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_image_data(ImageData& im
     // The putImageData(imageData, dx, dy, dirtyX, dirtyY, dirtyWidth, dirtyHeight) method steps are to put pixels
     // from an ImageData onto a bitmap, given imageData, this's output bitmap, dx, dy, dirtyX, dirtyY, dirtyWidth, and
     // dirtyHeight.
-    if (auto* painter = this->painter())
-        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *painter, x, y, dirty_x, dirty_y, dirty_width, dirty_height));
+    allocate_painting_surface_if_needed();
+    if (auto surface = canvas_element().surface())
+        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *surface, x, y, dirty_x, dirty_y, dirty_width, dirty_height));
 
     return {};
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-context2d-putimagedata-common
-WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_pixels_from_an_image_data_onto_a_bitmap(ImageData& image_data, Gfx::Painter& painter, float dx, float dy, float dirty_x, float dirty_y, float dirty_width, float dirty_height)
+WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_pixels_from_an_image_data_onto_a_bitmap(ImageData& image_data, Gfx::PaintingSurface& surface, float dx, float dy, float dirty_x, float dirty_y, float dirty_width, float dirty_height)
 {
     // 1. Let buffer be imageData's data attribute value's [[ViewedArrayBuffer]] internal slot.
     auto* buffer = image_data.data()->viewed_array_buffer();
@@ -654,19 +633,14 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_pixels_from_an_image_dat
     //    set the pixel with coordinate (dx+x, dy+y) in bitmap to the color of the pixel at coordinate (x, y) in the
     //    imageData data structure's bitmap, converted from imageData's colorSpace to the color space of bitmap using
     //    'relative-colorimetric' rendering intent.
-    auto dst_rect = Gfx::FloatRect { dx + dirty_x, dy + dirty_y, dirty_width, dirty_height };
-    painter.save();
-    painter.set_transform({});
-    painter.draw_bitmap(
-        dst_rect,
-        Gfx::ImmutableBitmap::create(image_data.bitmap(), Gfx::AlphaType::Unpremultiplied),
-        Gfx::IntRect { dirty_x, dirty_y, dirty_width, dirty_height },
-        Gfx::ScalingMode::NearestNeighbor,
-        {},
-        1.0f,
-        Gfx::CompositingAndBlendingOperator::SourceOver);
-    painter.restore();
+    // NB: Unlike drawing the pixels, writing them replaces the pixels of the bitmap including their alpha, and is not
+    //     affected by the transform, clip, global alpha or compositing operator, as required. The dirty rectangle (but
+    //     nothing else) is converted to the format of the bitmap along the way.
+    auto source_rect = Gfx::IntRect { dirty_x, dirty_y, dirty_width, dirty_height };
+    auto destination_position = Gfx::IntPoint { dx + dirty_x, dy + dirty_y };
+    surface.write_from_bitmap(image_data.bitmap(), source_rect, destination_position);
 
+    auto dst_rect = Gfx::FloatRect { dx + dirty_x, dy + dirty_y, dirty_width, dirty_height };
     did_draw(dst_rect);
 
     return {};
@@ -34,6 +34,10 @@ public:
 
     virtual size_t notify_frame_advanced(size_t frame_index) { return frame_index; }
 
+    // Called when the image is no longer being displayed anywhere, so that any frames which were decoded ahead of time
+    // can be released. The frame that was displayed last must stay available.
+    virtual void discard_buffered_frames() { }
+
     virtual Optional<CSSPixels> intrinsic_width() const = 0;
     virtual Optional<CSSPixels> intrinsic_height() const = 0;
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const = 0;
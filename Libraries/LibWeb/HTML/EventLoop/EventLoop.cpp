@@ -7,6 +7,7 @@
 
 #include <AK/TemporaryChange.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/Tracing.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/FontComputer.h>
@@ -24,6 +25,7 @@
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
@@ -34,6 +36,8 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(EventLoop);
 
+static constexpr double minimum_idle_period_for_garbage_collection_ms = 10;
+
 EventLoop::EventLoop(Type type)
     : m_type(type)
 {
@@ -160,7 +164,7 @@ void EventLoop::process()
 
     // 1. Let oldestTask and taskStartTime be null.
     GC::Ptr<Task> oldest_task;
-    [[maybe_unused]] double task_start_time = 0;
+    double task_start_time = 0;
 
     // Some algorithms request that steps or states only occur once the event loop has reached step 1.
     // Invoke a set of tasks that these algorithms request us to in order to achieve this.
@@ -179,7 +183,10 @@ void EventLoop::process()
         // 3. Set oldestTask to the first runnable task in taskQueue, and remove it from taskQueue.
         oldest_task = task_queue->take_first_runnable();
 
-        // FIXME: 4. If oldestTask's document is not null, then record task start time given taskStartTime and oldestTask's document.
+        // 4. If oldestTask's document is not null, then record task start time given taskStartTime and oldestTask's document.
+        // NB: Tasks only keep a const reference to their document, but recording the task's timing updates it.
+        if (auto* document = const_cast<DOM::Document*>(oldest_task->document()))
+            LongAnimationFrames::record_task_start_time(*document, task_start_time);
 
         // 5. Set the event loop's currently running task to oldestTask.
         m_currently_running_task = oldest_task.ptr();
@@ -195,7 +202,7 @@ void EventLoop::process()
     }
 
     // 3. Let taskEndTime be the unsafe shared current time. [HRT]
-    [[maybe_unused]] auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
+    auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
 
     // 4. If oldestTask is not null, then:
     if (oldest_task) {
@@ -207,7 +214,9 @@ void EventLoop::process()
         // FIXME: 2.4. Let tlbc be global's browsing context's top-level browsing context.
         // FIXME: 2.5. If tlbc is not null, then append it to top-level browsing contexts.
         // FIXME: 3. Report long tasks, passing in taskStartTime, taskEndTime, top-level browsing contexts, and oldestTask.
-        // FIXME: 4. If oldestTask's document is not null, then record task end time given taskEndTime and oldestTask's document.
+        // 4. If oldestTask's document is not null, then record task end time given taskEndTime and oldestTask's document.
+        if (auto* document = const_cast<DOM::Document*>(oldest_task->document()))
+            LongAnimationFrames::record_task_end_time(*document, task_end_time);
     }
 
     // 5. If this is a window event loop that has no runnable task in this event loop's task queues, then:
@@ -222,6 +231,15 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // NB: Use the idle period to pay off allocation debt early, as long as it's long enough to fit a collection.
+        //     This makes it less likely that a collection is triggered in the middle of a task or rendering update.
+        if (compute_deadline() - m_last_idle_period_start_time >= minimum_idle_period_for_garbage_collection_ms)
+            heap().collect_garbage_if_past_idle_threshold();
+
+        // NB: Blocks left empty by earlier collections are not decommitted until a while later, so we also check for
+        //     them when idle, rather than wait for the next collection.
+        heap().decommit_unused_blocks();
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
@@ -268,6 +286,7 @@ void EventLoop::process_input_events() const
 
         // Process events only for this page, collecting others to re-enqueue
         Queue<Web::QueuedInputEvent> events_for_other_pages;
+        bool has_handled_wheel_events = false;
 
         while (!input_events_queue.is_empty()) {
             auto event = input_events_queue.dequeue();
@@ -298,8 +317,12 @@ void EventLoop::process_input_events() const
                         return page.handle_mousemove(mouse_event.position, mouse_event.screen_position, mouse_event.buttons, mouse_event.modifiers);
                     case MouseEvent::Type::MouseLeave:
                         return page.handle_mouseleave();
-                    case MouseEvent::Type::MouseWheel:
-                        return page.handle_mousewheel(mouse_event.position, mouse_event.screen_position, mouse_event.button, mouse_event.buttons, mouse_event.modifiers, mouse_event.wheel_delta_x, mouse_event.wheel_delta_y);
+                    case MouseEvent::Type::MouseWheel: {
+                        auto result = page.handle_mousewheel(mouse_event.position, mouse_event.screen_position, mouse_event.button, mouse_event.buttons, mouse_event.modifiers, mouse_event.wheel_delta_x, mouse_event.wheel_delta_y);
+                        if (result == EventResult::Handled)
+                            has_handled_wheel_events = true;
+                        return result;
+                    }
                     }
                     VERIFY_NOT_REACHED();
                 },
@@ -320,6 +343,9 @@ void EventLoop::process_input_events() const
             input_events_queue.enqueue(events_for_other_pages.dequeue());
         }
 
+        if (has_handled_wheel_events)
+            page.top_level_traversable()->present_scrolled_frame();
+
         page.handle_sdl_input_events();
     };
 
@@ -347,6 +373,11 @@ void EventLoop::update_the_rendering()
         m_running_rendering_task = false;
     };
 
+    TRACE_EVENT("html", "EventLoop::update_the_rendering");
+
+    // NB: This is when the rendering update started for the purposes of long animation frame timing.
+    auto unsafe_rendering_start_time = HighResolutionTime::unsafe_shared_current_time();
+
     process_input_events();
 
     // 1. Let frameTimestamp be eventLoop's last render opportunity time.
@@ -430,7 +461,8 @@ void EventLoop::update_the_rendering()
         run_animation_frame_callbacks(*document, now);
     }
 
-    // FIXME: 15. Let unsafeStyleAndLayoutStartTime be the unsafe shared current time.
+    // 15. Let unsafeStyleAndLayoutStartTime be the unsafe shared current time.
+    auto unsafe_style_and_layout_start_time = HighResolutionTime::unsafe_shared_current_time();
 
     // 16. For each doc of docs:
     for (auto& document : docs) {
@@ -467,6 +499,11 @@ void EventLoop::update_the_rendering()
                     if (check_for_initial_determination && element.is_relevant_to_the_user()) {
                         had_initial_visible_content_visibility_determination = true;
                     }
+
+                    // NB: The contents of an element that skips them don't get any layout nodes, so the element's
+                    //     layout subtree has to be rebuilt whenever that changes.
+                    if (element.skips_its_contents() != element.contents_skipped_in_layout_tree())
+                        element.set_needs_layout_tree_update(true, DOM::SetNeedsLayoutTreeUpdateReason::ContentVisibilityAutoRelevanceChange);
                 }
             }
 
@@ -513,7 +550,9 @@ void EventLoop::update_the_rendering()
         document->run_the_update_intersection_observations_steps(now);
     }
 
-    // FIXME: 20. For each doc of docs, record rendering time for doc given unsafeStyleAndLayoutStartTime.
+    // 20. For each doc of docs, record rendering time for doc given unsafeStyleAndLayoutStartTime.
+    for (auto& document : docs)
+        LongAnimationFrames::record_rendering_time(*document, unsafe_rendering_start_time, unsafe_style_and_layout_start_time);
 
     // FIXME: 21. For each doc of docs, mark paint timing for doc.
 
@@ -529,6 +568,11 @@ void EventLoop::update_the_rendering()
         navigable->paint_next_frame();
     }
 
+    // https://w3c.github.io/long-animation-frames/#flush-frame-timing
+    // NB: The frame of each rendered document ends once its rendering has been updated.
+    for (auto& document : docs)
+        LongAnimationFrames::flush_frame_timing(*document);
+
     // 23. For each doc of docs, process top layer removals given doc.
     for (auto& document : docs) {
         document->process_top_layer_removals();
@@ -5,6 +5,7 @@
  */
 
 #include <AK/IDAllocator.h>
+#include <LibCore/Tracing.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 
@@ -44,6 +45,7 @@ void Task::visit_edges(Visitor& visitor)
 
 void Task::execute()
 {
+    TRACE_EVENT("html", "Task::execute");
     m_steps->function()();
 }
 
@@ -87,12 +87,23 @@ public:
         // https://www.w3.org/TR/webcrypto-2/#dfn-crypto-task-source
         Crypto,
 
+        // https://wicg.github.io/scheduling-apis/#posted-task-task-source
+        PostedTask,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
         UniqueTaskSourceStart
     };
 
+    // https://wicg.github.io/scheduling-apis/#sec-task-priorities
+    // NB: Tasks that aren't scheduled through the Scheduler API run at user-visible priority.
+    enum class Priority : u8 {
+        UserBlocking,
+        UserVisible,
+        Background,
+    };
+
     static GC::Ref<Task> create(JS::VM&, Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
 
     virtual ~Task() override;
@@ -101,6 +112,13 @@ public:
     Source source() const { return m_source; }
     void execute();
 
+    Priority priority() const { return m_priority; }
+    void set_priority(Priority priority) { m_priority = priority; }
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-queue-is-continuation
+    bool is_continuation() const { return m_is_continuation; }
+    void set_is_continuation(bool is_continuation) { m_is_continuation = is_continuation; }
+
     DOM::Document const* document() const;
 
     bool is_runnable() const;
@@ -113,6 +131,8 @@ private:
 
     TaskID m_id {};
     Source m_source { Source::Unspecified };
+    Priority m_priority { Priority::UserVisible };
+    bool m_is_continuation { false };
     GC::Ref<GC::Function<void()>> m_steps;
     GC::Ptr<DOM::Document const> m_document;
 };
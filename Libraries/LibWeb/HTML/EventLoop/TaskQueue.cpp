@@ -35,29 +35,80 @@ void TaskQueue::add(GC::Ref<Task> task)
         return;
 
     m_tasks.append(task);
+    ++m_task_count_by_rank[to_underlying(selection_rank(*task))];
     m_event_loop->schedule();
 }
 
+TaskQueue::SelectionRank TaskQueue::selection_rank(Task const& task)
+{
+    if (task.source() == Task::Source::Rendering)
+        return SelectionRank::Rendering;
+    if (task.source() == Task::Source::UserInteraction)
+        return SelectionRank::UserInteraction;
+
+    switch (task.priority()) {
+    case Task::Priority::UserBlocking:
+        return task.is_continuation() ? SelectionRank::UserBlockingContinuation : SelectionRank::UserBlocking;
+    case Task::Priority::UserVisible:
+        return task.is_continuation() ? SelectionRank::UserVisibleContinuation : SelectionRank::UserVisible;
+    case Task::Priority::Background:
+        return task.is_continuation() ? SelectionRank::BackgroundContinuation : SelectionRank::Background;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void TaskQueue::did_remove_task(Task const& task)
+{
+    auto& count = m_task_count_by_rank[to_underlying(selection_rank(task))];
+    VERIFY(count > 0);
+    --count;
+}
+
+GC::Ptr<Task> TaskQueue::dequeue()
+{
+    if (m_tasks.is_empty())
+        return {};
+    auto task = m_tasks.take_first();
+    did_remove_task(*task);
+    return task;
+}
+
 GC::Ptr<Task> TaskQueue::take_first_runnable()
 {
     if (m_event_loop->execution_paused())
         return nullptr;
 
-    for (size_t i = 0; i < m_tasks.size();) {
-        if (m_event_loop->running_rendering_task() && m_tasks[i]->source() == Task::Source::Rendering) {
-            ++i;
+    for (size_t rank = 0; rank < m_task_count_by_rank.size(); ++rank) {
+        if (m_task_count_by_rank[rank] == 0)
             continue;
-        }
 
-        if (m_tasks[i]->is_runnable())
-            return m_tasks.take(i);
+        for (size_t i = 0; i < m_tasks.size();) {
+            auto& task = m_tasks[i];
 
-        if (m_tasks[i]->is_permanently_unrunnable()) {
-            m_tasks.remove(i);
-            continue;
-        }
+            if (to_underlying(selection_rank(*task)) != rank) {
+                ++i;
+                continue;
+            }
 
-        ++i;
+            if (m_event_loop->running_rendering_task() && task->source() == Task::Source::Rendering) {
+                ++i;
+                continue;
+            }
+
+            if (task->is_runnable()) {
+                auto runnable_task = m_tasks.take(i);
+                did_remove_task(*runnable_task);
+                return runnable_task;
+            }
+
+            if (task->is_permanently_unrunnable()) {
+                did_remove_task(*task);
+                m_tasks.remove(i);
+                continue;
+            }
+
+            ++i;
+        }
     }
     return nullptr;
 }
@@ -78,7 +129,12 @@ bool TaskQueue::has_runnable_tasks() const
 
 void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
-    m_tasks.remove_all_matching(filter);
+    m_tasks.remove_all_matching([&](auto const& task) {
+        if (!filter(*task))
+            return false;
+        did_remove_task(*task);
+        return true;
+    });
 }
 
 GC::Ptr<Task> TaskQueue::take_first_runnable_matching(Function<bool(HTML::Task const&)> filter)
@@ -86,10 +142,14 @@ GC::Ptr<Task> TaskQueue::take_first_runnable_matching(Function<bool(HTML::Task c
     for (size_t i = 0; i < m_tasks.size();) {
         auto& task = m_tasks.at(i);
 
-        if (task->is_runnable() && filter(*task))
-            return m_tasks.take(i);
+        if (task->is_runnable() && filter(*task)) {
+            auto runnable_task = m_tasks.take(i);
+            did_remove_task(*runnable_task);
+            return runnable_task;
+        }
 
         if (task->is_permanently_unrunnable()) {
+            did_remove_task(*task);
             m_tasks.remove(i);
             continue;
         }
@@ -109,7 +169,7 @@ Task const* TaskQueue::last_added_task() const
 
 bool TaskQueue::has_rendering_tasks() const
 {
-    return m_tasks.contains([](auto const& task) { return task->source() == Task::Source::Rendering; });
+    return m_task_count_by_rank[to_underlying(SelectionRank::Rendering)] > 0;
 }
 
 }
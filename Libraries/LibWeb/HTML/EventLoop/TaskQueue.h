@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Vector.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
@@ -29,12 +30,7 @@ public:
     GC::Ptr<HTML::Task> take_first_runnable();
 
     void enqueue(GC::Ref<HTML::Task> task) { add(task); }
-    GC::Ptr<HTML::Task> dequeue()
-    {
-        if (m_tasks.is_empty())
-            return {};
-        return m_tasks.take_first();
-    }
+    GC::Ptr<HTML::Task> dequeue();
 
     void remove_tasks_matching(Function<bool(HTML::Task const&)>);
     GC::Ptr<Task> take_first_runnable_matching(Function<bool(HTML::Task const&)>);
@@ -44,9 +40,30 @@ public:
 private:
     virtual void visit_edges(Visitor&) override;
 
+    // Runnable tasks are taken from the queue in order of these ranks, and in the order they were added within a rank.
+    // Each task source only has tasks of a single rank, except for the posted task source of the Scheduler API, whose
+    // tasks keep their order within each priority like the spec's scheduler task queues.
+    enum class SelectionRank : u8 {
+        // NB: Rendering tasks are only queued at rendering opportunities, and input events are processed as part of
+        //     updating the rendering, so running them first keeps long backlogs from delaying frames and input.
+        Rendering,
+        UserInteraction,
+        UserBlockingContinuation,
+        UserBlocking,
+        UserVisibleContinuation,
+        UserVisible,
+        BackgroundContinuation,
+        Background,
+        Count,
+    };
+    static SelectionRank selection_rank(Task const&);
+
+    void did_remove_task(Task const&);
+
     GC::Ref<HTML::EventLoop> m_event_loop;
 
     Vector<GC::Ref<HTML::Task>> m_tasks;
+    Array<size_t, to_underlying(SelectionRank::Count)> m_task_count_by_rank {};
 };
 
 }
@@ -6,8 +6,12 @@
 
 #include <AK/Base64.h>
 #include <AK/Checked.h>
+#include <AK/MemoryStream.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/ShareableBitmap.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/TransportHandle.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/HTMLCanvasElementPrototype.h>
 #include <LibWeb/CSS/CascadedProperties.h>
@@ -23,6 +27,7 @@
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/HTMLCanvasElement.h>
 #include <LibWeb/HTML/Numbers.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/Layout/CanvasBox.h>
 #include <LibWeb/Page/Page.h>
@@ -30,6 +35,7 @@
 #include <LibWeb/WebGL/WebGL2RenderingContext.h>
 #include <LibWeb/WebGL/WebGLRenderingContext.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::HTML {
 
@@ -260,6 +266,9 @@ JS::ThrowCompletionOr<HTMLCanvasElement::RenderingContext> HTMLCanvasElement::ge
 
     // 3. Run the steps in the cell of the following table whose column header matches this canvas element's canvas context mode and whose row header matches contextId:
     // NOTE: See the spec for the full table.
+    if (m_is_placeholder)
+        return throw_completion(WebIDL::InvalidStateError::create(realm(), "Canvas control has been transferred to an OffscreenCanvas"_utf16));
+
     if (type == "2d"sv) {
         if (TRY(create_2d_context(options)) == HasOrCreatedContext::Yes)
             return GC::make_root(*m_context.get<GC::Ref<HTML::CanvasRenderingContext2D>>());
@@ -285,6 +294,71 @@ JS::ThrowCompletionOr<HTMLCanvasElement::RenderingContext> HTMLCanvasElement::ge
     return Empty {};
 }
 
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-canvas-transfercontroltooffscreen
+WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> HTMLCanvasElement::transfer_control_to_offscreen()
+{
+    // 1. If this's context mode is not set to none, throw an "InvalidStateError" DOMException.
+    if (!m_context.has<Empty>() || m_is_placeholder)
+        return WebIDL::InvalidStateError::create(realm(), "Canvas already has a rendering context"_utf16);
+
+    // 2. Let offscreenCanvas be a new OffscreenCanvas object with its width and height equal to the values of the width
+    //    and height content attributes of this canvas element.
+    auto offscreen_canvas = TRY(OffscreenCanvas::construct_impl(realm(), width(), height()));
+
+    // 3. Set the placeholder canvas element of offscreenCanvas to a weak reference to this.
+    // NB: The OffscreenCanvas gets one end of a transport, on which it sends us its frames, instead.
+    auto paired = MUST(IPC::Transport::create_paired());
+    m_placeholder_transport = move(paired.local);
+    m_placeholder_transport->set_up_read_hook([weak_this = GC::Weak { *this }] {
+        if (weak_this)
+            weak_this->read_frames_from_offscreen_canvas();
+    });
+    offscreen_canvas->set_placeholder_transport(MUST(paired.remote_handle.create_transport()));
+
+    // 4. Set this's context mode to placeholder.
+    m_is_placeholder = true;
+
+    // FIXME: 5. Set offscreenCanvas's inherited language to the language of this.
+    // FIXME: 6. Set offscreenCanvas's inherited direction to the directionality of this.
+
+    // 7. Return offscreenCanvas.
+    return offscreen_canvas;
+}
+
+void HTMLCanvasElement::read_frames_from_offscreen_canvas()
+{
+    if (!m_placeholder_transport)
+        return;
+
+    RefPtr<Gfx::Bitmap> latest_frame;
+    auto should_shutdown = m_placeholder_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
+        FixedMemoryStream stream { raw_message.payload(), FixedMemoryStream::Mode::ReadOnly };
+        IPC::Decoder decoder { stream, raw_message.attachments };
+
+        auto frame = decoder.decode<Gfx::ShareableBitmap>();
+        if (frame.is_error()) {
+            dbgln("Failed to decode OffscreenCanvas frame: {}", frame.error());
+            return;
+        }
+        if (frame.value().is_valid())
+            latest_frame = frame.value().bitmap();
+    });
+
+    // NB: The frames share their memory with the OffscreenCanvas' process, so showing one does not copy it. Frames
+    //     that arrived together have already been replaced by the last of them, so only that one is shown.
+    if (latest_frame) {
+        ensure_external_content_source().update(Gfx::ImmutableBitmap::create(latest_frame.release_nonnull()));
+        set_needs_repaint(InvalidateDisplayList::No);
+    }
+
+    // NB: The OffscreenCanvas is gone, so its last frame stays on screen.
+    if (should_shutdown == IPC::Transport::ShouldShutdown::Yes) {
+        Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [this] {
+            m_placeholder_transport = nullptr;
+        }));
+    }
+}
+
 Gfx::IntSize HTMLCanvasElement::bitmap_size_for_canvas(size_t minimum_width, size_t minimum_height) const
 {
     auto width = max(this->width(), minimum_width);
@@ -8,6 +8,7 @@
 
 #include <LibGfx/Forward.h>
 #include <LibGfx/PaintingSurface.h>
+#include <LibIPC/Transport.h>
 #include <LibWeb/HTML/HTMLElement.h>
 #include <LibWeb/Painting/ExternalContentSource.h>
 #include <LibWeb/WebIDL/Types.h>
@@ -42,12 +43,16 @@ public:
 
     virtual void attribute_changed(FlyString const& local_name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_) override;
 
+    WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> transfer_control_to_offscreen();
+    bool is_placeholder() const { return m_is_placeholder; }
+
     String to_data_url(StringView type, JS::Value quality);
     WebIDL::ExceptionOr<void> to_blob(GC::Ref<WebIDL::CallbackType> callback, StringView type, JS::Value quality);
     RefPtr<Gfx::Bitmap> get_bitmap_from_surface();
 
     void present();
     void set_canvas_content_dirty();
+    bool canvas_content_is_dirty() const { return m_canvas_content_dirty; }
 
     RefPtr<Gfx::PaintingSurface> surface() const;
     void allocate_painting_surface_if_needed();
@@ -71,10 +76,19 @@ private:
     JS::ThrowCompletionOr<HasOrCreatedContext> create_webgl_context(JS::Value options);
     void reset_context_to_default_state();
     void notify_context_about_canvas_size_change();
+    void read_frames_from_offscreen_canvas();
 
     Variant<GC::Ref<HTML::CanvasRenderingContext2D>, GC::Ref<WebGL::WebGLRenderingContext>, GC::Ref<WebGL::WebGL2RenderingContext>, Empty> m_context;
     RefPtr<Painting::ExternalContentSource> m_external_content_source;
     bool m_canvas_content_dirty { false };
+
+    // NB: This is the "placeholder" context mode, which the canvas element is in once control has been transferred to
+    //     an OffscreenCanvas, and which it never leaves.
+    bool m_is_placeholder { false };
+
+    // The frames of the OffscreenCanvas this canvas element is the placeholder canvas element of are sent to us over
+    // this transport, as the OffscreenCanvas may have been transferred to a worker in another process.
+    OwnPtr<IPC::Transport> m_placeholder_transport;
 };
 
 }
@@ -98,6 +98,24 @@ void HTMLImageElement::adopted_from(DOM::Document& old_document)
     }
 }
 
+void HTMLImageElement::inserted()
+{
+    Base::inserted();
+
+    if (is_connected() && has_animated_image())
+        document().start_intersection_observing_an_animated_image(*this);
+}
+
+void HTMLImageElement::removed_from(Node* old_parent, Node& old_root)
+{
+    Base::removed_from(old_parent, old_root);
+
+    // NB: Images that are not in a document may still be drawn elsewhere, e.g. onto a canvas, so they keep animating.
+    document().stop_intersection_observing_an_animated_image(*this);
+    document().stop_intersection_observing_a_loading_image(*this);
+    set_visible_in_viewport(true);
+}
+
 void HTMLImageElement::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -247,9 +265,45 @@ RefPtr<Gfx::ImmutableBitmap> HTMLImageElement::current_image_bitmap_sized(Gfx::I
     return nullptr;
 }
 
-void HTMLImageElement::set_visible_in_viewport(bool)
+void HTMLImageElement::set_visible_in_viewport(bool visible_in_viewport)
 {
-    // FIXME: Loosen grip on image data when it's not visible, e.g via volatile memory.
+    // OPTIMIZATION: Animations outside the viewport are paused, and let go of the frames they decoded ahead of time.
+    //               They pick up at the same frame once they are scrolled back into view.
+    m_is_outside_viewport = !visible_in_viewport;
+
+    if (m_is_outside_viewport) {
+        if (!m_animation_timer->is_active())
+            return;
+        m_animation_timer->stop();
+        m_animation_paused_outside_viewport = true;
+        if (auto image_data = decoded_image_data())
+            image_data->discard_buffered_frames();
+        return;
+    }
+
+    if (!m_animation_paused_outside_viewport)
+        return;
+    m_animation_paused_outside_viewport = false;
+    if (document().is_fully_active())
+        m_animation_timer->start();
+}
+
+bool HTMLImageElement::has_animated_image() const
+{
+    auto image_data = decoded_image_data();
+    return image_data && image_data->is_animated() && image_data->frame_count() > 1;
+}
+
+void HTMLImageElement::start_the_animation_timer()
+{
+    if (is_connected())
+        document().start_intersection_observing_an_animated_image(*this);
+
+    if (m_is_outside_viewport) {
+        m_animation_paused_outside_viewport = true;
+        return;
+    }
+    m_animation_timer->start();
 }
 
 // https://html.spec.whatwg.org/multipage/embedded-content.html#dom-img-width
@@ -870,7 +924,7 @@ after_step_7:
         if (will_lazy_load_element()) {
             // 1. Set the img's lazy load resumption steps to the rest of this algorithm starting with the step labeled fetch the image.
             set_lazy_load_resumption_steps([this, request, image_request]() {
-                image_request->fetch_image(realm(), request);
+                fetch_the_image(image_request, request);
             });
 
             // 2. Start intersection-observing a lazy loading element for the img element.
@@ -880,14 +934,34 @@ after_step_7:
             return;
         }
 
-        image_request->fetch_image(realm(), request);
+        fetch_the_image(image_request, request);
     }));
 }
 
+void HTMLImageElement::fetch_the_image(GC::Ref<ImageRequest> image_request, GC::Ref<Fetch::Infrastructure::Request> request)
+{
+    image_request->fetch_image(realm(), request);
+
+    // OPTIMIZATION: Images start out being fetched and decoded at the same priority, as we don't know which of them are
+    //               visible before layout. Once we do, the visible ones are moved ahead of the others.
+    if (is_connected() && image_request->is_fetching())
+        document().start_intersection_observing_a_loading_image(*this);
+}
+
+void HTMLImageElement::loading_image_became_visible()
+{
+    if (m_current_request)
+        m_current_request->prioritize_because_visible();
+    if (m_pending_request)
+        m_pending_request->prioritize_because_visible();
+}
+
 void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> image_request, bool maybe_omit_events, String const& url_string, String const& previous_url, u64 update_the_image_data_count)
 {
     image_request->add_callbacks(
         [this, image_request, maybe_omit_events, url_string, previous_url, update_the_image_data_count]() {
+            document().stop_intersection_observing_a_loading_image(*this);
+
             batching_dispatcher().enqueue(GC::create_function(realm().heap(), [this, image_request, maybe_omit_events, url_string, previous_url, update_the_image_data_count] {
                 // AD-HOC: Bail out if the document became inactive (e.g. iframe removed or navigated)
                 //         between when the fetch completed and when this batched callback runs.
@@ -936,15 +1010,18 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
 
                 m_current_frame_index = 0;
                 m_animation_timer->stop();
+                m_animation_paused_outside_viewport = false;
                 if (image_data->is_animated() && image_data->frame_count() > 1) {
                     m_animation_timer->set_interval(image_data->frame_duration(0));
-                    m_animation_timer->start();
+                    start_the_animation_timer();
                 }
 
                 m_load_event_delayer.clear();
             }));
         },
         [this, image_request, maybe_omit_events, url_string, previous_url, update_the_image_data_count]() {
+            document().stop_intersection_observing_a_loading_image(*this);
+
             // AD-HOC: Bail out if the document became inactive (e.g. iframe removed or navigated)
             //         between when the fetch completed and when this failure callback runs.
             if (!document().is_fully_active()) {
@@ -979,6 +1056,39 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
 
             m_load_event_delayer.clear();
+        },
+        [this, image_request, update_the_image_data_count]() {
+            batching_dispatcher().enqueue(GC::create_function(realm().heap(), [this, image_request, update_the_image_data_count] {
+                if (!document().is_fully_active() || update_the_image_data_count != m_update_the_image_data_count)
+                    return;
+
+                // NB: The image data is only partially decoded, as the rest of it is still being fetched.
+                VERIFY(image_request->shared_resource_request());
+                auto image_data = image_request->shared_resource_request()->image_data();
+                if (!image_data)
+                    return;
+                image_request->set_image_data(image_data);
+
+                // 1. If image request is the pending request and the user agent is able to determine image request's
+                //    image's width and height, then abort the image request for the current request, upgrade the pending
+                //    request to the current request, and prepare image request for presentation given the img element.
+                if (image_request == m_pending_request) {
+                    abort_the_image_request(realm(), m_current_request);
+                    upgrade_pending_request_to_current_request();
+                    image_request->prepare_for_presentation(*this);
+                }
+
+                // 2. Otherwise, if image request is the current request, image request's state is unavailable, and the
+                //    user agent is able to determine image request's image's width and height, then set image request's
+                //    state to partially available.
+                if (image_request == m_current_request && image_request->state() == ImageRequest::State::Unavailable)
+                    image_request->set_state(ImageRequest::State::PartiallyAvailable);
+
+                // Each task that is queued by the networking task source while the image is being fetched must update
+                // the presentation of the image.
+                set_needs_style_update(true);
+                set_needs_layout_update(DOM::SetNeedsLayoutReason::HTMLImageElementUpdateTheImageData);
+            }));
         });
 }
 
@@ -1178,9 +1288,10 @@ void HTMLImageElement::restart_the_animation()
 
     auto image_data = m_current_request->image_data();
     if (image_data && image_data->frame_count() > 1) {
-        m_animation_timer->start();
+        start_the_animation_timer();
     } else {
         m_animation_timer->stop();
+        m_animation_paused_outside_viewport = false;
     }
 }
 
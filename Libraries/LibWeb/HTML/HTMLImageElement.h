@@ -119,6 +119,9 @@ public:
 
     virtual void visit_edges(Cell::Visitor&) override;
 
+    // Called once the image is in the viewport while it is still being fetched.
+    void loading_image_became_visible();
+
 private:
     HTMLImageElement(DOM::Document&, DOM::QualifiedName);
 
@@ -130,6 +133,8 @@ private:
     virtual void finalize() override;
 
     virtual void adopted_from(DOM::Document&) override;
+    virtual void inserted() override;
+    virtual void removed_from(Node* old_parent, Node& old_root) override;
 
     virtual bool is_presentational_hint(FlyString const&) const override;
     virtual void apply_presentational_hints(GC::Ref<CSS::CascadedProperties>) const override;
@@ -145,10 +150,15 @@ private:
     void handle_successful_fetch(URL::URL const&, StringView mime_type, ImageRequest&, ByteBuffer, bool maybe_omit_events, URL::URL const& previous_url);
     void handle_failed_fetch();
     void add_callbacks_to_image_request(GC::Ref<ImageRequest>, bool maybe_omit_events, String const& url_string, String const& previous_url, u64 update_the_image_data_count);
+    void fetch_the_image(GC::Ref<ImageRequest>, GC::Ref<Fetch::Infrastructure::Request>);
 
     void animate();
+    void start_the_animation_timer();
+    bool has_animated_image() const;
 
     RefPtr<Core::Timer> m_animation_timer;
+    bool m_is_outside_viewport { false };
+    bool m_animation_paused_outside_viewport { false };
     size_t m_current_frame_index { 0 };
     size_t m_loops_completed { 0 };
 
@@ -9,9 +9,11 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/Debug.h>
+#include <LibCore/EventLoop.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Bindings/HTMLLinkElementPrototype.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
@@ -32,6 +34,7 @@
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/HTML/HTMLLinkElement.h>
 #include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/PreloadedResources.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Loader/ResourceLoader.h>
@@ -745,12 +748,13 @@ void HTMLLinkElement::preload(LinkProcessingOptions& options, GC::Ptr<GC::Functi
     controller_holder->set_controller(*m_fetch_controller);
 
     // 12. Let commit be the following steps given a Document document:
-    auto commit = GC::Function<void(DOM::Document&)>::create(realm.heap(), [entry, report_timing](DOM::Document& document) {
+    auto commit = GC::Function<void(DOM::Document&)>::create(realm.heap(), [entry, report_timing, key = move(key)](DOM::Document& document) {
         // 1. If entry's response is not null, then call reportTiming given document.
         if (entry->response)
             report_timing->function()(document);
 
-        // FIXME: 2. Set document's map of preloaded resources[key] to entry.
+        // 2. Set document's map of preloaded resources[key] to entry.
+        document.map_of_preloaded_resources().set(key, entry);
     });
 
     // 13. If options's document is null, then set options's on document ready to commit. Otherwise, call commit with
@@ -781,6 +785,31 @@ void HTMLLinkElement::process_icon_resource(bool success, Fetch::Infrastructure:
     document().check_favicon_after_loading_link_resource();
 }
 
+static constexpr size_t off_thread_style_sheet_decoding_threshold = 64 * KiB;
+
+// Decodes a style sheet on the thread pool, then calls `on_decoded` with the result on the main thread.
+// NB: The callback is heap-allocated so that if the event loop is destroyed while decoding, we leak it (and any
+//     GC::Root objects it captures) rather than destroying them on the worker thread.
+static void decode_style_sheet_off_thread(ByteBuffer body_bytes, Optional<String> environment_encoding, Optional<String> mime_type_charset, Function<void(ErrorOr<String>)>* on_decoded)
+{
+    auto event_loop_weak = Core::EventLoop::current_weak();
+
+    Threading::ThreadPool::the().submit([body_bytes = move(body_bytes), environment_encoding = move(environment_encoding),
+                                            mime_type_charset = move(mime_type_charset), on_decoded,
+                                            event_loop_weak = move(event_loop_weak)]() mutable {
+        auto decoded_style_sheet = css_decode_bytes(environment_encoding.map([](auto const& encoding) { return encoding.bytes_as_string_view(); }), move(mime_type_charset), body_bytes);
+        body_bytes.clear();
+
+        auto origin = event_loop_weak->take();
+        if (!origin)
+            return;
+        origin->deferred_invoke([decoded_style_sheet = move(decoded_style_sheet), on_decoded]() mutable {
+            (*on_decoded)(move(decoded_style_sheet));
+            delete on_decoded;
+        });
+    });
+}
+
 // https://html.spec.whatwg.org/multipage/links.html#link-type-stylesheet:process-the-linked-resource
 void HTMLLinkElement::process_stylesheet_resource(bool success, Fetch::Infrastructure::Response const& response, ByteBuffer body_bytes)
 {
@@ -804,6 +833,53 @@ void HTMLLinkElement::process_stylesheet_resource(bool success, Fetch::Infrastru
     // FIXME: 2. If el no longer creates an external resource link that contributes to the styling processing model,
     //           or if, since the resource in question was fetched, it has become appropriate to fetch it again, then return.
 
+    auto generation = ++m_style_sheet_resource_generation;
+
+    Optional<URL::URL> location;
+    if (!response.url_list().is_empty())
+        location = response.url_list().first();
+
+    if (!success) {
+        finish_processing_stylesheet_resource(false, location, String {});
+        return;
+    }
+
+    // OPTIMIZATION: Large style sheets are decoded on the thread pool, so that the main thread can keep parsing HTML
+    //               and running scripts in the meantime. Parsing the decoded text has to happen on the main thread, as
+    //               it creates GC-allocated rules.
+    if (body_bytes.size() >= off_thread_style_sheet_decoding_threshold) {
+        auto* callback = new Function<void(ErrorOr<String>)>(
+            [element = GC::Root { *this }, location = move(location), generation](ErrorOr<String> decoded_style_sheet) mutable {
+                element->queue_an_element_task(Task::Source::Networking, [element, location = move(location), generation, decoded_style_sheet = move(decoded_style_sheet)]() mutable {
+                    if (element->m_style_sheet_resource_generation != generation || !element->document().is_fully_active())
+                        return;
+                    element->finish_processing_stylesheet_resource(true, location, move(decoded_style_sheet));
+                });
+            });
+        decode_style_sheet_off_thread(move(body_bytes), css_environment_encoding(), move(mime_type_charset), callback);
+        return;
+    }
+
+    auto environment_encoding = css_environment_encoding();
+    finish_processing_stylesheet_resource(true, location, css_decode_bytes(environment_encoding.map([](auto const& encoding) { return encoding.bytes_as_string_view(); }), move(mime_type_charset), body_bytes));
+}
+
+// https://drafts.csswg.org/css-syntax/#environment-encoding
+Optional<String> HTMLLinkElement::css_environment_encoding() const
+{
+    // The CSS environment encoding is the result of running the following steps: [CSSSYNTAX]
+    //     1. If the element has a charset attribute, get an encoding from that attribute's value. If that succeeds, return the resulting encoding. [ENCODING]
+    //     2. Otherwise, return the document's character encoding. [DOM]
+    if (auto charset = attribute(HTML::AttributeNames::charset); charset.has_value()) {
+        if (auto encoding = TextCodec::get_standardized_encoding(charset.release_value()); encoding.has_value())
+            return MUST(String::from_utf8(*encoding));
+    }
+
+    return document().encoding();
+}
+
+void HTMLLinkElement::finish_processing_stylesheet_resource(bool success, Optional<URL::URL> const& location, ErrorOr<String> decoded_style_sheet)
+{
     // 3. If el has an associated CSS style sheet, remove the CSS style sheet.
     if (m_loaded_style_sheet) {
         document_or_shadow_root_style_sheets().remove_a_css_style_sheet(*m_loaded_style_sheet);
@@ -835,31 +911,21 @@ void HTMLLinkElement::process_stylesheet_resource(bool success, Fetch::Infrastru
         //        CSS rules
         //          Left uninitialized.
         //
-        // The CSS environment encoding is the result of running the following steps: [CSSSYNTAX]
-        //     1. If the element has a charset attribute, get an encoding from that attribute's value. If that succeeds, return the resulting encoding. [ENCODING]
-        //     2. Otherwise, return the document's character encoding. [DOM]
-        Optional<StringView> environment_encoding;
-        if (auto charset = attribute(HTML::AttributeNames::charset); charset.has_value())
-            environment_encoding = TextCodec::get_standardized_encoding(charset.release_value());
-
-        if (!environment_encoding.has_value() && document().encoding().has_value())
-            environment_encoding = document().encoding().value();
-
-        auto maybe_decoded_string = css_decode_bytes(environment_encoding, mime_type_charset, body_bytes);
-        if (maybe_decoded_string.is_error()) {
-            dbgln("Failed to decode CSS file: {}", response.url().value_or(URL::URL()));
+        // NB: The style sheet was decoded using the CSS environment encoding by our caller.
+        if (decoded_style_sheet.is_error()) {
+            dbgln("Failed to decode CSS file: {}", location.value_or(URL::URL()));
             dispatch_event(*DOM::Event::create(realm(), HTML::EventNames::error));
         } else {
-            VERIFY(!response.url_list().is_empty());
+            VERIFY(location.has_value());
             m_loaded_style_sheet = document_or_shadow_root_style_sheets().create_a_css_style_sheet(
-                maybe_decoded_string.release_value(),
+                decoded_style_sheet.release_value(),
                 "text/css"_string,
                 this,
                 attribute(HTML::AttributeNames::media).value_or({}),
                 in_a_document_tree() ? attribute(HTML::AttributeNames::title).value_or({}) : String {},
                 (m_relationship & Relationship::Alternate && !m_explicitly_enabled) ? CSS::StyleSheetList::Alternate::Yes : CSS::StyleSheetList::Alternate::No,
                 CSS::StyleSheetList::OriginClean::Yes,
-                response.url_list().first(),
+                *location,
                 nullptr,
                 nullptr);
 
@@ -1060,27 +1126,6 @@ void HTMLLinkElement::LinkProcessingOptions::visit_edges(Cell::Visitor& visitor)
     visitor.visit(on_document_ready);
 }
 
-// https://html.spec.whatwg.org/multipage/links.html#create-a-preload-key
-HTMLLinkElement::PreloadKey HTMLLinkElement::PreloadKey::create(Fetch::Infrastructure::Request const& request)
-{
-    // To create a preload key for a request request, return a new preload key whose URL is request's URL, destination
-    // is request's destination, mode is request's mode, and credentials mode is request's credentials mode.
-    return PreloadKey {
-        .url = request.url(),
-        .destination = request.destination(),
-        .mode = request.mode(),
-        .credentials_mode = request.credentials_mode(),
-    };
-}
-
-void HTMLLinkElement::PreloadEntry::visit_edges(Cell::Visitor& visitor)
-{
-    Base::visit_edges(visitor);
-    visitor.visit(response);
-    visitor.visit(on_response_available);
-}
-
 GC_DEFINE_ALLOCATOR(HTMLLinkElement::LinkProcessingOptions);
-GC_DEFINE_ALLOCATOR(HTMLLinkElement::PreloadEntry);
 
 }
@@ -133,47 +133,6 @@ private:
         Fetch::Infrastructure::Request::Priority fetch_priority { Fetch::Infrastructure::Request::Priority::Auto };
     };
 
-    // https://html.spec.whatwg.org/multipage/links.html#preload-key
-    struct PreloadKey {
-        static PreloadKey create(Fetch::Infrastructure::Request const&);
-
-        // URL
-        //     A URL
-        URL::URL url;
-
-        // destination
-        //     A string
-        Optional<Fetch::Infrastructure::Request::Destination> destination;
-
-        // mode
-        //     A request mode, either "same-origin", "cors", or "no-cors"
-        Fetch::Infrastructure::Request::Mode mode;
-
-        // credentials mode
-        //     A credentials mode
-        Fetch::Infrastructure::Request::CredentialsMode credentials_mode;
-    };
-
-    // https://html.spec.whatwg.org/multipage/links.html#preload-entry
-    struct PreloadEntry final : public JS::Cell {
-        GC_CELL(PreloadEntry, JS::Cell);
-        GC_DECLARE_ALLOCATOR(PreloadEntry);
-
-        virtual void visit_edges(Cell::Visitor& visitor) override;
-
-        // integrity metadata
-        //     A string
-        String integrity_metadata;
-
-        // response
-        //     Null or a response
-        GC::Ptr<Fetch::Infrastructure::Response> response;
-
-        // on response available
-        //     Null, or an algorithm accepting a response or null
-        GC::Ptr<GC::Function<void(GC::Ptr<Fetch::Infrastructure::Response>)>> on_response_available;
-    };
-
     HTMLLinkElement(DOM::Document&, DOM::QualifiedName);
 
     virtual void initialize(JS::Realm&) override;
@@ -206,6 +165,8 @@ private:
     void process_linked_resource(bool success, Fetch::Infrastructure::Response const&, ByteBuffer);
     void process_icon_resource(bool success, Fetch::Infrastructure::Response const&, ByteBuffer);
     void process_stylesheet_resource(bool success, Fetch::Infrastructure::Response const&, ByteBuffer);
+    void finish_processing_stylesheet_resource(bool success, Optional<URL::URL> const& location, ErrorOr<String> decoded_style_sheet);
+    Optional<String> css_environment_encoding() const;
 
     bool should_fetch_and_process_resource_type() const;
 
@@ -231,6 +192,10 @@ private:
     Optional<LoadedIcon> m_loaded_icon;
     GC::Ptr<CSS::CSSStyleSheet> m_loaded_style_sheet;
 
+    // Incremented whenever a style sheet resource is processed, so that one decoded on the thread pool is dropped if a
+    // newer one was processed in the meantime.
+    u64 m_style_sheet_resource_generation { 0 };
+
     GC::Ptr<DOM::DOMTokenList> m_rel_list;
     GC::Ptr<DOM::DOMTokenList> m_sizes;
     unsigned m_relationship { 0 };
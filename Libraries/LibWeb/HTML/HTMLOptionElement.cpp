@@ -99,7 +99,7 @@ void HTMLOptionElement::set_selected_internal(bool selected)
         m_selectedness_update_index = m_next_selectedness_update_index++;
 
     // this is here to invalidate the cache on the HTMLCollection in HTMLSelectElement::selected_options
-    document().bump_dom_tree_version();
+    bump_dom_tree_version();
 }
 
 // https://html.spec.whatwg.org/multipage/form-elements.html#dom-option-value
@@ -188,6 +188,13 @@ void HTMLScriptElement::execute_script()
         // 1. Register an import map given el's relevant global object and el's result.
         m_result.get<GC::Ref<ImportMapParseResult>>()->register_import_map(as<Window>(relevant_global_object(*this)));
     }
+    // -> "speculationrules"
+    else if (m_script_type == ScriptType::SpeculationRules) {
+        HTML::TemporaryExecutionContext execution_context { realm() };
+
+        // 1. Register speculation rules given el's relevant global object and el's result.
+        m_result.get<GC::Ref<SpeculationRulesParseResult>>()->register_speculation_rules(as<Window>(relevant_global_object(*this)));
+    }
 
     // 7. Decrement the ignore-destructive-writes counter of document, if it was incremented in the earlier step.
     if (incremented_destructive_writes_counter)
@@ -274,7 +281,11 @@ void HTMLScriptElement::prepare_script()
         // then set el's type to "importmap".
         m_script_type = ScriptType::ImportMap;
     }
-    // FIXME: 13. Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules", then set el's type to "speculationrules".
+    // 13. Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules",
+    else if (script_block_type.equals_ignoring_ascii_case("speculationrules"sv)) {
+        // then set el's type to "speculationrules".
+        m_script_type = ScriptType::SpeculationRules;
+    }
     // 14. Otherwise, return. (No script is executed, and el's type is left as null.)
     else {
         VERIFY(m_script_type == ScriptType::Null);
@@ -409,8 +420,7 @@ void HTMLScriptElement::prepare_script()
     // 34. If el has a src content attribute, then:
     if (has_attribute(HTML::AttributeNames::src)) {
         // 1. If el's type is "importmap" or "speculationrules", then:
-        // FIXME: Add "speculationrules" support.
-        if (m_script_type == ScriptType::ImportMap) {
+        if (m_script_type == ScriptType::ImportMap || m_script_type == ScriptType::SpeculationRules) {
             // then queue an element task on the DOM manipulation task source given el to fire an event named error at el, and return.
             queue_an_element_task(HTML::Task::Source::DOMManipulation, [this] {
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
@@ -537,7 +547,14 @@ void HTMLScriptElement::prepare_script()
             // 2. Mark as ready el given result.
             mark_as_ready(Result(move(result)));
         }
-        // FIXME: -> "speculationrules"
+        // -> "speculationrules"
+        else if (m_script_type == ScriptType::SpeculationRules) {
+            // 1. Let result be the result of creating a speculation rules parse result given source text and el's node document.
+            auto result = SpeculationRulesParseResult::create(realm(), source_text_utf8, document());
+
+            // 2. Mark as ready el given result.
+            mark_as_ready(Result(move(result)));
+        }
     }
 
     // 36. If el's type is "classic" and el has a src attribute, or el's type is "module":
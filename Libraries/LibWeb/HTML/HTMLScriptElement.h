@@ -12,6 +12,7 @@
 #include <LibWeb/HTML/HTMLElement.h>
 #include <LibWeb/HTML/Scripting/ImportMapParseResult.h>
 #include <LibWeb/HTML/Scripting/Script.h>
+#include <LibWeb/HTML/SpeculationRules.h>
 #include <LibWeb/ReferrerPolicy/ReferrerPolicy.h>
 #include <LibWeb/TrustedTypes/TrustedScript.h>
 #include <LibWeb/TrustedTypes/TrustedScriptURL.h>
@@ -51,7 +52,7 @@ public:
     // https://html.spec.whatwg.org/multipage/scripting.html#dom-script-supports
     static bool supports(JS::VM&, StringView type)
     {
-        return type.is_one_of("classic"sv, "module"sv, "importmap"sv);
+        return type.is_one_of("classic"sv, "module"sv, "importmap"sv, "speculationrules"sv);
     }
 
     void set_source_line_number(Badge<HTMLParser>, size_t source_line_number) { m_source_line_number = source_line_number; }
@@ -105,7 +106,7 @@ private:
         struct Null { };
     };
 
-    using Result = Variant<ResultState::Uninitialized, ResultState::Null, GC::Ref<HTML::Script>, GC::Ref<HTML::ImportMapParseResult>>;
+    using Result = Variant<ResultState::Uninitialized, ResultState::Null, GC::Ref<HTML::Script>, GC::Ref<HTML::ImportMapParseResult>, GC::Ref<HTML::SpeculationRulesParseResult>>;
 
     // https://html.spec.whatwg.org/multipage/scripting.html#mark-as-ready
     void mark_as_ready(Result);
@@ -143,6 +144,7 @@ private:
         Classic,
         Module,
         ImportMap,
+        SpeculationRules,
     };
 
     // https://html.spec.whatwg.org/multipage/scripting.html#concept-script-type
@@ -2829,21 +2829,12 @@ void Navigable::ready_to_paint()
     m_rendering_thread.ready_to_paint();
 }
 
-void Navigable::record_display_list_and_scroll_state(PaintConfig paint_config)
+static Painting::ScrollStateSnapshotByDisplayList collect_scroll_state_snapshots(DOM::Document& document, Painting::DisplayList& display_list)
 {
-    m_needs_repaint = false;
-    auto document = active_document();
-    if (!document)
-        return;
-
-    auto display_list = document->record_display_list(paint_config);
-    if (!display_list)
-        return;
-
-    auto& document_paintable = *document->paintable();
+    auto& document_paintable = *document.paintable();
     Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot_by_display_list;
     document_paintable.refresh_scroll_state();
-    scroll_state_snapshot_by_display_list.set(*display_list, document_paintable.scroll_state_snapshot());
+    scroll_state_snapshot_by_display_list.set(display_list, document_paintable.scroll_state_snapshot());
 
     // Collect scroll state snapshots for each nested navigable
     document_paintable.for_each_in_inclusive_subtree_of_type<Painting::NavigableContainerViewportPaintable>([&scroll_state_snapshot_by_display_list](auto& navigable_container_paintable) {
@@ -2870,7 +2861,21 @@ void Navigable::record_display_list_and_scroll_state(PaintConfig paint_config)
         return TraversalDecision::Continue;
     });
 
-    m_rendering_thread.update_display_list(*display_list, move(scroll_state_snapshot_by_display_list));
+    return scroll_state_snapshot_by_display_list;
+}
+
+void Navigable::record_display_list_and_scroll_state(PaintConfig paint_config)
+{
+    m_needs_repaint = false;
+    auto document = active_document();
+    if (!document)
+        return;
+
+    auto display_list = document->record_display_list(paint_config);
+    if (!display_list)
+        return;
+
+    m_rendering_thread.update_display_list(*display_list, collect_scroll_state_snapshots(*document, *display_list));
 }
 
 void Navigable::paint_next_frame()
@@ -2886,6 +2891,29 @@ void Navigable::paint_next_frame()
     m_rendering_thread.present_frame(viewport_rect);
 }
 
+// OPTIMIZATION: Scrolling doesn't change the display list, only the offsets it is played back with. Once input events
+//               have scrolled something, the display list that is already on the rendering thread can be presented
+//               with the new offsets right away, instead of after animation frame callbacks, style, layout and
+//               painting have run for the rest of the rendering update.
+void Navigable::present_scrolled_frame()
+{
+    if (!is_top_level_traversable())
+        return;
+
+    auto document = active_document();
+    if (!document || !document->layout_is_up_to_date() || !document->paintable())
+        return;
+
+    // NB: If the display list has been invalidated since it was recorded, the scroll offsets may no longer match it,
+    //     so the frame has to wait for the rendering update.
+    auto display_list = document->cached_display_list();
+    if (!display_list)
+        return;
+
+    m_rendering_thread.update_scroll_state(collect_scroll_state_snapshots(*document, *display_list));
+    m_rendering_thread.present_frame(page().css_to_device_rect(this->viewport_rect()).to_type<int>());
+}
+
 void Navigable::render_screenshot(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback)
 {
     record_display_list_and_scroll_state(paint_config);
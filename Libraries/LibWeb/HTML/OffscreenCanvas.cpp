@@ -6,12 +6,16 @@
 
 #include <AK/Tuple.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ShareableBitmap.h>
+#include <LibIPC/Encoder.h>
+#include <LibIPC/TransportHandle.h>
 #include <LibWeb/Bindings/OffscreenCanvasPrototype.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/Canvas/SerializeBitmap.h>
 #include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/OffscreenCanvasRenderingContext2D.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HTML/WorkerGlobalScope.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -83,25 +87,117 @@ OffscreenCanvas::OffscreenCanvas(JS::Realm& realm, RefPtr<Gfx::Bitmap> bitmap)
 
 OffscreenCanvas::~OffscreenCanvas() = default;
 
-WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_steps(HTML::TransferDataEncoder&)
+// NB: Marks whether the transfer data holds the transport to a placeholder canvas element.
+static constexpr u8 IPC_FILE_TAG = 0xA5;
+
+// https://html.spec.whatwg.org/multipage/canvas.html#the-offscreencanvas-interface:transfer-steps
+WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_steps(HTML::TransferDataEncoder& data_holder)
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) OffscreenCanvas::transfer_steps(HTML::TransferDataEncoder&)");
+    // 1. If value's context mode is not equal to none, then throw an "InvalidStateError" DOMException.
+    if (!m_context.has<Empty>())
+        return WebIDL::InvalidStateError::create(realm(), "Cannot transfer an OffscreenCanvas that has a rendering context"_utf16);
+
+    // 2. Set value's context mode to detached.
+    // NB: This is done by the caller, by setting value's [[Detached]] internal slot.
+
+    // 3. Let width and height be the dimensions of value's bitmap.
+    auto size = bitmap_size_for_canvas();
+
+    // FIXME: 4. Let language and direction be value's inherited language and inherited direction.
+
+    // 5. Unset value's bitmap.
+    m_bitmap = nullptr;
+
+    // 6. Set dataHolder.[[Width]] to width and dataHolder.[[Height]] to height.
+    data_holder.encode(size.width());
+    data_holder.encode(size.height());
+
+    // FIXME: 7. Set dataHolder.[[Language]] to language and dataHolder.[[Direction]] to direction.
+
+    // 8. Set dataHolder.[[PlaceholderCanvas]] to be a weak reference to value's placeholder canvas element, if value has
+    //    one, or null if it does not.
+    if (m_placeholder_transport) {
+        auto handle = MUST(m_placeholder_transport->release_for_transfer());
+        m_placeholder_transport.clear();
+
+        data_holder.encode(IPC_FILE_TAG);
+        data_holder.encode(handle);
+    } else {
+        data_holder.encode<u8>(0);
+    }
+
     return {};
 }
 
-WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataDecoder&)
+// https://html.spec.whatwg.org/multipage/canvas.html#the-offscreencanvas-interface:transfer-receiving-steps
+WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataDecoder& data_holder)
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataDecoder&)");
+    // 1. Initialize value's bitmap to a rectangular array of transparent black pixels with width given by
+    //    dataHolder.[[Width]] and height given by dataHolder.[[Height]].
+    auto width = data_holder.decode<int>();
+    auto height = data_holder.decode<int>();
+    TRY(set_new_bitmap_size({ width, height }));
+
+    // FIXME: 2. Set value's inherited language to dataHolder.[[Language]] and its inherited direction to
+    //           dataHolder.[[Direction]].
+
+    // 3. If dataHolder.[[PlaceholderCanvas]] is not null, set value's placeholder canvas element to
+    //    dataHolder.[[PlaceholderCanvas]] (while maintaining the weak reference semantics).
+    if (auto fd_tag = data_holder.decode<u8>(); fd_tag == IPC_FILE_TAG) {
+        auto handle = data_holder.decode<IPC::TransportHandle>();
+        set_placeholder_transport(MUST(handle.create_transport()));
+    } else if (fd_tag != 0) {
+        dbgln("Unexpected byte {:x} in OffscreenCanvas transfer data", fd_tag);
+        VERIFY_NOT_REACHED();
+    }
+
     return {};
 }
 
 HTML::TransferType OffscreenCanvas::primary_interface() const
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) OffscreenCanvas::primary_interface()");
-    return {};
+    return TransferType::OffscreenCanvas;
+}
+
+void OffscreenCanvas::set_placeholder_transport(NonnullOwnPtr<IPC::Transport> transport)
+{
+    m_placeholder_transport = move(transport);
+}
+
+void OffscreenCanvas::did_draw()
+{
+    if (!m_placeholder_transport || m_frame_push_is_scheduled)
+        return;
+
+    // NB: Everything that is drawn during the current task ends up in a single frame, so drawing many times per frame
+    //     does not send more than one frame to the placeholder canvas element.
+    m_frame_push_is_scheduled = true;
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [this] {
+        push_frame_to_placeholder_canvas_element();
+    }));
+}
+
+void OffscreenCanvas::push_frame_to_placeholder_canvas_element()
+{
+    m_frame_push_is_scheduled = false;
+
+    if (!m_placeholder_transport || !m_placeholder_transport->is_open() || !m_bitmap)
+        return;
+
+    // NB: The frame is copied into shared memory, so that the placeholder canvas element can show it without copying
+    //     it again, while we carry on drawing the next frame into our own bitmap.
+    auto frame = m_bitmap->to_shareable_bitmap();
+    if (!frame.is_valid())
+        return;
+
+    IPC::MessageBuffer buffer;
+    IPC::Encoder encoder(buffer);
+    MUST(encoder.encode(frame));
+
+    if (auto result = buffer.transfer_message(*m_placeholder_transport); result.is_error()) {
+        dbgln("Failed to send OffscreenCanvas frame to its placeholder canvas element: {}", result.error());
+        m_placeholder_transport.clear();
+    }
 }
 
 WebIDL::UnsignedLong OffscreenCanvas::width() const
@@ -210,6 +306,9 @@ JS::ThrowCompletionOr<OffscreenRenderingContext> OffscreenCanvas::get_context(Bi
 
     // 3. Run the steps in the cell of the following table whose column header matches this OffscreenCanvas object's context mode and whose row header matches contextId:
     // NOTE: See the spec for the full table.
+    if (is_detached())
+        return throw_completion(WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas is detached"_utf16));
+
     if (contextId == Bindings::OffscreenRenderingContextId::_2d) {
         if (TRY(create_2d_context(options)) == HasOrCreatedContext::Yes)
             return GC::make_root(*m_context.get<GC::Ref<HTML::OffscreenCanvasRenderingContext2D>>());
@@ -237,7 +336,9 @@ WebIDL::ExceptionOr<GC::Ref<ImageBitmap>> OffscreenCanvas::transfer_to_image_bit
 {
     // The transferToImageBitmap() method, when invoked, must run the following steps :
 
-    // FIXME: 1. If the value of this OffscreenCanvas object's [[Detached]] internal slot is set to true, then throw an "InvalidStateError" DOMException.
+    // 1. If the value of this OffscreenCanvas object's [[Detached]] internal slot is set to true, then throw an "InvalidStateError" DOMException.
+    if (is_detached())
+        return WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas is detached"_utf16);
 
     // 2. If this OffscreenCanvas object's context mode is set to none, then throw an "InvalidStateError" DOMException.
     if (m_context.has<Empty>()) {
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <LibGfx/Forward.h>
+#include <LibIPC/Transport.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/Bindings/Transferable.h>
 #include <LibWeb/DOM/EventTarget.h>
@@ -62,6 +63,9 @@ public:
 
     GC::Ref<WebIDL::Promise> convert_to_blob(Optional<ImageEncodeOptions> options);
 
+    void set_placeholder_transport(NonnullOwnPtr<IPC::Transport>);
+    void did_draw();
+
     void set_oncontextlost(GC::Ptr<WebIDL::CallbackType>);
     GC::Ptr<WebIDL::CallbackType> oncontextlost();
     void set_oncontextrestored(GC::Ptr<WebIDL::CallbackType>);
@@ -82,9 +86,16 @@ private:
     void reset_context_to_default_state();
     WebIDL::ExceptionOr<void> set_new_bitmap_size(Gfx::IntSize new_size);
 
+    void push_frame_to_placeholder_canvas_element();
+
     Variant<GC::Ref<HTML::OffscreenCanvasRenderingContext2D>, GC::Ref<WebGL::WebGLRenderingContext>, GC::Ref<WebGL::WebGL2RenderingContext>, Empty> m_context;
 
     RefPtr<Gfx::Bitmap> m_bitmap;
+
+    // NB: If this has a placeholder canvas element, which may live in another process, our frames are sent to it on
+    //     this transport.
+    OwnPtr<IPC::Transport> m_placeholder_transport;
+    bool m_frame_push_is_scheduled { false };
 };
 
 }
@@ -5,8 +5,10 @@
  */
 
 #include <AK/OwnPtr.h>
+#include <LibGfx/Bitmap.h>
 #include <LibGfx/CompositingAndBlendingOperator.h>
 #include <LibGfx/PainterSkia.h>
+#include <LibGfx/PaintingSurface.h>
 #include <LibGfx/Rect.h>
 #include <LibUnicode/Segmenter.h>
 #include <LibWeb/Bindings/Intrinsics.h>
@@ -68,6 +70,8 @@ void OffscreenCanvasRenderingContext2D::set_size(Gfx::IntSize const& size)
     if (m_size == size)
         return;
     m_size = size;
+    m_painter_bitmap = nullptr;
+    m_painter = nullptr;
 }
 
 GC::Ref<OffscreenCanvas> OffscreenCanvasRenderingContext2D::canvas()
@@ -86,19 +90,38 @@ OffscreenCanvas const& OffscreenCanvasRenderingContext2D::canvas_element() const
     return *m_canvas;
 }
 
-void OffscreenCanvasRenderingContext2D::fill_rect(float, float, float, float)
+static Gfx::Path rect_path(float x, float y, float width, float height)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::fill_rect()");
+    Gfx::Path path;
+    path.move_to({ x, y });
+    path.line_to({ x + width, y });
+    path.line_to({ x + width, y + height });
+    path.line_to({ x, y + height });
+    path.line_to({ x, y });
+    return path;
 }
 
-void OffscreenCanvasRenderingContext2D::clear_rect(float, float, float, float)
+void OffscreenCanvasRenderingContext2D::fill_rect(float x, float y, float width, float height)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::clear_rect()");
+    fill_internal(rect_path(x, y, width, height), Gfx::WindingRule::EvenOdd);
 }
 
-void OffscreenCanvasRenderingContext2D::stroke_rect(float, float, float, float)
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-clearrect
+void OffscreenCanvasRenderingContext2D::clear_rect(float x, float y, float width, float height)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::stroke_rect()");
+    // 1. If any of the arguments are infinite or NaN, then return.
+    if (!isfinite(x) || !isfinite(y) || !isfinite(width) || !isfinite(height))
+        return;
+
+    if (auto* painter = this->painter()) {
+        painter->clear_rect({ x, y, width, height }, clear_color());
+        did_draw();
+    }
+}
+
+void OffscreenCanvasRenderingContext2D::stroke_rect(float x, float y, float width, float height)
+{
+    stroke_internal(rect_path(x, y, width, height));
 }
 
 WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::draw_image_internal(CanvasImageSource const&, float, float, float, float, float, float, float, float)
@@ -109,17 +132,67 @@ WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::draw_image_internal
 
 void OffscreenCanvasRenderingContext2D::begin_path()
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::begin_path()");
+    path().clear();
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#the-canvas-settings:concept-canvas-alpha
+Gfx::Color OffscreenCanvasRenderingContext2D::clear_color() const
+{
+    return m_context_attributes.alpha ? Gfx::Color::Transparent : Gfx::Color::Black;
+}
+
+// FIXME: Paint shadows, like CanvasRenderingContext2D does.
+void OffscreenCanvasRenderingContext2D::stroke_internal(Gfx::Path const& path)
+{
+    auto* painter = this->painter();
+    if (!painter)
+        return;
+
+    auto& state = drawing_state();
+    auto paint_style = state.stroke_style.to_gfx_paint_style();
+    if (!paint_style->is_visible())
+        return;
+
+    auto dash_array = Vector<float> {};
+    dash_array.ensure_capacity(state.dash_list.size());
+    for (auto const& dash : state.dash_list)
+        dash_array.append(static_cast<float>(dash));
+
+    painter->stroke_path(path, paint_style, state.filter, state.line_width, state.global_alpha, state.current_compositing_and_blending_operator, to_gfx_cap(state.line_cap), to_gfx_join(state.line_join), state.miter_limit, dash_array, state.line_dash_offset);
+
+    did_draw();
 }
 
 void OffscreenCanvasRenderingContext2D::stroke()
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::stroke()");
+    stroke_internal(path());
 }
 
-void OffscreenCanvasRenderingContext2D::stroke(Path2D const&)
+void OffscreenCanvasRenderingContext2D::stroke(Path2D const& path)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::stroke(Path2D)");
+    stroke_internal(path.path());
+}
+
+// FIXME: Paint shadows, like CanvasRenderingContext2D does.
+void OffscreenCanvasRenderingContext2D::fill_internal(Gfx::Path const& path, Gfx::WindingRule winding_rule)
+{
+    auto* painter = this->painter();
+    if (!painter)
+        return;
+
+    auto& state = drawing_state();
+    auto paint_style = state.fill_style.to_gfx_paint_style();
+    if (!paint_style->is_visible())
+        return;
+
+    painter->fill_path(path, paint_style, state.filter, state.global_alpha, state.current_compositing_and_blending_operator, winding_rule);
+
+    did_draw();
+}
+
+void OffscreenCanvasRenderingContext2D::did_draw()
+{
+    m_canvas->did_draw();
 }
 
 void OffscreenCanvasRenderingContext2D::fill_text(Utf16String const&, float, float, Optional<double>)
@@ -132,14 +205,14 @@ void OffscreenCanvasRenderingContext2D::stroke_text(Utf16String const&, float, f
     dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::stroke_text()");
 }
 
-void OffscreenCanvasRenderingContext2D::fill(StringView)
+void OffscreenCanvasRenderingContext2D::fill(StringView fill_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::fill(StringView)");
+    fill_internal(path(), parse_fill_rule(fill_rule));
 }
 
-void OffscreenCanvasRenderingContext2D::fill(Path2D&, StringView)
+void OffscreenCanvasRenderingContext2D::fill(Path2D& path, StringView fill_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::fill(Path2D&, StringView)");
+    fill_internal(path.path(), parse_fill_rule(fill_rule));
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-createimagedata
@@ -170,9 +243,28 @@ WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::put_image_data(Imag
     return {};
 }
 
+// https://html.spec.whatwg.org/multipage/canvas.html#reset-the-rendering-context-to-its-default-state
 void OffscreenCanvasRenderingContext2D::reset_to_default_state()
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::reset_to_default_state()");
+    auto* painter = this->painter();
+
+    // 1. Clear canvas's bitmap to transparent black.
+    if (painter)
+        painter->clear_rect(m_painter_bitmap->rect().to_type<float>(), clear_color());
+
+    // 2. Empty the list of subpaths in context's current default path.
+    path().clear();
+
+    // 3. Clear the context's drawing state stack.
+    clear_drawing_state_stack();
+
+    // 4. Reset everything that drawing state consists of to their initial values.
+    reset_drawing_state();
+
+    if (painter) {
+        painter->reset();
+        did_draw();
+    }
 }
 
 GC::Ref<TextMetrics> OffscreenCanvasRenderingContext2D::measure_text(Utf16String const&)
@@ -337,8 +429,21 @@ void OffscreenCanvasRenderingContext2D::set_global_composite_operation(String)
 
 [[nodiscard]] Gfx::Painter* OffscreenCanvasRenderingContext2D::painter()
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::painter()");
-    return nullptr;
+    auto bitmap = m_canvas->bitmap();
+    if (!bitmap) {
+        m_painter_bitmap = nullptr;
+        m_painter = nullptr;
+        return nullptr;
+    }
+
+    if (!m_painter || m_painter_bitmap != bitmap) {
+        m_painter_bitmap = bitmap;
+        m_painter = make<Gfx::PainterSkia>(Gfx::PaintingSurface::wrap_bitmap(*bitmap));
+
+        // NB: The painter keeps the current transform, so a new one has to be told about it.
+        m_painter->set_transform(drawing_state().transform);
+    }
+    return m_painter.ptr();
 }
 
 }
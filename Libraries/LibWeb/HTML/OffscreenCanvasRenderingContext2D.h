@@ -135,16 +135,24 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
-    virtual Gfx::Painter* painter_for_canvas_state() override
-    {
-        dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::painter_for_canvas_state()");
-        return nullptr;
-    }
+    virtual Gfx::Painter* painter_for_canvas_state() override { return painter(); }
     virtual Gfx::Path& path_for_canvas_state() override { return path(); }
 
+    Gfx::Color clear_color() const;
+
+    void stroke_internal(Gfx::Path const&);
+    void fill_internal(Gfx::Path const&, Gfx::WindingRule);
+
+    void did_draw();
+
     GC::Ref<OffscreenCanvas> m_canvas;
     Gfx::IntSize m_size;
     CanvasRenderingContext2DSettings m_context_attributes;
+
+    // NB: The painter draws into the bitmap of the canvas, which is replaced when the canvas is resized or its bitmap is
+    //     transferred to an ImageBitmap, so we have to remember which bitmap the painter was created for.
+    RefPtr<Gfx::Bitmap> m_painter_bitmap;
+    OwnPtr<Gfx::Painter> m_painter;
 };
 
 }
@@ -8,9 +8,14 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/GenericShorthands.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <AK/Utf32View.h>
+#include <LibCore/EventLoop.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/StyleValues/LengthStyleValue.h>
@@ -23,6 +28,7 @@
 #include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/ProcessingInstruction.h>
+#include <LibWeb/DOM/StyleInvalidator.h>
 #include <LibWeb/DOM/QualifiedName.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/Text.h>
@@ -155,7 +161,12 @@ static bool is_html_integration_point(DOM::Element const& element)
 }
 
 HTMLParser::HTMLParser(DOM::Document& document, StringView input, StringView encoding)
-    : m_tokenizer(input, encoding)
+    : HTMLParser(document, HTMLTokenizer::decode_input(input, *TextCodec::decoder_for(encoding)), encoding)
+{
+}
+
+HTMLParser::HTMLParser(DOM::Document& document, HTMLTokenizer::DecodedInput decoded_input, StringView encoding)
+    : m_tokenizer(move(decoded_input))
     , m_scripting_enabled(document.is_scripting_enabled())
     , m_document(document)
 {
@@ -207,6 +218,10 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
 {
     m_stop_parsing = false;
 
+    // NB: Everything inserted while running is invalidated at once when we yield, or when a script updates style.
+    auto& style_invalidator = m_document->style_invalidator();
+    style_invalidator.begin_insertion_batch();
+
     for (;;) {
         auto optional_token = m_tokenizer.next_token(stop_at_insertion_point);
         if (!optional_token.has_value())
@@ -249,6 +264,9 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
             process_using_the_rules_for_foreign_content(token);
         }
 
+        if (token.is_character() && token.code_point() != 0)
+            insert_the_rest_of_the_text_run(stop_at_insertion_point);
+
         if (token.is_end_of_file() && m_tokenizer.is_eof_inserted())
             break;
 
@@ -260,6 +278,8 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
 
     flush_character_insertions();
 
+    style_invalidator.end_insertion_batch();
+
     m_tokenizer.parser_did_run({});
 }
 
@@ -1477,6 +1497,37 @@ void HTMLParser::insert_character(u32 data)
     m_character_insertion_builder.append_code_point(data);
 }
 
+// OPTIMIZATION: Text is by far the most common content of a document's body, so once a character token has been
+//               inserted in the "in body" insertion mode, we insert the rest of the text that follows it at once.
+//               (A U+0000 NULL character token is the one that isn't inserted, so the caller doesn't get here for it.)
+//               The tokens for it would all be character tokens that aren't U+0000 NULL, for each of which the "in body"
+//               insertion mode reconstructs the active formatting elements (which the first token has just done), and
+//               inserts the character in the same text node.
+void HTMLParser::insert_the_rest_of_the_text_run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
+{
+    if (m_stop_parsing
+        || m_insertion_mode != InsertionMode::InBody
+        || m_stack_of_open_elements.is_empty()
+        || adjusted_current_node()->namespace_uri() != Namespace::HTML
+        || m_character_insertion_builder.is_empty())
+        return;
+
+    auto text_run = m_tokenizer.consume_text_run_in_data_state(stop_at_insertion_point);
+    if (text_run.is_empty())
+        return;
+
+    if (m_frameset_ok) {
+        for (auto code_point : text_run) {
+            if (!first_is_one_of(code_point, '\t', '\n', '\f', '\r', ' ')) {
+                m_frameset_ok = false;
+                break;
+            }
+        }
+    }
+
+    m_character_insertion_builder.append(Utf32View { text_run });
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#the-after-head-insertion-mode
 void HTMLParser::handle_after_head(HTMLToken& token)
 {
@@ -3410,7 +3461,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    m_speculative_parser.start(*m_document, m_tokenizer.unconsumed_input());
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -3429,7 +3481,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     if (m_aborted)
                         return;
 
-                    // FIXME: 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // NB: Our speculative HTML parser has already stopped, as it runs to completion when started.
 
                     // 8. Unblock the tokenizer for this instance of the HTML parser, such that tasks that invoke the tokenizer can again be run.
                     m_tokenizer.set_blocked(false);
@@ -4950,15 +5003,55 @@ GC::Ref<HTMLParser> HTMLParser::create_for_scripting(DOM::Document& document)
     return document.realm().create<HTMLParser>(document);
 }
 
-GC::Ref<HTMLParser> HTMLParser::create_with_uncertain_encoding(DOM::Document& document, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type)
+static ByteString encoding_for_input(DOM::Document& document, ReadonlyBytes input, Optional<MimeSniff::MimeType> maybe_mime_type)
 {
     if (document.has_encoding())
-        return document.realm().create<HTMLParser>(document, input, document.encoding().value().to_byte_string());
+        return document.encoding().value().to_byte_string();
     auto encoding = run_encoding_sniffing_algorithm(document, input, maybe_mime_type);
     dbgln_if(HTML_PARSER_DEBUG, "The encoding sniffing algorithm returned encoding '{}'", encoding);
+    return encoding;
+}
+
+GC::Ref<HTMLParser> HTMLParser::create_with_uncertain_encoding(DOM::Document& document, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type)
+{
+    auto encoding = encoding_for_input(document, input, move(maybe_mime_type));
     return document.realm().create<HTMLParser>(document, input, encoding);
 }
 
+static constexpr size_t off_thread_decoding_threshold = 64 * KiB;
+
+void HTMLParser::create_with_uncertain_encoding_off_thread(DOM::Document& document, ByteBuffer input, Optional<MimeSniff::MimeType> maybe_mime_type, Function<void(GC::Ref<HTMLParser>)> on_created)
+{
+    auto encoding = encoding_for_input(document, input, move(maybe_mime_type));
+    if (input.size() < off_thread_decoding_threshold) {
+        on_created(document.realm().create<HTMLParser>(document, input, encoding));
+        return;
+    }
+
+    auto decoder = TextCodec::decoder_for(encoding);
+    VERIFY(decoder.has_value());
+
+    // NB: The callback is heap-allocated so that if the event loop is destroyed while decoding, we leak it (and the
+    //     GC::Root it captures) rather than destroying them on the worker thread.
+    auto* on_decoded = new Function<void(HTMLTokenizer::DecodedInput)>([document = GC::Root { document }, encoding = move(encoding), on_created = move(on_created)](HTMLTokenizer::DecodedInput decoded_input) mutable {
+        on_created(document->realm().create<HTMLParser>(*document, move(decoded_input), encoding));
+    });
+
+    auto event_loop_weak = Core::EventLoop::current_weak();
+    Threading::ThreadPool::the().submit([input = move(input), &decoder = *decoder, on_decoded, event_loop_weak = move(event_loop_weak)]() mutable {
+        auto decoded_input = HTMLTokenizer::decode_input(input, decoder);
+        input.clear();
+
+        auto origin = event_loop_weak->take();
+        if (!origin)
+            return;
+        origin->deferred_invoke([decoded_input = move(decoded_input), on_decoded]() mutable {
+            (*on_decoded)(move(decoded_input));
+            delete on_decoded;
+        });
+    });
+}
+
 GC::Ref<HTMLParser> HTMLParser::create(DOM::Document& document, StringView input, StringView encoding)
 {
     return document.realm().create<HTMLParser>(document, input, encoding);
@@ -4969,31 +5062,140 @@ enum class AttributeMode {
     Yes,
 };
 
-template<OneOf<Utf8View, Utf16View> ViewType>
-static String escape_string(ViewType const& string, AttributeMode attribute_mode)
+// OPTIMIZATION: Most text needs no escaping at all, so we look for the next code unit that might need it 16 bytes at a
+//               time, and append everything before it in one go.
+template<OneOf<u8, char16_t> CodeUnit>
+static size_t find_next_code_unit_to_escape(ReadonlySpan<CodeUnit> code_units, AttributeMode attribute_mode)
 {
-    // https://html.spec.whatwg.org/multipage/parsing.html#escapingString
-    StringBuilder builder;
-    for (auto code_point : string) {
-        // 1. Replace any occurrence of the "&" character by the string "&amp;".
-        if (code_point == '&')
-            builder.append("&amp;"sv);
-        // 2. Replace any occurrences of the U+00A0 NO-BREAK SPACE character by the string "&nbsp;".
-        else if (code_point == 0xA0)
-            builder.append("&nbsp;"sv);
-        // 3. Replace any occurrences of the "<" character by the string "&lt;".
-        else if (code_point == '<')
-            builder.append("&lt;"sv);
-        // 4. Replace any occurrences of the ">" character by the string "&gt;".
-        else if (code_point == '>')
-            builder.append("&gt;"sv);
-        // 5. If the algorithm was invoked in the attribute mode, then replace any occurrences of the """ character by the string "&quot;".
-        else if (code_point == '"' && attribute_mode == AttributeMode::Yes)
-            builder.append("&quot;"sv);
-        else
-            builder.append_code_point(code_point);
+    using namespace AK::SIMD;
+    using VectorType = Conditional<sizeof(CodeUnit) == 1, u8x16, u16x8>;
+    static constexpr size_t lanes = sizeof(VectorType) / sizeof(CodeUnit);
+
+    auto splat = [](CodeUnit code_unit) {
+        VectorType vector;
+        for (size_t i = 0; i < lanes; ++i)
+            vector[i] = code_unit;
+        return vector;
+    };
+
+    // NB: In UTF-8, U+00A0 NO-BREAK SPACE is encoded as 0xC2 0xA0, so we stop at any 0xC2 and let the caller check the
+    //     byte after it.
+    auto no_break_space_code_unit = static_cast<CodeUnit>(sizeof(CodeUnit) == 1 ? 0xC2 : 0xA0);
+    auto is_code_unit_to_escape = [&](CodeUnit code_unit) {
+        return code_unit == '&' || code_unit == '<' || code_unit == '>' || code_unit == no_break_space_code_unit
+            || (code_unit == '"' && attribute_mode == AttributeMode::Yes);
+    };
+
+    auto ampersands = splat('&');
+    auto less_than_signs = splat('<');
+    auto greater_than_signs = splat('>');
+    auto no_break_spaces = splat(no_break_space_code_unit);
+    auto quotation_marks = splat(attribute_mode == AttributeMode::Yes ? '"' : '&');
+
+    size_t offset = 0;
+    for (; offset + lanes <= code_units.size(); offset += lanes) {
+        auto chunk = load_unaligned<VectorType>(code_units.offset_pointer(offset));
+        auto matches = (chunk == ampersands) | (chunk == less_than_signs) | (chunk == greater_than_signs) | (chunk == no_break_spaces) | (chunk == quotation_marks);
+        u64 match_halves[2];
+        __builtin_memcpy(match_halves, &matches, sizeof(match_halves));
+        if ((match_halves[0] | match_halves[1]) != 0)
+            break;
+    }
+
+    for (; offset < code_units.size(); ++offset) {
+        if (is_code_unit_to_escape(code_units[offset]))
+            break;
+    }
+    return offset;
+}
+
+static void append_escaped_code_point(StringBuilder& builder, u32 code_point)
+{
+    // 1. Replace any occurrence of the "&" character by the string "&amp;".
+    if (code_point == '&')
+        builder.append("&amp;"sv);
+    // 2. Replace any occurrences of the U+00A0 NO-BREAK SPACE character by the string "&nbsp;".
+    else if (code_point == 0xA0)
+        builder.append("&nbsp;"sv);
+    // 3. Replace any occurrences of the "<" character by the string "&lt;".
+    else if (code_point == '<')
+        builder.append("&lt;"sv);
+    // 4. Replace any occurrences of the ">" character by the string "&gt;".
+    else if (code_point == '>')
+        builder.append("&gt;"sv);
+    // 5. If the algorithm was invoked in the attribute mode, then replace any occurrences of the """ character by the string "&quot;".
+    //    NB: Callers only pass a quotation mark in attribute mode.
+    else if (code_point == '"')
+        builder.append("&quot;"sv);
+    else
+        builder.append_code_point(code_point);
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#escapingString
+static void append_escaped_string(StringBuilder& builder, StringView string, AttributeMode attribute_mode)
+{
+    auto bytes = string.bytes();
+    while (!bytes.is_empty()) {
+        auto offset = find_next_code_unit_to_escape(bytes, attribute_mode);
+        builder.append(StringView { bytes.trim(offset) });
+        if (offset == bytes.size())
+            break;
+
+        if (bytes[offset] == 0xC2) {
+            if (offset + 1 < bytes.size() && bytes[offset + 1] == 0xA0) {
+                append_escaped_code_point(builder, 0xA0);
+                bytes = bytes.slice(offset + 2);
+            } else {
+                builder.append(static_cast<char>(bytes[offset]));
+                bytes = bytes.slice(offset + 1);
+            }
+            continue;
+        }
+
+        append_escaped_code_point(builder, bytes[offset]);
+        bytes = bytes.slice(offset + 1);
+    }
+}
+
+static void append_escaped_string(StringBuilder& builder, Utf16View const& string, AttributeMode attribute_mode)
+{
+    if (string.has_ascii_storage()) {
+        append_escaped_string(builder, StringView { string.bytes() }, attribute_mode);
+        return;
     }
-    return builder.to_string_without_validation();
+
+    auto code_units = string.utf16_span();
+    size_t start = 0;
+    while (start < code_units.size()) {
+        auto offset = start + find_next_code_unit_to_escape(code_units.slice(start), attribute_mode);
+        builder.append(string.substring_view(start, offset - start));
+        if (offset == code_units.size())
+            break;
+
+        append_escaped_code_point(builder, code_units[offset]);
+        start = offset + 1;
+    }
+}
+
+namespace {
+
+// NB: The serialization algorithm recurses into every element, which we unroll into a stack of these so that deeply
+//     nested trees don't overflow the call stack, and so that everything is appended to a single builder.
+struct FragmentSerializationStep {
+    enum class Type : u8 {
+        // Steps 1 to 6 of the HTML fragment serialization algorithm for node.
+        SerializeChildren,
+        // Step 5.2 of the HTML fragment serialization algorithm for node.
+        SerializeNode,
+        // Append "</", tag_name and ">".
+        AppendEndTag,
+    };
+
+    Type type;
+    DOM::Node const* node { nullptr };
+    FlyString tag_name {};
+};
+
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#html-fragment-serialisation-algorithm
@@ -5006,6 +5208,13 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
     // 2. Let s be a string, and initialize it to the empty string.
     StringBuilder builder;
 
+    Vector<FragmentSerializationStep, 32> steps;
+
+    auto push_children = [&](DOM::Node const& parent) {
+        for (auto* child = parent.last_child(); child; child = child->previous_sibling())
+            steps.append({ FragmentSerializationStep::Type::SerializeNode, child });
+    };
+
     auto serialize_element = [&](DOM::Element const& element) {
         // If current node is an element in the HTML namespace, the MathML namespace, or the SVG namespace, then let tagname be current node's local name.
         // Otherwise, let tagname be current node's qualified name.
@@ -5026,7 +5235,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // followed by a U+0022 QUOTATION MARK character (").
         if (element.is_value().has_value() && !element.has_attribute(AttributeNames::is)) {
             builder.append(" is=\""sv);
-            builder.append(escape_string(element.is_value().value().code_points(), AttributeMode::Yes));
+            append_escaped_string(builder, element.is_value()->bytes_as_string_view(), AttributeMode::Yes);
             builder.append('"');
         }
 
@@ -5076,7 +5285,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             }
 
             builder.append("=\""sv);
-            builder.append(escape_string(attribute.value().code_points(), AttributeMode::Yes));
+            append_escaped_string(builder, attribute.value().bytes_as_string_view(), AttributeMode::Yes);
             builder.append('"');
         });
 
@@ -5085,7 +5294,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
         // If current node serializes as void, then continue on to the next child node at this point.
         if (element.serializes_as_void())
-            return IterationDecision::Continue;
+            return;
 
         // Append the value of running the HTML fragment serialization algorithm with current node,
         // serializableShadowRoots, and shadowRoots (thus recursing into this algorithm for that node),
@@ -5093,83 +5302,81 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // a U+002F SOLIDUS character (/),
         // tagname again,
         // and finally a U+003E GREATER-THAN SIGN character (>).
-        builder.append(serialize_html_fragment(element, serializable_shadow_roots, shadow_roots));
-        builder.append("</"sv);
-        builder.append(tag_name);
-        builder.append('>');
-
-        return IterationDecision::Continue;
+        steps.append({ FragmentSerializationStep::Type::AppendEndTag, nullptr, move(tag_name) });
+        steps.append({ FragmentSerializationStep::Type::SerializeChildren, &element });
     };
 
-    if (fragment_serialization_mode == DOM::FragmentSerializationMode::Outer) {
-        serialize_element(as<DOM::Element>(node));
-        return builder.to_string_without_validation();
-    }
+    auto serialize_children = [&](DOM::Node const& node) {
+        // The algorithm takes as input a DOM Element, Document, or DocumentFragment referred to as the node.
+        VERIFY(node.is_element() || node.is_document() || node.is_document_fragment());
+        GC::Ref<DOM::Node const> actual_node = node;
 
-    // The algorithm takes as input a DOM Element, Document, or DocumentFragment referred to as the node.
-    VERIFY(node.is_element() || node.is_document() || node.is_document_fragment());
-    GC::Ref<DOM::Node const> actual_node = node;
+        if (is<DOM::Element>(node)) {
+            auto const& element = as<DOM::Element>(node);
 
-    if (is<DOM::Element>(node)) {
-        auto const& element = as<DOM::Element>(node);
+            // 1. If the node serializes as void, then return the empty string.
+            //    (NOTE: serializes as void is defined only on elements in the spec)
+            if (element.serializes_as_void())
+                return;
 
-        // 1. If the node serializes as void, then return the empty string.
-        //    (NOTE: serializes as void is defined only on elements in the spec)
-        if (element.serializes_as_void())
-            return String {};
-
-        // 3. If the node is a template element, then let the node instead be the template element's template contents (a DocumentFragment node).
-        //    (NOTE: This is out of order of the spec to avoid another dynamic cast. The second step just creates a string builder, so it shouldn't matter)
-        if (is<HTML::HTMLTemplateElement>(element))
-            actual_node = as<HTML::HTMLTemplateElement>(element).content();
-
-        // 4. If current node is a shadow host, then:
-        if (element.is_shadow_host()) {
-            // 1. Let shadow be current node's shadow root.
-            auto shadow = element.shadow_root();
-
-            // 2. If one of the following is true:
-            //    - serializableShadowRoots is true and shadow's serializable is true; or
-            //    - shadowRoots contains shadow,
-            if ((serializable_shadow_roots == SerializableShadowRoots::Yes && shadow->serializable())
-                || shadow_roots.contains([&](auto& entry) { return entry == shadow; })) {
-                // then:
-                // 1. Append "<template shadowrootmode="".
-                builder.append("<template shadowrootmode=\""sv);
-
-                // 2. If shadow's mode is "open", then append "open". Otherwise, append "closed".
-                builder.append(shadow->mode() == Bindings::ShadowRootMode::Open ? "open"sv : "closed"sv);
-
-                // 3. Append """.
-                builder.append('"');
-
-                // 4. If shadow's delegates focus is set, then append " shadowrootdelegatesfocus=""".
-                if (shadow->delegates_focus())
-                    builder.append(" shadowrootdelegatesfocus=\"\""sv);
-
-                // 5. If shadow's serializable is set, then append " shadowrootserializable=""".
-                if (shadow->serializable())
-                    builder.append(" shadowrootserializable=\"\""sv);
-
-                // 6. If shadow's clonable is set, then append " shadowrootclonable=""".
-                if (shadow->clonable())
-                    builder.append(" shadowrootclonable=\"\""sv);
-
-                // 7. Append ">".
-                builder.append('>');
-
-                // 8. Append the value of running the HTML fragment serialization algorithm with shadow,
-                //    serializableShadowRoots, and shadowRoots (thus recursing into this algorithm for that element).
-                builder.append(serialize_html_fragment(*shadow, serializable_shadow_roots, shadow_roots));
-
-                // 9. Append "</template>".
-                builder.append("</template>"sv);
+            // 3. If the node is a template element, then let the node instead be the template element's template contents (a DocumentFragment node).
+            //    (NOTE: This is out of order of the spec to avoid another dynamic cast. The second step just creates a string builder, so it shouldn't matter)
+            if (is<HTML::HTMLTemplateElement>(element))
+                actual_node = as<HTML::HTMLTemplateElement>(element).content();
+
+            // NB: The children of the node come after everything appended in step 4, so they are pushed first.
+            push_children(actual_node);
+
+            // 4. If current node is a shadow host, then:
+            if (element.is_shadow_host()) {
+                // 1. Let shadow be current node's shadow root.
+                auto shadow = element.shadow_root();
+
+                // 2. If one of the following is true:
+                //    - serializableShadowRoots is true and shadow's serializable is true; or
+                //    - shadowRoots contains shadow,
+                if ((serializable_shadow_roots == SerializableShadowRoots::Yes && shadow->serializable())
+                    || shadow_roots.contains([&](auto& entry) { return entry == shadow; })) {
+                    // then:
+                    // 1. Append "<template shadowrootmode="".
+                    builder.append("<template shadowrootmode=\""sv);
+
+                    // 2. If shadow's mode is "open", then append "open". Otherwise, append "closed".
+                    builder.append(shadow->mode() == Bindings::ShadowRootMode::Open ? "open"sv : "closed"sv);
+
+                    // 3. Append """.
+                    builder.append('"');
+
+                    // 4. If shadow's delegates focus is set, then append " shadowrootdelegatesfocus=""".
+                    if (shadow->delegates_focus())
+                        builder.append(" shadowrootdelegatesfocus=\"\""sv);
+
+                    // 5. If shadow's serializable is set, then append " shadowrootserializable=""".
+                    if (shadow->serializable())
+                        builder.append(" shadowrootserializable=\"\""sv);
+
+                    // 6. If shadow's clonable is set, then append " shadowrootclonable=""".
+                    if (shadow->clonable())
+                        builder.append(" shadowrootclonable=\"\""sv);
+
+                    // 7. Append ">".
+                    builder.append('>');
+
+                    // 8. Append the value of running the HTML fragment serialization algorithm with shadow,
+                    //    serializableShadowRoots, and shadowRoots (thus recursing into this algorithm for that element).
+                    // 9. Append "</template>".
+                    steps.append({ FragmentSerializationStep::Type::AppendEndTag, nullptr, HTML::TagNames::template_ });
+                    steps.append({ FragmentSerializationStep::Type::SerializeChildren, shadow.ptr() });
+                }
             }
+            return;
         }
-    }
 
-    // 5. For each child node of the node, in tree order, run the following steps:
-    actual_node->for_each_child([&](DOM::Node& current_node) {
+        // 5. For each child node of the node, in tree order, run the following steps:
+        push_children(actual_node);
+    };
+
+    auto serialize_node = [&](DOM::Node const& current_node) {
         // 1. Let current node be the child node being processed.
 
         // 2. Append the appropriate string from the following list to s:
@@ -5178,7 +5385,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             // -> If current node is an Element
             auto& element = as<DOM::Element>(current_node);
             serialize_element(element);
-            return IterationDecision::Continue;
+            return;
         }
 
         if (is<DOM::Text>(current_node)) {
@@ -5194,12 +5401,13 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
                 if (parent_element.local_name().is_one_of(HTML::TagNames::style, HTML::TagNames::script, HTML::TagNames::xmp, HTML::TagNames::iframe, HTML::TagNames::noembed, HTML::TagNames::noframes, HTML::TagNames::plaintext)
                     || (parent_element.local_name() == HTML::TagNames::noscript && !parent_element.is_scripting_disabled())) {
                     builder.append(text_node.data());
-                    return IterationDecision::Continue;
+                    return;
                 }
             }
 
             // Otherwise, append the value of current node's data IDL attribute, escaped as described below.
-            builder.append(escape_string(text_node.data().utf16_view(), AttributeMode::No));
+            append_escaped_string(builder, text_node.data().utf16_view(), AttributeMode::No);
+            return;
         }
 
         if (is<DOM::Comment>(current_node)) {
@@ -5211,7 +5419,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             builder.append("<!--"sv);
             builder.append(comment_node.data());
             builder.append("-->"sv);
-            return IterationDecision::Continue;
+            return;
         }
 
         if (is<DOM::ProcessingInstruction>(current_node)) {
@@ -5225,7 +5433,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             builder.append(' ');
             builder.append(processing_instruction_node.data());
             builder.append('>');
-            return IterationDecision::Continue;
+            return;
         }
 
         if (is<DOM::DocumentType>(current_node)) {
@@ -5238,11 +5446,30 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             builder.append("<!DOCTYPE "sv);
             builder.append(document_type_node.name());
             builder.append('>');
-            return IterationDecision::Continue;
         }
+    };
 
-        return IterationDecision::Continue;
-    });
+    if (fragment_serialization_mode == DOM::FragmentSerializationMode::Outer)
+        steps.append({ FragmentSerializationStep::Type::SerializeNode, &node });
+    else
+        steps.append({ FragmentSerializationStep::Type::SerializeChildren, &node });
+
+    while (!steps.is_empty()) {
+        auto step = steps.take_last();
+        switch (step.type) {
+        case FragmentSerializationStep::Type::SerializeChildren:
+            serialize_children(*step.node);
+            break;
+        case FragmentSerializationStep::Type::SerializeNode:
+            serialize_node(*step.node);
+            break;
+        case FragmentSerializationStep::Type::AppendEndTag:
+            builder.append("</"sv);
+            builder.append(step.tag_name);
+            builder.append('>');
+            break;
+        }
+    }
 
     // 6. Return s.
     return MUST(builder.to_string());
@@ -5513,7 +5740,8 @@ void HTMLParser::abort()
     // 1. Throw away any pending content in the input stream, and discard any future content that would have been added to it.
     m_tokenizer.abort();
 
-    // FIXME: 2. Stop the speculative HTML parser for this HTML parser.
+    // 2. Stop the speculative HTML parser for this HTML parser.
+    // NB: Our speculative HTML parser only ever runs to completion when started, so there's nothing to stop.
 
     // 3. Update the current document readiness to "interactive".
     m_document->update_readiness(DocumentReadyState::Interactive);
@@ -12,6 +12,7 @@
 #include <LibWeb/Export.h>
 #include <LibWeb/HTML/Parser/HTMLTokenizer.h>
 #include <LibWeb/HTML/Parser/ListOfActiveFormattingElements.h>
+#include <LibWeb/HTML/Parser/SpeculativeHTMLParser.h>
 #include <LibWeb/HTML/Parser/StackOfOpenElements.h>
 #include <LibWeb/MimeSniff/MimeType.h>
 
@@ -51,6 +52,10 @@ public:
 
     static GC::Ref<HTMLParser> create_for_scripting(DOM::Document&);
     static GC::Ref<HTMLParser> create_with_uncertain_encoding(DOM::Document&, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type = {});
+
+    // Like create_with_uncertain_encoding(), except that a large input is decoded on the thread pool. The callback is
+    // called with the parser on the main thread, which may be right away.
+    static void create_with_uncertain_encoding_off_thread(DOM::Document&, ByteBuffer input, Optional<MimeSniff::MimeType>, Function<void(GC::Ref<HTMLParser>)> on_created);
     static GC::Ref<HTMLParser> create(DOM::Document&, StringView input, StringView encoding);
 
     void run(HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
@@ -93,6 +98,7 @@ public:
 
 private:
     HTMLParser(DOM::Document&, StringView input, StringView encoding);
+    HTMLParser(DOM::Document&, HTMLTokenizer::DecodedInput, StringView encoding);
     HTMLParser(DOM::Document&);
 
     virtual void visit_edges(Cell::Visitor&) override;
@@ -151,6 +157,7 @@ private:
     [[nodiscard]] GC::Ptr<DOM::Element> adjusted_current_node();
     [[nodiscard]] GC::Ptr<DOM::Element> node_before_current_node();
     void insert_character(u32 data);
+    void insert_the_rest_of_the_text_run(HTMLTokenizer::StopAtInsertionPoint);
     void insert_comment(HTMLToken&);
     void reconstruct_the_active_formatting_elements();
     void close_a_p_element();
@@ -187,6 +194,7 @@ private:
     ListOfActiveFormattingElements m_list_of_active_formatting_elements;
 
     HTMLTokenizer m_tokenizer;
+    SpeculativeHTMLParser m_speculative_parser;
 
     bool m_next_line_feed_can_be_ignored { false };
 
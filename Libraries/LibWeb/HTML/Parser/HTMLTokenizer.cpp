@@ -5,10 +5,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericShorthands.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
+#include <AK/Utf32View.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/HTML/Parser/Entities.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
@@ -238,6 +241,78 @@ void HTMLTokenizer::skip(size_t count)
     }
 }
 
+// Returns the length of the run at the start of the input that contains neither the terminator nor '&', U+000D CR or
+// U+0000 NULL, which are the code points that the states consuming such runs handle individually.
+static size_t find_end_of_text_run(ReadonlySpan<u32> input, u32 terminator)
+{
+    using namespace AK::SIMD;
+
+    auto terminators = expand4(terminator);
+    auto ampersands = expand4(static_cast<u32>('&'));
+    auto carriage_returns = expand4(static_cast<u32>('\r'));
+    auto nulls = expand4(0u);
+
+    size_t offset = 0;
+    for (; offset + 4 <= input.size(); offset += 4) {
+        auto code_points = load_unaligned<u32x4>(input.offset_pointer(offset));
+        i32x4 special = (code_points == terminators) | (code_points == ampersands) | (code_points == carriage_returns) | (code_points == nulls);
+        if (auto mask = maskbits(special); mask != 0)
+            return offset + count_trailing_zeroes(static_cast<u32>(mask));
+    }
+
+    for (; offset < input.size(); ++offset) {
+        auto code_point = input[offset];
+        if (code_point == terminator || code_point == '&' || code_point == '\r' || code_point == 0)
+            break;
+    }
+    return offset;
+}
+
+ReadonlySpan<u32> HTMLTokenizer::consume_text_run(u32 terminator, StopAtInsertionPoint stop_at_insertion_point)
+{
+    auto end = static_cast<ssize_t>(m_decoded_input.size());
+    if (stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.has_value())
+        end = min(end, *m_insertion_point);
+    if (m_current_offset >= end)
+        return {};
+
+    auto text_run = m_decoded_input.span().slice(m_current_offset, end - m_current_offset);
+    text_run = text_run.trim(find_end_of_text_run(text_run, terminator));
+    if (text_run.is_empty())
+        return {};
+
+    // NB: This leaves the source positions the way skip() would, as far as the last two of them go, since those are
+    //     the only ones that are looked back on after the text run.
+    if (!m_source_positions.is_empty()) {
+        auto position = m_source_positions.last();
+        auto advance_position = [&](u32 code_point) {
+            if (code_point == '\n') {
+                position.column = 0;
+                position.line++;
+            } else {
+                position.column++;
+            }
+        };
+        for (auto code_point : text_run.trim(text_run.size() - 1))
+            advance_position(code_point);
+        if (text_run.size() > 1)
+            m_source_positions.append(position);
+        advance_position(text_run.last());
+        m_source_positions.append(position);
+    }
+
+    m_current_offset += text_run.size();
+    m_prev_offset = m_current_offset - 1;
+    return text_run;
+}
+
+ReadonlySpan<u32> HTMLTokenizer::consume_text_run_in_data_state(StopAtInsertionPoint stop_at_insertion_point)
+{
+    if (m_state != State::Data || !m_queued_tokens.is_empty() || m_aborted)
+        return {};
+    return consume_text_run('<', stop_at_insertion_point);
+}
+
 Optional<u32> HTMLTokenizer::peek_code_point(ssize_t offset, StopAtInsertionPoint stop_at_insertion_point) const
 {
     auto it = m_current_offset + offset;
@@ -1316,6 +1391,8 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    // OPTIMIZATION: Append the rest of the value up to the next code point handled above at once.
+                    m_current_builder.append(Utf32View { consume_text_run('"', stop_at_insertion_point) });
                     continue;
                 }
             }
@@ -1348,6 +1425,8 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    // OPTIMIZATION: Append the rest of the value up to the next code point handled above at once.
+                    m_current_builder.append(Utf32View { consume_text_run('\'', stop_at_insertion_point) });
                     continue;
                 }
             }
@@ -2883,14 +2962,40 @@ HTMLTokenizer::HTMLTokenizer()
     m_source_positions.empend(0u, 0u);
 }
 
-HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
+HTMLTokenizer::DecodedInput HTMLTokenizer::decode_input(StringView input, TextCodec::Decoder& decoder)
+{
+    DecodedInput decoded_input;
+    decoded_input.source = MUST(decoder.to_utf8(input));
+    decoded_input.code_points.ensure_capacity(decoded_input.source.bytes().size());
+    for (auto code_point : decoded_input.source.code_points())
+        decoded_input.code_points.unchecked_append(code_point);
+    return decoded_input;
+}
+
+static TextCodec::Decoder& decoder_for_encoding(StringView encoding)
 {
     auto decoder = TextCodec::decoder_for(encoding);
     VERIFY(decoder.has_value());
-    m_source = MUST(decoder->to_utf8(input));
-    m_decoded_input.ensure_capacity(m_source.bytes().size());
-    for (auto code_point : m_source.code_points())
-        m_decoded_input.append(code_point);
+    return *decoder;
+}
+
+HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
+    : HTMLTokenizer(decode_input(input, decoder_for_encoding(encoding)))
+{
+}
+
+HTMLTokenizer::HTMLTokenizer(DecodedInput decoded_input)
+{
+    m_source = move(decoded_input.source);
+    m_decoded_input = move(decoded_input.code_points);
+    m_current_offset = 0;
+    m_prev_offset = 0;
+    m_source_positions.empend(0u, 0u);
+}
+
+HTMLTokenizer::HTMLTokenizer(ReadonlySpan<u32> decoded_input)
+{
+    m_decoded_input.append(decoded_input.data(), decoded_input.size());
     m_current_offset = 0;
     m_prev_offset = 0;
     m_source_positions.empend(0u, 0u);
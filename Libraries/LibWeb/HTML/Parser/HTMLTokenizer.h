@@ -13,6 +13,7 @@
 #include <AK/Types.h>
 #include <LibGC/Cell.h>
 #include <LibGC/Ptr.h>
+#include <LibTextCodec/Forward.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/Parser/Entities.h>
@@ -104,8 +105,18 @@ namespace Web::HTML {
 
 class WEB_API HTMLTokenizer {
 public:
+    // The input decoded to UTF-8 (to become the document's source), and to the code points that are tokenized.
+    // NB: Decoding doesn't need any other tokenizer state, so it can happen on another thread.
+    struct DecodedInput {
+        String source;
+        Vector<u32> code_points;
+    };
+    static DecodedInput decode_input(StringView input, TextCodec::Decoder&);
+
     explicit HTMLTokenizer();
     explicit HTMLTokenizer(StringView input, ByteString const& encoding);
+    explicit HTMLTokenizer(DecodedInput);
+    explicit HTMLTokenizer(ReadonlySpan<u32> decoded_input);
 
     enum class State {
 #define __ENUMERATE_TOKENIZER_STATE(state) state,
@@ -119,6 +130,11 @@ public:
     };
     Optional<HTMLToken> next_token(StopAtInsertionPoint = StopAtInsertionPoint::No);
 
+    // OPTIMIZATION: Consumes the text that follows in the data state, up to the next code point the data state does
+    //               more with than emitting it as a character token, and returns it. This lets the parser insert a
+    //               run of text at once, instead of processing a character token for each of its code points.
+    ReadonlySpan<u32> consume_text_run_in_data_state(StopAtInsertionPoint);
+
     void set_parser(Badge<HTMLParser>, HTMLParser& parser) { m_parser = &parser; }
 
     void switch_to(Badge<HTMLParser>, State new_state);
@@ -132,6 +148,9 @@ public:
 
     auto const& source() const { return m_source; }
 
+    // The decoded input that hasn't been tokenized yet.
+    ReadonlySpan<u32> unconsumed_input() const { return m_decoded_input.span().slice(m_current_offset); }
+
     void insert_input_at_insertion_point(StringView input);
     void insert_eof();
     bool is_eof_inserted();
@@ -152,6 +171,7 @@ public:
 
 private:
     void skip(size_t count);
+    ReadonlySpan<u32> consume_text_run(u32 terminator, StopAtInsertionPoint);
     Optional<u32> next_code_point(StopAtInsertionPoint);
     Optional<u32> peek_code_point(ssize_t offset, StopAtInsertionPoint) const;
 
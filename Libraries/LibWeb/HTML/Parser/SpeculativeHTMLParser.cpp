@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/ContentSecurityPolicy/PolicyList.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/FetchController.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/HTMLToken.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/Parser/SpeculativeHTMLParser.h>
+#include <LibWeb/HTML/PolicyContainers.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/PreloadedResources.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+#include <LibWeb/ReferrerPolicy/ReferrerPolicy.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+void SpeculativeHTMLParser::start(DOM::Document& document, ReadonlySpan<u32> input)
+{
+    if (input.is_empty())
+        return;
+
+    // NB: A speculative fetch is made without the element that will make the real one, so it can't carry the nonce or
+    //     other element metadata that a content security policy checks. Rather than fetching resources the policy
+    //     might block, nothing is fetched speculatively in a document that has one.
+    if (!document.policy_container()->csp_list->policies().is_empty())
+        return;
+
+    // OPTIMIZATION: If no input was inserted since the last time we were started, the input that's left is the end of
+    //               what we scanned then, and there is nothing new to find in it.
+    if (input.size() <= m_scanned_input.size() && input.data() + input.size() == m_scanned_input.data() + m_scanned_input.size())
+        return;
+    m_scanned_input = input;
+
+    // NB: The spec lets the speculative parser run in parallel with the script that blocks the parser. We instead scan
+    //     all of the input that's left before waiting for the script, which only tokenizes and starts fetches, and
+    //     stop right after.
+    HTMLTokenizer tokenizer { input };
+
+    // NB: We don't build a tree, but keep track of just enough of it to tell which start tags would create HTML
+    //     elements that fetch something.
+    size_t foreign_content_depth = 0;
+    size_t template_depth = 0;
+    size_t picture_depth = 0;
+
+    bool has_seen_base_element_with_href = document.first_base_element_with_href_in_tree_order() != nullptr;
+    Optional<URL::URL> base_url;
+
+    for (;;) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+
+        if (token->is_end_tag()) {
+            auto const& tag_name = token->tag_name();
+            if (foreign_content_depth > 0) {
+                if (tag_name.is_one_of(TagNames::svg, TagNames::math))
+                    --foreign_content_depth;
+            } else if (tag_name == TagNames::template_ && template_depth > 0) {
+                --template_depth;
+            } else if (tag_name == TagNames::picture && picture_depth > 0) {
+                --picture_depth;
+            }
+            continue;
+        }
+
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+
+        // Elements in SVG and MathML content neither fetch like HTML elements do, nor switch the tokenizer state.
+        if (foreign_content_depth > 0 || tag_name.is_one_of(TagNames::svg, TagNames::math)) {
+            if (tag_name.is_one_of(TagNames::svg, TagNames::math) && !token->is_self_closing())
+                ++foreign_content_depth;
+            continue;
+        }
+
+        // Switch the tokenizer state like the tree construction stage does after inserting these elements, so that
+        // their contents aren't mistaken for markup.
+        if (tag_name == TagNames::script)
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes, TagNames::noscript))
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name.is_one_of(TagNames::textarea, TagNames::title))
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+        else if (tag_name == TagNames::plaintext)
+            tokenizer.switch_to(HTMLTokenizer::State::PLAINTEXT);
+
+        // The contents of a template are inert, so nothing in them fetches anything.
+        if (tag_name == TagNames::template_) {
+            ++template_depth;
+            continue;
+        }
+        if (template_depth > 0)
+            continue;
+
+        if (tag_name == TagNames::picture) {
+            ++picture_depth;
+            continue;
+        }
+
+        // URLs that follow the document's first base element with an href attribute are resolved against it.
+        if (tag_name == TagNames::base) {
+            if (auto href = token->attribute(AttributeNames::href); href.has_value() && !has_seen_base_element_with_href) {
+                has_seen_base_element_with_href = true;
+                base_url = DOMURL::parse(*href, document.fallback_base_url(), document.encoding_or_default());
+            }
+            continue;
+        }
+
+        // An image in a picture element is fetched from whichever of its sources matches, which we can't tell yet.
+        if (tag_name == TagNames::img && picture_depth > 0)
+            continue;
+
+        if (auto candidate = candidate_for_start_tag(*token); candidate.has_value())
+            speculatively_fetch(document, *token, *candidate, base_url);
+    }
+}
+
+Optional<SpeculativeHTMLParser::Candidate> SpeculativeHTMLParser::candidate_for_start_tag(HTMLToken const& token)
+{
+    auto const& tag_name = token.tag_name();
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+
+    if (tag_name == TagNames::script) {
+        if (!token.has_attribute(AttributeNames::src))
+            return {};
+
+        // NB: This determines the script's type the same way as HTMLScriptElement::prepare_script().
+        auto type = token.attribute(AttributeNames::type);
+        auto language = token.attribute(AttributeNames::language);
+        String script_block_type;
+        if ((type.has_value() && type->is_empty()) || (!type.has_value() && (!language.has_value() || language->is_empty())))
+            script_block_type = "text/javascript"_string;
+        else if (type.has_value())
+            script_block_type = MUST(type->trim(Infra::ASCII_WHITESPACE));
+        else
+            script_block_type = MUST(String::formatted("text/{}", *language));
+
+        if (MimeSniff::is_javascript_mime_type_essence_match(script_block_type)) {
+            // Classic scripts with a nomodule attribute are never fetched.
+            if (token.has_attribute(AttributeNames::nomodule))
+                return {};
+            return Candidate { AttributeNames::src, Fetch::Infrastructure::Request::Destination::Script, cors_setting, true, false };
+        }
+
+        if (script_block_type.equals_ignoring_ascii_case("module"sv)) {
+            // Module scripts are always fetched in CORS mode, which a missing crossorigin attribute makes anonymous.
+            if (cors_setting == CORSSettingAttribute::NoCORS)
+                cors_setting = CORSSettingAttribute::Anonymous;
+            return Candidate { AttributeNames::src, Fetch::Infrastructure::Request::Destination::Script, cors_setting, true, false };
+        }
+
+        return {};
+    }
+
+    if (tag_name == TagNames::link) {
+        auto rel = token.attribute(AttributeNames::rel);
+        if (!rel.has_value())
+            return {};
+
+        bool is_stylesheet = false;
+        bool is_alternate = false;
+        bool is_preload = false;
+        auto lowercased_rel = rel->to_ascii_lowercase();
+        for (auto keyword : lowercased_rel.bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace)) {
+            if (keyword == "stylesheet"sv)
+                is_stylesheet = true;
+            else if (keyword == "alternate"sv)
+                is_alternate = true;
+            else if (keyword == "preload"sv)
+                is_preload = true;
+        }
+
+        // Alternative style sheets are only fetched once they're enabled.
+        if (is_stylesheet && !is_alternate)
+            return Candidate { AttributeNames::href, Fetch::Infrastructure::Request::Destination::Style, cors_setting, false, false };
+
+        if (is_preload) {
+            auto as = token.attribute(AttributeNames::as).value_or({});
+            Optional<Fetch::Infrastructure::Request::Destination> destination;
+            if (as.equals_ignoring_ascii_case("script"sv))
+                destination = Fetch::Infrastructure::Request::Destination::Script;
+            else if (as.equals_ignoring_ascii_case("style"sv))
+                destination = Fetch::Infrastructure::Request::Destination::Style;
+            else if (as.equals_ignoring_ascii_case("image"sv))
+                destination = Fetch::Infrastructure::Request::Destination::Image;
+            else if (as.equals_ignoring_ascii_case("font"sv))
+                destination = Fetch::Infrastructure::Request::Destination::Font;
+            else
+                return {};
+            return Candidate { AttributeNames::href, destination, cors_setting, false, true };
+        }
+
+        return {};
+    }
+
+    if (tag_name == TagNames::img) {
+        // An image with a srcset attribute is fetched from whichever source fits its layout, which we can't tell yet.
+        if (token.has_attribute(AttributeNames::srcset))
+            return {};
+        if (auto loading = token.attribute(AttributeNames::loading); loading.has_value() && loading->equals_ignoring_ascii_case("lazy"sv))
+            return {};
+        return Candidate { AttributeNames::src, Fetch::Infrastructure::Request::Destination::Image, cors_setting, false, false };
+    }
+
+    return {};
+}
+
+void SpeculativeHTMLParser::speculatively_fetch(DOM::Document& document, HTMLToken const& token, Candidate const& candidate, Optional<URL::URL> const& base_url)
+{
+    auto& realm = document.realm();
+    auto& vm = realm.vm();
+
+    auto href = token.attribute(candidate.url_attribute);
+    if (!href.has_value() || href->is_empty())
+        return;
+
+    auto url = base_url.has_value()
+        ? DOMURL::parse(*href, *base_url, document.encoding_or_default())
+        : document.encoding_parse_url(*href);
+    if (!url.has_value() || !Fetch::Infrastructure::is_http_or_https_scheme(url->scheme()))
+        return;
+
+    if (m_speculatively_fetched_urls.set(*url) != HashSetResult::InsertedNewEntry)
+        return;
+
+    auto request = create_potential_CORS_request(vm, *url, candidate.destination, candidate.cors_setting);
+    request->set_client(&document.relevant_settings_object());
+    request->set_policy_container(document.policy_container());
+    if (auto integrity = token.attribute(AttributeNames::integrity); integrity.has_value())
+        request->set_integrity_metadata(*integrity);
+    if (auto referrer_policy = token.attribute(AttributeNames::referrerpolicy); referrer_policy.has_value())
+        request->set_referrer_policy(ReferrerPolicy::from_string(*referrer_policy).value_or(ReferrerPolicy::ReferrerPolicy::EmptyString));
+    if (candidate.is_parser_inserted_script)
+        request->set_parser_metadata(Fetch::Infrastructure::Request::ParserMetadata::ParserInserted);
+
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+
+    if (candidate.is_preload_link || !url->origin().is_same_origin(document.origin())) {
+        // NB: Consuming the body makes sure all of it is read, and so stored in the HTTP cache.
+        fetch_algorithms_input.process_response_consume_body = [](auto, auto) { };
+        Fetch::Fetching::fetch(realm, *request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input)));
+        return;
+    }
+
+    // NB: The rest mirrors the preload steps of HTMLLinkElement::preload().
+    auto key = PreloadKey::create(*request);
+    auto& map_of_preloaded_resources = document.map_of_preloaded_resources();
+    if (map_of_preloaded_resources.contains(key))
+        return;
+
+    auto entry = realm.create<PreloadEntry>();
+    entry->integrity_metadata = request->integrity_metadata();
+
+    fetch_algorithms_input.process_response_consume_body = [&realm, entry](GC::Ref<Fetch::Infrastructure::Response> response, Fetch::Infrastructure::FetchAlgorithms::BodyBytes body_bytes) {
+        response = response->unsafe_response();
+
+        // 1. If bodyBytes is a byte sequence, then set response's body to bodyBytes as a body.
+        if (auto* byte_sequence = body_bytes.get_pointer<ByteBuffer>())
+            response->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, *byte_sequence));
+        // 2. Otherwise, set response to a network error.
+        else
+            response = Fetch::Infrastructure::Response::network_error(realm.vm(), "Expected speculative response to contain a body"_string);
+
+        // 5. If entry's on response available is null, then set entry's response to response; otherwise call entry's
+        //    on response available given response.
+        if (!entry->on_response_available)
+            entry->response = response;
+        else
+            entry->on_response_available->function()(response);
+    };
+
+    Fetch::Fetching::fetch(realm, *request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input)));
+    map_of_preloaded_resources.set(move(key), entry);
+}
+
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/HashTable.h>
+#include <AK/Span.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HTML/CORSSettingAttribute.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-html-parsing
+// While the HTML parser is blocked on a script, scans the input that follows it for scripts, style sheets, preloads
+// and images, and starts fetching them right away instead of once the parser gets to them.
+//
+// The scan only tokenizes the input and tracks the little tree construction state needed to tell which start tags
+// would create HTML elements that fetch. Fetches of same-origin resources are stored in the document's map of
+// preloaded resources, so that the element's own fetch consumes the response. Other resources are fetched to warm up
+// the HTTP cache only, as a preloaded cross-origin response would skip the response tainting of the element's fetch.
+class SpeculativeHTMLParser {
+public:
+    // https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+    void start(DOM::Document&, ReadonlySpan<u32> input);
+
+private:
+    struct Candidate {
+        FlyString url_attribute;
+        Optional<Fetch::Infrastructure::Request::Destination> destination;
+        CORSSettingAttribute cors_setting { CORSSettingAttribute::NoCORS };
+        bool is_parser_inserted_script { false };
+
+        // A <link rel=preload> fetches its resource itself once it's inserted, so it's only fetched ahead of time to
+        // warm up the HTTP cache.
+        bool is_preload_link { false };
+    };
+
+    static Optional<Candidate> candidate_for_start_tag(HTMLToken const&);
+    void speculatively_fetch(DOM::Document&, HTMLToken const&, Candidate const&, Optional<URL::URL> const& base_url);
+
+    HashTable<URL::URL> m_speculatively_fetched_urls;
+
+    // The input that was scanned the last time the parser was started. If the parser is started again without any
+    // input having been inserted since, the rest of the input has already been scanned.
+    ReadonlySpan<u32> m_scanned_input;
+};
+
+}
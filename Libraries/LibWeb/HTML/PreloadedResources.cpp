@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/HTML/PreloadedResources.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(PreloadEntry);
+GC_DEFINE_ALLOCATOR(PreloadedResources);
+
+// https://html.spec.whatwg.org/multipage/links.html#create-a-preload-key
+PreloadKey PreloadKey::create(Fetch::Infrastructure::Request const& request)
+{
+    // To create a preload key for a request request, return a new preload key whose URL is request's URL, destination
+    // is request's destination, mode is request's mode, and credentials mode is request's credentials mode.
+    return PreloadKey {
+        .url = request.url(),
+        .destination = request.destination(),
+        .mode = request.mode(),
+        .credentials_mode = request.credentials_mode(),
+    };
+}
+
+void PreloadEntry::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(response);
+    visitor.visit(on_response_available);
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#consume-a-preloaded-resource
+bool PreloadedResources::consume(URL::URL const& url, Optional<Fetch::Infrastructure::Request::Destination> destination, Fetch::Infrastructure::Request::Mode mode, Fetch::Infrastructure::Request::CredentialsMode credentials_mode, StringView integrity_metadata, GC::Ref<GC::Function<void(GC::Ref<Fetch::Infrastructure::Response>)>> on_response_available)
+{
+    // 1. Let key be a preload key whose URL is url, destination is destination, mode is mode, and credentials mode is
+    //    credentialsMode.
+    PreloadKey key { .url = url, .destination = destination, .mode = mode, .credentials_mode = credentials_mode };
+
+    // 2. Let preloads be window's associated Document's map of preloaded resources.
+    // 3. If key does not exist in preloads, then return false.
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return false;
+
+    // 4. Let entry be preloads[key].
+    auto entry = it->value;
+
+    // 5. Let consumerIntegrityMetadata be the result of parsing integrityMetadata.
+    // 6. Let preloadIntegrityMetadata be the result of parsing entry's integrity metadata.
+    // 7. If none of the following conditions apply:
+    //    - consumerIntegrityMetadata is no metadata;
+    //    - consumerIntegrityMetadata is equal to preloadIntegrityMetadata,
+    //    then return false.
+    // NB: Metadata that parses the same is compared as written, which at worst fetches the resource again.
+    if (!integrity_metadata.trim_whitespace().is_empty() && entry->integrity_metadata != integrity_metadata)
+        return false;
+
+    // 8. Remove preloads[key].
+    m_entries.remove(it);
+
+    // 9. If entry's response is null, then set entry's on response available to onResponseAvailable.
+    if (!entry->response) {
+        entry->on_response_available = GC::create_function(heap(), [on_response_available](GC::Ptr<Fetch::Infrastructure::Response> response) {
+            on_response_available->function()(*response);
+        });
+    }
+    // 10. Otherwise, call onResponseAvailable with entry's response.
+    else {
+        on_response_available->function()(*entry->response);
+    }
+
+    // 11. Return true.
+    return true;
+}
+
+void PreloadedResources::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (auto& it : m_entries)
+        visitor.visit(it.value);
+}
+
+}
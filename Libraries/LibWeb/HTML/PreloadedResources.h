@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <LibGC/Function.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/links.html#preload-key
+struct PreloadKey {
+    static PreloadKey create(Fetch::Infrastructure::Request const&);
+
+    bool operator==(PreloadKey const&) const = default;
+
+    // URL
+    //     A URL
+    URL::URL url;
+
+    // destination
+    //     A string
+    Optional<Fetch::Infrastructure::Request::Destination> destination;
+
+    // mode
+    //     A request mode, either "same-origin", "cors", or "no-cors"
+    Fetch::Infrastructure::Request::Mode mode;
+
+    // credentials mode
+    //     A credentials mode
+    Fetch::Infrastructure::Request::CredentialsMode credentials_mode;
+};
+
+// https://html.spec.whatwg.org/multipage/links.html#preload-entry
+struct PreloadEntry final : public JS::Cell {
+    GC_CELL(PreloadEntry, JS::Cell);
+    GC_DECLARE_ALLOCATOR(PreloadEntry);
+
+    virtual void visit_edges(Cell::Visitor& visitor) override;
+
+    // integrity metadata
+    //     A string
+    String integrity_metadata;
+
+    // response
+    //     Null or a response
+    GC::Ptr<Fetch::Infrastructure::Response> response;
+
+    // on response available
+    //     Null, or an algorithm accepting a response or null
+    GC::Ptr<GC::Function<void(GC::Ptr<Fetch::Infrastructure::Response>)>> on_response_available;
+};
+
+// https://html.spec.whatwg.org/multipage/links.html#map-of-preloaded-resources
+class PreloadedResources final : public JS::Cell {
+    GC_CELL(PreloadedResources, JS::Cell);
+    GC_DECLARE_ALLOCATOR(PreloadedResources);
+
+public:
+    bool contains(PreloadKey const& key) const { return m_entries.contains(key); }
+    void set(PreloadKey key, GC::Ref<PreloadEntry> entry) { m_entries.set(move(key), entry); }
+
+    // https://html.spec.whatwg.org/multipage/links.html#consume-a-preloaded-resource
+    bool consume(URL::URL const&, Optional<Fetch::Infrastructure::Request::Destination>, Fetch::Infrastructure::Request::Mode, Fetch::Infrastructure::Request::CredentialsMode, StringView integrity_metadata, GC::Ref<GC::Function<void(GC::Ref<Fetch::Infrastructure::Response>)>> on_response_available);
+
+private:
+    struct PreloadKeyTraits : public DefaultTraits<PreloadKey> {
+        static unsigned hash(PreloadKey const& key) { return Traits<URL::URL>::hash(key.url); }
+    };
+
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    HashMap<PreloadKey, GC::Ref<PreloadEntry>, PreloadKeyTraits> m_entries;
+};
+
+}
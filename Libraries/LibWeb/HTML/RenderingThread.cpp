@@ -15,16 +15,42 @@
 
 namespace Web::HTML {
 
+// The display list, scroll offsets and viewport that a backing store was last rendered with.
+struct PresentedFrame {
+    NonnullRefPtr<Painting::DisplayList> display_list;
+    Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot;
+    Gfx::IntRect viewport_rect;
+
+    bool has_scroll_state_and_viewport(Painting::DisplayList const& other_display_list, Painting::ScrollStateSnapshotByDisplayList const& other_scroll_state_snapshot, Gfx::IntRect other_viewport_rect) const
+    {
+        if (viewport_rect != other_viewport_rect || scroll_state_snapshot.size() != other_scroll_state_snapshot.size())
+            return false;
+        for (auto const& [list, snapshot] : other_scroll_state_snapshot) {
+            // NB: The scroll offsets of the frame's own display list are keyed by that list, not by the other one.
+            auto it = scroll_state_snapshot.find(list.ptr() == &other_display_list ? display_list : list);
+            if (it == scroll_state_snapshot.end() || it->value != snapshot)
+                return false;
+        }
+        return true;
+    }
+};
+
 struct BackingStoreState {
     RefPtr<Gfx::PaintingSurface> front_store;
     RefPtr<Gfx::PaintingSurface> back_store;
     i32 front_bitmap_id { -1 };
     i32 back_bitmap_id { -1 };
 
+    // NB: Frames of display lists with external content are never recorded, as that content may have changed since
+    //     the frame was rendered.
+    Optional<PresentedFrame> front_frame;
+    Optional<PresentedFrame> back_frame;
+
     void swap()
     {
         AK::swap(front_store, back_store);
         AK::swap(front_bitmap_id, back_bitmap_id);
+        AK::swap(front_frame, back_frame);
     }
 
     bool is_valid() const { return front_store && back_store; }
@@ -35,6 +61,11 @@ struct UpdateDisplayListCommand {
     Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot;
 };
 
+// Scroll offsets to render the current display list with from now on, without recording it again.
+struct UpdateScrollStateCommand {
+    Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot;
+};
+
 struct UpdateBackingStoresCommand {
     RefPtr<Gfx::PaintingSurface> front_store;
     RefPtr<Gfx::PaintingSurface> back_store;
@@ -47,7 +78,7 @@ struct ScreenshotCommand {
     Function<void()> callback;
 };
 
-using CompositorCommand = Variant<UpdateDisplayListCommand, UpdateBackingStoresCommand, ScreenshotCommand>;
+using CompositorCommand = Variant<UpdateDisplayListCommand, UpdateScrollStateCommand, UpdateBackingStoresCommand, ScreenshotCommand>;
 
 class RenderingThread::ThreadData final : public AtomicRefCounted<ThreadData> {
 public:
@@ -121,7 +152,14 @@ public:
                         m_cached_display_list = move(cmd.display_list);
                         m_cached_scroll_state_snapshot = move(cmd.scroll_state_snapshot);
                     },
+                    [this](UpdateScrollStateCommand& cmd) {
+                        // NB: The offsets are only meaningful for the display list they were taken for.
+                        if (m_cached_display_list && cmd.scroll_state_snapshot.contains(*m_cached_display_list))
+                            m_cached_scroll_state_snapshot = move(cmd.scroll_state_snapshot);
+                    },
                     [this](UpdateBackingStoresCommand& cmd) {
+                        m_backing_stores.front_frame.clear();
+                        m_backing_stores.back_frame.clear();
                         m_backing_stores.front_store = move(cmd.front_store);
                         m_backing_stores.back_store = move(cmd.back_store);
                         m_backing_stores.front_bitmap_id = cmd.front_bitmap_id;
@@ -130,7 +168,7 @@ public:
                     [this](ScreenshotCommand& cmd) {
                         if (!m_cached_display_list)
                             return;
-                        m_skia_player->execute(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *cmd.target_surface);
+                        m_skia_player->execute_in_parallel(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *cmd.target_surface);
                         if (cmd.callback) {
                             invoke_on_main_thread([callback = move(cmd.callback)]() mutable {
                                 callback();
@@ -168,10 +206,36 @@ public:
                 }
 
                 if (m_cached_display_list && m_backing_stores.is_valid()) {
-                    m_skia_player->execute(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *m_backing_stores.back_store);
+                    auto& display_list = *m_cached_display_list;
+
+                    // OPTIMIZATION: Repaints are often requested for changes that don't end up affecting what is
+                    //               painted. If the front store already holds this exact frame, the client is
+                    //               showing it, so there is no need to rasterize it again.
+                    if (auto const& front_frame = m_backing_stores.front_frame; front_frame.has_value() && front_frame->display_list.ptr() == &display_list
+                        && front_frame->has_scroll_state_and_viewport(display_list, m_cached_scroll_state_snapshot, viewport_rect))
+                        continue;
+
+                    // OPTIMIZATION: If the back store holds an earlier frame with the same scroll offsets, only the
+                    //               area in which the display lists differ has to be painted again.
+                    Optional<Gfx::IntRect> damage_rect;
+                    if (auto const& back_frame = m_backing_stores.back_frame; back_frame.has_value()
+                        && back_frame->has_scroll_state_and_viewport(display_list, m_cached_scroll_state_snapshot, viewport_rect)) {
+                        auto scroll_state_snapshot = m_cached_scroll_state_snapshot.get(display_list).value_or({});
+                        damage_rect = display_list.damage_rect_since(*back_frame->display_list, scroll_state_snapshot);
+                        if (damage_rect.has_value())
+                            damage_rect->intersect(m_backing_stores.back_store->rect());
+                    }
+
+                    if (!damage_rect.has_value() || !damage_rect->is_empty())
+                        m_skia_player->execute_in_parallel(display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *m_backing_stores.back_store, damage_rect);
                     i32 rendered_bitmap_id = m_backing_stores.back_bitmap_id;
                     m_backing_stores.swap();
 
+                    if (display_list.has_external_content())
+                        m_backing_stores.front_frame.clear();
+                    else
+                        m_backing_stores.front_frame = PresentedFrame { display_list, m_cached_scroll_state_snapshot, viewport_rect };
+
                     m_queued_rasterization_tasks++;
 
                     invoke_on_main_thread([this, viewport_rect, rendered_bitmap_id]() {
@@ -257,6 +321,11 @@ void RenderingThread::update_display_list(NonnullRefPtr<Painting::DisplayList> d
     m_thread_data->enqueue_command(UpdateDisplayListCommand { move(display_list), move(scroll_state_snapshot) });
 }
 
+void RenderingThread::update_scroll_state(Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot)
+{
+    m_thread_data->enqueue_command(UpdateScrollStateCommand { move(scroll_state_snapshot) });
+}
+
 void RenderingThread::update_backing_stores(RefPtr<Gfx::PaintingSurface> front, RefPtr<Gfx::PaintingSurface> back, i32 front_id, i32 back_id)
 {
     m_thread_data->enqueue_command(UpdateBackingStoresCommand { move(front), move(back), front_id, back_id });
@@ -32,6 +32,9 @@ public:
     void set_skia_player(OwnPtr<Painting::DisplayListPlayerSkia>&& player);
 
     void update_display_list(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshotByDisplayList&&);
+    // Replaces the scroll offsets of the current display list, which are keyed by the same display lists as the ones
+    // passed to update_display_list().
+    void update_scroll_state(Painting::ScrollStateSnapshotByDisplayList&&);
     void update_backing_stores(RefPtr<Gfx::PaintingSurface> front, RefPtr<Gfx::PaintingSurface> back, i32 front_id, i32 back_id);
     void present_frame(Gfx::IntRect);
     void request_screenshot(NonnullRefPtr<Gfx::PaintingSurface>, Function<void()>&& callback);
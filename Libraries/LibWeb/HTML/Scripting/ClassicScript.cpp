@@ -6,6 +6,7 @@
 
 #include <AK/Debug.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/Tracing.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
@@ -105,10 +106,38 @@ GC::Ref<ClassicScript> ClassicScript::create_from_pre_parsed(ByteString filename
     return script;
 }
 
+GC::Ptr<ClassicScript> ClassicScript::create_from_compilation_cache(ByteString filename, JS::SourceCode const& source_code, JS::Realm& realm, URL::URL base_url, MutedErrors muted_errors)
+{
+    auto& vm = realm.vm();
+
+    if (is_scripting_disabled(realm))
+        return nullptr;
+
+    if (muted_errors == MutedErrors::Yes)
+        base_url = URL::about_blank();
+
+    auto script = vm.heap().allocate<ClassicScript>(move(base_url), move(filename), realm);
+
+    script->m_muted_errors = muted_errors;
+    script->set_parse_error(JS::js_null());
+    script->set_error_to_rethrow(JS::js_null());
+
+    auto script_record = JS::Script::create_from_compilation_cache(source_code, realm, script);
+    if (!script_record)
+        return nullptr;
+    dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Reused cached compilation of {}", script->filename());
+
+    script->m_script_record = script_record;
+
+    return script;
+}
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#run-a-classic-script
 // https://whatpr.org/html/9893/webappapis.html#run-a-classic-script
 JS::Completion ClassicScript::run(RethrowErrors rethrow_errors, GC::Ptr<JS::Environment> lexical_environment_override)
 {
+    TRACE_EVENT("script", "ClassicScript::run");
+
     // 1. Let realm be the realm of script.
     auto& realm = this->realm();
 
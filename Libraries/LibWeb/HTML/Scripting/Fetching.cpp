@@ -82,6 +82,42 @@ static void parse_off_thread(NonnullRefPtr<JS::SourceCode const> source_code, JS
     });
 }
 
+// Like parse_off_thread(), but also decodes the response body and builds the SourceCode on the thread pool, so the
+// main thread does no per-byte work on the script between the body arriving and it being compiled.
+// NB: The SourceCode is created on the worker thread and handed over to the main thread together with the parse
+//     result. The worker never touches it again after that, and it holds no GC references.
+static void decode_and_parse_off_thread(ByteBuffer body_bytes, TextCodec::Decoder& fallback_decoder, String filename, JS::RustIntegration::ProgramType type, size_t line_number_offset, Function<void(JS::FFI::ParsedProgram*, NonnullRefPtr<JS::SourceCode const>)> on_parsed)
+{
+    auto* callback = new Function<void(JS::FFI::ParsedProgram*, NonnullRefPtr<JS::SourceCode const>)>(move(on_parsed));
+
+    auto event_loop_weak = Core::EventLoop::current_weak();
+
+    Threading::ThreadPool::the().submit([body_bytes = move(body_bytes), fallback_decoder = &fallback_decoder,
+                                            filename = move(filename), type, line_number_offset, callback,
+                                            event_loop_weak = move(event_loop_weak)]() mutable {
+        auto source_text = TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*fallback_decoder, body_bytes).release_value_but_fixme_should_propagate_errors();
+        body_bytes.clear();
+
+        auto source_code = JS::SourceCode::create(move(filename), Utf16String::from_utf8(source_text));
+        source_text = {};
+
+        auto* parsed = JS::RustIntegration::parse_program(source_code->utf16_data(), source_code->length_in_code_units(), type, line_number_offset);
+
+        auto origin = event_loop_weak->take();
+        if (!origin) {
+            if (parsed)
+                JS::RustIntegration::free_parsed_program(parsed);
+            return;
+        }
+        origin->deferred_invoke([parsed, source_code = move(source_code), callback]() mutable {
+            (*callback)(parsed, move(source_code));
+            delete callback;
+            // AD-HOC: See parse_off_thread().
+            perform_a_microtask_checkpoint();
+        });
+    });
+}
+
 GC_DEFINE_ALLOCATOR(FetchContext);
 
 OnFetchScriptComplete create_on_fetch_script_complete(GC::Heap& heap, Function<void(GC::Ptr<Script>)> function)
@@ -420,8 +456,6 @@ void fetch_classic_script(GC::Ref<HTMLScriptElement> element, URL::URL const& ur
         auto fallback_decoder = TextCodec::decoder_for(extracted_character_encoding);
         VERIFY(fallback_decoder.has_value());
 
-        auto source_text = TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*fallback_decoder, body_bytes.template get<ByteBuffer>()).release_value_but_fixme_should_propagate_errors();
-
         // 6. Let muted errors be true if response was CORS-cross-origin, and false otherwise.
         auto muted_errors = response->is_cors_cross_origin() ? ClassicScript::MutedErrors::Yes : ClassicScript::MutedErrors::No;
 
@@ -430,23 +464,32 @@ void fetch_classic_script(GC::Ref<HTMLScriptElement> element, URL::URL const& ur
         // FIXME: Pass options.
         auto response_url = response->url().value_or({});
 
-        // If the Rust pipeline is available, parse off the main thread.
+        // If the Rust pipeline is available, decode and parse off the main thread.
         if (JS::RustIntegration::rust_pipeline_available()) {
+            auto response_url_string = response_url.to_byte_string();
+            auto filename = String::from_utf8(response_url_string.view()).release_value_but_fixme_should_propagate_errors();
+
             auto on_complete_root = GC::make_root(on_complete);
             auto realm_root = GC::make_root(settings_object.realm());
-            auto response_url_string = response_url.to_byte_string();
-            auto source_code = JS::SourceCode::create(
-                String::from_utf8(response_url_string.view()).release_value_but_fixme_should_propagate_errors(),
-                Utf16String::from_utf8(source_text));
 
-            parse_off_thread(move(source_code), JS::RustIntegration::ProgramType::Script, 1,
+            decode_and_parse_off_thread(move(body_bytes.template get<ByteBuffer>()), *fallback_decoder, move(filename), JS::RustIntegration::ProgramType::Script, 1,
                 [response_url = move(response_url), response_url_string = move(response_url_string),
                     muted_errors, on_complete_root = move(on_complete_root),
                     realm_root = move(realm_root)](auto* parsed, auto source_code) mutable {
+                    // OPTIMIZATION: If the same script has been compiled before, reuse its bytecode instead of
+                    //               compiling the fresh parse result.
+                    if (auto script = ClassicScript::create_from_compilation_cache(response_url_string, *source_code, *realm_root, response_url, muted_errors)) {
+                        if (parsed)
+                            JS::RustIntegration::free_parsed_program(parsed);
+                        on_complete_root->function()(script);
+                        return;
+                    }
+
                     auto script = ClassicScript::create_from_pre_parsed(move(response_url_string), move(source_code), *realm_root, move(response_url), parsed, muted_errors);
                     on_complete_root->function()(script);
                 });
         } else {
+            auto source_text = TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*fallback_decoder, body_bytes.template get<ByteBuffer>()).release_value_but_fixme_should_propagate_errors();
             auto script = ClassicScript::create(response_url.to_byte_string(), source_text, settings_object.realm(), response_url, 1, muted_errors);
 
             // 8. Run onComplete given script.
@@ -517,6 +560,33 @@ WebIDL::ExceptionOr<void> fetch_classic_worker_script(URL::URL const& url, Envir
         // 5. Let script be the result of creating a classic script using sourceText, settingsObject's realm,
         //    response's URL, and the default classic script fetch options.
         auto response_url = response->url().value_or({});
+
+        // If the Rust pipeline is available, parse off the worker's main thread.
+        if (JS::RustIntegration::rust_pipeline_available()) {
+            auto response_url_string = response_url.to_byte_string();
+            auto source_code = JS::SourceCode::create(
+                String::from_utf8(response_url_string.view()).release_value_but_fixme_should_propagate_errors(),
+                Utf16String::from_utf8(source_text));
+
+            // OPTIMIZATION: If the same script has been compiled before, reuse its bytecode instead of parsing again.
+            if (auto script = ClassicScript::create_from_compilation_cache(response_url_string, *source_code, settings_object.realm(), response_url)) {
+                on_complete->function()(script);
+                return;
+            }
+
+            auto on_complete_root = GC::make_root(on_complete);
+            auto realm_root = GC::make_root(settings_object.realm());
+
+            parse_off_thread(move(source_code), JS::RustIntegration::ProgramType::Script, 1,
+                [response_url = move(response_url), response_url_string = move(response_url_string),
+                    on_complete_root = move(on_complete_root),
+                    realm_root = move(realm_root)](auto* parsed, auto source_code) mutable {
+                    auto script = ClassicScript::create_from_pre_parsed(move(response_url_string), move(source_code), *realm_root, move(response_url), parsed);
+                    on_complete_root->function()(script);
+                });
+            return;
+        }
+
         auto script = ClassicScript::create(response_url.to_byte_string(), source_text, settings_object.realm(), response_url);
 
         // 6. Run onComplete given script.
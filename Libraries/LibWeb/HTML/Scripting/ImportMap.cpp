@@ -85,7 +85,8 @@ WebIDL::ExceptionOr<ImportMap> parse_import_map_string(JS::Realm& realm, ByteStr
     }
 
     // 9. If parsed's keys contains any items besides "imports", "scopes", or "integrity", then the user agent should report a warning to the console indicating that an invalid top-level key was present in the import map.
-    for (auto& key : parsed_object.shape().property_table().keys()) {
+    for (auto& entry : parsed_object.shape().property_table()) {
+        auto const& key = entry.key;
         if (key.as_string().is_one_of("imports"sv, "scopes"sv, "integrity"sv))
             continue;
 
@@ -132,7 +133,8 @@ WebIDL::ExceptionOr<ModuleSpecifierMap> sort_and_normalise_module_specifier_map(
     ModuleSpecifierMap normalized;
 
     // 2. For each specifierKey → value of originalMap:
-    for (auto& specifier_key : original_map.shape().property_table().keys()) {
+    for (auto& entry : original_map.shape().property_table()) {
+        auto const& specifier_key = entry.key;
         auto value = TRY(original_map.get(specifier_key.as_string()));
 
         // 1. Let normalizedSpecifierKey be the result of normalizing a specifier key given specifierKey and baseURL.
@@ -200,7 +202,8 @@ WebIDL::ExceptionOr<HashMap<URL::URL, ModuleSpecifierMap>> sort_and_normalise_sc
     HashMap<URL::URL, ModuleSpecifierMap> normalized;
 
     // 2. For each scopePrefix → potentialSpecifierMap of originalMap:
-    for (auto& scope_prefix : original_map.shape().property_table().keys()) {
+    for (auto& entry : original_map.shape().property_table()) {
+        auto const& scope_prefix = entry.key;
         auto potential_specifier_map = TRY(original_map.get(scope_prefix.as_string()));
 
         // 1. If potentialSpecifierMap is not an ordered map, then throw a TypeError indicating that the value of the scope with prefix scopePrefix needs to be a JSON object.
@@ -237,7 +240,8 @@ WebIDL::ExceptionOr<ModuleIntegrityMap> normalize_module_integrity_map(JS::Realm
     ModuleIntegrityMap normalized;
 
     // 2. For each key → value of originalMap:
-    for (auto& key : original_map.shape().property_table().keys()) {
+    for (auto& entry : original_map.shape().property_table()) {
+        auto const& key = entry.key;
         auto value = TRY(original_map.get(key.as_string()));
 
         // 1. Let resolvedURL be the result of resolving a URL-like module specifier given key and baseURL.
@@ -6,6 +6,7 @@
 
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/SkiaBackendContext.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/Fetch/Fetching/Fetching.h>
@@ -48,9 +49,16 @@ SharedResourceRequest::SharedResourceRequest(GC::Ref<Page> page, URL::URL url, G
 
 SharedResourceRequest::~SharedResourceRequest() = default;
 
+static bool is_svg_image(URL::URL const& url, StringView mime_type)
+{
+    return mime_type == "image/svg+xml"sv || url.basename().ends_with(".svg"sv);
+}
+
 void SharedResourceRequest::finalize()
 {
     Base::finalize();
+    if (auto stream_id = exchange(m_decode_stream_id, {}); stream_id.has_value())
+        Web::Platform::ImageCodecPlugin::the().cancel_streaming_decode(*stream_id);
     auto& shared_resource_requests = m_document->shared_resource_requests();
     shared_resource_requests.remove(m_url);
 }
@@ -64,6 +72,7 @@ void SharedResourceRequest::visit_edges(JS::Cell::Visitor& visitor)
     for (auto& callback : m_callbacks) {
         visitor.visit(callback.on_finish);
         visitor.visit(callback.on_fail);
+        visitor.visit(callback.on_partial_image);
     }
     visitor.visit(m_image_data);
 }
@@ -83,8 +92,31 @@ void SharedResourceRequest::set_fetch_controller(GC::Ptr<Fetch::Infrastructure::
     m_fetch_controller = move(fetch_controller);
 }
 
+// NB: Until layout has determined whether an image is in the viewport, we go by the priority the page gave its fetch.
+static ImageDecoder::DecodePriority decode_priority_for(Fetch::Infrastructure::Request const& request)
+{
+    switch (request.priority()) {
+    case Fetch::Infrastructure::Request::Priority::High:
+        return ImageDecoder::DecodePriority::Visible;
+    case Fetch::Infrastructure::Request::Priority::Low:
+        return ImageDecoder::DecodePriority::Offscreen;
+    case Fetch::Infrastructure::Request::Priority::Auto:
+        return ImageDecoder::DecodePriority::Normal;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Images decoded to YUV planes are converted to RGB on the GPU when they are drawn, so we only ask for them when there
+// is a GPU to draw with.
+static bool may_decode_to_yuv()
+{
+    return Gfx::SkiaBackendContext::the() != nullptr;
+}
+
 void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infrastructure::Request> request)
 {
+    m_decode_priority = decode_priority_for(request);
+
     Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
     fetch_algorithms_input.process_response = [this, &realm, request](GC::Ref<Fetch::Infrastructure::Response> response) {
         // FIXME: If the response is CORS cross-origin, we must use its internal response to query any of its data. See:
@@ -106,6 +138,15 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
             return;
         }
 
+        // OPTIMIZATION: Raster images are decoded while they are being fetched, so that what has arrived of them can
+        //               be shown before the rest. Bodies which are already in memory are decoded in one go.
+        auto extracted_mime_type = Fetch::Infrastructure::extract_mime_type(response->header_list());
+        auto mime_type = extracted_mime_type.has_value() ? extracted_mime_type.value().essence().bytes_as_string_view() : StringView {};
+        if (!is_svg_image(request->url(), mime_type) && !response->body()->source().has<ByteBuffer>()) {
+            decode_body_while_fetching(realm, *response->body());
+            return;
+        }
+
         response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
     };
 
@@ -120,7 +161,19 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
     set_fetch_controller(fetch_controller);
 }
 
-void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
+void SharedResourceRequest::prioritize_because_visible()
+{
+    if (m_state != State::Fetching)
+        return;
+
+    // NB: A decode that has already begun, because the image is decoded while it is being fetched, keeps its priority.
+    m_decode_priority = ImageDecoder::DecodePriority::Visible;
+
+    if (m_fetch_controller)
+        m_fetch_controller->raise_priority(RequestServer::RequestPriority::High);
+}
+
+void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image)
 {
     if (m_state == State::Finished) {
         if (on_finish)
@@ -139,6 +192,8 @@ void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<v
         callbacks.on_finish = GC::create_function(vm().heap(), move(on_finish));
     if (on_fail)
         callbacks.on_fail = GC::create_function(vm().heap(), move(on_fail));
+    if (on_partial_image)
+        callbacks.on_partial_image = GC::create_function(vm().heap(), move(on_partial_image));
 
     m_callbacks.append(move(callbacks));
 }
@@ -148,9 +203,7 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
     // AD-HOC: At this point, things gets very ad-hoc.
     // FIXME: Bring this closer to spec.
 
-    bool const is_svg_image = mime_type == "image/svg+xml"sv || url_string.basename().ends_with(".svg"sv);
-
-    if (is_svg_image) {
+    if (is_svg_image(url_string, mime_type)) {
         auto result = SVG::SVGDecodedImageData::create(m_document->realm(), m_page, url_string, data);
         if (result.is_error()) {
             handle_failed_fetch();
@@ -162,45 +215,114 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
     }
 
     auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
-        if (result.session_id != 0) {
-            // Streaming animated decode: create AnimatedDecodedImageData.
-            Vector<NonnullRefPtr<Gfx::Bitmap>> initial_bitmaps;
-            initial_bitmaps.ensure_capacity(result.frames.size());
-            for (auto& frame : result.frames)
-                initial_bitmaps.unchecked_append(*frame.bitmap);
-
-            auto first_bitmap = result.frames.first().bitmap;
-            auto size = first_bitmap->size();
-
-            strong_this->m_image_data = AnimatedDecodedImageData::create(
-                strong_this->m_document->realm(),
-                result.session_id,
-                result.frame_count,
-                result.loop_count,
-                size,
-                result.color_space,
-                move(result.all_durations),
-                move(initial_bitmaps));
-        } else {
-            // Single-shot decode: create BitmapDecodedImageData as before.
-            Vector<BitmapDecodedImageData::Frame> frames;
-            for (auto& frame : result.frames) {
-                frames.append(BitmapDecodedImageData::Frame {
-                    .bitmap = Gfx::ImmutableBitmap::create(*frame.bitmap, result.color_space),
-                    .duration = static_cast<int>(frame.duration),
-                });
-            }
-            strong_this->m_image_data = BitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
-        }
-        strong_this->handle_successful_resource_load();
-        return {};
+        return strong_this->handle_decoded_image(result);
     };
 
     auto handle_failed_decode = [strong_this = GC::Root(*this)](Error&) -> void {
         strong_this->handle_failed_fetch();
     };
 
-    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode), m_decode_priority, may_decode_to_yuv());
+}
+
+void SharedResourceRequest::decode_body_while_fetching(JS::Realm& realm, Fetch::Infrastructure::Body& body)
+{
+    m_decode_stream_id = Web::Platform::ImageCodecPlugin::the().begin_streaming_decode(
+        [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) {
+            strong_this->handle_partial_image(result);
+        },
+        [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+            return strong_this->handle_decoded_image(result);
+        },
+        [strong_this = GC::Root(*this)](Error&) {
+            if (auto stream_id = exchange(strong_this->m_decode_stream_id, {}); stream_id.has_value())
+                Web::Platform::ImageCodecPlugin::the().cancel_streaming_decode(*stream_id);
+            strong_this->handle_failed_fetch();
+        },
+        m_decode_priority, may_decode_to_yuv());
+
+    if (!m_decode_stream_id.has_value())
+        return;
+
+    auto process_body_chunk = GC::create_function(heap(), [this](ByteBuffer chunk) {
+        if (m_decode_stream_id.has_value())
+            Web::Platform::ImageCodecPlugin::the().append_streaming_decode_data(*m_decode_stream_id, chunk);
+    });
+    auto process_end_of_body = GC::create_function(heap(), [this]() {
+        if (auto stream_id = exchange(m_decode_stream_id, {}); stream_id.has_value())
+            Web::Platform::ImageCodecPlugin::the().finish_streaming_decode(*stream_id);
+    });
+    auto process_body_error = GC::create_function(heap(), [this](JS::Value) {
+        if (auto stream_id = exchange(m_decode_stream_id, {}); stream_id.has_value()) {
+            Web::Platform::ImageCodecPlugin::the().cancel_streaming_decode(*stream_id);
+            handle_failed_fetch();
+        }
+    });
+
+    body.incrementally_read(process_body_chunk, process_end_of_body, process_body_error, GC::Ref { realm.global_object() });
+}
+
+void SharedResourceRequest::handle_partial_image(Web::Platform::DecodedImage& result)
+{
+    if (m_state != State::Fetching || result.frames.is_empty())
+        return;
+
+    Vector<BitmapDecodedImageData::Frame> frames;
+    frames.append(BitmapDecodedImageData::Frame {
+        .bitmap = Gfx::ImmutableBitmap::create(*result.frames.first().bitmap, result.color_space),
+    });
+
+    auto image_data = BitmapDecodedImageData::create(m_document->realm(), move(frames), 0, false);
+    if (image_data.is_error())
+        return;
+    m_image_data = image_data.release_value();
+
+    for (auto& callback : m_callbacks) {
+        if (callback.on_partial_image)
+            callback.on_partial_image->function()();
+    }
+}
+
+ErrorOr<void> SharedResourceRequest::handle_decoded_image(Web::Platform::DecodedImage& result)
+{
+    if (result.yuv_data) {
+        Vector<BitmapDecodedImageData::Frame> frames;
+        frames.append(BitmapDecodedImageData::Frame {
+            .bitmap = TRY(Gfx::ImmutableBitmap::create_from_yuv(result.yuv_data.release_nonnull())),
+        });
+        m_image_data = TRY(BitmapDecodedImageData::create(m_document->realm(), move(frames), 0, false));
+    } else if (result.session_id != 0) {
+        // Streaming animated decode: create AnimatedDecodedImageData.
+        Vector<NonnullRefPtr<Gfx::Bitmap>> initial_bitmaps;
+        initial_bitmaps.ensure_capacity(result.frames.size());
+        for (auto& frame : result.frames)
+            initial_bitmaps.unchecked_append(*frame.bitmap);
+
+        auto first_bitmap = result.frames.first().bitmap;
+        auto size = first_bitmap->size();
+
+        m_image_data = AnimatedDecodedImageData::create(
+            m_document->realm(),
+            result.session_id,
+            result.frame_count,
+            result.loop_count,
+            size,
+            result.color_space,
+            move(result.all_durations),
+            move(initial_bitmaps));
+    } else {
+        // Single-shot decode: create BitmapDecodedImageData as before.
+        Vector<BitmapDecodedImageData::Frame> frames;
+        for (auto& frame : result.frames) {
+            frames.append(BitmapDecodedImageData::Frame {
+                .bitmap = Gfx::ImmutableBitmap::create(*frame.bitmap, result.color_space),
+                .duration = static_cast<int>(frame.duration),
+            });
+        }
+        m_image_data = BitmapDecodedImageData::create(m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
+    }
+    handle_successful_resource_load();
+    return {};
 }
 
 void SharedResourceRequest::handle_failed_fetch()
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <ImageDecoder/DecodePriority.h>
 #include <LibGC/Function.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Heap/Cell.h>
@@ -35,11 +36,16 @@ public:
 
     void fetch_resource(JS::Realm&, GC::Ref<Fetch::Infrastructure::Request>);
 
-    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
+    // The partial image callback is called whenever more of the image has been decoded while it is being fetched, and
+    // image_data() holds what has been decoded so far.
+    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image = {});
 
     bool is_fetching() const;
     bool needs_fetching() const;
 
+    // Moves the fetch and decode of the image ahead of those of images which are not visible.
+    void prioritize_because_visible();
+
 private:
     explicit SharedResourceRequest(GC::Ref<Page>, URL::URL, GC::Ref<DOM::Document>);
 
@@ -47,6 +53,9 @@ private:
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
     void handle_successful_fetch(URL::URL const&, StringView mime_type, ByteBuffer data);
+    void decode_body_while_fetching(JS::Realm&, Fetch::Infrastructure::Body&);
+    void handle_partial_image(Platform::DecodedImage&);
+    ErrorOr<void> handle_decoded_image(Platform::DecodedImage&);
     void handle_failed_fetch();
     void handle_successful_resource_load();
 
@@ -64,6 +73,7 @@ private:
     struct Callbacks {
         GC::Ptr<GC::Function<void()>> on_finish;
         GC::Ptr<GC::Function<void()>> on_fail;
+        GC::Ptr<GC::Function<void()>> on_partial_image;
     };
     Vector<Callbacks> m_callbacks;
 
@@ -74,6 +84,9 @@ private:
     GC::Ptr<DOM::Document> m_document;
 
     Optional<DOM::DocumentLoadEventDelayer> m_load_event_delayer;
+
+    Optional<i64> m_decode_stream_id;
+    ImageDecoder::DecodePriority m_decode_priority { ImageDecoder::DecodePriority::Normal };
 };
 
 }
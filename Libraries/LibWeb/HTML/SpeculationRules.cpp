@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibJS/Console.h>
+#include <LibJS/Runtime/ConsoleObject.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/Scripting/ExceptionReporter.h>
+#include <LibWeb/HTML/SpeculationRules.h>
+#include <LibWeb/HTML/Window.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(SpeculationRulesParseResult);
+
+static void report_a_warning_to_the_console(JS::Realm& realm, StringView message)
+{
+    auto& console = realm.intrinsics().console_object()->console();
+    console.output_debug_message(JS::Console::LogLevel::Warn, message);
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#parse-a-speculation-rule
+static Optional<SpeculationRule> parse_a_speculation_rule(JS::Realm& realm, JsonValue const& input, DOM::Document& document, URL::URL base_url)
+{
+    // 1. If input is not a map:
+    if (!input.is_object()) {
+        // 1. The user agent may report a warning to the console indicating that the rule needs to be a JSON object.
+        report_a_warning_to_the_console(realm, "Speculation rules need to be JSON objects"sv);
+
+        // 2. Return null.
+        return {};
+    }
+    auto const& input_object = input.as_object();
+
+    // 2. If input has any key other than "source", "urls", "where", "relative_to", "eagerness", "referrer_policy",
+    //    "tag", "requires", "expects_no_vary_search", or "target_hint":
+    bool has_unknown_key = false;
+    input_object.for_each_member([&](auto const& key, auto const&) {
+        if (!key.is_one_of("source"sv, "urls"sv, "where"sv, "relative_to"sv, "eagerness"sv, "referrer_policy"sv, "tag"sv, "requires"sv, "expects_no_vary_search"sv, "target_hint"sv))
+            has_unknown_key = true;
+    });
+    if (has_unknown_key) {
+        // 1. The user agent may report a warning to the console indicating that the rule has unrecognized keys.
+        report_a_warning_to_the_console(realm, "Speculation rule has unrecognized keys"sv);
+
+        // 2. Return null.
+        return {};
+    }
+
+    // FIXME: 3. If input["target_hint"] exists, then: ...
+
+    // 4. Let source be null.
+    Optional<String> source;
+
+    // 5. If input["source"] exists, then set source to input["source"].
+    if (auto const& raw_source = input_object.get("source"sv); raw_source.has_value()) {
+        if (raw_source->is_string())
+            source = raw_source->as_string();
+    }
+    // 6. Otherwise, if input["urls"] exists and input["where"] does not exist, then set source to "list".
+    else if (input_object.has("urls"sv) && !input_object.has("where"sv)) {
+        source = "list"_string;
+    }
+    // 7. Otherwise, if input["where"] exists and input["urls"] does not exist, then set source to "document".
+    else if (input_object.has("where"sv) && !input_object.has("urls"sv)) {
+        source = "document"_string;
+    }
+
+    // FIXME: Support document rules, which speculatively load the links of the document that match their predicate.
+    if (source == "document"sv) {
+        report_a_warning_to_the_console(realm, "Speculation rules with a \"document\" source are not supported"sv);
+        return {};
+    }
+
+    // 8. If source is neither "list" nor "document":
+    if (source != "list"sv) {
+        // 1. The user agent may report a warning to the console indicating that a source could not be inferred or an
+        //    invalid source was specified.
+        report_a_warning_to_the_console(realm, "Speculation rule has no valid source"sv);
+
+        // 2. Return null.
+        return {};
+    }
+
+    // 9. Let urls be an empty list.
+    SpeculationRule rule;
+
+    // 11. If source is "list", then:
+    {
+        // 1. If input["where"] exists, then:
+        if (input_object.has("where"sv)) {
+            // 1. The user agent may report a warning to the console indicating that there were conflicting sources for
+            //    this rule.
+            report_a_warning_to_the_console(realm, "Speculation rule with a \"list\" source has a \"where\" key"sv);
+
+            // 2. Return null.
+            return {};
+        }
+
+        // 2. If input["relative_to"] exists, then:
+        if (auto const& relative_to = input_object.get("relative_to"sv); relative_to.has_value()) {
+            // 1. If input["relative_to"] is neither "ruleset" nor "document", then:
+            if (!relative_to->is_string() || !relative_to->as_string().is_one_of("ruleset"sv, "document"sv)) {
+                // 1. The user agent may report a warning to the console indicating that the supplied relative-to value
+                //    was invalid.
+                report_a_warning_to_the_console(realm, "Speculation rule has an invalid \"relative_to\" value"sv);
+
+                // 2. Return null.
+                return {};
+            }
+
+            // 2. If input["relative_to"] is "document", then set baseURL to document's document base URL.
+            if (relative_to->as_string() == "document"sv)
+                base_url = document.base_url();
+        }
+
+        // 3. If input["urls"] does not exist or is not a list, then:
+        auto const& raw_urls = input_object.get_array("urls"sv);
+        if (!raw_urls.has_value()) {
+            // 1. The user agent may report a warning to the console indicating that the supplied URL list was invalid.
+            report_a_warning_to_the_console(realm, "Speculation rule has an invalid URL list"sv);
+
+            // 2. Return null.
+            return {};
+        }
+
+        // 4. For each urlString of input["urls"]:
+        for (auto const& url_string : raw_urls->values()) {
+            // 1. If urlString is not a string, then:
+            if (!url_string.is_string()) {
+                // 1. The user agent may report a warning to the console indicating that the supplied URL must be a
+                //    string.
+                report_a_warning_to_the_console(realm, "Speculation rule URLs need to be strings"sv);
+
+                // 2. Return null.
+                return {};
+            }
+
+            // 2. Let parsedURL be the result of URL parsing urlString with baseURL.
+            auto parsed_url = DOMURL::parse(url_string.as_string(), base_url);
+
+            // 3. If parsedURL is failure, or parsedURL's scheme is not an HTTP(S) scheme, then:
+            if (!parsed_url.has_value() || !parsed_url->scheme().is_one_of("http"sv, "https"sv)) {
+                // 1. The user agent may report a warning to the console indicating that the supplied URL string was
+                //    unparseable.
+                report_a_warning_to_the_console(realm, "Speculation rule URL could not be parsed as an HTTP(S) URL"sv);
+
+                // 2. Continue.
+                continue;
+            }
+
+            // 4. Append parsedURL to urls.
+            rule.urls.append(parsed_url.release_value());
+        }
+    }
+
+    // 13. If input["eagerness"] exists, then:
+    if (auto const& eagerness = input_object.get("eagerness"sv); eagerness.has_value()) {
+        // 1. If input["eagerness"] is not a speculation rule eagerness, then:
+        if (!eagerness->is_string() || !eagerness->as_string().is_one_of("immediate"sv, "eager"sv, "moderate"sv, "conservative"sv)) {
+            // 1. The user agent may report a warning to the console indicating that the supplied eagerness was invalid.
+            report_a_warning_to_the_console(realm, "Speculation rule has an invalid eagerness"sv);
+
+            // 2. Return null.
+            return {};
+        }
+
+        // FIXME: 2. Set eagerness to input["eagerness"].
+    }
+
+    // 15. If input["referrer_policy"] exists, then:
+    if (auto const& raw_referrer_policy = input_object.get("referrer_policy"sv); raw_referrer_policy.has_value()) {
+        // 1. If input["referrer_policy"] is not a referrer policy, then:
+        Optional<ReferrerPolicy::ReferrerPolicy> referrer_policy;
+        if (raw_referrer_policy->is_string())
+            referrer_policy = ReferrerPolicy::from_string(raw_referrer_policy->as_string());
+        if (!referrer_policy.has_value()) {
+            // 1. The user agent may report a warning to the console indicating that the supplied referrer policy was
+            //    invalid.
+            report_a_warning_to_the_console(realm, "Speculation rule has an invalid referrer policy"sv);
+
+            // 2. Return null.
+            return {};
+        }
+
+        // 2. Set referrerPolicy to input["referrer_policy"].
+        rule.referrer_policy = referrer_policy.release_value();
+    }
+
+    // FIXME: 16-23. Parse the tags, requirements and No-Vary-Search hint of the rule.
+
+    // 24. Return a speculation rule with URLs urls, predicate predicate, eagerness eagerness, referrer policy
+    //     referrerPolicy, tags tags, requirements requirements, and No-Vary-Search hint noVarySearchHint.
+    return rule;
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#parse-a-speculation-rule-set-string
+WebIDL::ExceptionOr<SpeculationRuleSet> parse_a_speculation_rule_set_string(JS::Realm& realm, StringView input, DOM::Document& document, URL::URL const& base_url)
+{
+    // 1. Let parsed be the result of parsing a JSON string to an Infra value given input.
+    auto parsed = JsonValue::from_string(input);
+    if (parsed.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::SyntaxError, "Speculation rules need to be valid JSON"_string };
+
+    // 2. If parsed is not a map, then throw a TypeError indicating that the top-level value needs to be a JSON object.
+    if (!parsed.value().is_object())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The top-level value of speculation rules needs to be a JSON object."_string };
+    auto const& parsed_object = parsed.value().as_object();
+
+    // 3. Let result be a new speculation rule set.
+    SpeculationRuleSet result;
+
+    // FIXME: 4. Let tag be null.
+    // FIXME: 5. If parsed["tag"] exists, then: ...
+
+    // 6. Let typesToTreatAsPrefetch be « "prefetch" ».
+    // 7. The user agent may append "prerender" to typesToTreatAsPrefetch.
+    // NB: We do, as we don't support prerendering.
+    for (auto type : { "prefetch"sv, "prerender"sv }) {
+        // 8. For each type of typesToTreatAsPrefetch:
+        //     1. If parsed[type] exists:
+        auto const& raw_rules = parsed_object.get(type);
+        if (!raw_rules.has_value())
+            continue;
+
+        // 1. If parsed[type] is a list, then for each rawRule of parsed[type]:
+        if (raw_rules->is_array()) {
+            for (auto const& raw_rule : raw_rules->as_array().values()) {
+                // 1. Let rule be the result of parsing a speculation rule given rawRule, tag, document, and baseURL.
+                auto rule = parse_a_speculation_rule(realm, raw_rule, document, base_url);
+
+                // 2. If rule is null, then continue.
+                if (!rule.has_value())
+                    continue;
+
+                // 3. Append rule to result's prefetch rules.
+                result.prefetch_rules.append(rule.release_value());
+            }
+        }
+        // 2. Otherwise, the user agent may report a warning to the console indicating that the rules list for type
+        //    needs to be a JSON array.
+        else {
+            report_a_warning_to_the_console(realm, MUST(String::formatted("The \"{}\" rules of speculation rules need to be a JSON array", type)));
+        }
+    }
+
+    // 9. Return result.
+    return result;
+}
+
+SpeculationRulesParseResult::SpeculationRulesParseResult() = default;
+
+SpeculationRulesParseResult::~SpeculationRulesParseResult() = default;
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#create-a-speculation-rules-parse-result
+GC::Ref<SpeculationRulesParseResult> SpeculationRulesParseResult::create(JS::Realm& realm, StringView input, DOM::Document& document)
+{
+    // 1. Let result be a speculation rules parse result whose rule set is null and whose error to rethrow is null.
+    auto result = realm.create<SpeculationRulesParseResult>();
+
+    // 2. Parse a speculation rule set string given input, document, and document's document base URL, catching any
+    //    exceptions.
+    auto rule_set = parse_a_speculation_rule_set_string(realm, input, document, document.base_url());
+
+    // 2.1. If this threw an exception, then set result's error to rethrow to that exception.
+    if (rule_set.is_exception())
+        result->m_error_to_rethrow = rule_set.exception();
+
+    // 2.2. Otherwise, set result's rule set to the return value.
+    else
+        result->m_rule_set = rule_set.release_value();
+
+    // 3. Return result.
+    return result;
+}
+
+void SpeculationRulesParseResult::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    if (m_error_to_rethrow.has_value()) {
+        m_error_to_rethrow.value().visit(
+            [&](WebIDL::SimpleException const&) {
+                // ignore
+            },
+            [&](GC::Ref<WebIDL::DOMException> exception) {
+                visitor.visit(exception);
+            },
+            [&](JS::Completion const& completion) {
+                visitor.visit(completion.value());
+            });
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#register-speculation-rules
+void SpeculationRulesParseResult::register_speculation_rules(Window& global)
+{
+    // 1. If result's error to rethrow is not null, then report an exception given by result's error to rethrow for
+    //    global and return.
+    if (m_error_to_rethrow.has_value()) {
+        auto completion = Web::Bindings::exception_to_throw_completion(global.vm(), m_error_to_rethrow.value());
+        HTML::report_exception(completion, global.realm());
+        return;
+    }
+
+    // 2. Append result's rule set to global's associated Document's speculation rule sets.
+    VERIFY(m_rule_set.has_value());
+    auto& document = global.associated_document();
+    document.speculation_rule_sets().append(m_rule_set.release_value());
+
+    // 3. Consider speculative loads for global's associated Document.
+    consider_speculative_loads(document);
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#consider-speculative-loads
+void consider_speculative_loads(DOM::Document& document)
+{
+    // NB: This is a much simplified version of the spec's algorithm. As we don't support eagerness or document rules, we
+    //     prefetch the URLs of every rule right away. The prefetched responses end up in the HTTP cache, from where the
+    //     navigation to them is served, rather than in the document's prefetch records.
+    if (!document.is_fully_active())
+        return;
+
+    auto& realm = document.realm();
+
+    for (auto const& rule_set : document.speculation_rule_sets()) {
+        for (auto const& rule : rule_set.prefetch_rules) {
+            for (auto const& url : rule.urls) {
+                // NB: Cross-origin prefetches must not reveal the user's identity to the other origin, which requires
+                //     an anonymous client IP and not sending credentials. We don't support that yet.
+                if (!url.origin().is_same_origin(document.origin()))
+                    continue;
+
+                // NB: Navigations ignore fragments when deciding what to fetch, so neither do we.
+                auto url_without_fragment = url;
+                url_without_fragment.set_fragment({});
+                if (url_without_fragment.equals(document.url(), URL::ExcludeFragment::Yes))
+                    continue;
+                if (document.speculatively_prefetched_urls().set(url_without_fragment) != HashSetResult::InsertedNewEntry)
+                    continue;
+
+                auto request = create_potential_CORS_request(realm.vm(), url_without_fragment, Fetch::Infrastructure::Request::Destination::Document, CORSSettingAttribute::NoCORS);
+                request->set_client(&document.relevant_settings_object());
+                request->set_initiator(Fetch::Infrastructure::Request::Initiator::Prefetch);
+                request->set_referrer_policy(rule.referrer_policy);
+                request->set_priority(Fetch::Infrastructure::Request::Priority::Low);
+
+                Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+                fetch_algorithms_input.process_response_consume_body = [](auto, auto) { };
+                Fetch::Fetching::fetch(realm, *request, Fetch::Infrastructure::FetchAlgorithms::create(realm.vm(), move(fetch_algorithms_input)));
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Vector.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/ReferrerPolicy/ReferrerPolicy.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rule
+struct SpeculationRule {
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-urls
+    Vector<URL::URL> urls;
+
+    // FIXME: predicate, eagerness, tags, requirements and No-Vary-Search hint.
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-referrer-policy
+    ReferrerPolicy::ReferrerPolicy referrer_policy { ReferrerPolicy::ReferrerPolicy::EmptyString };
+};
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rule-set
+struct SpeculationRuleSet {
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-set-prefetch
+    Vector<SpeculationRule> prefetch_rules;
+
+    // NB: We don't support prerendering, and treat prerender rules as prefetch rules, as the spec allows.
+};
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#parse-a-speculation-rule-set-string
+WebIDL::ExceptionOr<SpeculationRuleSet> parse_a_speculation_rule_set_string(JS::Realm&, StringView input, DOM::Document&, URL::URL const& base_url);
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rules-parse-result
+class SpeculationRulesParseResult : public JS::Cell {
+    GC_CELL(SpeculationRulesParseResult, JS::Cell);
+    GC_DECLARE_ALLOCATOR(SpeculationRulesParseResult);
+
+public:
+    virtual ~SpeculationRulesParseResult() override;
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#create-a-speculation-rules-parse-result
+    static GC::Ref<SpeculationRulesParseResult> create(JS::Realm&, StringView input, DOM::Document&);
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#register-speculation-rules
+    void register_speculation_rules(Window& global);
+
+private:
+    SpeculationRulesParseResult();
+
+    virtual void visit_edges(Visitor&) override;
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-pr-rule-set
+    Optional<SpeculationRuleSet> m_rule_set;
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-pr-error-to-rethrow
+    Optional<WebIDL::Exception> m_error_to_rethrow;
+};
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#consider-speculative-loads
+void consider_speculative_loads(DOM::Document&);
+
+}
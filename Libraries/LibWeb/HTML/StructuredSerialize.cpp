@@ -9,6 +9,7 @@
 
 #include <AK/StdLibExtras.h>
 #include <AK/String.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibIPC/File.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
@@ -58,6 +59,7 @@
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/HTML/ImageData.h>
 #include <LibWeb/HTML/MessagePort.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/Streams/ReadableStream.h>
@@ -1047,7 +1049,7 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
-                data_holder.encode(array_buffer->buffer());
+                data_holder.encode_transferred_buffer(array_buffer->buffer());
 
                 // 4. Set dataHolder.[[ArrayBufferMaxByteLength]] to transferable.[[ArrayBufferMaxByteLength]].
                 data_holder.encode(array_buffer->max_byte_length());
@@ -1059,7 +1061,7 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
-                data_holder.encode(array_buffer->buffer());
+                data_holder.encode_transferred_buffer(array_buffer->buffer());
             }
 
             // 3. Perform ? DetachArrayBuffer(transferable).
@@ -1106,6 +1108,8 @@ static bool is_transferable_interface_exposed_on_target_realm(TransferType name,
         return is_exposed(Bindings::InterfaceName::TransformStream, realm);
     case TransferType::ImageBitmap:
         return is_exposed(Bindings::InterfaceName::ImageBitmap, realm);
+    case TransferType::OffscreenCanvas:
+        return is_exposed(Bindings::InterfaceName::OffscreenCanvas, realm);
     case TransferType::Unknown:
         dbgln("Unknown interface type for transfer: {}", to_underlying(name));
         break;
@@ -1143,6 +1147,11 @@ static WebIDL::ExceptionOr<GC::Ref<Bindings::PlatformObject>> create_transferred
         TRY(image_bitmap->transfer_receiving_steps(decoder));
         return image_bitmap;
     }
+    case TransferType::OffscreenCanvas: {
+        auto offscreen_canvas = OffscreenCanvas::create(target_realm, 0, 0);
+        TRY(offscreen_canvas->transfer_receiving_steps(decoder));
+        return offscreen_canvas;
+    }
     case TransferType::ArrayBuffer:
     case TransferType::ResizableArrayBuffer:
     case TransferType::Unknown:
@@ -1203,7 +1212,7 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(Tra
     //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
     //       when both the source and target realms are in the same process.
     if (type == TransferType::ArrayBuffer) {
-        auto buffer = TRY(decoder.decode_buffer(target_realm));
+        auto buffer = TRY(decoder.decode_transferred_buffer(target_realm));
         value = JS::ArrayBuffer::create(target_realm, move(buffer));
     }
 
@@ -1213,7 +1222,7 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(Tra
     //     [[ArrayBufferMaxByteLength]] internal slot value is transferDataHolder.[[ArrayBufferMaxByteLength]].
     // NOTE: For the same reason as the previous step, this step is also unlikely to throw an exception.
     else if (type == TransferType::ResizableArrayBuffer) {
-        auto buffer = TRY(decoder.decode_buffer(target_realm));
+        auto buffer = TRY(decoder.decode_transferred_buffer(target_realm));
         auto max_byte_length = decoder.decode<size_t>();
 
         auto data = JS::ArrayBuffer::create(target_realm, move(buffer));
@@ -1304,6 +1313,27 @@ IPC::MessageBuffer TransferDataEncoder::take_buffer() const
     return move(m_buffer);
 }
 
+// Below this size, the cost of creating and mapping a shared memory region outweighs copying the bytes through the
+// transport.
+static constexpr size_t minimum_size_for_shared_memory_transfer = 64 * KiB;
+
+void TransferDataEncoder::encode_transferred_buffer(ByteBuffer const& buffer)
+{
+    VERIFY(!m_buffer_has_been_taken);
+
+    if (buffer.size() >= minimum_size_for_shared_memory_transfer) {
+        if (auto shared_buffer = Core::AnonymousBuffer::create_with_size(buffer.size()); !shared_buffer.is_error()) {
+            buffer.bytes().copy_to(Bytes { shared_buffer.value().data<u8>(), buffer.size() });
+            encode(true);
+            encode(shared_buffer.value());
+            return;
+        }
+    }
+
+    encode(false);
+    encode(buffer);
+}
+
 void TransferDataEncoder::append(SerializationRecord&& record)
 {
     VERIFY(!m_buffer_has_been_taken);
@@ -1343,6 +1373,22 @@ WebIDL::ExceptionOr<ByteBuffer> TransferDataDecoder::decode_buffer(JS::Realm& re
     return buffer.release_value();
 }
 
+WebIDL::ExceptionOr<ByteBuffer> TransferDataDecoder::decode_transferred_buffer(JS::Realm& realm)
+{
+    auto is_in_shared_memory = decode<bool>();
+    if (!is_in_shared_memory)
+        return decode_buffer(realm);
+
+    auto shared_buffer = decode<Core::AnonymousBuffer>();
+
+    auto buffer = ByteBuffer::create_uninitialized(shared_buffer.size());
+    if (buffer.is_error())
+        return WebIDL::DataCloneError::create(realm, "Unable to allocate memory for transferred buffer"_utf16);
+
+    shared_buffer.bytes().copy_to(buffer.value().bytes());
+    return buffer.release_value();
+}
+
 }
 
 namespace IPC {
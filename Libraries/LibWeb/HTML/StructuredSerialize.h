@@ -34,6 +34,10 @@ public:
         MUST(m_encoder.encode(value));
     }
 
+    // Encodes the contents of a transferred ArrayBuffer. Large buffers are placed in shared memory and sent as an
+    // attachment, instead of being copied into the message data.
+    void encode_transferred_buffer(ByteBuffer const&);
+
     void append(SerializationRecord&&);
     void extend(Vector<TransferDataEncoder>);
 
@@ -59,6 +63,7 @@ public:
     }
 
     WebIDL::ExceptionOr<ByteBuffer> decode_buffer(JS::Realm&);
+    WebIDL::ExceptionOr<ByteBuffer> decode_transferred_buffer(JS::Realm&);
 
 private:
     IPC::MessageBuffer m_buffer;
@@ -27,6 +27,7 @@ enum class TransferType : u8 {
     WritableStream = 5,
     TransformStream = 6,
     ImageBitmap = 7,
+    OffscreenCanvas = 8,
 };
 
 }
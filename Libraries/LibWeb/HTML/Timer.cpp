@@ -6,6 +6,7 @@
 
 #include <LibCore/Timer.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/Timer.h>
 #include <LibWeb/HTML/Window.h>
 
@@ -13,6 +14,10 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(Timer);
 
+// Timers of hidden documents are aligned to this boundary, so that they fire in batches rather than each waking up the
+// process on their own. It is a power of two, so that the event loop's own coalescing of timers preserves it.
+static constexpr i64 HIDDEN_DOCUMENT_TIMER_ALIGNMENT_MS = 1024;
+
 GC::Ref<Timer> Timer::create(JS::Object& window_or_worker_global_scope, i32 milliseconds, Function<void()> callback, i32 id, Repeating repeating)
 {
     return window_or_worker_global_scope.heap().allocate<Timer>(window_or_worker_global_scope, milliseconds, move(callback), id, repeating);
@@ -20,19 +25,19 @@ GC::Ref<Timer> Timer::create(JS::Object& window_or_worker_global_scope, i32 mill
 
 Timer::Timer(JS::Object& window_or_worker_global_scope, i32 milliseconds, Function<void()> callback, i32 id, Repeating repeating)
     : m_window_or_worker_global_scope(window_or_worker_global_scope)
+    , m_callback(move(callback))
+    , m_interval(milliseconds)
     , m_id(id)
+    , m_repeating(repeating)
 {
-    if (repeating == Repeating::Yes)
-        m_timer = Core::Timer::create_repeating(milliseconds, move(callback));
-    else
-        m_timer = Core::Timer::create_single_shot(milliseconds, move(callback));
+    m_timer = Core::Timer::create_single_shot(milliseconds, [this] { fire(); });
 }
 
 void Timer::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_window_or_worker_global_scope);
-    visitor.visit_possible_values(m_timer->on_timeout.raw_capture_range());
+    visitor.visit_possible_values(m_callback.raw_capture_range());
 }
 
 void Timer::finalize()
@@ -43,7 +48,10 @@ void Timer::finalize()
 
 void Timer::start()
 {
-    m_timer->start();
+    // NB: Repeating timers of hidden documents are started anew every time they fire, so that they stay aligned.
+    auto is_throttled = this->is_throttled();
+    m_timer->set_single_shot(m_repeating == Repeating::No || is_throttled);
+    m_timer->start(is_throttled ? throttled_interval() : m_interval);
 }
 
 void Timer::stop()
@@ -51,15 +59,61 @@ void Timer::stop()
     m_timer->stop();
 }
 
+// NB: Only timers that had yet to fire are restarted on resumption. The others already queued their task, which runs
+//     once the document is fully active again.
+void Timer::suspend()
+{
+    if (!m_timer->is_active())
+        return;
+    m_timer->stop();
+    m_is_suspended = true;
+}
+
+void Timer::resume()
+{
+    if (!exchange(m_is_suspended, false))
+        return;
+    start();
+}
+
+void Timer::fire()
+{
+    // The document may have been hidden or shown since the timer was started, so repeating timers reconsider whether
+    // they should be throttled every time they fire.
+    if (m_repeating == Repeating::Yes && (m_timer->is_single_shot() || is_throttled())) {
+        m_timer->stop();
+        start();
+    }
+
+    m_callback();
+}
+
+bool Timer::is_throttled() const
+{
+    auto const* window = as_if<Window>(*m_window_or_worker_global_scope);
+    return window && window->associated_document().visibility_state_value() == VisibilityState::Hidden;
+}
+
+i32 Timer::throttled_interval() const
+{
+    auto now = MonotonicTime::now_coarse().milliseconds();
+    auto aligned_fire_time = ceil_div(now + m_interval, HIDDEN_DOCUMENT_TIMER_ALIGNMENT_MS) * HIDDEN_DOCUMENT_TIMER_ALIGNMENT_MS;
+    return static_cast<i32>(min<i64>(aligned_fire_time - now, NumericLimits<i32>::max()));
+}
+
 void Timer::set_callback(Function<void()> callback)
 {
-    m_timer->on_timeout = move(callback);
+    m_callback = move(callback);
 }
 
 void Timer::set_interval(i32 milliseconds)
 {
-    if (m_timer->interval() != milliseconds)
-        m_timer->restart(milliseconds);
+    if (m_interval == milliseconds)
+        return;
+
+    m_interval = milliseconds;
+    m_timer->stop();
+    start();
 }
 
 }
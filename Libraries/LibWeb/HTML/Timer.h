@@ -34,6 +34,9 @@ public:
     void start();
     void stop();
 
+    void suspend();
+    void resume();
+
     void set_callback(Function<void()>);
     void set_interval(i32 milliseconds);
 
@@ -43,9 +46,18 @@ private:
     virtual void visit_edges(Cell::Visitor&) override;
     virtual void finalize() override;
 
+    void fire();
+
+    bool is_throttled() const;
+    i32 throttled_interval() const;
+
     RefPtr<Core::Timer> m_timer;
     GC::Ref<JS::Object> m_window_or_worker_global_scope;
+    Function<void()> m_callback;
+    i32 m_interval { 0 };
     i32 m_id { 0 };
+    Repeating m_repeating { Repeating::No };
+    bool m_is_suspended { false };
 };
 
 }
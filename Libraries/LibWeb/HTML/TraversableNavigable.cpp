@@ -31,6 +31,9 @@
 
 namespace Web::HTML {
 
+// The number of documents, besides the active one, that we keep alive in session history entries for history traversal.
+static constexpr size_t MAXIMUM_NUMBER_OF_DOCUMENTS_IN_BFCACHE = 4;
+
 GC_DEFINE_ALLOCATOR(TraversableNavigable);
 
 TraversableNavigable::TraversableNavigable(GC::Ref<Page> page)
@@ -48,6 +51,7 @@ void TraversableNavigable::visit_edges(Cell::Visitor& visitor)
     if (m_emulated_position_data.has<GC::Ref<Geolocation::GeolocationCoordinates>>())
         visitor.visit(m_emulated_position_data.get<GC::Ref<Geolocation::GeolocationCoordinates>>());
     visitor.visit(m_session_history_entries);
+    visitor.visit(m_documents_in_bfcache);
     visitor.visit(m_session_history_traversal_queue);
     visitor.visit(m_storage_shed);
 }
@@ -889,6 +893,9 @@ TraversableNavigable::HistoryStepResult TraversableNavigable::apply_the_history_
     // 20. Set traversable's current session history step to targetStep.
     m_current_session_history_step = target_step;
 
+    // Not in the spec:
+    evict_documents_from_bfcache(MAXIMUM_NUMBER_OF_DOCUMENTS_IN_BFCACHE);
+
     // Not in the spec:
     auto back_enabled = m_current_session_history_step > 0;
     VERIFY(m_session_history_entries.size() > 0);
@@ -1281,6 +1288,59 @@ void TraversableNavigable::definitely_close_top_level_traversable()
     }));
 }
 
+void TraversableNavigable::store_document_in_bfcache(GC::Ref<DOM::Document> document)
+{
+    m_documents_in_bfcache.set(document);
+}
+
+// NB: Documents that are the farthest away from the current step are evicted first, as they are the least likely to
+//     be traversed to. Documents that are no longer referenced by any session history entry, e.g. because the entry was
+//     replaced or the forward history was cleared, are always evicted.
+void TraversableNavigable::evict_documents_from_bfcache(size_t number_of_documents_to_keep)
+{
+    if (m_documents_in_bfcache.is_empty())
+        return;
+
+    // NB: A document that was traversed back to is active again, and no longer in the bfcache.
+    if (auto active_document = this->active_document())
+        m_documents_in_bfcache.remove(*active_document);
+
+    HashMap<GC::Ref<DOM::Document>, int> distances_from_current_step;
+    for (auto& entry : m_session_history_entries) {
+        auto document = entry->document();
+        if (!document || !m_documents_in_bfcache.contains(*document))
+            continue;
+
+        auto distance = abs(entry->step().get<int>() - m_current_session_history_step);
+        auto& distance_from_current_step = distances_from_current_step.ensure(*document, [&] { return distance; });
+        distance_from_current_step = min(distance_from_current_step, distance);
+    }
+
+    auto documents_to_keep = distances_from_current_step.keys();
+    quick_sort(documents_to_keep, [&](auto const& a, auto const& b) {
+        return distances_from_current_step.get(a).value() < distances_from_current_step.get(b).value();
+    });
+    if (documents_to_keep.size() > number_of_documents_to_keep)
+        documents_to_keep.shrink(number_of_documents_to_keep);
+
+    HashTable<GC::Ref<DOM::Document>> evicted_documents;
+    for (auto document : m_documents_in_bfcache) {
+        if (!documents_to_keep.contains_slow(document))
+            evicted_documents.set(document);
+    }
+
+    for (auto document : evicted_documents) {
+        m_documents_in_bfcache.remove(document);
+        document->destroy();
+    }
+
+    // NB: Traversing to these entries will populate them with a newly loaded document.
+    for (auto& entry : m_session_history_entries) {
+        if (auto document = entry->document(); document && evicted_documents.contains(*document))
+            entry->document_state()->set_document(nullptr);
+    }
+}
+
 // https://html.spec.whatwg.org/multipage/document-sequences.html#destroy-a-top-level-traversable
 void TraversableNavigable::destroy_top_level_traversable()
 {
@@ -1289,6 +1349,10 @@ void TraversableNavigable::destroy_top_level_traversable()
     // 1. Let browsingContext be traversable's active browsing context.
     auto browsing_context = active_browsing_context();
 
+    // AD-HOC: Documents in the bfcache have no navigable, so no task that we queue for them would ever run. We destroy
+    //         them right away instead.
+    evict_documents_from_bfcache();
+
     // 2. For each historyEntry in traversable's session history entries [[ in what order? ]]:
     for (auto& history_entry : m_session_history_entries) {
         // 1. Let document be historyEntry's document.
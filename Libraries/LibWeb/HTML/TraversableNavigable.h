@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AK/HashTable.h>
 #include <AK/Vector.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Geolocation/Geolocation.h>
@@ -87,6 +88,9 @@ public:
     void definitely_close_top_level_traversable();
     void destroy_top_level_traversable();
 
+    void store_document_in_bfcache(GC::Ref<DOM::Document>);
+    void evict_documents_from_bfcache(size_t number_of_documents_to_keep = 0);
+
     void append_session_history_traversal_steps(GC::Ref<GC::Function<NonnullRefPtr<Core::Promise<Empty>>()>> steps)
     {
         m_session_history_traversal_queue->append(steps);
@@ -152,6 +156,10 @@ private:
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-session-history-entries
     Vector<GC::Ref<SessionHistoryEntry>> m_session_history_entries;
 
+    // Documents that were kept alive in their session history entries as they were unloaded, so that traversing back to
+    // them doesn't need to load them again.
+    HashTable<GC::Ref<DOM::Document>> m_documents_in_bfcache;
+
     // FIXME: https://html.spec.whatwg.org/multipage/document-sequences.html#tn-session-history-traversal-queue
 
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-running-nested-apply-history-step
@@ -41,6 +41,7 @@
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/SupportedPerformanceTypes.h>
 #include <LibWeb/IndexedDB/IDBFactory.h>
+#include <LibWeb/LongAnimationFrames/PerformanceLongAnimationFrameTiming.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/PerformanceTimeline/EntryTypes.h>
 #include <LibWeb/PerformanceTimeline/EventNames.h>
@@ -50,6 +51,7 @@
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
 #include <LibWeb/SVG/SVGImageElement.h>
+#include <LibWeb/Scheduling/Scheduler.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
 #include <LibWeb/TrustedTypes/TrustedTypePolicyFactory.h>
 #include <LibWeb/UserTiming/PerformanceMark.h>
@@ -92,6 +94,7 @@ void WindowOrWorkerGlobalScopeMixin::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_cache_storage);
     visitor.visit(m_resource_timing_secondary_buffer);
     visitor.visit(m_trusted_type_policy_factory);
+    visitor.visit(m_scheduler);
 }
 
 void WindowOrWorkerGlobalScopeMixin::finalize()
@@ -539,6 +542,18 @@ void WindowOrWorkerGlobalScopeMixin::clear_map_of_active_timers()
     m_timer_nesting_levels.clear();
 }
 
+void WindowOrWorkerGlobalScopeMixin::suspend_active_timers()
+{
+    for (auto& it : m_timers)
+        it.value->suspend();
+}
+
+void WindowOrWorkerGlobalScopeMixin::resume_suspended_timers()
+{
+    for (auto& it : m_timers)
+        it.value->resume();
+}
+
 // https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#timer-initialisation-steps
 // With no active script fix from https://github.com/whatwg/html/pull/9712
 i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler handler, i32 timeout, GC::RootVector<JS::Value> arguments, Repeat repeat, Optional<i32> previous_id)
@@ -1300,6 +1315,16 @@ GC::Ref<TrustedTypes::TrustedTypePolicyFactory> WindowOrWorkerGlobalScopeMixin::
     return *m_trusted_type_policy_factory;
 }
 
+// https://wicg.github.io/scheduling-apis/#dom-windoworworkerglobalscope-scheduler
+GC::Ref<Scheduling::Scheduler> WindowOrWorkerGlobalScopeMixin::scheduler()
+{
+    auto& realm = this_impl().realm();
+
+    if (!m_scheduler)
+        m_scheduler = Scheduling::Scheduler::create(realm);
+    return *m_scheduler;
+}
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#windoworworkerglobalscope-mixin:extract-an-origin
 Optional<URL::Origin> WindowOrWorkerGlobalScopeMixin::window_or_worker_global_scope_extract_an_origin() const
 {
@@ -48,6 +48,8 @@ public:
     void clear_timeout(i32);
     void clear_interval(i32);
     void clear_map_of_active_timers();
+    void suspend_active_timers();
+    void resume_suspended_timers();
 
     enum class CheckIfPerformanceBufferIsFull {
         No,
@@ -74,6 +76,7 @@ public:
     void register_event_source(Badge<EventSource>, GC::Ref<EventSource>);
     void unregister_event_source(Badge<EventSource>, GC::Ref<EventSource>);
     void forcibly_close_all_event_sources();
+    bool has_registered_event_sources() const { return !m_registered_event_sources.is_empty(); }
 
     void register_web_socket(Badge<WebSockets::WebSocket>, GC::Ref<WebSockets::WebSocket>);
     void unregister_web_socket(Badge<WebSockets::WebSocket>, GC::Ref<WebSockets::WebSocket>);
@@ -106,6 +109,8 @@ public:
 
     [[nodiscard]] GC::Ref<TrustedTypes::TrustedTypePolicyFactory> trusted_types();
 
+    [[nodiscard]] GC::Ref<Scheduling::Scheduler> scheduler();
+
     Optional<URL::Origin> window_or_worker_global_scope_extract_an_origin() const;
 
 protected:
@@ -161,6 +166,8 @@ private:
 
     GC::Ptr<TrustedTypes::TrustedTypePolicyFactory> m_trusted_type_policy_factory;
 
+    GC::Ptr<Scheduling::Scheduler> m_scheduler;
+
     bool m_error_reporting_mode { false };
 
     WebSockets::WebSocket::List m_registered_web_sockets;
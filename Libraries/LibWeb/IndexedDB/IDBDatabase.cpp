@@ -275,6 +275,17 @@ void IDBDatabase::set_state(ConnectionState state)
     m_state = state;
 }
 
+void IDBDatabase::add_transaction(GC::Ref<IDBTransaction> transaction)
+{
+    // NB: Finished transactions can neither block other transactions nor be waited on anymore. So instead of keeping
+    //     every transaction that was ever created using this connection alive, and checking all of them whenever a new
+    //     transaction is scheduled, we drop the finished ones here.
+    m_transactions.remove_all_matching([](auto const& existing) {
+        return existing->is_finished() && !existing->cleanup_event_loop();
+    });
+    m_transactions.append(transaction);
+}
+
 void IDBDatabase::wait_for_transactions_to_finish(ReadonlySpan<GC::Ref<IDBTransaction>> transactions, GC::Ref<GC::Function<void()>> on_complete)
 {
     auto all_finished = [&] {
@@ -62,7 +62,7 @@ public:
     }
 
     [[nodiscard]] ReadonlySpan<GC::Ref<IDBTransaction>> transactions() { return m_transactions; }
-    void add_transaction(GC::Ref<IDBTransaction> transaction) { m_transactions.append(transaction); }
+    void add_transaction(GC::Ref<IDBTransaction>);
 
     [[nodiscard]] GC::Ref<HTML::DOMStringList> object_store_names();
     WebIDL::ExceptionOr<GC::Ref<IDBObjectStore>> create_object_store(String const&, IDBObjectStoreParameters const&);
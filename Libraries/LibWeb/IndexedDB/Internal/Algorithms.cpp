@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Math.h>
 #include <AK/NumericLimits.h>
 #include <AK/QuickSort.h>
@@ -35,6 +36,7 @@
 #include <LibWeb/IndexedDB/Internal/Database.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/IndexedDB/Internal/RecordSearch.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/StorageAPI/StorageKey.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
@@ -1821,6 +1823,26 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
             });
     };
 
+    // OPTIMIZATION: The records are sorted by their key, and the requirements above only hold for records whose key is
+    //               not below key, position and the range, or not above them for the prev directions. So we only look
+    //               for the found record among those, which we can find with a binary search.
+    auto records_not_below_bounds = [&]<typename Record>(ReadonlySpan<Record> content) {
+        size_t start = 0;
+        for (auto bound : Array { key, position, range->lower_key() }) {
+            if (bound)
+                start = max(start, lower_bound_of_key(content, *bound));
+        }
+        return content.slice(start);
+    };
+    auto records_not_above_bounds = [&]<typename Record>(ReadonlySpan<Record> content) {
+        size_t end = content.size();
+        for (auto bound : Array { key, position, range->upper_key() }) {
+            if (bound)
+                end = min(end, upper_bound_of_key(content, *bound));
+        }
+        return content.trim(end);
+    };
+
     // 9. While count is greater than 0:
     Variant<Empty, ObjectStoreRecord, IndexRecord> found_record;
     while (count > 0) {
@@ -1829,7 +1851,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Next: {
             // Let found record be the first record in records which satisfy all of the following requirements:
             found_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                auto value = content.first_matching(next_requirements);
+                auto value = records_not_below_bounds(content).first_matching(next_requirements);
                 if (value.has_value())
                     return *value;
 
@@ -1840,7 +1862,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Nextunique: {
             // Let found record be the first record in records which satisfy all of the following requirements:
             found_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                auto value = content.first_matching(next_unique_requirements);
+                auto value = records_not_below_bounds(content).first_matching(next_unique_requirements);
                 if (value.has_value())
                     return *value;
 
@@ -1851,7 +1873,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Prev: {
             // Let found record be the last record in records which satisfy all of the following requirements:
             found_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                auto value = content.last_matching(prev_requirements);
+                auto value = records_not_above_bounds(content).last_matching(prev_requirements);
                 if (value.has_value())
                     return *value;
 
@@ -1863,7 +1885,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Prevunique: {
             // Let temp record be the last record in records which satisfy all of the following requirements:
             auto temp_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                auto value = content.last_matching(prev_unique_requirements);
+                auto value = records_not_above_bounds(content).last_matching(prev_unique_requirements);
                 if (value.has_value())
                     return *value;
 
@@ -1877,11 +1899,9 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
                     [](auto const& record) { return record.key; });
 
                 found_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                    auto value = content.first_matching([&](auto const& content_record) {
-                        return Key::equals(content_record.key, temp_record_key);
-                    });
-                    if (value.has_value())
-                        return *value;
+                    auto index = lower_bound_of_key(content, temp_record_key);
+                    if (index < content.size() && Key::equals(content[index].key, temp_record_key))
+                        return content[index];
 
                     return Empty {};
                 });
@@ -2000,7 +2020,7 @@ GC::Ref<JS::Array> retrieve_multiple_values_from_an_object_store(JS::Realm& real
 
     // 4. For each record of records:
     for (u32 i = 0; i < records.size(); ++i) {
-        auto& record = records[i];
+        auto const& record = records[i];
 
         // 1. Let serialized be record’s value. If an error occurs while reading the value from the underlying storage, return a newly created "NotReadableError" DOMException.
         auto const& serialized = *record.value;
@@ -2024,16 +2044,20 @@ GC::Ref<JS::Array> retrieve_multiple_items_from_an_object_store(JS::Realm& realm
         count = OptionalNone();
 
     // 2. Let records an empty list.
-    GC::ConservativeVector<ObjectStoreRecord> records(realm.heap());
+    // OPTIMIZATION: We read the records from the store directly, instead of copying them along with their serialized
+    //               values first. The records are in ascending order, so we read them backwards for the prev directions.
+    ReadonlySpan<ObjectStoreRecord> records;
+    bool records_are_reversed = false;
 
     // 3. If direction is "next" or "nextunique", set records to the first count of store’s list of records whose key is in range.
     if (direction == Bindings::IDBCursorDirection::Next || direction == Bindings::IDBCursorDirection::Nextunique) {
-        records.extend(store->first_n_in_range(range, count));
+        records = store->first_n_in_range(range, count);
     }
 
     // 4. If direction is "prev" or "prevunique", set records to the last count of store’s list of records whose key is in range.
     if (direction == Bindings::IDBCursorDirection::Prev || direction == Bindings::IDBCursorDirection::Prevunique) {
-        records.extend(store->last_n_in_range(range, count));
+        records = store->last_n_in_range(range, count);
+        records_are_reversed = true;
     }
 
     // 5. Let list be an empty list.
@@ -2041,7 +2065,7 @@ GC::Ref<JS::Array> retrieve_multiple_items_from_an_object_store(JS::Realm& realm
 
     // 6. For each record of records, switching on kind:
     for (u32 i = 0; i < records.size(); ++i) {
-        auto& record = records[i];
+        auto const& record = records_are_reversed ? records[records.size() - 1 - i] : records[i];
 
         switch (kind) {
         case RecordKind::Key: {
@@ -2102,7 +2126,7 @@ GC::Ref<JS::Array> retrieve_multiple_keys_from_an_object_store(JS::Realm& realm,
 
     // 4. For each record of records:
     for (u32 i = 0; i < records.size(); ++i) {
-        auto& record = records[i];
+        auto const& record = records[i];
 
         // 1. Let entry be the result of converting a key to a value with record’s key.
         auto entry = convert_a_key_to_a_value(realm, record.key);
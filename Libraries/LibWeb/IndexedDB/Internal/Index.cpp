@@ -4,10 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/MutationLog.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/RecordSearch.h>
 
 namespace Web::IndexedDB {
 
@@ -52,11 +52,8 @@ void Index::set_name(String name)
 
 bool Index::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
-    });
-
-    return index != m_records.end();
+    auto index = lower_bound_of_key(m_records, key);
+    return index < m_records.size() && Key::equals(m_records[index].key, key);
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
@@ -64,13 +61,10 @@ HTML::SerializationRecord const& Index::referenced_value(IndexRecord const& inde
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return *m_object_store
-                ->records()
-                .first_matching([&](auto const& store_record) {
-                    return Key::equals(store_record.key, index_record.value);
-                })
-                .value()
-                .value;
+    auto store_records = m_object_store->records();
+    auto index = lower_bound_of_key(store_records, index_record.value);
+    VERIFY(index < store_records.size() && Key::equals(store_records[index].key, index_record.value));
+    return *store_records[index].value;
 }
 
 void Index::clear_records()
@@ -82,47 +76,58 @@ void Index::clear_records()
 
 Optional<IndexRecord&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto indices = indices_of_records_in_range(m_records, *range);
+    if (indices.is_empty())
+        return {};
+    return m_records[indices.start];
 }
 
 GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
-    GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    auto indices = indices_of_records_in_range(m_records, *range);
+    if (count.has_value() && *count < indices.size())
+        indices.end = indices.start + *count;
 
-        if (count.has_value() && records.size() >= *count)
-            break;
-    }
+    GC::ConservativeVector<IndexRecord> records(range->heap());
+    records.ensure_capacity(indices.size());
+    for (size_t i = indices.start; i < indices.end; ++i)
+        records.unchecked_append(m_records[i]);
 
     return records;
 }
 
 GC::ConservativeVector<IndexRecord> Index::last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
-    GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records.in_reverse()) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    auto indices = indices_of_records_in_range(m_records, *range);
+    if (count.has_value() && *count < indices.size())
+        indices.start = indices.end - *count;
 
-        if (count.has_value() && records.size() >= *count)
-            break;
-    }
+    GC::ConservativeVector<IndexRecord> records(range->heap());
+    records.ensure_capacity(indices.size());
+    for (size_t i = indices.end; i > indices.start; --i)
+        records.unchecked_append(m_records[i - 1]);
 
     return records;
 }
 
 u64 Index::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
+    return indices_of_records_in_range(m_records, *range).size();
+}
+
+// Returns the index of the first record that is not sorted before the given record, i.e. where it is or would be stored.
+static size_t lower_bound_of_record(ReadonlySpan<IndexRecord> records, IndexRecord const& record)
+{
+    auto index = lower_bound_of_key(records, record.key);
+    auto end = upper_bound_of_key(records.slice(index), record.key) + index;
+    while (index < end) {
+        auto middle = index + (end - index) / 2;
+        if (Key::less_than(records[middle].value, record.value))
+            index = middle + 1;
+        else
+            end = middle;
     }
-    return count;
+    return index;
 }
 
 void Index::store_a_record(IndexRecord const& record)
@@ -130,23 +135,15 @@ void Index::store_a_record(IndexRecord const& record)
     if (auto log = m_object_store->mutation_log())
         log->note_index_record_stored(*this, record);
 
-    m_records.append(record);
-
     // NOTE: The record is stored in index’s list of records such that the list is sorted primarily on the records keys, and secondarily on the records values, in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        auto key_comparison = Key::compare_two_keys(a.key, b.key);
-        if (key_comparison != 0)
-            return key_comparison < 0;
-
-        return Key::compare_two_keys(a.value, b.value) < 0;
-    });
+    m_records.insert(lower_bound_of_record(m_records, record), record);
 }
 
 void Index::remove_record(IndexRecord const& record)
 {
-    m_records.remove_first_matching([&](auto const& existing) {
-        return Key::equals(existing.key, record.key) && Key::equals(existing.value, record.value);
-    });
+    auto index = lower_bound_of_record(m_records, record);
+    if (index < m_records.size() && Key::equals(m_records[index].key, record.key) && Key::equals(m_records[index].value, record.value))
+        m_records.remove(index);
 }
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
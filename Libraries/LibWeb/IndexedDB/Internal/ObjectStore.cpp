@@ -9,6 +9,7 @@
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/MutationLog.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/RecordSearch.h>
 
 namespace Web::IndexedDB {
 
@@ -59,61 +60,25 @@ void ObjectStore::visit_edges(Visitor& visitor)
 
 void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    if (m_records.is_empty())
+    auto indices = indices_of_records_in_range(m_records, *range);
+    if (indices.is_empty())
         return;
 
-    // Since records are sorted by key, records in range form a contiguous block.
-    // Binary search for the first record in range.
-    size_t lo = 0;
-    size_t hi = m_records.size();
-
-    auto lower = range->lower_key();
-    if (lower) {
-        // Find the first record with key >= lower (or > lower if lower_open).
-        size_t l = 0, h = m_records.size();
-        while (l < h) {
-            size_t mid = l + (h - l) / 2;
-            auto cmp = Key::compare_two_keys(m_records[mid].key, *lower);
-            if (cmp < 0 || (cmp == 0 && range->lower_open()))
-                l = mid + 1;
-            else
-                h = mid;
-        }
-        lo = l;
-    }
-
-    auto upper = range->upper_key();
-    if (upper) {
-        // Find the first record with key > upper (or >= upper if upper_open).
-        size_t l = lo, h = m_records.size();
-        while (l < h) {
-            size_t mid = l + (h - l) / 2;
-            auto cmp = Key::compare_two_keys(m_records[mid].key, *upper);
-            if (cmp < 0 || (cmp == 0 && !range->upper_open()))
-                l = mid + 1;
-            else
-                h = mid;
-        }
-        hi = l;
-    }
-
-    if (lo < hi) {
-        if (m_mutation_log) {
-            Vector<ObjectStoreRecord> deleted;
-            deleted.ensure_capacity(hi - lo);
-            for (size_t i = lo; i < hi; ++i)
-                deleted.append(move(m_records[i]));
-            m_mutation_log->note_records_deleted(move(deleted));
-        }
-        m_records.remove(lo, hi - lo);
+    if (m_mutation_log) {
+        Vector<ObjectStoreRecord> deleted;
+        deleted.ensure_capacity(indices.size());
+        for (size_t i = indices.start; i < indices.end; ++i)
+            deleted.append(move(m_records[i]));
+        m_mutation_log->note_records_deleted(move(deleted));
     }
+    m_records.remove(indices.start, indices.size());
 }
 
 void ObjectStore::remove_record_with_key(GC::Ref<Key> key)
 {
-    m_records.remove_first_matching([&](auto const& record) {
-        return Key::equals(record.key, key);
-    });
+    auto index = lower_bound_of_key(m_records, key);
+    if (index < m_records.size() && Key::equals(m_records[index].key, key))
+        m_records.remove(index);
 }
 
 bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
@@ -130,33 +95,21 @@ void ObjectStore::store_a_record(ObjectStoreRecord record)
 
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
     //       We use binary search to find the correct insertion position.
-    size_t lo = 0;
-    size_t hi = m_records.size();
-    while (lo < hi) {
-        size_t mid = lo + (hi - lo) / 2;
-        if (Key::compare_two_keys(m_records[mid].key, record.key) < 0)
-            lo = mid + 1;
-        else
-            hi = mid;
-    }
-    m_records.insert(lo, move(record));
+    auto index = lower_bound_of_key(m_records, record.key);
+    m_records.insert(index, move(record));
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    return indices_of_records_in_range(m_records, *range).size();
 }
 
 Optional<ObjectStoreRecord&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto indices = indices_of_records_in_range(m_records, *range);
+    if (indices.is_empty())
+        return {};
+    return m_records[indices.start];
 }
 
 void ObjectStore::clear_records()
@@ -215,32 +168,20 @@ void ObjectStore::possibly_update_the_key_generator(GC::Ref<Key> key)
     }
 }
 
-GC::ConservativeVector<ObjectStoreRecord> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
+ReadonlySpan<ObjectStoreRecord> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
-    GC::ConservativeVector<ObjectStoreRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
-
-        if (count.has_value() && records.size() >= *count)
-            break;
-    }
-
-    return records;
+    auto indices = indices_of_records_in_range(m_records, *range);
+    if (count.has_value() && *count < indices.size())
+        indices.end = indices.start + *count;
+    return m_records.span().slice(indices.start, indices.size());
 }
 
-GC::ConservativeVector<ObjectStoreRecord> ObjectStore::last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
+ReadonlySpan<ObjectStoreRecord> ObjectStore::last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
-    GC::ConservativeVector<ObjectStoreRecord> records(range->heap());
-    for (auto const& record : m_records.in_reverse()) {
-        if (range->is_in_range(record.key))
-            records.append(record);
-
-        if (count.has_value() && records.size() >= *count)
-            break;
-    }
-
-    return records;
+    auto indices = indices_of_records_in_range(m_records, *range);
+    if (count.has_value() && *count < indices.size())
+        indices.start = indices.end - *count;
+    return m_records.span().slice(indices.start, indices.size());
 }
 
 }
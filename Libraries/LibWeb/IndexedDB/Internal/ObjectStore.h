@@ -56,8 +56,11 @@ public:
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
     Optional<ObjectStoreRecord&> first_in_range(GC::Ref<IDBKeyRange> range);
     void clear_records();
-    GC::ConservativeVector<ObjectStoreRecord> first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count);
-    GC::ConservativeVector<ObjectStoreRecord> last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count);
+
+    // These return the records as they are stored, in ascending order of their keys. They stay valid until the records
+    // of this object store are modified.
+    ReadonlySpan<ObjectStoreRecord> first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count);
+    ReadonlySpan<ObjectStoreRecord> last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count);
 
     // https://w3c.github.io/IndexedDB/#generate-a-key
     ErrorOr<u64> generate_a_key();
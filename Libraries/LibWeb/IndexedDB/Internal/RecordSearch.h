@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+#include <LibGC/Ptr.h>
+#include <LibWeb/IndexedDB/IDBKeyRange.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+namespace Web::IndexedDB {
+
+// The records of object stores and indexes are sorted by their key, so instead of checking every record, we can binary
+// search for the records with a given key, or for the records whose key is in a key range.
+
+// Returns the index of the first record whose key is greater than or equal to the given key.
+template<typename Records>
+size_t lower_bound_of_key(Records const& records, GC::Ref<Key> key)
+{
+    size_t low = 0;
+    size_t high = records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (Key::less_than(records[middle].key, key))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+// Returns the index of the first record whose key is greater than the given key.
+template<typename Records>
+size_t upper_bound_of_key(Records const& records, GC::Ref<Key> key)
+{
+    size_t low = 0;
+    size_t high = records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (Key::less_than_or_equal(records[middle].key, key))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+struct RecordIndexRange {
+    size_t start { 0 };
+    size_t end { 0 };
+
+    size_t size() const { return end - start; }
+    bool is_empty() const { return start == end; }
+};
+
+// Returns the indices of the records whose key is in the given range, which are always next to each other.
+template<typename Records>
+RecordIndexRange indices_of_records_in_range(Records const& records, IDBKeyRange const& range)
+{
+    size_t start = 0;
+    if (auto lower = range.lower_key())
+        start = range.lower_open() ? upper_bound_of_key(records, *lower) : lower_bound_of_key(records, *lower);
+
+    size_t end = records.size();
+    if (auto upper = range.upper_key())
+        end = range.upper_open() ? lower_bound_of_key(records, *upper) : upper_bound_of_key(records, *upper);
+
+    return { start, max(start, end) };
+}
+
+}
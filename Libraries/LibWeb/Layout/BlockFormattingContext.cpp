@@ -769,6 +769,36 @@ static CSSPixels containing_block_height_to_resolve_percentage_in_quirks_mode(Bo
     VERIFY_NOT_REACHED();
 }
 
+// Lays out the contents of an independent formatting context root in a throwaway state to find out whether its
+// automatic content height is less than its min-height.
+CSSPixels BlockFormattingContext::measure_content_height_for_min_height(Box const& box, AvailableSpace const& inner_available_space)
+{
+    // NB: The result only depends on the box's subtree and the space it's laid out in, so it's cached alongside the
+    //     intrinsic sizes. Without this, nested boxes with a min-height lay out their subtree twice at every level.
+    auto& measured_content_heights = box.cached_intrinsic_sizes().measured_content_heights;
+    for (auto const& measured : measured_content_heights) {
+        if (measured.layout_mode == m_layout_mode && measured.available_space == inner_available_space)
+            return measured.content_height;
+    }
+
+    LayoutState throwaway_state(box);
+    // Populate the entire containing block chain: the throwaway BFC may encounter abspos
+    // elements whose containing block is an ancestor above `box`. We stop when the source
+    // state lacks an entry, which happens when it is itself a nested throwaway state.
+    for (auto cb = box.containing_block(); cb; cb = cb->containing_block()) {
+        if (!m_state.try_get(*cb))
+            break;
+        throwaway_state.populate_node_from(m_state, *cb);
+    }
+
+    auto measuring_context = create_independent_formatting_context_if_needed(throwaway_state, m_layout_mode, box);
+    measuring_context->run(inner_available_space);
+    auto content_height = measuring_context->automatic_content_height();
+
+    measured_content_heights.append({ m_layout_mode, inner_available_space, content_height });
+    return content_height;
+}
+
 void BlockFormattingContext::layout_block_level_box(Box const& box, BlockContainer const& block_container, CSSPixels& bottom_of_lowest_margin_box, AvailableSpace const& available_space)
 {
     if (box.is_absolutely_positioned()) {
@@ -914,19 +944,7 @@ void BlockFormattingContext::layout_block_level_box(Box const& box, BlockContain
         // For boxes with auto height but non-auto min-height, we need to determine if the content height is less than
         // min-height. If so, we run layout with min-height as the available height.
         if (should_treat_height_as_auto(box, available_space) && !box.computed_values().min_height().is_auto()) {
-            LayoutState throwaway_state(box);
-            // Populate the entire containing block chain: the throwaway BFC may encounter abspos
-            // elements whose containing block is an ancestor above `box`. We stop when the source
-            // state lacks an entry, which happens when it is itself a nested throwaway state.
-            for (auto cb = box.containing_block(); cb; cb = cb->containing_block()) {
-                if (!m_state.try_get(*cb))
-                    break;
-                throwaway_state.populate_node_from(m_state, *cb);
-            }
-
-            auto measuring_context = create_independent_formatting_context_if_needed(throwaway_state, m_layout_mode, box);
-            measuring_context->run(inner_available_space);
-            auto content_height = measuring_context->automatic_content_height();
+            auto content_height = measure_content_height_for_min_height(box, inner_available_space);
             auto min_height = calculate_inner_height(box, available_space, box.computed_values().min_height());
             if (content_height < min_height) {
                 inner_available_space.height = AvailableSize::make_definite(min_height);
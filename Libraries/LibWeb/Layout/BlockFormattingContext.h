@@ -97,6 +97,7 @@ public:
 
 private:
     CSSPixels compute_auto_height_for_block_level_element(Box const&, AvailableSpace const&);
+    CSSPixels measure_content_height_for_min_height(Box const&, AvailableSpace const& inner_available_space);
 
     void compute_width_for_floating_box(Box const&, AvailableSpace const&);
 
@@ -10,6 +10,7 @@
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/CSS/Sizing.h>
 #include <LibWeb/Export.h>
+#include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/Node.h>
 
 namespace Web::Layout {
@@ -24,6 +25,14 @@ struct IntrinsicSizes {
     Optional<CSSPixels> max_content_width;
     HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
     HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+
+    // Content heights measured by BlockFormattingContext to compare against a non-auto min-height.
+    struct MeasuredContentHeight {
+        LayoutMode layout_mode;
+        AvailableSpace available_space;
+        CSSPixels content_height;
+    };
+    Vector<MeasuredContentHeight> measured_content_heights;
 };
 
 class WEB_API Box : public NodeWithStyleAndBoxModelMetrics {
@@ -80,7 +80,7 @@ private:
     LayoutMode const m_layout_mode;
 
     struct TextNodeContext {
-        Vector<TextNode::Chunk> chunks;
+        ReadonlySpan<TextNode::Chunk> chunks;
         size_t next_chunk_index { 0 };
         bool should_collapse_whitespace {};
         bool should_wrap_lines {};
@@ -22,7 +22,8 @@
 namespace Web::Layout {
 
 LayoutState::LayoutState(NodeWithStyle const& subtree_root)
-    : m_subtree_root(&subtree_root)
+    : m_used_values_store(subtree_root.layout_index())
+    , m_subtree_root(&subtree_root)
 {
 }
 
@@ -405,9 +406,9 @@ void LayoutState::commit(Box& root)
                 svg_graphics_paintable->set_computed_transforms(*used_values.computed_svg_transforms());
             }
 
-            if (auto* svg_path_paintable = as_if<Painting::SVGPathPaintable>(paintable.ptr());
-                svg_path_paintable && used_values.computed_svg_path().has_value()) {
-                svg_path_paintable->set_computed_path(move(*used_values.computed_svg_path()));
+            if (auto* svg_path_paintable = as_if<Painting::SVGPathPaintable>(paintable.ptr())) {
+                if (auto computed_svg_path = used_values.take_computed_svg_path(); computed_svg_path.has_value())
+                    svg_path_paintable->set_computed_path(computed_svg_path.release_value());
             }
 
             if (node.display().is_grid_inside()) {
@@ -747,7 +748,31 @@ void LayoutState::UsedValues::materialize_from_paintable(Painting::PaintableBox
     inset_bottom = box_model.inset.bottom;
 
     if (auto const* svg_graphics_paintable = as_if<Painting::SVGGraphicsPaintable>(paintable))
-        m_computed_svg_transforms = svg_graphics_paintable->computed_transforms();
+        set_computed_svg_transforms(svg_graphics_paintable->computed_transforms());
+}
+
+LayoutState::UsedValues::RareValues const& LayoutState::UsedValues::rare_values() const
+{
+    static RareValues const empty_rare_values;
+    if (!m_rare_values)
+        return empty_rare_values;
+    return *m_rare_values;
+}
+
+LayoutState::UsedValues::RareValues& LayoutState::UsedValues::ensure_rare_values()
+{
+    if (!m_rare_values)
+        m_rare_values = adopt_ref(*new SharedRareValues);
+    else if (m_rare_values->ref_count() > 1)
+        m_rare_values = m_rare_values->clone();
+    return *m_rare_values;
+}
+
+Optional<Gfx::Path> LayoutState::UsedValues::take_computed_svg_path()
+{
+    if (!m_rare_values || !m_rare_values->computed_svg_path.has_value())
+        return {};
+    return ensure_rare_values().computed_svg_path.release_value();
 }
 
 void LayoutState::UsedValues::set_content_width(CSSPixels width)
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <AK/HashTable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/RefCounted.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
 #include <LibWeb/Layout/Box.h>
@@ -59,6 +61,12 @@ struct StaticPositionRect {
 // flat vector pre-allocated for the entire tree wastes memory, while
 // a hash map pays hashing overhead on every access. Page tables give
 // O(1) lookup without hashing, allocating pages only on first write.
+//
+// The page table starts at the first index of the subtree being laid out,
+// so that throwaway states for a subtree deep in the tree don't have to
+// allocate page table entries for everything that precedes it. The few
+// entries below that index (the containing block chain of the subtree)
+// are kept in a separate list.
 template<typename T>
 class PagedStore {
     static constexpr u32 PageBits = 4;
@@ -69,14 +77,29 @@ class PagedStore {
         Optional<T> entries[PageSize] {};
     };
 
+    struct OutlyingEntry {
+        u32 index { 0 };
+        NonnullOwnPtr<T> value;
+    };
+
 public:
+    explicit PagedStore(u32 first_index = 0)
+        : m_first_index(first_index)
+    {
+    }
+
     void ensure_capacity(u32 count)
     {
-        m_pages.resize((count + PageSize - 1) >> PageBits);
+        if (count <= m_first_index)
+            return;
+        m_pages.resize((count - m_first_index + PageSize - 1) >> PageBits);
     }
 
     T* get(u32 index) const
     {
+        if (index < m_first_index) [[unlikely]]
+            return get_outlying(index);
+        index -= m_first_index;
         auto page_index = index >> PageBits;
         if (page_index >= m_pages.size())
             return nullptr;
@@ -91,6 +114,9 @@ public:
 
     T& allocate(u32 index)
     {
+        if (index < m_first_index) [[unlikely]]
+            return allocate_outlying(index);
+        index -= m_first_index;
         auto page_index = index >> PageBits;
         if (page_index >= m_pages.size())
             m_pages.resize(page_index + 1);
@@ -105,6 +131,8 @@ public:
     template<typename Callback>
     void for_each(Callback callback)
     {
+        for (auto& entry : m_outlying_entries)
+            callback(*entry.value);
         for (auto const& page : m_pages) {
             if (!page)
                 continue;
@@ -116,7 +144,28 @@ public:
     }
 
 private:
+    T* get_outlying(u32 index) const
+    {
+        for (auto const& entry : m_outlying_entries) {
+            if (entry.index == index)
+                return entry.value.ptr();
+        }
+        return nullptr;
+    }
+
+    T& allocate_outlying(u32 index)
+    {
+        if (auto* value = get_outlying(index)) {
+            *value = T {};
+            return *value;
+        }
+        m_outlying_entries.append({ index, make<T>() });
+        return *m_outlying_entries.last().value;
+    }
+
+    u32 m_first_index { 0 };
     Vector<OwnPtr<Page>> m_pages;
+    Vector<OutlyingEntry> m_outlying_entries;
 };
 
 struct LayoutState {
@@ -212,33 +261,34 @@ struct LayoutState {
 
         Optional<LineBoxFragmentCoordinate> containing_line_box_fragment;
 
-        void add_floating_descendant(Box const& box) { m_floating_descendants.set(&box); }
-        auto const& floating_descendants() const { return m_floating_descendants; }
+        void add_floating_descendant(Box const& box) { ensure_rare_values().floating_descendants.set(&box); }
+        auto const& floating_descendants() const { return rare_values().floating_descendants; }
 
-        void set_override_borders_data(Painting::PaintableBox::BordersDataWithElementKind const& override_borders_data) { m_override_borders_data = override_borders_data; }
-        auto const& override_borders_data() const { return m_override_borders_data; }
+        void set_override_borders_data(Painting::PaintableBox::BordersDataWithElementKind const& override_borders_data) { ensure_rare_values().override_borders_data = override_borders_data; }
+        auto const& override_borders_data() const { return rare_values().override_borders_data; }
 
-        void set_table_cell_coordinates(Painting::PaintableBox::TableCellCoordinates const& table_cell_coordinates) { m_table_cell_coordinates = table_cell_coordinates; }
-        auto const& table_cell_coordinates() const { return m_table_cell_coordinates; }
+        void set_table_cell_coordinates(Painting::PaintableBox::TableCellCoordinates const& table_cell_coordinates) { ensure_rare_values().table_cell_coordinates = table_cell_coordinates; }
+        auto const& table_cell_coordinates() const { return rare_values().table_cell_coordinates; }
 
-        void set_computed_svg_path(Gfx::Path const& svg_path) { m_computed_svg_path = svg_path; }
-        auto& computed_svg_path() { return m_computed_svg_path; }
+        void set_computed_svg_path(Gfx::Path const& svg_path) { ensure_rare_values().computed_svg_path = svg_path; }
+        Optional<Gfx::Path> take_computed_svg_path();
 
-        void set_computed_svg_transforms(Painting::SVGGraphicsPaintable::ComputedTransforms const& computed_transforms) { m_computed_svg_transforms = computed_transforms; }
-        auto const& computed_svg_transforms() const { return m_computed_svg_transforms; }
+        void set_computed_svg_transforms(Painting::SVGGraphicsPaintable::ComputedTransforms const& computed_transforms) { ensure_rare_values().computed_svg_transforms = computed_transforms; }
+        auto const& computed_svg_transforms() const { return rare_values().computed_svg_transforms; }
 
-        void set_grid_template_columns(RefPtr<CSS::GridTrackSizeListStyleValue const> used_values_for_grid_template_columns) { m_grid_template_columns = move(used_values_for_grid_template_columns); }
-        auto const& grid_template_columns() const { return m_grid_template_columns; }
+        void set_grid_template_columns(RefPtr<CSS::GridTrackSizeListStyleValue const> used_values_for_grid_template_columns) { ensure_rare_values().grid_template_columns = move(used_values_for_grid_template_columns); }
+        auto const& grid_template_columns() const { return rare_values().grid_template_columns; }
 
-        void set_grid_template_rows(RefPtr<CSS::GridTrackSizeListStyleValue const> used_values_for_grid_template_rows) { m_grid_template_rows = move(used_values_for_grid_template_rows); }
-        auto const& grid_template_rows() const { return m_grid_template_rows; }
+        void set_grid_template_rows(RefPtr<CSS::GridTrackSizeListStyleValue const> used_values_for_grid_template_rows) { ensure_rare_values().grid_template_rows = move(used_values_for_grid_template_rows); }
+        auto const& grid_template_rows() const { return rare_values().grid_template_rows; }
 
-        void set_static_position_rect(StaticPositionRect const& static_position_rect) { m_static_position_rect = static_position_rect; }
+        void set_static_position_rect(StaticPositionRect const& static_position_rect) { ensure_rare_values().static_position_rect = static_position_rect; }
         CSSPixelPoint static_position() const
         {
-            if (!m_static_position_rect.has_value())
+            auto const& static_position_rect = rare_values().static_position_rect;
+            if (!static_position_rect.has_value())
                 return {};
-            return m_static_position_rect->aligned_position_for_box_with_size({ margin_box_width(), margin_box_height() });
+            return static_position_rect->aligned_position_for_box_with_size({ margin_box_width(), margin_box_height() });
         }
 
     private:
@@ -247,7 +297,7 @@ struct LayoutState {
         AvailableSize available_width_inside() const;
         AvailableSize available_height_inside() const;
 
-        bool use_collapsing_borders_model() const { return m_override_borders_data.has_value(); }
+        bool use_collapsing_borders_model() const { return m_rare_values && m_rare_values->override_borders_data.has_value(); }
         // Implement the collapsing border model https://www.w3.org/TR/CSS22/tables.html#collapsing-borders.
         CSSPixels border_left_collapsed() const { return use_collapsing_borders_model() ? round(border_left / 2) : border_left; }
         CSSPixels border_right_collapsed() const { return use_collapsing_borders_model() ? round(border_right / 2) : border_right; }
@@ -264,18 +314,39 @@ struct LayoutState {
         bool m_has_definite_width { false };
         bool m_has_definite_height { false };
 
-        HashTable<GC::Ptr<Box const>> m_floating_descendants;
+        // NB: Values that only a few kinds of boxes have (table cells, SVG graphics, grid containers, boxes with floating
+        //     or absolutely positioned descendants) are kept out of line, so that the values every box has stay small.
+        //     They are shared between copies of the used values, and are only copied once one of the copies changes.
+        struct RareValues {
+            HashTable<GC::Ptr<Box const>> floating_descendants;
 
-        Optional<Painting::PaintableBox::BordersDataWithElementKind> m_override_borders_data;
-        Optional<Painting::PaintableBox::TableCellCoordinates> m_table_cell_coordinates;
+            Optional<Painting::PaintableBox::BordersDataWithElementKind> override_borders_data;
+            Optional<Painting::PaintableBox::TableCellCoordinates> table_cell_coordinates;
 
-        Optional<Gfx::Path> m_computed_svg_path;
-        Optional<Painting::SVGGraphicsPaintable::ComputedTransforms> m_computed_svg_transforms;
+            Optional<Gfx::Path> computed_svg_path;
+            Optional<Painting::SVGGraphicsPaintable::ComputedTransforms> computed_svg_transforms;
+
+            RefPtr<CSS::GridTrackSizeListStyleValue const> grid_template_columns;
+            RefPtr<CSS::GridTrackSizeListStyleValue const> grid_template_rows;
+
+            Optional<StaticPositionRect> static_position_rect;
+        };
+
+        struct SharedRareValues final
+            : public RefCounted<SharedRareValues>
+            , public RareValues {
+            NonnullRefPtr<SharedRareValues> clone() const
+            {
+                auto clone = adopt_ref(*new SharedRareValues);
+                static_cast<RareValues&>(*clone) = *this;
+                return clone;
+            }
+        };
 
-        RefPtr<CSS::GridTrackSizeListStyleValue const> m_grid_template_columns;
-        RefPtr<CSS::GridTrackSizeListStyleValue const> m_grid_template_rows;
+        RareValues const& rare_values() const;
+        RareValues& ensure_rare_values();
 
-        Optional<StaticPositionRect> m_static_position_rect;
+        RefPtr<SharedRareValues> m_rare_values;
     };
 
     LayoutState() = default;
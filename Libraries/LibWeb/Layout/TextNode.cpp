@@ -299,6 +299,43 @@ void TextNode::invalidate_text_for_rendering()
     m_text_for_rendering = {};
     m_grapheme_segmenter.clear();
     m_line_segmenter.clear();
+    m_chunks_for_inline_layout.clear();
+}
+
+ReadonlySpan<TextNode::Chunk> TextNode::chunks_for_inline_layout(bool should_wrap_lines, bool should_respect_linebreaks) const
+{
+    auto const& font_cascade_list = computed_values().font_list();
+    auto word_break = computed_values().word_break();
+    auto white_space_collapse = computed_values().white_space_collapse();
+
+    if (m_chunks_for_inline_layout.has_value()) {
+        auto const& cached = *m_chunks_for_inline_layout;
+        if (cached.font_cascade_list.ptr() == &font_cascade_list
+            && cached.word_break == word_break
+            && cached.white_space_collapse == white_space_collapse
+            && cached.should_wrap_lines == should_wrap_lines
+            && cached.should_respect_linebreaks == should_respect_linebreaks)
+            return cached.chunks;
+    }
+
+    ChunkIterator chunk_iterator { *this, should_wrap_lines, should_respect_linebreaks };
+    Vector<Chunk> chunks;
+    while (true) {
+        auto chunk = chunk_iterator.next();
+        if (!chunk.has_value())
+            break;
+        chunks.append(chunk.release_value());
+    }
+
+    m_chunks_for_inline_layout = ChunksForInlineLayout {
+        .font_cascade_list = font_cascade_list,
+        .word_break = word_break,
+        .white_space_collapse = white_space_collapse,
+        .should_wrap_lines = should_wrap_lines,
+        .should_respect_linebreaks = should_respect_linebreaks,
+        .chunks = move(chunks),
+    };
+    return m_chunks_for_inline_layout->chunks;
 }
 
 Utf16String const& TextNode::text_for_rendering() const
@@ -80,6 +80,10 @@ public:
 
     void invalidate_text_for_rendering();
 
+    // The chunks an inline formatting context splits this text node into. They only depend on the text and a few of
+    // its computed values, so they are kept across layouts until one of those changes.
+    ReadonlySpan<Chunk> chunks_for_inline_layout(bool should_wrap_lines, bool should_respect_linebreaks) const;
+
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& line_segmenter() const;
 
@@ -91,6 +95,16 @@ private:
     void compute_text_for_rendering();
 
     Optional<Utf16String> m_text_for_rendering;
+
+    struct ChunksForInlineLayout {
+        NonnullRefPtr<Gfx::FontCascadeList const> font_cascade_list;
+        CSS::WordBreak word_break;
+        CSS::WhiteSpaceCollapse white_space_collapse;
+        bool should_wrap_lines { false };
+        bool should_respect_linebreaks { false };
+        Vector<Chunk> chunks;
+    };
+    mutable Optional<ChunksForInlineLayout> m_chunks_for_inline_layout;
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_line_segmenter;
 };
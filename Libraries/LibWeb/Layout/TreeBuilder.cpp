@@ -568,6 +568,30 @@ static bool is_ignorable_whitespace(Layout::Node const& node)
     return false;
 }
 
+// Removes the now stale layout and paint nodes of a DOM subtree that doesn't get any layout nodes anymore.
+static void remove_stale_layout_nodes_in_inclusive_subtree(DOM::Node& dom_node)
+{
+    dom_node.for_each_in_inclusive_subtree([&](auto& node) {
+        node.set_needs_layout_tree_update(false, DOM::SetNeedsLayoutTreeUpdateReason::None);
+        node.set_child_needs_layout_tree_update(false);
+        // NB: Called during layout tree construction.
+        auto layout_node = node.unsafe_layout_node();
+        // SVGPatternBox, SVGMaskBox, and SVGClipBox are created on behalf of a referencing
+        // element and attached to that element's layout subtree. Skip them so they survive cleanup of their
+        // DOM ancestor.
+        if (layout_node && (is<SVGPatternBox>(*layout_node) || is<SVGMaskBox>(*layout_node) || is<SVGClipBox>(*layout_node)))
+            return TraversalDecision::SkipChildrenAndContinue;
+        if (layout_node && layout_node->parent()) {
+            layout_node->remove();
+        }
+        node.detach_layout_node({});
+        node.clear_paintable();
+        if (is<DOM::Element>(node))
+            static_cast<DOM::Element&>(node).clear_pseudo_element_nodes({});
+        return TraversalDecision::Continue;
+    });
+}
+
 void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context& context, MustCreateSubtree must_create_subtree)
 {
     // NB: Called during layout tree construction.
@@ -597,27 +621,8 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     ScopeGuard remove_stale_layout_node_guard = [&] {
         // If we didn't create a layout node for this DOM node,
         // go through the DOM tree and remove any old layout & paint nodes since they are now all stale.
-        if (!layout_node) {
-            dom_node.for_each_in_inclusive_subtree([&](auto& node) {
-                node.set_needs_layout_tree_update(false, DOM::SetNeedsLayoutTreeUpdateReason::None);
-                node.set_child_needs_layout_tree_update(false);
-                // NB: Called during layout tree construction.
-                auto layout_node = node.unsafe_layout_node();
-                // SVGPatternBox, SVGMaskBox, and SVGClipBox are created on behalf of a referencing
-                // element and attached to that element's layout subtree. Skip them so they survive cleanup of their
-                // DOM ancestor.
-                if (layout_node && (is<SVGPatternBox>(*layout_node) || is<SVGMaskBox>(*layout_node) || is<SVGClipBox>(*layout_node)))
-                    return TraversalDecision::SkipChildrenAndContinue;
-                if (layout_node && layout_node->parent()) {
-                    layout_node->remove();
-                }
-                node.detach_layout_node({});
-                node.clear_paintable();
-                if (is<DOM::Element>(node))
-                    static_cast<DOM::Element&>(node).clear_pseudo_element_nodes({});
-                return TraversalDecision::Continue;
-            });
-        }
+        if (!layout_node)
+            remove_stale_layout_nodes_in_inclusive_subtree(dom_node);
     };
 
     if (dom_node.is_svg_container()) {
@@ -718,10 +723,14 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     auto* dom_element = as_if<DOM::Element>(dom_node);
     auto shadow_root = dom_element ? dom_element->shadow_root() : nullptr;
 
-    auto element_has_content_visibility_hidden = [&dom_node]() {
+    // https://drafts.csswg.org/css-contain-2/#skips-its-contents
+    // NB: Skipped contents don't get any layout nodes, so they are neither laid out, painted nor hit tested.
+    auto element_skips_its_contents = [&dom_node]() {
         if (is<DOM::Element>(dom_node)) {
             auto& element = static_cast<DOM::Element&>(dom_node);
-            return element.computed_properties()->content_visibility() == CSS::ContentVisibility::Hidden;
+            auto skips_its_contents = element.skips_its_contents();
+            element.set_contents_skipped_in_layout_tree(skips_its_contents);
+            return skips_its_contents;
         }
         return false;
     }();
@@ -735,11 +744,11 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
             CSS::resolve_counters(element_reference);
         }
 
-        update_layout_tree_before_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_before_children(dom_node, *layout_node, context, element_skips_its_contents);
     }
 
     if (should_create_layout_node || dom_node.child_needs_layout_tree_update()) {
-        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_skips_its_contents) {
             push_parent(as<NodeWithStyle>(*layout_node));
             if (shadow_root) {
                 // For replaced elements with shadow DOM children, wrap the children in an
@@ -774,13 +783,22 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
                 }
             }
             pop_parent();
+        } else if (element_skips_its_contents) {
+            for (auto* child = as<DOM::ParentNode>(dom_node).first_child(); child; child = child->next_sibling())
+                remove_stale_layout_nodes_in_inclusive_subtree(*child);
+            if (shadow_root) {
+                for (auto* child = shadow_root->first_child(); child; child = child->next_sibling())
+                    remove_stale_layout_nodes_in_inclusive_subtree(*child);
+                shadow_root->set_child_needs_layout_tree_update(false);
+                shadow_root->set_needs_layout_tree_update(false, DOM::SetNeedsLayoutTreeUpdateReason::None);
+            }
         }
     }
 
     if (is<HTML::HTMLSlotElement>(dom_node)) {
         auto& slot_element = static_cast<HTML::HTMLSlotElement&>(dom_node);
 
-        if (slot_element.computed_properties()->content_visibility() != CSS::ContentVisibility::Hidden) {
+        if (!element_skips_its_contents) {
             auto slottables = slot_element.assigned_nodes_internal();
             push_parent(as<NodeWithStyle>(*layout_node));
 
@@ -797,7 +815,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     }
 
     if (should_create_layout_node) {
-        update_layout_tree_after_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_after_children(dom_node, *layout_node, context, element_skips_its_contents);
         wrap_in_button_layout_tree_if_needed(dom_node, *layout_node);
 
         // If we completely finished inserting a block level element into an inline parent, we need to fix up the tree so
@@ -863,10 +881,10 @@ void TreeBuilder::wrap_in_button_layout_tree_if_needed(DOM::Node& dom_node, GC::
     }
 }
 
-void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_skips_its_contents)
 {
     // Add node for the ::before pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::PseudoElement::Before, AppendOrPrepend::Prepend);
@@ -875,7 +893,7 @@ void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Re
     }
 }
 
-void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_skips_its_contents)
 {
     if (is<SVG::SVGGraphicsElement>(dom_node)) {
         auto& graphics_element = static_cast<SVG::SVGGraphicsElement&>(dom_node);
@@ -930,7 +948,7 @@ void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref
     }
 
     // Add nodes for the ::after pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
 
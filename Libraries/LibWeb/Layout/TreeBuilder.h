@@ -27,8 +27,8 @@ private:
 
     i32 calculate_list_item_index(DOM::Node&);
 
-    void update_layout_tree_before_children(DOM::Node&, GC::Ref<Layout::Node>, Context&, bool element_has_content_visibility_hidden);
-    void update_layout_tree_after_children(DOM::Node&, GC::Ref<Layout::Node>, Context&, bool element_has_content_visibility_hidden);
+    void update_layout_tree_before_children(DOM::Node&, GC::Ref<Layout::Node>, Context&, bool element_skips_its_contents);
+    void update_layout_tree_after_children(DOM::Node&, GC::Ref<Layout::Node>, Context&, bool element_skips_its_contents);
     void wrap_in_button_layout_tree_if_needed(DOM::Node&, GC::Ref<Layout::Node>);
     enum class MustCreateSubtree {
         No,
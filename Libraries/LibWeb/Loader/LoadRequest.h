@@ -45,6 +45,9 @@ public:
     Optional<Fetch::Infrastructure::Request::InitiatorType> const& initiator_type() const { return m_initiator_type; }
     void set_initiator_type(Optional<Fetch::Infrastructure::Request::InitiatorType> initiator_type) { m_initiator_type = move(initiator_type); }
 
+    RequestServer::RequestPriority priority() const { return m_priority; }
+    void set_priority(RequestServer::RequestPriority priority) { m_priority = priority; }
+
     void start_timer() { m_load_timer.start(); }
     AK::Duration load_time() const { return m_load_timer.elapsed_time(); }
 
@@ -63,6 +66,7 @@ private:
     HTTP::CacheMode m_cache_mode { HTTP::CacheMode::Default };
     HTTP::Cookie::IncludeCredentials m_include_credentials { HTTP::Cookie::IncludeCredentials::Yes };
     Optional<Fetch::Infrastructure::Request::InitiatorType> m_initiator_type;
+    RequestServer::RequestPriority m_priority { RequestServer::RequestPriority::Medium };
 };
 
 }
@@ -109,17 +109,26 @@ static ByteString sanitized_url_for_logging(URL::URL const& url)
     return url.to_byte_string();
 }
 
-static void store_response_cookies(Page& page, URL::URL const& url, StringView set_cookie_entry)
+static void store_response_cookies(Page& page, URL::URL const& url, HTTP::HeaderList const& response_headers)
 {
-    auto decoded_cookie = String::from_utf8(set_cookie_entry);
-    if (decoded_cookie.is_error())
-        return;
+    Vector<HTTP::Cookie::ParsedCookie> cookies;
 
-    auto cookie = HTTP::Cookie::parse_cookie(url, decoded_cookie.value());
-    if (!cookie.has_value())
-        return;
+    for (auto const& [header, value] : response_headers) {
+        if (!header.equals_ignoring_ascii_case("Set-Cookie"sv))
+            continue;
 
-    page.client().page_did_set_cookie(url, cookie.value(), HTTP::Cookie::Source::Http);
+        auto decoded_cookie = String::from_utf8(value);
+        if (decoded_cookie.is_error())
+            continue;
+
+        if (auto cookie = HTTP::Cookie::parse_cookie(url, decoded_cookie.value()); cookie.has_value())
+            cookies.append(cookie.release_value());
+    }
+
+    // OPTIMIZATION: Storing cookies is a synchronous round-trip to the UI process, so we store all of a response's
+    //               cookies at once.
+    if (!cookies.is_empty())
+        page.client().page_did_set_cookies(url, cookies, HTTP::Cookie::Source::Http);
 }
 
 static NonnullRefPtr<HTTP::HeaderList> response_headers_for_file(StringView path, Optional<time_t> const& modified_time)
@@ -476,7 +485,7 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
         return nullptr;
     }
 
-    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), request.headers(), request.body(), request.cache_mode(), request.include_credentials(), proxy);
+    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), request.headers(), request.body(), request.cache_mode(), request.include_credentials(), proxy, request.priority());
     if (!protocol_request) {
         log_failure(request, "Failed to initiate load"sv);
         return nullptr;
@@ -510,11 +519,7 @@ void ResourceLoader::handle_network_response_headers(LoadRequest const& request,
         // From https://fetch.spec.whatwg.org/#concept-http-network-fetch:
         // 15. If includeCredentials is true, then the user agent should parse and store response
         //     `Set-Cookie` headers given request and response.
-        for (auto const& [header, value] : response_headers) {
-            if (header.equals_ignoring_ascii_case("Set-Cookie"sv)) {
-                store_response_cookies(*request.page(), request.url().value(), value);
-            }
-        }
+        store_response_cookies(*request.page(), request.url().value(), response_headers);
     }
 }
 
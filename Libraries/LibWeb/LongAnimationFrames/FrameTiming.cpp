@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/Navigable.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
+#include <LibWeb/LongAnimationFrames/PerformanceLongAnimationFrameTiming.h>
+
+namespace Web::LongAnimationFrames {
+
+// https://w3c.github.io/long-animation-frames/#record-task-start-time
+void record_task_start_time(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp unsafe_task_start_time)
+{
+    auto& timing_info = document.current_frame_timing_info();
+
+    // 1. If document's current frame timing info is null, set it to a new frame timing info whose start time is
+    //    unsafeTaskStartTime.
+    if (!timing_info.has_value())
+        timing_info = FrameTimingInfo { .start_time = unsafe_task_start_time };
+
+    // 2. Set document's current frame timing info's current task start time to unsafeTaskStartTime.
+    timing_info->current_task_start_time = unsafe_task_start_time;
+}
+
+// NB: We only update the rendering of documents when something about them changed, so a frame has to end with its last
+//     task if nothing is left to render. Otherwise, the idle time until the next rendering update would be included.
+static bool updating_the_rendering_would_have_no_visible_effect(DOM::Document& document)
+{
+    if (document.hidden())
+        return true;
+
+    auto navigable = document.navigable();
+    if (!navigable || !navigable->has_a_rendering_opportunity())
+        return true;
+
+    if (auto window = document.window(); window && window->has_animation_frame_callbacks())
+        return false;
+
+    return !document.needs_style_update()
+        && !document.child_needs_style_update()
+        && document.layout_is_up_to_date()
+        && !navigable->needs_repaint();
+}
+
+// https://w3c.github.io/long-animation-frames/#record-task-end-time
+void record_task_end_time(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp unsafe_task_end_time)
+{
+    // 1. Let timingInfo be document's current frame timing info.
+    auto& timing_info = document.current_frame_timing_info();
+
+    // 2. If timingInfo is null, then return.
+    if (!timing_info.has_value())
+        return;
+
+    // 3. Append unsafeTaskEndTime minus timingInfo's current task start time to timingInfo's task durations.
+    timing_info->task_durations.append(unsafe_task_end_time - timing_info->current_task_start_time);
+
+    // 4. If the user agent believes that updating the rendering of document's node navigable would have no visible
+    //    effect, then flush frame timing given document.
+    if (updating_the_rendering_would_have_no_visible_effect(document))
+        flush_frame_timing(document);
+}
+
+// https://w3c.github.io/long-animation-frames/#record-rendering-time
+void record_rendering_time(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp unsafe_rendering_start_time, HighResolutionTime::DOMHighResTimeStamp unsafe_style_and_layout_start_time)
+{
+    auto& timing_info = document.current_frame_timing_info();
+
+    // 1. If document's current frame timing info is null, set it to a new frame timing info whose start time is
+    //    unsafeRenderingStartTime.
+    // NB: This is the case for documents that are rendered without having run a task of their own, e.g. iframes
+    //     running animations.
+    if (!timing_info.has_value())
+        timing_info = FrameTimingInfo { .start_time = unsafe_rendering_start_time };
+
+    // 2. Set timingInfo's update the rendering start time to unsafeRenderingStartTime.
+    timing_info->update_the_rendering_start_time = unsafe_rendering_start_time;
+
+    // 3. Set timingInfo's style and layout start time to unsafeStyleAndLayoutStartTime.
+    timing_info->style_and_layout_start_time = unsafe_style_and_layout_start_time;
+}
+
+// https://w3c.github.io/long-animation-frames/#flush-frame-timing
+void flush_frame_timing(DOM::Document& document)
+{
+    // 1. Let timingInfo be document's current frame timing info.
+    // 2. Set document's current frame timing info to null.
+    // 3. If timingInfo is null, then return.
+    auto& current_frame_timing_info = document.current_frame_timing_info();
+    if (!current_frame_timing_info.has_value())
+        return;
+    auto timing_info = current_frame_timing_info.release_value();
+
+    // 4. Set timingInfo's end time to the unsafe shared current time.
+    timing_info.end_time = HighResolutionTime::unsafe_shared_current_time();
+
+    // 5. If timingInfo's end time minus timingInfo's start time is less than the long animation frame duration
+    //    threshold, then return.
+    if (timing_info.end_time - timing_info.start_time < long_animation_frame_duration_threshold)
+        return;
+
+    // 6. Let global be document's relevant global object.
+    auto window = document.window();
+    if (!window)
+        return;
+
+    // 7. Let entry be a new PerformanceLongAnimationFrameTiming in global's realm, whose frame timing info is timingInfo.
+    auto entry = PerformanceLongAnimationFrameTiming::create(window->realm(), timing_info);
+
+    // 8. Queue a performance entry entry.
+    window->queue_performance_entry(entry);
+    window->add_performance_entry(entry, HTML::WindowOrWorkerGlobalScopeMixin::CheckIfPerformanceBufferIsFull::Yes);
+}
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Vector.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
+
+namespace Web::LongAnimationFrames {
+
+// https://w3c.github.io/long-animation-frames/#frame-timing-info
+// NB: All of these times are unsafe shared current times, which are only made relative to the time origin of a global
+//     once they are exposed through a PerformanceLongAnimationFrameTiming.
+struct FrameTimingInfo {
+    HighResolutionTime::DOMHighResTimeStamp start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp current_task_start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp update_the_rendering_start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp style_and_layout_start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp end_time { 0 };
+    Vector<HighResolutionTime::DOMHighResTimeStamp> task_durations;
+
+    // FIXME: first UI event timestamp, scripts and pending script.
+};
+
+// https://w3c.github.io/long-animation-frames/#long-animation-frame-duration-threshold
+static constexpr HighResolutionTime::DOMHighResTimeStamp long_animation_frame_duration_threshold = 50;
+
+// https://w3c.github.io/long-animation-frames/#record-task-start-time
+void record_task_start_time(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp unsafe_task_start_time);
+
+// https://w3c.github.io/long-animation-frames/#record-task-end-time
+void record_task_end_time(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp unsafe_task_end_time);
+
+// https://w3c.github.io/long-animation-frames/#record-rendering-time
+void record_rendering_time(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp unsafe_rendering_start_time, HighResolutionTime::DOMHighResTimeStamp unsafe_style_and_layout_start_time);
+
+// https://w3c.github.io/long-animation-frames/#flush-frame-timing
+void flush_frame_timing(DOM::Document&);
+
+}
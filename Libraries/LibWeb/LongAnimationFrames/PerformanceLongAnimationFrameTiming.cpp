@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PerformanceLongAnimationFrameTimingPrototype.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/LongAnimationFrames/PerformanceLongAnimationFrameTiming.h>
+#include <LibWeb/PerformanceTimeline/EntryTypes.h>
+
+namespace Web::LongAnimationFrames {
+
+GC_DEFINE_ALLOCATOR(PerformanceLongAnimationFrameTiming);
+
+// https://w3c.github.io/long-animation-frames/#long-task-duration-threshold
+static constexpr HighResolutionTime::DOMHighResTimeStamp long_task_duration_threshold = 50;
+
+// https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-blockingduration
+static HighResolutionTime::DOMHighResTimeStamp compute_blocking_duration(FrameTimingInfo const& timing_info)
+{
+    // 1. Let sortedTaskDurations be timingInfo's task durations.
+    auto task_durations = timing_info.task_durations;
+
+    // 2. If timingInfo's update the rendering start time is not zero, then:
+    if (timing_info.update_the_rendering_start_time != 0) {
+        // 1. Let renderDuration be timingInfo's end time minus timingInfo's update the rendering start time.
+        auto render_duration = timing_info.end_time - timing_info.update_the_rendering_start_time;
+
+        // 2. Increment the last item of taskDurations by renderDuration, or append it if taskDurations is empty.
+        if (task_durations.is_empty())
+            task_durations.append(render_duration);
+        else
+            task_durations.last() += render_duration;
+    }
+
+    // 3. Let totalBlockingDuration be 0.
+    HighResolutionTime::DOMHighResTimeStamp total_blocking_duration = 0;
+
+    // 4. For each duration in taskDurations, if duration is greater than the long task duration threshold, increment
+    //    totalBlockingDuration by duration minus the long task duration threshold.
+    for (auto duration : task_durations) {
+        if (duration > long_task_duration_threshold)
+            total_blocking_duration += duration - long_task_duration_threshold;
+    }
+
+    // 5. Return totalBlockingDuration.
+    return total_blocking_duration;
+}
+
+GC::Ref<PerformanceLongAnimationFrameTiming> PerformanceLongAnimationFrameTiming::create(JS::Realm& realm, FrameTimingInfo const& timing_info)
+{
+    auto& global = realm.global_object();
+
+    auto relative_time = [&](HighResolutionTime::DOMHighResTimeStamp unsafe_time) -> HighResolutionTime::DOMHighResTimeStamp {
+        if (unsafe_time == 0)
+            return 0;
+        return HighResolutionTime::relative_high_resolution_time(unsafe_time, global);
+    };
+
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-starttime
+    auto start_time = relative_time(timing_info.start_time);
+
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-duration
+    auto duration = relative_time(timing_info.end_time) - start_time;
+
+    return realm.create<PerformanceLongAnimationFrameTiming>(
+        realm,
+        start_time,
+        duration,
+        relative_time(timing_info.update_the_rendering_start_time),
+        relative_time(timing_info.style_and_layout_start_time),
+        compute_blocking_duration(timing_info));
+}
+
+PerformanceLongAnimationFrameTiming::PerformanceLongAnimationFrameTiming(JS::Realm& realm, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, HighResolutionTime::DOMHighResTimeStamp render_start, HighResolutionTime::DOMHighResTimeStamp style_and_layout_start, HighResolutionTime::DOMHighResTimeStamp blocking_duration)
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-name
+    : PerformanceTimeline::PerformanceEntry(realm, PerformanceTimeline::EntryTypes::long_animation_frame.to_string(), start_time, duration)
+    , m_render_start(render_start)
+    , m_style_and_layout_start(style_and_layout_start)
+    , m_blocking_duration(blocking_duration)
+{
+}
+
+PerformanceLongAnimationFrameTiming::~PerformanceLongAnimationFrameTiming() = default;
+
+// https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-entrytype
+FlyString const& PerformanceLongAnimationFrameTiming::entry_type() const
+{
+    return PerformanceTimeline::EntryTypes::long_animation_frame;
+}
+
+void PerformanceLongAnimationFrameTiming::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(PerformanceLongAnimationFrameTiming);
+    Base::initialize(realm);
+}
+
+}
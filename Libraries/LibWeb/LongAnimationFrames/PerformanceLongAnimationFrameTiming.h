@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::LongAnimationFrames {
+
+// https://w3c.github.io/long-animation-frames/#performancelonganimationframetiming
+class PerformanceLongAnimationFrameTiming final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(PerformanceLongAnimationFrameTiming, PerformanceTimeline::PerformanceEntry);
+    GC_DECLARE_ALLOCATOR(PerformanceLongAnimationFrameTiming);
+
+public:
+    static GC::Ref<PerformanceLongAnimationFrameTiming> create(JS::Realm&, FrameTimingInfo const&);
+
+    virtual ~PerformanceLongAnimationFrameTiming();
+
+    // NOTE: These three functions are answered by the registry for the given entry type.
+    // https://w3c.github.io/timing-entrytypes-registry/#registry
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-availablefromtimeline
+    static PerformanceTimeline::AvailableFromTimeline available_from_timeline() { return PerformanceTimeline::AvailableFromTimeline::No; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-maxbuffersize
+    static Optional<u64> max_buffer_size() { return 200; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-should-add-entry
+    virtual PerformanceTimeline::ShouldAddEntry should_add_entry(Optional<PerformanceTimeline::PerformanceObserverInit const&> = {}) const override { return PerformanceTimeline::ShouldAddEntry::Yes; }
+
+    virtual FlyString const& entry_type() const override;
+
+    HighResolutionTime::DOMHighResTimeStamp render_start() const { return m_render_start; }
+    HighResolutionTime::DOMHighResTimeStamp style_and_layout_start() const { return m_style_and_layout_start; }
+    HighResolutionTime::DOMHighResTimeStamp blocking_duration() const { return m_blocking_duration; }
+
+    // FIXME: Implement the first UI event timestamp.
+    HighResolutionTime::DOMHighResTimeStamp first_ui_event_timestamp() const { return 0; }
+
+private:
+    PerformanceLongAnimationFrameTiming(JS::Realm&, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, HighResolutionTime::DOMHighResTimeStamp render_start, HighResolutionTime::DOMHighResTimeStamp style_and_layout_start, HighResolutionTime::DOMHighResTimeStamp blocking_duration);
+
+    virtual void initialize(JS::Realm&) override;
+
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-renderstart
+    HighResolutionTime::DOMHighResTimeStamp m_render_start { 0 };
+
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-styleandlayoutstart
+    HighResolutionTime::DOMHighResTimeStamp m_style_and_layout_start { 0 };
+
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-blockingduration
+    HighResolutionTime::DOMHighResTimeStamp m_blocking_duration { 0 };
+};
+
+}
@@ -38,6 +38,9 @@ VisualContextIndex AccumulatedVisualContextTree::append(VisualContextData data,
         empty_clip = data.get<ClipPathData>().path.bounding_box().is_empty();
     }
 
+    if (auto const* effects = data.get_pointer<EffectsData>(); effects && effects->gfx_filter.has_value())
+        m_has_filters = true;
+
     auto index = VisualContextIndex(m_nodes.size());
     m_nodes.append({ move(data), parent_index, depth, empty_clip });
     return index;
@@ -89,6 +89,7 @@ public:
     VisualContextIndex append(VisualContextData data, VisualContextIndex parent_index);
 
     AccumulatedVisualContextNode const& node_at(VisualContextIndex index) const { return m_nodes[index.value()]; }
+    size_t node_count() const { return m_nodes.size(); }
 
     VisualContextIndex find_common_ancestor(VisualContextIndex a, VisualContextIndex b) const;
     Optional<Gfx::FloatPoint> transform_point_for_hit_test(VisualContextIndex, Gfx::FloatPoint, ScrollStateSnapshot const&) const;
@@ -99,12 +100,16 @@ public:
     bool is_effect(VisualContextIndex i) const { return m_nodes[i.value()].data.has<EffectsData>(); }
     bool has_empty_effective_clip(VisualContextIndex i) const { return m_nodes[i.value()].has_empty_effective_clip; }
 
+    // Whether any context applies a filter, which makes the pixels it produces depend on their surroundings.
+    bool has_filters() const { return m_has_filters; }
+
 private:
     AccumulatedVisualContextTree() = default;
 
     Vector<size_t, 8> build_ancestor_chain(VisualContextIndex index) const;
 
     Vector<AccumulatedVisualContextNode> m_nodes;
+    bool m_has_filters { false };
 };
 
 }
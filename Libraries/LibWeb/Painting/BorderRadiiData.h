@@ -22,6 +22,8 @@ struct CornerRadius {
     {
         return horizontal_radius > 0 && vertical_radius > 0;
     }
+
+    bool operator==(CornerRadius const&) const = default;
 };
 
 struct WEB_API BorderRadiusData {
@@ -55,6 +57,8 @@ struct CornerRadii {
         return top_left || top_right || bottom_right || bottom_left;
     }
 
+    bool operator==(CornerRadii const&) const = default;
+
     void adjust_corners_for_spread_distance(int spread_distance);
 
     bool contains(Gfx::IntPoint point, Gfx::IntRect const& rect) const
@@ -33,7 +33,16 @@ void CanvasPaintable::paint(DisplayListRecordingContext& context, PaintPhase pha
         ScopedCornerRadiusClip corner_clip { context, canvas_rect, normalized_border_radii_data(ShrinkRadiiForBorders::Yes) };
 
         auto& canvas_element = as<HTML::HTMLCanvasElement>(*dom_node());
-        if (canvas_element.surface()) {
+        if (canvas_element.is_placeholder()) {
+            // NB: The frames of a placeholder canvas element are published to its ExternalContentSource as they arrive
+            //     from its OffscreenCanvas.
+            auto& mutable_canvas_element = const_cast<HTML::HTMLCanvasElement&>(canvas_element);
+            auto canvas_int_rect = canvas_rect.to_type<int>();
+            auto scaling_mode = to_gfx_scaling_mode(computed_values().image_rendering(),
+                canvas_element.bitmap_size_for_canvas(), canvas_int_rect.size());
+            context.display_list_recorder().draw_external_content(canvas_int_rect,
+                mutable_canvas_element.ensure_external_content_source(), scaling_mode);
+        } else if (canvas_element.surface()) {
             // present() snapshots the surface and publishes to ExternalContentSource.
             // FIXME: Remove this const_cast.
             auto& mutable_canvas_element = const_cast<HTML::HTMLCanvasElement&>(canvas_element);
@@ -5,6 +5,7 @@
  */
 
 #include <AK/TemporaryChange.h>
+#include <LibCore/Tracing.h>
 #include <LibGfx/PaintingSurface.h>
 #include <LibWeb/Painting/DisplayList.h>
 
@@ -14,10 +15,85 @@ bool DisplayList::append(DisplayListCommand&& command, VisualContextIndex contex
 {
     if (context_index.value() && m_visual_context_tree->has_empty_effective_clip(context_index))
         return false;
+    if (command.has<DrawExternalContent>())
+        m_has_external_content = true;
+    else if (auto const* nested = command.get_pointer<PaintNestedDisplayList>(); nested && nested->display_list && nested->display_list->has_external_content())
+        m_has_external_content = true;
+    if (command.has<ApplyBackdropFilter>())
+        m_has_filters = true;
+    else if (auto const* effects = command.get_pointer<ApplyEffects>(); effects && effects->filter.has_value())
+        m_has_filters = true;
+    else if (auto const* nested = command.get_pointer<PaintNestedDisplayList>(); nested && nested->display_list && nested->display_list->has_filters())
+        m_has_filters = true;
     m_commands.append({ context_index, move(command) });
     return true;
 }
 
+// Drops a Save or SaveLayer at the end of `items` that would be restored before anything is drawn, along with the clips
+// and translations added after it.
+static bool remove_empty_save(Vector<DisplayList::CommandListItem>& items, VisualContextIndex context_index)
+{
+    for (size_t i = items.size(); i > 0; --i) {
+        auto const& item = items[i - 1];
+        if (item.context_index != context_index)
+            return false;
+        if (item.command.has<Save>() || item.command.has<SaveLayer>()) {
+            items.shrink(i - 1);
+            return true;
+        }
+        if (!item.command.has<AddClipRect>() && !item.command.has<AddRoundedRectClip>() && !item.command.has<Translate>())
+            return false;
+    }
+    return false;
+}
+
+// Folds the FillRect in `item` into the one in `previous`, if painting the result produces the same pixels as painting
+// both of them.
+static bool merge_into_previous_fill_rect(DisplayList::CommandListItem& previous, DisplayList::CommandListItem const& item)
+{
+    auto* previous_fill = previous.command.get_pointer<FillRect>();
+    if (!previous_fill || previous.context_index != item.context_index)
+        return false;
+
+    auto const& fill = item.command.get<FillRect>();
+    bool is_opaque = fill.color.alpha() == 255;
+    if (is_opaque && fill.rect.contains(previous_fill->rect)) {
+        *previous_fill = fill;
+        return true;
+    }
+    if (previous_fill->color != fill.color)
+        return false;
+    if (is_opaque && previous_fill->rect.contains(fill.rect))
+        return true;
+
+    // NB: Translucent fills can only be merged if they don't overlap, as the overlap would be blended twice otherwise.
+    auto const& a = previous_fill->rect;
+    auto const& b = fill.rect;
+    bool share_horizontal_edge = a.y() == b.y() && a.height() == b.height() && (a.right() == b.left() || b.right() == a.left());
+    bool share_vertical_edge = a.x() == b.x() && a.width() == b.width() && (a.bottom() == b.top() || b.bottom() == a.top());
+    if (!share_horizontal_edge && !share_vertical_edge)
+        return false;
+    previous_fill->rect = a.united(b);
+    return true;
+}
+
+void DisplayList::remove_redundant_commands()
+{
+    Vector<CommandListItem> items;
+    items.ensure_capacity(m_commands.size());
+    for (auto& item : m_commands) {
+        if (item.command.has<Restore>() && remove_empty_save(items, item.context_index))
+            continue;
+        if (item.command.has<FillRect>() && !items.is_empty() && merge_into_previous_fill_rect(items.last(), item))
+            continue;
+        items.append(move(item));
+    }
+
+    m_commands = {};
+    for (auto& item : items)
+        m_commands.append(move(item));
+}
+
 static Optional<Gfx::IntRect> command_bounding_rectangle(DisplayListCommand const& command)
 {
     return command.visit(
@@ -40,15 +116,137 @@ static bool command_is_clip(DisplayListCommand const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
+// NB: Only commands that are common in mostly static content are compared. Any other command is considered to have
+//     changed, which is always safe.
+static bool commands_are_identical(DisplayList::CommandListItem const& a, DisplayList::CommandListItem const& b)
+{
+    if (a.context_index != b.context_index || a.command.index() != b.command.index())
+        return false;
+
+    return a.command.visit(
+        [&](DrawGlyphRun const& command) {
+            auto const& other = b.command.get<DrawGlyphRun>();
+            // NB: Glyph runs are created anew by every layout, but identical ones share the same text blob.
+            auto same_glyphs = command.glyph_run.ptr() == other.glyph_run.ptr()
+                || (command.glyph_run->cached_skia_text_blob() && command.glyph_run->cached_skia_text_blob() == other.glyph_run->cached_skia_text_blob());
+            return same_glyphs && command.rect == other.rect && command.translation == other.translation && command.color == other.color && command.orientation == other.orientation;
+        },
+        [&](FillRect const& command) {
+            auto const& other = b.command.get<FillRect>();
+            return command.rect == other.rect && command.color == other.color;
+        },
+        [&](FillRectWithRoundedCorners const& command) {
+            auto const& other = b.command.get<FillRectWithRoundedCorners>();
+            return command.rect == other.rect && command.color == other.color && command.corner_radii == other.corner_radii;
+        },
+        [&](DrawScaledImmutableBitmap const& command) {
+            auto const& other = b.command.get<DrawScaledImmutableBitmap>();
+            return command.dst_rect == other.dst_rect && command.clip_rect == other.clip_rect && command.bitmap.ptr() == other.bitmap.ptr() && command.scaling_mode == other.scaling_mode;
+        },
+        [&](DrawRect const& command) {
+            auto const& other = b.command.get<DrawRect>();
+            return command.rect == other.rect && command.color == other.color && command.rough == other.rough;
+        },
+        [&](DrawLine const& command) {
+            auto const& other = b.command.get<DrawLine>();
+            return command.color == other.color && command.from == other.from && command.to == other.to && command.thickness == other.thickness && command.style == other.style && command.alternate_color == other.alternate_color;
+        },
+        [&](AddClipRect const& command) {
+            return command.rect == b.command.get<AddClipRect>().rect;
+        },
+        [&](AddRoundedRectClip const& command) {
+            auto const& other = b.command.get<AddRoundedRectClip>();
+            return command.corner_radii == other.corner_radii && command.border_rect == other.border_rect && command.corner_clip == other.corner_clip;
+        },
+        [&](Translate const& command) {
+            return command.delta == b.command.get<Translate>().delta;
+        },
+        [&](Save const&) { return true; },
+        [&](Restore const&) { return true; },
+        [&](PaintNestedDisplayList const& command) {
+            auto const& other = b.command.get<PaintNestedDisplayList>();
+            return command.display_list.ptr() == other.display_list.ptr() && command.rect == other.rect;
+        },
+        [&](PaintScrollBar const& command) {
+            auto const& other = b.command.get<PaintScrollBar>();
+            return command.scroll_frame_index == other.scroll_frame_index && command.gutter_rect == other.gutter_rect && command.thumb_rect == other.thumb_rect && command.scroll_size == other.scroll_size && command.thumb_color == other.thumb_color && command.track_color == other.track_color && command.vertical == other.vertical;
+        },
+        [&](auto const&) { return false; });
+}
+
+// Returns the device rectangle that a changed command paints into, or nothing if it has an effect beyond its bounding
+// rectangle (such as a clip or a save) or lives in a context whose mapping to the viewport we can't bound.
+static Optional<Gfx::IntRect> damage_rect_for_changed_command(DisplayList::CommandListItem const& item, AccumulatedVisualContextTree const& visual_context_tree, ScrollStateSnapshot const& scroll_state)
+{
+    if (command_is_clip(item.command))
+        return {};
+    auto bounding_rect = command_bounding_rectangle(item.command);
+    if (!bounding_rect.has_value())
+        return {};
+
+    for (auto index = item.context_index; index.value(); index = visual_context_tree.node_at(index).parent_index) {
+        if (visual_context_tree.node_at(index).data.has<PerspectiveData>())
+            return {};
+    }
+
+    // NB: Changed pixels are antialiased against their surroundings, so include a pixel around them.
+    auto rect = visual_context_tree.transform_rect_to_viewport(item.context_index, bounding_rect->to_type<float>(), scroll_state);
+    return Gfx::enclosing_int_rect(rect).inflated(2, 2);
+}
+
+Optional<Gfx::IntRect> DisplayList::damage_rect_since(DisplayList const& previous, ScrollStateSnapshot const& scroll_state) const
 {
+    // NB: Filters and external content can change pixels without any command changing, and indices into different
+    //     visual context trees can't be compared.
+    if (m_visual_context_tree.ptr() != previous.m_visual_context_tree.ptr() || m_visual_context_tree->has_filters())
+        return {};
+    if (m_has_filters || previous.m_has_filters || m_has_external_content || previous.m_has_external_content)
+        return {};
+
+    auto const& commands = m_commands;
+    auto const& previous_commands = previous.m_commands;
+    auto common_size = min(commands.size(), previous_commands.size());
+
+    size_t prefix_size = 0;
+    while (prefix_size < common_size && commands_are_identical(commands[prefix_size], previous_commands[prefix_size]))
+        ++prefix_size;
+
+    size_t suffix_size = 0;
+    while (suffix_size < common_size - prefix_size && commands_are_identical(commands[commands.size() - suffix_size - 1], previous_commands[previous_commands.size() - suffix_size - 1]))
+        ++suffix_size;
+
+    Gfx::IntRect damage_rect;
+    auto add_damage = [&](auto const& changed_commands, size_t end) {
+        for (size_t i = prefix_size; i < end; ++i) {
+            auto rect = damage_rect_for_changed_command(changed_commands[i], *m_visual_context_tree, scroll_state);
+            if (!rect.has_value())
+                return false;
+            damage_rect.unite(*rect);
+        }
+        return true;
+    };
+    if (!add_damage(commands, commands.size() - suffix_size) || !add_damage(previous_commands, previous_commands.size() - suffix_size))
+        return {};
+    return damage_rect;
+}
+
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> damage_rect)
+{
+    TRACE_EVENT("paint", "DisplayListPlayer::execute");
+
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
     if (surface) {
         surface->lock_context();
     }
     m_surface = surface;
     auto scroll_state_snapshot = m_scroll_state_snapshots_by_display_list.get(display_list).value_or({});
+    if (damage_rect.has_value()) {
+        save({});
+        clip_and_clear(*damage_rect);
+    }
     execute_impl(display_list, scroll_state_snapshot);
+    if (damage_rect.has_value())
+        restore({});
     if (surface)
         flush();
     m_surface = nullptr;
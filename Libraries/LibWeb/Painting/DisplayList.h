@@ -24,7 +24,8 @@ class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>);
+    // If a damage rectangle is given, only the pixels inside of it are painted, and the rest of the surface is kept.
+    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> damage_rect = {});
 
 protected:
     Gfx::PaintingSurface& surface() const { return *m_surface; }
@@ -35,6 +36,7 @@ protected:
 
 private:
     virtual void flush() = 0;
+    virtual void clip_and_clear(Gfx::IntRect) = 0;
     virtual void draw_glyph_run(DrawGlyphRun const&) = 0;
     virtual void fill_rect(FillRect const&) = 0;
     virtual void draw_scaled_immutable_bitmap(DrawScaledImmutableBitmap const&) = 0;
@@ -87,6 +89,22 @@ public:
 
     AccumulatedVisualContextTree const& visual_context_tree() const { return *m_visual_context_tree; }
 
+    // Whether this list, or a list nested in it, draws content (such as a canvas or video frame) that can change
+    // without the list being recorded again.
+    bool has_external_content() const { return m_has_external_content; }
+
+    // Whether this list, or a list nested in it, applies a filter, which may read pixels from outside of the area
+    // being painted.
+    bool has_filters() const { return m_has_filters || m_visual_context_tree->has_filters(); }
+
+    // Returns the device rectangle outside of which playing back this list produces the same pixels as playing back
+    // `previous` with the same scroll state, or nothing if that can't be determined cheaply.
+    Optional<Gfx::IntRect> damage_rect_since(DisplayList const& previous, ScrollStateSnapshot const&) const;
+
+    // Drops commands that can't affect the pixels produced by playing back this list, and merges fills that can be
+    // painted as one. Must only be called once recording has finished.
+    void remove_redundant_commands();
+
     auto& commands(Badge<DisplayListRecorder>) { return m_commands; }
     auto const& commands() const { return m_commands; }
 
@@ -98,6 +116,8 @@ private:
 
     NonnullRefPtr<AccumulatedVisualContextTree const> const m_visual_context_tree;
     AK::SegmentedVector<CommandListItem, 512> m_commands;
+    bool m_has_external_content { false };
+    bool m_has_filters { false };
 };
 
 }
@@ -15,8 +15,10 @@
 #include <core/SkMaskFilter.h>
 #include <core/SkPath.h>
 #include <core/SkPathEffect.h>
+#include <core/SkPixmap.h>
 #include <core/SkRRect.h>
 #include <core/SkSurface.h>
+#include <core/SkTextBlob.h>
 #include <effects/SkDashPathEffect.h>
 #include <effects/SkGradientShader.h>
 #include <effects/SkImageFilters.h>
@@ -25,11 +27,13 @@
 #include <gpu/ganesh/SkSurfaceGanesh.h>
 #include <pathops/SkPathOps.h>
 
+#include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/PainterSkia.h>
 #include <LibGfx/PathSkia.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibGfx/SkiaUtils.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/CSS/ComputedValues.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
 #include <LibWeb/Painting/PaintStyle.h>
@@ -44,6 +48,52 @@ DisplayListPlayerSkia::~DisplayListPlayerSkia()
 {
 }
 
+static constexpr size_t max_band_count = 4;
+static constexpr int minimum_band_height = 64;
+
+// Gradients are painted on every frame, and most of them only have a handful of color stops.
+static constexpr size_t inline_gradient_stop_count = 8;
+
+void DisplayListPlayerSkia::execute_in_parallel(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, Gfx::PaintingSurface& surface, Optional<Gfx::IntRect> damage_rect)
+{
+    auto rect_to_paint = damage_rect.value_or(surface.rect());
+    auto band_count = min(max_band_count, static_cast<size_t>(max(rect_to_paint.height() / minimum_band_height, 1)));
+
+    // NB: Filters can sample pixels from outside of the band being painted, and external content sources may not be
+    //     drawn from several threads at once, so such lists are always painted in one go.
+    SkPixmap pixmap;
+    bool can_paint_in_bands = band_count > 1
+        && !Gfx::SkiaBackendContext::the()
+        && !surface.skia_backend_context()
+        && !display_list.has_filters()
+        && !display_list.has_external_content()
+        && surface.sk_surface().peekPixels(&pixmap)
+        && pixmap.colorType() == kBGRA_8888_SkColorType
+        && pixmap.alphaType() == kPremul_SkAlphaType;
+    if (!can_paint_in_bands) {
+        execute(display_list, move(scroll_state_snapshot_by_display_list), surface, damage_rect);
+        return;
+    }
+
+    auto paint_band = [&](size_t band_index) {
+        auto top = rect_to_paint.top() + static_cast<int>(rect_to_paint.height() * band_index / band_count);
+        auto bottom = rect_to_paint.top() + static_cast<int>(rect_to_paint.height() * (band_index + 1) / band_count);
+        Gfx::IntRect band_rect { rect_to_paint.x(), top, rect_to_paint.width(), bottom - top };
+
+        // Each band is painted into a surface over its rows of the target surface, so commands that don't intersect
+        // the band are culled by the regular clip checks.
+        auto band_bitmap = MUST(Gfx::Bitmap::create_wrapper(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, { surface.size().width(), band_rect.height() }, pixmap.rowBytes(), pixmap.writable_addr(0, top)));
+        auto band_surface = Gfx::PaintingSurface::wrap_bitmap(*band_bitmap);
+        band_surface->canvas().translate(0, -top);
+
+        DisplayListPlayerSkia player;
+        player.execute(display_list, ScrollStateSnapshotByDisplayList(scroll_state_snapshot_by_display_list), band_surface, damage_rect.has_value() ? band_rect : Optional<Gfx::IntRect> {});
+    };
+
+    // Painting blocks the presentation of the next frame, so it goes ahead of any other pending work.
+    Threading::ThreadPool::the().parallel_for(band_count, paint_band, Threading::ThreadPool::Priority::High);
+}
+
 static SkRRect to_skia_rrect(auto const& rect, CornerRadii const& corner_radii)
 {
     SkRRect rrect;
@@ -98,6 +148,13 @@ void DisplayListPlayerSkia::flush()
     surface().flush();
 }
 
+void DisplayListPlayerSkia::clip_and_clear(Gfx::IntRect rect)
+{
+    auto& canvas = surface().canvas();
+    canvas.clipIRect(SkIRect::MakeXYWH(rect.x(), rect.y(), rect.width(), rect.height()));
+    canvas.clear(SK_ColorTRANSPARENT);
+}
+
 void DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
 {
     auto* blob = command.glyph_run->cached_skia_text_blob();
@@ -161,7 +218,12 @@ void DisplayListPlayerSkia::draw_scaled_immutable_bitmap(DrawScaledImmutableBitm
     paint.setAntiAlias(true);
     canvas.save();
     canvas.clipRect(clip_rect, true);
-    canvas.drawImageRect(command.bitmap->sk_image(), dst_rect, to_skia_sampling_options(command.scaling_mode), &paint);
+    auto const* sk_image = command.bitmap->sk_image();
+    if (command.scaling_mode == Gfx::ScalingMode::Bilinear || command.scaling_mode == Gfx::ScalingMode::BilinearMipmap) {
+        auto device_rect = canvas.getTotalMatrix().mapRect(dst_rect);
+        sk_image = command.bitmap->sk_image_for_size(Gfx::IntSize(ceilf(device_rect.width()), ceilf(device_rect.height())));
+    }
+    canvas.drawImageRect(sk_image, dst_rect, to_skia_sampling_options(command.scaling_mode), &paint);
     canvas.restore();
 }
 
@@ -305,8 +367,8 @@ void DisplayListPlayerSkia::paint_linear_gradient(PaintLinearGradient const& com
     auto const& repeat_length = linear_gradient_data.color_stops.repeat_length;
     VERIFY(!color_stop_list.is_empty());
 
-    Vector<SkColor4f> colors;
-    Vector<SkScalar> positions;
+    Vector<SkColor4f, inline_gradient_stop_count> colors;
+    Vector<SkScalar, inline_gradient_stop_count> positions;
     auto const first_position = repeat_length.has_value() ? color_stop_list.first().position : 0.f;
     for (size_t stop_index = 0; stop_index < color_stop_list.size(); stop_index++) {
         auto const& stop = color_stop_list[stop_index];
@@ -383,15 +445,35 @@ void DisplayListPlayerSkia::paint_inner_box_shadow(PaintInnerBoxShadow const& co
 
 void DisplayListPlayerSkia::paint_text_shadow(PaintTextShadow const& command)
 {
+    DrawGlyphRun const draw_shadow_glyph_run {
+        .glyph_run = command.glyph_run,
+        .rect = command.text_rect,
+        .translation = command.draw_location + command.text_rect.location().to_type<float>(),
+        .color = command.color,
+    };
+
+    // OPTIMIZATION: A shadow that isn't blurred is just the text painted again, which doesn't need a layer.
+    auto sigma = command.blur_radius / 2;
+    if (sigma <= 0) {
+        draw_glyph_run(draw_shadow_glyph_run);
+        return;
+    }
+
+    auto* blob = command.glyph_run->cached_skia_text_blob();
+    if (!blob)
+        return;
+
+    // OPTIMIZATION: Only allocate and blur a layer the size of the text and the blur around it, instead of one the
+    //               size of the entire clip.
+    auto const& translation = draw_shadow_glyph_run.translation;
+    auto layer_bounds = blob->bounds().makeOffset(translation.x(), translation.y()).makeOutset(sigma * 3, sigma * 3);
+
     auto& canvas = surface().canvas();
-    auto blur_image_filter = SkImageFilters::Blur(command.blur_radius / 2, command.blur_radius / 2, nullptr);
+    auto blur_image_filter = SkImageFilters::Blur(sigma, sigma, nullptr);
     SkPaint blur_paint;
     blur_paint.setImageFilter(blur_image_filter);
-    canvas.saveLayer(SkCanvas::SaveLayerRec(nullptr, &blur_paint, nullptr, 0));
-    draw_glyph_run({ .glyph_run = command.glyph_run,
-        .rect = command.text_rect,
-        .translation = command.draw_location + command.text_rect.location().to_type<float>(),
-        .color = command.color });
+    canvas.saveLayer(SkCanvas::SaveLayerRec(&layer_bounds, &blur_paint, nullptr, 0));
+    draw_glyph_run(draw_shadow_glyph_run);
     canvas.restore();
 }
 
@@ -428,9 +510,9 @@ static SkPaint gradient_paint_style_to_skia_paint(Painting::SVGGradientPaintStyl
 
     auto const& color_stops = paint_style.color_stops();
 
-    Vector<SkColor> colors;
+    Vector<SkColor, inline_gradient_stop_count> colors;
     colors.ensure_capacity(color_stops.size());
-    Vector<SkScalar> positions;
+    Vector<SkScalar, inline_gradient_stop_count> positions;
     positions.ensure_capacity(color_stops.size());
 
     for (auto const& color_stop : color_stops) {
@@ -651,8 +733,8 @@ void DisplayListPlayerSkia::paint_radial_gradient(PaintRadialGradient const& com
     auto const& color_stop_list = radial_gradient_data.color_stops.list;
     VERIFY(!color_stop_list.is_empty());
 
-    Vector<SkColor4f> colors;
-    Vector<SkScalar> positions;
+    Vector<SkColor4f, inline_gradient_stop_count> colors;
+    Vector<SkScalar, inline_gradient_stop_count> positions;
     for (size_t stop_index = 0; stop_index < color_stop_list.size(); stop_index++) {
         auto const& stop = color_stop_list[stop_index];
         if (stop_index > 0 && stop == color_stop_list[stop_index - 1])
@@ -691,8 +773,8 @@ void DisplayListPlayerSkia::paint_conic_gradient(PaintConicGradient const& comma
     auto const& color_stop_list = conic_gradient_data.color_stops.list;
     VERIFY(!color_stop_list.is_empty());
 
-    Vector<SkColor4f> colors;
-    Vector<SkScalar> positions;
+    Vector<SkColor4f, inline_gradient_stop_count> colors;
+    Vector<SkScalar, inline_gradient_stop_count> positions;
     for (size_t stop_index = 0; stop_index < color_stop_list.size(); stop_index++) {
         auto const& stop = color_stop_list[stop_index];
         if (stop_index > 0 && stop == color_stop_list[stop_index - 1])
@@ -20,8 +20,13 @@ public:
     DisplayListPlayerSkia();
     ~DisplayListPlayerSkia();
 
+    // Plays back a display list like execute() does, but splits a CPU-backed surface into bands of rows that are
+    // rasterized in parallel on the thread pool, each by its own player.
+    void execute_in_parallel(DisplayList&, ScrollStateSnapshotByDisplayList&&, Gfx::PaintingSurface&, Optional<Gfx::IntRect> damage_rect = {});
+
 private:
     void flush() override;
+    void clip_and_clear(Gfx::IntRect) override;
     void draw_glyph_run(DrawGlyphRun const&) override;
     void fill_rect(FillRect const&) override;
     void draw_scaled_immutable_bitmap(DrawScaledImmutableBitmap const&) override;
@@ -86,6 +86,28 @@ void DisplayListRecorder::replay_cached_commands(ReadonlySpan<DisplayListCommand
     }
 }
 
+void DisplayListRecorder::replay_cached_commands(ReadonlySpan<DisplayList::CommandListItem> items)
+{
+    VERIFY(!m_is_capturing);
+    for (auto const& item : items) {
+        auto command_copy = item.command;
+        m_save_nesting_level += command_copy.visit([](auto const& command) -> int {
+            if constexpr (requires { command.nesting_level_change; })
+                return command.nesting_level_change;
+            return 0;
+        });
+        m_display_list.append(move(command_copy), item.context_index);
+    }
+}
+
+void DisplayListRecorder::copy_commands_since(size_t index, Vector<DisplayList::CommandListItem>& items) const
+{
+    auto const& commands = m_display_list.commands();
+    items.ensure_capacity(items.size() + commands.size() - index);
+    for (size_t i = index; i < commands.size(); ++i)
+        items.unchecked_append(commands[i]);
+}
+
 void DisplayListRecorder::paint_nested_display_list(RefPtr<DisplayList> display_list, Gfx::IntRect rect)
 {
     APPEND(PaintNestedDisplayList { move(display_list), rect });
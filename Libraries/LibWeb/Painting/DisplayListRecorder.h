@@ -23,6 +23,7 @@
 #include <LibWeb/Painting/AccumulatedVisualContext.h>
 #include <LibWeb/Painting/BorderRadiiData.h>
 #include <LibWeb/Painting/BorderRadiusCornerClipper.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/DisplayListCommand.h>
 #include <LibWeb/Painting/GradientData.h>
 #include <LibWeb/Painting/PaintStyle.h>
@@ -91,6 +92,16 @@ public:
     VisualContextIndex accumulated_visual_context() const { return m_accumulated_visual_context_index; }
 
     void replay_cached_commands(ReadonlySpan<DisplayListCommand> commands);
+    void replay_cached_commands(ReadonlySpan<DisplayList::CommandListItem> items);
+
+    AccumulatedVisualContextTree const& visual_context_tree() const { return m_display_list.visual_context_tree(); }
+    size_t command_count() const { return m_display_list.commands().size(); }
+    void copy_commands_since(size_t index, Vector<DisplayList::CommandListItem>&) const;
+
+    // Painting code that doesn't go through the per-paintable command cache reports itself here, so that the stacking
+    // context it is painted in knows not to cache its commands either.
+    void note_uncached_content() { ++m_uncached_content_count; }
+    size_t uncached_content_count() const { return m_uncached_content_count; }
 
     class CommandCapture {
         AK_MAKE_NONCOPYABLE(CommandCapture);
@@ -110,6 +121,7 @@ public:
     };
 
     CommandCapture begin_command_capture();
+    bool is_capturing() const { return m_is_capturing; }
 
     void save();
     void save_layer();
@@ -154,6 +166,7 @@ private:
     DisplayList& m_display_list;
     bool m_is_capturing { false };
     Vector<DisplayListCommand> m_captured_commands;
+    size_t m_uncached_content_count { 0 };
 };
 
 class DisplayListRecorderStateSaver {
@@ -0,0 +1,1268 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitCast.h>
+#include <AK/Endian.h>
+#include <AK/HashMap.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/Typeface.h>
+#include <LibGfx/FourCC.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/TextLayout.h>
+#include <LibWeb/Painting/DisplayListSerialization.h>
+
+namespace Web::Painting {
+
+// The serialized form starts with a header, followed by tables of typefaces, fonts, glyph runs, bitmaps, visual
+// context trees and display lists, in that order. Every entry only refers to entries of earlier tables, or to earlier
+// entries of its own table. This puts nested display lists before the lists that paint them, and the root list last.
+// All numbers are stored in little-endian byte order.
+static constexpr u32 magic = 0x4c44424c; // "LBDL"
+static constexpr u16 format_version = 1;
+
+using ColorInterpolationMethod = CSS::ColorInterpolationMethodStyleValue::ColorInterpolationMethod;
+
+enum class VisualContextKind : u8 {
+    Scroll,
+    Clip,
+    Transform,
+    Perspective,
+    ClipPath,
+    Effects,
+};
+
+template<typename>
+struct CommandTypes;
+
+template<typename... Ts>
+struct CommandTypes<Variant<Ts...>> {
+    template<typename T>
+    static constexpr u8 tag_of()
+    {
+        u8 tag = 0;
+        bool found = false;
+        ((found = found || IsSame<T, Ts>, tag += found ? 0 : 1), ...);
+        return tag;
+    }
+};
+
+// Commands are identified by their position in the DisplayListCommand variant.
+template<typename T>
+static constexpr u8 command_tag = CommandTypes<DisplayListCommand>::tag_of<T>();
+
+class Encoder {
+public:
+    void encode(u8 value) { m_buffer.append(value); }
+    void encode(bool value) { encode(static_cast<u8>(value)); }
+    void encode(u16 value) { append_little_endian(value); }
+    void encode(u32 value) { append_little_endian(value); }
+    void encode(i32 value) { encode(bit_cast<u32>(value)); }
+    void encode(u64 value) { append_little_endian(value); }
+    void encode(float value) { encode(bit_cast<u32>(value)); }
+    void encode(double value) { encode(bit_cast<u64>(value)); }
+
+    template<Enum T>
+    void encode(T value)
+    {
+        encode(static_cast<u8>(to_underlying(value)));
+    }
+
+    void encode_count(size_t count)
+    {
+        VERIFY(count <= NumericLimits<u32>::max());
+        encode(static_cast<u32>(count));
+    }
+
+    void encode_bytes(ReadonlyBytes bytes)
+    {
+        encode_count(bytes.size());
+        append(bytes);
+    }
+
+    void append(ReadonlyBytes bytes) { m_buffer.append(bytes); }
+
+    void encode(Gfx::IntPoint point)
+    {
+        encode(point.x());
+        encode(point.y());
+    }
+
+    void encode(Gfx::IntSize size)
+    {
+        encode(size.width());
+        encode(size.height());
+    }
+
+    void encode(Gfx::IntRect const& rect)
+    {
+        encode(rect.location());
+        encode(rect.size());
+    }
+
+    void encode(Gfx::FloatPoint point)
+    {
+        encode(point.x());
+        encode(point.y());
+    }
+
+    void encode(DevicePixelRect const& rect)
+    {
+        encode(rect.to_type<int>());
+    }
+
+    void encode(Gfx::Color color) { encode(color.value()); }
+
+    void encode(CornerRadii const& corner_radii)
+    {
+        for (auto const& corner_radius : { corner_radii.top_left, corner_radii.top_right, corner_radii.bottom_right, corner_radii.bottom_left }) {
+            encode(corner_radius.horizontal_radius);
+            encode(corner_radius.vertical_radius);
+        }
+    }
+
+    void encode(Gfx::FloatMatrix4x4 const& matrix)
+    {
+        for (size_t row = 0; row < 4; ++row) {
+            for (size_t column = 0; column < 4; ++column)
+                encode(matrix[row, column]);
+        }
+    }
+
+    void encode(Gfx::Path const& path) { encode_bytes(path.to_bytes()); }
+
+    void encode(Optional<float> value)
+    {
+        encode(value.has_value());
+        if (value.has_value())
+            encode(*value);
+    }
+
+    void encode(ColorStopData const& color_stops)
+    {
+        encode_count(color_stops.list.size());
+        for (auto const& color_stop : color_stops.list) {
+            encode(color_stop.color);
+            encode(color_stop.position);
+            encode(color_stop.transition_hint);
+        }
+        encode(color_stops.repeat_length);
+        encode(color_stops.repeating);
+    }
+
+    void encode(ColorInterpolationMethod const& interpolation_method)
+    {
+        interpolation_method.visit(
+            [&](CSS::RectangularColorSpace color_space) {
+                encode(false);
+                encode(color_space);
+            },
+            [&](CSS::ColorInterpolationMethodStyleValue::PolarColorInterpolationMethod const& polar) {
+                encode(true);
+                encode(polar.color_space);
+                encode(polar.hue_interpolation_method);
+            });
+    }
+
+    ReadonlyBytes bytes() const { return m_buffer.bytes(); }
+    ByteBuffer release_buffer() { return move(m_buffer); }
+
+private:
+    template<typename T>
+    void append_little_endian(T value)
+    {
+        LittleEndian<T> little_endian_value = value;
+        m_buffer.append(&little_endian_value, sizeof(little_endian_value));
+    }
+
+    ByteBuffer m_buffer;
+};
+
+class Decoder {
+public:
+    explicit Decoder(ReadonlyBytes bytes)
+        : m_bytes(bytes)
+    {
+    }
+
+    bool is_at_end() const { return m_offset == m_bytes.size(); }
+
+    ErrorOr<ReadonlyBytes> read_bytes(size_t size)
+    {
+        if (size > m_bytes.size() - m_offset)
+            return Error::from_string_literal("Unexpected end of serialized display list");
+        auto bytes = m_bytes.slice(m_offset, size);
+        m_offset += size;
+        return bytes;
+    }
+
+    template<typename T>
+    ErrorOr<T> decode();
+
+    template<Enum T>
+    ErrorOr<T> decode_enum(T first, T last);
+
+    ErrorOr<ReadonlyBytes> decode_bytes();
+
+private:
+    template<typename T>
+    ErrorOr<T> read_little_endian()
+    {
+        auto bytes = TRY(read_bytes(sizeof(T)));
+        LittleEndian<T> value;
+        __builtin_memcpy(&value, bytes.data(), sizeof(T));
+        return static_cast<T>(value);
+    }
+
+    ReadonlyBytes m_bytes;
+    size_t m_offset { 0 };
+};
+
+template<>
+ErrorOr<u8> Decoder::decode()
+{
+    return TRY(read_bytes(1))[0];
+}
+
+template<>
+ErrorOr<bool> Decoder::decode()
+{
+    auto value = TRY(decode<u8>());
+    if (value > 1)
+        return Error::from_string_literal("Invalid boolean in serialized display list");
+    return value == 1;
+}
+
+template<>
+ErrorOr<u16> Decoder::decode()
+{
+    return read_little_endian<u16>();
+}
+
+template<>
+ErrorOr<u32> Decoder::decode()
+{
+    return read_little_endian<u32>();
+}
+
+template<Enum T>
+ErrorOr<T> Decoder::decode_enum(T first, T last)
+{
+    auto value = TRY(decode<u8>());
+    if (value < to_underlying(first) || value > to_underlying(last))
+        return Error::from_string_literal("Invalid enum value in serialized display list");
+    return static_cast<T>(value);
+}
+
+ErrorOr<ReadonlyBytes> Decoder::decode_bytes()
+{
+    return read_bytes(TRY(decode<u32>()));
+}
+
+template<>
+ErrorOr<i32> Decoder::decode()
+{
+    return bit_cast<i32>(TRY(decode<u32>()));
+}
+
+template<>
+ErrorOr<u64> Decoder::decode()
+{
+    return read_little_endian<u64>();
+}
+
+template<>
+ErrorOr<float> Decoder::decode()
+{
+    return bit_cast<float>(TRY(decode<u32>()));
+}
+
+template<>
+ErrorOr<double> Decoder::decode()
+{
+    return bit_cast<double>(TRY(decode<u64>()));
+}
+
+template<>
+ErrorOr<Gfx::IntPoint> Decoder::decode()
+{
+    auto x = TRY(decode<i32>());
+    auto y = TRY(decode<i32>());
+    return Gfx::IntPoint { x, y };
+}
+
+template<>
+ErrorOr<Gfx::IntSize> Decoder::decode()
+{
+    auto width = TRY(decode<i32>());
+    auto height = TRY(decode<i32>());
+    return Gfx::IntSize { width, height };
+}
+
+template<>
+ErrorOr<Gfx::IntRect> Decoder::decode()
+{
+    auto location = TRY(decode<Gfx::IntPoint>());
+    auto size = TRY(decode<Gfx::IntSize>());
+    return Gfx::IntRect { location, size };
+}
+
+template<>
+ErrorOr<Gfx::FloatPoint> Decoder::decode()
+{
+    auto x = TRY(decode<float>());
+    auto y = TRY(decode<float>());
+    return Gfx::FloatPoint { x, y };
+}
+
+template<>
+ErrorOr<DevicePixelRect> Decoder::decode()
+{
+    return TRY(decode<Gfx::IntRect>()).to_type<DevicePixels>();
+}
+
+template<>
+ErrorOr<Gfx::Color> Decoder::decode()
+{
+    return Gfx::Color::from_bgra(TRY(decode<u32>()));
+}
+
+template<>
+ErrorOr<CornerRadii> Decoder::decode()
+{
+    CornerRadii corner_radii;
+    for (auto* corner_radius : { &corner_radii.top_left, &corner_radii.top_right, &corner_radii.bottom_right, &corner_radii.bottom_left }) {
+        corner_radius->horizontal_radius = TRY(decode<i32>());
+        corner_radius->vertical_radius = TRY(decode<i32>());
+    }
+    return corner_radii;
+}
+
+template<>
+ErrorOr<Gfx::FloatMatrix4x4> Decoder::decode()
+{
+    Gfx::FloatMatrix4x4 matrix;
+    for (size_t row = 0; row < 4; ++row) {
+        for (size_t column = 0; column < 4; ++column)
+            matrix[row, column] = TRY(decode<float>());
+    }
+    return matrix;
+}
+
+template<>
+ErrorOr<Gfx::Path> Decoder::decode()
+{
+    return Gfx::Path::from_bytes(TRY(decode_bytes()));
+}
+
+template<>
+ErrorOr<Optional<float>> Decoder::decode()
+{
+    if (!TRY(decode<bool>()))
+        return Optional<float> {};
+    return TRY(decode<float>());
+}
+
+template<>
+ErrorOr<ColorStopData> Decoder::decode()
+{
+    ColorStopData color_stops;
+    auto count = TRY(decode<u32>());
+    for (u32 i = 0; i < count; ++i) {
+        auto color = TRY(decode<Gfx::Color>());
+        auto position = TRY(decode<float>());
+        auto transition_hint = TRY(decode<Optional<float>>());
+        color_stops.list.append({ .color = color, .position = position, .transition_hint = transition_hint });
+    }
+    color_stops.repeat_length = TRY(decode<Optional<float>>());
+    color_stops.repeating = TRY(decode<bool>());
+    return color_stops;
+}
+
+template<>
+ErrorOr<ColorInterpolationMethod> Decoder::decode()
+{
+    if (!TRY(decode<bool>()))
+        return ColorInterpolationMethod { TRY(decode_enum(CSS::RectangularColorSpace::Srgb, CSS::RectangularColorSpace::XyzD65)) };
+
+    auto color_space = TRY(decode_enum(CSS::PolarColorSpace::Hsl, CSS::PolarColorSpace::Oklch));
+    auto hue_interpolation_method = TRY(decode_enum(CSS::HueInterpolationMethod::Shorter, CSS::HueInterpolationMethod::Decreasing));
+    return ColorInterpolationMethod { CSS::ColorInterpolationMethodStyleValue::PolarColorInterpolationMethod { color_space, hue_interpolation_method } };
+}
+
+class Serializer {
+public:
+    explicit Serializer(ScrollStateSnapshotByDisplayList const& scroll_state_snapshot_by_display_list)
+        : m_scroll_state_snapshot_by_display_list(scroll_state_snapshot_by_display_list)
+    {
+    }
+
+    ErrorOr<u32> display_list_id(DisplayList&);
+    ByteBuffer finish();
+
+private:
+    template<typename T>
+    struct Table {
+        u32 add(T const& object)
+        {
+            auto id = count++;
+            ids.set(&object, id);
+            return id;
+        }
+
+        HashMap<T const*, u32> ids;
+        u32 count { 0 };
+        Encoder entries;
+    };
+
+    u32 typeface_id(Gfx::Typeface const&);
+    u32 font_id(Gfx::Font const&);
+    u32 glyph_run_id(Gfx::GlyphRun const&);
+    ErrorOr<u32> bitmap_id(Gfx::ImmutableBitmap const&);
+    ErrorOr<u32> visual_context_tree_id(AccumulatedVisualContextTree const&);
+    ErrorOr<void> encode_command(Encoder&, DisplayListCommand const&);
+
+    ScrollStateSnapshotByDisplayList const& m_scroll_state_snapshot_by_display_list;
+    Table<Gfx::Typeface> m_typefaces;
+    Table<Gfx::Font> m_fonts;
+    Table<Gfx::GlyphRun> m_glyph_runs;
+    Table<Gfx::ImmutableBitmap> m_bitmaps;
+    Table<AccumulatedVisualContextTree> m_visual_context_trees;
+    Table<DisplayList> m_display_lists;
+};
+
+u32 Serializer::typeface_id(Gfx::Typeface const& typeface)
+{
+    if (auto id = m_typefaces.ids.get(&typeface); id.has_value())
+        return *id;
+
+    auto& encoder = m_typefaces.entries;
+    encoder.encode(typeface.ttc_index());
+    encoder.encode_bytes(typeface.buffer());
+    return m_typefaces.add(typeface);
+}
+
+u32 Serializer::font_id(Gfx::Font const& font)
+{
+    if (auto id = m_fonts.ids.get(&font); id.has_value())
+        return *id;
+
+    auto typeface = typeface_id(font.typeface());
+
+    auto& encoder = m_fonts.entries;
+    encoder.encode(typeface);
+    encoder.encode(font.point_size());
+    encoder.encode_count(font.variations().axes.size());
+    for (auto const& [tag, value] : font.variations().axes) {
+        encoder.encode(tag.to_u32());
+        encoder.encode(value);
+    }
+    encoder.encode_count(font.features().size());
+    for (auto const& feature : font.features()) {
+        encoder.append({ feature.tag, sizeof(feature.tag) });
+        encoder.encode(feature.value);
+    }
+    return m_fonts.add(font);
+}
+
+u32 Serializer::glyph_run_id(Gfx::GlyphRun const& glyph_run)
+{
+    if (auto id = m_glyph_runs.ids.get(&glyph_run); id.has_value())
+        return *id;
+
+    auto font = font_id(glyph_run.font());
+
+    auto& encoder = m_glyph_runs.entries;
+    encoder.encode(font);
+    encoder.encode(glyph_run.text_type());
+    encoder.encode(glyph_run.width());
+    // NB: The recorder builds the text blob of a glyph run for the scale it is painted at, and the player only draws
+    //     glyph runs that have one, so the scale needs to survive the round trip.
+    encoder.encode(glyph_run.cached_text_blob_scale());
+    encoder.encode_count(glyph_run.glyphs().size());
+    for (auto const& glyph : glyph_run.glyphs()) {
+        encoder.encode(glyph.position);
+        encoder.encode_count(glyph.length_in_code_units);
+        encoder.encode(glyph.glyph_width);
+        encoder.encode(glyph.glyph_id);
+    }
+    return m_glyph_runs.add(glyph_run);
+}
+
+ErrorOr<u32> Serializer::bitmap_id(Gfx::ImmutableBitmap const& immutable_bitmap)
+{
+    if (auto id = m_bitmaps.ids.get(&immutable_bitmap); id.has_value())
+        return *id;
+
+    auto bitmap = immutable_bitmap.bitmap();
+    if (!bitmap)
+        return Error::from_string_literal("Serializing YUV-backed bitmaps is not supported");
+
+    auto& encoder = m_bitmaps.entries;
+    encoder.encode(bitmap->format());
+    encoder.encode(bitmap->alpha_type());
+    encoder.encode(immutable_bitmap.alpha_type());
+    encoder.encode(bitmap->size());
+
+    auto row_size = static_cast<size_t>(bitmap->width()) * sizeof(Gfx::ARGB32);
+    for (int y = 0; y < bitmap->height(); ++y)
+        encoder.append({ bitmap->scanline_u8(y), row_size });
+    return m_bitmaps.add(immutable_bitmap);
+}
+
+ErrorOr<u32> Serializer::visual_context_tree_id(AccumulatedVisualContextTree const& visual_context_tree)
+{
+    if (auto id = m_visual_context_trees.ids.get(&visual_context_tree); id.has_value())
+        return *id;
+
+    // NB: The sentinel at index 0 is not written, as AccumulatedVisualContextTree::create() adds it.
+    Encoder encoder;
+    encoder.encode_count(visual_context_tree.node_count() - 1);
+    for (size_t i = 1; i < visual_context_tree.node_count(); ++i) {
+        auto const& node = visual_context_tree.node_at(VisualContextIndex { i });
+        encoder.encode_count(node.parent_index.value());
+        TRY(node.data.visit(
+            [&](ScrollData const& data) -> ErrorOr<void> {
+                encoder.encode(VisualContextKind::Scroll);
+                encoder.encode_count(data.scroll_frame_index.value());
+                encoder.encode(data.is_sticky);
+                return {};
+            },
+            [&](ClipData const& data) -> ErrorOr<void> {
+                encoder.encode(VisualContextKind::Clip);
+                encoder.encode(data.rect);
+                encoder.encode(data.corner_radii);
+                return {};
+            },
+            [&](TransformData const& data) -> ErrorOr<void> {
+                encoder.encode(VisualContextKind::Transform);
+                encoder.encode(data.matrix);
+                encoder.encode(data.origin);
+                return {};
+            },
+            [&](PerspectiveData const& data) -> ErrorOr<void> {
+                encoder.encode(VisualContextKind::Perspective);
+                encoder.encode(data.matrix);
+                return {};
+            },
+            [&](ClipPathData const& data) -> ErrorOr<void> {
+                encoder.encode(VisualContextKind::ClipPath);
+                encoder.encode(data.path);
+                encoder.encode(data.bounding_rect);
+                encoder.encode(data.fill_rule);
+                return {};
+            },
+            [&](EffectsData const& data) -> ErrorOr<void> {
+                if (data.gfx_filter.has_value())
+                    return Error::from_string_literal("Serializing filters is not supported");
+                encoder.encode(VisualContextKind::Effects);
+                encoder.encode(data.opacity);
+                encoder.encode(data.blend_mode);
+                return {};
+            }));
+    }
+
+    m_visual_context_trees.entries.append(encoder.bytes());
+    return m_visual_context_trees.add(visual_context_tree);
+}
+
+static ErrorOr<void> encode_paint_style_or_color(Encoder& encoder, PaintStyleOrColor const& paint_style_or_color)
+{
+    if (!paint_style_or_color.has<Gfx::Color>())
+        return Error::from_string_literal("Serializing SVG paint styles is not supported");
+    encoder.encode(paint_style_or_color.get<Gfx::Color>());
+    return {};
+}
+
+ErrorOr<void> Serializer::encode_command(Encoder& encoder, DisplayListCommand const& display_list_command)
+{
+    display_list_command.visit([&]<typename T>(T const&) { encoder.encode(command_tag<T>); });
+
+    return display_list_command.visit(
+        [&](DrawGlyphRun const& command) -> ErrorOr<void> {
+            encoder.encode(glyph_run_id(*command.glyph_run));
+            encoder.encode(command.rect);
+            encoder.encode(command.translation);
+            encoder.encode(command.color);
+            encoder.encode(command.orientation);
+            return {};
+        },
+        [&](FillRect const& command) -> ErrorOr<void> {
+            encoder.encode(command.rect);
+            encoder.encode(command.color);
+            return {};
+        },
+        [&](DrawScaledImmutableBitmap const& command) -> ErrorOr<void> {
+            encoder.encode(command.dst_rect);
+            encoder.encode(command.clip_rect);
+            encoder.encode(TRY(bitmap_id(*command.bitmap)));
+            encoder.encode(command.scaling_mode);
+            return {};
+        },
+        [&](DrawRepeatedImmutableBitmap const& command) -> ErrorOr<void> {
+            encoder.encode(command.dst_rect);
+            encoder.encode(command.clip_rect);
+            encoder.encode(TRY(bitmap_id(*command.bitmap)));
+            encoder.encode(command.scaling_mode);
+            encoder.encode(command.repeat.x);
+            encoder.encode(command.repeat.y);
+            return {};
+        },
+        [&](DrawExternalContent const&) -> ErrorOr<void> {
+            return Error::from_string_literal("Serializing external content is not supported");
+        },
+        [&](Save const&) -> ErrorOr<void> { return {}; },
+        [&](SaveLayer const&) -> ErrorOr<void> { return {}; },
+        [&](Restore const&) -> ErrorOr<void> { return {}; },
+        [&](Translate const& command) -> ErrorOr<void> {
+            encoder.encode(command.delta);
+            return {};
+        },
+        [&](AddClipRect const& command) -> ErrorOr<void> {
+            encoder.encode(command.rect);
+            return {};
+        },
+        [&](PaintLinearGradient const& command) -> ErrorOr<void> {
+            encoder.encode(command.gradient_rect);
+            encoder.encode(command.linear_gradient_data.gradient_angle);
+            encoder.encode(command.linear_gradient_data.color_stops);
+            encoder.encode(command.linear_gradient_data.interpolation_method);
+            return {};
+        },
+        [&](PaintRadialGradient const& command) -> ErrorOr<void> {
+            encoder.encode(command.rect);
+            encoder.encode(command.radial_gradient_data.color_stops);
+            encoder.encode(command.radial_gradient_data.interpolation_method);
+            encoder.encode(command.center);
+            encoder.encode(command.size);
+            return {};
+        },
+        [&](PaintConicGradient const& command) -> ErrorOr<void> {
+            encoder.encode(command.rect);
+            encoder.encode(command.conic_gradient_data.start_angle);
+            encoder.encode(command.conic_gradient_data.color_stops);
+            encoder.encode(command.conic_gradient_data.interpolation_method);
+            encoder.encode(command.position);
+            return {};
+        },
+        [&](PaintOuterBoxShadow const& command) -> ErrorOr<void> {
+            encoder.encode(command.color);
+            encoder.encode(command.blur_radius);
+            encoder.encode(command.device_content_rect);
+            encoder.encode(command.content_corner_radii);
+            encoder.encode(command.shadow_rect);
+            encoder.encode(command.shadow_corner_radii);
+            return {};
+        },
+        [&](PaintInnerBoxShadow const& command) -> ErrorOr<void> {
+            encoder.encode(command.color);
+            encoder.encode(command.blur_radius);
+            encoder.encode(command.device_content_rect);
+            encoder.encode(command.content_corner_radii);
+            encoder.encode(command.outer_shadow_rect);
+            encoder.encode(command.inner_shadow_rect);
+            encoder.encode(command.inner_shadow_corner_radii);
+            return {};
+        },
+        [&](PaintTextShadow const& command) -> ErrorOr<void> {
+            encoder.encode(glyph_run_id(*command.glyph_run));
+            encoder.encode(command.shadow_bounding_rect);
+            encoder.encode(command.text_rect);
+            encoder.encode(command.draw_location);
+            encoder.encode(command.blur_radius);
+            encoder.encode(command.color);
+            return {};
+        },
+        [&](FillRectWithRoundedCorners const& command) -> ErrorOr<void> {
+            encoder.encode(command.rect);
+            encoder.encode(command.color);
+            encoder.encode(command.corner_radii);
+            return {};
+        },
+        [&](FillPath const& command) -> ErrorOr<void> {
+            encoder.encode(command.path_bounding_rect);
+            encoder.encode(command.path);
+            encoder.encode(command.opacity);
+            TRY(encode_paint_style_or_color(encoder, command.paint_style_or_color));
+            encoder.encode(command.winding_rule);
+            encoder.encode(command.should_anti_alias);
+            return {};
+        },
+        [&](StrokePath const& command) -> ErrorOr<void> {
+            encoder.encode(command.cap_style);
+            encoder.encode(command.join_style);
+            encoder.encode(command.miter_limit);
+            encoder.encode_count(command.dash_array.size());
+            for (auto dash : command.dash_array)
+                encoder.encode(dash);
+            encoder.encode(command.dash_offset);
+            encoder.encode(command.path_bounding_rect);
+            encoder.encode(command.path);
+            encoder.encode(command.opacity);
+            TRY(encode_paint_style_or_color(encoder, command.paint_style_or_color));
+            encoder.encode(command.thickness);
+            encoder.encode(command.should_anti_alias);
+            return {};
+        },
+        [&](DrawEllipse const& command) -> ErrorOr<void> {
+            encoder.encode(command.rect);
+            encoder.encode(command.color);
+            encoder.encode(command.thickness);
+            return {};
+        },
+        [&](FillEllipse const& command) -> ErrorOr<void> {
+            encoder.encode(command.rect);
+            encoder.encode(command.color);
+            return {};
+        },
+        [&](DrawLine const& command) -> ErrorOr<void> {
+            encoder.encode(command.color);
+            encoder.encode(command.from);
+            encoder.encode(command.to);
+            encoder.encode(command.thickness);
+            encoder.encode(command.style);
+            encoder.encode(command.alternate_color);
+            return {};
+        },
+        [&](ApplyBackdropFilter const& command) -> ErrorOr<void> {
+            if (command.backdrop_filter.has_value())
+                return Error::from_string_literal("Serializing filters is not supported");
+            encoder.encode(command.backdrop_region);
+            encoder.encode(command.corner_radii);
+            return {};
+        },
+        [&](DrawRect const& command) -> ErrorOr<void> {
+            encoder.encode(command.rect);
+            encoder.encode(command.color);
+            encoder.encode(command.rough);
+            return {};
+        },
+        [&](AddRoundedRectClip const& command) -> ErrorOr<void> {
+            encoder.encode(command.corner_radii);
+            encoder.encode(command.border_rect);
+            encoder.encode(command.corner_clip);
+            return {};
+        },
+        [&](PaintNestedDisplayList const& command) -> ErrorOr<void> {
+            // NB: Display list IDs are offset by one, so that zero can stand for a missing list.
+            u32 nested_display_list_id = 0;
+            if (command.display_list)
+                nested_display_list_id = TRY(display_list_id(*command.display_list)) + 1;
+            encoder.encode(nested_display_list_id);
+            encoder.encode(command.rect);
+            return {};
+        },
+        [&](PaintScrollBar const& command) -> ErrorOr<void> {
+            encoder.encode_count(command.scroll_frame_index.value());
+            encoder.encode(command.gutter_rect);
+            encoder.encode(command.thumb_rect);
+            encoder.encode(command.scroll_size);
+            encoder.encode(command.thumb_color);
+            encoder.encode(command.track_color);
+            encoder.encode(command.vertical);
+            return {};
+        },
+        [&](ApplyEffects const& command) -> ErrorOr<void> {
+            if (command.filter.has_value())
+                return Error::from_string_literal("Serializing filters is not supported");
+            encoder.encode(command.opacity);
+            encoder.encode(command.compositing_and_blending_operator);
+            encoder.encode(command.mask_kind.has_value());
+            if (command.mask_kind.has_value())
+                encoder.encode(*command.mask_kind);
+            return {};
+        });
+}
+
+ErrorOr<u32> Serializer::display_list_id(DisplayList& display_list)
+{
+    if (auto id = m_display_lists.ids.get(&display_list); id.has_value())
+        return *id;
+
+    Encoder encoder;
+    encoder.encode(TRY(visual_context_tree_id(display_list.visual_context_tree())));
+
+    auto scroll_state_snapshot = m_scroll_state_snapshot_by_display_list.get(display_list);
+    encoder.encode(scroll_state_snapshot.has_value());
+    if (scroll_state_snapshot.has_value()) {
+        auto device_offsets = scroll_state_snapshot->device_offsets();
+        encoder.encode_count(device_offsets.size());
+        for (auto device_offset : device_offsets)
+            encoder.encode(device_offset);
+    }
+
+    encoder.encode_count(display_list.commands().size());
+    for (auto const& item : display_list.commands()) {
+        encoder.encode_count(item.context_index.value());
+        TRY(encode_command(encoder, item.command));
+    }
+
+    m_display_lists.entries.append(encoder.bytes());
+    return m_display_lists.add(display_list);
+}
+
+ByteBuffer Serializer::finish()
+{
+    Encoder encoder;
+    encoder.encode(magic);
+    encoder.encode(format_version);
+
+    auto append_table = [&](auto const& table) {
+        encoder.encode(table.count);
+        encoder.append(table.entries.bytes());
+    };
+    append_table(m_typefaces);
+    append_table(m_fonts);
+    append_table(m_glyph_runs);
+    append_table(m_bitmaps);
+    append_table(m_visual_context_trees);
+    append_table(m_display_lists);
+    return encoder.release_buffer();
+}
+
+ErrorOr<ByteBuffer> serialize_display_list(DisplayList& display_list, ScrollStateSnapshotByDisplayList const& scroll_state_snapshot_by_display_list)
+{
+    Serializer serializer { scroll_state_snapshot_by_display_list };
+    TRY(serializer.display_list_id(display_list));
+    return serializer.finish();
+}
+
+class Deserializer {
+public:
+    explicit Deserializer(ReadonlyBytes bytes)
+        : m_decoder(bytes)
+    {
+    }
+
+    ErrorOr<DeserializedDisplayList> deserialize();
+
+private:
+    template<typename T>
+    static ErrorOr<NonnullRefPtr<T>> entry_at(Vector<NonnullRefPtr<T>> const& table, u32 id)
+    {
+        if (id >= table.size())
+            return Error::from_string_literal("Invalid reference in serialized display list");
+        return table[id];
+    }
+
+    ErrorOr<void> decode_typeface();
+    ErrorOr<void> decode_font();
+    ErrorOr<void> decode_glyph_run();
+    ErrorOr<void> decode_bitmap();
+    ErrorOr<void> decode_visual_context_tree();
+    ErrorOr<VisualContextData> decode_visual_context_data();
+    ErrorOr<void> decode_display_list();
+    ErrorOr<DisplayListCommand> decode_command();
+    ErrorOr<PaintStyleOrColor> decode_paint_style_or_color() { return PaintStyleOrColor { TRY(m_decoder.decode<Gfx::Color>()) }; }
+
+    Decoder m_decoder;
+    Vector<NonnullRefPtr<Gfx::Typeface>> m_typefaces;
+    Vector<NonnullRefPtr<Gfx::Font>> m_fonts;
+    Vector<NonnullRefPtr<Gfx::GlyphRun>> m_glyph_runs;
+    Vector<NonnullRefPtr<Gfx::ImmutableBitmap>> m_bitmaps;
+    Vector<NonnullRefPtr<AccumulatedVisualContextTree>> m_visual_context_trees;
+    Vector<NonnullRefPtr<DisplayList>> m_display_lists;
+    ScrollStateSnapshotByDisplayList m_scroll_state_snapshot_by_display_list;
+};
+
+ErrorOr<void> Deserializer::decode_typeface()
+{
+    auto ttc_index = TRY(m_decoder.decode<u32>());
+    auto data = TRY(m_decoder.decode_bytes());
+    m_typefaces.append(TRY(Gfx::Typeface::try_load_from_temporary_memory(data, ttc_index)));
+    return {};
+}
+
+ErrorOr<void> Deserializer::decode_font()
+{
+    auto typeface = TRY(entry_at(m_typefaces, TRY(m_decoder.decode<u32>())));
+    auto point_size = TRY(m_decoder.decode<float>());
+
+    Gfx::FontVariationSettings variations;
+    auto axis_count = TRY(m_decoder.decode<u32>());
+    for (u32 i = 0; i < axis_count; ++i) {
+        auto tag = TRY(m_decoder.decode<u32>());
+        auto value = TRY(m_decoder.decode<float>());
+        variations.axes.set(Gfx::FourCC::from_u32(tag), value);
+    }
+
+    Gfx::ShapeFeatures features;
+    auto feature_count = TRY(m_decoder.decode<u32>());
+    for (u32 i = 0; i < feature_count; ++i) {
+        Gfx::ShapeFeature feature;
+        TRY(m_decoder.read_bytes(sizeof(feature.tag))).copy_to({ feature.tag, sizeof(feature.tag) });
+        feature.value = TRY(m_decoder.decode<u32>());
+        features.append(feature);
+    }
+
+    m_fonts.append(typeface->font(point_size, variations, features));
+    return {};
+}
+
+ErrorOr<void> Deserializer::decode_glyph_run()
+{
+    auto font = TRY(entry_at(m_fonts, TRY(m_decoder.decode<u32>())));
+    auto text_type = TRY(m_decoder.decode_enum(Gfx::GlyphRun::TextType::Common, Gfx::GlyphRun::TextType::Rtl));
+    auto width = TRY(m_decoder.decode<float>());
+    auto text_blob_scale = TRY(m_decoder.decode<Optional<float>>());
+
+    Vector<Gfx::DrawGlyph> glyphs;
+    auto glyph_count = TRY(m_decoder.decode<u32>());
+    for (u32 i = 0; i < glyph_count; ++i) {
+        auto position = TRY(m_decoder.decode<Gfx::FloatPoint>());
+        auto length_in_code_units = TRY(m_decoder.decode<u32>());
+        auto glyph_width = TRY(m_decoder.decode<float>());
+        auto glyph_id = TRY(m_decoder.decode<u32>());
+        glyphs.append({ .position = position, .length_in_code_units = length_in_code_units, .glyph_width = glyph_width, .glyph_id = glyph_id });
+    }
+
+    auto glyph_run = adopt_ref(*new Gfx::GlyphRun(move(glyphs), move(font), text_type, width));
+    if (text_blob_scale.has_value())
+        glyph_run->ensure_text_blob(*text_blob_scale);
+    m_glyph_runs.append(move(glyph_run));
+    return {};
+}
+
+ErrorOr<void> Deserializer::decode_bitmap()
+{
+    auto format = TRY(m_decoder.decode<u8>());
+    if (!Gfx::is_valid_bitmap_format(format) || format == to_underlying(Gfx::BitmapFormat::Invalid))
+        return Error::from_string_literal("Invalid bitmap format in serialized display list");
+    auto alpha_type = TRY(m_decoder.decode_enum(Gfx::AlphaType::Premultiplied, Gfx::AlphaType::Unpremultiplied));
+    auto immutable_bitmap_alpha_type = TRY(m_decoder.decode_enum(Gfx::AlphaType::Premultiplied, Gfx::AlphaType::Unpremultiplied));
+    auto size = TRY(m_decoder.decode<Gfx::IntSize>());
+
+    auto bitmap = TRY(Gfx::Bitmap::create(static_cast<Gfx::BitmapFormat>(format), alpha_type, size));
+    auto row_size = static_cast<size_t>(bitmap->width()) * sizeof(Gfx::ARGB32);
+    for (int y = 0; y < bitmap->height(); ++y)
+        TRY(m_decoder.read_bytes(row_size)).copy_to({ bitmap->scanline_u8(y), row_size });
+
+    m_bitmaps.append(Gfx::ImmutableBitmap::create(move(bitmap), immutable_bitmap_alpha_type));
+    return {};
+}
+
+ErrorOr<VisualContextData> Deserializer::decode_visual_context_data()
+{
+    switch (TRY(m_decoder.decode_enum(VisualContextKind::Scroll, VisualContextKind::Effects))) {
+    case VisualContextKind::Scroll: {
+        auto scroll_frame_index = ScrollFrameIndex { TRY(m_decoder.decode<u32>()) };
+        auto is_sticky = TRY(m_decoder.decode<bool>());
+        return VisualContextData { ScrollData { scroll_frame_index, is_sticky } };
+    }
+    case VisualContextKind::Clip: {
+        auto rect = TRY(m_decoder.decode<DevicePixelRect>());
+        auto corner_radii = TRY(m_decoder.decode<CornerRadii>());
+        return VisualContextData { ClipData { rect, corner_radii } };
+    }
+    case VisualContextKind::Transform: {
+        auto matrix = TRY(m_decoder.decode<Gfx::FloatMatrix4x4>());
+        auto origin = TRY(m_decoder.decode<Gfx::FloatPoint>());
+        return VisualContextData { TransformData { matrix, origin } };
+    }
+    case VisualContextKind::Perspective:
+        return VisualContextData { PerspectiveData { TRY(m_decoder.decode<Gfx::FloatMatrix4x4>()) } };
+    case VisualContextKind::ClipPath: {
+        auto path = TRY(m_decoder.decode<Gfx::Path>());
+        auto bounding_rect = TRY(m_decoder.decode<DevicePixelRect>());
+        auto fill_rule = TRY(m_decoder.decode_enum(Gfx::WindingRule::Nonzero, Gfx::WindingRule::EvenOdd));
+        return VisualContextData { ClipPathData { move(path), bounding_rect, fill_rule } };
+    }
+    case VisualContextKind::Effects: {
+        auto opacity = TRY(m_decoder.decode<float>());
+        auto blend_mode = TRY(m_decoder.decode_enum(Gfx::CompositingAndBlendingOperator::Normal, Gfx::CompositingAndBlendingOperator::PlusLighter));
+        return VisualContextData { EffectsData { .opacity = opacity, .blend_mode = blend_mode, .gfx_filter = {} } };
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
+ErrorOr<void> Deserializer::decode_visual_context_tree()
+{
+    auto visual_context_tree = AccumulatedVisualContextTree::create();
+    auto node_count = TRY(m_decoder.decode<u32>());
+    for (u32 i = 0; i < node_count; ++i) {
+        // NB: A node can only have an earlier node, or the sentinel, as its parent.
+        auto parent_index = TRY(m_decoder.decode<u32>());
+        if (parent_index >= visual_context_tree->node_count())
+            return Error::from_string_literal("Invalid visual context parent in serialized display list");
+        auto data = TRY(decode_visual_context_data());
+        visual_context_tree->append(move(data), VisualContextIndex { parent_index });
+    }
+    m_visual_context_trees.append(move(visual_context_tree));
+    return {};
+}
+
+ErrorOr<DisplayListCommand> Deserializer::decode_command()
+{
+    auto& decoder = m_decoder;
+
+    switch (TRY(decoder.decode<u8>())) {
+    case command_tag<DrawGlyphRun>: {
+        auto glyph_run = TRY(entry_at(m_glyph_runs, TRY(decoder.decode<u32>())));
+        auto rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto translation = TRY(decoder.decode<Gfx::FloatPoint>());
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        auto orientation = TRY(decoder.decode_enum(Gfx::Orientation::Horizontal, Gfx::Orientation::Vertical));
+        return DisplayListCommand { DrawGlyphRun { .glyph_run = move(glyph_run), .rect = rect, .translation = translation, .color = color, .orientation = orientation } };
+    }
+    case command_tag<FillRect>: {
+        auto rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        return DisplayListCommand { FillRect { .rect = rect, .color = color } };
+    }
+    case command_tag<DrawScaledImmutableBitmap>: {
+        auto dst_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto clip_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto bitmap = TRY(entry_at(m_bitmaps, TRY(decoder.decode<u32>())));
+        auto scaling_mode = TRY(decoder.decode_enum(Gfx::ScalingMode::None, Gfx::ScalingMode::NearestNeighbor));
+        return DisplayListCommand { DrawScaledImmutableBitmap { .dst_rect = dst_rect, .clip_rect = clip_rect, .bitmap = move(bitmap), .scaling_mode = scaling_mode } };
+    }
+    case command_tag<DrawRepeatedImmutableBitmap>: {
+        auto dst_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto clip_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto bitmap = TRY(entry_at(m_bitmaps, TRY(decoder.decode<u32>())));
+        auto scaling_mode = TRY(decoder.decode_enum(Gfx::ScalingMode::None, Gfx::ScalingMode::NearestNeighbor));
+        auto repeat_x = TRY(decoder.decode<bool>());
+        auto repeat_y = TRY(decoder.decode<bool>());
+        return DisplayListCommand { DrawRepeatedImmutableBitmap { .dst_rect = dst_rect, .clip_rect = clip_rect, .bitmap = move(bitmap), .scaling_mode = scaling_mode, .repeat = { .x = repeat_x, .y = repeat_y } } };
+    }
+    case command_tag<Save>:
+        return DisplayListCommand { Save {} };
+    case command_tag<SaveLayer>:
+        return DisplayListCommand { SaveLayer {} };
+    case command_tag<Restore>:
+        return DisplayListCommand { Restore {} };
+    case command_tag<Translate>:
+        return DisplayListCommand { Translate { .delta = TRY(decoder.decode<Gfx::IntPoint>()) } };
+    case command_tag<AddClipRect>:
+        return DisplayListCommand { AddClipRect { .rect = TRY(decoder.decode<Gfx::IntRect>()) } };
+    case command_tag<PaintLinearGradient>: {
+        auto gradient_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto gradient_angle = TRY(decoder.decode<float>());
+        auto color_stops = TRY(decoder.decode<ColorStopData>());
+        auto interpolation_method = TRY(decoder.decode<ColorInterpolationMethod>());
+        return DisplayListCommand { PaintLinearGradient { .gradient_rect = gradient_rect, .linear_gradient_data = { gradient_angle, move(color_stops), interpolation_method } } };
+    }
+    case command_tag<PaintRadialGradient>: {
+        auto rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto color_stops = TRY(decoder.decode<ColorStopData>());
+        auto interpolation_method = TRY(decoder.decode<ColorInterpolationMethod>());
+        auto center = TRY(decoder.decode<Gfx::IntPoint>());
+        auto size = TRY(decoder.decode<Gfx::IntSize>());
+        return DisplayListCommand { PaintRadialGradient { .rect = rect, .radial_gradient_data = { move(color_stops), interpolation_method }, .center = center, .size = size } };
+    }
+    case command_tag<PaintConicGradient>: {
+        auto rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto start_angle = TRY(decoder.decode<float>());
+        auto color_stops = TRY(decoder.decode<ColorStopData>());
+        auto interpolation_method = TRY(decoder.decode<ColorInterpolationMethod>());
+        auto position = TRY(decoder.decode<Gfx::IntPoint>());
+        return DisplayListCommand { PaintConicGradient { .rect = rect, .conic_gradient_data = { start_angle, move(color_stops), interpolation_method }, .position = position } };
+    }
+    case command_tag<PaintOuterBoxShadow>: {
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        auto blur_radius = TRY(decoder.decode<i32>());
+        auto device_content_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto content_corner_radii = TRY(decoder.decode<CornerRadii>());
+        auto shadow_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto shadow_corner_radii = TRY(decoder.decode<CornerRadii>());
+        return DisplayListCommand { PaintOuterBoxShadow { color, blur_radius, device_content_rect, content_corner_radii, shadow_rect, shadow_corner_radii } };
+    }
+    case command_tag<PaintInnerBoxShadow>: {
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        auto blur_radius = TRY(decoder.decode<i32>());
+        auto device_content_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto content_corner_radii = TRY(decoder.decode<CornerRadii>());
+        auto outer_shadow_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto inner_shadow_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto inner_shadow_corner_radii = TRY(decoder.decode<CornerRadii>());
+        return DisplayListCommand { PaintInnerBoxShadow { color, blur_radius, device_content_rect, content_corner_radii, outer_shadow_rect, inner_shadow_rect, inner_shadow_corner_radii } };
+    }
+    case command_tag<PaintTextShadow>: {
+        auto glyph_run = TRY(entry_at(m_glyph_runs, TRY(decoder.decode<u32>())));
+        auto shadow_bounding_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto text_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto draw_location = TRY(decoder.decode<Gfx::FloatPoint>());
+        auto blur_radius = TRY(decoder.decode<i32>());
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        return DisplayListCommand { PaintTextShadow { move(glyph_run), shadow_bounding_rect, text_rect, draw_location, blur_radius, color } };
+    }
+    case command_tag<FillRectWithRoundedCorners>: {
+        auto rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        auto corner_radii = TRY(decoder.decode<CornerRadii>());
+        return DisplayListCommand { FillRectWithRoundedCorners { .rect = rect, .color = color, .corner_radii = corner_radii } };
+    }
+    case command_tag<FillPath>: {
+        auto path_bounding_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto path = TRY(decoder.decode<Gfx::Path>());
+        auto opacity = TRY(decoder.decode<float>());
+        auto paint_style_or_color = TRY(decode_paint_style_or_color());
+        auto winding_rule = TRY(decoder.decode_enum(Gfx::WindingRule::Nonzero, Gfx::WindingRule::EvenOdd));
+        auto should_anti_alias = TRY(decoder.decode_enum(ShouldAntiAlias::Yes, ShouldAntiAlias::No));
+        return DisplayListCommand { FillPath {
+            .path_bounding_rect = path_bounding_rect,
+            .path = move(path),
+            .opacity = opacity,
+            .paint_style_or_color = move(paint_style_or_color),
+            .winding_rule = winding_rule,
+            .should_anti_alias = should_anti_alias,
+        } };
+    }
+    case command_tag<StrokePath>: {
+        auto cap_style = TRY(decoder.decode_enum(Gfx::Path::CapStyle::Butt, Gfx::Path::CapStyle::Square));
+        auto join_style = TRY(decoder.decode_enum(Gfx::Path::JoinStyle::Miter, Gfx::Path::JoinStyle::Bevel));
+        auto miter_limit = TRY(decoder.decode<float>());
+        Vector<float> dash_array;
+        auto dash_count = TRY(decoder.decode<u32>());
+        for (u32 i = 0; i < dash_count; ++i)
+            dash_array.append(TRY(decoder.decode<float>()));
+        auto dash_offset = TRY(decoder.decode<float>());
+        auto path_bounding_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto path = TRY(decoder.decode<Gfx::Path>());
+        auto opacity = TRY(decoder.decode<float>());
+        auto paint_style_or_color = TRY(decode_paint_style_or_color());
+        auto thickness = TRY(decoder.decode<float>());
+        auto should_anti_alias = TRY(decoder.decode_enum(ShouldAntiAlias::Yes, ShouldAntiAlias::No));
+        return DisplayListCommand { StrokePath {
+            .cap_style = cap_style,
+            .join_style = join_style,
+            .miter_limit = miter_limit,
+            .dash_array = move(dash_array),
+            .dash_offset = dash_offset,
+            .path_bounding_rect = path_bounding_rect,
+            .path = move(path),
+            .opacity = opacity,
+            .paint_style_or_color = move(paint_style_or_color),
+            .thickness = thickness,
+            .should_anti_alias = should_anti_alias,
+        } };
+    }
+    case command_tag<DrawEllipse>: {
+        auto rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        auto thickness = TRY(decoder.decode<i32>());
+        return DisplayListCommand { DrawEllipse { .rect = rect, .color = color, .thickness = thickness } };
+    }
+    case command_tag<FillEllipse>: {
+        auto rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        return DisplayListCommand { FillEllipse { .rect = rect, .color = color } };
+    }
+    case command_tag<DrawLine>: {
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        auto from = TRY(decoder.decode<Gfx::IntPoint>());
+        auto to = TRY(decoder.decode<Gfx::IntPoint>());
+        auto thickness = TRY(decoder.decode<i32>());
+        auto style = TRY(decoder.decode_enum(Gfx::LineStyle::Solid, Gfx::LineStyle::Dashed));
+        auto alternate_color = TRY(decoder.decode<Gfx::Color>());
+        return DisplayListCommand { DrawLine { .color = color, .from = from, .to = to, .thickness = thickness, .style = style, .alternate_color = alternate_color } };
+    }
+    case command_tag<ApplyBackdropFilter>: {
+        auto backdrop_region = TRY(decoder.decode<Gfx::IntRect>());
+        auto corner_radii = TRY(decoder.decode<CornerRadii>());
+        return DisplayListCommand { ApplyBackdropFilter { .backdrop_region = backdrop_region, .corner_radii = corner_radii, .backdrop_filter = {} } };
+    }
+    case command_tag<DrawRect>: {
+        auto rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto color = TRY(decoder.decode<Gfx::Color>());
+        auto rough = TRY(decoder.decode<bool>());
+        return DisplayListCommand { DrawRect { .rect = rect, .color = color, .rough = rough } };
+    }
+    case command_tag<AddRoundedRectClip>: {
+        auto corner_radii = TRY(decoder.decode<CornerRadii>());
+        auto border_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto corner_clip = TRY(decoder.decode_enum(CornerClip::Outside, CornerClip::Inside));
+        return DisplayListCommand { AddRoundedRectClip { .corner_radii = corner_radii, .border_rect = border_rect, .corner_clip = corner_clip } };
+    }
+    case command_tag<PaintNestedDisplayList>: {
+        RefPtr<DisplayList> display_list;
+        if (auto id = TRY(decoder.decode<u32>()); id != 0)
+            display_list = TRY(entry_at(m_display_lists, id - 1));
+        auto rect = TRY(decoder.decode<Gfx::IntRect>());
+        return DisplayListCommand { PaintNestedDisplayList { .display_list = move(display_list), .rect = rect } };
+    }
+    case command_tag<PaintScrollBar>: {
+        auto scroll_frame_index = ScrollFrameIndex { TRY(decoder.decode<u32>()) };
+        auto gutter_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto thumb_rect = TRY(decoder.decode<Gfx::IntRect>());
+        auto scroll_size = TRY(decoder.decode<double>());
+        auto thumb_color = TRY(decoder.decode<Gfx::Color>());
+        auto track_color = TRY(decoder.decode<Gfx::Color>());
+        auto vertical = TRY(decoder.decode<bool>());
+        return DisplayListCommand { PaintScrollBar { scroll_frame_index, gutter_rect, thumb_rect, scroll_size, thumb_color, track_color, vertical } };
+    }
+    case command_tag<ApplyEffects>: {
+        auto opacity = TRY(decoder.decode<float>());
+        auto compositing_and_blending_operator = TRY(decoder.decode_enum(Gfx::CompositingAndBlendingOperator::Normal, Gfx::CompositingAndBlendingOperator::PlusLighter));
+        Optional<Gfx::MaskKind> mask_kind;
+        if (TRY(decoder.decode<bool>()))
+            mask_kind = TRY(decoder.decode_enum(Gfx::MaskKind::Alpha, Gfx::MaskKind::Luminance));
+        return DisplayListCommand { ApplyEffects { .opacity = opacity, .compositing_and_blending_operator = compositing_and_blending_operator, .filter = {}, .mask_kind = mask_kind } };
+    }
+    default:
+        return Error::from_string_literal("Invalid command in serialized display list");
+    }
+}
+
+ErrorOr<void> Deserializer::decode_display_list()
+{
+    auto visual_context_tree = TRY(entry_at(m_visual_context_trees, TRY(m_decoder.decode<u32>())));
+    auto display_list = DisplayList::create(visual_context_tree);
+
+    if (TRY(m_decoder.decode<bool>())) {
+        Vector<Gfx::FloatPoint> device_offsets;
+        auto device_offset_count = TRY(m_decoder.decode<u32>());
+        for (u32 i = 0; i < device_offset_count; ++i)
+            device_offsets.append(TRY(m_decoder.decode<Gfx::FloatPoint>()));
+        m_scroll_state_snapshot_by_display_list.set(display_list, ScrollStateSnapshot::create_from_device_offsets(move(device_offsets)));
+    }
+
+    auto command_count = TRY(m_decoder.decode<u32>());
+    for (u32 i = 0; i < command_count; ++i) {
+        auto context_index = TRY(m_decoder.decode<u32>());
+        if (context_index >= visual_context_tree->node_count())
+            return Error::from_string_literal("Invalid visual context in serialized display list");
+        display_list->append(TRY(decode_command()), VisualContextIndex { context_index });
+    }
+
+    m_display_lists.append(move(display_list));
+    return {};
+}
+
+ErrorOr<DeserializedDisplayList> Deserializer::deserialize()
+{
+    if (TRY(m_decoder.decode<u32>()) != magic)
+        return Error::from_string_literal("Not a serialized display list");
+    if (TRY(m_decoder.decode<u16>()) != format_version)
+        return Error::from_string_literal("Unsupported serialized display list version");
+
+    auto decode_table = [&](auto decode_entry) -> ErrorOr<void> {
+        auto count = TRY(m_decoder.decode<u32>());
+        for (u32 i = 0; i < count; ++i)
+            TRY((this->*decode_entry)());
+        return {};
+    };
+    TRY(decode_table(&Deserializer::decode_typeface));
+    TRY(decode_table(&Deserializer::decode_font));
+    TRY(decode_table(&Deserializer::decode_glyph_run));
+    TRY(decode_table(&Deserializer::decode_bitmap));
+    TRY(decode_table(&Deserializer::decode_visual_context_tree));
+    TRY(decode_table(&Deserializer::decode_display_list));
+
+    if (m_display_lists.is_empty() || !m_decoder.is_at_end())
+        return Error::from_string_literal("Malformed serialized display list");
+
+    return DeserializedDisplayList { m_display_lists.last(), move(m_scroll_state_snapshot_by_display_list) };
+}
+
+ErrorOr<DeserializedDisplayList> deserialize_display_list(ReadonlyBytes bytes)
+{
+    Deserializer deserializer { bytes };
+    return deserializer.deserialize();
+}
+
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/NonnullRefPtr.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+namespace Web::Painting {
+
+// A compact binary representation of a display list, together with the lists nested in it and the scroll state to
+// play all of them back with. It can be replayed in another process, or long after the document that recorded it is
+// gone. Typefaces, fonts, glyph runs, bitmaps and visual context trees are written once, however many commands refer
+// to them.
+//
+// NB: Filters, SVG paint styles and external content are backed by live objects that can't be written out, so
+//     serializing a display list that uses any of them fails.
+WEB_API ErrorOr<ByteBuffer> serialize_display_list(DisplayList&, ScrollStateSnapshotByDisplayList const&);
+
+struct DeserializedDisplayList {
+    NonnullRefPtr<DisplayList> display_list;
+    ScrollStateSnapshotByDisplayList scroll_state_snapshot_by_display_list;
+};
+
+WEB_API ErrorOr<DeserializedDisplayList> deserialize_display_list(ReadonlyBytes);
+
+}
@@ -759,6 +759,22 @@ void PaintableBox::invalidate_stacking_context()
     m_stacking_context = nullptr;
 }
 
+void PaintableBox::invalidate_paint_cache() const
+{
+    m_cached_phase_commands = {};
+
+    // The commands of this box are also cached by the stacking context that paints it, which is the stacking context
+    // of its nearest inclusive ancestor that has one.
+    for (auto const* ancestor = static_cast<Paintable const*>(this); ancestor; ancestor = ancestor->parent()) {
+        if (!ancestor->is_paintable_box())
+            continue;
+        if (auto const* stacking_context = static_cast<PaintableBox const&>(*ancestor).stacking_context()) {
+            stacking_context->invalidate_cached_commands();
+            return;
+        }
+    }
+}
+
 BordersData PaintableBox::remove_element_kind_from_borders_data(PaintableBox::BordersDataWithElementKind borders_data)
 {
     return {
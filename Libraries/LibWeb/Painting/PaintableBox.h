@@ -275,7 +275,7 @@ public:
 
     static constexpr size_t paint_phase_count = to_underlying(PaintPhase::Overlay) + 1;
 
-    void invalidate_paint_cache() const { m_cached_phase_commands = {}; }
+    void invalidate_paint_cache() const;
 
     bool has_cached_commands(PaintPhase phase) const
     {
@@ -568,7 +568,7 @@ void paint_text_decoration(DisplayListRecordingContext& context, TextPaintable c
     // Use span's text decoration if explicitly set, otherwise use the element's computed values.
     Color line_color;
     CSS::TextDecorationStyle line_style;
-    Vector<CSS::TextDecorationLine> text_decoration_lines;
+    ReadonlySpan<CSS::TextDecorationLine> text_decoration_lines;
     if (span.text_decoration.has_value()) {
         line_color = span.text_decoration->color;
         line_style = span.text_decoration->style;
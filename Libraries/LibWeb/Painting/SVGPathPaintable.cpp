@@ -28,6 +28,17 @@ void SVGPathPaintable::reset_for_relayout()
 {
     SVGGraphicsPaintable::reset_for_relayout();
     m_computed_path.clear();
+    m_device_path_cache.clear();
+}
+
+Gfx::Path const& SVGPathPaintable::device_path(Gfx::AffineTransform const& paint_transform, Gfx::FloatPoint offset) const
+{
+    if (m_device_path_cache.has_value() && m_device_path_cache->paint_transform == paint_transform && m_device_path_cache->offset == offset)
+        return m_device_path_cache->path;
+
+    auto const& path = device_path(paint_transform, offset);
+    m_device_path_cache = DevicePathCacheEntry { paint_transform, offset, move(path) };
+    return m_device_path_cache->path;
 }
 
 TraversalDecision SVGPathPaintable::hit_test(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
@@ -71,8 +82,7 @@ void SVGPathPaintable::paint(DisplayListRecordingContext& context, PaintPhase ph
     auto maybe_view_box = svg_node->dom_node().view_box();
 
     auto paint_transform = computed_transforms().svg_to_device_pixels_transform(context);
-    auto path = computed_path()->copy_transformed(paint_transform);
-    path.offset(offset);
+    auto const& path = device_path(paint_transform, offset);
 
     auto svg_viewport = [&] {
         if (maybe_view_box.has_value())
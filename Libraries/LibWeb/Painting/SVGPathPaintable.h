@@ -29,6 +29,7 @@ public:
     void set_computed_path(Gfx::Path path)
     {
         m_computed_path = move(path);
+        m_device_path_cache.clear();
     }
 
     Optional<Gfx::Path> const& computed_path() const { return m_computed_path; }
@@ -41,7 +42,18 @@ protected:
     Optional<Gfx::Path> m_computed_path = {};
 
 private:
+    Gfx::Path const& device_path(Gfx::AffineTransform const& paint_transform, Gfx::FloatPoint offset) const;
+
     virtual bool is_svg_path_paintable() const final { return true; }
+
+    // The computed path as it was last painted, so that repainting with the same transform (e.g. on hover) neither has
+    // to transform the path again, nor hands Skia a new path that it would have to tessellate again.
+    struct DevicePathCacheEntry {
+        Gfx::AffineTransform paint_transform;
+        Gfx::FloatPoint offset;
+        Gfx::Path path;
+    };
+    mutable Optional<DevicePathCacheEntry> m_device_path_cache;
 };
 
 template<>
@@ -25,6 +25,9 @@ SVGSVGPaintable::SVGSVGPaintable(Layout::SVGSVGBox const& layout_box)
 
 void SVGSVGPaintable::paint_svg_box(DisplayListRecordingContext& context, PaintableBox const& svg_box, PaintPhase phase)
 {
+    // NB: SVG boxes are painted without the per-paintable command cache, so their commands can't be reused either.
+    context.display_list_recorder().note_uncached_content();
+
     context.display_list_recorder().set_accumulated_visual_context(svg_box.accumulated_visual_context_index());
 
     // For elements with SVG filters, emit a transparent FillRect to trigger filter application.
@@ -15,6 +15,15 @@ class ScrollStateSnapshot {
 public:
     static ScrollStateSnapshot create(Vector<ScrollFrame> const& scroll_frames, double device_pixels_per_css_pixel);
 
+    static ScrollStateSnapshot create_from_device_offsets(Vector<Gfx::FloatPoint> device_offsets)
+    {
+        ScrollStateSnapshot snapshot;
+        snapshot.m_device_offsets = move(device_offsets);
+        return snapshot;
+    }
+
+    ReadonlySpan<Gfx::FloatPoint> device_offsets() const { return m_device_offsets; }
+
     Gfx::FloatPoint device_offset_for_index(ScrollFrameIndex index) const
     {
         if (index.value() >= m_device_offsets.size())
@@ -22,6 +31,8 @@ public:
         return m_device_offsets[index.value()];
     }
 
+    bool operator==(ScrollStateSnapshot const&) const = default;
+
 private:
     Vector<Gfx::FloatPoint> m_device_offsets;
 };
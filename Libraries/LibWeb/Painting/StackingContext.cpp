@@ -90,6 +90,14 @@ void StackingContext::visit_edges(Visitor& visitor)
     visitor.visit(m_positioned_descendants_and_stacking_contexts_with_stack_level_0);
     visitor.visit(m_parent);
     visitor.visit(m_children);
+    auto visit_child_paints = [&](CachedCommands const* commands) {
+        if (!commands)
+            return;
+        for (auto const& child_paint : commands->child_paints)
+            visitor.visit(child_paint.child);
+    };
+    visit_child_paints(m_cached_commands.ptr());
+    visit_child_paints(m_recording.ptr());
 }
 
 void StackingContext::set_last_paint_generation_id(u64 generation_id)
@@ -221,11 +229,88 @@ void StackingContext::paint_descendants(DisplayListRecordingContext& context, Pa
     });
 }
 
-void StackingContext::paint_child(DisplayListRecordingContext& context, StackingContext const& child)
+void StackingContext::paint_child(DisplayListRecordingContext& context, StackingContext const& child) const
 {
     VERIFY(!child.paintable_box().is_svg_paintable());
+
+    // NB: The commands of a child stacking context are cached by the child itself, so we only remember where to paint it.
+    record_commands_painted_so_far(context.display_list_recorder());
+    if (m_recording)
+        m_recording->child_paints.append({ m_recording->commands.size(), child });
+
     const_cast<StackingContext&>(child).set_last_paint_generation_id(context.paint_generation_id());
     child.paint(context);
+
+    resume_recording(context.display_list_recorder());
+}
+
+bool StackingContext::can_replay_cached_commands(DisplayListRecordingContext const& context) const
+{
+    if (!m_cached_commands)
+        return false;
+    auto const& recorder = context.display_list_recorder();
+    if (recorder.is_capturing() || context.should_show_line_box_borders())
+        return false;
+    return m_cached_commands->visual_context_tree.ptr() == &recorder.visual_context_tree()
+        && m_cached_commands->device_pixels_per_css_pixel == context.device_pixels_per_css_pixel()
+        && m_cached_commands->painted_overlay == context.should_paint_overlay();
+}
+
+void StackingContext::replay_cached_commands(DisplayListRecordingContext& context) const
+{
+    auto& recorder = context.display_list_recorder();
+
+    // NB: Hold on to the cache, as painting a child could invalidate it.
+    NonnullRefPtr<CachedCommands const> cached_commands = *m_cached_commands;
+    ReadonlySpan<DisplayList::CommandListItem> commands = cached_commands->commands;
+
+    size_t replayed_command_count = 0;
+    for (auto const& child_paint : cached_commands->child_paints) {
+        recorder.replay_cached_commands(commands.slice(replayed_command_count, child_paint.command_index - replayed_command_count));
+        replayed_command_count = child_paint.command_index;
+        paint_child(context, child_paint.child);
+    }
+    recorder.replay_cached_commands(commands.slice(replayed_command_count));
+    recorder.set_accumulated_visual_context(paintable_box().accumulated_visual_context_index());
+}
+
+void StackingContext::begin_recording(DisplayListRecordingContext const& context) const
+{
+    m_cached_commands = nullptr;
+    m_recording = nullptr;
+
+    auto const& recorder = context.display_list_recorder();
+    if (recorder.is_capturing() || context.should_show_line_box_borders())
+        return;
+
+    m_recording = adopt_ref(*new CachedCommands);
+    m_recording->visual_context_tree = recorder.visual_context_tree();
+    m_recording->device_pixels_per_css_pixel = context.device_pixels_per_css_pixel();
+    m_recording->painted_overlay = context.should_paint_overlay();
+    resume_recording(recorder);
+}
+
+void StackingContext::record_commands_painted_so_far(DisplayListRecorder const& recorder) const
+{
+    if (!m_recording)
+        return;
+    if (recorder.uncached_content_count() != m_recording_uncached_content_count) {
+        m_recording = nullptr;
+        return;
+    }
+    recorder.copy_commands_since(m_recording_command_index, m_recording->commands);
+}
+
+void StackingContext::resume_recording(DisplayListRecorder const& recorder) const
+{
+    m_recording_command_index = recorder.command_count();
+    m_recording_uncached_content_count = recorder.uncached_content_count();
+}
+
+void StackingContext::end_recording(DisplayListRecorder const& recorder) const
+{
+    record_commands_painted_so_far(recorder);
+    m_cached_commands = move(m_recording);
 }
 
 void StackingContext::paint_internal(DisplayListRecordingContext& context) const
@@ -316,6 +401,13 @@ void StackingContext::paint(DisplayListRecordingContext& context) const
         VERIFY(context.display_list_recorder().m_save_nesting_level == 0);
     });
 
+    if (can_replay_cached_commands(context)) {
+        replay_cached_commands(context);
+        return;
+    }
+
+    begin_recording(context);
+
     auto const& computed_values = paintable_box().computed_values();
     auto mask_image = computed_values.mask_image();
 
@@ -360,6 +452,10 @@ void StackingContext::paint(DisplayListRecordingContext& context) const
         }
     }
 
+    // NB: Masks are painted from other parts of the tree, whose invalidation doesn't reach this stacking context.
+    if (!masks.is_empty())
+        m_recording = nullptr;
+
     context.display_list_recorder().begin_masks(masks);
 
     auto context_before_children = context.display_list_recorder().accumulated_visual_context();
@@ -369,6 +465,8 @@ void StackingContext::paint(DisplayListRecordingContext& context) const
     context.display_list_recorder().set_accumulated_visual_context(context_before_children);
 
     context.display_list_recorder().end_masks(masks);
+
+    end_recording(context.display_list_recorder());
 }
 
 TraversalDecision StackingContext::hit_test(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <AK/RefCounted.h>
 #include <AK/Vector.h>
 #include <LibGC/CellAllocator.h>
 #include <LibWeb/Export.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/Paintable.h>
 
 namespace Web::Painting {
@@ -46,6 +48,12 @@ public:
 
     void set_last_paint_generation_id(u64 generation_id);
 
+    void invalidate_cached_commands() const
+    {
+        m_cached_commands = nullptr;
+        m_recording = nullptr;
+    }
+
     virtual void visit_edges(Visitor&) override;
 
 private:
@@ -58,8 +66,36 @@ private:
     Vector<GC::Ref<PaintableBox const>> m_positioned_descendants_and_stacking_contexts_with_stack_level_0;
     Vector<GC::Ref<PaintableBox const>> m_non_positioned_floating_descendants;
 
-    static void paint_child(DisplayListRecordingContext&, StackingContext const&);
+    // The commands recorded by the last paint of this stacking context, without those of its child stacking contexts,
+    // which are painted again at the position they were painted at. They are reused for as long as none of the
+    // paintables painted here has its paint cache invalidated, and the visual context tree is not rebuilt.
+    struct CachedCommands final : public RefCounted<CachedCommands> {
+        struct ChildPaint {
+            size_t command_index { 0 };
+            GC::Ref<StackingContext const> child;
+        };
+
+        RefPtr<AccumulatedVisualContextTree const> visual_context_tree;
+        double device_pixels_per_css_pixel { 1 };
+        bool painted_overlay { false };
+        Vector<DisplayList::CommandListItem> commands;
+        Vector<ChildPaint> child_paints;
+    };
+
+    void paint_child(DisplayListRecordingContext&, StackingContext const&) const;
     void paint_internal(DisplayListRecordingContext&) const;
+
+    bool can_replay_cached_commands(DisplayListRecordingContext const&) const;
+    void replay_cached_commands(DisplayListRecordingContext&) const;
+    void begin_recording(DisplayListRecordingContext const&) const;
+    void record_commands_painted_so_far(DisplayListRecorder const&) const;
+    void resume_recording(DisplayListRecorder const&) const;
+    void end_recording(DisplayListRecorder const&) const;
+
+    mutable RefPtr<CachedCommands const> m_cached_commands;
+    mutable RefPtr<CachedCommands> m_recording;
+    mutable size_t m_recording_command_index { 0 };
+    mutable size_t m_recording_uncached_content_count { 0 };
 };
 
 }
@@ -17,6 +17,7 @@ namespace Web::PerformanceTimeline::EntryTypes {
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(first_input, "first-input")                           \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(largest_contentful_paint, "largest-contentful-paint") \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(layout_shift, "layout-shift")                         \
+    __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(long_animation_frame, "long-animation-frame")         \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(longtask, "longtask")                                 \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(mark, "mark")                                         \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(measure, "measure")                                   \
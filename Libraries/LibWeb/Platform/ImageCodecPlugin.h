@@ -9,8 +9,10 @@
 
 #include <AK/RefPtr.h>
 #include <AK/Vector.h>
+#include <ImageDecoder/DecodePriority.h>
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
+#include <LibGfx/YUVData.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/Export.h>
 
@@ -29,6 +31,9 @@ struct DecodedImage {
     Vector<u32> all_durations;
     Gfx::ColorSpace color_space;
     i64 session_id { 0 };
+
+    // Set instead of the frames for still images that were decoded to YUV planes.
+    OwnPtr<Gfx::YUVData> yuv_data;
 };
 
 class WEB_API ImageCodecPlugin {
@@ -39,7 +44,17 @@ public:
 
     virtual ~ImageCodecPlugin();
 
-    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, ImageDecoder::DecodePriority = ImageDecoder::DecodePriority::Normal, bool allow_yuv = false) = 0;
+
+    // A streaming decode is fed the encoded data as it arrives. Images decoded from the data so far are passed to the
+    // partial image callback until the final image is resolved. Returns an empty optional if the decode was rejected
+    // right away.
+    //
+    // If YUV is allowed, the final image may be resolved with YUV planes instead of frames.
+    virtual Optional<i64> begin_streaming_decode(ESCAPING Function<void(DecodedImage&)> on_partial_image, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, ImageDecoder::DecodePriority, bool allow_yuv) = 0;
+    virtual void append_streaming_decode_data(i64 stream_id, ReadonlyBytes) = 0;
+    virtual void finish_streaming_decode(i64 stream_id) = 0;
+    virtual void cancel_streaming_decode(i64 stream_id) = 0;
 
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) = 0;
     virtual void stop_animation_decode(i64 session_id) = 0;
@@ -33,13 +33,16 @@ void SVGPathElement::attribute_changed(FlyString const& name, Optional<String> c
 
     if (name == "d") {
         m_path = AttributeParser::parse_path_data(value.value_or(String {}));
+        m_gfx_path.clear();
         set_needs_layout_update(DOM::SetNeedsLayoutReason::StyleChange);
     }
 }
 
 Gfx::Path SVGPathElement::get_path(CSSPixelSize)
 {
-    return m_path.to_gfx_path();
+    if (!m_gfx_path.has_value())
+        m_gfx_path = m_path.to_gfx_path();
+    return *m_gfx_path;
 }
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibGfx/Path.h>
 #include <LibWeb/SVG/Path.h>
 #include <LibWeb/SVG/SVGGeometryElement.h>
 
@@ -28,6 +29,10 @@ private:
     virtual void initialize(JS::Realm&) override;
 
     Path m_path {};
+
+    // NB: Converting the path data is redone on every layout otherwise. Copies of a Gfx::Path share their points until
+    //     one of them is modified, so handing out copies of this is cheap.
+    Optional<Gfx::Path> m_gfx_path;
 };
 
 }
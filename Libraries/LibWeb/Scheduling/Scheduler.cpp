@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/Scheduling/Scheduler.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Scheduling {
+
+GC_DEFINE_ALLOCATOR(Scheduler);
+
+GC::Ref<Scheduler> Scheduler::create(JS::Realm& realm)
+{
+    return realm.create<Scheduler>(realm);
+}
+
+Scheduler::Scheduler(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+}
+
+Scheduler::~Scheduler() = default;
+
+void Scheduler::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Scheduler);
+    Base::initialize(realm);
+}
+
+static HTML::Task::Priority to_task_priority(Bindings::TaskPriority priority)
+{
+    switch (priority) {
+    case Bindings::TaskPriority::UserBlocking:
+        return HTML::Task::Priority::UserBlocking;
+    case Bindings::TaskPriority::UserVisible:
+        return HTML::Task::Priority::UserVisible;
+    case Bindings::TaskPriority::Background:
+        return HTML::Task::Priority::Background;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// https://wicg.github.io/scheduling-apis/#queue-a-scheduler-task
+void Scheduler::queue_a_scheduler_task(HTML::Task::Priority priority, bool is_continuation, GC::Ref<GC::Function<void()>> steps)
+{
+    auto& global = HTML::relevant_global_object(*this);
+
+    GC::Ptr<DOM::Document const> document;
+    if (auto* window = as_if<HTML::Window>(global))
+        document = &window->associated_document();
+
+    // NB: Instead of keeping a separate task queue for each priority, every task carries its priority and the event
+    //     loop's task queue picks tasks of higher priority first, preferring continuations within the same priority.
+    auto task = HTML::Task::create(vm(), HTML::Task::Source::PostedTask, document, steps);
+    task->set_priority(priority);
+    task->set_is_continuation(is_continuation);
+    HTML::relevant_agent(global).event_loop->task_queue().add(task);
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-posttask
+// https://wicg.github.io/scheduling-apis/#schedule-a-posttask-task
+GC::Ref<WebIDL::Promise> Scheduler::post_task(GC::Ref<WebIDL::CallbackType> callback, SchedulerPostTaskOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Let signal be options["signal"] if options["signal"] exists, or otherwise null.
+    auto signal = options.signal;
+
+    // 3. If signal is not null and it is aborted, then reject result with signal's abort reason and return result.
+    if (signal && signal->aborted()) {
+        WebIDL::reject_promise(realm, result, signal->reason());
+        return result;
+    }
+
+    // 4. Let state be a new scheduling state.
+    // 5. Set state's abort source to signal.
+    // 6. If options["priority"] exists, then set state's priority source to the result of creating a fixed priority
+    //    unabortable task signal given options["priority"].
+    // FIXME: 7. Otherwise if signal is not null and implements the TaskSignal interface, then set state's priority
+    //           source to signal.
+    // 8. If state's priority source is null, then set state's priority source to the result of creating a fixed
+    //    priority unabortable task signal given "user-visible".
+    auto priority = options.priority.has_value() ? to_task_priority(*options.priority) : HTML::Task::Priority::UserVisible;
+
+    // 9. Let handle be the result of creating a task handle given result and signal.
+    // 10. If signal is not null, then add handle's abort steps to signal.
+    Optional<DOM::AbortSignal::AbortAlgorithmID> abort_algorithm_id;
+    if (signal) {
+        abort_algorithm_id = signal->add_abort_algorithm([&realm, result, signal] {
+            // https://wicg.github.io/scheduling-apis/#task-handle-abort-steps
+            // 1. Reject handle's result promise with signal's abort reason.
+            WebIDL::reject_promise(realm, result, signal->reason());
+
+            // 2. If task is not null, then remove task from the scheduler's task queue.
+            // NB: The abort steps are removed once the task runs, so the task checks whether the signal was aborted
+            //     instead of being looked up in the task queue.
+        });
+    }
+
+    // 11. Let enqueueSteps be the following steps:
+    auto enqueue_steps = [this, &realm, callback, result, signal, abort_algorithm_id, priority] {
+        if (signal && signal->aborted())
+            return;
+
+        // 1. Set handle's queue to the result of selecting the scheduler task queue for scheduler given state's
+        //    priority source's priority and false.
+        // 2. Schedule a task to invoke an algorithm for scheduler given handle and the following steps:
+        queue_a_scheduler_task(priority, false, GC::create_function(heap(), [this, &realm, callback, result, signal, abort_algorithm_id, priority] {
+            if (signal) {
+                if (signal->aborted())
+                    return;
+
+                // NB: The task can no longer be aborted once it runs.
+                if (abort_algorithm_id.has_value())
+                    signal->remove_abort_algorithm(*abort_algorithm_id);
+            }
+
+            HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+            // 1. Let event loop be the scheduler's relevant agent's event loop.
+            // 2. Set event loop's current scheduling state to state.
+            auto previous_task_priority = m_current_task_priority;
+            m_current_task_priority = priority;
+
+            // 3. Let callbackResult be the result of invoking callback with « » and "rethrow". If that threw an
+            //    exception, then reject handle's result promise with that, and return.
+            auto callback_result = WebIDL::invoke_callback(*callback, {}, WebIDL::ExceptionBehavior::Rethrow, {});
+
+            // 4. Set event loop's current scheduling state to null.
+            m_current_task_priority = previous_task_priority;
+
+            if (callback_result.is_error()) {
+                WebIDL::reject_promise(realm, result, callback_result.release_value());
+                return;
+            }
+
+            // 5. Resolve handle's result promise with callbackResult.
+            WebIDL::resolve_promise(realm, result, callback_result.release_value());
+        }));
+    };
+
+    // 12. Let delay be options["delay"].
+    auto delay = options.delay;
+
+    // 13. If delay is greater than 0, then run steps after a timeout given scheduler's relevant global object,
+    //     "scheduler-postTask", delay, and the following steps:
+    if (delay > 0) {
+        auto timeout = static_cast<i32>(min(delay, static_cast<u64>(NumericLimits<i32>::max())));
+        auto& global = as<HTML::WindowOrWorkerGlobalScopeMixin>(HTML::relevant_global_object(*this));
+        global.run_steps_after_a_timeout(timeout, move(enqueue_steps));
+    }
+    // 14. Otherwise, run enqueueSteps.
+    else {
+        enqueue_steps();
+    }
+
+    // 15. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-yield
+// https://wicg.github.io/scheduling-apis/#schedule-a-yield-continuation
+GC::Ref<WebIDL::Promise> Scheduler::yield()
+{
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Let inheritedState be the scheduler's relevant agent's event loop's current scheduling state.
+    // 3. Let priority be inheritedState's priority source's priority if inheritedState is not null, or otherwise
+    //    "user-visible".
+    // FIXME: Inherit the abort source, and reject result if it is aborted.
+    auto priority = m_current_task_priority.value_or(HTML::Task::Priority::UserVisible);
+
+    // 4. Let handle be the result of creating a task handle given result and the abort source.
+    // 5. Set handle's queue to the result of selecting the scheduler task queue for scheduler given priority and true.
+    // 6. Schedule a task to invoke an algorithm for scheduler given handle and the following steps:
+    queue_a_scheduler_task(priority, true, GC::create_function(heap(), [&realm, result] {
+        HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+        // 1. Resolve handle's result promise with undefined.
+        WebIDL::resolve_promise(realm, result, JS::js_undefined());
+    }));
+
+    // 7. Return result.
+    return result;
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::Scheduling {
+
+// https://wicg.github.io/scheduling-apis/#dictdef-schedulerposttaskoptions
+struct SchedulerPostTaskOptions {
+    GC::Ptr<DOM::AbortSignal> signal;
+    Optional<Bindings::TaskPriority> priority;
+    WebIDL::UnsignedLongLong delay { 0 };
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduler
+class Scheduler final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Scheduler, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Scheduler);
+
+public:
+    [[nodiscard]] static GC::Ref<Scheduler> create(JS::Realm&);
+    virtual ~Scheduler() override;
+
+    GC::Ref<WebIDL::Promise> post_task(GC::Ref<WebIDL::CallbackType> callback, SchedulerPostTaskOptions const&);
+    GC::Ref<WebIDL::Promise> yield();
+
+private:
+    explicit Scheduler(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+
+    void queue_a_scheduler_task(HTML::Task::Priority, bool is_continuation, GC::Ref<GC::Function<void()>> steps);
+
+    // The priority of the postTask() callback that's currently running, which continuations of yield() calls made
+    // from it inherit.
+    // FIXME: The spec propagates the whole scheduling state through promise reactions as well.
+    Optional<HTML::Task::Priority> m_current_task_priority;
+};
+
+}
@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Array.h>
+#include <LibWeb/Bindings/CachePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/ServiceWorker/Cache.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::ServiceWorker {
+
+GC_DEFINE_ALLOCATOR(Cache);
+
+GC::Ref<Cache> Cache::create(JS::Realm& realm, NonnullRefPtr<RequestResponseList> request_response_list)
+{
+    return realm.create<Cache>(realm, move(request_response_list));
+}
+
+Cache::Cache(JS::Realm& realm, NonnullRefPtr<RequestResponseList> request_response_list)
+    : Bindings::PlatformObject(realm)
+    , m_request_response_list(move(request_response_list))
+{
+}
+
+void Cache::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Cache);
+}
+
+static bool is_http_or_https_get_request(Fetch::Infrastructure::Request const& request)
+{
+    return request.url().scheme().is_one_of("http"sv, "https"sv) && request.method() == "GET"sv;
+}
+
+static bool has_vary_wildcard(Fetch::Infrastructure::Response const& response)
+{
+    auto field_values = response.header_list()->get_decode_and_split("Vary"sv);
+    if (!field_values.has_value())
+        return false;
+    return field_values->contains_slow("*"_string);
+}
+
+// The steps that turn the request argument of a Cache method into the request to query with. Without a request, every
+// item matches.
+struct RequestQuery {
+    Optional<CachedRequest> request;
+    bool matches_nothing { false };
+};
+
+static WebIDL::ExceptionOr<RequestQuery> request_query_for(JS::Realm& realm, Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    // 1. Let r be null.
+    // 2. If the optional argument request is not omitted, then:
+    if (!request.has_value())
+        return RequestQuery {};
+
+    // 1. If request is a Request object, then:
+    if (auto const* request_object = request->get_pointer<GC::Root<Fetch::Request>>()) {
+        // 1. Set r to request’s request.
+        auto r = (*request_object)->request();
+
+        // 2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with an empty array.
+        if (r->method() != "GET"sv && !options.ignore_method)
+            return RequestQuery { .matches_nothing = true };
+
+        return RequestQuery { .request = CachedRequest::from_request(*r) };
+    }
+
+    // 2. Else if request is a string, then:
+    //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor with
+    //        request as its argument. If this throws an exception, return a promise rejected with that exception.
+    auto request_object = TRY(Fetch::Request::construct_impl(realm, *request));
+    return RequestQuery { .request = CachedRequest::from_request(*request_object->request()) };
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-match
+GC::Ref<WebIDL::Promise> Cache::match(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let promise be a new promise.
+    // 2. Run these substeps in parallel:
+    //     1. Let p be the result of running the algorithm specified in matchAll(request, options) method with request
+    //        and options.
+    //     2. Wait until p settles.
+    //     3. If p rejects with an exception, then:
+    //         1. Reject promise with that exception.
+    //     4. Else if p resolves with an array, responses, then:
+    //         1. If responses is an empty array, then:
+    //             1. Resolve promise with undefined.
+    //         2. Else:
+    //             1. Resolve promise with the first element of responses.
+    // 3. Return promise.
+    // OPTIMIZATION: Only the first matching response is created, rather than a Response object for every match.
+    auto query = request_query_for(realm, request, options);
+    if (query.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, query.release_error());
+
+    Optional<size_t> first_match;
+    if (!query.value().matches_nothing) {
+        auto matches = m_request_response_list->query(*query.value().request, options);
+        if (!matches.is_empty())
+            first_match = matches.first();
+    }
+
+    if (!first_match.has_value())
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+
+    auto promise = WebIDL::create_promise(realm);
+    auto response = m_request_response_list->items()[*first_match].response.to_response(realm);
+
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, response] {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::resolve_promise(realm, promise, Fetch::Response::create(realm, response, Fetch::Headers::Guard::Immutable));
+    }));
+
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-matchall
+GC::Ref<WebIDL::Promise> Cache::match_all(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1-2. Let r be the request to match against, if any.
+    auto query = request_query_for(realm, request, options);
+    if (query.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, query.release_error());
+    if (query.value().matches_nothing)
+        return WebIDL::create_resolved_promise(realm, MUST(JS::Array::create(realm, 0)));
+
+    // 3. Let realm be this’s relevant realm.
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Run these substeps in parallel:
+    //     1. Let responses be an empty list.
+    //     2. If the optional argument request is omitted, then:
+    //         1. For each requestResponse of the relevant request response list:
+    //             1. Add a copy of requestResponse’s response to responses.
+    //     3. Else:
+    //         1. Let requestResponses be the result of running Query Cache with r and options.
+    //         2. For each requestResponse of requestResponses:
+    //             1. Add a copy of requestResponse’s response to responses.
+    Vector<size_t> indices;
+    if (query.value().request.has_value()) {
+        indices = m_request_response_list->query(*query.value().request, options);
+    } else {
+        indices.ensure_capacity(m_request_response_list->items().size());
+        for (size_t i = 0; i < m_request_response_list->items().size(); ++i)
+            indices.unchecked_append(i);
+    }
+
+    // FIXME: 4. For each response in responses:
+    //     1. If response’s type is "opaque" and cross-origin resource policy check with promise’s relevant settings
+    //        object’s origin, promise’s relevant settings object, "", and response’s internal response returns
+    //        blocked, then reject promise with a TypeError and abort these steps.
+
+    // 5. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation task
+    //    source, to perform the following steps:
+    //     1. Let responseList be a list.
+    //     2. For each response in responses:
+    //         1. Add a new Response object associated with response and a new Headers object whose guard is
+    //            "immutable" to responseList.
+    //     3. Resolve promise with a frozen array created from responseList, in realm.
+    // NB: The responses are turned into Response objects right away, as the list may change before the task runs.
+    GC::RootVector<JS::Value> response_list(realm.heap());
+    response_list.ensure_capacity(indices.size());
+    for (auto index : indices) {
+        auto response = m_request_response_list->items()[index].response.to_response(realm);
+        response_list.unchecked_append(Fetch::Response::create(realm, response, Fetch::Headers::Guard::Immutable));
+    }
+
+    auto array = JS::Array::create_from(realm, response_list);
+    MUST(array->set_integrity_level(JS::Object::IntegrityLevel::Frozen));
+
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, array] {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::resolve_promise(realm, promise, array);
+    }));
+
+    // 6. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-add
+GC::Ref<WebIDL::Promise> Cache::add(Fetch::RequestInfo const& request)
+{
+    auto& realm = this->realm();
+
+    // 1. Let requests be an array containing only request.
+    Vector<Fetch::RequestInfo> requests;
+    requests.append(request);
+
+    // 2. Let responseArrayPromise be the result of running the algorithm specified in addAll(requests) passing
+    //    requests as the argument.
+    auto response_array_promise = add_all(requests);
+
+    // 3. Return the result of reacting to responseArrayPromise with a fulfillment handler that returns undefined.
+    return WebIDL::upon_fulfillment(response_array_promise, GC::create_function(realm.heap(), [](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+        return JS::js_undefined();
+    }));
+}
+
+namespace {
+
+// The requests and responses addAll() has fetched so far, in the order of its requests.
+struct FetchedRequestResponses : public RefCounted<FetchedRequestResponses> {
+    Vector<Optional<RequestResponse>> items;
+};
+
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-addAll
+GC::Ref<WebIDL::Promise> Cache::add_all(Vector<Fetch::RequestInfo> const& requests)
+{
+    auto& realm = this->realm();
+    auto& vm = realm.vm();
+
+    // 1. Let responsePromises be an empty list.
+    Vector<GC::Ref<WebIDL::Promise>> response_promises;
+
+    // 2. Let requestList be an empty list.
+    GC::RootVector<GC::Ref<Fetch::Infrastructure::Request>> request_list(realm.heap());
+
+    // 3. For each request whose type is Request in requests:
+    for (auto const& request : requests) {
+        auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>();
+        if (!request_object)
+            continue;
+
+        // 1. Let r be request’s request.
+        // 2. If r’s url’s scheme is not one of "http" and "https", or r’s method is not `GET`, return a promise
+        //    rejected with a TypeError.
+        if (!is_http_or_https_get_request(*(*request_object)->request()))
+            return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Only GET requests over HTTP(S) can be cached"_utf16));
+    }
+
+    // 4. Let fetchControllers be a list of fetch controllers.
+    // FIXME: Abort the fetches that are still ongoing when one of them fails.
+
+    auto fetched_request_responses = adopt_ref(*new FetchedRequestResponses);
+    fetched_request_responses->items.resize(requests.size());
+
+    // 5. For each request in requests:
+    for (size_t index = 0; index < requests.size(); ++index) {
+        // 1. Let r be the associated request of the result of invoking the initial value of Request as constructor
+        //    with request as its argument. If this throws an exception, return a promise rejected with exception.
+        auto request_object = Fetch::Request::construct_impl(realm, requests[index]);
+        if (request_object.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, request_object.release_error());
+        auto r = request_object.value()->request();
+
+        // 2. If r’s url’s scheme is not one of "http" and "https", then:
+        //     1. For each fetchController of fetchControllers, abort fetchController.
+        //     2. Return a promise rejected with a TypeError.
+        if (!r->url().scheme().is_one_of("http"sv, "https"sv))
+            return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Only requests over HTTP(S) can be cached"_utf16));
+
+        // FIXME: 3. If r’s client’s global object is a ServiceWorkerGlobalScope object, set request’s service-workers mode
+        //           to "none".
+
+        // 4. Set r’s initiator to "fetch" and destination to "subresource".
+        r->set_initiator_type(Fetch::Infrastructure::Request::InitiatorType::Fetch);
+
+        // 5. Add r to requestList.
+        request_list.append(r);
+
+        // 6. Let responsePromise be a new promise.
+        auto response_promise = WebIDL::create_promise(realm);
+
+        // 7. Run the following substeps in parallel:
+        //     1. Append the result of fetching r.
+        //     2. To processResponse for response, run these substeps:
+        auto process_response = [&realm, response_promise](GC::Ref<Fetch::Infrastructure::Response> response) {
+            // 1. If response’s type is "error", or response’s status is not an ok status or is 206, reject
+            //    responsePromise with a TypeError.
+            if (response->type() == Fetch::Infrastructure::Response::Type::Error || !Fetch::Infrastructure::is_ok_status(response->status()) || response->status() == 206) {
+                WebIDL::reject_promise(realm, response_promise, JS::TypeError::create(realm, "Fetching the response to cache failed"_utf16));
+                return;
+            }
+
+            // 2. Else if response’s header list contains a header named `Vary`, then:
+            //     1. Let fieldValues be the list containing the elements corresponding to the field-values of the Vary
+            //        header.
+            //     2. For each fieldValue in fieldValues:
+            //         1. If fieldValue matches "*", then:
+            //             1. Reject responsePromise with a TypeError.
+            //             2. For each fetchController of fetchControllers, abort fetchController.
+            //             3. Abort these steps.
+            if (has_vary_wildcard(*response))
+                WebIDL::reject_promise(realm, response_promise, JS::TypeError::create(realm, "Responses with Vary: * cannot be cached"_utf16));
+        };
+
+        //     3. To processResponseEndOfBody for response, run these substeps:
+        //         1. If response’s aborted flag is set, reject responsePromise with an "AbortError" DOMException and
+        //            abort these steps.
+        //         2. Resolve responsePromise with response.
+        // NB: The body is consumed rather than left in its stream, as it is stored as bytes.
+        auto process_response_consume_body = [&realm, response_promise, fetched_request_responses, index, cached_request = CachedRequest::from_request(*r)](GC::Ref<Fetch::Infrastructure::Response> response, Fetch::Infrastructure::FetchAlgorithms::BodyBytes body) {
+            if (response->aborted()) {
+                WebIDL::reject_promise(realm, response_promise, WebIDL::AbortError::create(realm, "Fetching the response to cache was aborted"_utf16));
+                return;
+            }
+            if (body.has<Fetch::Infrastructure::FetchAlgorithms::ConsumeBodyFailureTag>()) {
+                WebIDL::reject_promise(realm, response_promise, JS::TypeError::create(realm, "Reading the response to cache failed"_utf16));
+                return;
+            }
+
+            Optional<ByteBuffer> bytes;
+            if (auto* buffer = body.get_pointer<ByteBuffer>())
+                bytes = move(*buffer);
+            fetched_request_responses->items[index] = RequestResponse::create(cached_request, *response, move(bytes));
+
+            WebIDL::resolve_promise(realm, response_promise, JS::js_undefined());
+        };
+
+        (void)Fetch::Fetching::fetch(
+            realm,
+            *r,
+            Fetch::Infrastructure::FetchAlgorithms::create(vm,
+                {
+                    .process_request_body_chunk_length = {},
+                    .process_request_end_of_body = {},
+                    .process_early_hints_response = {},
+                    .process_response = move(process_response),
+                    .process_response_end_of_body = {},
+                    .process_response_consume_body = move(process_response_consume_body),
+                }));
+
+        // 8. Append responsePromise to responsePromises.
+        response_promises.append(response_promise);
+    }
+
+    // 6. Let p be the result of getting a promise to wait for all of responsePromises.
+    auto p = WebIDL::get_promise_for_wait_for_all(realm, response_promises);
+
+    // 7. Return the result of reacting to p with a fulfillment handler that, when called with argument responses,
+    //    performs the following substeps:
+    return WebIDL::upon_fulfillment(p, GC::create_function(realm.heap(), [this, &realm, fetched_request_responses](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+        // 1. Let operations be an empty list.
+        // 2. Let index be zero.
+        // 3. For each response in responses:
+        //     1. Let operation be a cache batch operation.
+        //     2. Set operation’s type to "put".
+        //     3. Set operation’s request to requestList[index].
+        //     4. Set operation’s response to response.
+        //     5. Append operation to operations.
+        //     6. Increment index by one.
+        // 4. Let cacheJobPromise be a new promise.
+        auto cache_job_promise = WebIDL::create_promise(realm);
+
+        // 5. Return cacheJobPromise and run these steps in parallel:
+        //     1. Let errorData be null.
+        //     2. Invoke Batch Cache Operations with operations. If this throws an exception, set errorData to the
+        //        exception.
+        // NB: Batch Cache Operations throws an "InvalidStateError" DOMException if two of the put operations match the
+        //     same request, before the request response list is modified.
+        Optional<JS::Value> error_data;
+        auto& items = fetched_request_responses->items;
+        for (size_t i = 0; i < items.size() && !error_data.has_value(); ++i) {
+            for (size_t j = 0; j < i; ++j) {
+                if (items[j]->matches(items[i]->request, items[i]->url_without_fragment, {})) {
+                    error_data = WebIDL::InvalidStateError::create(realm, "The same request was added more than once"_utf16);
+                    break;
+                }
+            }
+        }
+
+        if (!error_data.has_value()) {
+            for (auto& item : items)
+                m_request_response_list->put(item.release_value());
+        }
+
+        //     3. Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM
+        //        manipulation task source, to perform the following substeps:
+        //         1. If errorData is null, resolve cacheJobPromise with undefined.
+        //         2. Else, reject cacheJobPromise with errorData.
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, cache_job_promise, error_data] {
+            HTML::TemporaryExecutionContext execution_context { realm };
+            if (!error_data.has_value())
+                WebIDL::resolve_promise(realm, cache_job_promise, JS::js_undefined());
+            else
+                WebIDL::reject_promise(realm, cache_job_promise, *error_data);
+        }));
+
+        return cache_job_promise->promise();
+    }));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-put
+GC::Ref<WebIDL::Promise> Cache::put(Fetch::RequestInfo const& request, Fetch::Response& response)
+{
+    auto& realm = this->realm();
+
+    // 1. Let innerRequest be null.
+    GC::Ptr<Fetch::Infrastructure::Request> inner_request;
+
+    // 2. If request is a Request object, then set innerRequest to request’s request.
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>()) {
+        inner_request = (*request_object)->request();
+    }
+    // 3. Else:
+    else {
+        // 1. Let requestObj be the result of invoking Request’s constructor with request as its argument. If this
+        //    throws an exception, return a promise rejected with exception.
+        auto request_object = Fetch::Request::construct_impl(realm, request);
+        if (request_object.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, request_object.release_error());
+
+        // 2. Set innerRequest to requestObj’s request.
+        inner_request = request_object.value()->request();
+    }
+
+    // 4. If innerRequest’s url’s scheme is not one of "http" and "https", or innerRequest’s method is not `GET`, return a
+    //    promise rejected with a TypeError.
+    if (!is_http_or_https_get_request(*inner_request))
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Only GET requests over HTTP(S) can be cached"_utf16));
+
+    // 5. Let innerResponse be response’s response.
+    auto inner_response = response.response();
+
+    // 6. If innerResponse’s status is 206, return a promise rejected with a TypeError.
+    if (inner_response->status() == 206)
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Partial responses cannot be cached"_utf16));
+
+    // 7. If innerResponse’s header list contains a header named `Vary`, then:
+    //     1. Let fieldValues be the list containing the items corresponding to the Vary header’s field-values.
+    //     2. For each fieldValue in fieldValues:
+    //         1. If fieldValue matches "*", return a promise rejected with a TypeError.
+    if (has_vary_wildcard(*inner_response))
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Responses with Vary: * cannot be cached"_utf16));
+
+    // 8. If innerResponse’s body is disturbed or locked, return a promise rejected with a TypeError.
+    if (auto body = inner_response->body(); body && (body->stream()->is_disturbed() || body->stream()->is_locked()))
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "The response body has already been used"_utf16));
+
+    // 9. Let clonedResponse be a clone of innerResponse.
+    // 10. Let bodyReadPromise be a promise resolved with undefined.
+    // 11. If innerResponse’s body is non-null, run these substeps:
+    //     1. Let stream be innerResponse’s body’s stream.
+    //     2. Let reader be the result of getting a reader for stream.
+    //     3. Set bodyReadPromise to the result of reading all bytes from reader.
+    // NB: Rather than storing a clone whose body is a teed stream, the bytes that were read are stored. Opaque responses
+    //     have no body of their own, so the body of their internal response is read instead.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 12. Let operations be an empty list.
+    // 13. Let operation be a cache batch operation.
+    // 14. Set operation’s type to "put".
+    // 15. Set operation’s request to innerRequest.
+    // 16. Set operation’s response to clonedResponse.
+    // 17. Append operation to operations.
+    // 18. Let realm be this’s relevant realm.
+    // 19. Return the result of the fulfillment of bodyReadPromise:
+    auto store = GC::create_function(realm.heap(), [this, &realm, promise, inner_response, cached_request = CachedRequest::from_request(*inner_request)](Optional<ByteBuffer> body) mutable {
+        // 1. Let cacheJobPromise be a new promise.
+        // 2. Return cacheJobPromise and run these steps in parallel:
+        //     1. Let errorData be null.
+        //     2. Invoke Batch Cache Operations with operations. If this throws an exception, set errorData to the
+        //        exception.
+        m_request_response_list->put(RequestResponse::create(move(cached_request), *inner_response, move(body)));
+
+        //     3. Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM
+        //        manipulation task source, to perform the following substeps:
+        //         1. If errorData is null, resolve cacheJobPromise with undefined.
+        //         2. Else, reject cacheJobPromise with errorData.
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise] {
+            HTML::TemporaryExecutionContext execution_context { realm };
+            WebIDL::resolve_promise(realm, promise, JS::js_undefined());
+        }));
+    });
+
+    auto body = inner_response->unsafe_response()->body();
+    if (!body) {
+        store->function()({});
+        return promise;
+    }
+
+    auto process_body = GC::create_function(realm.heap(), [store](ByteBuffer bytes) {
+        store->function()(move(bytes));
+    });
+    auto process_body_error = GC::create_function(realm.heap(), [&realm, promise](JS::Value error) {
+        if (error.is_undefined())
+            error = JS::TypeError::create(realm, "Reading the response body failed"_utf16);
+        WebIDL::reject_promise(realm, promise, error);
+    });
+
+    body->fully_read(realm, process_body, process_body_error, GC::Ref<JS::Object> { HTML::relevant_global_object(*this) });
+
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-delete
+GC::Ref<WebIDL::Promise> Cache::delete_(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    // 2. If request is a Request object, then:
+    //     1. Set r to request’s request.
+    //     2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with false.
+    // 3. Else if request is a string, then:
+    //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor with
+    //        request as its argument. If this throws an exception, return a promise rejected with that exception.
+    auto query = request_query_for(realm, request, options);
+    if (query.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, query.release_error());
+    if (query.value().matches_nothing)
+        return WebIDL::create_resolved_promise(realm, JS::Value(false));
+
+    // 4. Let operations be an empty list.
+    // 5. Let operation be a cache batch operation.
+    // 6. Set operation’s type to "delete".
+    // 7. Set operation’s request to r.
+    // 8. Set operation’s options to options.
+    // 9. Append operation to operations.
+    // 10. Let cacheJobPromise be a new promise.
+    auto cache_job_promise = WebIDL::create_promise(realm);
+
+    // 11. Run these substeps in parallel:
+    //     1. Let errorData be null.
+    //     2. Let requestResponses be the result of running Batch Cache Operations with operations. If this throws an
+    //        exception, set errorData to the exception.
+    auto deleted_any = m_request_response_list->delete_matching(*query.value().request, options);
+
+    //     3. Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM
+    //        manipulation task source, to perform the following substeps:
+    //         1. If errorData is null, then:
+    //             1. If requestResponses is not empty, resolve cacheJobPromise with true.
+    //             2. Else, resolve cacheJobPromise with false.
+    //         2. Else, reject cacheJobPromise with errorData.
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, cache_job_promise, deleted_any] {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::resolve_promise(realm, cache_job_promise, JS::Value(deleted_any));
+    }));
+
+    // 12. Return cacheJobPromise.
+    return cache_job_promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-keys
+GC::Ref<WebIDL::Promise> Cache::keys(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1-2. Let r be the request to match against, if any.
+    auto query = request_query_for(realm, request, options);
+    if (query.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, query.release_error());
+    if (query.value().matches_nothing)
+        return WebIDL::create_resolved_promise(realm, MUST(JS::Array::create(realm, 0)));
+
+    // 3. Let realm be this’s relevant realm.
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Run these substeps in parallel:
+    //     1. Let requests be an empty list.
+    //     2. If the optional argument request is omitted, then:
+    //         1. For each requestResponse of the relevant request response list:
+    //             1. Add requestResponse’s request to requests.
+    //     3. Else:
+    //         1. Let requestResponses be the result of running Query Cache with r and options.
+    //         2. For each requestResponse of requestResponses:
+    //             1. Add requestResponse’s request to requests.
+    Vector<size_t> indices;
+    if (query.value().request.has_value()) {
+        indices = m_request_response_list->query(*query.value().request, options);
+    } else {
+        indices.ensure_capacity(m_request_response_list->items().size());
+        for (size_t i = 0; i < m_request_response_list->items().size(); ++i)
+            indices.unchecked_append(i);
+    }
+
+    //     4. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation
+    //        task source, to perform the following steps:
+    //         1. Let requestList be a list.
+    //         2. For each request in requests:
+    //             1. Add a new Request object associated with request and a new associated Headers object whose guard
+    //                is "immutable" to requestList.
+    //         3. Resolve promise with a frozen array created from requestList, in realm.
+    // NB: The requests are turned into Request objects right away, as the list may change before the task runs.
+    GC::RootVector<JS::Value> request_list(realm.heap());
+    request_list.ensure_capacity(indices.size());
+    for (auto index : indices) {
+        auto request = m_request_response_list->items()[index].request.to_request(realm.vm());
+        request_list.unchecked_append(Fetch::Request::create(realm, request, Fetch::Headers::Guard::Immutable, realm.create<DOM::AbortSignal>(realm)));
+    }
+
+    auto array = JS::Array::create_from(realm, request_list);
+    MUST(array->set_integrity_level(JS::Object::IntegrityLevel::Frozen));
+
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, array] {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::resolve_promise(realm, promise, array);
+    }));
+
+    // 6. Return promise.
+    return promise;
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Fetch/Request.h>
+#include <LibWeb/ServiceWorker/RequestResponseList.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#cache-interface
+class Cache : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Cache, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Cache);
+
+public:
+    [[nodiscard]] static GC::Ref<Cache> create(JS::Realm&, NonnullRefPtr<RequestResponseList>);
+
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const&, CacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> match_all(Optional<Fetch::RequestInfo> const&, CacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> add(Fetch::RequestInfo const&);
+    GC::Ref<WebIDL::Promise> add_all(Vector<Fetch::RequestInfo> const&);
+    GC::Ref<WebIDL::Promise> put(Fetch::RequestInfo const&, Fetch::Response&);
+    GC::Ref<WebIDL::Promise> delete_(Fetch::RequestInfo const&, CacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> keys(Optional<Fetch::RequestInfo> const&, CacheQueryOptions const&);
+
+private:
+    Cache(JS::Realm&, NonnullRefPtr<RequestResponseList>);
+
+    virtual void initialize(JS::Realm&) override;
+
+    // https://w3c.github.io/ServiceWorker/#cache-interface
+    // A Cache object represents a request response list.
+    NonnullRefPtr<RequestResponseList> m_request_response_list;
+};
+
+}
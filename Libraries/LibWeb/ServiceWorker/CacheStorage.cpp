@@ -4,15 +4,27 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/PrimitiveString.h>
 #include <LibWeb/Bindings/CacheStoragePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/ServiceWorker/Cache.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
+#include <LibWeb/StorageAPI/StorageKey.h>
+#include <LibWeb/WebIDL/DOMException.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::ServiceWorker {
 
 GC_DEFINE_ALLOCATOR(CacheStorage);
 
+// NB: Like the request response lists they contain, the name to cache maps are shared by every realm of the same storage
+//     key, and live for as long as the process does.
+static HashMap<StorageAPI::StorageKey, NameToCacheMap> s_name_to_cache_maps;
+
 CacheStorage::CacheStorage(JS::Realm& realm)
     : Bindings::PlatformObject(realm)
 {
@@ -24,17 +36,183 @@ void CacheStorage::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(CacheStorage);
 }
 
-// https://w3c.github.io/ServiceWorker/#cache-storage-open
-GC::Ref<WebIDL::Promise> CacheStorage::open(String const&)
+// https://w3c.github.io/ServiceWorker/#relevant-name-to-cache-map
+NameToCacheMap* CacheStorage::relevant_name_to_cache_map()
+{
+    // The relevant name to cache map for a CacheStorage object is the name to cache map associated with the result of
+    // running obtain a local storage bottle map with the object’s relevant settings object and "caches".
+    auto storage_key = StorageAPI::obtain_a_storage_key(HTML::relevant_settings_object(*this));
+    if (!storage_key.has_value())
+        return nullptr;
+    return &s_name_to_cache_maps.ensure(storage_key.release_value());
+}
+
+static GC::Ref<WebIDL::Promise> create_rejected_promise_for_unavailable_storage(JS::Realm& realm)
+{
+    return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Cache storage is not available to this origin"_utf16));
+}
+
+static void resolve_in_task(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise, JS::Value value)
+{
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, promise, value] {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::resolve_promise(realm, promise, value);
+    }));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-match
+GC::Ref<WebIDL::Promise> CacheStorage::match(Fetch::RequestInfo const& request, MultiCacheQueryOptions const& options)
 {
-    return WebIDL::create_rejected_promise(realm(), WebIDL::NotSupportedError::create(realm(), "CacheStorage.open() is not yet implemented"_utf16));
+    auto& realm = this->realm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return create_rejected_promise_for_unavailable_storage(realm);
+
+    // 1. If options["cacheName"] exists, then:
+    if (options.cache_name.has_value()) {
+        // 1. Return a new promise promise and run the following substeps in parallel:
+        //     1. For each cacheName → cache of the relevant name to cache map:
+        //         1. If options["cacheName"] matches cacheName, then:
+        //             1. Resolve promise with the result of running the algorithm specified in match(request, options)
+        //                method of Cache interface with request and options (providing cache as thisArgument to the
+        //                [[Call]] internal method of match(request, options).)
+        //             2. Abort these steps.
+        //     2. Resolve promise with undefined.
+        auto cache = name_to_cache_map->get(*options.cache_name);
+        if (!cache.has_value())
+            return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return Cache::create(realm, *cache)->match(request, options);
+    }
+
+    // 2. Else:
+    //     1. Let promise be a promise resolved with undefined.
+    auto promise = WebIDL::create_resolved_promise(realm, JS::js_undefined());
+
+    //     2. For each cacheName → cache of the relevant name to cache map:
+    for (auto const& it : *name_to_cache_map) {
+        auto cache = Cache::create(realm, it.value);
+
+        // 1. Set promise to the result of reacting to itself with a fulfillment handler that, when called with argument
+        //    response, performs the following substeps:
+        promise = WebIDL::upon_fulfillment(promise, GC::create_function(realm.heap(), [cache, request, options](JS::Value response) -> WebIDL::ExceptionOr<JS::Value> {
+            // 1. If response is not undefined, return response.
+            if (!response.is_undefined())
+                return response;
+
+            // 2. Return the result of running the algorithm specified in match(request, options) method of Cache
+            //    interface with request and options as the arguments (providing cache as thisArgument to the [[Call]]
+            //    internal method of match(request, options).)
+            return cache->match(request, options)->promise();
+        }));
+    }
+
+    //     3. Return promise.
+    return promise;
 }
 
 // https://w3c.github.io/ServiceWorker/#cache-storage-has
-GC::Ref<WebIDL::Promise> CacheStorage::has(String const&)
+GC::Ref<WebIDL::Promise> CacheStorage::has(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return create_rejected_promise_for_unavailable_storage(realm);
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run the following substeps in parallel:
+    //     1. For each key → value of the relevant name to cache map:
+    //         1. If cacheName matches key, resolve promise with true and abort these steps.
+    //     2. Resolve promise with false.
+    resolve_in_task(realm, promise, JS::Value(name_to_cache_map->contains(cache_name)));
+
+    // 3. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-open
+GC::Ref<WebIDL::Promise> CacheStorage::open(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return create_rejected_promise_for_unavailable_storage(realm);
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run the following substeps in parallel:
+    //     1. For each key → value of the relevant name to cache map:
+    //         1. If cacheName matches key, then:
+    //             1. Resolve promise with a new Cache object that represents value.
+    //             2. Abort these steps.
+    //     2. Let cache be a new request response list.
+    //     3. Set the relevant name to cache map[cacheName] to cache. If this cache write operation failed due to
+    //        exceeding the granted quota limit, reject promise with a "QuotaExceededError" DOMException and abort these
+    //        steps.
+    //     4. Resolve promise with a new Cache object that represents cache.
+    auto cache = name_to_cache_map->ensure(cache_name, [] { return RequestResponseList::create(); });
+    resolve_in_task(realm, promise, Cache::create(realm, move(cache)));
+
+    // 3. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-delete
+GC::Ref<WebIDL::Promise> CacheStorage::delete_(String const& cache_name)
 {
-    dbgln("FIXME: CacheStorage::has() is not implemented yet");
-    return WebIDL::create_rejected_promise(realm(), JS::Value(false));
+    auto& realm = this->realm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return create_rejected_promise_for_unavailable_storage(realm);
+
+    // 1. Let cacheExists be the result of running the algorithm specified in has(cacheName) method with cacheName as
+    //    the argument.
+    // 2. Let cacheJobPromise be a new promise.
+    auto cache_job_promise = WebIDL::create_promise(realm);
+
+    // 3. Run the following substeps in parallel:
+    //     1. If cacheExists is true, then:
+    //         1. Remove the relevant name to cache map[cacheName].
+    //         2. Queue a task to resolve cacheJobPromise with true.
+    //     2. Else, queue a task to resolve cacheJobPromise with false.
+    // NB: Objects that represent the removed request response list keep it alive, as the spec requires.
+    resolve_in_task(realm, cache_job_promise, JS::Value(name_to_cache_map->remove(cache_name)));
+
+    // 4. Return cacheJobPromise.
+    return cache_job_promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-keys
+GC::Ref<WebIDL::Promise> CacheStorage::keys()
+{
+    auto& realm = this->realm();
+    auto& vm = realm.vm();
+
+    auto* name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map)
+        return create_rejected_promise_for_unavailable_storage(realm);
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run the following substeps in parallel:
+    //     1. Let cacheKeys be the result of running getting the keys on the relevant name to cache map.
+    //     2. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation
+    //        task source, to resolve promise with cacheKeys.
+    GC::RootVector<JS::Value> cache_keys(realm.heap());
+    cache_keys.ensure_capacity(name_to_cache_map->size());
+    for (auto const& it : *name_to_cache_map)
+        cache_keys.unchecked_append(JS::PrimitiveString::create(vm, it.key));
+    resolve_in_task(realm, promise, JS::Array::create_from(realm, cache_keys));
+
+    // 3. Return promise.
+    return promise;
 }
 
 }
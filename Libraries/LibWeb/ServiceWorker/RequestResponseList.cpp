@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/ServiceWorker/RequestResponseList.h>
+
+namespace Web::ServiceWorker {
+
+static String serialize_url_without_query(URL::URL url)
+{
+    url.set_query(String {});
+    return url.serialize(URL::ExcludeFragment::Yes);
+}
+
+CachedRequest CachedRequest::from_request(Fetch::Infrastructure::Request const& request)
+{
+    return {
+        .url = request.url(),
+        .method = request.method(),
+        .header_list = HTTP::HeaderList::create(request.header_list()->headers()),
+    };
+}
+
+GC::Ref<Fetch::Infrastructure::Request> CachedRequest::to_request(JS::VM& vm) const
+{
+    auto request = Fetch::Infrastructure::Request::create(vm);
+    request->set_url(url);
+    request->set_method(method);
+    request->set_header_list(HTTP::HeaderList::create(header_list->headers()));
+    return request;
+}
+
+GC::Ref<Fetch::Infrastructure::Response> CachedResponse::to_response(JS::Realm& realm) const
+{
+    auto& vm = realm.vm();
+
+    auto response = Fetch::Infrastructure::Response::create(vm);
+    response->set_url_list(url_list);
+    response->set_status(status);
+    response->set_status_message(status_message);
+    response->set_header_list(HTTP::HeaderList::create(header_list->headers()));
+    response->set_cors_exposed_header_name_list(cors_exposed_header_name_list);
+    if (body.has_value())
+        response->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, *body));
+
+    switch (type) {
+    case Fetch::Infrastructure::Response::Type::Basic:
+        return Fetch::Infrastructure::BasicFilteredResponse::create(vm, response);
+    case Fetch::Infrastructure::Response::Type::CORS:
+        return Fetch::Infrastructure::CORSFilteredResponse::create(vm, response);
+    case Fetch::Infrastructure::Response::Type::Opaque:
+        return Fetch::Infrastructure::OpaqueFilteredResponse::create(vm, response);
+    case Fetch::Infrastructure::Response::Type::OpaqueRedirect:
+        return Fetch::Infrastructure::OpaqueRedirectFilteredResponse::create(vm, response);
+    case Fetch::Infrastructure::Response::Type::Default:
+    case Fetch::Infrastructure::Response::Type::Error:
+        response->set_type(type);
+        return response;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+RequestResponse RequestResponse::create(CachedRequest request, Fetch::Infrastructure::Response& response, Optional<ByteBuffer> body)
+{
+    // NB: Filtered responses are stored as their internal response, and filtered again when they are handed out.
+    auto internal_response = response.unsafe_response();
+
+    auto url_without_fragment = request.url.serialize(URL::ExcludeFragment::Yes);
+    auto url_without_fragment_and_query = serialize_url_without_query(request.url);
+
+    // NB: Vary is looked up in the header list of the response itself, so it is ignored for opaque responses.
+    auto vary_field_values = response.header_list()->get_decode_and_split("Vary"sv);
+
+    return {
+        .request = move(request),
+        .response = {
+            .type = response.type(),
+            .url_list = internal_response->url_list(),
+            .status = internal_response->status(),
+            .status_message = internal_response->status_message(),
+            .header_list = HTTP::HeaderList::create(internal_response->header_list()->headers()),
+            .cors_exposed_header_name_list = internal_response->cors_exposed_header_name_list(),
+            .body = move(body),
+        },
+        .url_without_fragment = move(url_without_fragment),
+        .url_without_fragment_and_query = move(url_without_fragment_and_query),
+        .vary_field_values = move(vary_field_values),
+    };
+}
+
+// https://w3c.github.io/ServiceWorker/#request-matches-cached-item-algorithm
+bool RequestResponse::matches(CachedRequest const& request_query, StringView query_url, CacheQueryOptions const& options) const
+{
+    // 1. If options["ignoreMethod"] is false and requestQuery’s method is not `GET`, return false.
+    if (!options.ignore_method && request_query.method != "GET"sv)
+        return false;
+
+    // 2. Let queryURL be requestQuery’s url.
+    // 3. Let cachedURL be request’s url.
+    // 4. If options["ignoreSearch"] is true, then:
+    //     1. Set cachedURL’s query to the empty string.
+    //     2. Set queryURL’s query to the empty string.
+    // 5. If queryURL does not equal cachedURL with exclude fragment set to true, then return false.
+    // NB: The caller serializes queryURL once for all items, in the same way.
+    auto const& cached_url = options.ignore_search ? url_without_fragment_and_query : url_without_fragment;
+    if (cached_url != query_url)
+        return false;
+
+    // 6. If response is null, options["ignoreVary"] is true, or response’s header list does not contain `Vary`, then
+    //    return true.
+    if (options.ignore_vary || !vary_field_values.has_value())
+        return true;
+
+    // 7. Let fieldValues be the list containing the elements corresponding to the field-values of the Vary header for
+    //    the value of the header with name `Vary`.
+    // 8. For each fieldValue in fieldValues:
+    for (auto const& field_value : *vary_field_values) {
+        // 1. If fieldValue matches "*", or the combined value given fieldValue and request’s header list does not
+        //    match the combined value given fieldValue and requestQuery’s header list, then return false.
+        if (field_value == "*"sv)
+            return false;
+        if (request.header_list->get(field_value) != request_query.header_list->get(field_value))
+            return false;
+    }
+
+    // 9. Return true.
+    return true;
+}
+
+// https://w3c.github.io/ServiceWorker/#query-cache
+Vector<size_t> RequestResponseList::query(CachedRequest const& request_query, CacheQueryOptions const& options) const
+{
+    // 1. Let resultList be an empty list.
+    Vector<size_t> result_list;
+
+    // OPTIMIZATION: The URL of the query is serialized once, rather than once for every item it is compared with.
+    auto query_url = options.ignore_search
+        ? serialize_url_without_query(request_query.url)
+        : request_query.url.serialize(URL::ExcludeFragment::Yes);
+
+    // 2. Let storage be null.
+    // 3. If targetStorage is null, set storage to the relevant request response list.
+    // 4. Otherwise, set storage to targetStorage.
+    // 5. For each requestResponse of storage:
+    for (size_t i = 0; i < m_items.size(); ++i) {
+        // 1. Let cachedRequest be requestResponse’s request.
+        // 2. Let cachedResponse be requestResponse’s response.
+        // 3. If Request Matches Cached Item with requestQuery, cachedRequest, cachedResponse, and options returns true,
+        //    then:
+        //     1. Let requestCopy be a copy of cachedRequest.
+        //     2. Let responseCopy be a copy of cachedResponse.
+        //     3. Add requestCopy/responseCopy to resultList.
+        // NB: Copies are only made once the callers hand the matching items out.
+        if (m_items[i].matches(request_query, query_url, options))
+            result_list.append(i);
+    }
+
+    // 6. Return resultList.
+    return result_list;
+}
+
+// https://w3c.github.io/ServiceWorker/#batch-cache-operations-algorithm
+bool RequestResponseList::delete_matching(CachedRequest const& request, CacheQueryOptions const& options)
+{
+    // 1. If operation’s type is "delete" and operation’s response is not null, throw a TypeError.
+    // 2. Let requestResponses be the result of running Query Cache with operation’s request, operation’s options,
+    //    and addedItems.
+    auto request_responses = query(request, options);
+
+    // 3. For each requestResponse of requestResponses:
+    //     1. Remove the item whose value matches requestResponse from cache.
+    for (auto index : request_responses.in_reverse())
+        m_items.remove(index);
+
+    return !request_responses.is_empty();
+}
+
+// https://w3c.github.io/ServiceWorker/#batch-cache-operations-algorithm
+void RequestResponseList::put(RequestResponse request_response)
+{
+    // 1. Let requestResponses be the result of running Query Cache with operation’s request.
+    auto request_responses = query(request_response.request);
+
+    // 2. For each requestResponse of requestResponses:
+    //     1. Remove the item whose value matches requestResponse from cache.
+    for (auto index : request_responses.in_reverse())
+        m_items.remove(index);
+
+    // 3. Append operation’s request/operation’s response to cache.
+    m_items.append(move(request_response));
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibHTTP/HeaderList.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Statuses.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#dictdef-cachequeryoptions
+struct CacheQueryOptions {
+    bool ignore_search { false };
+    bool ignore_method { false };
+    bool ignore_vary { false };
+};
+
+// The parts of a request that a request response list keeps, and that requests are matched against.
+struct CachedRequest {
+    static CachedRequest from_request(Fetch::Infrastructure::Request const&);
+
+    GC::Ref<Fetch::Infrastructure::Request> to_request(JS::VM&) const;
+
+    URL::URL url;
+    ByteString method;
+    NonnullRefPtr<HTTP::HeaderList> header_list;
+};
+
+// The internal response of a cached response, along with the type of filtered response that was put into the cache.
+struct CachedResponse {
+    GC::Ref<Fetch::Infrastructure::Response> to_response(JS::Realm&) const;
+
+    Fetch::Infrastructure::Response::Type type { Fetch::Infrastructure::Response::Type::Default };
+    Vector<URL::URL> url_list;
+    Fetch::Infrastructure::Status status { 200 };
+    ByteString status_message;
+    NonnullRefPtr<HTTP::HeaderList> header_list;
+    Vector<ByteString> cors_exposed_header_name_list;
+    Optional<ByteBuffer> body;
+};
+
+struct RequestResponse {
+    static RequestResponse create(CachedRequest, Fetch::Infrastructure::Response&, Optional<ByteBuffer> body);
+
+    // https://w3c.github.io/ServiceWorker/#request-matches-cached-item-algorithm
+    bool matches(CachedRequest const& request_query, StringView query_url, CacheQueryOptions const&) const;
+
+    CachedRequest request;
+    CachedResponse response;
+
+    // NB: These are computed once when the item is stored, as every query compares them against the request.
+    String url_without_fragment;
+    String url_without_fragment_and_query;
+    Optional<Vector<String>> vary_field_values;
+};
+
+// https://w3c.github.io/ServiceWorker/#request-response-list
+// NB: Request response lists are not allocated on the JS heap, as the Cache objects of every realm with the same storage
+//     key share them. Responses are kept with their body as bytes, and a fresh response is created whenever one is
+//     handed out.
+class RequestResponseList : public RefCounted<RequestResponseList> {
+public:
+    static NonnullRefPtr<RequestResponseList> create() { return adopt_ref(*new RequestResponseList); }
+
+    Vector<RequestResponse> const& items() const { return m_items; }
+
+    // https://w3c.github.io/ServiceWorker/#query-cache
+    // Returns the indices of the items that match, in the order they were stored in.
+    Vector<size_t> query(CachedRequest const& request_query, CacheQueryOptions const& = {}) const;
+
+    // https://w3c.github.io/ServiceWorker/#batch-cache-operations-algorithm
+    bool delete_matching(CachedRequest const&, CacheQueryOptions const&);
+    void put(RequestResponse);
+
+private:
+    RequestResponseList() = default;
+
+    Vector<RequestResponse> m_items;
+};
+
+}
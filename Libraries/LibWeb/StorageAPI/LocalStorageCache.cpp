@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/Function.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/StorageAPI/LocalStorageCache.h>
+#include <LibWeb/StorageAPI/StorageEndpoint.h>
+
+namespace Web::StorageAPI {
+
+static size_t size_of_item(String const& key, String const& value)
+{
+    return key.bytes().size() + value.bytes().size();
+}
+
+LocalStorageCache& LocalStorageCache::the()
+{
+    static LocalStorageCache s_the;
+    return s_the;
+}
+
+OrderedHashMap<String, String> const& LocalStorageCache::items(PageClient& client, String const& storage_key)
+{
+    return snapshot_for(client, storage_key).items;
+}
+
+size_t LocalStorageCache::size_in_bytes(PageClient& client, String const& storage_key)
+{
+    return snapshot_for(client, storage_key).size_in_bytes;
+}
+
+void LocalStorageCache::set_item(PageClient& client, String const& storage_key, String const& key, String const& value)
+{
+    auto& snapshot = snapshot_for(client, storage_key);
+
+    size_t old_size = 0;
+    if (auto old_value = snapshot.items.get(key); old_value.has_value())
+        old_size = size_of_item(key, old_value.value());
+    auto new_size = size_of_item(key, value);
+
+    snapshot.items.set(key, value);
+    snapshot.size_in_bytes = snapshot.size_in_bytes - old_size + new_size;
+    m_size_in_bytes = m_size_in_bytes - old_size + new_size;
+
+    pending_writes_for(client, storage_key).items.set(key, value);
+}
+
+void LocalStorageCache::remove_item(PageClient& client, String const& storage_key, String const& key)
+{
+    auto& snapshot = snapshot_for(client, storage_key);
+
+    auto old_value = snapshot.items.take(key);
+    if (!old_value.has_value())
+        return;
+
+    auto old_size = size_of_item(key, old_value.value());
+    snapshot.size_in_bytes -= old_size;
+    m_size_in_bytes -= old_size;
+
+    pending_writes_for(client, storage_key).items.set(key, OptionalNone {});
+}
+
+void LocalStorageCache::clear(PageClient& client, String const& storage_key)
+{
+    auto& snapshot = snapshot_for(client, storage_key);
+
+    m_size_in_bytes -= snapshot.size_in_bytes;
+    snapshot.size_in_bytes = 0;
+    snapshot.items.clear();
+
+    // NB: Clearing the storage makes any earlier writes to it irrelevant.
+    auto& pending_writes = pending_writes_for(client, storage_key);
+    pending_writes.clear = true;
+    pending_writes.items.clear();
+}
+
+void LocalStorageCache::storage_did_change(String const& storage_key)
+{
+    if (auto snapshot = m_snapshots.take(storage_key); snapshot.has_value())
+        m_size_in_bytes -= snapshot->size_in_bytes;
+}
+
+void LocalStorageCache::all_storage_did_change()
+{
+    m_snapshots.clear();
+    m_size_in_bytes = 0;
+}
+
+LocalStorageCache::Snapshot& LocalStorageCache::snapshot_for(PageClient& client, String const& storage_key)
+{
+    if (auto it = m_snapshots.find(storage_key); it != m_snapshots.end()) {
+        it->value.last_use = ++m_use_counter;
+        return it->value;
+    }
+
+    // NB: Our own writes to this storage have to reach the browser process before we read the storage back from it.
+    flush_pending_writes(storage_key);
+
+    Snapshot snapshot;
+    snapshot.items = client.page_did_request_storage_items(StorageEndpointType::LocalStorage, storage_key);
+    for (auto const& [key, value] : snapshot.items)
+        snapshot.size_in_bytes += size_of_item(key, value);
+    snapshot.last_use = ++m_use_counter;
+
+    // NB: The snapshot that is about to be used is kept even if it does not fit into the cache on its own.
+    evict_until_size_is_at_most(capacity_in_bytes - min(snapshot.size_in_bytes, capacity_in_bytes));
+
+    m_size_in_bytes += snapshot.size_in_bytes;
+    return m_snapshots.ensure(storage_key, [&] { return move(snapshot); });
+}
+
+LocalStorageCache::PendingWrites& LocalStorageCache::pending_writes_for(PageClient& client, String const& storage_key)
+{
+    auto& pending_writes = m_pending_writes.ensure(storage_key);
+    if (!pending_writes.client)
+        pending_writes.client = GC::make_root(client);
+
+    if (!m_flush_is_scheduled) {
+        m_flush_is_scheduled = true;
+        Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(client.heap(), [this] {
+            flush_all_pending_writes();
+        }));
+    }
+
+    return pending_writes;
+}
+
+void LocalStorageCache::flush_pending_writes(String const& storage_key)
+{
+    if (auto pending_writes = m_pending_writes.take(storage_key); pending_writes.has_value())
+        flush(storage_key, pending_writes.value());
+}
+
+void LocalStorageCache::flush_all_pending_writes()
+{
+    m_flush_is_scheduled = false;
+
+    auto pending_writes = move(m_pending_writes);
+    for (auto const& [storage_key, writes] : pending_writes)
+        flush(storage_key, writes);
+}
+
+void LocalStorageCache::flush(String const& storage_key, PendingWrites const& pending_writes)
+{
+    auto& client = *pending_writes.client;
+
+    if (pending_writes.clear)
+        client.page_did_clear_storage(StorageEndpointType::LocalStorage, storage_key);
+
+    for (auto const& [key, value] : pending_writes.items) {
+        if (value.has_value())
+            client.page_did_set_storage_item(StorageEndpointType::LocalStorage, storage_key, key, value.value());
+        else
+            client.page_did_remove_storage_item(StorageEndpointType::LocalStorage, storage_key, key);
+    }
+}
+
+void LocalStorageCache::evict_until_size_is_at_most(size_t size)
+{
+    while (m_size_in_bytes > size && !m_snapshots.is_empty()) {
+        auto least_recently_used = m_snapshots.begin();
+        for (auto it = m_snapshots.begin(); it != m_snapshots.end(); ++it) {
+            if (it->value.last_use < least_recently_used->value.last_use)
+                least_recently_used = it;
+        }
+        m_size_in_bytes -= least_recently_used->value.size_in_bytes;
+        m_snapshots.remove(least_recently_used);
+    }
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <LibGC/Root.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::StorageAPI {
+
+// Local storage lives in the browser process, so that every WebContent process sees the same storage. To not ask the
+// browser process every time a page reads from localStorage, we keep a snapshot of the local storage of each storage
+// key that is in use. Writes are applied to the snapshot right away, and are sent to the browser process together once
+// the current task is done, with only the last write to each item being sent.
+// The browser process tells us to drop a snapshot when another WebContent process changes the storage behind it, and
+// we load it again the next time it is read.
+// NB: Storage is only ever accessed on the main thread, so this must only be used from the main thread as well.
+class LocalStorageCache {
+public:
+    static LocalStorageCache& the();
+
+    OrderedHashMap<String, String> const& items(PageClient&, String const& storage_key);
+    size_t size_in_bytes(PageClient&, String const& storage_key);
+
+    void set_item(PageClient&, String const& storage_key, String const& key, String const& value);
+    void remove_item(PageClient&, String const& storage_key, String const& key);
+    void clear(PageClient&, String const& storage_key);
+
+    void storage_did_change(String const& storage_key);
+    void all_storage_did_change();
+
+private:
+    static constexpr size_t capacity_in_bytes = 16 * MiB;
+
+    struct Snapshot {
+        OrderedHashMap<String, String> items;
+        size_t size_in_bytes { 0 };
+        u64 last_use { 0 };
+    };
+
+    // An empty value means that the item was removed.
+    struct PendingWrites {
+        GC::Root<PageClient> client;
+        bool clear { false };
+        OrderedHashMap<String, Optional<String>> items;
+    };
+
+    Snapshot& snapshot_for(PageClient&, String const& storage_key);
+    PendingWrites& pending_writes_for(PageClient&, String const& storage_key);
+
+    void flush_pending_writes(String const& storage_key);
+    void flush_all_pending_writes();
+    static void flush(String const& storage_key, PendingWrites const&);
+
+    void evict_until_size_is_at_most(size_t);
+
+    HashMap<String, Snapshot> m_snapshots;
+    size_t m_size_in_bytes { 0 };
+    u64 m_use_counter { 0 };
+
+    HashMap<String, PendingWrites> m_pending_writes;
+    bool m_flush_is_scheduled { false };
+};
+
+}
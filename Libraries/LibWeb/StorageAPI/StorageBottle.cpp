@@ -9,6 +9,7 @@
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/StorageAPI/LocalStorageCache.h>
 #include <LibWeb/StorageAPI/StorageBottle.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
 #include <LibWeb/StorageAPI/StorageShed.h>
@@ -107,32 +108,51 @@ void LocalStorageBottle::visit_edges(GC::Cell::Visitor& visitor)
 
 size_t LocalStorageBottle::size() const
 {
-    return m_page->client().page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string()).size();
+    return LocalStorageCache::the().items(m_page->client(), m_storage_key).size();
 }
 
 Vector<String> LocalStorageBottle::keys() const
 {
-    return m_page->client().page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string());
+    return LocalStorageCache::the().items(m_page->client(), m_storage_key).keys();
 }
 
 Optional<String> LocalStorageBottle::get(String const& key) const
 {
-    return m_page->client().page_did_request_storage_item(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string(), key);
+    if (auto value = LocalStorageCache::the().items(m_page->client(), m_storage_key).get(key); value.has_value())
+        return value.value();
+    return OptionalNone {};
 }
 
 WebView::StorageSetResult LocalStorageBottle::set(String const& key, String const& value)
 {
-    return m_page->client().page_did_set_storage_item(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string(), key, value);
+    auto& cache = LocalStorageCache::the();
+    auto old_value = get(key);
+
+    // NB: Storage does not change anything when the value stays the same, so there is nothing to write either.
+    if (old_value == value)
+        return old_value;
+
+    if (m_quota.has_value()) {
+        size_t current_size = cache.size_in_bytes(m_page->client(), m_storage_key);
+        if (old_value.has_value())
+            current_size -= key.bytes().size() + old_value->bytes().size();
+        size_t new_size = key.bytes().size() + value.bytes().size();
+        if (current_size + new_size > m_quota.value())
+            return WebView::StorageOperationError::QuotaExceededError;
+    }
+
+    cache.set_item(m_page->client(), m_storage_key, key, value);
+    return old_value;
 }
 
 void LocalStorageBottle::clear()
 {
-    m_page->client().page_did_clear_storage(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string());
+    LocalStorageCache::the().clear(m_page->client(), m_storage_key);
 }
 
 void LocalStorageBottle::remove(String const& key)
 {
-    m_page->client().page_did_remove_storage_item(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string(), key);
+    LocalStorageCache::the().remove_item(m_page->client(), m_storage_key, key);
 }
 
 size_t SessionStorageBottle::size() const
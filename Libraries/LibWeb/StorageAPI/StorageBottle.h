@@ -69,15 +69,17 @@ public:
     virtual void visit_edges(GC::Cell::Visitor& visitor) override;
 
 private:
-    explicit LocalStorageBottle(GC::Ref<Page> page, StorageKey key, Optional<u64> quota)
+    explicit LocalStorageBottle(GC::Ref<Page> page, StorageKey const& key, Optional<u64> quota)
         : StorageBottle(quota)
         , m_page(move(page))
-        , m_storage_key(move(key))
+        , m_storage_key(key.to_string())
     {
     }
 
     GC::Ref<Page> m_page;
-    StorageKey m_storage_key;
+
+    // NB: The storage key is only ever needed in its serialized form, which is what the local storage is looked up by.
+    String m_storage_key;
 };
 
 class SessionStorageBottle final : public StorageBottle {
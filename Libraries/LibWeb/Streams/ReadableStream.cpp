@@ -279,7 +279,7 @@ WebIDL::ExceptionOr<GC::Ref<ReadableStreamDefaultReader>> ReadableStream::get_a_
 }
 
 // https://streams.spec.whatwg.org/#readablestream-pull-from-bytes
-WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
+WebIDL::ExceptionOr<size_t> ReadableStream::pull_from_bytes(ReadonlyBytes bytes)
 {
     auto& realm = this->realm();
 
@@ -301,14 +301,15 @@ WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
     auto pull_size = min(available, desired_size);
 
     // 6. Let pulled be the first pullSize bytes of bytes.
-    auto pulled = pull_size == available ? move(bytes) : MUST(bytes.slice(0, pull_size));
+    auto pulled = bytes.trim(pull_size);
 
     // 7. Remove the first pullSize bytes from bytes.
-    // NB: We skip this step. No caller actually wants its bytes trimmed, and we don't take the bytes by reference anyways.
+    // NB: We don't own the bytes, so we return pullSize instead and leave it to the caller to remove them.
 
     // 8. If stream’s current BYOB request view is non-null, then:
     if (auto byob_view = current_byob_request_view()) {
         // 1. Write pulled into stream’s current BYOB request view.
+        // NB: This copies the bytes straight from the caller's buffer into the reader's buffer.
         byob_view->write(pulled);
 
         // 2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
@@ -317,14 +318,15 @@ WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
     // 9. Otherwise,
     else {
         // 1. Set view to the result of creating a Uint8Array from pulled in stream’s relevant Realm.
-        auto array_buffer = JS::ArrayBuffer::create(realm, move(pulled));
+        auto array_buffer = TRY(JS::ArrayBuffer::create(realm, pull_size));
+        pulled.copy_to(array_buffer->buffer().bytes());
         auto view = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
 
         // 2. Perform ? ReadableByteStreamControllerEnqueue(stream.[[controller]], view).
         TRY(readable_byte_stream_controller_enqueue(controller, view));
     }
 
-    return {};
+    return pull_size;
 }
 
 // https://streams.spec.whatwg.org/#readablestream-current-byob-request-view
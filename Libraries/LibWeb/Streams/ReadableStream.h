@@ -109,7 +109,7 @@ public:
     void set_state(State value) { m_state = value; }
 
     WebIDL::ExceptionOr<GC::Ref<ReadableStreamDefaultReader>> get_a_reader();
-    WebIDL::ExceptionOr<void> pull_from_bytes(ByteBuffer);
+    WebIDL::ExceptionOr<size_t> pull_from_bytes(ReadonlyBytes);
     WebIDL::ExceptionOr<void> enqueue(JS::Value chunk);
     void set_up_with_byte_reading_support(GC::Ptr<PullAlgorithm> = {}, GC::Ptr<CancelAlgorithm> = {}, double high_water_mark = 0);
     GC::Ref<ReadableStream> piped_through(GC::Ref<TransformStream>, bool prevent_close = false, bool prevent_abort = false, bool prevent_cancel = false, GC::Ptr<DOM::AbortSignal> signal = {});
@@ -9,6 +9,8 @@
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibCore/EventLoop.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -19,6 +21,7 @@
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/ResponsePrototype.h>
@@ -40,6 +43,7 @@
 namespace Web::WebAssembly {
 
 static GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::VM&, ByteBuffer, HTML::Task::Source = HTML::Task::Source::Unspecified);
+static void settle_compile_promise(JS::Realm&, GC::Ref<WebIDL::Promise>, HTML::Task::Source, JS::ThrowCompletionOr<NonnullRefPtr<Detail::CompiledWebAssemblyModule>>);
 static GC::Ref<WebIDL::Promise> instantiate_promise_of_module(JS::VM&, GC::Ref<WebIDL::Promise>, GC::Ptr<JS::Object> import_object);
 static GC::Ref<WebIDL::Promise> asynchronously_instantiate_webassembly_module(JS::VM&, GC::Ref<Module>, GC::Ptr<JS::Object> import_object);
 static GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM&, GC::Ref<WebIDL::Promise>);
@@ -419,25 +423,113 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
     return instance_result.release_value();
 }
 
+namespace {
+
+// A process-wide cache of validated modules keyed by the hash of their bytes, so that documents which compile the same
+// module again, for example on a later visit to the same site, don't have to parse and validate it again.
+// NB: Modules are only ever compiled on the main thread, so this must only be used from the main thread as well.
+class ValidatedModuleCache {
+public:
+    using Key = Crypto::Hash::SHA256::DigestType;
+
+    static ValidatedModuleCache& the()
+    {
+        static ValidatedModuleCache s_the;
+        return s_the;
+    }
+
+    RefPtr<Wasm::Module> get(Key const& key)
+    {
+        auto it = m_modules.find(key);
+        if (it == m_modules.end())
+            return nullptr;
+        it->value.last_use = ++m_use_counter;
+        return it->value.module;
+    }
+
+    void set(Key const& key, NonnullRefPtr<Wasm::Module> module, size_t size_in_bytes)
+    {
+        if (size_in_bytes > capacity_in_bytes || m_modules.contains(key))
+            return;
+
+        while (m_size_in_bytes + size_in_bytes > capacity_in_bytes) {
+            auto least_recently_used = m_modules.begin();
+            for (auto it = m_modules.begin(); it != m_modules.end(); ++it) {
+                if (it->value.last_use < least_recently_used->value.last_use)
+                    least_recently_used = it;
+            }
+            m_size_in_bytes -= least_recently_used->value.size_in_bytes;
+            m_modules.remove(least_recently_used);
+        }
+
+        m_size_in_bytes += size_in_bytes;
+        m_modules.set(key, { move(module), size_in_bytes, ++m_use_counter });
+    }
+
+private:
+    // NB: This is measured in the size of the modules' bytes, which their parsed form is roughly proportional to.
+    static constexpr size_t capacity_in_bytes = 64 * MiB;
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key)
+        {
+            // NB: The digest is already uniformly distributed, so any part of it makes for a good hash.
+            unsigned digest_hash = 0;
+            __builtin_memcpy(&digest_hash, key.data, sizeof(digest_hash));
+            return digest_hash;
+        }
+    };
+
+    struct ValidatedModule {
+        NonnullRefPtr<Wasm::Module> module;
+        size_t size_in_bytes { 0 };
+        u64 last_use { 0 };
+    };
+
+    HashMap<Key, ValidatedModule, KeyTraits> m_modules;
+    size_t m_size_in_bytes { 0 };
+    u64 m_use_counter { 0 };
+};
+
+}
+
+static NonnullRefPtr<CompiledWebAssemblyModule> create_compiled_webassembly_module(JS::Realm& realm, NonnullRefPtr<Wasm::Module> module)
+{
+    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(move(module));
+    get_cache(realm).add_compiled_module(compiled_module);
+    return compiled_module;
+}
+
 // https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
 // https://webassembly.github.io/content-security-policy/js-api/#compile-a-webassembly-module
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM& vm, ByteBuffer data)
 {
     TRY(host_ensure_can_compile_wasm_bytes(vm));
 
-    FixedMemoryStream stream { data.bytes() };
+    auto digest = Crypto::Hash::SHA256::hash(data);
+    if (auto module = ValidatedModuleCache::the().get(digest))
+        return create_compiled_webassembly_module(*vm.current_realm(), module.release_nonnull());
+
+    auto module_or_error = parse_and_validate_webassembly_module(data.bytes());
+    if (module_or_error.is_error())
+        return vm.throw_completion<CompileError>(module_or_error.release_error());
+
+    ValidatedModuleCache::the().set(digest, module_or_error.value(), data.size());
+    return create_compiled_webassembly_module(*vm.current_realm(), module_or_error.release_value());
+}
+
+// NB: This does not depend on the VM or any other state of the realm, so that it can be done off the main thread.
+ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> parse_and_validate_webassembly_module(ReadonlyBytes data)
+{
+    FixedMemoryStream stream { data };
     auto module_result = Wasm::Module::parse(stream);
-    if (module_result.is_error()) {
-        return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
-    }
+    if (module_result.is_error())
+        return Wasm::parse_error_to_byte_string(module_result.error());
 
-    auto& cache = get_cache(*vm.current_realm());
-    if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
-        return vm.throw_completion<CompileError>(validation_result.error().error_string);
-    }
-    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
-    cache.add_compiled_module(compiled_module);
-    return compiled_module;
+    if (auto validation_result = Wasm::AbstractMachine::validate(module_result.value()); validation_result.is_error())
+        return validation_result.release_error().error_string;
+
+    return module_result.release_value();
 }
 
 // https://webassembly.github.io/spec/js-api/#HostResizeArrayBuffer
@@ -793,35 +885,78 @@ GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::VM& vm, B
     // 2. Run the following steps in parallel:
     Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(vm.heap(), [&vm, &realm, bytes = move(bytes), promise, task_source]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-        // 1. Compile the WebAssembly module bytes and store the result as module.
-        auto module_or_error = Detail::compile_a_webassembly_module(vm, move(bytes));
 
-        // 2. Queue a task to perform the following steps. If taskSource was provided, queue the task on that task source.
-        HTML::queue_a_task(task_source, nullptr, nullptr, GC::create_function(vm.heap(), [&realm, promise, module_or_error = move(module_or_error)]() mutable {
-            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-            auto& realm = HTML::relevant_realm(*promise->promise());
+        // 1. Compile the WebAssembly module bytes and store the result as module.
+        // NB: Parsing and validating large modules takes a long time, so we do that on the thread pool instead of blocking
+        //     the event loop, and then continue on the main thread.
+        if (auto result = Detail::host_ensure_can_compile_wasm_bytes(vm); result.is_error()) {
+            settle_compile_promise(realm, promise, task_source, result.release_error());
+            return;
+        }
 
-            // 1. If module is error, reject promise with a CompileError exception.
-            if (module_or_error.is_error()) {
-                WebIDL::reject_promise(realm, promise, module_or_error.error_value());
-            }
+        auto digest = Crypto::Hash::SHA256::hash(bytes);
+        if (auto module = Detail::ValidatedModuleCache::the().get(digest)) {
+            settle_compile_promise(realm, promise, task_source, Detail::create_compiled_webassembly_module(realm, module.release_nonnull()));
+            return;
+        }
 
-            // 2. Otherwise,
-            else {
-                // 1. Construct a WebAssembly module object from module and bytes, and let moduleObject be the result.
-                // FIXME: Save bytes to the Module instance instead of moving into compile_a_webassembly_module
-                auto module_object = realm.create<Module>(realm, module_or_error.release_value());
+        // NB: The callback is heap-allocated so that if the event loop is destroyed while compiling, we leak it (and the
+        //     GC::Root objects it captures) rather than destroying them on the worker thread.
+        auto* on_compiled = new Function<void(ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString>)>(
+            [&vm, realm = GC::make_root(realm), promise = GC::make_root(promise), task_source, digest, size_in_bytes = bytes.size()](ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> module_or_error) {
+                if (module_or_error.is_error()) {
+                    HTML::TemporaryExecutionContext context(*realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+                    settle_compile_promise(*realm, *promise, task_source, vm.throw_completion<CompileError>(module_or_error.release_error()));
+                    return;
+                }
 
-                // 2. Resolve promise with moduleObject.
-                WebIDL::resolve_promise(realm, promise, module_object);
-            }
-        }));
+                Detail::ValidatedModuleCache::the().set(digest, module_or_error.value(), size_in_bytes);
+                settle_compile_promise(*realm, *promise, task_source, Detail::create_compiled_webassembly_module(*realm, module_or_error.release_value()));
+            });
+        auto event_loop_weak = Core::EventLoop::current_weak();
+
+        Threading::ThreadPool::the().submit([bytes = move(bytes), on_compiled, event_loop_weak = move(event_loop_weak)]() mutable {
+            auto module_or_error = Detail::parse_and_validate_webassembly_module(bytes.bytes());
+            bytes.clear();
+
+            auto origin = event_loop_weak->take();
+            if (!origin)
+                return;
+            origin->deferred_invoke([module_or_error = move(module_or_error), on_compiled]() mutable {
+                (*on_compiled)(move(module_or_error));
+                delete on_compiled;
+            });
+        });
     }));
 
     // 3. Return promise.
     return promise;
 }
 
+static void settle_compile_promise(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise, HTML::Task::Source task_source, JS::ThrowCompletionOr<NonnullRefPtr<Detail::CompiledWebAssemblyModule>> module_or_error)
+{
+    // 2. Queue a task to perform the following steps. If taskSource was provided, queue the task on that task source.
+    HTML::queue_a_task(task_source, nullptr, nullptr, GC::create_function(realm.heap(), [&realm, promise, module_or_error = move(module_or_error)]() mutable {
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        auto& realm = HTML::relevant_realm(*promise->promise());
+
+        // 1. If module is error, reject promise with a CompileError exception.
+        if (module_or_error.is_error()) {
+            WebIDL::reject_promise(realm, promise, module_or_error.error_value());
+        }
+
+        // 2. Otherwise,
+        else {
+            // 1. Construct a WebAssembly module object from module and bytes, and let moduleObject be the result.
+            // FIXME: Save bytes to the Module instance instead of moving into compile_a_webassembly_module
+            auto module_object = realm.create<Module>(realm, module_or_error.release_value());
+
+            // 2. Resolve promise with moduleObject.
+            WebIDL::resolve_promise(realm, promise, module_object);
+        }
+    }));
+}
+
 // https://webassembly.github.io/spec/js-api/#asynchronously-instantiate-a-webassembly-module
 GC::Ref<WebIDL::Promise> asynchronously_instantiate_webassembly_module(JS::VM& vm, GC::Ref<Module> module_object, GC::Ptr<JS::Object> import_object)
 {
@@ -13,6 +13,7 @@
 #include <LibWeb/Bindings/AnalyserNodePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AnalyserNode.h>
+#include <LibWeb/WebAudio/AudioKernels.h>
 #include <LibWeb/WebIDL/Buffers.h>
 #include <LibWeb/WebIDL/DOMException.h>
 
@@ -65,13 +66,14 @@ Vector<f32> AnalyserNode::apply_a_blackman_window(Vector<f32> const& x) const
         return a0 - a1 * cos(2 * AK::Pi<f32> * (f32)n / (f32)N) + a2 * cos(4 * AK::Pi<f32> * (f32)n / (f32)N);
     };
 
-    Vector<f32> x_hat;
-    x_hat.resize(m_fft_size);
+    if (m_blackman_window.size() != N) {
+        m_blackman_window.resize(N);
+        for (unsigned long i = 0; i < N; i++)
+            m_blackman_window[i] = w(i);
+    }
 
-    // FIXME: Naive
-    for (unsigned long i = 0; i < m_fft_size; i++) {
-        x_hat[i] = x[i] * w(i);
-    };
+    Vector<f32> x_hat = x;
+    multiply_samples(x_hat, m_blackman_window);
 
     return x_hat;
 }
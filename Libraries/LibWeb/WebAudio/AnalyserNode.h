@@ -72,6 +72,9 @@ private:
     // https://webaudio.github.io/web-audio-api/#blackman-window
     Vector<f32> apply_a_blackman_window(Vector<f32> const& x) const;
 
+    // The Blackman window for the current fftSize, which we only compute again when the fftSize changes.
+    mutable Vector<f32> m_blackman_window;
+
     // https://webaudio.github.io/web-audio-api/#smoothing-over-time
     Vector<f32> smoothing_over_time(Vector<f32> const& current_block);
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibMedia/Audio/PlaybackStream.h>
 #include <LibWeb/Bindings/AudioContextPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/DOM/Document.h>
@@ -15,6 +16,9 @@
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/WebAudio/AudioContext.h>
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/AudioRenderer.h>
+#include <LibWeb/WebAudio/ControlMessageQueue.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::WebAudio {
@@ -102,6 +106,7 @@ WebIDL::ExceptionOr<GC::Ref<AudioContext>> AudioContext::construct_impl(JS::Real
 
         // 2. Set this [[rendering thread state]] to running on the AudioContext.
         context->set_rendering_state(Bindings::AudioContextState::Running);
+        context->start_rendering_audio_graph();
 
         // 3. Queue a media element task to execute the following steps:
         context->queue_a_media_element_task(GC::create_function(context->heap(), [context]() {
@@ -265,6 +270,7 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::suspend()
 
     // 7.2: Set the [[rendering thread state]] on the AudioContext to suspended.
     set_rendering_state(Bindings::AudioContextState::Suspended);
+    suspend_rendering_audio_graph();
 
     // 7.3: queue a media element task to execute the following steps:
     queue_a_media_element_task(GC::create_function(heap(), [promise, this]() {
@@ -314,7 +320,8 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::close()
 
     // 5. Queue a control message to close the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
-    // FIXME: 5.1: Attempt to release system resources.
+    // 5.1: Attempt to release system resources.
+    m_playback_stream = nullptr;
 
     // 5.2: Set the [[rendering thread state]] to "suspended".
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -344,11 +351,77 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::close()
     return promise;
 }
 
-// FIXME: Actually implement the rendering thread
+// https://webaudio.github.io/web-audio-api/#rendering-loop
 bool AudioContext::start_rendering_audio_graph()
 {
-    bool render_result = true;
-    return render_result;
+    if (m_playback_stream) {
+        m_playback_stream->resume()->when_rejected([](auto&& error) {
+            warnln("Unexpected error while resuming AudioContext: {}", error);
+        });
+        return true;
+    }
+    if (m_renderer)
+        return true;
+
+    m_renderer = AudioRenderer::create(control_message_queue(), sample_rate());
+    submit_audio_graph();
+
+    // NB: The audio output calls this on its real-time thread, so it must only touch the renderer, which it keeps alive
+    //     for as long as it may still call it.
+    auto data_request_callback = [renderer = NonnullRefPtr { *m_renderer }](Span<float> buffer) {
+        return renderer->render(buffer);
+    };
+    constexpr u32 target_latency_ms = 20;
+
+    auto promise = Audio::PlaybackStream::create(Audio::OutputState::Suspended, target_latency_ms, move(data_request_callback));
+    promise->when_resolved([weak_self = GC::Weak { *this }](auto& stream) {
+        if (!weak_self || weak_self->state() == Bindings::AudioContextState::Closed)
+            return;
+
+        weak_self->m_renderer->set_output_sample_specification(stream->sample_specification());
+        weak_self->m_playback_stream = stream;
+        if (weak_self->state() == Bindings::AudioContextState::Running)
+            weak_self->start_rendering_audio_graph();
+    });
+    promise->when_rejected([](auto& error) {
+        warnln("Failed to create the audio output for AudioContext: {}", error);
+    });
+
+    return true;
+}
+
+void AudioContext::suspend_rendering_audio_graph()
+{
+    if (!m_playback_stream)
+        return;
+    m_playback_stream->discard_buffer_and_suspend()->when_rejected([](auto&& error) {
+        warnln("Unexpected error while suspending AudioContext: {}", error);
+    });
+}
+
+void AudioContext::submit_audio_graph()
+{
+    m_renderer->submit_graph(RenderGraph::compile(*m_destination, sample_rate()));
+}
+
+double AudioContext::current_time() const
+{
+    if (m_renderer)
+        return m_renderer->current_time();
+    return Base::current_time();
+}
+
+void AudioContext::audio_graph_did_change()
+{
+    if (!m_renderer || m_audio_graph_submission_pending)
+        return;
+
+    // NB: Graphs tend to be changed many times in a row, so we compile them once all of those changes are done.
+    m_audio_graph_submission_pending = true;
+    queue_a_media_element_task(GC::create_function(heap(), [this]() {
+        m_audio_graph_submission_pending = false;
+        submit_audio_graph();
+    }));
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audiocontext-createmediaelementsource
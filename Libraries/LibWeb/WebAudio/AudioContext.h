@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Variant.h>
+#include <LibMedia/Audio/Forward.h>
 #include <LibWeb/Bindings/AudioContextPrototype.h>
 #include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
@@ -14,6 +15,8 @@
 
 namespace Web::WebAudio {
 
+class AudioRenderer;
+
 struct AudioContextOptions {
     Variant<Bindings::AudioContextLatencyCategory, double> latency_hint = Bindings::AudioContextLatencyCategory::Interactive;
     Optional<float> sample_rate;
@@ -43,6 +46,9 @@ public:
 
     WebIDL::ExceptionOr<GC::Ref<MediaElementAudioSourceNode>> create_media_element_source(GC::Ptr<HTML::HTMLMediaElement>);
 
+    virtual double current_time() const override;
+    virtual void audio_graph_did_change() override;
+
 private:
     explicit AudioContext(JS::Realm& realm)
         : BaseAudioContext(realm)
@@ -60,6 +66,12 @@ private:
     bool m_suspended_by_user = false;
 
     bool start_rendering_audio_graph();
+    void suspend_rendering_audio_graph();
+    void submit_audio_graph();
+
+    RefPtr<AudioRenderer> m_renderer;
+    RefPtr<Audio::PlaybackStream> m_playback_stream;
+    bool m_audio_graph_submission_pending { false };
 };
 
 }
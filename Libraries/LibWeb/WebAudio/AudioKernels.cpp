@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibWeb/WebAudio/AudioKernels.h>
+
+namespace Web::WebAudio {
+
+using namespace AK::SIMD;
+
+void scale_samples(Span<float> samples, float factor)
+{
+    auto* data = samples.data();
+    size_t count = samples.size();
+    size_t i = 0;
+
+    auto factors = expand4(factor);
+    for (; count - i >= 4; i += 4)
+        store_unaligned(data + i, load_unaligned<f32x4>(data + i) * factors);
+
+    for (; i < count; ++i)
+        data[i] *= factor;
+}
+
+void add_scaled_samples(Span<float> destination, ReadonlySpan<float> source, float factor)
+{
+    VERIFY(source.size() == destination.size());
+
+    auto* output = destination.data();
+    auto const* input = source.data();
+    size_t count = destination.size();
+    size_t i = 0;
+
+    // NB: Mixing inputs without scaling them is by far the most common case, so we leave out the multiplication for it.
+    if (factor == 1.0f) {
+        for (; count - i >= 4; i += 4)
+            store_unaligned(output + i, load_unaligned<f32x4>(output + i) + load_unaligned<f32x4>(input + i));
+    } else {
+        auto factors = expand4(factor);
+        for (; count - i >= 4; i += 4)
+            store_unaligned(output + i, load_unaligned<f32x4>(output + i) + (load_unaligned<f32x4>(input + i) * factors));
+    }
+
+    for (; i < count; ++i)
+        output[i] += input[i] * factor;
+}
+
+void multiply_samples(Span<float> destination, ReadonlySpan<float> source)
+{
+    VERIFY(source.size() == destination.size());
+
+    auto* output = destination.data();
+    auto const* input = source.data();
+    size_t count = destination.size();
+    size_t i = 0;
+
+    for (; count - i >= 4; i += 4)
+        store_unaligned(output + i, load_unaligned<f32x4>(output + i) * load_unaligned<f32x4>(input + i));
+
+    for (; i < count; ++i)
+        output[i] *= input[i];
+}
+
+}
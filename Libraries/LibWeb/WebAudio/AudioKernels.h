@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <LibWeb/Export.h>
+
+// Operations on whole blocks of samples at once, so that they can process several samples per instruction. The source
+// and destination spans must have the same number of samples.
+namespace Web::WebAudio {
+
+// Multiplies each sample by the given factor.
+WEB_API void scale_samples(Span<float> samples, float factor);
+
+// Adds each source sample multiplied by the given factor to the destination sample at the same position.
+WEB_API void add_scaled_samples(Span<float> destination, ReadonlySpan<float> source, float factor);
+
+// Multiplies each destination sample by the source sample at the same position.
+WEB_API void multiply_samples(Span<float> destination, ReadonlySpan<float> source);
+
+}
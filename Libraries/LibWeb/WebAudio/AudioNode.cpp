@@ -83,6 +83,7 @@ WebIDL::ExceptionOr<GC::Ref<AudioNode>> AudioNode::connect(GC::Ref<AudioNode> de
     m_output_connections.append(output_connection);
     // Connect destination_node input to node's output.
     destination_node->m_input_connections.append(input_connection);
+    m_context->audio_graph_did_change();
 
     return destination_node;
 }
@@ -130,6 +131,7 @@ void AudioNode::disconnect()
     }
 
     m_param_connections.clear();
+    m_context->audio_graph_did_change();
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-output
@@ -156,6 +158,7 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(WebIDL::UnsignedLong output)
     m_param_connections.remove_all_matching([&](AudioParamConnection& connection) {
         return connection.output == output;
     });
+    m_context->audio_graph_did_change();
 
     return {};
 }
@@ -180,6 +183,7 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_n
     if (m_output_connections.size() == before) {
         return WebIDL::InvalidAccessError::create(realm(), Utf16String::formatted("No connection to given AudioNode"));
     }
+    m_context->audio_graph_did_change();
 
     return {};
 }
@@ -210,6 +214,7 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_n
     if (m_output_connections.size() == before) {
         return WebIDL::InvalidAccessError::create(realm(), Utf16String::formatted("No connection from output {} to given AudioNode", output));
     }
+    m_context->audio_graph_did_change();
 
     return {};
 }
@@ -246,6 +251,7 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_n
     if (m_output_connections.size() == before) {
         return WebIDL::InvalidAccessError::create(realm(), Utf16String::formatted("No connection from output {} to input {} of given AudioNode", output, input));
     }
+    m_context->audio_graph_did_change();
 
     return {};
 }
@@ -298,6 +304,7 @@ WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong chan
         return WebIDL::NotSupportedError::create(realm(), "Invalid channel count"_utf16);
 
     m_channel_count = channel_count;
+    m_context->audio_graph_did_change();
     return {};
 }
 
@@ -305,6 +312,7 @@ WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong chan
 WebIDL::ExceptionOr<void> AudioNode::set_channel_count_mode(Bindings::ChannelCountMode channel_count_mode)
 {
     m_channel_count_mode = channel_count_mode;
+    m_context->audio_graph_did_change();
     return {};
 }
 
@@ -318,6 +326,7 @@ Bindings::ChannelCountMode AudioNode::channel_count_mode()
 WebIDL::ExceptionOr<void> AudioNode::set_channel_interpretation(Bindings::ChannelInterpretation channel_interpretation)
 {
     m_channel_interpretation = channel_interpretation;
+    m_context->audio_graph_did_change();
     return {};
 }
 
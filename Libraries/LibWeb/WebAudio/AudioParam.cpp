@@ -46,6 +46,7 @@ float AudioParam::value() const
 void AudioParam::set_value(float value)
 {
     m_current_value = value;
+    m_context->audio_graph_did_change();
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-automationrate
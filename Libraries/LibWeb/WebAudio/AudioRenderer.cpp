@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/AudioRenderer.h>
+#include <LibWeb/WebAudio/BaseAudioContext.h>
+
+namespace Web::WebAudio {
+
+static constexpr size_t quantum_size = BaseAudioContext::render_quantum_size();
+
+NonnullRefPtr<AudioRenderer> AudioRenderer::create(NonnullRefPtr<ControlMessageQueue> control_message_queue, float sample_rate)
+{
+    return adopt_ref(*new AudioRenderer(move(control_message_queue), sample_rate));
+}
+
+AudioRenderer::AudioRenderer(NonnullRefPtr<ControlMessageQueue> control_message_queue, float sample_rate)
+    : m_control_message_queue(move(control_message_queue))
+    , m_sample_rate(sample_rate)
+    , m_frame_in_quantum(quantum_size)
+{
+    m_unapplied_control_messages.ensure_capacity(max_unapplied_control_messages);
+}
+
+AudioRenderer::~AudioRenderer()
+{
+    delete m_submitted_graph.exchange(nullptr);
+    delete m_retired_graph.exchange(nullptr);
+}
+
+void AudioRenderer::set_output_sample_specification(Audio::SampleSpecification sample_specification)
+{
+    m_output_sample_specification = sample_specification;
+    m_resampling_step = static_cast<double>(m_sample_rate) / sample_specification.sample_rate();
+    m_previous_frame.resize(sample_specification.channel_count());
+    m_next_frame.resize(sample_specification.channel_count());
+}
+
+void AudioRenderer::submit_graph(NonnullOwnPtr<RenderGraph> graph)
+{
+    delete m_retired_graph.exchange(nullptr, AK::MemoryOrder::memory_order_acq_rel);
+
+    // NB: If the rendering thread hasn't picked up the previous graph yet, it never will, so we can free it right away.
+    delete m_submitted_graph.exchange(graph.leak_ptr(), AK::MemoryOrder::memory_order_acq_rel);
+}
+
+double AudioRenderer::current_time() const
+{
+    return static_cast<double>(m_rendered_frame_count.load(AK::MemoryOrder::memory_order_acquire)) / m_sample_rate;
+}
+
+void AudioRenderer::adopt_submitted_graph()
+{
+    // NB: We can only hand back one graph at a time, so we keep rendering the current one until the control thread has
+    //     freed the one we handed back before.
+    if (m_retired_graph.load(AK::MemoryOrder::memory_order_acquire) != nullptr)
+        return;
+
+    auto* submitted_graph = m_submitted_graph.exchange(nullptr, AK::MemoryOrder::memory_order_acq_rel);
+    if (!submitted_graph)
+        return;
+
+    auto graph = adopt_own(*submitted_graph);
+    auto keep_unapplied_message = [this](ControlMessage message) {
+        if (m_unapplied_control_messages.size() < max_unapplied_control_messages)
+            m_unapplied_control_messages.unchecked_append(move(message));
+    };
+
+    m_unapplied_control_messages.remove_all_matching([&](ControlMessage const& message) {
+        return graph->apply_control_message(message);
+    });
+    if (m_graph)
+        graph->take_state_from(*m_graph, keep_unapplied_message);
+
+    m_retired_graph.store(m_graph.leak_ptr(), AK::MemoryOrder::memory_order_release);
+    m_graph = move(graph);
+}
+
+void AudioRenderer::render_quantum()
+{
+    adopt_submitted_graph();
+
+    m_control_message_queue->drain([&](ControlMessage message) {
+        if (m_graph && m_graph->apply_control_message(message))
+            return;
+        if (m_unapplied_control_messages.size() < max_unapplied_control_messages)
+            m_unapplied_control_messages.unchecked_append(move(message));
+    });
+
+    auto first_frame = m_rendered_frame_count.load(AK::MemoryOrder::memory_order_relaxed);
+    if (m_graph)
+        m_graph->render_quantum(first_frame);
+    m_rendered_frame_count.store(first_frame + quantum_size, AK::MemoryOrder::memory_order_release);
+}
+
+void AudioRenderer::advance_frame()
+{
+    swap(m_previous_frame, m_next_frame);
+
+    if (m_frame_in_quantum == quantum_size) {
+        render_quantum();
+        m_frame_in_quantum = 0;
+    }
+
+    // FIXME: Down-mix the destination to the channels of the output if it has fewer of them.
+    auto graph_channel_count = m_graph ? m_graph->channel_count() : 0;
+    for (size_t channel = 0; channel < m_next_frame.size(); ++channel) {
+        if (graph_channel_count == 1)
+            m_next_frame[channel] = m_graph->channel(0)[m_frame_in_quantum];
+        else if (channel < graph_channel_count)
+            m_next_frame[channel] = m_graph->channel(channel)[m_frame_in_quantum];
+        else
+            m_next_frame[channel] = 0.0f;
+    }
+    ++m_frame_in_quantum;
+}
+
+ReadonlySpan<float> AudioRenderer::render(Span<float> buffer)
+{
+    auto channel_count = m_output_sample_specification.channel_count();
+    if (channel_count == 0) {
+        buffer.fill(0.0f);
+        return buffer;
+    }
+
+    auto frame_count = buffer.size() / channel_count;
+    for (size_t frame = 0; frame < frame_count; ++frame) {
+        while (m_resampling_position >= 1.0) {
+            advance_frame();
+            m_resampling_position -= 1.0;
+        }
+
+        auto* output = buffer.offset_pointer(frame * channel_count);
+        auto position = static_cast<float>(m_resampling_position);
+        for (size_t channel = 0; channel < channel_count; ++channel)
+            output[channel] = m_previous_frame[channel] + ((m_next_frame[channel] - m_previous_frame[channel]) * position);
+        m_resampling_position += m_resampling_step;
+    }
+
+    return buffer.trim(frame_count * channel_count);
+}
+
+}
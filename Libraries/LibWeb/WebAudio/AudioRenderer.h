@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibMedia/Audio/SampleSpecification.h>
+#include <LibWeb/WebAudio/ControlMessageQueue.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
+
+namespace Web::WebAudio {
+
+// Renders the graph of an AudioContext on the real-time thread of its audio output, one render quantum at a time.
+// Rendering never allocates or waits for the control thread: compiled graphs are handed over through an atomic pointer,
+// and control messages through the ControlMessageQueue.
+class AudioRenderer : public AtomicRefCounted<AudioRenderer> {
+public:
+    static NonnullRefPtr<AudioRenderer> create(NonnullRefPtr<ControlMessageQueue>, float sample_rate);
+
+    ~AudioRenderer();
+
+    // Called by the control thread. The output sample specification must be set before the output starts playing.
+    void set_output_sample_specification(Audio::SampleSpecification);
+    void submit_graph(NonnullOwnPtr<RenderGraph>);
+    double current_time() const;
+
+    // Called by the rendering thread to fill the interleaved buffer of the audio output.
+    ReadonlySpan<float> render(Span<float>);
+
+private:
+    static constexpr size_t max_unapplied_control_messages = 256;
+
+    AudioRenderer(NonnullRefPtr<ControlMessageQueue>, float sample_rate);
+
+    void adopt_submitted_graph();
+    void render_quantum();
+    void advance_frame();
+
+    NonnullRefPtr<ControlMessageQueue> m_control_message_queue;
+    float m_sample_rate { 0 };
+    Audio::SampleSpecification m_output_sample_specification;
+
+    // The control thread submits new graphs, and the rendering thread hands back the graphs it has replaced, so that the
+    // control thread can free them.
+    Atomic<RenderGraph*> m_submitted_graph { nullptr };
+    Atomic<RenderGraph*> m_retired_graph { nullptr };
+
+    Atomic<u64> m_rendered_frame_count { 0 };
+
+    // Everything below is only accessed by the rendering thread.
+    OwnPtr<RenderGraph> m_graph;
+
+    // Control messages for nodes that are not connected to the destination, which we apply once they are.
+    Vector<ControlMessage> m_unapplied_control_messages;
+
+    size_t m_frame_in_quantum { 0 };
+
+    // NB: The output may run at a different sample rate than the context, in which case we resample by interpolating
+    //     between the two rendered frames around each output frame.
+    // FIXME: Use a resampler with better quality than linear interpolation.
+    double m_resampling_step { 1 };
+    double m_resampling_position { 1 };
+    Vector<float> m_previous_frame;
+    Vector<float> m_next_frame;
+};
+
+}
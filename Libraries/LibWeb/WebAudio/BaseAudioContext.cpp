@@ -34,7 +34,7 @@ BaseAudioContext::BaseAudioContext(JS::Realm& realm, float sample_rate)
     : DOM::EventTarget(realm)
     , m_sample_rate(sample_rate)
     , m_listener(AudioListener::create(realm, *this))
-    , m_control_message_queue(make<ControlMessageQueue>())
+    , m_control_message_queue(make_ref_counted<ControlMessageQueue>())
 {
 }
 
@@ -223,7 +223,6 @@ void BaseAudioContext::queue_a_media_element_task(GC::Ref<GC::Function<void()>>
 void BaseAudioContext::queue_control_message(ControlMessage message)
 {
     m_control_message_queue->enqueue(move(message));
-    // FIXME: Should signal the rendering thread when implemented
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-decodeaudiodata
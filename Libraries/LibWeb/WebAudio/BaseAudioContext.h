@@ -48,11 +48,11 @@ public:
     static constexpr float MIN_SAMPLE_RATE { 8000 };
     static constexpr float MAX_SAMPLE_RATE { 192000 };
 
-    static WebIDL::UnsignedLong render_quantum_size() { return s_render_quantum_size; }
+    static constexpr WebIDL::UnsignedLong render_quantum_size() { return s_render_quantum_size; }
 
     GC::Ref<AudioDestinationNode> destination() const { return *m_destination; }
     float sample_rate() const { return m_sample_rate; }
-    double current_time() const { return m_current_time; }
+    virtual double current_time() const { return m_current_time; }
     GC::Ref<AudioListener> listener() const { return m_listener; }
     Bindings::AudioContextState state() const { return m_control_thread_state; }
 
@@ -92,6 +92,9 @@ public:
 
     void queue_control_message(ControlMessage);
 
+    // Called whenever the nodes of the graph, their connections or their parameters change.
+    virtual void audio_graph_did_change() { }
+
     NodeID next_node_id(Badge<AudioNode>) { return ++m_next_node_id; }
 
 protected:
@@ -102,6 +105,8 @@ protected:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    NonnullRefPtr<ControlMessageQueue> const& control_message_queue() const { return m_control_message_queue; }
+
     GC::Ptr<AudioDestinationNode> m_destination;
     Vector<GC::Ref<WebIDL::Promise>> m_pending_promises;
 
@@ -123,7 +128,7 @@ private:
 
     HTML::UniqueTaskSource m_media_element_event_task_source {};
 
-    NonnullOwnPtr<ControlMessageQueue> m_control_message_queue;
+    NonnullRefPtr<ControlMessageQueue> m_control_message_queue;
 };
 
 }
@@ -10,13 +10,25 @@ namespace Web::WebAudio {
 void ControlMessageQueue::enqueue(ControlMessage message)
 {
     Threading::MutexLocker locker(m_mutex);
-    m_messages.append(move(message));
+
+    // NB: Once there is a backlog, later messages have to go behind it to keep them in order.
+    auto tail = m_tail.load(AK::MemoryOrder::memory_order_relaxed);
+    if (m_backlog.is_empty() && tail - m_head.load(AK::MemoryOrder::memory_order_acquire) < capacity) {
+        m_messages[tail % capacity] = move(message);
+        m_tail.store(tail + 1, AK::MemoryOrder::memory_order_release);
+        return;
+    }
+
+    m_backlog.append(move(message));
+    m_backlog_size.store(m_backlog.size(), AK::MemoryOrder::memory_order_release);
 }
 
 Vector<ControlMessage> ControlMessageQueue::drain()
 {
+    Vector<ControlMessage> messages;
     Threading::MutexLocker locker(m_mutex);
-    return move(m_messages);
+    drain([&](ControlMessage message) { messages.append(move(message)); });
+    return messages;
 }
 
 }
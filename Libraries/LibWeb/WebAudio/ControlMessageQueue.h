@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Optional.h>
 #include <AK/Vector.h>
 #include <LibThreading/Mutex.h>
 #include <LibWeb/Export.h>
@@ -14,15 +18,54 @@
 namespace Web::WebAudio {
 
 // https://webaudio.github.io/web-audio-api/#control-message-queue
-class WEB_API ControlMessageQueue {
+// Messages are passed from the control thread to the rendering thread through a fixed-size ring buffer, so that the
+// rendering thread never has to allocate or wait for a lock to receive them. Messages that don't fit into the ring
+// buffer are kept in a backlog, which the rendering thread only takes messages from if it can do so without waiting.
+class WEB_API ControlMessageQueue : public AtomicRefCounted<ControlMessageQueue> {
 
 public:
+    static constexpr size_t capacity = 256;
+
     void enqueue(ControlMessage);   // Called by the control thread.
-    Vector<ControlMessage> drain(); // Called by the rendering thread.
+    Vector<ControlMessage> drain(); // Called by the rendering thread, waits for the control thread to take the backlog.
+
+    // Called by the real-time rendering thread. This neither allocates nor waits for the control thread.
+    template<typename Callback>
+    void drain(Callback callback)
+    {
+        drain_ring_buffer(callback);
+
+        if (m_backlog_size.load(AK::MemoryOrder::memory_order_acquire) == 0 || !m_mutex.try_lock())
+            return;
+
+        // NB: The control thread can only add to the ring buffer while holding the lock, so any messages that it has
+        //     added since we drained it came before the ones in the backlog.
+        drain_ring_buffer(callback);
+        for (auto& message : m_backlog)
+            callback(move(message));
+        m_backlog.clear_with_capacity();
+        m_backlog_size.store(0, AK::MemoryOrder::memory_order_release);
+        m_mutex.unlock();
+    }
 
 private:
+    template<typename Callback>
+    void drain_ring_buffer(Callback& callback)
+    {
+        auto head = m_head.load(AK::MemoryOrder::memory_order_relaxed);
+        auto tail = m_tail.load(AK::MemoryOrder::memory_order_acquire);
+        for (; head != tail; ++head)
+            callback(m_messages[head % capacity].release_value());
+        m_head.store(head, AK::MemoryOrder::memory_order_release);
+    }
+
+    Array<Optional<ControlMessage>, capacity> m_messages;
+    Atomic<size_t> m_head { 0 }; // Only advanced by the rendering thread.
+    Atomic<size_t> m_tail { 0 }; // Only advanced by the control thread.
+
     mutable Threading::Mutex m_mutex;
-    Vector<ControlMessage> m_messages;
+    Vector<ControlMessage> m_backlog;
+    Atomic<size_t> m_backlog_size { 0 };
 };
 
 }
@@ -71,6 +71,7 @@ WebIDL::ExceptionOr<void> OscillatorNode::set_type(Bindings::OscillatorType type
     set_periodic_wave(nullptr);
 
     m_type = type;
+    context()->audio_graph_did_change();
     return {};
 }
 
@@ -79,6 +80,7 @@ void OscillatorNode::set_periodic_wave(GC::Ptr<PeriodicWave> periodic_wave)
 {
     m_periodic_wave = periodic_wave;
     m_type = Bindings::OscillatorType::Custom;
+    context()->audio_graph_did_change();
 }
 
 void OscillatorNode::initialize(JS::Realm& realm)
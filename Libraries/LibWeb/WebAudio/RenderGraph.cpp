@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/HashTable.h>
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/AudioKernels.h>
+#include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/AudioScheduledSourceNode.h>
+#include <LibWeb/WebAudio/BaseAudioContext.h>
+#include <LibWeb/WebAudio/ConstantSourceNode.h>
+#include <LibWeb/WebAudio/GainNode.h>
+#include <LibWeb/WebAudio/OscillatorNode.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
+
+namespace Web::WebAudio {
+
+static constexpr size_t quantum_size = BaseAudioContext::render_quantum_size();
+
+NonnullOwnPtr<RenderGraph> RenderGraph::compile(AudioDestinationNode& destination, float sample_rate)
+{
+    auto graph = adopt_own(*new RenderGraph(sample_rate));
+    HashTable<NodeID> nodes_being_added;
+    graph->add_node(destination, nodes_being_added);
+    return graph;
+}
+
+// https://webaudio.github.io/web-audio-api/#computednumberofchannels
+static size_t computed_number_of_channels(AudioNode& node, size_t max_input_channel_count)
+{
+    switch (node.channel_count_mode()) {
+    case Bindings::ChannelCountMode::Max:
+        return max_input_channel_count;
+    case Bindings::ChannelCountMode::ClampedMax:
+        return min<size_t>(max_input_channel_count, node.channel_count());
+    case Bindings::ChannelCountMode::Explicit:
+        return node.channel_count();
+    }
+    VERIFY_NOT_REACHED();
+}
+
+Optional<size_t> RenderGraph::add_node(AudioNode& audio_node, HashTable<NodeID>& nodes_being_added)
+{
+    if (auto index = m_node_indices.get(audio_node.node_id()); index.has_value())
+        return *index;
+
+    // NB: The inputs of a node are added before the node itself, which sorts the nodes topologically. Cycles are only
+    //     allowed through a DelayNode, which we don't render yet, so we break them at the connection that closes them.
+    if (nodes_being_added.set(audio_node.node_id()) != HashSetResult::InsertedNewEntry)
+        return {};
+
+    Node node { .id = audio_node.node_id() };
+    size_t max_input_channel_count = 1;
+    for (auto const& connection : audio_node.input_connections()) {
+        auto input = add_node(*connection.destination_node, nodes_being_added);
+        if (!input.has_value() || node.inputs.contains_slow(*input))
+            continue;
+        node.inputs.append(*input);
+        max_input_channel_count = max(max_input_channel_count, m_nodes[*input].channel_count);
+    }
+    nodes_being_added.remove(audio_node.node_id());
+
+    node.channel_interpretation = audio_node.channel_interpretation();
+    node.is_scheduled_source = is<AudioScheduledSourceNode>(audio_node);
+
+    if (is<AudioDestinationNode>(audio_node)) {
+        node.type = NodeType::Destination;
+        node.channel_count = computed_number_of_channels(audio_node, max_input_channel_count);
+    } else if (auto* gain_node = as_if<GainNode>(audio_node)) {
+        node.type = NodeType::Gain;
+        node.value = gain_node->gain()->value();
+        node.channel_count = computed_number_of_channels(audio_node, max_input_channel_count);
+    } else if (auto* oscillator_node = as_if<OscillatorNode>(audio_node); oscillator_node && oscillator_node->type() != Bindings::OscillatorType::Custom) {
+        // https://webaudio.github.io/web-audio-api/#dom-oscillatornode-frequency
+        node.type = NodeType::Oscillator;
+        node.oscillator_type = oscillator_node->type();
+        node.frequency = oscillator_node->frequency()->value() * AK::pow(2.0f, oscillator_node->detune()->value() / 1200.0f);
+    } else if (auto* constant_source_node = as_if<ConstantSourceNode>(audio_node)) {
+        node.type = NodeType::ConstantSource;
+        node.value = constant_source_node->offset()->value();
+    } else if (audio_node.number_of_inputs() > 0) {
+        // FIXME: Process the nodes that we can't render yet, instead of passing their input through unchanged.
+        node.type = NodeType::PassThrough;
+        node.channel_count = computed_number_of_channels(audio_node, max_input_channel_count);
+    } else {
+        // FIXME: Render AudioBufferSourceNode, MediaElementAudioSourceNode and custom oscillators.
+        node.type = NodeType::Silence;
+    }
+
+    node.buffer.resize(node.channel_count * quantum_size);
+
+    auto index = m_nodes.size();
+    m_node_indices.set(node.id, index);
+    m_nodes.append(move(node));
+    return index;
+}
+
+bool RenderGraph::apply_control_message(ControlMessage const& message)
+{
+    auto node_index = message.visit([&](auto const& typed_message) { return m_node_indices.get(typed_message.node_id); });
+    if (!node_index.has_value())
+        return false;
+
+    auto& source_state = m_nodes[*node_index].source_state;
+    message.visit(
+        [&](StartSource const& start) { source_state.start_time = start.when; },
+        [&](StopSource const& stop) { source_state.stop_time = stop.when; });
+    return true;
+}
+
+void RenderGraph::take_state_from(RenderGraph& previous_graph, Function<void(ControlMessage)> const& on_unapplied_message)
+{
+    for (auto const& previous_node : previous_graph.m_nodes) {
+        if (!previous_node.is_scheduled_source)
+            continue;
+
+        if (auto index = m_node_indices.get(previous_node.id); index.has_value()) {
+            m_nodes[*index].source_state = previous_node.source_state;
+            continue;
+        }
+
+        if (previous_node.source_state.start_time.has_value())
+            on_unapplied_message(StartSource { .node_id = previous_node.id, .when = *previous_node.source_state.start_time });
+        if (previous_node.source_state.stop_time.has_value())
+            on_unapplied_message(StopSource { .node_id = previous_node.id, .when = *previous_node.source_state.stop_time });
+    }
+}
+
+ReadonlySpan<float> RenderGraph::channel(size_t channel) const
+{
+    return m_nodes.last().buffer.span().slice(channel * quantum_size, quantum_size);
+}
+
+// https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+static void mix_into(Span<float> destination, size_t destination_channel_count, ReadonlySpan<float> source, size_t source_channel_count, Bindings::ChannelInterpretation interpretation)
+{
+    auto add_channel = [&](size_t destination_channel, size_t source_channel, float scale) {
+        add_scaled_samples(destination.slice(destination_channel * quantum_size, quantum_size), source.slice(source_channel * quantum_size, quantum_size), scale);
+    };
+
+    if (interpretation == Bindings::ChannelInterpretation::Speakers) {
+        if (source_channel_count == 1 && (destination_channel_count == 2 || destination_channel_count == 4)) {
+            add_channel(0, 0, 1.0f);
+            add_channel(1, 0, 1.0f);
+            return;
+        }
+        if (source_channel_count == 1 && destination_channel_count == 6) {
+            add_channel(2, 0, 1.0f);
+            return;
+        }
+        if (source_channel_count == 2 && destination_channel_count == 1) {
+            add_channel(0, 0, 0.5f);
+            add_channel(0, 1, 0.5f);
+            return;
+        }
+        // FIXME: Implement the remaining up-mixing and down-mixing rules for speaker layouts.
+    }
+
+    for (size_t channel = 0; channel < min(source_channel_count, destination_channel_count); ++channel)
+        add_channel(channel, channel, 1.0f);
+}
+
+void RenderGraph::mix_inputs(Node& node)
+{
+    for (auto input_index : node.inputs) {
+        auto const& input = m_nodes[input_index];
+        mix_into(node.buffer, node.channel_count, input.buffer, input.channel_count, node.channel_interpretation);
+    }
+}
+
+// Returns the range of frames in the render quantum starting at first_frame during which a source plays.
+static Optional<Array<size_t, 2>> playing_frames(auto const& source_state, u64 first_frame, float sample_rate)
+{
+    if (!source_state.start_time.has_value())
+        return {};
+
+    auto frame_at = [&](double time) { return static_cast<u64>(AK::ceil(time * sample_rate)); };
+    auto start_frame = max(frame_at(*source_state.start_time), first_frame);
+    auto end_frame = first_frame + quantum_size;
+    if (source_state.stop_time.has_value())
+        end_frame = min(end_frame, frame_at(*source_state.stop_time));
+    if (start_frame >= end_frame)
+        return {};
+    return Array<size_t, 2> { static_cast<size_t>(start_frame - first_frame), static_cast<size_t>(end_frame - first_frame) };
+}
+
+// https://webaudio.github.io/web-audio-api/#oscillator-coefficients
+static float oscillator_sample(Bindings::OscillatorType type, double phase)
+{
+    switch (type) {
+    case Bindings::OscillatorType::Sine:
+        return static_cast<float>(AK::sin(2.0 * AK::Pi<double> * phase));
+    case Bindings::OscillatorType::Square:
+        return phase < 0.5 ? 1.0f : -1.0f;
+    case Bindings::OscillatorType::Sawtooth:
+        return static_cast<float>(2.0 * (phase - AK::floor(phase + 0.5)));
+    case Bindings::OscillatorType::Triangle: {
+        auto shifted_phase = phase + 0.25 - AK::floor(phase + 0.25);
+        return static_cast<float>(1.0 - 4.0 * AK::fabs(shifted_phase - 0.5));
+    }
+    case Bindings::OscillatorType::Custom:
+        break;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void RenderGraph::render_oscillator(Node& node, u64 first_frame)
+{
+    auto frames = playing_frames(node.source_state, first_frame, m_sample_rate);
+    if (!frames.has_value())
+        return;
+
+    // FIXME: Band-limit the square, sawtooth and triangle waves to avoid aliasing.
+    auto& phase = node.source_state.phase;
+    auto phase_increment = static_cast<double>(node.frequency) / m_sample_rate;
+    for (size_t i = frames->at(0); i < frames->at(1); ++i) {
+        node.buffer[i] = oscillator_sample(node.oscillator_type, phase);
+        phase += phase_increment;
+        phase -= AK::floor(phase);
+    }
+}
+
+void RenderGraph::render_constant_source(Node& node, u64 first_frame)
+{
+    auto frames = playing_frames(node.source_state, first_frame, m_sample_rate);
+    if (!frames.has_value())
+        return;
+
+    for (size_t i = frames->at(0); i < frames->at(1); ++i)
+        node.buffer[i] = node.value;
+}
+
+void RenderGraph::render_quantum(u64 first_frame)
+{
+    for (auto& node : m_nodes) {
+        node.buffer.span().fill(0.0f);
+
+        switch (node.type) {
+        case NodeType::Destination:
+        case NodeType::PassThrough:
+            mix_inputs(node);
+            break;
+        case NodeType::Gain:
+            mix_inputs(node);
+            scale_samples(node.buffer, node.value);
+            break;
+        case NodeType::Oscillator:
+            render_oscillator(node, first_frame);
+            break;
+        case NodeType::ConstantSource:
+            render_constant_source(node, first_frame);
+            break;
+        case NodeType::Silence:
+            break;
+        }
+    }
+}
+
+}
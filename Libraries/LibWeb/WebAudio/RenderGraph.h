@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibWeb/Bindings/AudioNodePrototype.h>
+#include <LibWeb/Bindings/OscillatorNodePrototype.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/ControlMessage.h>
+#include <LibWeb/WebAudio/Types.h>
+
+namespace Web::WebAudio {
+
+// A snapshot of the nodes that are connected to the destination of an audio graph, which is compiled on the control
+// thread and then rendered on the rendering thread. The nodes are sorted topologically, so that a render quantum is
+// rendered in a single pass over them, and all of their buffers are allocated up front. Rendering a quantum therefore
+// neither allocates nor touches any GC objects.
+class RenderGraph {
+public:
+    static NonnullOwnPtr<RenderGraph> compile(AudioDestinationNode&, float sample_rate);
+
+    // Everything below is only called by the rendering thread.
+
+    // Returns false if the message is for a node that is not part of this graph.
+    bool apply_control_message(ControlMessage const&);
+
+    // Carries over the state of the nodes that this graph shares with the previous one, such as the phase of an
+    // oscillator. The schedules of the sources that are not part of this graph anymore are passed back as control
+    // messages, so that they can be applied again once a later graph contains them.
+    void take_state_from(RenderGraph&, Function<void(ControlMessage)> const& on_unapplied_message);
+
+    void render_quantum(u64 first_frame);
+
+    size_t channel_count() const { return m_nodes.last().channel_count; }
+    ReadonlySpan<float> channel(size_t) const;
+
+private:
+    enum class NodeType : u8 {
+        Destination,
+        Gain,
+        Oscillator,
+        ConstantSource,
+        PassThrough,
+        Silence,
+    };
+
+    struct SourceState {
+        Optional<double> start_time;
+        Optional<double> stop_time;
+        double phase { 0 };
+    };
+
+    struct Node {
+        NodeID id;
+        NodeType type { NodeType::Silence };
+        bool is_scheduled_source { false };
+        Vector<size_t> inputs;
+        size_t channel_count { 1 };
+        Bindings::ChannelInterpretation channel_interpretation { Bindings::ChannelInterpretation::Speakers };
+
+        // The gain of a GainNode, or the offset of a ConstantSourceNode.
+        float value { 0 };
+        // The computed frequency of an OscillatorNode.
+        float frequency { 0 };
+        Bindings::OscillatorType oscillator_type { Bindings::OscillatorType::Sine };
+
+        SourceState source_state;
+
+        // The output of the node for the current render quantum, one channel after the other.
+        Vector<float> buffer;
+    };
+
+    explicit RenderGraph(float sample_rate)
+        : m_sample_rate(sample_rate)
+    {
+    }
+
+    Optional<size_t> add_node(AudioNode&, HashTable<NodeID>& nodes_being_added);
+
+    void mix_inputs(Node&);
+    void render_oscillator(Node&, u64 first_frame);
+    void render_constant_source(Node&, u64 first_frame);
+
+    float m_sample_rate { 0 };
+
+    // The destination is always the last node.
+    Vector<Node> m_nodes;
+    HashMap<NodeID, size_t> m_node_indices;
+};
+
+}
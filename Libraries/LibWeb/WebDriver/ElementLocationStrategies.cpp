@@ -11,6 +11,7 @@
 #include <LibWeb/DOM/StaticNodeList.h>
 #include <LibWeb/WebDriver/ElementLocationStrategies.h>
 #include <LibWeb/WebDriver/ElementReference.h>
+#include <LibWeb/XPath/XPath.h>
 
 namespace Web::WebDriver {
 
@@ -111,9 +112,47 @@ static GC::Ref<DOM::NodeList> locate_element_by_tag_name(DOM::ParentNode& start_
 }
 
 // https://w3c.github.io/webdriver/#xpath
-static ErrorOr<GC::Ref<DOM::NodeList>, Error> locate_element_by_x_path(DOM::ParentNode&, StringView)
+static ErrorOr<GC::Ref<DOM::NodeList>, Error> locate_element_by_x_path(DOM::ParentNode& start_node, StringView selector)
 {
-    return Error::from_code(ErrorCode::UnsupportedOperation, "Not implemented: locate element by XPath"sv);
+    auto& realm = start_node.realm();
+
+    // 1. Let evaluateResult be the result of calling evaluate, with arguments selector, start node, null,
+    //    ORDERED_NODE_SNAPSHOT_TYPE, and null.
+    //    NOTE: A snapshot is used to promote operation atomicity.
+    auto selector_string = String::from_utf8(selector);
+    if (selector_string.is_error())
+        return Error::from_code(ErrorCode::InvalidSelector, "XPath selector is not valid UTF-8"sv);
+
+    auto evaluate_result = XPath::evaluate(realm, selector_string.value(), start_node, nullptr, XPath::XPathResult::ORDERED_NODE_SNAPSHOT_TYPE, nullptr);
+
+    // 2. If this causes an exception to be thrown, return error with error code invalid selector.
+    if (evaluate_result.is_exception())
+        return Error::from_code(ErrorCode::InvalidSelector, "evaluate() failed"sv);
+
+    // 3. Let index be 0.
+    // 4. Let length be the result of getting the property "snapshotLength" from evaluateResult.
+    auto length = evaluate_result.value()->snapshot_length();
+
+    // 5. Let result be an empty NodeList.
+    Vector<GC::Root<DOM::Node>> result;
+
+    // 6. Repeat, while index is less than length:
+    for (WebIDL::UnsignedLong index = 0; index < length; ++index) {
+        // 1. Let node be the result of calling snapshotItem with evaluateResult as this and index as the argument.
+        auto node = evaluate_result.value()->snapshot_item(index);
+
+        // 2. If node is not an element return an error with error code invalid selector.
+        if (!node || !node->is_element())
+            return Error::from_code(ErrorCode::InvalidSelector, "XPath result is not an element"sv);
+
+        // 3. Append node to result.
+        result.append(*node);
+
+        // 4. Increment index by 1.
+    }
+
+    // 7. Return success with data result.
+    return DOM::StaticNodeList::create(realm, move(result));
 }
 
 Optional<LocationStrategy> location_strategy_from_string(StringView type)
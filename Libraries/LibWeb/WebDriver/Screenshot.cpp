@@ -4,21 +4,24 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Base64.h>
+#include <AK/ScopeGuard.h>
+#include <LibCore/EventLoop.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/DOM/Document.h>
-#include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/HTML/BrowsingContext.h>
-#include <LibWeb/HTML/HTMLCanvasElement.h>
-#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
-#include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/WebDriver/Screenshot.h>
 
 namespace Web::WebDriver {
 
 // https://w3c.github.io/webdriver/#dfn-draw-a-bounding-box-from-the-framebuffer
-ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext& browsing_context, DOM::Element& element, Gfx::IntRect rect)
+ErrorOr<NonnullRefPtr<Gfx::Bitmap>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext& browsing_context, Gfx::IntRect rect)
 {
     // 1. If either the initial viewport's width or height is 0 CSS pixels, return error with error code unable to capture screen.
     auto viewport_rect = browsing_context.top_level_traversable()->viewport_rect();
@@ -34,18 +37,16 @@ ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_fr
     auto paint_height = viewport_device_rect.height() - min(rect.y(), rect.y() + rect.height());
 
     // 4. Let canvas be a new canvas element, and set its width and height to paint width and paint height, respectively.
-    auto canvas_element = DOM::create_element(element.document(), HTML::TagNames::canvas, Namespace::HTML).release_value_but_fixme_should_propagate_errors();
-    auto& canvas = as<HTML::HTMLCanvasElement>(*canvas_element);
-
+    // FIXME: 5. Let context, a canvas context mode, be the result of invoking the 2D context creation algorithm given canvas as the target.
+    // NB: The framebuffer is drawn into a bitmap of that size instead, as the canvas would only be used to encode it.
     // FIXME: Handle DevicePixelRatio in HiDPI mode.
-    canvas.set_width(paint_width);
-    canvas.set_height(paint_height);
+    if (paint_width <= 0 || paint_height <= 0)
+        return Error::from_code(ErrorCode::UnableToCaptureScreen, "Captured screenshot is empty"sv);
 
-    // FIXME: 5. Let context, a canvas context mode, be the result of invoking the 2D context creation algorithm given canvas as the target.
-    MUST(canvas.create_2d_context({}));
-    canvas.allocate_painting_surface_if_needed();
-    if (!canvas.surface())
+    auto bitmap_or_error = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, { paint_width, paint_height });
+    if (bitmap_or_error.is_error())
         return Error::from_code(ErrorCode::UnableToCaptureScreen, "Failed to allocate painting surface"sv);
+    auto bitmap = bitmap_or_error.release_value();
 
     // 6. Complete implementation specific steps equivalent to drawing the region of the framebuffer specified by the following coordinates onto context:
     //    - X coordinate: rectangle x coordinate
@@ -54,7 +55,6 @@ ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_fr
     //    - Height: paint height
     Gfx::IntRect paint_rect { rect.x(), rect.y(), paint_width, paint_height };
 
-    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, canvas.surface()->size()));
     auto painting_surface = Gfx::PaintingSurface::wrap_bitmap(bitmap);
     IGNORE_USE_IN_ESCAPING_LAMBDA bool did_paint = false;
     HTML::PaintConfig paint_config { .canvas_fill_rect = paint_rect };
@@ -65,34 +65,57 @@ ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_fr
         return did_paint;
     }));
 
-    canvas.surface()->write_from_bitmap(*bitmap);
-
     // 7. Return success with canvas.
-    return canvas;
+    return bitmap;
+}
+
+static ErrorOr<String> encode_bitmap_as_base64_png(Gfx::Bitmap const& bitmap)
+{
+    // OPTIMIZATION: Screenshots are usually taken in bulk, and are rarely kept, so we favor encoding speed over size.
+    auto png = TRY(Gfx::PNGWriter::encode(bitmap, { .compression_level = 1, .filter_strategy = Gfx::PNGFilterStrategy::Sub }));
+    return encode_base64(png);
 }
 
 // https://w3c.github.io/webdriver/#dfn-encoding-a-canvas-as-base64
-Response encode_canvas_element(HTML::HTMLCanvasElement& canvas)
+void encode_bitmap_as_base64(NonnullRefPtr<Gfx::Bitmap> bitmap, Function<void(Response)> on_complete)
 {
     // FIXME: 1. If the canvas element’s bitmap’s origin-clean flag is set to false, return error with error code unable to capture screen.
 
     // 2. If the canvas element’s bitmap has no pixels (i.e. either its horizontal dimension or vertical dimension is zero) then return error with error code unable to capture screen.
-    if (canvas.surface()->size().is_empty())
-        return Error::from_code(ErrorCode::UnableToCaptureScreen, "Captured screenshot is empty"sv);
-
-    // 3. Let file be a serialization of the canvas element’s bitmap as a file, using "image/png" as an argument.
-    // 4. Let data url be a data: URL representing file. [RFC2397]
-    auto data_url = canvas.to_data_url("image/png"sv, JS::js_undefined());
-
-    // 5. Let index be the index of "," in data url.
-    auto index = data_url.find_byte_offset(',');
-    VERIFY(index.has_value());
-
-    // 6. Let encoded string be a substring of data url using (index + 1) as the start argument.
-    auto encoded_string = MUST(data_url.substring_from_byte_offset(*index + 1));
-
-    // 7. Return success with data encoded string.
-    return JsonValue { move(encoded_string) };
+    if (bitmap->size().is_empty()) {
+        on_complete(Error::from_code(ErrorCode::UnableToCaptureScreen, "Captured screenshot is empty"sv));
+        return;
+    }
+
+    // NB: The callback is heap-allocated so that if the event loop is destroyed while encoding, we leak it rather than
+    //     destroying it on the worker thread.
+    auto* on_encoded = new Function<void(Response)>(move(on_complete));
+
+    // OPTIMIZATION: Encoding a large screenshot takes much longer than painting it, so it is done off the main thread.
+    auto event_loop_weak = Core::EventLoop::current_weak();
+    Threading::ThreadPool::the().submit([bitmap = move(bitmap), on_encoded, event_loop_weak = move(event_loop_weak)]() mutable {
+        // 3. Let file be a serialization of the canvas element’s bitmap as a file, using "image/png" as an argument.
+        // 4. Let data url be a data: URL representing file. [RFC2397]
+        // 5. Let index be the index of "," in data url.
+        // 6. Let encoded string be a substring of data url using (index + 1) as the start argument.
+        // NB: The encoded string is the base64 encoding of the file, so we produce it directly rather than through a data: URL.
+        auto encoded_string = encode_bitmap_as_base64_png(*bitmap);
+
+        auto origin = event_loop_weak->take();
+        if (!origin)
+            return;
+        origin->deferred_invoke([encoded_string = move(encoded_string), on_encoded]() mutable {
+            ScopeGuard delete_on_encoded = [&] { delete on_encoded; };
+
+            if (encoded_string.is_error()) {
+                (*on_encoded)(Error::from_code(ErrorCode::UnableToCaptureScreen, "Failed to encode screenshot"sv));
+                return;
+            }
+
+            // 7. Return success with data encoded string.
+            (*on_encoded)(JsonValue { encoded_string.release_value() });
+        });
+    });
 }
 
 }
@@ -6,7 +6,9 @@
 
 #pragma once
 
-#include <LibGC/Ptr.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <LibGfx/Forward.h>
 #include <LibGfx/Rect.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
@@ -14,7 +16,7 @@
 
 namespace Web::WebDriver {
 
-WEB_API ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext&, DOM::Element&, Gfx::IntRect);
-WEB_API Response encode_canvas_element(HTML::HTMLCanvasElement&);
+WEB_API ErrorOr<NonnullRefPtr<Gfx::Bitmap>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext&, Gfx::IntRect);
+WEB_API void encode_bitmap_as_base64(NonnullRefPtr<Gfx::Bitmap>, Function<void(Response)> on_complete);
 
 }
@@ -31,6 +31,18 @@ extern "C" {
 
 namespace Web::WebGL {
 
+#ifdef ENABLE_WEBGL
+// NB: Every WebGL call makes its context current first, so we remember which context is current on this thread to not
+//     go through EGL for every call when it already is.
+static thread_local EGLContext s_current_context = EGL_NO_CONTEXT;
+
+static void make_context_current(EGLDisplay display, EGLSurface surface, EGLContext context)
+{
+    eglMakeCurrent(display, surface, surface, context);
+    s_current_context = context;
+}
+#endif
+
 struct OpenGLContext::Impl {
     EGLDisplay display { EGL_NO_DISPLAY };
     EGLConfig config { EGL_NO_CONFIG_KHR };
@@ -63,7 +75,7 @@ OpenGLContext::~OpenGLContext()
 {
 #ifdef ENABLE_WEBGL
     free_surface_resources();
-    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    make_context_current(m_impl->display, EGL_NO_SURFACE, EGL_NO_CONTEXT);
     eglDestroyContext(m_impl->display, m_impl->context);
 #endif
 }
@@ -71,7 +83,7 @@ OpenGLContext::~OpenGLContext()
 void OpenGLContext::free_surface_resources()
 {
 #ifdef ENABLE_WEBGL
-    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_impl->context);
+    make_context_current(m_impl->display, EGL_NO_SURFACE, m_impl->context);
 
     if (m_impl->framebuffer) {
         glDeleteFramebuffers(1, &m_impl->framebuffer);
@@ -308,7 +320,7 @@ void OpenGLContext::allocate_iosurface_painting_surface()
     };
     m_impl->surface = eglCreatePbufferFromClientBuffer(m_impl->display, EGL_IOSURFACE_ANGLE, iosurface.core_foundation_pointer(), m_impl->config, surface_attributes);
 
-    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_impl->context);
+    make_context_current(m_impl->display, EGL_NO_SURFACE, m_impl->context);
 
     glGenTextures(1, &m_impl->color_buffer);
     glBindTexture(m_impl->texture_target == EGL_TEXTURE_RECTANGLE_ANGLE ? GL_TEXTURE_RECTANGLE_ANGLE : GL_TEXTURE_2D, m_impl->color_buffer);
@@ -372,7 +384,7 @@ void OpenGLContext::allocate_vkimage_painting_surface()
     VERIFY(m_impl->egl_image != EGL_NO_IMAGE);
 
     m_impl->surface = EGL_NO_SURFACE;
-    eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    make_context_current(m_impl->display, m_impl->surface, m_impl->context);
 
     glGenTextures(1, &m_impl->color_buffer);
     glBindTexture(GL_TEXTURE_2D, m_impl->color_buffer);
@@ -437,7 +449,9 @@ void OpenGLContext::make_current()
 {
 #ifdef ENABLE_WEBGL
     allocate_painting_surface_if_needed();
-    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_impl->context);
+    if (s_current_context == m_impl->context)
+        return;
+    make_context_current(m_impl->display, EGL_NO_SURFACE, m_impl->context);
 #endif
 }
 
@@ -143,6 +143,12 @@ void WebGLRenderingContextImpl::bind_buffer(WebIDL::UnsignedLong target, GC::Roo
         }
     }
 
+    // OPTIMIZATION: Content tends to bind the buffer that is already bound over and over again, so skip going through GL
+    //               in that case. Only do this for the array buffer binding, as the other bindings are either part of
+    //               the bound vertex array object or are rarely rebound.
+    if (target == GL_ARRAY_BUFFER && m_array_buffer_binding == buffer.ptr())
+        return;
+
     if (m_context->webgl_version() == OpenGLContext::WebGLVersion::WebGL2) {
         switch (target) {
         case GL_ARRAY_BUFFER:
@@ -448,6 +454,14 @@ void WebGLRenderingContextImpl::delete_buffer(GC::Root<WebGLBuffer> buffer)
     }
 
     glDeleteBuffers(1, &buffer_handle);
+
+    // NB: Deleting a buffer unbinds it from every binding point of the current context.
+    if (buffer) {
+        for (auto* binding : { &m_array_buffer_binding, &m_element_array_buffer_binding, &m_uniform_buffer_binding, &m_copy_read_buffer_binding, &m_copy_write_buffer_binding, &m_transform_feedback_buffer_binding, &m_pixel_pack_buffer_binding, &m_pixel_unpack_buffer_binding }) {
+            if (*binding == buffer.ptr())
+                *binding = nullptr;
+        }
+    }
 }
 
 void WebGLRenderingContextImpl::delete_framebuffer(GC::Root<WebGLFramebuffer> framebuffer)
@@ -598,10 +612,51 @@ void WebGLRenderingContextImpl::detach_shader(GC::Root<WebGLProgram> program, GC
     }
 }
 
-void WebGLRenderingContextImpl::disable(WebIDL::UnsignedLong cap)
+bool WebGLRenderingContextImpl::is_cacheable_capability(WebIDL::UnsignedLong cap) const
 {
+    switch (cap) {
+    case GL_BLEND:
+    case GL_CULL_FACE:
+    case GL_DEPTH_TEST:
+    case GL_DITHER:
+    case GL_POLYGON_OFFSET_FILL:
+    case GL_SAMPLE_ALPHA_TO_COVERAGE:
+    case GL_SAMPLE_COVERAGE:
+    case GL_SCISSOR_TEST:
+    case GL_STENCIL_TEST:
+        return true;
+    case GL_RASTERIZER_DISCARD:
+        return m_context->webgl_version() == OpenGLContext::WebGLVersion::WebGL2;
+    default:
+        return false;
+    }
+}
+
+void WebGLRenderingContextImpl::set_capability_enabled(WebIDL::UnsignedLong cap, bool enabled)
+{
+    // OPTIMIZATION: Content tends to enable and disable capabilities around every draw call whether or not they are
+    //               already in that state, so we remember the state of each capability to skip going through GL when
+    //               it would not change anything. Unknown capabilities are always passed on, so they still generate a
+    //               GL_INVALID_ENUM error.
+    auto cacheable = is_cacheable_capability(cap);
+    if (cacheable) {
+        if (auto cached_enabled = m_enabled_capabilities.get(cap); cached_enabled.has_value() && *cached_enabled == enabled)
+            return;
+    }
+
     m_context->make_current();
-    glDisable(cap);
+    if (enabled)
+        glEnable(cap);
+    else
+        glDisable(cap);
+
+    if (cacheable)
+        m_enabled_capabilities.set(cap, enabled);
+}
+
+void WebGLRenderingContextImpl::disable(WebIDL::UnsignedLong cap)
+{
+    set_capability_enabled(cap, false);
 }
 
 void WebGLRenderingContextImpl::disable_vertex_attrib_array(WebIDL::UnsignedLong index)
@@ -629,8 +684,7 @@ void WebGLRenderingContextImpl::draw_elements(WebIDL::UnsignedLong mode, WebIDL:
 
 void WebGLRenderingContextImpl::enable(WebIDL::UnsignedLong cap)
 {
-    m_context->make_current();
-    glEnable(cap);
+    set_capability_enabled(cap, true);
 }
 
 void WebGLRenderingContextImpl::enable_vertex_attrib_array(WebIDL::UnsignedLong index)
@@ -1956,6 +2010,11 @@ bool WebGLRenderingContextImpl::is_buffer(GC::Root<WebGLBuffer> buffer)
 
 bool WebGLRenderingContextImpl::is_enabled(WebIDL::UnsignedLong cap)
 {
+    if (is_cacheable_capability(cap)) {
+        if (auto cached_enabled = m_enabled_capabilities.get(cap); cached_enabled.has_value())
+            return *cached_enabled;
+    }
+
     m_context->make_current();
     return glIsEnabled(cap);
 }
@@ -2281,6 +2340,12 @@ void WebGLRenderingContextImpl::use_program(GC::Root<WebGLProgram> program)
         program_handle = handle_or_error.release_value();
     }
 
+    // OPTIMIZATION: Skip going through GL when the program is already in use. Relinking a program that is in use
+    //               makes the new executable current by itself, and deleting it clears m_current_program, so this
+    //               never leaves a stale program in use.
+    if (program && m_current_program == program.ptr())
+        return;
+
     glUseProgram(program_handle);
     m_current_program = program;
 }
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/NonnullOwnPtr.h>
 #include <LibGC/Ptr.h>
 #include <LibWeb/Bindings/PlatformObject.h>
@@ -148,6 +149,9 @@ public:
 protected:
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
+    bool is_cacheable_capability(WebIDL::UnsignedLong cap) const;
+    void set_capability_enabled(WebIDL::UnsignedLong cap, bool enabled);
+
     GC::Ptr<WebGLBuffer> m_array_buffer_binding;
     GC::Ptr<WebGLBuffer> m_element_array_buffer_binding;
     GC::Ptr<WebGLProgram> m_current_program;
@@ -171,6 +175,8 @@ protected:
     GC::Ptr<WebGLQuery> m_any_samples_passed_conservative;
     GC::Ptr<WebGLQuery> m_transform_feedback_primitives_written;
 
+    HashMap<WebIDL::UnsignedLong, bool> m_enabled_capabilities;
+
     NonnullOwnPtr<OpenGLContext> m_context;
 };
 
@@ -53,9 +53,9 @@ XMLDocumentBuilder::XMLDocumentBuilder(DOM::Document& document, XMLScriptingSupp
     m_namespace_stack.append({ {}, 1 });
 }
 
-ErrorOr<void> XMLDocumentBuilder::set_source(ByteString source)
+ErrorOr<void> XMLDocumentBuilder::set_source(StringView source)
 {
-    m_document->set_source(TRY(String::from_byte_string(source)));
+    m_document->set_source(TRY(String::from_utf8(source)));
     return {};
 }
 
@@ -86,6 +86,8 @@ void XMLDocumentBuilder::set_doctype(XML::Doctype doctype)
 
 void XMLDocumentBuilder::element_start(XML::Name const& name, OrderedHashMap<XML::Name, ByteString> const& attributes)
 {
+    flush_pending_text();
+
     if (m_has_error)
         return;
 
@@ -192,6 +194,8 @@ void XMLDocumentBuilder::element_start(XML::Name const& name, OrderedHashMap<XML
 
 void XMLDocumentBuilder::element_end(XML::Name const& name)
 {
+    flush_pending_text();
+
     if (m_has_error)
         return;
 
@@ -252,20 +256,34 @@ void XMLDocumentBuilder::text(StringView data)
     if (m_has_error)
         return;
 
+    // NB: The parser hands us long runs of text in many small pieces, so they are buffered until the next node is
+    //     inserted or an element is closed, instead of rebuilding the data of the text node for every one of them.
+    m_text_builder.append(data);
+}
+
+void XMLDocumentBuilder::flush_pending_text()
+{
+    if (m_text_builder.is_empty())
+        return;
+
+    auto data = m_text_builder.to_utf16_string();
+    m_text_builder.clear();
+
+    if (m_has_error || !m_current_node)
+        return;
+
     if (auto* last = m_current_node->last_child(); last && last->is_text()) {
-        auto& text_node = static_cast<DOM::Text&>(*last);
-        m_text_builder.append(text_node.data());
-        m_text_builder.append(data);
-        text_node.set_data(m_text_builder.to_utf16_string());
-        m_text_builder.clear();
-    } else if (!data.is_empty()) {
-        auto node = m_document->create_text_node(Utf16String::from_utf8(data));
+        MUST(static_cast<DOM::Text&>(*last).append_data(data));
+    } else {
+        auto node = m_document->create_text_node(move(data));
         MUST(m_current_node->append_child(node));
     }
 }
 
 void XMLDocumentBuilder::comment(StringView data)
 {
+    flush_pending_text();
+
     if (m_has_error || !m_current_node)
         return;
 
@@ -274,6 +292,8 @@ void XMLDocumentBuilder::comment(StringView data)
 
 void XMLDocumentBuilder::cdata_section(StringView data)
 {
+    flush_pending_text();
+
     if (m_has_error || !m_current_node)
         return;
 
@@ -283,6 +303,8 @@ void XMLDocumentBuilder::cdata_section(StringView data)
 
 void XMLDocumentBuilder::processing_instruction(StringView target, StringView data)
 {
+    flush_pending_text();
+
     if (m_has_error || !m_current_node)
         return;
 
@@ -292,6 +314,8 @@ void XMLDocumentBuilder::processing_instruction(StringView target, StringView da
 
 void XMLDocumentBuilder::document_end()
 {
+    flush_pending_text();
+
     auto& heap = m_document->heap();
 
     // When an XML parser reaches the end of its input, it must stop parsing.
@@ -29,7 +29,7 @@ public:
     bool has_error() const { return m_has_error; }
 
 private:
-    virtual ErrorOr<void> set_source(ByteString) override;
+    virtual ErrorOr<void> set_source(StringView) override;
     virtual void set_doctype(XML::Doctype) override;
     virtual void element_start(XML::Name const& name, OrderedHashMap<XML::Name, ByteString> const& attributes) override;
     virtual void element_end(XML::Name const& name) override;
@@ -45,6 +45,7 @@ private:
     };
 
     Optional<FlyString> namespace_for_name(XML::Name const&);
+    void flush_pending_text();
 
     GC::Ref<DOM::Document> m_document;
     GC::RootVector<GC::Ref<DOM::Node>> m_template_node_stack;
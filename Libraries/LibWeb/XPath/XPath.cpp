@@ -5,6 +5,9 @@
  */
 
 #include <AK/Format.h>
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
+#include <LibGC/Weak.h>
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/CDATASection.h>
 #include <LibWeb/DOM/Comment.h>
@@ -159,40 +162,138 @@ static void convert_xpath_result(xmlXPathObjectPtr xpath_result, XPath::XPathRes
     }
 }
 
-WebIDL::ExceptionOr<GC::Ref<XPathExpression>> create_expression(JS::Realm& realm, String const& expression, GC::Ptr<XPathNSResolver> resolver)
+// OPTIMIZATION: Scripts tend to evaluate the same few expressions over and over, so recently compiled expressions are
+//               kept around rather than being parsed again for every evaluation.
+static constexpr size_t compiled_expression_cache_capacity = 64;
+
+static HashMap<String, NonnullRefPtr<CompiledExpression>>& compiled_expression_cache()
 {
-    return realm.create<XPathExpression>(realm, expression, resolver);
+    // NB: The cache is never destroyed, so that libxml2 is not called into after it has been cleaned up at exit.
+    static auto& cache = *new HashMap<String, NonnullRefPtr<CompiledExpression>>;
+    return cache;
 }
 
-WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, String const& expression, DOM::Node const& context_node, GC::Ptr<XPathNSResolver> /*resolver*/, unsigned short type, GC::Ptr<XPathResult> result)
+WebIDL::ExceptionOr<NonnullRefPtr<CompiledExpression>> CompiledExpression::create(JS::Realm& realm, String const& expression)
 {
+    auto& cache = compiled_expression_cache();
+    if (auto it = cache.find(expression); it != cache.end())
+        return it->value;
+
     // Parse the expression as xpath
     ByteString bytes = expression.bytes_as_string_view();
     auto* xpath_compiled = xmlXPathCompile(bit_cast<xmlChar const*>(bytes.characters()));
     if (!xpath_compiled)
         return WebIDL::SyntaxError::create(realm, "Invalid XPath expression"_utf16);
-    ScopeGuard xpath_compiled_cleanup = [&] { xmlXPathFreeCompExpr(xpath_compiled); };
 
-    auto* xml_document = xmlNewDoc(nullptr);
-    ScopeGuard xml_cleanup = [&] { xmlFreeDoc(xml_document); };
+    auto compiled_expression = adopt_ref(*new CompiledExpression(xpath_compiled));
+    if (cache.size() >= compiled_expression_cache_capacity)
+        cache.clear();
+    cache.set(expression, compiled_expression);
+    return compiled_expression;
+}
+
+CompiledExpression::~CompiledExpression()
+{
+    xmlXPathFreeCompExpr(m_expression);
+}
+
+// NB: A copy of a DOM tree in libxml2's own representation, which expressions are evaluated against.
+struct MirroredTree {
+    AK_MAKE_NONCOPYABLE(MirroredTree);
+    AK_MAKE_NONMOVABLE(MirroredTree);
+
+public:
+    MirroredTree() = default;
+    ~MirroredTree()
+    {
+        if (document)
+            xmlFreeDoc(document);
+    }
+
+    GC::Weak<DOM::Node> context_node;
+    GC::Weak<DOM::Document> node_document;
+    u64 dom_tree_version { 0 };
+    u64 character_data_version { 0 };
+
+    xmlDocPtr document { nullptr };
+    xmlNodePtr root { nullptr };
+};
+
+static ErrorOr<void> mirror_tree(MirroredTree& tree, DOM::Node const& context_node)
+{
+    tree.document = xmlNewDoc(nullptr);
 
     if (context_node.type() == DOM::NodeType::DOCUMENT_NODE) {
-        xml_document->_private = bit_cast<void*>(&context_node);
+        tree.document->_private = bit_cast<void*>(&context_node);
     } else {
-        xml_document->_private = bit_cast<void*>(&context_node.document());
+        tree.document->_private = bit_cast<void*>(&context_node.document());
     }
 
-    auto* xml_node = mirror_node(xml_document, context_node);
-    if (!xml_node) {
-        return WebIDL::OperationError::create(realm, "XPath evaluation failed"_utf16);
+    tree.root = mirror_node(tree.document, context_node);
+    if (!tree.root)
+        return Error::from_string_literal("XPath evaluation failed");
+
+    xmlDocSetRootElement(tree.document, tree.root);
+
+    // OPTIMIZATION: Number the elements in document order, so that libxml2 can put node-sets in document order by
+    //               comparing these numbers rather than by walking the tree for every pair of nodes it compares.
+    xmlXPathOrderDocElems(tree.document);
+
+    tree.context_node = const_cast<DOM::Node&>(context_node);
+    tree.node_document = const_cast<DOM::Document&>(context_node.document());
+    tree.dom_tree_version = context_node.document().dom_tree_version();
+    tree.character_data_version = context_node.document().character_data_version();
+    return {};
+}
+
+// OPTIMIZATION: Mirroring the tree takes much longer than evaluating most expressions, so the tree that was mirrored last
+//               is reused for as long as its DOM tree, and the text in it, stays unchanged.
+static MirroredTree* mirrored_tree_for(DOM::Node const& context_node)
+{
+    // NB: The tree is never destroyed, for the same reason as the compiled expression cache.
+    static auto& cached_tree = *new OwnPtr<MirroredTree>;
+
+    auto const& document = context_node.document();
+    if (cached_tree
+        && cached_tree->context_node.ptr() == &context_node
+        && cached_tree->node_document.ptr() == &document
+        && cached_tree->dom_tree_version == document.dom_tree_version()
+        && cached_tree->character_data_version == document.character_data_version()) {
+        return cached_tree.ptr();
     }
 
-    xmlDocSetRootElement(xml_document, xml_node);
+    cached_tree = nullptr;
+
+    auto tree = make<MirroredTree>();
+    if (mirror_tree(*tree, context_node).is_error())
+        return nullptr;
+
+    cached_tree = move(tree);
+    return cached_tree.ptr();
+}
+
+WebIDL::ExceptionOr<GC::Ref<XPathExpression>> create_expression(JS::Realm& realm, String const& expression, GC::Ptr<XPathNSResolver> resolver)
+{
+    auto compiled_expression = TRY(CompiledExpression::create(realm, expression));
+    return realm.create<XPathExpression>(realm, move(compiled_expression), resolver);
+}
+
+WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, String const& expression, DOM::Node const& context_node, GC::Ptr<XPathNSResolver> /*resolver*/, unsigned short type, GC::Ptr<XPathResult> result)
+{
+    auto compiled_expression = TRY(CompiledExpression::create(realm, expression));
+    return evaluate(realm, *compiled_expression, context_node, type, result);
+}
+
+WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, CompiledExpression const& expression, DOM::Node const& context_node, unsigned short type, GC::Ptr<XPathResult> result)
+{
+    auto* mirrored_tree = mirrored_tree_for(context_node);
+    if (!mirrored_tree)
+        return WebIDL::OperationError::create(realm, "XPath evaluation failed"_utf16);
 
-    auto* xpath_context = xmlXPathNewContext(xml_document);
-    xmlXPathSetContextNode(xml_node, xpath_context);
+    auto* xpath_context = xmlXPathNewContext(mirrored_tree->document);
+    xmlXPathSetContextNode(mirrored_tree->root, xpath_context);
 
-    auto* xpath_result = xmlXPathCompiledEval(xpath_compiled, xpath_context);
+    auto* xpath_result = xmlXPathCompiledEval(expression.expression(), xpath_context);
 
     ScopeGuard xpath_result_cleanup = [&] {
         xmlXPathFreeObject(xpath_result);
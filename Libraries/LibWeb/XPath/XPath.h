@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/Noncopyable.h>
+#include <AK/RefCounted.h>
 #include <LibGC/Ptr.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
@@ -13,9 +15,32 @@
 #include "XPathNSResolver.h"
 #include "XPathResult.h"
 
+struct _xmlXPathCompExpr;
+
 namespace Web::XPath {
 
+// An XPath expression that has been compiled by libxml2, and that can be evaluated any number of times.
+class CompiledExpression : public RefCounted<CompiledExpression> {
+    AK_MAKE_NONCOPYABLE(CompiledExpression);
+    AK_MAKE_NONMOVABLE(CompiledExpression);
+
+public:
+    static WebIDL::ExceptionOr<NonnullRefPtr<CompiledExpression>> create(JS::Realm&, String const& expression);
+    ~CompiledExpression();
+
+    _xmlXPathCompExpr* expression() const { return m_expression; }
+
+private:
+    explicit CompiledExpression(_xmlXPathCompExpr* expression)
+        : m_expression(expression)
+    {
+    }
+
+    _xmlXPathCompExpr* m_expression { nullptr };
+};
+
 WebIDL::ExceptionOr<GC::Ref<XPathExpression>> create_expression(JS::Realm& realm, String const& expression, GC::Ptr<XPathNSResolver> resolver);
 WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, String const& expression, DOM::Node const& context_node, GC::Ptr<XPathNSResolver> resolver, unsigned short type, GC::Ptr<XPathResult> result);
+WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, CompiledExpression const& expression, DOM::Node const& context_node, unsigned short type, GC::Ptr<XPathResult> result);
 
 }
@@ -14,12 +14,14 @@
 
 namespace Web::XPath {
 
+class CompiledExpression;
+
 class XPathExpression final : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(XPathExpression, Bindings::PlatformObject);
     GC_DECLARE_ALLOCATOR(XPathExpression);
 
 public:
-    explicit XPathExpression(JS::Realm&, String const& expression, GC::Ptr<XPathNSResolver> resolver);
+    explicit XPathExpression(JS::Realm&, NonnullRefPtr<CompiledExpression> expression, GC::Ptr<XPathNSResolver> resolver);
     virtual ~XPathExpression() override;
     virtual void visit_edges(Cell::Visitor&) override;
     virtual void initialize(JS::Realm&) override;
@@ -27,7 +29,7 @@ public:
     WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(DOM::Node const& context_node, WebIDL::UnsignedShort type = 0, GC::Ptr<XPathResult> result = nullptr);
 
 private:
-    String m_expression;
+    NonnullRefPtr<CompiledExpression> m_expression;
     GC::Ptr<XPathNSResolver> m_resolver;
 };
 
@@ -10,6 +10,7 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
+#include <AK/Optional.h>
 #include <AK/Span.h>
 #include <LibWebSocket/ConnectionInfo.h>
 
@@ -29,6 +30,10 @@ public:
 
     virtual bool handshake_complete_when_connected() const { return false; }
 
+    // If the implementation performs the opening handshake itself, this returns the value of the server's
+    // Sec-WebSocket-Extensions header, if it sent one.
+    virtual Optional<ByteString> server_extensions() const { return {}; }
+
     Function<void()> on_connected;
     Function<void()> on_connection_error;
     Function<void()> on_ready_to_read;
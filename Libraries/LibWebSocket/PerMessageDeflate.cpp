@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <LibWebSocket/PerMessageDeflate.h>
+
+namespace WebSocket {
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.1
+static constexpr Array<u8, 4> empty_stored_block { 0x00, 0x00, 0xff, 0xff };
+
+static constexpr size_t decompression_chunk_size = 16 * KiB;
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.1
+ErrorOr<OwnPtr<PerMessageDeflate>> PerMessageDeflate::create_from_server_extensions(StringView server_extensions)
+{
+    OwnPtr<PerMessageDeflate> extension;
+
+    for (auto element : server_extensions.split_view(',')) {
+        auto parameters = element.split_view(';');
+        if (parameters.is_empty() || !parameters.take_first().trim_whitespace().equals_ignoring_ascii_case(extension_name))
+            continue;
+
+        // A client MUST _Fail the WebSocket Connection_ if the peer server accepted an extension negotiation offer for
+        // this extension with an extension negotiation response that is not acceptable to the client.
+        if (extension)
+            return Error::from_string_literal("permessage-deflate was accepted more than once");
+
+        bool client_no_context_takeover = false;
+        for (auto parameter : parameters) {
+            auto name = parameter.find_first_split_view('=').trim_whitespace();
+
+            if (name.equals_ignoring_ascii_case("client_no_context_takeover"sv)) {
+                client_no_context_takeover = true;
+                continue;
+            }
+
+            // Our decompressor always uses the largest possible window, which can decompress anything that was
+            // compressed with a smaller one, and keeping our context does no harm if the server discards its own.
+            if (name.equals_ignoring_ascii_case("server_no_context_takeover"sv) || name.equals_ignoring_ascii_case("server_max_window_bits"sv))
+                continue;
+
+            // NB: This includes client_max_window_bits, which the server may only send if we offered it.
+            return Error::from_string_literal("permessage-deflate was accepted with an unsupported parameter");
+        }
+
+        extension = adopt_own(*new PerMessageDeflate(client_no_context_takeover));
+    }
+
+    return extension;
+}
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.1
+ErrorOr<ByteBuffer> PerMessageDeflate::compress(ReadonlyBytes message)
+{
+    if (!m_compressor || m_client_no_context_takeover) {
+        m_compressor = nullptr;
+        m_compressor = TRY(Compress::DeflateCompressor::create(MaybeOwned<Stream> { m_compressed_output }));
+    }
+
+    // 1. Compress all the octets of the payload of the message using DEFLATE.
+    // 2. If the resulting data does not end with an empty DEFLATE block with no compression (the "BTYPE" bits are set
+    //    to 00), append an empty DEFLATE block with no compression to the tail end.
+    TRY(m_compressor->write_until_depleted(message));
+    TRY(m_compressor->flush());
+
+    auto compressed = TRY(ByteBuffer::create_uninitialized(m_compressed_output.used_buffer_size()));
+    TRY(m_compressed_output.read_until_filled(compressed));
+
+    // 3. Remove 4 octets (that are 0x00 0x00 0xff 0xff) from the tail end.
+    VERIFY(compressed.bytes().ends_with(empty_stored_block.span()));
+    compressed.trim(compressed.size() - empty_stored_block.size(), false);
+    return compressed;
+}
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.2
+ErrorOr<ByteBuffer> PerMessageDeflate::decompress(ReadonlyBytes payload)
+{
+    if (!m_decompressor)
+        m_decompressor = TRY(Compress::DeflateDecompressor::create(MaybeOwned<Stream> { m_compressed_input }));
+
+    // 1. Append 4 octets of 0x00 0x00 0xff 0xff to the tail end of the payload of the message.
+    TRY(m_compressed_input.write_until_depleted(payload));
+    TRY(m_compressed_input.write_until_depleted(empty_stored_block.span()));
+
+    // 2. Decompress the resulting data using DEFLATE.
+    ByteBuffer message;
+    while (true) {
+        auto buffer = TRY(message.get_bytes_for_writing(decompression_chunk_size));
+        auto decompressed = TRY(m_decompressor->read_some_of_available_input(buffer));
+        message.trim(message.size() - decompression_chunk_size + decompressed.size(), false);
+        if (decompressed.size() < decompression_chunk_size)
+            break;
+    }
+
+    // NB: The server may end its DEFLATE stream after a message (setting "BFINAL"), in which case the next message
+    //     starts a new stream.
+    if (m_decompressor->is_eof()) {
+        m_decompressor = nullptr;
+        TRY(m_compressed_input.discard(m_compressed_input.used_buffer_size()));
+    }
+
+    return message;
+}
+
+}
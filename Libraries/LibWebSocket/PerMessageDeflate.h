@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/MemoryStream.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <LibCompress/Deflate.h>
+
+namespace WebSocket {
+
+// The "permessage-deflate" extension, as defined by RFC 7692. Unless the server asked us not to, both directions keep
+// their sliding window across messages, so that a message can refer back to the ones before it.
+class PerMessageDeflate {
+    AK_MAKE_NONCOPYABLE(PerMessageDeflate);
+    AK_MAKE_NONMOVABLE(PerMessageDeflate);
+
+public:
+    static constexpr StringView extension_name = "permessage-deflate"sv;
+
+    // Returns the extension if the value of a server's Sec-WebSocket-Extensions header accepts our offer, nullptr if it
+    // does not mention it, or an error if it accepts it with parameters we did not offer or do not support.
+    static ErrorOr<OwnPtr<PerMessageDeflate>> create_from_server_extensions(StringView);
+
+    ErrorOr<ByteBuffer> compress(ReadonlyBytes message);
+    ErrorOr<ByteBuffer> decompress(ReadonlyBytes payload);
+
+private:
+    explicit PerMessageDeflate(bool client_no_context_takeover)
+        : m_client_no_context_takeover(client_no_context_takeover)
+    {
+    }
+
+    bool m_client_no_context_takeover { false };
+
+    AllocatingMemoryStream m_compressed_output;
+    OwnPtr<Compress::DeflateCompressor> m_compressor;
+
+    AllocatingMemoryStream m_compressed_input;
+    OwnPtr<Compress::DeflateDecompressor> m_decompressor;
+};
+
+}
@@ -5,11 +5,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Base64.h>
 #include <AK/Endian.h>
 #include <AK/Random.h>
 #include <LibCrypto/Hash/HashManager.h>
 #include <LibWebSocket/Impl/WebSocketImplSerenity.h>
+#include <LibWebSocket/PerMessageDeflate.h>
 #include <LibWebSocket/WebSocket.h>
 
 namespace WebSocket {
@@ -28,6 +30,8 @@ WebSocket::WebSocket(ConnectionInfo connection, RefPtr<WebSocketImpl> impl)
 {
 }
 
+WebSocket::~WebSocket() = default;
+
 void WebSocket::start()
 {
     VERIFY(m_state == WebSocket::InternalState::NotStarted);
@@ -54,6 +58,12 @@ void WebSocket::start()
         if (m_state != WebSocket::InternalState::EstablishingProtocolConnection)
             return;
         if (m_impl->handshake_complete_when_connected()) {
+            if (auto server_extensions = m_impl->server_extensions(); server_extensions.has_value()) {
+                if (auto result = accept_server_extensions(*server_extensions); result.is_error()) {
+                    fail_connection(to_underlying(CloseStatusCode::AbnormalClosure), WebSocket::Error::ConnectionUpgradeFailed, ByteString::formatted("Server accepted extensions '{}' in a way we can't use: {}", *server_extensions, result.error()));
+                    return;
+                }
+            }
             set_state(WebSocket::InternalState::Open);
             notify_open();
         } else {
@@ -100,10 +110,19 @@ void WebSocket::send(Message const& message)
     // Calling send on a socket that is not opened is not allowed
     VERIFY(m_state == WebSocket::InternalState::Open);
     VERIFY(m_impl);
-    if (message.is_text())
-        send_frame(WebSocket::OpCode::Text, message.data(), true);
-    else
-        send_frame(WebSocket::OpCode::Binary, message.data(), true);
+    auto op_code = message.is_text() ? WebSocket::OpCode::Text : WebSocket::OpCode::Binary;
+
+    // https://datatracker.ietf.org/doc/html/rfc7692#section-6.1
+    if (m_per_message_deflate && !message.data().is_empty()) {
+        auto compressed = m_per_message_deflate->compress(message.data());
+        if (!compressed.is_error()) {
+            send_frame(op_code, compressed.value(), true, true);
+            return;
+        }
+        dbgln("WebSocket: Failed to compress message, sending it uncompressed: {}", compressed.error());
+    }
+
+    send_frame(op_code, message.data(), true);
 }
 
 void WebSocket::close(u16 code, ByteString const& message)
@@ -182,7 +201,12 @@ void WebSocket::drain_read()
         do {
             if (auto maybe_error = read_frame(); maybe_error.is_error())
                 break;
-        } while (!m_buffered_data.is_empty());
+        } while (m_buffered_data_offset < m_buffered_data.size());
+
+        // NB: The frames that have been read are only dropped from the buffer once we run out of complete frames, so
+        //     that a read containing many small frames doesn't move the rest of the buffer after each of them.
+        m_buffered_data.remove(0, m_buffered_data_offset);
+        m_buffered_data_offset = 0;
     } break;
     case InternalState::Closed:
     case InternalState::Errored: {
@@ -380,19 +404,9 @@ void WebSocket::read_server_handshake()
 
         if (header_name.equals_ignoring_ascii_case("Sec-WebSocket-Extensions"sv)) {
             // 5. |Sec-WebSocket-Extensions| should not contain an extension that doesn't appear in m_connection->extensions()
-            auto server_extensions = parts[1].split(',');
-            for (auto const& extension : server_extensions) {
-                auto trimmed_extension = extension.trim_whitespace();
-                bool found_extension = false;
-                for (auto const& supported_extension : m_connection.extensions()) {
-                    if (trimmed_extension.equals_ignoring_ascii_case(supported_extension)) {
-                        found_extension = true;
-                    }
-                }
-                if (!found_extension) {
-                    fail_opening_handshake(ByteString::formatted("Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains '{}', which is not supported by the client. Failing connection.", trimmed_extension));
-                    return;
-                }
+            if (auto result = accept_server_extensions(parts[1]); result.is_error()) {
+                fail_opening_handshake(ByteString::formatted("Server HTTP Handshake Header |Sec-WebSocket-Extensions| is '{}', which is not supported by the client: {}. Failing connection.", parts[1], result.error()));
+                return;
             }
             continue;
         }
@@ -419,12 +433,27 @@ void WebSocket::read_server_handshake()
     // If needed, we will keep reading the header on the next drain_read call
 }
 
+ErrorOr<void> WebSocket::accept_server_extensions(StringView server_extensions)
+{
+    for (auto extension : server_extensions.split_view(',')) {
+        auto name = extension.find_first_split_view(';').trim_whitespace();
+        bool was_offered = any_of(m_connection.extensions(), [&](auto const& offered_extension) {
+            return name.equals_ignoring_ascii_case(offered_extension.view().find_first_split_view(';').trim_whitespace());
+        });
+        if (!was_offered)
+            return AK::Error::from_string_literal("An extension that wasn't offered was accepted");
+    }
+
+    m_per_message_deflate = TRY(PerMessageDeflate::create_from_server_extensions(server_extensions));
+    return {};
+}
+
 ErrorOr<void> WebSocket::read_frame()
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing);
 
-    size_t cursor = 0;
+    size_t cursor = m_buffered_data_offset;
     auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
         if (cursor + count > m_buffered_data.size())
             return {};
@@ -435,6 +464,10 @@ ErrorOr<void> WebSocket::read_frame()
 
     auto head_bytes = get_buffered_bytes(2);
     if (head_bytes.is_null() || head_bytes.is_empty()) {
+        // Only part of the next frame's head has arrived so far.
+        if (m_buffered_data_offset < m_buffered_data.size())
+            return AK::Error::from_errno(EAGAIN);
+
         // The connection got closed.
         set_state(WebSocket::InternalState::Closed);
         notify_close(m_last_close_code, m_last_close_message, true);
@@ -446,6 +479,15 @@ ErrorOr<void> WebSocket::read_frame()
     bool is_final_frame = head_bytes[0] & 0x80;
     bool is_masked = head_bytes[1] & 0x80;
 
+    // https://datatracker.ietf.org/doc/html/rfc7692#section-6
+    // The "Per-Message Compressed" bit (RSV1) may only be set on the first frame of a data message, and only if the
+    // permessage-deflate extension is in use.
+    bool is_compressed = head_bytes[0] & 0x40;
+    if (is_compressed && (!m_per_message_deflate || (op_code != WebSocket::OpCode::Text && op_code != WebSocket::OpCode::Binary))) {
+        fail_connection(to_underlying(CloseStatusCode::ProtocolError), WebSocket::Error::ServerClosedSocket, "Server sent a frame with the RSV1 bit set where it is not allowed");
+        return AK::Error::from_errno(EPROTO);
+    }
+
     // Parse the payload length.
     size_t payload_length;
     auto payload_length_bits = head_bytes[1] & 0x7f;
@@ -503,13 +545,7 @@ ErrorOr<void> WebSocket::read_frame()
         read_length += payload_part.size();
     }
 
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
-    } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
-    }
+    m_buffered_data_offset = cursor;
 
     if (is_masked) {
         // Unmask the payload
@@ -542,6 +578,7 @@ ErrorOr<void> WebSocket::read_frame()
         if (op_code != WebSocket::OpCode::Continuation) {
             // First fragmented message
             m_initial_fragment_opcode = op_code;
+            m_fragmented_message_is_compressed = is_compressed;
         }
         // First and next fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
@@ -551,10 +588,18 @@ ErrorOr<void> WebSocket::read_frame()
         // Last fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
         op_code = m_initial_fragment_opcode;
-        payload.clear();
-        payload.append(m_fragmented_data_buffer.data(), m_fragmented_data_buffer.size());
+        is_compressed = m_fragmented_message_is_compressed;
+        payload = move(m_fragmented_data_buffer);
         m_fragmented_data_buffer.clear();
     }
+    if (is_compressed) {
+        auto decompressed = m_per_message_deflate->decompress(payload);
+        if (decompressed.is_error()) {
+            fail_connection(to_underlying(CloseStatusCode::InvalidPayload), WebSocket::Error::ServerClosedSocket, ByteString::formatted("Failed to decompress message: {}", decompressed.error()));
+            return decompressed.release_error();
+        }
+        payload = decompressed.release_value();
+    }
     if (op_code == WebSocket::OpCode::Text) {
         notify_message(Message(move(payload), true));
         return {};
@@ -567,15 +612,17 @@ ErrorOr<void> WebSocket::read_frame()
     return {};
 }
 
-void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final)
+void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final, bool is_compressed)
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open);
 
-    ByteBuffer buf = MUST(ByteBuffer::create_uninitialized(1 + 9 + 4 + payload.size()));
+    // The frame is written straight into the frames that are waiting to be sent.
+    auto frames_size_before = m_pending_frames.size();
+    auto buf = m_pending_frames.must_get_bytes_for_writing(1 + 9 + 4 + payload.size());
     size_t offset = 0;
 
-    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | ((u8)(op_code) & 0xf)) };
+    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | (is_compressed ? 0x40 : 0x00) | ((u8)(op_code) & 0xf)) };
     buf.overwrite(offset, frame_head, 1);
     offset += 1;
     // Section 5.1 : a client MUST mask all frames that it sends to the server
@@ -639,11 +686,8 @@ void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, boo
         fill_with_random(masking_key);
         buf.overwrite(offset, masking_key, 4);
         offset += 4;
-        // don't try to send empty payload
-        if (payload.size() == 0)
-            return;
         // Mask the payload
-        auto masked_payload = buf.span().slice(offset, payload.size());
+        auto masked_payload = buf.slice(offset, payload.size());
         for (size_t i = 0; i < payload.size(); ++i) {
             masked_payload[i] = payload[i] ^ (masking_key[i % 4]);
         }
@@ -652,7 +696,25 @@ void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, boo
         buf.overwrite(offset, payload.data(), payload.size());
         offset += payload.size();
     }
-    m_impl->send(buf.span().slice(0, offset));
+    m_pending_frames.trim(frames_size_before + offset, false);
+
+    if (m_has_scheduled_send)
+        return;
+    m_has_scheduled_send = true;
+    deferred_invoke([this] {
+        send_pending_frames();
+    });
+}
+
+void WebSocket::send_pending_frames()
+{
+    m_has_scheduled_send = false;
+    if (!m_impl || m_pending_frames.is_empty())
+        return;
+
+    auto frames = move(m_pending_frames);
+    if (!m_impl->send(frames))
+        dbgln("WebSocket: Failed to send {} bytes of frames", frames.size());
 }
 
 void WebSocket::fatal_error(WebSocket::Error error)
@@ -670,6 +732,7 @@ void WebSocket::discard_connection()
 
     deferred_invoke([this] {
         VERIFY(m_impl);
+        send_pending_frames();
         m_impl->discard_connection();
         m_impl->on_connection_error = nullptr;
         m_impl->on_connected = nullptr;
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/OwnPtr.h>
 #include <AK/Span.h>
 #include <LibCore/EventReceiver.h>
 #include <LibWebSocket/ConnectionInfo.h>
@@ -15,6 +16,8 @@
 
 namespace WebSocket {
 
+class PerMessageDeflate;
+
 enum class ReadyState {
     Connecting = 0,
     Open = 1,
@@ -41,7 +44,7 @@ class WebSocket final : public Core::EventReceiver {
     C_OBJECT(WebSocket)
 public:
     static NonnullRefPtr<WebSocket> create(ConnectionInfo, RefPtr<WebSocketImpl> = nullptr);
-    virtual ~WebSocket() override = default;
+    virtual ~WebSocket() override;
 
     URL::URL const& url() const { return m_connection.url(); }
 
@@ -90,8 +93,11 @@ private:
     void send_client_handshake();
     void read_server_handshake();
 
+    ErrorOr<void> accept_server_extensions(StringView);
+
     ErrorOr<void> read_frame();
-    void send_frame(OpCode, ReadonlyBytes, bool is_final);
+    void send_frame(OpCode, ReadonlyBytes, bool is_final, bool is_compressed = false);
+    void send_pending_frames();
 
     void notify_open();
     void notify_close(u16 code, ByteString reason, bool was_clean);
@@ -134,9 +140,19 @@ private:
     ConnectionInfo m_connection;
     RefPtr<WebSocketImpl> m_impl;
 
+    // The bytes before this offset belong to frames that have already been read.
+    size_t m_buffered_data_offset { 0 };
     Vector<u8> m_buffered_data;
     ByteBuffer m_fragmented_data_buffer;
     WebSocket::OpCode m_initial_fragment_opcode;
+    bool m_fragmented_message_is_compressed { false };
+
+    // Frames are sent together once control returns to the event loop, so that sending many small messages in a row
+    // doesn't take a write for each of them.
+    ByteBuffer m_pending_frames;
+    bool m_has_scheduled_send { false };
+
+    OwnPtr<PerMessageDeflate> m_per_message_deflate;
 };
 
 }
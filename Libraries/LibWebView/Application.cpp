@@ -7,9 +7,11 @@
 #include <AK/Debug.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
+#include <LibCore/File.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibCore/TimeZoneWatcher.h>
+#include <LibCore/Tracing.h>
 #include <LibDatabase/Database.h>
 #include <LibDevTools/DevToolsServer.h>
 #include <LibFileSystem/FileSystem.h>
@@ -21,6 +23,7 @@
 #include <LibWebView/HeadlessWebView.h>
 #include <LibWebView/HelperProcess.h>
 #include <LibWebView/Menu.h>
+#include <LibWebView/SiteIsolation.h>
 #include <LibWebView/URL.h>
 #include <LibWebView/UserAgent.h>
 #include <LibWebView/Utilities.h>
@@ -34,6 +37,11 @@
 
 namespace WebView {
 
+// A process is pre-warmed for a site once it has been visited this many times.
+static constexpr size_t PREWARMED_WEB_CONTENT_PROCESS_VISIT_THRESHOLD = 3;
+static constexpr size_t MAX_PREWARMED_WEB_CONTENT_PROCESSES = 2;
+static constexpr size_t MAX_SITES_WITH_VISIT_COUNTS = 256;
+
 Application* Application::s_the = nullptr;
 
 struct ApplicationSettingsObserver final : public SettingsObserver {
@@ -154,13 +162,20 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool disable_http_disk_cache = false;
     bool disable_content_filter = false;
     Optional<StringView> resource_substitution_map_path;
+    Optional<HTTP3Mode> http3_mode;
     bool enable_autoplay = false;
     bool expose_experimental_interfaces = false;
     bool expose_internals_object = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
+    bool collect_inline_cache_statistics = false;
+    GCHeapSizingOptions gc_heap_sizing;
     bool disable_scrollbar_painting = false;
+    Optional<size_t> spare_web_content_process_count;
+    Optional<size_t> spare_web_worker_process_count;
+    Optional<size_t> memory_limit_mib;
+    Optional<size_t> web_content_memory_budget_mib;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("The Ladybird web browser :^)");
@@ -216,6 +231,11 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation", 'g');
+    args_parser.add_option(collect_inline_cache_statistics, "Record JS inline cache hit/miss counters (slows down JS execution)", "collect-inline-cache-statistics");
+    args_parser.add_option(gc_heap_sizing.minimum_threshold_mib, "Minimum JS heap allocation between garbage collections (default: 4)", "gc-min-threshold", 0, "MiB");
+    args_parser.add_option(gc_heap_sizing.maximum_threshold_mib, "Maximum JS heap allocation between garbage collections (default: unlimited)", "gc-max-threshold", 0, "MiB");
+    args_parser.add_option(gc_heap_sizing.live_bytes_growth_factor, "JS heap allocation between garbage collections relative to live bytes (default: 1.0)", "gc-growth-factor", 0, "factor");
+    args_parser.add_option(gc_heap_sizing.target_overhead_percent, "Target share of time spent collecting garbage (default: disabled)", "gc-target-overhead", 0, "percent");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical scrollbars on the main viewport", "disable-scrollbar-painting");
     args_parser.add_option(dns_server_address, "Set the DNS server address", "dns-server", 0, "host|address");
     args_parser.add_option(dns_server_port, "Set the DNS server port", "dns-port", 0, "port (default: 53 or 853 if --dot)");
@@ -223,6 +243,10 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(validate_dnssec_locally, "Validate DNSSEC locally", "dnssec");
     args_parser.add_option(default_time_zone, "Default time zone", "default-time-zone", 0, "time-zone-id");
     args_parser.add_option(resource_substitution_map_path, "Path to JSON file mapping URLs to local files", "resource-map", 0, "path");
+    args_parser.add_option(spare_web_content_process_count, "Number of WebContent processes to launch ahead of time (default: 1)", "spare-web-content-processes", 0, "count");
+    args_parser.add_option(spare_web_worker_process_count, "Number of WebWorker processes of each type to launch ahead of time (default: 0)", "spare-web-worker-processes", 0, "count");
+    args_parser.add_option(memory_limit_mib, "Memory usage at which processes start releasing memory (default: the limit imposed by the system)", "memory-limit", 0, "MiB");
+    args_parser.add_option(web_content_memory_budget_mib, "Memory usage of WebContent processes at which pages of the same site start sharing a process (default: unlimited)", "web-content-memory-budget", 0, "MiB");
 
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
@@ -239,6 +263,23 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         },
     });
 
+    args_parser.add_option(Core::ArgsParser::Option {
+        .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
+        .help_string = "When to use HTTP/3. Mode may be 'disabled', 'alt-svc' (default), or 'enabled'.",
+        .long_name = "http3",
+        .value_name = "mode",
+        .accept_value = [&](StringView value) {
+            if (value == "disabled"sv)
+                http3_mode = HTTP3Mode::Disabled;
+            else if (value == "alt-svc"sv)
+                http3_mode = HTTP3Mode::AltSvc;
+            else if (value == "enabled"sv)
+                http3_mode = HTTP3Mode::Enabled;
+
+            return http3_mode.has_value();
+        },
+    });
+
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
         .help_string = "Name of the User-Agent preset to use in place of the default User-Agent",
@@ -301,6 +342,15 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     if (webdriver_endpoint.has_value())
         m_browser_options.webdriver_endpoint = *webdriver_endpoint;
 
+    if (spare_web_content_process_count.has_value())
+        m_browser_options.spare_web_content_process_count = *spare_web_content_process_count;
+    if (spare_web_worker_process_count.has_value())
+        m_browser_options.spare_web_worker_process_count = *spare_web_worker_process_count;
+    if (memory_limit_mib.has_value())
+        m_browser_options.memory_limit_in_bytes = static_cast<u64>(*memory_limit_mib) * MiB;
+    if (web_content_memory_budget_mib.has_value())
+        m_browser_options.web_content_memory_budget_in_bytes = static_cast<u64>(*web_content_memory_budget_mib) * MiB;
+
     auto http_disk_cache_mode = HTTPDiskCacheMode::Enabled;
     if (disable_http_disk_cache)
         http_disk_cache_mode = HTTPDiskCacheMode::Disabled;
@@ -310,6 +360,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     m_request_server_options = {
         .certificates = move(certificates),
         .http_disk_cache_mode = http_disk_cache_mode,
+        .http3_mode = http3_mode.value_or(HTTP3Mode::AltSvc),
         .resource_substitution_map_path = resource_substitution_map_path.has_value() ? Optional<ByteString> { *resource_substitution_map_path } : OptionalNone {},
     };
 
@@ -328,6 +379,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .force_fontconfig = force_fontconfig ? ForceFontconfig::Yes : ForceFontconfig::No,
         .enable_autoplay = enable_autoplay ? EnableAutoplay::Yes : EnableAutoplay::No,
         .collect_garbage_on_every_allocation = collect_garbage_on_every_allocation ? CollectGarbageOnEveryAllocation::Yes : CollectGarbageOnEveryAllocation::No,
+        .collect_inline_cache_statistics = collect_inline_cache_statistics ? CollectInlineCacheStatistics::Yes : CollectInlineCacheStatistics::No,
+        .gc_heap_sizing = gc_heap_sizing,
         .paint_viewport_scrollbars = disable_scrollbar_painting ? PaintViewportScrollbars::No : PaintViewportScrollbars::Yes,
         .default_time_zone = default_time_zone,
     };
@@ -372,36 +425,64 @@ static ErrorOr<NonnullRefPtr<WebContentClient>> create_web_content_client(Option
 
 ErrorOr<NonnullRefPtr<WebContentClient>> Application::launch_web_content_process(ViewImplementation& view)
 {
-    if (m_spare_web_content_process) {
-        auto web_content_client = m_spare_web_content_process.release_nonnull();
-        launch_spare_web_content_process();
+    if (auto site = site_for_process_consolidation(view.url()); site.has_value()) {
+        if (auto web_content_client = m_prewarmed_web_content_processes.take(*site); web_content_client.has_value()) {
+            m_process_manager->did_allocate_web_content_process(WebContentProcessAllocation::PrewarmedProcess);
+
+            (*web_content_client)->assign_view({}, view);
+            return web_content_client.release_value();
+        }
+    }
+
+    m_process_manager->did_allocate_web_content_process(WebContentProcessAllocation::NewProcess);
+
+    if (!m_spare_web_content_processes.is_empty()) {
+        auto web_content_client = m_spare_web_content_processes.take_first();
+        launch_spare_web_content_processes();
 
         web_content_client->assign_view({}, view);
         return web_content_client;
     }
 
-    launch_spare_web_content_process();
+    launch_spare_web_content_processes();
     return create_web_content_client(view);
 }
 
-void Application::launch_spare_web_content_process()
+bool Application::should_launch_spare_web_content_processes() const
 {
     // Spare WebContent processes inherit the active WebDriver endpoint, but they are not part of the
     // session and can race browser shutdown while bootstrapping.
     if (browser_options().webdriver_endpoint.has_value())
-        return;
+        return false;
 
     // Disable spare processes when debugging WebContent. Otherwise, it breaks running `gdb attach -p $(pidof WebContent)`.
     if (browser_options().debug_helper_process == ProcessType::WebContent)
-        return;
+        return false;
     // Disable spare processes when profiling WebContent. This reduces callgrind logging we are not interested in.
     if (browser_options().profile_helper_process == ProcessType::WebContent)
+        return false;
+
+    return browser_options().spare_web_content_process_count > 0;
+}
+
+void Application::launch_spare_web_content_processes()
+{
+    if (!should_launch_spare_web_content_processes())
+        return;
+
+    if (m_spare_web_content_processes.size() >= browser_options().spare_web_content_process_count)
         return;
 
     if (m_has_queued_task_to_launch_spare_web_content_process)
         return;
+
+    // New pages share processes once WebContent processes have used up their memory budget, so a spare process would
+    // only add to the memory usage.
+    if (has_exceeded_web_content_memory_budget())
+        return;
     m_has_queued_task_to_launch_spare_web_content_process = true;
 
+    // NB: Processes are launched one at a time, so that filling up the pool does not stall the event loop.
     Core::deferred_invoke([this]() {
         m_has_queued_task_to_launch_spare_web_content_process = false;
 
@@ -411,10 +492,181 @@ void Application::launch_spare_web_content_process()
             return;
         }
 
-        m_spare_web_content_process = web_content_client.release_value();
-
-        if (auto process = find_process(m_spare_web_content_process->pid()); process.has_value())
+        if (auto process = find_process(web_content_client.value()->pid()); process.has_value())
             process->set_title("(spare)"_utf16);
+
+        m_spare_web_content_processes.append(web_content_client.release_value());
+        launch_spare_web_content_processes();
+    });
+}
+
+RefPtr<WebContentClient> Application::find_web_content_process_to_share(URL::URL const& url)
+{
+    // Pages only share processes, and processes are only pre-warmed for sites, if WebContent processes have a budget.
+    if (!browser_options().web_content_memory_budget_in_bytes.has_value())
+        return {};
+
+    auto site = site_for_process_consolidation(url);
+    if (!site.has_value())
+        return {};
+
+    // NB: The counts only serve as a heuristic, so they are simply started over once too many sites have been visited.
+    if (m_site_visit_counts.size() >= MAX_SITES_WITH_VISIT_COUNTS && !m_site_visit_counts.contains(*site))
+        m_site_visit_counts.clear();
+
+    auto& visit_count = m_site_visit_counts.ensure(*site, [] { return 0uz; });
+    ++visit_count;
+
+    if (visit_count >= PREWARMED_WEB_CONTENT_PROCESS_VISIT_THRESHOLD)
+        prewarm_web_content_process_for_site(*site, url);
+
+    if (!has_exceeded_web_content_memory_budget())
+        return {};
+
+    // Pages of other sites never share a process with this page, so a new process is still launched for it if no
+    // process shows pages of its site yet.
+    RefPtr<WebContentClient> process_to_share;
+
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        if (!client.is_open() || !client.is_showing_only_pages_of_site(*site))
+            return IterationDecision::Continue;
+
+        // Spread the pages of the site evenly across the processes that show them.
+        if (!process_to_share || client.view_count() < process_to_share->view_count())
+            process_to_share = client;
+
+        return IterationDecision::Continue;
+    });
+
+    if (process_to_share) {
+        dbgln_if(WEBVIEW_PROCESS_DEBUG, "Page for {} shares WebContent process {}", url, process_to_share->pid());
+        m_process_manager->did_allocate_web_content_process(WebContentProcessAllocation::SharedProcess);
+    }
+
+    return process_to_share;
+}
+
+void Application::prewarm_web_content_process_for_site(String const& site, URL::URL const& url)
+{
+    if (!should_launch_spare_web_content_processes())
+        return;
+
+    if (m_prewarmed_web_content_processes.contains(site) || m_sites_with_queued_prewarmed_web_content_process.contains(site))
+        return;
+
+    if (m_prewarmed_web_content_processes.size() + m_sites_with_queued_prewarmed_web_content_process.size() >= MAX_PREWARMED_WEB_CONTENT_PROCESSES) {
+        auto visit_count_of_site = [&](String const& site_to_count) { return m_site_visit_counts.get(site_to_count).value_or(0); };
+
+        // Make room by giving up the process of the site that is visited least often, if this site is visited more often.
+        Optional<String> least_visited_site;
+        for (auto const& [prewarmed_site, web_content_client] : m_prewarmed_web_content_processes) {
+            if (!least_visited_site.has_value() || visit_count_of_site(prewarmed_site) < visit_count_of_site(*least_visited_site))
+                least_visited_site = prewarmed_site;
+        }
+
+        if (!least_visited_site.has_value() || visit_count_of_site(*least_visited_site) >= visit_count_of_site(site))
+            return;
+
+        m_prewarmed_web_content_processes.take(*least_visited_site).value()->async_close_server();
+    }
+
+    if (has_exceeded_web_content_memory_budget())
+        return;
+
+    m_sites_with_queued_prewarmed_web_content_process.set(site);
+
+    Core::deferred_invoke([this, site, url]() {
+        m_sites_with_queued_prewarmed_web_content_process.remove(site);
+
+        auto web_content_client = create_web_content_client({});
+        if (web_content_client.is_error()) {
+            dbgln("Unable to create pre-warmed web content client for {}: {}", site, web_content_client.error());
+            return;
+        }
+
+        if (auto process = find_process(web_content_client.value()->pid()); process.has_value())
+            process->set_title(Utf16String::formatted("(pre-warmed for {})", site));
+
+        // Resolve the host of the site ahead of time as well, so that the first request to it does not wait on DNS.
+        request_server_client().ensure_connection(url, RequestServer::CacheLevel::ResolveOnly);
+
+        m_prewarmed_web_content_processes.set(site, web_content_client.release_value());
+    });
+}
+
+void Application::release_prewarmed_web_content_processes()
+{
+    for (auto const& [site, web_content_client] : m_prewarmed_web_content_processes)
+        web_content_client->async_close_server();
+
+    m_prewarmed_web_content_processes.clear();
+}
+
+bool Application::has_exceeded_web_content_memory_budget()
+{
+    auto memory_budget = browser_options().web_content_memory_budget_in_bytes;
+    if (!memory_budget.has_value())
+        return false;
+
+    m_process_manager->update_all_process_statistics();
+    return m_process_manager->web_content_process_statistics().memory_usage_in_bytes >= *memory_budget;
+}
+
+static size_t spare_web_worker_pool_index(Web::Bindings::AgentType type)
+{
+    switch (type) {
+    case Web::Bindings::AgentType::DedicatedWorker:
+        return 0;
+    case Web::Bindings::AgentType::SharedWorker:
+        return 1;
+    case Web::Bindings::AgentType::ServiceWorker:
+        return 2;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> Application::launch_web_worker_process(Web::Bindings::AgentType type)
+{
+    auto& pool = m_spare_web_worker_processes[spare_web_worker_pool_index(type)];
+
+    if (!pool.is_empty()) {
+        auto web_worker_client = pool.take_first();
+        launch_spare_web_worker_processes(type);
+        return web_worker_client;
+    }
+
+    launch_spare_web_worker_processes(type);
+    return WebView::launch_web_worker_process(type);
+}
+
+void Application::launch_spare_web_worker_processes(Web::Bindings::AgentType type)
+{
+    // Disable spare processes when debugging or profiling WebWorker, for the same reasons as for WebContent.
+    if (browser_options().debug_helper_process == ProcessType::WebWorker)
+        return;
+    if (browser_options().profile_helper_process == ProcessType::WebWorker)
+        return;
+
+    auto index = spare_web_worker_pool_index(type);
+    if (m_spare_web_worker_processes[index].size() >= browser_options().spare_web_worker_process_count)
+        return;
+
+    if (m_has_queued_task_to_launch_spare_web_worker_process[index])
+        return;
+    m_has_queued_task_to_launch_spare_web_worker_process[index] = true;
+
+    Core::deferred_invoke([this, type, index]() {
+        m_has_queued_task_to_launch_spare_web_worker_process[index] = false;
+
+        auto web_worker_client = WebView::launch_web_worker_process(type);
+        if (web_worker_client.is_error()) {
+            dbgln("Unable to create spare web worker client: {}", web_worker_client.error());
+            return;
+        }
+
+        m_spare_web_worker_processes[index].append(web_worker_client.release_value());
+        launch_spare_web_worker_processes(type);
     });
 }
 
@@ -428,6 +680,22 @@ ErrorOr<void> Application::launch_services()
         process_did_exit(move(process));
     };
 
+    auto memory_limit = m_browser_options.memory_limit_in_bytes;
+    if (!memory_limit.has_value())
+        memory_limit = ProcessManager::system_memory_limit();
+
+    if (memory_limit.has_value()) {
+        m_process_manager->on_memory_pressure = [this](Core::MemoryPressureLevel level) {
+            release_prewarmed_web_content_processes();
+
+            WebContentClient::for_each_client([&](WebContentClient& client) {
+                client.async_release_memory(level);
+                return IterationDecision::Continue;
+            });
+        };
+        m_process_manager->start_monitoring_memory_pressure(*memory_limit);
+    }
+
     if (m_browser_options.disable_sql_database == DisableSQLDatabase::No) {
         // FIXME: Move this to a generic "Ladybird data directory" helper.
         auto database_path = ByteString::formatted("{}/Ladybird", Core::StandardPaths::user_data_directory());
@@ -637,11 +905,119 @@ NonnullOwnPtr<Core::EventLoop> Application::create_platform_event_loop()
     return make<Core::EventLoop>();
 }
 
+static void set_tracing_enabled_in_process(Process& process, bool enabled)
+{
+    switch (process.type()) {
+    case ProcessType::Browser:
+        Core::Tracing::set_enabled(enabled);
+        break;
+    case ProcessType::ImageDecoder:
+        if (auto client = process.client<ImageDecoderClient::Client>(); client.has_value())
+            client->async_set_tracing_enabled(enabled);
+        break;
+    case ProcessType::RequestServer:
+        if (auto client = process.client<Requests::RequestClient>(); client.has_value())
+            client->async_set_tracing_enabled(enabled);
+        break;
+    case ProcessType::WebContent:
+        if (auto client = process.client<WebContentClient>(); client.has_value())
+            client->async_set_tracing_enabled(enabled);
+        break;
+    case ProcessType::WebWorker:
+        // FIXME: Record trace events in WebWorker processes as well.
+        break;
+    }
+}
+
+static ByteString take_trace_events_from_process(Process& process)
+{
+    switch (process.type()) {
+    case ProcessType::Browser:
+        return Core::Tracing::take_events_as_json();
+    case ProcessType::ImageDecoder:
+        if (auto client = process.client<ImageDecoderClient::Client>(); client.has_value())
+            return client->take_trace_events();
+        break;
+    case ProcessType::RequestServer:
+        if (auto client = process.client<Requests::RequestClient>(); client.has_value())
+            return client->take_trace_events();
+        break;
+    case ProcessType::WebContent:
+        if (auto client = process.client<WebContentClient>(); client.has_value())
+            return client->take_trace_events();
+        break;
+    case ProcessType::WebWorker:
+        break;
+    }
+    return {};
+}
+
 void Application::add_child_process(WebView::Process&& process)
 {
+    // Processes that are launched while a trace is being recorded, e.g. for new tabs, are included in the trace.
+    if (Core::Tracing::is_enabled())
+        set_tracing_enabled_in_process(process, true);
+
     m_process_manager->add_process(move(process));
 }
 
+void Application::start_recording_trace()
+{
+    m_process_manager->for_each_process([](Process& process) {
+        set_tracing_enabled_in_process(process, true);
+    });
+}
+
+ByteString Application::stop_recording_trace()
+{
+    StringBuilder builder;
+    builder.append("{\"traceEvents\":["sv);
+
+    bool is_first_event = true;
+    auto append_events = [&](StringView events) {
+        if (events.is_empty())
+            return;
+        if (!is_first_event)
+            builder.append(',');
+        is_first_event = false;
+        builder.append(events);
+    };
+
+    m_process_manager->for_each_process([&](Process& process) {
+        // NB: Messages to a process are handled in order, so nothing is recorded after the events have been taken.
+        set_tracing_enabled_in_process(process, false);
+
+        // Name the process in the trace the same way the task manager does, so the trace viewer can tell them apart.
+        StringBuilder metadata;
+        metadata.appendff("{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{},\"args\":{{\"name\":\"", process.pid());
+        metadata.append_escaped_for_json(process_name_from_type(process.type()));
+        if (auto const& title = process.title(); title.has_value()) {
+            metadata.append(" - "sv);
+            metadata.append_escaped_for_json(title->to_byte_string());
+        }
+        metadata.append("\"}}"sv);
+
+        append_events(metadata.string_view());
+        append_events(take_trace_events_from_process(process));
+    });
+
+    builder.append("]}"sv);
+    return builder.to_byte_string();
+}
+
+ErrorOr<LexicalPath> Application::stop_recording_trace_into_file()
+{
+    auto trace = stop_recording_trace();
+
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(TRY(AK::UnixDateTime::now().to_string("trace-%Y-%m-%d-%H-%M-%S.json"sv)));
+
+    auto trace_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(trace_file->write_until_depleted(trace.bytes()));
+
+    return path;
+}
+
 #if defined(AK_OS_MACH)
 void Application::set_process_mach_port(pid_t pid, Core::MachPort&& port)
 {
@@ -791,6 +1167,11 @@ void Application::clear_browsing_data(ClearBrowsingDataOptions const& options)
     if (options.delete_site_data == ClearBrowsingDataOptions::Delete::Yes) {
         m_cookie_jar->expire_cookies_accessed_since(options.since);
         m_storage_jar->remove_items_accessed_since(options.since);
+
+        WebContentClient::for_each_client([](WebContentClient& client) {
+            client.async_all_storage_changed();
+            return IterationDecision::Continue;
+        });
     }
 }
 
@@ -988,6 +1369,23 @@ void Application::initialize_actions()
             }
         }
     }));
+    m_debug_menu->add_action(Action::create("Dump GC Cell Statistics"sv, ActionID::DumpGCCellStatistics, debug_request("dump-gc-cell-statistics"sv)));
+    m_debug_menu->add_action(Action::create("Dump Inline Cache Statistics"sv, ActionID::DumpInlineCacheStatistics, debug_request("dump-inline-cache-statistics"sv)));
+    m_debug_menu->add_action(Action::create("Dump Lazy Compilation Statistics"sv, ActionID::DumpLazyCompilationStatistics, debug_request("dump-lazy-compilation-statistics"sv)));
+    m_debug_menu->add_separator();
+
+    m_record_performance_trace_action = Action::create_checkable("Record Performance Trace"sv, ActionID::RecordPerformanceTrace, [this]() {
+        if (m_record_performance_trace_action->checked()) {
+            start_recording_trace();
+            return;
+        }
+
+        if (auto trace_path = stop_recording_trace_into_file(); trace_path.is_error())
+            warnln("\033[31;1mFailed to record performance trace: {}\033[0m", trace_path.error());
+        else
+            warnln("\033[33;1mRecorded performance trace into {}, which may be opened in https://ui.perfetto.dev\033[0m", trace_path.value());
+    });
+    m_debug_menu->add_action(*m_record_performance_trace_action);
     m_debug_menu->add_separator();
 
     m_show_line_box_borders_action = Action::create_checkable("Show Line Box Borders"sv, ActionID::ShowLineBoxBorders, check(m_show_line_box_borders_action, "set-line-box-borders"sv));
@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/ByteString.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/LexicalPath.h>
 #include <AK/Optional.h>
 #include <LibCore/EventLoop.h>
@@ -20,10 +23,12 @@
 #include <LibMain/Main.h>
 #include <LibRequests/Forward.h>
 #include <LibURL/URL.h>
+#include <LibWeb/Bindings/AgentType.h>
 #include <LibWeb/CSS/PreferredColorScheme.h>
 #include <LibWeb/CSS/PreferredContrast.h>
 #include <LibWeb/CSS/PreferredMotion.h>
 #include <LibWeb/Clipboard/SystemClipboard.h>
+#include <LibWeb/Forward.h>
 #include <LibWeb/HTML/ActivateTab.h>
 #include <LibWebView/BookmarkStore.h>
 #include <LibWebView/FileDownloader.h>
@@ -78,6 +83,11 @@ public:
 
     ErrorOr<NonnullRefPtr<WebContentClient>> launch_web_content_process(ViewImplementation&);
 
+    // Returns a process that already shows pages of the URL's site, if a new page for the URL should share it rather than
+    // get a process of its own. This also counts the visit to the site, to pre-warm processes for frequently visited sites.
+    RefPtr<WebContentClient> find_web_content_process_to_share(URL::URL const&);
+    ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(Web::Bindings::AgentType);
+
     virtual Optional<ViewImplementation&> active_web_view() const { return {}; }
     virtual Optional<ViewImplementation&> open_blank_new_tab(Web::HTML::ActivateTab) const { return {}; }
     void open_url_in_new_tab(URL::URL const&, Web::HTML::ActivateTab) const;
@@ -150,6 +160,12 @@ public:
     void apply_view_options(Badge<ViewImplementation>, ViewImplementation&);
 
     ErrorOr<void> toggle_devtools_enabled();
+
+    // Records trace events in all processes until the trace is stopped, at which point the events recorded by all of
+    // them are collected into a single JSON object in the Chrome trace event format.
+    void start_recording_trace();
+    ByteString stop_recording_trace();
+    ErrorOr<LexicalPath> stop_recording_trace_into_file();
     void refresh_tab_list();
 
     Optional<Core::TimeZoneWatcher&> time_zone_watcher();
@@ -177,7 +193,12 @@ protected:
 
 private:
     ErrorOr<void> launch_services();
-    void launch_spare_web_content_process();
+    bool should_launch_spare_web_content_processes() const;
+    void launch_spare_web_content_processes();
+    void prewarm_web_content_process_for_site(String const& site, URL::URL const&);
+    void release_prewarmed_web_content_processes();
+    bool has_exceeded_web_content_memory_budget();
+    void launch_spare_web_worker_processes(Web::Bindings::AgentType);
     ErrorOr<void> launch_request_server();
     ErrorOr<void> launch_image_decoder_server();
     ErrorOr<void> launch_devtools_server();
@@ -240,9 +261,18 @@ private:
     RefPtr<Requests::RequestClient> m_request_server_client;
     RefPtr<ImageDecoderClient::Client> m_image_decoder_client;
 
-    RefPtr<WebContentClient> m_spare_web_content_process;
+    Vector<NonnullRefPtr<WebContentClient>> m_spare_web_content_processes;
     bool m_has_queued_task_to_launch_spare_web_content_process { false };
 
+    // Processes that were launched ahead of time for the sites that are visited most often, keyed by their site.
+    HashMap<String, NonnullRefPtr<WebContentClient>> m_prewarmed_web_content_processes;
+    HashTable<String> m_sites_with_queued_prewarmed_web_content_process;
+    HashMap<String, size_t> m_site_visit_counts;
+
+    // One pool for each of dedicated, shared and service workers.
+    Array<Vector<NonnullRefPtr<Web::HTML::WebWorkerClient>>, 3> m_spare_web_worker_processes;
+    Array<bool, 3> m_has_queued_task_to_launch_spare_web_worker_process {};
+
     RefPtr<Database::Database> m_database;
     OwnPtr<CookieJar> m_cookie_jar;
     OwnPtr<StorageJar> m_storage_jar;
@@ -282,6 +312,7 @@ private:
     RefPtr<Action> m_toggle_devtools_action;
 
     RefPtr<Menu> m_debug_menu;
+    RefPtr<Action> m_record_performance_trace_action;
     RefPtr<Action> m_show_line_box_borders_action;
     RefPtr<Action> m_enable_scripting_action;
     RefPtr<Action> m_enable_content_filtering_action;
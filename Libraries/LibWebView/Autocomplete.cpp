@@ -15,6 +15,7 @@
 #include <LibWeb/MimeSniff/MimeType.h>
 #include <LibWebView/Application.h>
 #include <LibWebView/Autocomplete.h>
+#include <LibWebView/URL.h>
 
 namespace WebView {
 
@@ -54,6 +55,8 @@ void Autocomplete::query_autocomplete_engine(String query)
         return;
     }
 
+    preconnect_to_predicted_navigation(trimmed_query);
+
     auto engine = Application::settings().autocomplete_engine();
     if (!engine.has_value()) {
         invoke_autocomplete_query_complete({});
@@ -97,6 +100,22 @@ void Autocomplete::query_autocomplete_engine(String query)
         });
 }
 
+void Autocomplete::preconnect_to_predicted_navigation(StringView query)
+{
+    // Whatever is being typed is likely to be navigated to soon, either directly or as a search. Connecting to its
+    // origin now takes the DNS lookup and the TCP and TLS handshakes off of the navigation's critical path.
+    auto url = sanitize_url(query, Application::settings().search_engine());
+    if (!url.has_value() || !url->scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    auto origin = url->origin();
+    if (m_preconnected_origin == origin)
+        return;
+    m_preconnected_origin = move(origin);
+
+    Application::request_server_client().ensure_connection(*url, RequestServer::CacheLevel::CreateConnection);
+}
+
 static ErrorOr<Vector<String>> parse_duckduckgo_autocomplete(JsonValue const& json)
 {
     if (!json.is_array())
@@ -13,6 +13,7 @@
 #include <AK/String.h>
 #include <AK/Vector.h>
 #include <LibRequests/Forward.h>
+#include <LibURL/Origin.h>
 #include <LibWebView/Forward.h>
 
 namespace WebView {
@@ -37,9 +38,11 @@ public:
 private:
     static ErrorOr<Vector<String>> received_autocomplete_respsonse(AutocompleteEngine const&, Optional<ByteString const&> content_type, StringView response);
     void invoke_autocomplete_query_complete(Vector<String> suggestions) const;
+    void preconnect_to_predicted_navigation(StringView query);
 
     String m_query;
     RefPtr<Requests::Request> m_request;
+    Optional<URL::Origin> m_preconnected_origin;
 };
 
 }
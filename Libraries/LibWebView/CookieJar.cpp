@@ -72,6 +72,8 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage)
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
         [this]() {
+            auto transaction = m_persisted_storage->database.begin_transaction();
+
             for (auto const& it : m_transient_storage.take_dirty_cookies())
                 m_persisted_storage->insert_cookie(it.value);
 
@@ -93,7 +95,17 @@ CookieJar::~CookieJar()
 // https://datatracker.ietf.org/doc/html/draft-ietf-httpbis-rfc6265bis-22#section-5.8.3
 String CookieJar::get_cookie(URL::URL const& url, HTTP::Cookie::Source source)
 {
-    m_transient_storage.purge_expired_cookies();
+    auto now = m_transient_storage.purge_expired_cookies();
+
+    auto retrieval_host_canonical = HTTP::Cookie::canonicalize_domain(url);
+    if (!retrieval_host_canonical.has_value())
+        return {};
+
+    // OPTIMIZATION: Every request to a site asks for the same cookies, so we reuse the Cookie header we serialized for
+    //               the previous request to the same URL path, unless a cookie on a matching domain changed since.
+    CookieHeaderCacheKey cache_key { retrieval_host_canonical.release_value(), url.serialize_path(), url.scheme() == "https"sv || url.scheme() == "wss"sv, source };
+    if (auto header = m_transient_storage.get_cookie_header(cache_key, now); header.has_value())
+        return header.release_value();
 
     auto cookie_list = get_matching_cookies(url, source);
 
@@ -115,7 +127,14 @@ String CookieJar::get_cookie(URL::URL const& url, HTTP::Cookie::Source source)
         // 3. If the cookie was not the last cookie in the cookie-list, output the characters %x3B and %x20 ("; ").
     }
 
-    return MUST(builder.to_string());
+    TransientStorage::CachedCookieHeader cached_header { MUST(builder.to_string()), {} };
+    cached_header.cookies.ensure_capacity(cookie_list.size());
+    for (auto const& cookie : cookie_list)
+        cached_header.cookies.unchecked_append({ cookie.name, cookie.domain, cookie.path });
+
+    auto header = cached_header.header;
+    m_transient_storage.set_cookie_header(move(cache_key), move(cached_header));
+    return header;
 }
 
 // https://datatracker.ietf.org/doc/html/draft-ietf-httpbis-rfc6265bis-22#section-5.7
@@ -507,7 +526,7 @@ Vector<HTTP::Cookie::Cookie> CookieJar::get_matching_cookies(URL::URL const& url
     // 3. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<HTTP::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](HTTP::Cookie::Cookie& cookie) {
+    m_transient_storage.for_each_cookie_for_host(*retrieval_host_canonical, [&](HTTP::Cookie::Cookie& cookie) {
         if (!HTTP::Cookie::cookie_matches_url(cookie, url, *retrieval_host_canonical, source))
             return;
 
@@ -550,36 +569,56 @@ Vector<HTTP::Cookie::Cookie> CookieJar::get_matching_cookies(URL::URL const& url
 
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
-    m_cookies = move(cookies);
+    m_cookies_by_domain.clear();
+    m_cookie_headers.clear();
+    m_size = cookies.size();
+    m_next_expiry_time = UnixDateTime::latest();
+
+    for (auto& [key, cookie] : cookies) {
+        m_next_expiry_time = min(m_next_expiry_time, cookie.expiry_time);
+        m_cookies_by_domain.ensure(key.domain).set(key, move(cookie));
+    }
+
     purge_expired_cookies();
 }
 
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, HTTP::Cookie::Cookie cookie)
 {
     auto now = UnixDateTime::now();
+    auto& bucket = m_cookies_by_domain.ensure(key.domain);
 
     // AD-HOC: Skip adding immediately-expiring cookies (i.e., only allow updating to immediately-expiring) to prevent
     //         firing deletion events for them.
     //         Spec issue: https://github.com/whatwg/cookiestore/issues/282
-    if (cookie.expiry_time < now && !m_cookies.contains(key))
+    if (cookie.expiry_time < now && !bucket.contains(key)) {
+        if (bucket.is_empty())
+            m_cookies_by_domain.remove(key.domain);
         return;
+    }
 
     // We skip notifying about updating expired cookies, as they will be notified as being expired immediately after instead
     if (cookie.expiry_time >= now) {
         auto cookie_value_changed = true;
-        if (auto old_cookie = m_cookies.get(key); old_cookie.has_value())
+        if (auto old_cookie = bucket.get(key); old_cookie.has_value())
             cookie_value_changed = old_cookie->value != cookie.value;
 
         send_cookie_changed_notifications({ { CookieEntry { {}, cookie } } }, cookie_value_changed);
     }
 
-    m_cookies.set(key, cookie);
+    invalidate_cookie_headers_for_domain(key.domain);
+    m_next_expiry_time = min(m_next_expiry_time, cookie.expiry_time);
+
+    if (bucket.set(key, cookie) == HashSetResult::InsertedNewEntry)
+        ++m_size;
     m_dirty_cookies.set(move(key), move(cookie));
 }
 
 Optional<HTTP::Cookie::Cookie const&> CookieJar::TransientStorage::get_cookie(CookieStorageKey const& key)
 {
-    return m_cookies.get(key);
+    auto bucket = m_cookies_by_domain.find(key.domain);
+    if (bucket == m_cookies_by_domain.end())
+        return {};
+    return bucket->value.get(key);
 }
 
 UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Duration> offset)
@@ -592,9 +631,31 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
             cookie.value.expiry_time -= *offset;
     }
 
+    // OPTIMIZATION: This runs for every cookie that is read or written, so we avoid looking at every cookie until one of
+    //               them actually expires.
+    if (now <= m_next_expiry_time)
+        return now;
+
     auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
 
-    if (auto removed_entries = m_cookies.take_all_matching(is_expired); !removed_entries.is_empty())
+    Vector<CookieEntry> removed_entries;
+    m_next_expiry_time = UnixDateTime::latest();
+
+    for (auto& [domain, bucket] : m_cookies_by_domain) {
+        auto removed_bucket_entries = bucket.take_all_matching(is_expired);
+        if (!removed_bucket_entries.is_empty()) {
+            invalidate_cookie_headers_for_domain(domain);
+            removed_entries.extend(move(removed_bucket_entries));
+        }
+
+        for (auto const& it : bucket)
+            m_next_expiry_time = min(m_next_expiry_time, it.value.expiry_time);
+    }
+
+    m_cookies_by_domain.remove_all_matching([](auto const&, auto const& bucket) { return bucket.is_empty(); });
+    m_size -= removed_entries.size();
+
+    if (!removed_entries.is_empty())
         send_cookie_changed_notifications(removed_entries);
 
     return now;
@@ -602,11 +663,16 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
 
 void CookieJar::TransientStorage::expire_and_purge_cookies_accessed_since(UnixDateTime since)
 {
-    for (auto& [key, value] : m_cookies) {
-        if (value.last_access_time >= since) {
-            value.expiry_time = UnixDateTime::earliest();
-            set_cookie(key, value);
-        }
+    Vector<CookieEntry> cookies_to_expire;
+
+    for_each_cookie([&](HTTP::Cookie::Cookie const& cookie) {
+        if (cookie.last_access_time >= since)
+            cookies_to_expire.append({ { cookie.name, cookie.domain, cookie.path }, cookie });
+    });
+
+    for (auto& [key, cookie] : cookies_to_expire) {
+        cookie.expiry_time = UnixDateTime::earliest();
+        set_cookie(move(key), move(cookie));
     }
 
     purge_expired_cookies();
@@ -616,17 +682,53 @@ Requests::CacheSizes CookieJar::TransientStorage::estimate_storage_size_accessed
 {
     Requests::CacheSizes sizes;
 
-    for (auto const& [key, value] : m_cookies) {
-        auto size = key.name.byte_count() + key.domain.byte_count() + key.path.byte_count() + value.value.byte_count();
-        sizes.total += size;
+    for (auto const& [domain, bucket] : m_cookies_by_domain) {
+        for (auto const& [key, value] : bucket) {
+            auto size = key.name.byte_count() + key.domain.byte_count() + key.path.byte_count() + value.value.byte_count();
+            sizes.total += size;
 
-        if (value.last_access_time >= since)
-            sizes.since_requested_time += size;
+            if (value.last_access_time >= since)
+                sizes.since_requested_time += size;
+        }
     }
 
     return sizes;
 }
 
+Optional<String> CookieJar::TransientStorage::get_cookie_header(CookieHeaderCacheKey const& key, UnixDateTime now)
+{
+    auto cached_header = m_cookie_headers.get(key);
+    if (!cached_header.has_value())
+        return {};
+
+    // 5. Update the last-access-time of each cookie in the cookie-list to the current date and time.
+    for (auto const& cookie_key : cached_header->cookies) {
+        if (auto bucket = m_cookies_by_domain.find(cookie_key.domain); bucket != m_cookies_by_domain.end()) {
+            if (auto cookie = bucket->value.get(cookie_key); cookie.has_value())
+                cookie->last_access_time = now;
+        }
+    }
+
+    return cached_header->header;
+}
+
+void CookieJar::TransientStorage::set_cookie_header(CookieHeaderCacheKey key, CachedCookieHeader header)
+{
+    // NB: All of the headers are cached for the same few sites most of the time, so there is no need to be any smarter
+    //     about which ones to evict.
+    if (m_cookie_headers.size() >= MAXIMUM_CACHED_COOKIE_HEADERS)
+        m_cookie_headers.clear();
+
+    m_cookie_headers.set(move(key), move(header));
+}
+
+void CookieJar::TransientStorage::invalidate_cookie_headers_for_domain(StringView domain)
+{
+    m_cookie_headers.remove_all_matching([&](auto const& key, auto const&) {
+        return HTTP::Cookie::domain_matches(key.host, domain);
+    });
+}
+
 void CookieJar::TransientStorage::send_cookie_changed_notifications(ReadonlySpan<CookieEntry> cookies, bool inform_web_view_about_changed_domains)
 {
     ViewImplementation::for_each_view([&](ViewImplementation& view) {
@@ -12,6 +12,7 @@
 #include <AK/String.h>
 #include <AK/StringView.h>
 #include <AK/Traits.h>
+#include <AK/Vector.h>
 #include <LibCore/Timer.h>
 #include <LibDatabase/Forward.h>
 #include <LibHTTP/Cookie/Cookie.h>
@@ -30,6 +31,15 @@ struct CookieStorageKey {
     String path;
 };
 
+struct CookieHeaderCacheKey {
+    bool operator==(CookieHeaderCacheKey const&) const = default;
+
+    String host;
+    String path;
+    bool is_secure { false };
+    HTTP::Cookie::Source source { HTTP::Cookie::Source::Http };
+};
+
 class WEBVIEW_API CookieJar {
 public:
     static ErrorOr<NonnullOwnPtr<CookieJar>> create(Database::Database&);
@@ -56,15 +66,23 @@ private:
         Database::StatementID select_all_cookies { 0 };
     };
 
+    // Cookies are kept in buckets by their domain. Only cookies whose domain is a host or one of its parent domains can
+    // match a URL with that host, so looking up the cookies for a URL only has to look at the buckets of those domains.
+    // The Cookie headers that were serialized for a URL are cached as well, until a cookie on a matching domain changes.
     class WEBVIEW_API TransientStorage {
     public:
         using Cookies = HashMap<CookieStorageKey, HTTP::Cookie::Cookie>;
 
+        struct CachedCookieHeader {
+            String header;
+            Vector<CookieStorageKey> cookies;
+        };
+
         void set_cookies(Cookies);
         void set_cookie(CookieStorageKey, HTTP::Cookie::Cookie);
         Optional<HTTP::Cookie::Cookie const&> get_cookie(CookieStorageKey const&);
 
-        size_t size() const { return m_cookies.size(); }
+        size_t size() const { return m_size; }
 
         UnixDateTime purge_expired_cookies(Optional<AK::Duration> offset = {});
         void expire_and_purge_cookies_accessed_since(UnixDateTime since);
@@ -73,28 +91,69 @@ private:
 
         auto take_dirty_cookies() { return move(m_dirty_cookies); }
 
+        // Returns the cached Cookie header, and updates the last-access-time of the cookies in it.
+        Optional<String> get_cookie_header(CookieHeaderCacheKey const&, UnixDateTime now);
+        void set_cookie_header(CookieHeaderCacheKey, CachedCookieHeader);
+
         template<typename Callback>
         void for_each_cookie(Callback callback)
+        {
+            for (auto& it : m_cookies_by_domain) {
+                if (for_each_cookie_in_bucket(it.value, callback) == IterationDecision::Break)
+                    return;
+            }
+        }
+
+        template<typename Callback>
+        void for_each_cookie_for_host(StringView host, Callback callback)
+        {
+            for (auto domain = host;;) {
+                if (auto it = m_cookies_by_domain.find(domain); it != m_cookies_by_domain.end()) {
+                    if (for_each_cookie_in_bucket(it->value, callback) == IterationDecision::Break)
+                        return;
+                }
+
+                auto dot = domain.find('.');
+                if (!dot.has_value())
+                    return;
+                domain = domain.substring_view(*dot + 1);
+            }
+        }
+
+    private:
+        using CookieEntry = decltype(declval<Cookies>().take_all_matching(nullptr))::ValueType;
+        static void send_cookie_changed_notifications(ReadonlySpan<CookieEntry>, bool inform_web_view_about_changed_domains = true);
+
+        template<typename Callback>
+        static IterationDecision for_each_cookie_in_bucket(Cookies& bucket, Callback& callback)
         {
             using ReturnType = InvokeResult<Callback, HTTP::Cookie::Cookie&>;
 
-            for (auto& it : m_cookies) {
+            for (auto& it : bucket) {
                 if constexpr (IsSame<ReturnType, IterationDecision>) {
                     if (callback(it.value) == IterationDecision::Break)
-                        return;
+                        return IterationDecision::Break;
                 } else {
                     static_assert(IsSame<ReturnType, void>);
                     callback(it.value);
                 }
             }
+
+            return IterationDecision::Continue;
         }
 
-    private:
-        using CookieEntry = decltype(declval<Cookies>().take_all_matching(nullptr))::ValueType;
-        static void send_cookie_changed_notifications(ReadonlySpan<CookieEntry>, bool inform_web_view_about_changed_domains = true);
+        void invalidate_cookie_headers_for_domain(StringView domain);
 
-        Cookies m_cookies;
+        static constexpr size_t MAXIMUM_CACHED_COOKIE_HEADERS = 256;
+
+        HashMap<String, Cookies> m_cookies_by_domain;
+        size_t m_size { 0 };
         Cookies m_dirty_cookies;
+
+        // NB: No cookie expires before this time, so we don't have to look for expired cookies until then.
+        UnixDateTime m_next_expiry_time { UnixDateTime::latest() };
+
+        HashMap<CookieHeaderCacheKey, CachedCookieHeader> m_cookie_headers;
     };
 
     struct WEBVIEW_API PersistedStorage {
@@ -135,3 +194,16 @@ struct AK::Traits<WebView::CookieStorageKey> : public AK::DefaultTraits<WebView:
         return hash;
     }
 };
+
+template<>
+struct AK::Traits<WebView::CookieHeaderCacheKey> : public AK::DefaultTraits<WebView::CookieHeaderCacheKey> {
+    static unsigned hash(WebView::CookieHeaderCacheKey const& key)
+    {
+        unsigned hash = 0;
+        hash = pair_int_hash(hash, key.host.hash());
+        hash = pair_int_hash(hash, key.path.hash());
+        hash = pair_int_hash(hash, key.is_secure);
+        hash = pair_int_hash(hash, to_underlying(key.source));
+        return hash;
+    }
+};
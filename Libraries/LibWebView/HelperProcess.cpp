@@ -121,6 +121,24 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
         arguments.append("--force-fontconfig"sv);
     if (web_content_options.collect_garbage_on_every_allocation == WebView::CollectGarbageOnEveryAllocation::Yes)
         arguments.append("--collect-garbage-on-every-allocation"sv);
+    if (web_content_options.collect_inline_cache_statistics == WebView::CollectInlineCacheStatistics::Yes)
+        arguments.append("--collect-inline-cache-statistics"sv);
+    if (auto value = web_content_options.gc_heap_sizing.minimum_threshold_mib; value.has_value()) {
+        arguments.append("--gc-min-threshold"sv);
+        arguments.append(ByteString::number(*value));
+    }
+    if (auto value = web_content_options.gc_heap_sizing.maximum_threshold_mib; value.has_value()) {
+        arguments.append("--gc-max-threshold"sv);
+        arguments.append(ByteString::number(*value));
+    }
+    if (auto value = web_content_options.gc_heap_sizing.live_bytes_growth_factor; value.has_value()) {
+        arguments.append("--gc-growth-factor"sv);
+        arguments.append(ByteString::number(*value));
+    }
+    if (auto value = web_content_options.gc_heap_sizing.target_overhead_percent; value.has_value()) {
+        arguments.append("--gc-target-overhead"sv);
+        arguments.append(ByteString::number(*value));
+    }
     if (web_content_options.paint_viewport_scrollbars == PaintViewportScrollbars::No)
         arguments.append("--disable-scrollbar-painting"sv);
 
@@ -230,6 +248,20 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
         break;
     }
 
+    arguments.append("--http3-mode"sv);
+
+    switch (request_server_options.http3_mode) {
+    case HTTP3Mode::Disabled:
+        arguments.append("disabled"sv);
+        break;
+    case HTTP3Mode::AltSvc:
+        arguments.append("alt-svc"sv);
+        break;
+    case HTTP3Mode::Enabled:
+        arguments.append("enabled"sv);
+        break;
+    }
+
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
@@ -87,6 +87,10 @@ enum class ActionID {
     DumpCookies,
     DumpLocalStorage,
     DumpGCGraph,
+    DumpGCCellStatistics,
+    DumpInlineCacheStatistics,
+    DumpLazyCompilationStatistics,
+    RecordPerformanceTrace,
     ShowLineBoxBorders,
     CollectGarbage,
     SpoofUserAgent,
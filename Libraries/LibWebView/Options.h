@@ -91,6 +91,19 @@ struct BrowserOptions {
     Optional<DNSSettings> dns_settings {};
     Optional<u16> devtools_port;
     EnableContentFilter enable_content_filter { EnableContentFilter::Yes };
+
+    // The number of helper processes that are launched ahead of time, so that new tabs and workers do not have to wait
+    // for a process to start up. Spare WebWorker processes are kept for each type of worker.
+    size_t spare_web_content_process_count { 1 };
+    size_t spare_web_worker_process_count { 0 };
+
+    // The amount of memory that all of our processes may use together before they are asked to release memory. If this
+    // is not set, the limit imposed by the system is used, if any.
+    Optional<u64> memory_limit_in_bytes {};
+
+    // The amount of memory that WebContent processes may use together before new pages share a process with other pages
+    // of their site, rather than each getting a process of their own. If this is not set, pages never share processes.
+    Optional<u64> web_content_memory_budget_in_bytes {};
 };
 
 enum class HTTPDiskCacheMode {
@@ -100,9 +113,21 @@ enum class HTTPDiskCacheMode {
     Testing,
 };
 
+enum class HTTP3Mode {
+    // Never use HTTP/3.
+    Disabled,
+
+    // Use HTTP/3 with servers that have advertised it with an Alt-Svc response header.
+    AltSvc,
+
+    // Also attempt HTTP/3 with servers that have not advertised it, racing the attempt against HTTP/2.
+    Enabled,
+};
+
 struct RequestServerOptions {
     Vector<ByteString> certificates;
     HTTPDiskCacheMode http_disk_cache_mode { HTTPDiskCacheMode::Disabled };
+    HTTP3Mode http3_mode { HTTP3Mode::AltSvc };
     Optional<ByteString> resource_substitution_map_path;
 };
 
@@ -156,11 +181,24 @@ enum class CollectGarbageOnEveryAllocation {
     Yes,
 };
 
+enum class CollectInlineCacheStatistics {
+    No,
+    Yes,
+};
+
 enum class PaintViewportScrollbars {
     Yes,
     No,
 };
 
+// Knobs for the JS heap's GC::HeapSizingPolicy. Unset values keep the heap's defaults.
+struct GCHeapSizingOptions {
+    Optional<size_t> minimum_threshold_mib {};
+    Optional<size_t> maximum_threshold_mib {};
+    Optional<double> live_bytes_growth_factor {};
+    Optional<double> target_overhead_percent {};
+};
+
 struct WebContentOptions {
     String command_line;
     String executable_path;
@@ -177,6 +215,8 @@ struct WebContentOptions {
     ForceFontconfig force_fontconfig { ForceFontconfig::No };
     EnableAutoplay enable_autoplay { EnableAutoplay::No };
     CollectGarbageOnEveryAllocation collect_garbage_on_every_allocation { CollectGarbageOnEveryAllocation::No };
+    CollectInlineCacheStatistics collect_inline_cache_statistics { CollectInlineCacheStatistics::No };
+    GCHeapSizingOptions gc_heap_sizing {};
     Optional<u16> echo_server_port {};
     PaintViewportScrollbars paint_viewport_scrollbars { PaintViewportScrollbars::Yes };
     Optional<StringView> default_time_zone {};
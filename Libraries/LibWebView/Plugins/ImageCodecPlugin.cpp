@@ -42,7 +42,24 @@ void ImageCodecPlugin::setup_client_callbacks()
 
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
-NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+static Web::Platform::DecodedImage to_platform_decoded_image(ImageDecoderClient::DecodedImage& result)
+{
+    // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
+    Web::Platform::DecodedImage decoded_image;
+    decoded_image.is_animated = result.is_animated;
+    decoded_image.loop_count = result.loop_count;
+    decoded_image.frame_count = result.frame_count;
+    decoded_image.session_id = result.session_id;
+    decoded_image.all_durations = move(result.all_durations);
+    for (auto& frame : result.frames) {
+        decoded_image.frames.empend(move(frame.bitmap), frame.duration);
+    }
+    decoded_image.color_space = move(result.color_space);
+    decoded_image.yuv_data = move(result.yuv_data);
+    return decoded_image;
+}
+
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, ImageDecoder::DecodePriority priority, bool allow_yuv)
 {
     auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
     if (on_resolved)
@@ -58,27 +75,85 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
     auto image_decoder_promise = m_client->decode_image(
         bytes,
         [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
-            // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
-            Web::Platform::DecodedImage decoded_image;
-            decoded_image.is_animated = result.is_animated;
-            decoded_image.loop_count = result.loop_count;
-            decoded_image.frame_count = result.frame_count;
-            decoded_image.session_id = result.session_id;
-            decoded_image.all_durations = move(result.all_durations);
-            for (auto& frame : result.frames) {
-                decoded_image.frames.empend(move(frame.bitmap), frame.duration);
-            }
-            decoded_image.color_space = move(result.color_space);
-            promise->resolve(move(decoded_image));
+            promise->resolve(to_platform_decoded_image(result));
             return {};
         },
         [promise](auto& error) {
             promise->reject(Error::copy(error));
-        });
+        },
+        {}, {}, priority, allow_yuv);
 
     return promise;
 }
 
+Optional<i64> ImageCodecPlugin::begin_streaming_decode(Function<void(Web::Platform::DecodedImage&)> on_partial_image, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, ImageDecoder::DecodePriority priority, bool allow_yuv)
+{
+    if (!m_client) {
+        auto error = Error::from_string_literal("ImageDecoderClient is disconnected");
+        if (on_rejected)
+            on_rejected(error);
+        return {};
+    }
+
+    auto request_id = m_client->begin_streaming_decode(
+        [on_partial_image = move(on_partial_image)](ImageDecoderClient::DecodedImage& result) {
+            if (!on_partial_image)
+                return;
+            auto decoded_image = to_platform_decoded_image(result);
+            on_partial_image(decoded_image);
+        },
+        [on_resolved = move(on_resolved)](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+            if (!on_resolved)
+                return {};
+            auto decoded_image = to_platform_decoded_image(result);
+            return on_resolved(decoded_image);
+        },
+        [on_rejected = move(on_rejected)](auto& error) {
+            if (on_rejected)
+                on_rejected(error);
+        },
+        {}, priority, allow_yuv);
+
+    auto stream_id = m_next_stream_id++;
+    m_streaming_decodes.set(stream_id, { *m_client, request_id });
+    return stream_id;
+}
+
+Optional<ImageCodecPlugin::StreamingDecode&> ImageCodecPlugin::streaming_decode_on_current_client(i64 stream_id)
+{
+    auto streaming_decode = m_streaming_decodes.get(stream_id);
+    if (!streaming_decode.has_value())
+        return {};
+
+    // The promise of a stream on a client that has died has already been rejected.
+    if (streaming_decode->client.ptr() != m_client.ptr()) {
+        m_streaming_decodes.remove(stream_id);
+        return {};
+    }
+
+    return streaming_decode;
+}
+
+void ImageCodecPlugin::append_streaming_decode_data(i64 stream_id, ReadonlyBytes bytes)
+{
+    if (auto streaming_decode = streaming_decode_on_current_client(stream_id); streaming_decode.has_value())
+        m_client->append_streaming_decode_data(streaming_decode->request_id, bytes);
+}
+
+void ImageCodecPlugin::finish_streaming_decode(i64 stream_id)
+{
+    if (auto streaming_decode = streaming_decode_on_current_client(stream_id); streaming_decode.has_value())
+        m_client->finish_streaming_decode(streaming_decode->request_id);
+    m_streaming_decodes.remove(stream_id);
+}
+
+void ImageCodecPlugin::cancel_streaming_decode(i64 stream_id)
+{
+    if (auto streaming_decode = streaming_decode_on_current_client(stream_id); streaming_decode.has_value())
+        m_client->cancel_decoding(streaming_decode->request_id);
+    m_streaming_decodes.remove(stream_id);
+}
+
 void ImageCodecPlugin::request_animation_frames(i64 session_id, u32 start_frame_index, u32 count)
 {
     if (m_client)
@@ -18,7 +18,12 @@ public:
     explicit ImageCodecPlugin(NonnullRefPtr<ImageDecoderClient::Client>);
     virtual ~ImageCodecPlugin() override;
 
-    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected) override;
+    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, ImageDecoder::DecodePriority = ImageDecoder::DecodePriority::Normal, bool allow_yuv = false) override;
+
+    virtual Optional<i64> begin_streaming_decode(Function<void(Web::Platform::DecodedImage&)> on_partial_image, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, ImageDecoder::DecodePriority, bool allow_yuv) override;
+    virtual void append_streaming_decode_data(i64 stream_id, ReadonlyBytes) override;
+    virtual void finish_streaming_decode(i64 stream_id) override;
+    virtual void cancel_streaming_decode(i64 stream_id) override;
 
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) override;
     virtual void stop_animation_decode(i64 session_id) override;
@@ -29,6 +34,16 @@ private:
     void setup_client_callbacks();
 
     RefPtr<ImageDecoderClient::Client> m_client;
+
+    // NB: Streams remember the client they were started on, as the client is replaced if the ImageDecoder process dies.
+    struct StreamingDecode {
+        NonnullRefPtr<ImageDecoderClient::Client> client;
+        i64 request_id { 0 };
+    };
+    Optional<StreamingDecode&> streaming_decode_on_current_client(i64 stream_id);
+
+    HashMap<i64, StreamingDecode> m_streaming_decodes;
+    i64 m_next_stream_id { 1 };
 };
 
 }
@@ -8,11 +8,22 @@
 #include <AK/JsonObject.h>
 #include <AK/String.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
 #include <LibCore/System.h>
+#include <LibCore/Timer.h>
 #include <LibWebView/ProcessManager.h>
 
 namespace WebView {
 
+static constexpr int MEMORY_PRESSURE_CHECK_INTERVAL_MS = 2'000;
+
+// Purging caches takes a while to have an effect on the memory usage we sample, and leaves processes slower until they
+// have repopulated their caches. So we only signal the same level of pressure again once this much time has passed.
+static constexpr auto MEMORY_PRESSURE_SIGNAL_COOLDOWN = AK::Duration::from_seconds(30);
+
+static constexpr u64 MODERATE_MEMORY_PRESSURE_PERCENT = 75;
+static constexpr u64 CRITICAL_MEMORY_PRESSURE_PERCENT = 90;
+
 ProcessType process_type_from_name(StringView name)
 {
     if (name == "Browser"sv)
@@ -129,6 +140,53 @@ void ProcessManager::update_all_process_statistics()
 {
     Threading::MutexLocker locker { m_lock };
     (void)update_process_statistics(m_statistics);
+    update_web_content_process_statistics();
+}
+
+void ProcessManager::update_web_content_process_statistics()
+{
+    m_web_content_process_statistics.process_count = 0;
+    m_web_content_process_statistics.memory_usage_in_bytes = 0;
+
+    m_statistics.for_each_process([&](auto const& process) {
+        if (auto process_handle = find_process(process.pid); process_handle.has_value() && process_handle->type() == ProcessType::WebContent) {
+            ++m_web_content_process_statistics.process_count;
+            m_web_content_process_statistics.memory_usage_in_bytes += process.memory_usage_bytes;
+        }
+    });
+}
+
+void ProcessManager::did_allocate_web_content_process(WebContentProcessAllocation allocation)
+{
+    Threading::MutexLocker locker { m_lock };
+
+    switch (allocation) {
+    case WebContentProcessAllocation::NewProcess:
+        ++m_web_content_process_statistics.pages_in_new_processes;
+        break;
+    case WebContentProcessAllocation::PrewarmedProcess:
+        ++m_web_content_process_statistics.pages_in_prewarmed_processes;
+        break;
+    case WebContentProcessAllocation::SharedProcess:
+        ++m_web_content_process_statistics.pages_in_shared_processes;
+        break;
+    }
+}
+
+WebContentProcessStatistics ProcessManager::web_content_process_statistics()
+{
+    Threading::MutexLocker locker { m_lock };
+    return m_web_content_process_statistics;
+}
+
+Optional<u64> ProcessManager::memory_usage_of_process(pid_t pid)
+{
+    Threading::MutexLocker locker { m_lock };
+    for (auto const& info : m_statistics.processes) {
+        if (info->pid == pid)
+            return info->memory_usage_bytes;
+    }
+    return {};
 }
 
 JsonValue ProcessManager::serialize_json()
@@ -157,4 +215,81 @@ JsonValue ProcessManager::serialize_json()
     return serialized;
 }
 
+Optional<u64> ProcessManager::system_memory_limit()
+{
+#if defined(AK_OS_LINUX)
+    // Try the unified cgroup v2 hierarchy first, then fall back to the memory controller of cgroup v1.
+    for (auto path : { "/sys/fs/cgroup/memory.max"sv, "/sys/fs/cgroup/memory/memory.limit_in_bytes"sv }) {
+        auto file = Core::File::open(path, Core::File::OpenMode::Read);
+        if (file.is_error())
+            continue;
+
+        auto contents = file.value()->read_until_eof();
+        if (contents.is_error())
+            continue;
+
+        auto limit = StringView { contents.value() }.trim_whitespace();
+        if (limit == "max"sv)
+            return {};
+
+        // NB: cgroup v1 reports an unlimited cgroup as a huge number that is rounded down to the page size.
+        if (auto value = limit.to_number<u64>(); value.has_value() && *value < NumericLimits<i64>::max() / 2)
+            return *value;
+        return {};
+    }
+#endif
+
+    return {};
+}
+
+void ProcessManager::start_monitoring_memory_pressure(u64 memory_limit_in_bytes)
+{
+    m_memory_limit_in_bytes = memory_limit_in_bytes;
+
+    m_memory_pressure_timer = Core::Timer::create_repeating(MEMORY_PRESSURE_CHECK_INTERVAL_MS, [this]() {
+        check_memory_pressure();
+    });
+    m_memory_pressure_timer->start();
+}
+
+void ProcessManager::check_memory_pressure()
+{
+    u64 memory_usage_in_bytes = 0;
+
+    {
+        Threading::MutexLocker locker { m_lock };
+        (void)update_process_statistics(m_statistics);
+        update_web_content_process_statistics();
+
+        m_statistics.for_each_process([&](auto const& process) {
+            memory_usage_in_bytes += process.memory_usage_bytes;
+        });
+    }
+
+    Optional<Core::MemoryPressureLevel> level;
+    if (memory_usage_in_bytes >= m_memory_limit_in_bytes / 100 * CRITICAL_MEMORY_PRESSURE_PERCENT)
+        level = Core::MemoryPressureLevel::Critical;
+    else if (memory_usage_in_bytes >= m_memory_limit_in_bytes / 100 * MODERATE_MEMORY_PRESSURE_PERCENT)
+        level = Core::MemoryPressureLevel::Moderate;
+
+    if (!level.has_value()) {
+        m_memory_pressure_level.clear();
+        return;
+    }
+
+    auto now = MonotonicTime::now_coarse();
+
+    // Rising pressure is always signaled right away, whereas ongoing pressure is only signaled again after a while.
+    if (m_memory_pressure_level.has_value() && *level <= *m_memory_pressure_level && now - m_last_memory_pressure_signal_time < MEMORY_PRESSURE_SIGNAL_COOLDOWN)
+        return;
+
+    m_memory_pressure_level = level;
+    m_last_memory_pressure_signal_time = now;
+
+    dbgln("Memory usage of {} MiB is close to the limit of {} MiB", memory_usage_in_bytes / MiB, m_memory_limit_in_bytes / MiB);
+
+    if (on_memory_pressure)
+        on_memory_pressure(*level);
+}
+
 }
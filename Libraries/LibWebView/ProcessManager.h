@@ -7,7 +7,10 @@
 #pragma once
 
 #include <AK/JsonValue.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
+#include <LibCore/Forward.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Platform/ProcessStatistics.h>
 #include <LibThreading/Mutex.h>
 #include <LibWebView/Forward.h>
@@ -19,6 +22,26 @@ namespace WebView {
 WEBVIEW_API ProcessType process_type_from_name(StringView);
 WEBVIEW_API StringView process_name_from_type(ProcessType type);
 
+enum class WebContentProcessAllocation {
+    // The page was given a process of its own, i.e. a spare process or a newly launched one.
+    NewProcess,
+
+    // The page was given the process that was pre-warmed for its site.
+    PrewarmedProcess,
+
+    // The page shares a process with other pages of its site, as WebContent processes have used up their memory budget.
+    SharedProcess,
+};
+
+struct WebContentProcessStatistics {
+    size_t process_count { 0 };
+    u64 memory_usage_in_bytes { 0 };
+
+    u64 pages_in_new_processes { 0 };
+    u64 pages_in_prewarmed_processes { 0 };
+    u64 pages_in_shared_processes { 0 };
+};
+
 class WEBVIEW_API ProcessManager {
     AK_MAKE_NONCOPYABLE(ProcessManager);
 
@@ -30,6 +53,14 @@ public:
     Optional<Process> remove_process(pid_t);
     Optional<Process&> find_process(pid_t);
 
+    template<typename Callback>
+    void for_each_process(Callback callback)
+    {
+        Threading::MutexLocker locker { m_lock };
+        for (auto& [pid, process] : m_processes)
+            callback(process);
+    }
+
 #if defined(AK_OS_MACH)
     void set_process_mach_port(pid_t, Core::MachPort&&);
 #endif
@@ -37,13 +68,40 @@ public:
     void update_all_process_statistics();
     JsonValue serialize_json();
 
+    void did_allocate_web_content_process(WebContentProcessAllocation);
+
+    // Returns how many WebContent processes there are and how much memory they use as of the last time the statistics
+    // were updated, along with how the processes of pages were allocated.
+    WebContentProcessStatistics web_content_process_statistics();
+
+    // Returns the memory usage of the given process as of the last time the statistics were updated.
+    Optional<u64> memory_usage_of_process(pid_t);
+
+    // Returns the amount of memory this process and its children may use, if it is limited by the system (e.g. through
+    // the memory controller of the cgroup we are running in).
+    static Optional<u64> system_memory_limit();
+
+    // Periodically samples the memory usage of all processes, and invokes on_memory_pressure whenever their combined
+    // usage gets close to the given limit.
+    void start_monitoring_memory_pressure(u64 memory_limit_in_bytes);
+
     Function<void(Process&&)> on_process_exited;
+    Function<void(Core::MemoryPressureLevel)> on_memory_pressure;
 
 private:
+    void check_memory_pressure();
+    void update_web_content_process_statistics();
+
     Core::Platform::ProcessStatistics m_statistics;
+    WebContentProcessStatistics m_web_content_process_statistics;
     HashMap<pid_t, Process> m_processes;
     [[maybe_unused]] int m_signal_handle { -1 };
     Threading::Mutex m_lock;
+
+    u64 m_memory_limit_in_bytes { 0 };
+    RefPtr<Core::Timer> m_memory_pressure_timer;
+    Optional<Core::MemoryPressureLevel> m_memory_pressure_level;
+    MonotonicTime m_last_memory_pressure_signal_time { MonotonicTime::now_coarse() };
 };
 
 }
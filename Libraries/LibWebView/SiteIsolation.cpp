@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibURL/Site.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Fetch/Infrastructure/URL.h>
 #include <LibWeb/HTML/BrowsingContext.h>
@@ -42,4 +43,14 @@ bool is_url_suitable_for_same_process_navigation(URL::URL const& current_url, UR
     return current_url.origin().is_same_site(target_url.origin());
 }
 
+Optional<String> site_for_process_consolidation(URL::URL const& url)
+{
+    // Only HTTP(S) pages are grouped by their site. Other pages (e.g. about: and file: pages) always get a process of
+    // their own.
+    if (!Web::Fetch::Infrastructure::is_http_or_https_scheme(url.scheme()))
+        return {};
+
+    return URL::Site::obtain(url.origin()).serialize();
+}
+
 }
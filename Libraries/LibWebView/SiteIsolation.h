@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/Optional.h>
+#include <AK/String.h>
 #include <LibURL/Forward.h>
 #include <LibWebView/Forward.h>
 
@@ -14,4 +16,8 @@ namespace WebView {
 WEBVIEW_API void disable_site_isolation();
 [[nodiscard]] WEBVIEW_API bool is_url_suitable_for_same_process_navigation(URL::URL const& current_url, URL::URL const& target_url);
 
+// Returns the site that pages showing the given URL are grouped by when they share a WebContent process with other pages,
+// if such pages may share a process at all.
+[[nodiscard]] WEBVIEW_API Optional<String> site_for_process_consolidation(URL::URL const&);
+
 }
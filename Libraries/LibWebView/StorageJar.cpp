@@ -59,8 +59,9 @@ ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database::Database& databa
     statements.delete_item = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
     statements.delete_items_accessed_since = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE last_access_time >= ?;"sv));
     statements.update_last_access_time = TRY(database.prepare_statement("UPDATE WebStorage SET last_access_time = ? WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
+    statements.update_last_access_time_of_all_items = TRY(database.prepare_statement("UPDATE WebStorage SET last_access_time = ? WHERE storage_endpoint = ? AND storage_key = ?;"sv));
     statements.clear = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.get_keys = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
+    statements.get_items = TRY(database.prepare_statement("SELECT bottle_key, bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
     statements.calculate_size_excluding_key = TRY(database.prepare_statement("SELECT SUM(OCTET_LENGTH(bottle_key) + OCTET_LENGTH(bottle_value)) FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key != ?;"sv));
     statements.estimate_storage_size_accessed_since = TRY(database.prepare_statement("SELECT SUM(OCTET_LENGTH(storage_key)) + SUM(OCTET_LENGTH(bottle_key)) + SUM(OCTET_LENGTH(bottle_value)) FROM WebStorage WHERE last_access_time >= ?;"sv));
 
@@ -142,11 +143,11 @@ void StorageJar::clear_storage_key(StorageEndpointType storage_endpoint, String
         m_transient_storage.clear(storage_endpoint, storage_key);
 }
 
-Vector<String> StorageJar::get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key)
+OrderedHashMap<String, String> StorageJar::get_all_items(StorageEndpointType storage_endpoint, String const& storage_key)
 {
     if (m_persisted_storage.has_value())
-        return m_persisted_storage->get_keys(storage_endpoint, storage_key);
-    return m_transient_storage.get_keys(storage_endpoint, storage_key);
+        return m_persisted_storage->get_items(storage_endpoint, storage_key);
+    return m_transient_storage.get_items(storage_endpoint, storage_key);
 }
 
 Requests::CacheSizes StorageJar::estimate_storage_size_accessed_since(UnixDateTime since) const
@@ -211,16 +212,19 @@ void StorageJar::TransientStorage::clear(StorageEndpointType storage_endpoint, S
         m_storage_items.remove(key);
 }
 
-Vector<String> StorageJar::TransientStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
+OrderedHashMap<String, String> StorageJar::TransientStorage::get_items(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    Vector<String> keys;
+    OrderedHashMap<String, String> items;
+    auto now = UnixDateTime::now();
 
-    for (auto const& [key, value] : m_storage_items) {
-        if (key.storage_endpoint == storage_endpoint && key.storage_key == storage_key)
-            keys.append(key.bottle_key);
+    for (auto& [key, entry] : m_storage_items) {
+        if (key.storage_endpoint == storage_endpoint && key.storage_key == storage_key) {
+            entry.last_access_time = now;
+            items.set(key.bottle_key, entry.value);
+        }
     }
 
-    return keys;
+    return items;
 }
 
 Requests::CacheSizes StorageJar::TransientStorage::estimate_storage_size_accessed_since(UnixDateTime since) const
@@ -266,6 +270,9 @@ Optional<String> StorageJar::PersistedStorage::get_item(StorageLocation const& k
 
 StorageSetResult StorageJar::PersistedStorage::set_item(StorageLocation const& key, String const& value)
 {
+    // NB: Setting an item takes a few statements, which are committed together rather than one by one.
+    auto transaction = database.begin_transaction();
+
     auto old_value = get_item(key);
 
     size_t current_size = 0;
@@ -318,19 +325,29 @@ void StorageJar::PersistedStorage::clear(StorageEndpointType storage_endpoint, S
         storage_key);
 }
 
-Vector<String> StorageJar::PersistedStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
+OrderedHashMap<String, String> StorageJar::PersistedStorage::get_items(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    Vector<String> keys;
+    OrderedHashMap<String, String> items;
 
     database.execute_statement(
-        statements.get_keys,
+        statements.get_items,
         [&](auto statement_id) {
-            keys.append(database.result_column<String>(statement_id, 0));
+            items.set(database.result_column<String>(statement_id, 0), database.result_column<String>(statement_id, 1));
         },
         to_underlying(storage_endpoint),
         storage_key);
 
-    return keys;
+    // NB: The items are read for a snapshot that all further reads are served from, so they all count as accessed now.
+    if (!items.is_empty()) {
+        database.execute_statement(
+            statements.update_last_access_time_of_all_items,
+            {},
+            UnixDateTime::now(),
+            to_underlying(storage_endpoint),
+            storage_key);
+    }
+
+    return items;
 }
 
 Requests::CacheSizes StorageJar::PersistedStorage::estimate_storage_size_accessed_since(UnixDateTime since) const
@@ -13,6 +13,7 @@
 #include <LibGfx/ImageFormats/PNGWriter.h>
 #include <LibURL/Parser.h>
 #include <LibWeb/Crypto/Crypto.h>
+#include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWebView/Application.h>
 #include <LibWebView/BookmarkStore.h>
@@ -124,12 +125,28 @@ void ViewImplementation::set_favicon(Badge<WebContentClient>, Gfx::Bitmap const&
 
 void ViewImplementation::create_new_process_for_cross_site_navigation(URL::URL const& url)
 {
-    if (m_client_state.client) {
+    // NB: The URL is set ahead of loading it, so that a process that was pre-warmed for its site may be picked.
+    set_url(url);
+    switch_web_content_process(Application::the().find_web_content_process_to_share(url));
+
+    load(url);
+}
+
+void ViewImplementation::switch_web_content_process(RefPtr<WebContentClient> process_to_share)
+{
+    if (m_client_state.client)
         m_client_state.client->unregister_view(m_client_state.page_index);
-        client().async_close_server();
+
+    if (process_to_share) {
+        m_client_state = {};
+        m_client_state.client = process_to_share;
+        m_client_state.page_index = process_to_share->create_page();
+
+        initialize_client(CreateNewClient::No);
+    } else {
+        initialize_client();
     }
 
-    initialize_client();
     VERIFY(m_client_state.client);
 
     if (on_web_content_process_change_for_cross_site_navigation)
@@ -138,8 +155,6 @@ void ViewImplementation::create_new_process_for_cross_site_navigation(URL::URL c
     // Don't keep a stale backup bitmap around.
     m_backup_bitmap = nullptr;
     handle_resize();
-
-    load(url);
 }
 
 void ViewImplementation::server_did_paint(Badge<WebContentClient>, i32 bitmap_id, Gfx::IntSize size)
@@ -179,6 +194,13 @@ void ViewImplementation::set_system_visibility_state(Web::HTML::VisibilityState
 
 void ViewImplementation::load(URL::URL const& url)
 {
+    // A view that has not shown a page yet may move to a process that already shows pages of the URL's site, rather
+    // than keep the process that was launched for it.
+    if (m_client_state.client && m_client_state.client->view_count() == 1 && (m_url.scheme().is_empty() || Web::HTML::url_matches_about_blank(m_url))) {
+        if (auto process_to_share = Application::the().find_web_content_process_to_share(url); process_to_share && process_to_share != m_client_state.client)
+            switch_web_content_process(move(process_to_share));
+    }
+
     set_url(url);
     client().async_load_url(page_id(), url);
 }
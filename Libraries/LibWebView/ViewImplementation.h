@@ -303,6 +303,9 @@ protected:
     };
     void handle_web_content_process_crash(LoadErrorPage = LoadErrorPage::Yes);
 
+    // Moves the view to a new page in the given process, or to a process of its own if no process is given.
+    void switch_web_content_process(RefPtr<WebContentClient> process_to_share);
+
     virtual void default_zoom_level_factor_changed() override;
     virtual void languages_changed() override;
     virtual void autoplay_settings_changed() override;
@@ -9,6 +9,7 @@
 #include <LibWebView/Application.h>
 #include <LibWebView/CookieJar.h>
 #include <LibWebView/HelperProcess.h>
+#include <LibWebView/SiteIsolation.h>
 #include <LibWebView/SourceHighlighter.h>
 #include <LibWebView/ViewImplementation.h>
 #include <LibWebView/WebContentClient.h>
@@ -56,8 +57,25 @@ void WebContentClient::register_view(u64 page_id, ViewImplementation& view)
 void WebContentClient::unregister_view(u64 page_id)
 {
     m_views.remove(page_id);
+
+    // NB: Other pages may be sharing this process, in which case only the page of the view is closed.
     if (m_views.is_empty())
         async_close_server();
+    else
+        async_close_page(page_id);
+}
+
+bool WebContentClient::is_showing_only_pages_of_site(StringView site) const
+{
+    if (m_views.is_empty())
+        return false;
+
+    for (auto const& [page_id, view] : m_views) {
+        if (site_for_process_consolidation(view->url()) != site)
+            return false;
+    }
+
+    return true;
 }
 
 void WebContentClient::web_ui_disconnected(Badge<WebUI>)
@@ -568,6 +586,12 @@ void WebContentClient::did_set_cookie(URL::URL url, HTTP::Cookie::ParsedCookie c
     Application::cookie_jar().set_cookie(url, cookie, source);
 }
 
+void WebContentClient::did_set_cookies(URL::URL url, Vector<HTTP::Cookie::ParsedCookie> cookies, HTTP::Cookie::Source source)
+{
+    for (auto const& cookie : cookies)
+        Application::cookie_jar().set_cookie(url, cookie, source);
+}
+
 void WebContentClient::did_update_cookie(HTTP::Cookie::Cookie cookie)
 {
     Application::cookie_jar().update_cookie(cookie);
@@ -578,29 +602,45 @@ void WebContentClient::did_expire_cookies_with_time_offset(AK::Duration offset)
     Application::cookie_jar().expire_cookies_with_time_offset(offset);
 }
 
-Messages::WebContentClient::DidRequestStorageItemResponse WebContentClient::did_request_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key)
+// WebContent processes keep a snapshot of the storage they use, so they have to be told when another process changes it.
+static void notify_other_clients_of_storage_change(WebContentClient& source, Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    return Application::storage_jar().get_item(storage_endpoint, storage_key, bottle_key);
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        if (&client != &source)
+            client.async_storage_changed(storage_endpoint, storage_key);
+        return IterationDecision::Continue;
+    });
 }
 
-Messages::WebContentClient::DidSetStorageItemResponse WebContentClient::did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key, String value)
+Messages::WebContentClient::DidRequestStorageItemsResponse WebContentClient::did_request_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
 {
-    return Application::storage_jar().set_item(storage_endpoint, storage_key, bottle_key, value);
+    return Application::storage_jar().get_all_items(storage_endpoint, storage_key);
 }
 
-void WebContentClient::did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key)
+void WebContentClient::did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key, String value)
 {
-    Application::storage_jar().remove_item(storage_endpoint, storage_key, bottle_key);
+    auto result = Application::storage_jar().set_item(storage_endpoint, storage_key, bottle_key, value);
+
+    // NB: The WebContent process checks the quota against its snapshot before writing, but another process may have
+    //     written to the same storage in the meantime. Its snapshot is out of date then, so it has to drop it too.
+    if (result.has<WebView::StorageOperationError>()) {
+        async_storage_changed(storage_endpoint, storage_key);
+        return;
+    }
+
+    notify_other_clients_of_storage_change(*this, storage_endpoint, storage_key);
 }
 
-Messages::WebContentClient::DidRequestStorageKeysResponse WebContentClient::did_request_storage_keys(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
+void WebContentClient::did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key)
 {
-    return Application::storage_jar().get_all_keys(storage_endpoint, storage_key);
+    Application::storage_jar().remove_item(storage_endpoint, storage_key, bottle_key);
+    notify_other_clients_of_storage_change(*this, storage_endpoint, storage_key);
 }
 
 void WebContentClient::did_clear_storage(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
 {
     Application::storage_jar().clear_storage_key(storage_endpoint, storage_key);
+    notify_other_clients_of_storage_change(*this, storage_endpoint, storage_key);
 }
 
 Messages::WebContentClient::DidRequestNewWebViewResponse WebContentClient::did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab activate_tab, Web::HTML::WebViewHints hints, Optional<u64> page_index)
@@ -623,9 +663,11 @@ void WebContentClient::did_request_activate_tab(u64 page_id)
 
 void WebContentClient::did_close_browsing_context(u64 page_id)
 {
-    if (auto view = view_for_page_id(page_id); view.has_value()) {
-        if (view->on_close)
-            view->on_close();
+    // NB: Pages that were closed through unregister_view() no longer have a view, so this does not use view_for_page_id(),
+    //     which would complain about it.
+    if (auto view = m_views.get(page_id); view.has_value()) {
+        if ((*view)->on_close)
+            (*view)->on_close();
     }
 }
 
@@ -778,7 +820,7 @@ Messages::WebContentClient::RequestWorkerAgentResponse WebContentClient::request
     if (auto view = view_for_page_id(page_id); view.has_value()) {
         auto request_server_handle = MUST(connect_new_request_server_client());
         auto image_decoder_handle = MUST(connect_new_image_decoder_client());
-        auto worker_client = MUST(WebView::launch_web_worker_process(worker_type));
+        auto worker_client = MUST(Application::the().launch_web_worker_process(worker_type));
         auto worker_handle = MUST(worker_client->transport().release_for_transfer());
         return { move(worker_handle), move(request_server_handle), move(image_decoder_handle) };
     }
@@ -55,6 +55,33 @@ static StringView xml_char_to_string_view(xmlChar const* str)
     return StringView(reinterpret_cast<char const*>(str), strlen(reinterpret_cast<char const*>(str)));
 }
 
+// NB: This is called for every element and attribute, so the name is built in one allocation and without a
+//     StringBuilder in between.
+static ByteString qualified_name(StringView prefix, StringView local_name)
+{
+    if (prefix.is_empty())
+        return ByteString(local_name);
+
+    return ByteString::create_and_overwrite(prefix.length() + 1 + local_name.length(), [&](Bytes buffer) {
+        prefix.bytes().copy_to(buffer);
+        buffer[prefix.length()] = ':';
+        local_name.bytes().copy_to(buffer.slice(prefix.length() + 1));
+    });
+}
+
+static ByteString qualified_name(xmlChar const* prefix, xmlChar const* local_name)
+{
+    return qualified_name(xml_char_to_string_view(prefix), xml_char_to_string_view(local_name));
+}
+
+// NB: The push parser discards the input it has consumed, so the offset into its current buffer is not an offset into
+//     the source.
+static size_t current_offset(xmlParserCtxtPtr parser_ctx)
+{
+    auto consumed = xmlByteConsumed(parser_ctx);
+    return consumed > 0 ? static_cast<size_t>(consumed) : 0;
+}
+
 static bool is_known_xhtml_public_id(StringView public_id)
 {
     return public_id.is_one_of(
@@ -174,9 +201,7 @@ static void start_element_ns_handler(void* ctx, xmlChar const* localname, xmlCha
         return;
 
     if (++context->depth > MAX_XML_TREE_DEPTH) {
-        size_t offset = 0;
-        if (parser_ctx->input && parser_ctx->input->cur && parser_ctx->input->base)
-            offset = static_cast<size_t>(parser_ctx->input->cur - parser_ctx->input->base);
+        auto offset = current_offset(parser_ctx);
 
         ParseError parse_error {
             .position = LineTrackingLexer::Position { .offset = offset },
@@ -191,28 +216,17 @@ static void start_element_ns_handler(void* ctx, xmlChar const* localname, xmlCha
         return;
     }
 
-    StringBuilder name_builder;
-    if (prefix) {
-        name_builder.append(xml_char_to_string_view(prefix));
-        name_builder.append(':');
-    }
-    name_builder.append(xml_char_to_string_view(localname));
-    auto name = name_builder.to_byte_string();
+    auto name = qualified_name(prefix, localname);
 
     OrderedHashMap<Name, ByteString> attrs;
+    attrs.ensure_capacity(static_cast<size_t>(nb_namespaces + nb_attributes));
 
     for (int i = 0; i < nb_namespaces; i++) {
         auto* ns_prefix = namespaces[i * 2];
         auto* ns_uri = namespaces[i * 2 + 1];
 
-        StringBuilder attr_name;
-        if (ns_prefix) {
-            attr_name.append("xmlns:"sv);
-            attr_name.append(xml_char_to_string_view(ns_prefix));
-        } else {
-            attr_name.append("xmlns"sv);
-        }
-        attrs.set(attr_name.to_byte_string(), xml_char_to_byte_string(ns_uri));
+        auto attr_name = ns_prefix ? qualified_name("xmlns"sv, xml_char_to_string_view(ns_prefix)) : ByteString("xmlns"sv);
+        attrs.set(move(attr_name), xml_char_to_byte_string(ns_uri));
     }
 
     for (int i = 0; i < nb_attributes; i++) {
@@ -221,16 +235,8 @@ static void start_element_ns_handler(void* ctx, xmlChar const* localname, xmlCha
         auto* value_begin = attributes[i * 5 + 3];
         auto* value_end = attributes[i * 5 + 4];
 
-        StringBuilder attr_name;
-        if (attr_prefix) {
-            attr_name.append(xml_char_to_string_view(attr_prefix));
-            attr_name.append(':');
-        }
-        attr_name.append(xml_char_to_string_view(attr_localname));
-
         auto value_len = static_cast<int>(value_end - value_begin);
-        auto value = xml_char_to_byte_string(value_begin, value_len);
-        attrs.set(attr_name.to_byte_string(), value);
+        attrs.set(qualified_name(attr_prefix, attr_localname), xml_char_to_byte_string(value_begin, value_len));
     }
 
     if (context->listener) {
@@ -264,13 +270,7 @@ static void end_element_ns_handler(void* ctx, xmlChar const* localname, xmlChar
 
     --context->depth;
 
-    StringBuilder name_builder;
-    if (prefix) {
-        name_builder.append(xml_char_to_string_view(prefix));
-        name_builder.append(':');
-    }
-    name_builder.append(xml_char_to_string_view(localname));
-    auto name = name_builder.to_byte_string();
+    auto name = qualified_name(prefix, localname);
 
     if (context->listener) {
         context->listener->element_end(name);
@@ -401,9 +401,7 @@ static void structured_error_handler(void* ctx, xmlError const* error)
     if (!context || !error)
         return;
 
-    size_t offset = 0;
-    if (parser_ctx->input && parser_ctx->input->cur && parser_ctx->input->base)
-        offset = static_cast<size_t>(parser_ctx->input->cur - parser_ctx->input->base);
+    auto offset = current_offset(parser_ctx);
 
     ParseError parse_error {
         .position = LineTrackingLexer::Position {
@@ -445,90 +443,78 @@ static xmlSAXHandler create_sax_handler(bool preserve_comments, bool resolve_htm
     return handler;
 }
 
-ErrorOr<void, ParseError> Parser::parse_with_listener(Listener& listener)
-{
-    auto source_result = listener.set_source(ByteString(m_source));
-    if (source_result.is_error())
-        return ParseError { {}, ByteString("Failed to set source") };
+// The source is fed to libxml2 in chunks of this size. Its push parser only keeps the input it has not consumed yet,
+// so this bounds its copy of the source, and the listener receives events while the rest is still being fed.
+static constexpr size_t PARSE_CHUNK_SIZE = 64 * KiB;
 
-    ParserContext context;
-    context.listener = &listener;
-    context.options = &m_options;
+static ErrorOr<void, ParseError> run_parser(StringView source, Parser::Options const& options, ParserContext& context)
+{
+    context.options = &options;
 
-    bool resolve_html_entities = static_cast<bool>(m_options.resolve_named_html_entity);
-    auto sax_handler = create_sax_handler(m_options.preserve_comments, resolve_html_entities);
+    bool resolve_html_entities = static_cast<bool>(options.resolve_named_html_entity);
+    auto sax_handler = create_sax_handler(options.preserve_comments, resolve_html_entities);
 
-    int options = XML_PARSE_NONET | XML_PARSE_NOWARNING;
-    if (!m_options.preserve_cdata)
-        options |= XML_PARSE_NOCDATA;
+    int parse_options = XML_PARSE_NONET | XML_PARSE_NOWARNING;
+    if (!options.preserve_cdata)
+        parse_options |= XML_PARSE_NOCDATA;
 
     auto* parser_ctx = xmlCreatePushParserCtxt(&sax_handler, nullptr, nullptr, 0, nullptr);
     if (!parser_ctx)
         return ParseError { {}, ByteString("Failed to create parser context") };
 
     parser_ctx->_private = &context;
-    xmlCtxtUseOptions(parser_ctx, options);
+    xmlCtxtUseOptions(parser_ctx, parse_options);
 
     xmlSwitchEncoding(parser_ctx, XML_CHAR_ENCODING_UTF8);
 
-    auto result = xmlParseChunk(parser_ctx, m_source.characters_without_null_termination(), static_cast<int>(m_source.length()), 1);
+    int result = 0;
+    size_t offset = 0;
+    do {
+        auto chunk = source.substring_view(offset, min(PARSE_CHUNK_SIZE, source.length() - offset));
+        offset += chunk.length();
+        result = xmlParseChunk(parser_ctx, chunk.characters_without_null_termination(), static_cast<int>(chunk.length()), offset == source.length());
+    } while (result == 0 && offset < source.length());
 
     bool well_formed = parser_ctx->wellFormed;
     xmlFreeParserCtxt(parser_ctx);
 
-    m_parse_errors = move(context.parse_errors);
-
-    if (!context.document_ended)
-        listener.document_end();
-
-    if (context.error.has_value() && m_options.treat_errors_as_fatal)
-        return context.error.release_value();
+    if (context.error.has_value() && options.treat_errors_as_fatal)
+        return context.error.value();
 
     if (result != 0 || !well_formed) {
-        if (!m_parse_errors.is_empty())
-            return m_parse_errors.first();
+        if (!context.parse_errors.is_empty())
+            return context.parse_errors.first();
         return ParseError { {}, ByteString("XML parsing failed") };
     }
 
     return {};
 }
 
-ErrorOr<Document, ParseError> Parser::parse()
+ErrorOr<void, ParseError> Parser::parse_with_listener(Listener& listener)
 {
-    ParserContext context;
-    context.options = &m_options;
-
-    bool resolve_html_entities = static_cast<bool>(m_options.resolve_named_html_entity);
-    auto sax_handler = create_sax_handler(m_options.preserve_comments, resolve_html_entities);
-
-    int options = XML_PARSE_NONET | XML_PARSE_NOWARNING;
-    if (!m_options.preserve_cdata)
-        options |= XML_PARSE_NOCDATA;
+    auto source_result = listener.set_source(m_source);
+    if (source_result.is_error())
+        return ParseError { {}, ByteString("Failed to set source") };
 
-    auto* parser_ctx = xmlCreatePushParserCtxt(&sax_handler, nullptr, nullptr, 0, nullptr);
-    if (!parser_ctx)
-        return ParseError { {}, ByteString("Failed to create parser context") };
+    ParserContext context;
+    context.listener = &listener;
 
-    parser_ctx->_private = &context;
-    xmlCtxtUseOptions(parser_ctx, options);
+    auto result = run_parser(m_source, m_options, context);
+    m_parse_errors = move(context.parse_errors);
 
-    xmlSwitchEncoding(parser_ctx, XML_CHAR_ENCODING_UTF8);
+    if (!context.document_ended)
+        listener.document_end();
 
-    auto result = xmlParseChunk(parser_ctx, m_source.characters_without_null_termination(), static_cast<int>(m_source.length()), 1);
+    return result;
+}
 
-    bool well_formed = parser_ctx->wellFormed;
-    xmlFreeParserCtxt(parser_ctx);
+ErrorOr<Document, ParseError> Parser::parse()
+{
+    ParserContext context;
 
+    auto result = run_parser(m_source, m_options, context);
     m_parse_errors = move(context.parse_errors);
-
-    if (context.error.has_value() && m_options.treat_errors_as_fatal)
-        return context.error.release_value();
-
-    if (result != 0 || !well_formed) {
-        if (!m_parse_errors.is_empty())
-            return m_parse_errors.first();
-        return ParseError { {}, ByteString("XML parsing failed") };
-    }
+    TRY(result);
 
     if (!context.root_node)
         return ParseError { {}, ByteString("No root element") };
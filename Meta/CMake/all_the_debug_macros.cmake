@@ -59,6 +59,7 @@ set(RSA_PARSE_DEBUG ON)
 set(SHARED_QUEUE_DEBUG ON)
 set(SPAM_DEBUG ON)
 set(STYLE_INVALIDATION_DEBUG ON)
+set(SYNC_IPC_DEBUG ON)
 set(SYNTAX_HIGHLIGHTING_DEBUG ON)
 set(TEXTEDITOR_DEBUG ON)
 set(TIFF_DEBUG ON)
@@ -74,6 +75,7 @@ set(VULKAN_VALIDATION_LAYERS_DEBUG ON)
 set(WASI_DEBUG ON)
 set(WASI_FINE_GRAINED_DEBUG ON)
 set(WASM_BINPARSER_DEBUG ON)
+set(WASM_OPCODE_PAIR_PROFILE_DEBUG ON)
 set(WASM_TRACE_DEBUG ON)
 set(WASM_VALIDATOR_DEBUG ON)
 set(WEBDRIVER_DEBUG ON)
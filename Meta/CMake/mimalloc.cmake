@@ -0,0 +1,19 @@
+# mimalloc keeps a cache of free blocks for each size class in every thread, so the many small allocations made by our
+# containers rarely have to take a lock. It overrides malloc and free for the whole process, including for the
+# allocations made by our third-party dependencies, so it is linked into every target.
+if (ENABLE_MIMALLOC)
+    if (WIN32)
+        message(FATAL_ERROR "ENABLE_MIMALLOC is not supported on Windows, as overriding malloc there requires a redirection DLL")
+    endif()
+    if (ENABLE_ADDRESS_SANITIZER OR ENABLE_MEMORY_SANITIZER)
+        message(FATAL_ERROR "ENABLE_MIMALLOC cannot be combined with sanitizers that replace the allocator themselves")
+    endif()
+
+    find_package(mimalloc CONFIG REQUIRED)
+
+    if (BUILD_SHARED_LIBS AND TARGET mimalloc)
+        link_libraries(mimalloc)
+    else()
+        link_libraries(mimalloc-static)
+    endif()
+endif()
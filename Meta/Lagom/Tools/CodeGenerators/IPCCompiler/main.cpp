@@ -46,6 +46,7 @@ static ByteString pascal_case(ByteString const& identifier)
 struct Message {
     ByteString name;
     bool is_synchronous { false };
+    bool is_coalesced { false };
     Vector<Parameter> inputs;
     Vector<Parameter> outputs;
 
@@ -228,6 +229,17 @@ Vector<Endpoint> parse(ByteBuffer const& file_contents)
     auto parse_message = [&] {
         Message message;
         consume_whitespace();
+        if (lexer.consume_specific('[')) {
+            auto attribute = lexer.consume_until(']');
+            assert_specific(']');
+            if (attribute == "Coalesced"sv) {
+                message.is_coalesced = true;
+            } else {
+                warnln("Unknown message attribute: {}", attribute);
+                VERIFY_NOT_REACHED();
+            }
+            consume_whitespace();
+        }
         message.name = lexer.consume_until([](char ch) { return isspace(ch) || ch == '('; });
         consume_whitespace();
         assert_specific('(');
@@ -246,6 +258,11 @@ Vector<Endpoint> parse(ByteBuffer const& file_contents)
 
         consume_whitespace();
 
+        if (message.is_coalesced && message.is_synchronous) {
+            warnln("Synchronous message {} cannot be coalesced", message.name);
+            VERIFY_NOT_REACHED();
+        }
+
         if (message.is_synchronous) {
             assert_specific('(');
             parse_parameters(message.outputs, message.name);
@@ -404,6 +421,7 @@ public:)~~~");
     virtual i32 message_id() const override { return (int)MessageID::@message.pascal_name@; }
     static i32 static_message_id() { return (int)MessageID::@message.pascal_name@; }
     virtual const char* message_name() const override { return "@endpoint.name@::@message.pascal_name@"; }
+    static const char* static_message_name() { return "@endpoint.name@::@message.pascal_name@"; }
 
     static ErrorOr<NonnullOwnPtr<@message.pascal_name@>> decode(Stream& stream, Queue<IPC::Attachment>& attachments)
     {
@@ -655,6 +673,13 @@ void generate_proxy_method(SourceGenerator& message_generator, Endpoint const& e
             message_generator.appendln(R"~~~(
         return { };)~~~");
         }
+    } else if (message.is_coalesced) {
+        // Coalesced messages are coalesced per page, if they are for a page.
+        auto has_page_id = !parameters.is_empty() && parameters.first().name == "page_id"sv && parameters.first().type == "u64"sv;
+        message_generator.set("message.page_id", has_page_id ? "page_id" : "OptionalNone {}");
+
+        message_generator.append(R"~~~());
+        m_connection.post_coalesced_message(Messages::@endpoint.name@::@message.pascal_name@::static_message_id(), @message.page_id@, move(message_buffer)); )~~~");
     } else {
         // Async messages silently ignore send failures (e.g. peer disconnected).
         message_generator.append(R"~~~());
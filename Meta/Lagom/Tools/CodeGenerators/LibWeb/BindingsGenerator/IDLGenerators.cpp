@@ -48,6 +48,7 @@ static bool is_platform_object(Type const& type)
         "AudioTrack"sv,
         "BaseAudioContext"sv,
         "Blob"sv,
+        "Cache"sv,
         "CacheStorage"sv,
         "CanvasGradient"sv,
         "CanvasPattern"sv,
@@ -122,6 +123,7 @@ static bool is_platform_object(Type const& type)
         "Range"sv,
         "ReadableStream"sv,
         "Request"sv,
+        "Response"sv,
         "Selection"sv,
         "ServiceWorkerContainer"sv,
         "ServiceWorkerRegistration"sv,
@@ -605,6 +607,17 @@ static void generate_from_integral(SourceGenerator& scoped_generator, IDL::Type
     }
 }
 
+// Returns the name of the JS::Value method that checks whether an int32 value can be used for the given integral IDL
+// type as is, if there is one.
+static Optional<StringView> int32_fast_path_check_for_integral_type(StringView idl_type)
+{
+    if (idl_type.is_one_of("long"sv, "long long"sv))
+        return "is_int32"sv;
+    if (idl_type.is_one_of("unsigned long"sv, "unsigned long long"sv))
+        return "is_non_negative_int32"sv;
+    return {};
+}
+
 template<typename ParameterType>
 static void generate_to_integral(SourceGenerator& scoped_generator, ParameterType const& parameter, bool optional, Optional<ByteString> optional_default_value)
 {
@@ -659,6 +672,13 @@ static void generate_to_integral(SourceGenerator& scoped_generator, ParameterTyp
     if (it->cpp_type == "bool"sv) {
         scoped_generator.append(R"~~~(
     @cpp_name@ = @js_name@@js_suffix@.to_boolean();
+)~~~");
+    } else if (auto int32_check = int32_fast_path_check_for_integral_type(it->idl_type); int32_check.has_value()) {
+        // OPTIMIZATION: Int32 values that the IDL type can represent come out of the conversion unchanged, whether or
+        //               not [EnforceRange] or [Clamp] apply, so we can skip the generic conversion for them.
+        scoped_generator.set("int32_check"sv, *int32_check);
+        scoped_generator.append(R"~~~(
+    @cpp_name@ = @js_name@@js_suffix@.@int32_check@() ? static_cast<@cpp_type@>(@js_name@@js_suffix@.as_i32()) : TRY(WebIDL::convert_to_int<@cpp_type@>(vm, @js_name@@js_suffix@, WebIDL::EnforceRange::@enforce_range@, WebIDL::Clamp::@clamp@));
 )~~~");
     } else {
         scoped_generator.append(R"~~~(
@@ -876,10 +896,12 @@ static void generate_to_cpp(SourceGenerator& generator, ParameterType& parameter
             scoped_generator.set("parameter.type.name", "double");
         }
 
+        // OPTIMIZATION: Most floating point arguments are passed as numbers already, which we can read out of the value
+        //               directly instead of making an out-of-line call to Value::to_double().
         bool is_wrapped_in_optional_type = false;
         if (!optional) {
             scoped_generator.append(R"~~~(
-    @parameter.type.name@ @cpp_name@ = TRY(@js_name@@js_suffix@.to_double(vm));
+    @parameter.type.name@ @cpp_name@ = @js_name@@js_suffix@.is_number() ? @js_name@@js_suffix@.as_double() : TRY(@js_name@@js_suffix@.to_double(vm));
 )~~~");
         } else {
             if (optional_default_value.has_value() && optional_default_value != "null"sv) {
@@ -893,7 +915,9 @@ static void generate_to_cpp(SourceGenerator& generator, ParameterType& parameter
 )~~~");
             }
             scoped_generator.append(R"~~~(
-    if (!@js_name@@js_suffix@.is_undefined())
+    if (@js_name@@js_suffix@.is_number())
+        @cpp_name@ = @js_name@@js_suffix@.as_double();
+    else if (!@js_name@@js_suffix@.is_undefined())
         @cpp_name@ = TRY(@js_name@@js_suffix@.to_double(vm));
 )~~~");
             if (optional_default_value.has_value() && optional_default_value.value() != "null"sv) {
@@ -5454,6 +5478,7 @@ using namespace Web::HTML;
 using namespace Web::IndexedDB;
 using namespace Web::Internals;
 using namespace Web::IntersectionObserver;
+using namespace Web::LongAnimationFrames;
 using namespace Web::MediaCapabilitiesAPI;
 using namespace Web::MediaSourceExtensions;
 using namespace Web::NavigationTiming;
@@ -5462,6 +5487,7 @@ using namespace Web::PerformanceTimeline;
 using namespace Web::RequestIdleCallback;
 using namespace Web::ResizeObserver;
 using namespace Web::ResourceTiming;
+using namespace Web::Scheduling;
 using namespace Web::Selection;
 using namespace Web::Serial;
 using namespace Web::ServiceWorker;
@@ -642,6 +642,29 @@ def generate_fixup_cache_function(ops: List[OpDef]) -> str:
     return "\n".join(lines)
 
 
+def generate_instruction_cache_function(ops: List[OpDef]) -> str:
+    """Generate instruction_cache() that returns the (fixed up) cache pointer of an instruction."""
+    lines: List[str] = []
+    lines.append("void const* instruction_cache(Instruction const& insn)")
+    lines.append("{")
+    lines.append("    switch (insn.type()) {")
+
+    for op in ops:
+        has_cache = any(f.name == "m_cache" and is_cache_pointer_type(f.type) for f in op.fields)
+        if not has_cache:
+            continue
+
+        lines.append(f"    case Instruction::Type::{op.name}:")
+        lines.append(f"        return bit_cast<void const*>(static_cast<Op::{op.name} const&>(insn).cache());")
+
+    lines.append("    default:")
+    lines.append("        return nullptr;")
+    lines.append("    }")
+    lines.append("}")
+    lines.append("")
+    return "\n".join(lines)
+
+
 def generate_op_cpp_body(ops: List[OpDef]) -> str:
     lines: List[str] = []
     lines.append("#include <AK/StringBuilder.h>")
@@ -662,6 +685,7 @@ def generate_op_cpp_body(ops: List[OpDef]) -> str:
     lines.append("namespace JS::Bytecode {")
     lines.append("")
     lines.append(generate_fixup_cache_function(ops))
+    lines.append(generate_instruction_cache_function(ops))
     lines.append("} // namespace JS::Bytecode")
     return "\n".join(lines)
 
@@ -706,6 +730,10 @@ void fixup_instruction_cache(
     Span<TemplateObjectCache> template_object_caches,
     Span<ObjectShapeCache> object_shape_caches);
 
+// Returns the inline cache used by an instruction, or nullptr if it has none.
+// Only meaningful after the executable's cache pointers have been fixed up.
+void const* instruction_cache(Instruction const& insn);
+
 } // namespace JS::Bytecode
 """
     return includes + "\n" + body + "\n" + fixup_decl
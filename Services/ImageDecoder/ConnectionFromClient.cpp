@@ -7,8 +7,10 @@
 #include <AK/Debug.h>
 #include <AK/IDAllocator.h>
 #include <ImageDecoder/ConnectionFromClient.h>
+#include <ImageDecoder/DecodedImageCache.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <LibCore/System.h>
+#include <LibCore/Tracing.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibGfx/ImageFormats/TIFFMetadata.h>
@@ -36,6 +38,12 @@ void ConnectionFromClient::die()
     m_pending_frame_jobs.clear();
     m_animation_sessions.clear();
 
+    for (auto& [_, streaming_decode] : m_streaming_decodes) {
+        if (streaming_decode->partial_decode_job)
+            streaming_decode->partial_decode_job->cancel();
+    }
+    m_streaming_decodes.clear();
+
     auto client_id = this->client_id();
     s_connections.remove(client_id);
     s_client_ids.deallocate(client_id);
@@ -81,6 +89,16 @@ Messages::ImageDecoderServer::ConnectNewClientsResponse ConnectionFromClient::co
     return handles;
 }
 
+void ConnectionFromClient::set_tracing_enabled(bool enabled)
+{
+    Core::Tracing::set_enabled(enabled);
+}
+
+Messages::ImageDecoderServer::TakeTraceEventsResponse ConnectionFromClient::take_trace_events()
+{
+    return Core::Tracing::take_events_as_json();
+}
+
 static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
 {
     bitmaps.ensure_capacity(decoder.frame_count());
@@ -101,7 +119,10 @@ static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder
 
 static constexpr u32 STREAMING_BATCH_SIZE = 4;
 
-static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
+// Images larger than this may not fit into a single texture, so they are converted to RGB here rather than on the GPU.
+static constexpr int MAXIMUM_YUV_IMAGE_DIMENSION = 8192;
+
+static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type, bool allow_yuv)
 {
     auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type));
 
@@ -116,13 +137,6 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     result.loop_count = decoder->loop_count();
     result.frame_count = decoder->frame_count();
 
-    if (auto maybe_icc_data = decoder->color_space(); !maybe_icc_data.is_error())
-        result.color_profile = maybe_icc_data.value();
-    else
-        dbgln("Invalid color profile: {}", maybe_icc_data.error());
-
-    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
-
     if (auto maybe_metadata = decoder->metadata(); maybe_metadata.has_value() && is<Gfx::ExifMetadata>(*maybe_metadata)) {
         auto const& exif = static_cast<Gfx::ExifMetadata const&>(maybe_metadata.value());
         if (exif.x_resolution().has_value() && exif.y_resolution().has_value()) {
@@ -135,6 +149,31 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         }
     }
 
+    // OPTIMIZATION: Still images that the decoder can give us as YUV planes are sent to the client as they are, and are
+    //               converted to RGB on the GPU when they are drawn. This skips the conversion on the CPU, and the planes
+    //               take up half as much memory as the bitmap would, or less.
+    // NB: This has to happen before we ask for the color space, as that decodes some formats to RGB.
+    if (allow_yuv && !result.is_animated && result.frame_count == 1) {
+        auto yuv_data_or_error = decoder->yuv_frame();
+        if (yuv_data_or_error.is_error())
+            dbgln_if(IMAGE_DECODER_DEBUG, "Could not decode image to YUV: {}", yuv_data_or_error.error());
+
+        if (!yuv_data_or_error.is_error() && yuv_data_or_error.value()) {
+            auto const& yuv_data = *yuv_data_or_error.value();
+            if (yuv_data.size().width() <= MAXIMUM_YUV_IMAGE_DIMENSION && yuv_data.size().height() <= MAXIMUM_YUV_IMAGE_DIMENSION) {
+                result.yuv_data = Gfx::ShareableYUVData { yuv_data };
+                return result;
+            }
+        }
+    }
+
+    if (auto maybe_icc_data = decoder->color_space(); !maybe_icc_data.is_error())
+        result.color_profile = maybe_icc_data.value();
+    else
+        dbgln("Invalid color profile: {}", maybe_icc_data.error());
+
+    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+
     bool const use_streaming = result.is_animated && result.frame_count > 1;
 
     if (use_streaming) {
@@ -175,13 +214,104 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     return result;
 }
 
-NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 request_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+static ErrorOr<ConnectionFromClient::PartialDecodeResult> decode_partial_image(ReadonlyBytes encoded_data, Optional<ByteString> const& known_mime_type)
+{
+    ConnectionFromClient::PartialDecodeResult result;
+
+    // Until enough data has arrived to tell what kind of image this is, there is nothing to decode.
+    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(encoded_data, known_mime_type));
+    if (!decoder)
+        return result;
+
+    // NB: Animations are only shown once their frames can be decoded in full.
+    if (decoder->is_animated() || decoder->frame_count() != 1) {
+        result.may_decode_again = false;
+        return result;
+    }
+
+    auto frame = TRY(decoder->frame(0));
+    frame.image->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
+    result.bitmap = move(frame.image);
+
+    if (auto color_space = decoder->color_space(); !color_space.is_error())
+        result.color_profile = color_space.release_value();
+
+    return result;
+}
+
+static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_or_take_from_cache(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type, bool allow_yuv)
+{
+    auto cache_key = DecodedImageCache::key_for(encoded_buffer.bytes(), ideal_size, allow_yuv);
+
+    if (auto image = DecodedImageCache::the().lookup(cache_key); image.has_value()) {
+        ConnectionFromClient::DecodeResult result;
+        result.frame_count = 1;
+        result.scale = image->scale;
+        result.color_profile = move(image->color_profile);
+        result.shared_bitmap = move(image->bitmap);
+        result.yuv_data = move(image->yuv_data);
+        return result;
+    }
+
+    auto result = TRY(decode_image_to_details(move(encoded_buffer), ideal_size, known_mime_type, allow_yuv));
+
+    // NB: Animations keep their decoder around to decode more frames on demand, so only still images are shared.
+    if (!result.yuv_data.is_valid()) {
+        if (result.decoder || result.is_animated || result.bitmaps.bitmaps.size() != 1 || !result.bitmaps.bitmaps.first())
+            return result;
+
+        auto bitmap = TRY(result.bitmaps.bitmaps.first()->to_bitmap_backed_by_anonymous_buffer());
+        result.shared_bitmap = Gfx::ShareableBitmap { move(bitmap), Gfx::ShareableBitmap::ConstructWithKnownGoodBitmap };
+        result.bitmaps = {};
+    }
+
+    DecodedImageCache::Image image {
+        .bitmap = result.shared_bitmap,
+        .yuv_data = result.yuv_data,
+        .scale = result.scale,
+        .color_profile = result.color_profile,
+    };
+    if (auto cache_result = DecodedImageCache::the().insert(move(cache_key), image); cache_result.is_error())
+        dbgln_if(IMAGE_DECODER_DEBUG, "Could not cache decoded image: {}", cache_result.error());
+
+    return result;
+}
+
+// Image decodes are independent of one another, so they run on the thread pool, where several of them may run at once.
+// Images that are visible to the user are decoded ahead of the rest.
+static Threading::ThreadPool::Priority thread_pool_priority(DecodePriority priority)
+{
+    switch (priority) {
+    case DecodePriority::Visible:
+        return Threading::ThreadPool::Priority::High;
+    case DecodePriority::Normal:
+        return Threading::ThreadPool::Priority::Normal;
+    case DecodePriority::Offscreen:
+        return Threading::ThreadPool::Priority::Low;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 request_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority priority, bool allow_yuv)
 {
     return Job::construct(
-        [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)](auto&) mutable -> ErrorOr<DecodeResult> {
-            return TRY(decode_image_to_details(move(encoded_buffer), ideal_size, mime_type));
+        [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type), allow_yuv](auto&) mutable -> ErrorOr<DecodeResult> {
+            TRACE_EVENT("image", "ImageDecoder::decode_image");
+            return TRY(decode_image_or_take_from_cache(move(encoded_buffer), ideal_size, mime_type, allow_yuv));
         },
         [strong_this = NonnullRefPtr(*this), request_id](DecodeResult result) {
+            if (result.shared_bitmap.is_valid()) {
+                strong_this->async_did_decode_still_image(request_id, move(result.shared_bitmap), result.scale, move(result.color_profile));
+                strong_this->m_pending_jobs.remove(request_id);
+                return;
+            }
+
+            if (result.yuv_data.is_valid()) {
+                strong_this->async_did_decode_yuv_image(request_id, move(result.yuv_data), result.scale);
+                strong_this->m_pending_jobs.remove(request_id);
+                return;
+            }
+
             i64 session_id = 0;
 
             if (result.decoder) {
@@ -201,10 +331,11 @@ NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image
             if (strong_this->is_open())
                 strong_this->async_did_fail_to_decode_image(request_id, MUST(String::formatted("Decoding failed: {}", error)));
             strong_this->m_pending_jobs.remove(request_id);
-        });
+        },
+        thread_pool_priority(priority));
 }
 
-void ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id)
+void ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority priority, bool allow_yuv, i64 request_id)
 {
     if (!encoded_buffer.is_valid()) {
         dbgln_if(IMAGE_DECODER_DEBUG, "Encoded data is invalid");
@@ -212,7 +343,17 @@ void ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Op
         return;
     }
 
-    auto set_result = m_pending_jobs.set(request_id, make_decode_image_job(request_id, move(encoded_buffer), ideal_size, move(mime_type)), AK::HashSetExistingEntryBehavior::Keep);
+    if (m_streaming_decodes.contains(request_id)) {
+        did_misbehave("Duplicate decode request id");
+        return;
+    }
+
+    start_decoding(request_id, move(encoded_buffer), ideal_size, move(mime_type), priority, allow_yuv);
+}
+
+void ConnectionFromClient::start_decoding(i64 request_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority priority, bool allow_yuv)
+{
+    auto set_result = m_pending_jobs.set(request_id, make_decode_image_job(request_id, move(encoded_buffer), ideal_size, move(mime_type), priority, allow_yuv), AK::HashSetExistingEntryBehavior::Keep);
 
     if (set_result != HashSetResult::InsertedNewEntry) {
         m_pending_jobs.take(request_id).value()->cancel();
@@ -221,11 +362,138 @@ void ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Op
     }
 }
 
+// NB: A canceled job that has not started yet is never run, so canceling also frees up the pool for other decodes.
 void ConnectionFromClient::cancel_decoding(i64 request_id)
 {
     if (auto job = m_pending_jobs.take(request_id); job.has_value()) {
         job.value()->cancel();
     }
+
+    if (auto streaming_decode = m_streaming_decodes.take(request_id); streaming_decode.has_value()) {
+        if (streaming_decode.value()->partial_decode_job)
+            streaming_decode.value()->partial_decode_job->cancel();
+    }
+}
+
+void ConnectionFromClient::begin_streaming_decode(i64 request_id, Optional<ByteString> mime_type, DecodePriority priority, bool allow_yuv)
+{
+    if (m_pending_jobs.contains(request_id)) {
+        did_misbehave("Duplicate decode request id");
+        return;
+    }
+
+    auto streaming_decode = make<StreamingDecode>();
+    streaming_decode->mime_type = move(mime_type);
+    streaming_decode->priority = priority;
+    streaming_decode->allow_yuv = allow_yuv;
+
+    if (m_streaming_decodes.set(request_id, move(streaming_decode), AK::HashSetExistingEntryBehavior::Keep) != HashSetResult::InsertedNewEntry)
+        did_misbehave("Duplicate decode request id");
+}
+
+void ConnectionFromClient::append_streaming_decode_data(i64 request_id, ByteBuffer data)
+{
+    auto it = m_streaming_decodes.find(request_id);
+    if (it == m_streaming_decodes.end())
+        return;
+
+    auto& streaming_decode = *it->value;
+
+    if (auto result = streaming_decode.encoded_data.try_append(data); result.is_error()) {
+        cancel_decoding(request_id);
+        async_did_fail_to_decode_image(request_id, MUST(String::formatted("Decoding failed: {}", result.error())));
+        return;
+    }
+
+    start_partial_decode_if_needed(request_id, streaming_decode);
+}
+
+void ConnectionFromClient::finish_streaming_decode(i64 request_id, Optional<Gfx::IntSize> ideal_size)
+{
+    auto streaming_decode = m_streaming_decodes.take(request_id);
+    if (!streaming_decode.has_value())
+        return;
+
+    // The final decode supersedes any partial decode that is still running.
+    if (streaming_decode.value()->partial_decode_job)
+        streaming_decode.value()->partial_decode_job->cancel();
+
+    auto& encoded_data = streaming_decode.value()->encoded_data;
+    if (encoded_data.is_empty()) {
+        async_did_fail_to_decode_image(request_id, "No encoded data"_string);
+        return;
+    }
+
+    auto encoded_buffer_or_error = Core::AnonymousBuffer::create_with_size(encoded_data.size());
+    if (encoded_buffer_or_error.is_error()) {
+        async_did_fail_to_decode_image(request_id, MUST(String::formatted("Decoding failed: {}", encoded_buffer_or_error.error())));
+        return;
+    }
+
+    auto encoded_buffer = encoded_buffer_or_error.release_value();
+    memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
+
+    start_decoding(request_id, move(encoded_buffer), ideal_size, move(streaming_decode.value()->mime_type), streaming_decode.value()->priority, streaming_decode.value()->allow_yuv);
+}
+
+// We only decode partially once at least this much data has arrived, as smaller images are quickly downloaded in full.
+static constexpr size_t MINIMUM_PARTIAL_DECODE_SIZE = 64 * KiB;
+
+void ConnectionFromClient::start_partial_decode_if_needed(i64 request_id, StreamingDecode& streaming_decode)
+{
+    if (!streaming_decode.may_decode_partially || streaming_decode.partial_decode_job)
+        return;
+
+    // OPTIMIZATION: Each partial decode starts over from the beginning of the data, so we wait for the data to at least
+    //               double in size between partial decodes. This keeps the partial decodes of an image from adding up to
+    //               more work than its final decode.
+    auto size = streaming_decode.encoded_data.size();
+    if (size < max(MINIMUM_PARTIAL_DECODE_SIZE, streaming_decode.size_at_last_partial_decode * 2))
+        return;
+
+    // NB: The decode runs on a background thread, so it gets a copy of the data that will not move as more arrives.
+    auto encoded_data_or_error = ByteBuffer::copy(streaming_decode.encoded_data);
+    if (encoded_data_or_error.is_error())
+        return;
+
+    streaming_decode.size_at_last_partial_decode = size;
+
+    auto on_finished = [](ConnectionFromClient& connection, i64 request_id) -> StreamingDecode* {
+        auto it = connection.m_streaming_decodes.find(request_id);
+        if (it == connection.m_streaming_decodes.end())
+            return nullptr;
+        it->value->partial_decode_job = nullptr;
+        return it->value.ptr();
+    };
+
+    streaming_decode.partial_decode_job = PartialDecodeJob::construct(
+        [encoded_data = encoded_data_or_error.release_value(), mime_type = streaming_decode.mime_type](auto&) -> ErrorOr<PartialDecodeResult> {
+            TRACE_EVENT("image", "ImageDecoder::decode_partial_image");
+            return decode_partial_image(encoded_data, mime_type);
+        },
+        [strong_this = NonnullRefPtr(*this), request_id, on_finished](PartialDecodeResult result) {
+            auto* streaming_decode = on_finished(*strong_this, request_id);
+            if (!streaming_decode)
+                return;
+
+            streaming_decode->may_decode_partially = result.may_decode_again;
+
+            if (result.bitmap) {
+                Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+                bitmaps.append(move(result.bitmap));
+                strong_this->async_did_decode_partial_image(request_id, Gfx::BitmapSequence { move(bitmaps) }, move(result.color_profile));
+            }
+
+            // More data may have arrived while we were decoding.
+            strong_this->start_partial_decode_if_needed(request_id, *streaming_decode);
+        },
+        [strong_this = NonnullRefPtr(*this), request_id, on_finished](Error error) {
+            dbgln_if(IMAGE_DECODER_DEBUG, "Partial decode of request {} failed: {}", request_id, error);
+
+            if (auto* streaming_decode = on_finished(*strong_this, request_id))
+                strong_this->start_partial_decode_if_needed(request_id, *streaming_decode);
+        },
+        thread_pool_priority(streaming_decode.priority));
 }
 
 void ConnectionFromClient::request_animation_frames(i64 session_id, u32 start_frame_index, u32 count)
@@ -243,8 +511,11 @@ void ConnectionFromClient::request_animation_frames(i64 session_id, u32 start_fr
 
     u32 const end_index = min(frame_count, start_frame_index + min(count, frame_count - start_frame_index));
 
+    // NB: Frame decodes share the decoder of their session, so unlike other decodes, they stay on the background thread
+    //     where they run one after another.
     auto job = FrameDecodeJob::construct(
         [decoder, start_frame_index, end_index](auto&) -> ErrorOr<Vector<Gfx::ImageFrameDescriptor>> {
+            TRACE_EVENT("image", "ImageDecoder::decode_animation_frames");
             Vector<Gfx::ImageFrameDescriptor> frames;
             frames.ensure_capacity(end_index - start_frame_index);
             for (u32 i = start_frame_index; i < end_index; ++i) {
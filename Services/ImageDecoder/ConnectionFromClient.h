@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <ImageDecoder/DecodePriority.h>
 #include <ImageDecoder/Forward.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
@@ -14,6 +15,8 @@
 #include <LibGfx/BitmapSequence.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
+#include <LibGfx/ShareableBitmap.h>
+#include <LibGfx/ShareableYUVData.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibThreading/BackgroundAction.h>
 
@@ -37,6 +40,10 @@ public:
         Vector<u32> durations;
         Gfx::ColorSpace color_profile;
 
+        // Set instead of the bitmaps for still images, which are shared with every client that decodes them.
+        Gfx::ShareableBitmap shared_bitmap;
+        Gfx::ShareableYUVData yuv_data;
+
         // Non-null for streaming animated sessions:
         RefPtr<Gfx::ImageDecoder> decoder;
         Core::AnonymousBuffer encoded_data;
@@ -48,26 +55,56 @@ public:
         u32 frame_count { 0 };
     };
 
+    struct PartialDecodeResult {
+        RefPtr<Gfx::Bitmap> bitmap;
+        Gfx::ColorSpace color_profile;
+
+        // Cleared for images that cannot be decoded partially, such as animations.
+        bool may_decode_again { true };
+    };
+
 private:
     using Job = Threading::BackgroundAction<DecodeResult>;
+    using PartialDecodeJob = Threading::BackgroundAction<PartialDecodeResult>;
     using FrameDecodeResult = Vector<Gfx::ImageFrameDescriptor>;
     using FrameDecodeJob = Threading::BackgroundAction<FrameDecodeResult>;
 
     explicit ConnectionFromClient(NonnullOwnPtr<IPC::Transport>);
 
-    virtual void decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id) override;
+    virtual void decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority, bool allow_yuv, i64 request_id) override;
     virtual void cancel_decoding(i64 request_id) override;
+    virtual void begin_streaming_decode(i64 request_id, Optional<ByteString> mime_type, DecodePriority, bool allow_yuv) override;
+    virtual void append_streaming_decode_data(i64 request_id, ByteBuffer data) override;
+    virtual void finish_streaming_decode(i64 request_id, Optional<Gfx::IntSize> ideal_size) override;
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) override;
     virtual void stop_animation_decode(i64 session_id) override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
     virtual Messages::ImageDecoderServer::InitTransportResponse init_transport(int peer_pid) override;
+    virtual void set_tracing_enabled(bool) override;
+    virtual Messages::ImageDecoderServer::TakeTraceEventsResponse take_trace_events() override;
 
     ErrorOr<IPC::TransportHandle> connect_new_client();
 
-    NonnullRefPtr<Job> make_decode_image_job(i64 request_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    NonnullRefPtr<Job> make_decode_image_job(i64 request_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority, bool allow_yuv);
+    void start_decoding(i64 request_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority, bool allow_yuv);
+
+    // The encoded data of a streaming decode arrives in chunks. Whenever enough of it has arrived, the image is decoded
+    // from the data so far, and the partial image is sent to the client ahead of the final image.
+    struct StreamingDecode {
+        ByteBuffer encoded_data;
+        Optional<ByteString> mime_type;
+        DecodePriority priority { DecodePriority::Normal };
+        bool allow_yuv { false };
+        size_t size_at_last_partial_decode { 0 };
+        RefPtr<PartialDecodeJob> partial_decode_job;
+        bool may_decode_partially { true };
+    };
+
+    void start_partial_decode_if_needed(i64 request_id, StreamingDecode&);
 
     i64 m_next_session_id { 1 };
     HashMap<i64, NonnullRefPtr<Job>> m_pending_jobs;
+    HashMap<i64, NonnullOwnPtr<StreamingDecode>> m_streaming_decodes;
     HashMap<i64, NonnullOwnPtr<AnimationSession>> m_animation_sessions;
     HashMap<i64, NonnullRefPtr<FrameDecodeJob>> m_pending_frame_jobs;
 };
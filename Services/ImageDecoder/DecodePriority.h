@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace ImageDecoder {
+
+// How soon the client needs a decoded image, from most to least urgent.
+enum class DecodePriority : u8 {
+    // Images that are or are about to be visible to the user.
+    Visible,
+    // Images without any particular urgency.
+    Normal,
+    // Images that the page marked as low priority, which are likely not visible.
+    Offscreen,
+};
+
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <ImageDecoder/DecodedImageCache.h>
+#include <LibGfx/Bitmap.h>
+
+namespace ImageDecoder {
+
+static constexpr size_t CAPACITY_IN_BYTES = 256 * MiB;
+
+DecodedImageCache& DecodedImageCache::the()
+{
+    static DecodedImageCache cache;
+    return cache;
+}
+
+DecodedImageCache::Key DecodedImageCache::key_for(ReadonlyBytes encoded_data, Optional<Gfx::IntSize> ideal_size, bool allow_yuv)
+{
+    // NB: The digest has to be cryptographic, as a page that could make its image collide with another page's image
+    //     would get to decide what that other page shows.
+    return Key {
+        .digest = Crypto::Hash::SHA256::hash(encoded_data.data(), encoded_data.size()),
+        .ideal_size = ideal_size,
+        .allow_yuv = allow_yuv,
+    };
+}
+
+static Core::AnonymousBuffer shared_buffer_for(DecodedImageCache::Image const& image)
+{
+    if (image.yuv_data.is_valid())
+        return image.yuv_data.anonymous_buffer();
+    VERIFY(image.bitmap.is_valid());
+    return image.bitmap.bitmap()->anonymous_buffer();
+}
+
+DecodedImageCache::Entry* DecodedImageCache::find(Key const& key)
+{
+    for (auto& entry : m_entries) {
+        if (entry.key == key)
+            return &entry;
+    }
+    return nullptr;
+}
+
+Optional<DecodedImageCache::Image> DecodedImageCache::lookup(Key const& key)
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    auto* entry = find(key);
+    if (!entry)
+        return {};
+
+    entry->last_use = ++m_use_counter;
+    return entry->image;
+}
+
+ErrorOr<void> DecodedImageCache::insert(Key key, Image const& image)
+{
+    auto buffer = shared_buffer_for(image);
+    TRY(buffer.seal_against_writes());
+
+    auto size = buffer.size();
+    if (size > CAPACITY_IN_BYTES)
+        return {};
+
+    Threading::MutexLocker locker(m_mutex);
+
+    // Another client may have decoded the same image in the meantime.
+    if (auto* entry = find(key)) {
+        entry->last_use = ++m_use_counter;
+        return {};
+    }
+
+    evict_until_size_is_at_most(CAPACITY_IN_BYTES - size);
+
+    TRY(m_entries.try_append({
+        .key = move(key),
+        .image = image,
+        .size_in_bytes = size,
+        .last_use = ++m_use_counter,
+    }));
+    m_size_in_bytes += size;
+    return {};
+}
+
+void DecodedImageCache::evict_until_size_is_at_most(size_t size)
+{
+    while (m_size_in_bytes > size) {
+        size_t least_recently_used = 0;
+        for (size_t i = 1; i < m_entries.size(); ++i) {
+            if (m_entries[i].last_use < m_entries[least_recently_used].last_use)
+                least_recently_used = i;
+        }
+        m_size_in_bytes -= m_entries[least_recently_used].size_in_bytes;
+        m_entries.remove(least_recently_used);
+    }
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibGfx/ColorSpace.h>
+#include <LibGfx/Point.h>
+#include <LibGfx/ShareableBitmap.h>
+#include <LibGfx/ShareableYUVData.h>
+#include <LibGfx/Size.h>
+#include <LibThreading/Mutex.h>
+
+namespace ImageDecoder {
+
+// A cache of decoded still images, shared by every client of the ImageDecoder process. Pages in different WebContent
+// processes often load the very same images, such as logos and avatars from a CDN, which this lets us decode only
+// once. The decoded images live in shared memory that is sealed against writes, so that every client maps the same
+// pixels, and none of them can change what the others see.
+//
+// Images are keyed by a digest of their encoded data, along with the parameters they were decoded with. The cache is
+// bounded by the size of the decoded images, and the least recently used images are evicted first. Clients keep their
+// mappings of evicted images alive for as long as they need them.
+//
+// NB: Decodes run on the thread pool, so the cache may be used from any thread.
+class DecodedImageCache {
+public:
+    struct Key {
+        Crypto::Hash::SHA256::DigestType digest;
+        Optional<Gfx::IntSize> ideal_size;
+        bool allow_yuv { false };
+
+        bool operator==(Key const&) const = default;
+    };
+
+    // Exactly one of the bitmap and the YUV data is valid.
+    struct Image {
+        Gfx::ShareableBitmap bitmap;
+        Gfx::ShareableYUVData yuv_data;
+        Gfx::FloatPoint scale { 1, 1 };
+        Gfx::ColorSpace color_profile;
+    };
+
+    static DecodedImageCache& the();
+
+    static Key key_for(ReadonlyBytes encoded_data, Optional<Gfx::IntSize> ideal_size, bool allow_yuv);
+
+    Optional<Image> lookup(Key const&);
+
+    // Seals the image's shared memory against writes, which happens even if the image is too large to be cached.
+    ErrorOr<void> insert(Key, Image const&);
+
+private:
+    struct Entry {
+        Key key;
+        Image image;
+        size_t size_in_bytes { 0 };
+        u64 last_use { 0 };
+    };
+
+    Entry* find(Key const&);
+    void evict_until_size_is_at_most(size_t);
+
+    Threading::Mutex m_mutex;
+    Vector<Entry> m_entries;
+    size_t m_size_in_bytes { 0 };
+    u64 m_use_counter { 0 };
+};
+
+}
@@ -12,15 +12,18 @@
 #include <LibCore/Socket.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
+#include <LibCore/Tracing.h>
 #include <LibHTTP/Cache/DiskCache.h>
 #include <LibIPC/TransportHandle.h>
 #include <LibRequests/WebSocket.h>
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
+#include <LibWebSocket/PerMessageDeflate.h>
 #include <RequestServer/CURL.h>
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/Request.h>
 #include <RequestServer/Resolver.h>
+#include <RequestServer/TLSSessionCache.h>
 #include <RequestServer/WebSocketImplCurl.h>
 
 namespace RequestServer {
@@ -28,13 +31,21 @@ namespace RequestServer {
 static ConnectionFromClient* g_primary_connection = nullptr;
 static IDAllocator s_client_ids;
 
+static ByteString alt_svc_cache_path_for_disk_cache(Optional<HTTP::DiskCache&> disk_cache)
+{
+    // The Alt-Svc advertisements of servers are stored alongside the disk cache, so that they are cleared along with it.
+    if (disk_cache.has_value())
+        return disk_cache->cache_directory().append("alt-svc-cache.txt"sv).string();
+    return ByteString::formatted("{}/Ladybird/alt-svc-cache.txt", Core::StandardPaths::cache_directory());
+}
+
 ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transport, IsPrimaryConnection is_primary_connection, ConnectionMap& connections, Optional<HTTP::DiskCache&> disk_cache)
     : IPC::ConnectionFromClient<RequestClientEndpoint, RequestServerEndpoint>(*this, move(transport), s_client_ids.allocate())
     , m_connections(connections)
     , m_disk_cache(disk_cache)
     , m_curl_multi(curl_multi_init())
     , m_resolver(Resolver::default_resolver())
-    , m_alt_svc_cache_path(ByteString::formatted("{}/Ladybird/alt-svc-cache.txt", Core::StandardPaths::cache_directory()))
+    , m_alt_svc_cache_path(alt_svc_cache_path_for_disk_cache(disk_cache))
 {
     if (is_primary_connection == IsPrimaryConnection::Yes) {
         VERIFY(g_primary_connection == nullptr);
@@ -61,6 +72,7 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transpo
 
 ConnectionFromClient::~ConnectionFromClient()
 {
+    m_delayed_requests.clear();
     m_active_requests.clear();
     m_active_revalidation_requests.clear();
 
@@ -79,10 +91,13 @@ void ConnectionFromClient::request_complete(Badge<Request>, Request const& reque
 {
     Core::deferred_invoke([weak_self = make_weak_ptr<ConnectionFromClient>(), request_id = request.request_id(), type = request.type()] {
         if (auto self = weak_self.strong_ref()) {
-            if (type == Request::Type::BackgroundRevalidation)
+            if (type == Request::Type::BackgroundRevalidation) {
                 self->m_active_revalidation_requests.remove(request_id);
-            else
+            } else {
                 self->m_active_requests.remove(request_id);
+                self->release_delayable_request_slot(request_id);
+                TRACE_COUNTER("network", "Active requests", self->m_active_requests.size());
+            }
         }
     });
 }
@@ -199,12 +214,86 @@ void ConnectionFromClient::set_use_system_dns()
     m_resolver->dns.reset_connection();
 }
 
-void ConnectionFromClient::start_request(u64 request_id, ByteString method, URL::URL url, Vector<HTTP::Header> request_headers, ByteBuffer request_body, HTTP::CacheMode cache_mode, HTTP::Cookie::IncludeCredentials include_credentials, Core::ProxyData proxy_data)
+static constexpr size_t max_in_flight_delayable_requests_per_origin = 6;
+
+static bool is_delayable_request(URL::URL const& url, RequestPriority priority)
+{
+    return priority > RequestPriority::High && url.scheme().is_one_of("http"sv, "https"sv);
+}
+
+void ConnectionFromClient::start_request(u64 request_id, ByteString method, URL::URL url, Vector<HTTP::Header> request_headers, ByteBuffer request_body, HTTP::CacheMode cache_mode, HTTP::Cookie::IncludeCredentials include_credentials, Core::ProxyData proxy_data, RequestPriority priority)
 {
     dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: start_request({}, {})", request_id, url);
 
-    auto request = Request::fetch(request_id, m_disk_cache, cache_mode, *this, m_curl_multi, m_resolver, move(url), move(method), HTTP::HeaderList::create(move(request_headers)), move(request_body), include_credentials, m_alt_svc_cache_path, proxy_data);
+    PendingRequest request { request_id, move(method), move(url), move(request_headers), move(request_body), cache_mode, include_credentials, move(proxy_data), priority };
+
+    if (is_delayable_request(request.url, priority)) {
+        auto origin = request.url.origin();
+        if (m_in_flight_delayable_request_count_by_origin.get(origin).value_or(0) >= max_in_flight_delayable_requests_per_origin) {
+            // Keep the delayed requests ordered by priority, and by arrival within the same priority.
+            auto index = m_delayed_requests.find_first_index_if([&](auto const& delayed_request) {
+                return delayed_request.priority > priority;
+            });
+            m_delayed_requests.insert(index.value_or(m_delayed_requests.size()), move(request));
+            TRACE_COUNTER("network", "Delayed requests", m_delayed_requests.size());
+            return;
+        }
+    }
+
+    start_pending_request(move(request));
+}
+
+void ConnectionFromClient::start_pending_request(PendingRequest pending_request)
+{
+    if (is_delayable_request(pending_request.url, pending_request.priority)) {
+        auto origin = pending_request.url.origin();
+        ++m_in_flight_delayable_request_count_by_origin.ensure(origin, [] { return 0; });
+        m_in_flight_delayable_request_origins.set(pending_request.request_id, move(origin));
+    }
+
+    auto request_id = pending_request.request_id;
+    auto request = Request::fetch(request_id, m_disk_cache, pending_request.cache_mode, *this, m_curl_multi, m_resolver, move(pending_request.url), move(pending_request.method), HTTP::HeaderList::create(move(pending_request.request_headers)), move(pending_request.request_body), pending_request.include_credentials, m_alt_svc_cache_path, pending_request.proxy_data, pending_request.priority);
     m_active_requests.set(request_id, move(request));
+
+    TRACE_COUNTER("network", "Active requests", m_active_requests.size());
+    TRACE_COUNTER("network", "Delayed requests", m_delayed_requests.size());
+}
+
+void ConnectionFromClient::release_delayable_request_slot(u64 request_id)
+{
+    auto origin = m_in_flight_delayable_request_origins.take(request_id);
+    if (!origin.has_value())
+        return;
+
+    auto count = m_in_flight_delayable_request_count_by_origin.find(*origin);
+    VERIFY(count != m_in_flight_delayable_request_count_by_origin.end());
+    if (--count->value == 0)
+        m_in_flight_delayable_request_count_by_origin.remove(count);
+
+    // Start the most urgent request that was delayed for this origin.
+    auto index = m_delayed_requests.find_first_index_if([&](auto const& delayed_request) {
+        return delayed_request.url.origin() == *origin;
+    });
+    if (index.has_value())
+        start_pending_request(m_delayed_requests.take(*index));
+}
+
+void ConnectionFromClient::start_requests(Vector<HTTP::Header> header_table, Vector<Requests::BatchedRequest> requests)
+{
+    for (auto& request : requests) {
+        Vector<HTTP::Header> request_headers;
+        request_headers.ensure_capacity(request.header_indices.size());
+
+        for (auto header_index : request.header_indices) {
+            if (header_index >= header_table.size()) {
+                did_misbehave("Batched request refers to a header outside of the header table");
+                return;
+            }
+            request_headers.unchecked_append(header_table[header_index]);
+        }
+
+        start_request(request.request_id, move(request.method), move(request.url), move(request_headers), move(request.request_body), request.cache_mode, request.include_credentials, move(request.proxy_data), request.priority);
+    }
 }
 
 void ConnectionFromClient::start_revalidation_request(Badge<Request>, ByteString method, URL::URL url, NonnullRefPtr<HTTP::HeaderList> request_headers, ByteBuffer request_body, HTTP::Cookie::IncludeCredentials include_credentials, Core::ProxyData proxy_data)
@@ -307,13 +396,44 @@ Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(
 {
     auto request = m_active_requests.take(request_id);
     if (!request.has_value()) {
+        auto removed_delayed_request = m_delayed_requests.remove_first_matching([&](auto const& delayed_request) {
+            return delayed_request.request_id == request_id;
+        });
+        if (removed_delayed_request)
+            return true;
+
         dbgln("StopRequest: Request ID {} not found", request_id);
         return false;
     }
 
+    release_delayable_request_slot(request_id);
     return true;
 }
 
+void ConnectionFromClient::set_request_priority(u64 request_id, RequestPriority priority)
+{
+    // NB: Requests that are already in flight keep their priority, as their HTTP/2 stream weight cannot be changed once
+    //     they have started. Only the order of the delayed requests is affected.
+    auto index = m_delayed_requests.find_first_index_if([&](auto const& delayed_request) {
+        return delayed_request.request_id == request_id;
+    });
+    if (!index.has_value())
+        return;
+
+    auto request = m_delayed_requests.take(*index);
+    request.priority = priority;
+
+    if (!is_delayable_request(request.url, priority)) {
+        start_pending_request(move(request));
+        return;
+    }
+
+    auto new_index = m_delayed_requests.find_first_index_if([&](auto const& delayed_request) {
+        return delayed_request.priority > priority;
+    });
+    m_delayed_requests.insert(new_index.value_or(m_delayed_requests.size()), move(request));
+}
+
 Messages::RequestServer::SetCertificateResponse ConnectionFromClient::set_certificate(u64 request_id, ByteString certificate, ByteString key)
 {
     (void)request_id;
@@ -350,6 +470,22 @@ void ConnectionFromClient::remove_cache_entries_accessed_since(UnixDateTime sinc
 {
     if (m_disk_cache.has_value())
         m_disk_cache->remove_entries_accessed_since(since);
+
+    TLSSessionCache::the().remove_persisted_sessions();
+    Resolver::remove_persisted_cache();
+
+    // NB: Like TLS sessions, Alt-Svc advertisements are not tracked by access time, so they are all removed.
+    (void)Core::System::unlink(m_alt_svc_cache_path);
+}
+
+void ConnectionFromClient::set_tracing_enabled(bool enabled)
+{
+    Core::Tracing::set_enabled(enabled);
+}
+
+Messages::RequestServer::TakeTraceEventsResponse ConnectionFromClient::take_trace_events()
+{
+    return Core::Tracing::take_events_as_json();
 }
 
 void ConnectionFromClient::websocket_connect(u64 websocket_id, URL::URL url, ByteString origin, Vector<ByteString> protocols, Vector<ByteString> extensions, Vector<HTTP::Header> additional_request_headers)
@@ -371,6 +507,10 @@ void ConnectionFromClient::websocket_connect(u64 websocket_id, URL::URL url, Byt
             WebSocket::ConnectionInfo connection_info(move(url));
             connection_info.set_origin(move(origin));
             connection_info.set_protocols(move(protocols));
+
+            // NB: LibWebSocket implements permessage-deflate itself, so we can offer it on every connection.
+            if (!extensions.contains_slow(WebSocket::PerMessageDeflate::extension_name))
+                extensions.append(WebSocket::PerMessageDeflate::extension_name);
             connection_info.set_extensions(move(extensions));
             connection_info.set_headers(HTTP::HeaderList::create(move(additional_request_headers)));
             connection_info.set_dns_result(move(dns_result));
@@ -12,8 +12,10 @@
 #include <LibHTTP/Cache/DiskCacheSettings.h>
 #include <LibHTTP/Forward.h>
 #include <LibIPC/ConnectionFromClient.h>
+#include <LibURL/Origin.h>
 #include <LibWebSocket/WebSocket.h>
 #include <RequestServer/Forward.h>
+#include <RequestServer/RequestPriority.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
@@ -37,6 +39,8 @@ public:
 
     static Optional<ConnectionFromClient&> primary_connection();
 
+    ByteString const& alt_svc_cache_path() const { return m_alt_svc_cache_path; }
+
     void start_revalidation_request(Badge<Request>, ByteString method, URL::URL, NonnullRefPtr<HTTP::HeaderList> request_headers, ByteBuffer request_body, HTTP::Cookie::IncludeCredentials, Core::ProxyData proxy_data);
     void request_complete(Badge<Request>, Request const&);
 
@@ -52,8 +56,10 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(u64 request_id, ByteString, URL::URL, Vector<HTTP::Header>, ByteBuffer, HTTP::CacheMode, HTTP::Cookie::IncludeCredentials, Core::ProxyData) override;
+    virtual void start_request(u64 request_id, ByteString, URL::URL, Vector<HTTP::Header>, ByteBuffer, HTTP::CacheMode, HTTP::Cookie::IncludeCredentials, Core::ProxyData, ::RequestServer::RequestPriority) override;
+    virtual void start_requests(Vector<HTTP::Header> header_table, Vector<Requests::BatchedRequest> requests) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(u64 request_id) override;
+    virtual void set_request_priority(u64 request_id, ::RequestServer::RequestPriority) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(u64 request_id, ByteString, ByteString) override;
     virtual void ensure_connection(u64 request_id, URL::URL url, ::RequestServer::CacheLevel cache_level) override;
 
@@ -62,6 +68,9 @@ private:
     virtual void estimate_cache_size_accessed_since(u64 cache_size_estimation_id, UnixDateTime since) override;
     virtual void remove_cache_entries_accessed_since(UnixDateTime since) override;
 
+    virtual void set_tracing_enabled(bool) override;
+    virtual Messages::RequestServer::TakeTraceEventsResponse take_trace_events() override;
+
     virtual void websocket_connect(u64 websocket_id, URL::URL, ByteString, Vector<ByteString>, Vector<ByteString>, Vector<HTTP::Header>) override;
     virtual void websocket_send(u64 websocket_id, bool, ByteBuffer) override;
     virtual void websocket_close(u64 websocket_id, u16, ByteString) override;
@@ -73,6 +82,20 @@ private:
 
     ErrorOr<IPC::TransportHandle> create_client_socket();
 
+    struct PendingRequest {
+        u64 request_id { 0 };
+        ByteString method;
+        URL::URL url;
+        Vector<HTTP::Header> request_headers;
+        ByteBuffer request_body;
+        HTTP::CacheMode cache_mode { HTTP::CacheMode::Default };
+        HTTP::Cookie::IncludeCredentials include_credentials { HTTP::Cookie::IncludeCredentials::Yes };
+        Core::ProxyData proxy_data;
+        RequestPriority priority { RequestPriority::Medium };
+    };
+    void start_pending_request(PendingRequest);
+    void release_delayable_request_slot(u64 request_id);
+
     ConnectionMap& m_connections;
     Optional<HTTP::DiskCache&> m_disk_cache;
 
@@ -80,6 +103,13 @@ private:
 
     HashMap<u64, NonnullOwnPtr<Request>> m_active_requests;
     HashMap<u64, NonnullOwnPtr<Request>> m_active_revalidation_requests;
+
+    // Requests below high priority are delayable: only a few of them are in flight to an origin at once, so that they
+    // don't compete with requests for the stylesheets, scripts and fonts the page needs first. The rest wait here, and
+    // are started in order of priority as the in-flight ones complete.
+    Vector<PendingRequest> m_delayed_requests;
+    HashMap<u64, URL::Origin> m_in_flight_delayable_request_origins;
+    HashMap<URL::Origin, size_t> m_in_flight_delayable_request_count_by_origin;
     HashMap<u64, RefPtr<WebSocket::WebSocket>> m_websockets;
 
     RefPtr<Core::Timer> m_timer;
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <RequestServer/ContentDecoder.h>
+
+#include <zstd.h>
+
+namespace RequestServer {
+
+// https://www.rfc-editor.org/rfc/rfc9842#name-dictionary-compressed-zstan
+static constexpr Array<u8, 8> DICTIONARY_COMPRESSED_ZSTD_MAGIC { 0x5e, 0x2a, 0x4d, 0x18, 0x20, 0x00, 0x00, 0x00 };
+static constexpr size_t DICTIONARY_COMPRESSED_ZSTD_HEADER_SIZE = DICTIONARY_COMPRESSED_ZSTD_MAGIC.size() + 32;
+
+// Servers may compress dictionary-compressed responses with windows of up to 128 MiB, which is also the largest window
+// that other Zstandard decoders accept by default.
+static constexpr int MAXIMUM_WINDOW_LOG = 27;
+
+static Error zstd_error(size_t result)
+{
+    auto const* message = ZSTD_getErrorName(result);
+    return Error::from_string_view({ message, strlen(message) });
+}
+
+static ErrorOr<ZSTD_DCtx*> create_zstd_context()
+{
+    auto* context = ZSTD_createDCtx();
+    if (!context)
+        return Error::from_errno(ENOMEM);
+
+    if (auto result = ZSTD_DCtx_setParameter(context, ZSTD_d_windowLogMax, MAXIMUM_WINDOW_LOG); ZSTD_isError(result)) {
+        ZSTD_freeDCtx(context);
+        return zstd_error(result);
+    }
+
+    return context;
+}
+
+ErrorOr<NonnullOwnPtr<ContentDecoder>> ContentDecoder::create_for_zstd()
+{
+    auto* context = TRY(create_zstd_context());
+    return adopt_nonnull_own_or_enomem(new (nothrow) ContentDecoder(context, {}, {}));
+}
+
+ErrorOr<NonnullOwnPtr<ContentDecoder>> ContentDecoder::create_for_dictionary_compressed_zstd(ByteBuffer dictionary, ByteString dictionary_hash)
+{
+    auto* context = TRY(create_zstd_context());
+    return adopt_nonnull_own_or_enomem(new (nothrow) ContentDecoder(context, move(dictionary), move(dictionary_hash)));
+}
+
+ContentDecoder::ContentDecoder(ZSTD_DCtx* context, ByteBuffer dictionary, Optional<ByteString> dictionary_hash)
+    : m_context(context)
+    , m_dictionary(move(dictionary))
+    , m_dictionary_hash(move(dictionary_hash))
+{
+}
+
+ContentDecoder::~ContentDecoder()
+{
+    ZSTD_freeDCtx(m_context);
+}
+
+ErrorOr<void> ContentDecoder::decode(ReadonlyBytes data, OnDecodedData const& on_decoded_data)
+{
+    if (m_dictionary_hash.has_value()) {
+        TRY(decode_dictionary_compressed_header(data));
+        if (data.is_empty())
+            return {};
+    }
+
+    if (m_output_buffer.is_empty())
+        m_output_buffer = TRY(ByteBuffer::create_uninitialized(ZSTD_DStreamOutSize()));
+
+    ZSTD_inBuffer input { data.data(), data.size(), 0 };
+
+    while (true) {
+        // NB: The dictionary is referenced as a raw prefix, which only applies to the frame that follows it.
+        if (!m_is_within_frame && !m_dictionary.is_empty()) {
+            if (auto result = ZSTD_DCtx_refPrefix(m_context, m_dictionary.data(), m_dictionary.size()); ZSTD_isError(result))
+                return zstd_error(result);
+        }
+
+        ZSTD_outBuffer output { m_output_buffer.data(), m_output_buffer.size(), 0 };
+
+        auto result = ZSTD_decompressStream(m_context, &output, &input);
+        if (ZSTD_isError(result))
+            return zstd_error(result);
+
+        m_is_within_frame = result != 0;
+
+        if (output.pos != 0)
+            TRY(on_decoded_data(m_output_buffer.bytes().trim(output.pos)));
+
+        // The decoder may be holding on to more decoded data if it filled the output buffer.
+        if (input.pos == input.size && output.pos < output.size)
+            break;
+    }
+
+    return {};
+}
+
+ErrorOr<void> ContentDecoder::decode_dictionary_compressed_header(ReadonlyBytes& data)
+{
+    auto header_bytes = data.trim(DICTIONARY_COMPRESSED_ZSTD_HEADER_SIZE - m_dictionary_compressed_header.size());
+    TRY(m_dictionary_compressed_header.try_append(header_bytes));
+    data = data.slice(header_bytes.size());
+
+    if (m_dictionary_compressed_header.size() < DICTIONARY_COMPRESSED_ZSTD_HEADER_SIZE)
+        return {};
+
+    auto header = m_dictionary_compressed_header.bytes();
+
+    if (header.trim(DICTIONARY_COMPRESSED_ZSTD_MAGIC.size()) != DICTIONARY_COMPRESSED_ZSTD_MAGIC.span())
+        return Error::from_string_literal("Invalid dictionary-compressed Zstandard header");
+    if (header.slice(DICTIONARY_COMPRESSED_ZSTD_MAGIC.size()) != m_dictionary_hash->bytes())
+        return Error::from_string_literal("Response was compressed with a different dictionary");
+
+    m_dictionary_hash.clear();
+    return {};
+}
+
+ErrorOr<void> ContentDecoder::finish() const
+{
+    if (m_dictionary_hash.has_value())
+        return Error::from_string_literal("Dictionary-compressed Zstandard header is incomplete");
+    if (m_is_within_frame)
+        return Error::from_string_literal("Zstandard frame is incomplete");
+    return {};
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+
+extern "C" {
+typedef struct ZSTD_DCtx_s ZSTD_DCtx;
+}
+
+namespace RequestServer {
+
+// Decodes the content codings that curl cannot decode for us, as response data arrives.
+class ContentDecoder {
+    AK_MAKE_NONCOPYABLE(ContentDecoder);
+    AK_MAKE_NONMOVABLE(ContentDecoder);
+
+public:
+    // https://www.rfc-editor.org/rfc/rfc8878
+    static ErrorOr<NonnullOwnPtr<ContentDecoder>> create_for_zstd();
+
+    // https://www.rfc-editor.org/rfc/rfc9842#name-dictionary-compressed-zstan
+    static ErrorOr<NonnullOwnPtr<ContentDecoder>> create_for_dictionary_compressed_zstd(ByteBuffer dictionary, ByteString dictionary_hash);
+
+    ~ContentDecoder();
+
+    using OnDecodedData = Function<ErrorOr<void>(ReadonlyBytes)>;
+    ErrorOr<void> decode(ReadonlyBytes, OnDecodedData const&);
+
+    // Returns an error if the encoded data ended in the middle of a frame.
+    ErrorOr<void> finish() const;
+
+private:
+    ContentDecoder(ZSTD_DCtx*, ByteBuffer dictionary, Optional<ByteString> dictionary_hash);
+
+    ErrorOr<void> decode_dictionary_compressed_header(ReadonlyBytes&);
+
+    ZSTD_DCtx* m_context { nullptr };
+
+    // NB: The context only references the dictionary, so it must outlive the context.
+    ByteBuffer m_dictionary;
+
+    // Dictionary-compressed data begins with a header containing the hash of the dictionary it was compressed with.
+    Optional<ByteString> m_dictionary_hash;
+    ByteBuffer m_dictionary_compressed_header;
+
+    ByteBuffer m_output_buffer;
+    bool m_is_within_frame { false };
+};
+
+}
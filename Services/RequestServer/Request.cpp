@@ -6,9 +6,11 @@
  */
 
 #include <AK/GenericShorthands.h>
+#include <LibCore/EventLoop.h>
 #include <LibCore/File.h>
 #include <LibCore/MimeData.h>
 #include <LibCore/Notifier.h>
+#include <LibCore/Tracing.h>
 #include <LibHTTP/Cache/DiskCache.h>
 #include <LibHTTP/Cache/Utilities.h>
 #include <LibHTTP/Status.h>
@@ -18,12 +20,65 @@
 #include <RequestServer/Request.h>
 #include <RequestServer/Resolver.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
+#include <RequestServer/TLSSessionCache.h>
 
 namespace RequestServer {
 
 extern OwnPtr<ResourceSubstitutionMap> g_resource_substitution_map;
 
 static long s_connect_timeout_seconds = 90L;
+static HTTP3Mode s_http3_mode = HTTP3Mode::AltSvc;
+
+void set_http3_mode(HTTP3Mode http3_mode)
+{
+    s_http3_mode = http3_mode;
+}
+
+// NB: Preconnects must make the same choice of HTTP version as the requests that follow them, otherwise curl will not
+//     reuse the connections that they establish.
+template<typename SetOption>
+static void set_http_version_options(SetOption const& set_option, URL::URL const& url, ByteString const& alt_svc_cache_path)
+{
+    set_option(CURLOPT_ALTSVC, alt_svc_cache_path.characters());
+
+    switch (s_http3_mode) {
+    case HTTP3Mode::Disabled:
+        set_option(CURLOPT_ALTSVC_CTRL, static_cast<long>(CURLALTSVC_H1 | CURLALTSVC_H2));
+        break;
+    case HTTP3Mode::AltSvc:
+        set_option(CURLOPT_ALTSVC_CTRL, static_cast<long>(CURLALTSVC_H1 | CURLALTSVC_H2 | CURLALTSVC_H3));
+        break;
+    case HTTP3Mode::Enabled:
+        set_option(CURLOPT_ALTSVC_CTRL, static_cast<long>(CURLALTSVC_H1 | CURLALTSVC_H2 | CURLALTSVC_H3));
+
+        // curl attempts QUIC first, and starts a TCP connection as well if QUIC has not succeeded after a short delay.
+        // Whichever connects first is used. HTTP/3 is only ever used over TLS, so there's nothing to race otherwise.
+        if (url.scheme() == "https"sv)
+            set_option(CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_3));
+        break;
+    }
+}
+
+// Mapping a cached response is only cheaper than copying it through the request pipe once it spans a few pages.
+static constexpr u64 minimum_cached_response_size_for_mapping = 64 * KiB;
+
+// HTTP/2 servers share the connection's bandwidth between streams in proportion to their weights (1 to 256).
+static long http2_stream_weight_for_priority(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Highest:
+        return 256;
+    case RequestPriority::High:
+        return 220;
+    case RequestPriority::Medium:
+        return 147;
+    case RequestPriority::Low:
+        return 64;
+    case RequestPriority::Lowest:
+        return 1;
+    }
+    VERIFY_NOT_REACHED();
+}
 
 NonnullOwnPtr<Request> Request::fetch(
     u64 request_id,
@@ -38,9 +93,10 @@ NonnullOwnPtr<Request> Request::fetch(
     ByteBuffer request_body,
     HTTP::Cookie::IncludeCredentials include_credentials,
     ByteString alt_svc_cache_path,
-    Core::ProxyData proxy_data)
+    Core::ProxyData proxy_data,
+    RequestPriority priority)
 {
-    auto request = adopt_own(*new Request { request_id, Type::Fetch, disk_cache, cache_mode, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), include_credentials, move(alt_svc_cache_path), proxy_data });
+    auto request = adopt_own(*new Request { request_id, Type::Fetch, disk_cache, cache_mode, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), include_credentials, move(alt_svc_cache_path), proxy_data, priority });
     request->process();
 
     return request;
@@ -82,7 +138,7 @@ NonnullOwnPtr<Request> Request::revalidate(
     ByteString alt_svc_cache_path,
     Core::ProxyData proxy_data)
 {
-    auto request = adopt_own(*new Request { request_id, Type::BackgroundRevalidation, disk_cache, HTTP::CacheMode::Default, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), include_credentials, move(alt_svc_cache_path), proxy_data });
+    auto request = adopt_own(*new Request { request_id, Type::BackgroundRevalidation, disk_cache, HTTP::CacheMode::Default, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), include_credentials, move(alt_svc_cache_path), proxy_data, RequestPriority::Lowest });
     request->process();
 
     return request;
@@ -102,9 +158,11 @@ Request::Request(
     ByteBuffer request_body,
     HTTP::Cookie::IncludeCredentials include_credentials,
     ByteString alt_svc_cache_path,
-    Core::ProxyData proxy_data)
+    Core::ProxyData proxy_data,
+    RequestPriority priority)
     : m_request_id(request_id)
     , m_type(type)
+    , m_priority(priority)
     , m_disk_cache(disk_cache)
     , m_cache_mode(cache_mode)
     , m_client(client)
@@ -159,6 +217,17 @@ Request::~Request()
         else
             m_cache_entry_writer->remove_incomplete_entry();
     }
+
+    // If we were cancelled before the response was complete, the requests following us will never receive the rest of
+    // it. We defer informing them, as we may be destroyed along with their client connection.
+    if (!m_following_requests.is_empty()) {
+        Core::deferred_invoke([following_requests = move(m_following_requests)]() {
+            for (auto const& request : following_requests) {
+                if (request)
+                    request->notify_followed_request_complete({}, Requests::NetworkError::IncompleteContent);
+            }
+        });
+    }
 }
 
 void Request::notify_request_unblocked(Badge<HTTP::DiskCache>)
@@ -168,6 +237,45 @@ void Request::notify_request_unblocked(Badge<HTTP::DiskCache>)
     transition_to_state(State::Init);
 }
 
+void Request::notify_following_request(Badge<Request>, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderList const& response_headers)
+{
+    VERIFY(m_state == State::WaitForCache);
+
+    m_status_code = status_code;
+    m_reason_phrase = move(reason_phrase);
+    m_response_headers = HTTP::HeaderList::create(response_headers.headers());
+
+    transition_to_state(State::FollowRequest);
+}
+
+void Request::notify_followed_request_received_data(Badge<Request>, ReadonlyBytes bytes)
+{
+    if (m_state != State::FollowRequest)
+        return;
+
+    if (auto result = receive_response_data(bytes); result.is_error()) {
+        dbgln("Request::notify_followed_request_received_data: Error occurred whilst writing data to the client: {}", result.error());
+        transition_to_state(State::Error);
+    }
+}
+
+void Request::notify_followed_request_complete(Badge<Request>, Optional<Requests::NetworkError> network_error)
+{
+    if (m_state != State::FollowRequest)
+        return;
+
+    if (network_error.has_value()) {
+        m_network_error = network_error;
+        transition_to_state(State::Error);
+        return;
+    }
+
+    m_curl_result_code = CURLE_OK;
+
+    if (m_response_buffer.is_eof())
+        transition_to_state(State::Complete);
+}
+
 void Request::notify_retrieved_http_cookie(Badge<ConnectionFromClient>, StringView cookie)
 {
     if (!cookie.is_empty()) {
@@ -196,6 +304,15 @@ void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code
         transfer_headers_to_client_if_needed();
     }
 
+    if (m_content_decoding_failed) {
+        result_code = CURLE_BAD_CONTENT_ENCODING;
+    } else if (m_content_decoder && result_code == CURLE_OK) {
+        if (auto result = m_content_decoder->finish(); result.is_error()) {
+            dbgln("Request::notify_fetch_complete: Unable to decode response content: {}", result.error());
+            result_code = CURLE_BAD_CONTENT_ENCODING;
+        }
+    }
+
     m_curl_result_code = result_code;
 
     if (m_response_buffer.is_eof())
@@ -205,7 +322,15 @@ void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code
 void Request::transition_to_state(State state)
 {
     dbgln_if(REQUESTSERVER_DEBUG, "Request::Transition[{}]: {} -> {} ({} {})", m_request_id, state_name(m_state), state_name(state), m_method, m_url);
+
+    auto now = MonotonicTime::now();
+    if (Core::Tracing::is_enabled()) [[unlikely]] {
+        // NB: The state names are string literals, so they live long enough to be recorded.
+        Core::Tracing::record_async_event("network", state_name(m_state).characters_without_null_termination(), m_request_id, m_state_start_time.nanoseconds(), now.nanoseconds());
+    }
+
     m_state = state;
+    m_state_start_time = now;
     process();
 }
 
@@ -221,6 +346,9 @@ void Request::process()
     case State::WaitForCache:
         // Do nothing; we are waiting for the disk cache to notify us to proceed.
         break;
+    case State::FollowRequest:
+        handle_follow_request_state();
+        break;
     case State::FailedCacheOnly:
         handle_failed_cache_only_state();
         break;
@@ -330,6 +458,25 @@ void Request::handle_read_cache_state()
         return;
     transfer_headers_to_client_if_needed();
 
+    if (m_cache_entry_reader->data_size() >= minimum_cached_response_size_for_mapping) {
+        // Let the client map the response from the cache file itself, so that it can read it without any copies.
+        auto data = m_cache_entry_reader->release_data_for_mapping();
+        m_cache_entry_reader.clear();
+
+        if (data.is_error()) {
+            m_network_error = Requests::NetworkError::CacheReadFailed;
+            transition_to_state(State::Error);
+            return;
+        }
+
+        m_client.async_cached_response_available(m_request_id, IPC::File::adopt_fd(data.value().fd), data.value().offset, data.value().size);
+
+        m_bytes_transferred_to_client = data.value().size;
+        m_curl_result_code = CURLE_OK;
+        transition_to_state(State::Complete);
+        return;
+    }
+
     m_cache_entry_reader->send_to(
         m_client_request_pipe->writer_fd(),
         weak_callback(*this, [](auto& self, auto bytes_sent) {
@@ -346,6 +493,19 @@ void Request::handle_read_cache_state()
         }));
 }
 
+void Request::handle_follow_request_state()
+{
+    // The response is being written to the cache entry we were waiting for, and would satisfy our request as though we
+    // had read it from that entry.
+    m_cache_status = CacheStatus::ReadFromCache;
+
+    if (inform_client_request_started().is_error())
+        return;
+    transfer_headers_to_client_if_needed();
+
+    // The response data will now arrive as the request we are following receives it.
+}
+
 void Request::handle_failed_cache_only_state()
 {
     if (m_cache_mode == HTTP::CacheMode::OnlyIfCached) {
@@ -435,7 +595,9 @@ void Request::handle_dns_lookup_state()
     auto host = m_url.serialized_host().to_byte_string();
     auto const& dns_info = DNSInfo::the();
 
-    m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = dns_info.validate_dnssec_locally })
+    // NB: The A and AAAA records are looked up with separate queries at the same time, as most servers don't answer
+    //     queries with several questions. curl then races connections to the addresses of both families.
+    m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { { DNS::Messages::ResourceType::A }, { DNS::Messages::ResourceType::AAAA } }, { .validate_dnssec_locally = dns_info.validate_dnssec_locally })
         ->when_rejected(weak_callback(*this, [host](auto& self, auto const& error) {
             dbgln("Request::handle_dns_lookup_state: DNS lookup failed for '{}': {}", host, error);
             self.m_network_error = Requests::NetworkError::UnableToResolveHost;
@@ -491,6 +653,8 @@ void Request::handle_connect_state()
     set_option(CURLOPT_PORT, m_url.port_or_default());
     set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
     set_option(CURLOPT_CONNECT_ONLY, 1L);
+    set_option(CURLOPT_SHARE, TLSSessionCache::the().share_handle());
+    set_http_version_options(set_option, m_url, m_client.alt_svc_cache_path());
 
     auto result = curl_multi_add_handle(m_curl_multi_handle, m_curl_easy_handle);
     VERIFY(result == CURLM_OK);
@@ -526,12 +690,23 @@ void Request::handle_fetch_state()
     if (auto const& path = default_certificate_path(); !path.is_empty())
         set_option(CURLOPT_CAINFO, path.characters());
 
-    set_option(CURLOPT_ACCEPT_ENCODING, ""); // Empty string lets curl define the accepted encodings.
+    if (m_disk_cache.has_value() && !m_request_headers->contains("Accept-Encoding"sv))
+        m_available_dictionary = m_disk_cache->find_compression_dictionary(m_url, m_request_headers);
+
+    // curl is unable to decode responses that were compressed with a dictionary. So if we advertise a dictionary, we
+    // only accept the content codings that we are able to decode ourselves.
+    if (m_available_dictionary.has_value())
+        set_option(CURLOPT_HTTP_CONTENT_DECODING, 0L);
+    else
+        set_option(CURLOPT_ACCEPT_ENCODING, ""); // Empty string lets curl define the accepted encodings.
+
     set_option(CURLOPT_URL, m_url.to_byte_string().characters());
     set_option(CURLOPT_PORT, m_url.port_or_default());
     set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
     set_option(CURLOPT_PIPEWAIT, 1L);
-    set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path.characters());
+    set_http_version_options(set_option, m_url, m_alt_svc_cache_path);
+    set_option(CURLOPT_SHARE, TLSSessionCache::the().share_handle());
+    set_option(CURLOPT_STREAM_WEIGHT, http2_stream_weight_for_priority(m_priority));
 
     set_option(CURLOPT_CUSTOMREQUEST, m_method.characters());
     set_option(CURLOPT_FOLLOWLOCATION, 0);
@@ -572,6 +747,19 @@ void Request::handle_fetch_state()
         }
     }
 
+    if (m_available_dictionary.has_value()) {
+        auto append_header = [&](StringView name, StringView value) {
+            auto header_string = ByteString::formatted("{}: {}", name, value);
+            curl_headers = curl_slist_append(curl_headers, header_string.characters());
+        };
+
+        append_header("Accept-Encoding"sv, ByteString::formatted("{}, zstd", HTTP::DICTIONARY_COMPRESSED_ZSTD_ENCODING));
+        append_header(HTTP::AVAILABLE_DICTIONARY_HEADER, m_available_dictionary->available_dictionary_header_value());
+
+        if (!m_available_dictionary->id.is_empty())
+            append_header(HTTP::DICTIONARY_ID_HEADER, m_available_dictionary->dictionary_id_header_value());
+    }
+
     if (is_revalidation_request) {
         auto revalidation_attributes = HTTP::RevalidationAttributes::create(m_cache_entry_reader->response_headers());
         VERIFY(revalidation_attributes.etag.has_value() || revalidation_attributes.last_modified.has_value());
@@ -645,6 +833,7 @@ void Request::handle_complete_state()
         m_client.async_request_finished(m_request_id, m_bytes_transferred_to_client, timing_info, m_network_error);
     }
 
+    notify_following_requests_of_completion();
     m_client.request_complete({}, *this);
 }
 
@@ -655,6 +844,7 @@ void Request::handle_error_state()
         m_client.async_request_finished(m_request_id, m_bytes_transferred_to_client, {}, m_network_error.value_or(Requests::NetworkError::Unknown));
     }
 
+    notify_following_requests_of_completion();
     m_client.request_complete({}, *this);
 }
 
@@ -713,17 +903,43 @@ size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void*
                 });
     }
 
+    if (request.m_available_dictionary.has_value() && !exchange(request.m_created_content_decoder, true)) {
+        if (auto result = request.create_content_decoder(); result.is_error()) {
+            dbgln("Request::on_data_received: Aborting request because the response content cannot be decoded: {}", result.error());
+            request.m_content_decoding_failed = true;
+            return CURL_WRITEFUNC_ERROR;
+        }
+    }
+
     request.transfer_headers_to_client_if_needed();
 
     auto total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
-    auto result = [&] -> ErrorOr<void> {
-        TRY(request.m_response_buffer.write_some(bytes));
-        return request.write_queued_bytes_without_blocking();
-    }();
+    if (request.m_content_decoder) {
+        bool failed_to_write_to_client = false;
 
-    if (result.is_error()) {
+        auto result = request.m_content_decoder->decode(bytes, [&](ReadonlyBytes decoded_bytes) -> ErrorOr<void> {
+            auto result = request.receive_response_data(decoded_bytes);
+            failed_to_write_to_client = result.is_error();
+            return result;
+        });
+
+        if (result.is_error()) {
+            if (failed_to_write_to_client) {
+                dbgln("Request::on_data_received: Aborting request because error occurred whilst writing data to the client: {}", result.error());
+            } else {
+                dbgln("Request::on_data_received: Aborting request because the response content cannot be decoded: {}", result.error());
+                request.m_content_decoding_failed = true;
+            }
+
+            return CURL_WRITEFUNC_ERROR;
+        }
+
+        return total_size;
+    }
+
+    if (auto result = request.receive_response_data(bytes); result.is_error()) {
         dbgln("Request::on_data_received: Aborting request because error occurred whilst writing data to the client: {}", result.error());
         return CURL_WRITEFUNC_ERROR;
     }
@@ -731,6 +947,44 @@ size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void*
     return total_size;
 }
 
+ErrorOr<void> Request::create_content_decoder()
+{
+    auto content_encoding = m_response_headers->get("Content-Encoding"sv);
+    if (!content_encoding.has_value())
+        return {};
+
+    auto encoding = content_encoding->view().trim_whitespace();
+
+    if (encoding.equals_ignoring_ascii_case(HTTP::DICTIONARY_COMPRESSED_ZSTD_ENCODING)) {
+        auto dictionary = TRY(m_disk_cache->read_compression_dictionary(*m_available_dictionary));
+        m_content_decoder = TRY(ContentDecoder::create_for_dictionary_compressed_zstd(move(dictionary), m_available_dictionary->hash));
+    } else if (encoding.equals_ignoring_ascii_case("zstd"sv)) {
+        m_content_decoder = TRY(ContentDecoder::create_for_zstd());
+    } else if (!encoding.equals_ignoring_ascii_case("identity"sv)) {
+        return Error::from_string_literal("Response uses a content coding that was not requested");
+    }
+
+    return {};
+}
+
+ErrorOr<void> Request::receive_response_data(ReadonlyBytes bytes)
+{
+    // OPTIMIZATION: If nothing is queued for the client, send the data straight from curl's buffer, and only queue
+    //               whatever the client pipe could not take.
+    if (m_type != Type::BackgroundRevalidation && m_response_buffer.is_eof()) {
+        auto bytes_sent = TRY(write_bytes_to_client_without_blocking(bytes));
+        if (bytes_sent == bytes.size())
+            return {};
+
+        TRY(m_response_buffer.write_some(bytes.slice(bytes_sent)));
+        m_client_writer_notifier->set_enabled(true);
+        return {};
+    }
+
+    TRY(m_response_buffer.write_some(bytes));
+    return write_queued_bytes_without_blocking();
+}
+
 ErrorOr<void> Request::inform_client_request_started()
 {
     if (m_type == Type::BackgroundRevalidation)
@@ -764,6 +1018,7 @@ void Request::transfer_headers_to_client_if_needed()
             m_cache_entry_writer.clear();
         } else {
             m_cache_status = CacheStatus::WrittenToCache;
+            attach_following_requests();
         }
     }
 
@@ -789,32 +1044,55 @@ void Request::transfer_headers_to_client_if_needed()
     m_client.async_headers_became_available(m_request_id, m_response_headers->headers(), m_status_code, m_reason_phrase);
 }
 
+// The most we send to the client in one write. This matches the size of the client pipe's socket buffer, so copying
+// more of the queued data at once would not let us send any more of it.
+static constexpr size_t maximum_client_write_size = 512 * KiB;
+
 ErrorOr<void> Request::write_queued_bytes_without_blocking()
 {
-    Vector<u8> bytes_to_send;
-    bytes_to_send.resize(m_response_buffer.used_buffer_size());
-    m_response_buffer.peek_some(bytes_to_send);
-
-    auto write_bytes_to_disk_cache = [&](size_t byte_count) {
-        if (!m_cache_entry_writer.has_value())
-            return;
-
-        auto bytes_to_write = bytes_to_send.span().slice(0, byte_count);
-
-        if (m_cache_entry_writer->write_data(bytes_to_write).is_error())
-            m_cache_entry_writer.clear();
+    // NB: The queued data is copied out in bounded pieces into a buffer that is reused across writes, rather than all
+    //     at once into a new buffer for every write, which made draining a large backlog quadratic.
+    auto peek_queued_bytes = [&] {
+        m_client_write_buffer.resize(min(m_response_buffer.used_buffer_size(), maximum_client_write_size));
+        m_response_buffer.peek_some(m_client_write_buffer.bytes());
+        return m_client_write_buffer.bytes();
     };
 
     if (m_type == Type::BackgroundRevalidation) {
-        write_bytes_to_disk_cache(bytes_to_send.size());
-        MUST(m_response_buffer.discard(bytes_to_send.size()));
+        while (!m_response_buffer.is_eof()) {
+            auto bytes_to_write = peek_queued_bytes();
+            write_bytes_to_disk_cache(bytes_to_write);
+            write_bytes_to_following_requests(bytes_to_write);
+            MUST(m_response_buffer.discard(bytes_to_write.size()));
+        }
 
-        if (m_response_buffer.is_eof() && m_curl_result_code.has_value())
+        if (m_curl_result_code.has_value())
             transition_to_state(State::Complete);
 
         return {};
     }
 
+    while (!m_response_buffer.is_eof()) {
+        auto bytes_to_send = peek_queued_bytes();
+
+        auto bytes_sent = TRY(write_bytes_to_client_without_blocking(bytes_to_send));
+        MUST(m_response_buffer.discard(bytes_sent));
+
+        // The client pipe is full, so wait until the client has read from it.
+        if (bytes_sent < bytes_to_send.size())
+            break;
+    }
+
+    if (m_client_writer_notifier)
+        m_client_writer_notifier->set_enabled(!m_response_buffer.is_eof());
+    if (m_response_buffer.is_eof() && m_curl_result_code.has_value())
+        transition_to_state(State::Complete);
+
+    return {};
+}
+
+ErrorOr<size_t> Request::write_bytes_to_client_without_blocking(ReadonlyBytes bytes)
+{
     if (!m_client_writer_notifier) {
         m_client_writer_notifier = Core::Notifier::construct(m_client_request_pipe->writer_fd(), Core::NotificationType::Write);
         m_client_writer_notifier->set_enabled(false);
@@ -825,25 +1103,63 @@ ErrorOr<void> Request::write_queued_bytes_without_blocking()
         });
     }
 
-    auto result = m_client_request_pipe->write(bytes_to_send);
+    auto result = m_client_request_pipe->write(bytes);
     if (result.is_error()) {
         if (!first_is_one_of(result.error().code(), EAGAIN, EWOULDBLOCK))
             return result.release_error();
-
-        m_client_writer_notifier->set_enabled(true);
-        return {};
+        return 0;
     }
 
-    write_bytes_to_disk_cache(result.value());
-    MUST(m_response_buffer.discard(result.value()));
-
+    write_bytes_to_disk_cache(bytes.trim(result.value()));
+    write_bytes_to_following_requests(bytes.trim(result.value()));
     m_bytes_transferred_to_client += result.value();
 
-    m_client_writer_notifier->set_enabled(!m_response_buffer.is_eof());
-    if (m_response_buffer.is_eof() && m_curl_result_code.has_value())
-        transition_to_state(State::Complete);
+    return result.value();
+}
 
-    return {};
+void Request::write_bytes_to_disk_cache(ReadonlyBytes bytes)
+{
+    if (!m_cache_entry_writer.has_value())
+        return;
+
+    if (m_cache_entry_writer->write_data(bytes).is_error())
+        m_cache_entry_writer.clear();
+}
+
+void Request::attach_following_requests()
+{
+    // OPTIMIZATION: Rather than have other requests for this resource wait until we have written the entire response to
+    //               the disk cache before reading it back, we send them the response as we receive it. This way,
+    //               identical requests that are made at the same time share a single network request.
+    for (auto request : m_disk_cache->take_requests_able_to_follow(*m_cache_entry_writer, m_response_headers)) {
+        // NB: Every cache request in RequestServer is a Request.
+        auto& following_request = static_cast<Request&>(*request);
+
+        m_following_requests.append(following_request.make_weak_ptr<Request>());
+        following_request.notify_following_request({}, *m_status_code, m_reason_phrase, m_response_headers);
+    }
+}
+
+void Request::write_bytes_to_following_requests(ReadonlyBytes bytes)
+{
+    // NB: This writes the same bytes, in the same order, that we write to the disk cache. Following requests therefore
+    //     receive exactly the response they would have read from the cache entry.
+    for (auto const& request : m_following_requests) {
+        if (request)
+            request->notify_followed_request_received_data({}, bytes);
+    }
+}
+
+void Request::notify_following_requests_of_completion()
+{
+    Optional<Requests::NetworkError> network_error;
+    if (m_state != State::Complete || m_curl_result_code != CURLE_OK)
+        network_error = m_network_error.value_or(Requests::NetworkError::IncompleteContent);
+
+    for (auto const& request : exchange(m_following_requests, {})) {
+        if (request)
+            request->notify_followed_request_complete({}, network_error);
+    }
 }
 
 bool Request::is_revalidation_request() const
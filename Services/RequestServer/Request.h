@@ -11,23 +11,35 @@
 #include <AK/MemoryStream.h>
 #include <AK/Optional.h>
 #include <AK/Time.h>
+#include <AK/Vector.h>
+#include <AK/WeakPtr.h>
 #include <LibCore/Proxy.h>
 #include <LibDNS/Resolver.h>
 #include <LibHTTP/Cache/CacheMode.h>
 #include <LibHTTP/Cache/CacheRequest.h>
+#include <LibHTTP/Cache/CompressionDictionary.h>
 #include <LibHTTP/Cookie/IncludeCredentials.h>
 #include <LibHTTP/HeaderList.h>
 #include <LibRequests/NetworkError.h>
 #include <LibRequests/RequestTimingInfo.h>
 #include <LibURL/URL.h>
 #include <RequestServer/CacheLevel.h>
+#include <RequestServer/ContentDecoder.h>
 #include <RequestServer/Forward.h>
 #include <RequestServer/RequestPipe.h>
+#include <RequestServer/RequestPriority.h>
 
 struct curl_slist;
 
 namespace RequestServer {
 
+enum class HTTP3Mode : u8 {
+    Disabled, // Never use HTTP/3.
+    AltSvc,   // Use HTTP/3 with servers that have advertised it with an Alt-Svc response header.
+    Enabled,  // Also attempt HTTP/3 with servers that have not advertised it, racing the attempt against HTTP/2.
+};
+void set_http3_mode(HTTP3Mode);
+
 class Request final : public HTTP::CacheRequest {
 public:
     static NonnullOwnPtr<Request> fetch(
@@ -43,7 +55,8 @@ public:
         ByteBuffer request_body,
         HTTP::Cookie::IncludeCredentials include_credentials,
         ByteString alt_svc_cache_path,
-        Core::ProxyData proxy_data);
+        Core::ProxyData proxy_data,
+        RequestPriority priority);
 
     static NonnullOwnPtr<Request> connect(
         u64 request_id,
@@ -78,8 +91,12 @@ public:
     u64 request_id() const { return m_request_id; }
     Type type() const { return m_type; }
     URL::URL const& url() const { return m_url; }
+    RequestPriority priority() const { return m_priority; }
 
     virtual void notify_request_unblocked(Badge<HTTP::DiskCache>) override;
+    void notify_following_request(Badge<Request>, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderList const& response_headers);
+    void notify_followed_request_received_data(Badge<Request>, ReadonlyBytes);
+    void notify_followed_request_complete(Badge<Request>, Optional<Requests::NetworkError>);
     void notify_retrieved_http_cookie(Badge<ConnectionFromClient>, StringView cookie);
     void notify_fetch_complete(Badge<ConnectionFromClient>, int result_code);
 
@@ -88,6 +105,7 @@ private:
         Init,              // Decide whether to service this request from cache or the network.
         ReadCache,         // Read the cached response from disk.
         WaitForCache,      // Wait for an existing cache entry to complete before proceeding.
+        FollowRequest,     // Stream the response of another request as it writes the cache entry we were waiting for.
         FailedCacheOnly,   // An only-if-cached request failed to find a cache entry.
         ServeSubstitution, // Serve content from a local file substitution.
         DNSLookup,         // Resolve the URL's host.
@@ -107,6 +125,8 @@ private:
             return "ReadCache"sv;
         case State::WaitForCache:
             return "WaitForCache"sv;
+        case State::FollowRequest:
+            return "FollowRequest"sv;
         case State::FailedCacheOnly:
             return "FailedCacheOnly"sv;
         case State::ServeSubstitution:
@@ -141,7 +161,8 @@ private:
         ByteBuffer request_body,
         HTTP::Cookie::IncludeCredentials include_credentials,
         ByteString alt_svc_cache_path,
-        Core::ProxyData proxy_data);
+        Core::ProxyData proxy_data,
+        RequestPriority priority);
 
     Request(
         u64 request_id,
@@ -155,6 +176,7 @@ private:
 
     void handle_initial_state();
     void handle_read_cache_state();
+    void handle_follow_request_state();
     void handle_failed_cache_only_state();
     void handle_serve_substitution_state();
     void handle_dns_lookup_state();
@@ -167,11 +189,21 @@ private:
     static size_t on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data);
     static size_t on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data);
 
+    ErrorOr<void> create_content_decoder();
+    ErrorOr<void> receive_response_data(ReadonlyBytes);
+
     ErrorOr<void> inform_client_request_started();
     void transfer_headers_to_client_if_needed();
     ErrorOr<void> write_queued_bytes_without_blocking();
+    ErrorOr<size_t> write_bytes_to_client_without_blocking(ReadonlyBytes);
+    void write_bytes_to_disk_cache(ReadonlyBytes);
+
+    void attach_following_requests();
+    void write_bytes_to_following_requests(ReadonlyBytes);
+    void notify_following_requests_of_completion();
 
     virtual bool is_revalidation_request() const override;
+    virtual HTTP::HeaderList const& request_headers() const override { return m_request_headers; }
     ErrorOr<void> revalidation_failed();
 
     bool is_cache_only_request() const;
@@ -181,7 +213,9 @@ private:
 
     u64 m_request_id { 0 };
     Type m_type { Type::Fetch };
+    RequestPriority m_priority { RequestPriority::Medium };
     State m_state { State::Init };
+    MonotonicTime m_state_start_time { MonotonicTime::now() };
 
     Optional<HTTP::DiskCache&> m_disk_cache;
     HTTP::CacheMode m_cache_mode { HTTP::CacheMode::Default };
@@ -213,12 +247,23 @@ private:
     NonnullRefPtr<HTTP::HeaderList> m_response_headers;
     bool m_sent_response_headers_to_client { false };
 
+    // When we advertise a compression dictionary, we decode the response ourselves rather than letting curl do so.
+    Optional<HTTP::AvailableDictionary> m_available_dictionary;
+    OwnPtr<ContentDecoder> m_content_decoder;
+    bool m_created_content_decoder { false };
+    bool m_content_decoding_failed { false };
+
     AllocatingMemoryStream m_response_buffer;
+    ByteBuffer m_client_write_buffer;
     RefPtr<Core::Notifier> m_client_writer_notifier;
     Optional<RequestPipe> m_client_request_pipe;
     size_t m_bytes_transferred_to_client { 0 };
 
     Optional<Requests::NetworkError> m_network_error;
+
+    // Requests for the same resource that are served the response we are writing to the disk cache as it arrives,
+    // rather than waiting for the cache entry to be complete.
+    Vector<WeakPtr<Request>> m_following_requests;
 };
 
 }
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace RequestServer {
+
+// How urgently the client needs the response to a request, from most to least urgent.
+enum class RequestPriority : u8 {
+    // Documents, and subresources that block rendering, like stylesheets.
+    Highest,
+    // Fonts, scripts, and requests made by fetch() or XMLHttpRequest.
+    High,
+    // Images and other subresources.
+    Medium,
+    // Async scripts, media, and requests the page marked as low priority.
+    Low,
+    // Speculative requests, like prefetches.
+    Lowest,
+};
+
+}
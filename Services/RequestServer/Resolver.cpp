@@ -5,11 +5,24 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Endian.h>
+#include <AK/MemoryStream.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
 #include <LibTLS/TLSv12.h>
 #include <RequestServer/Resolver.h>
 
 namespace RequestServer {
 
+static constexpr u32 DNS_CACHE_MAGIC = 0x4c42444e; // "LBDN"
+static constexpr u32 DNS_CACHE_VERSION = 1;
+
+static Optional<ByteString> s_persisted_cache_path;
+static WeakPtr<Resolver> s_default_resolver;
+
+static void load_persisted_cache(DNS::Resolver&);
+
 static ByteString g_default_certificate_path;
 
 ByteString const& default_certificate_path()
@@ -30,9 +43,7 @@ DNSInfo& DNSInfo::the()
 
 NonnullRefPtr<Resolver> Resolver::default_resolver()
 {
-    static WeakPtr<Resolver> g_resolver {};
-
-    if (auto resolver = g_resolver.strong_ref())
+    if (auto resolver = s_default_resolver.strong_ref())
         return *resolver;
 
     auto resolver = adopt_ref(*new Resolver([] -> ErrorOr<DNS::Resolver::SocketResult> {
@@ -68,10 +79,129 @@ NonnullRefPtr<Resolver> Resolver::default_resolver()
         };
     }));
 
-    g_resolver = resolver;
+    s_default_resolver = resolver;
+    load_persisted_cache(resolver->dns);
     return resolver;
 }
 
+void Resolver::initialize_persistence(Persistence persistence)
+{
+    if (persistence == Persistence::Enabled)
+        s_persisted_cache_path = ByteString::formatted("{}/Ladybird/dns-cache.bin", Core::StandardPaths::cache_directory());
+    else
+        s_persisted_cache_path.clear();
+}
+
+static void load_persisted_cache(DNS::Resolver& resolver)
+{
+    if (!s_persisted_cache_path.has_value())
+        return;
+
+    auto file = Core::File::open(*s_persisted_cache_path, Core::File::OpenMode::Read);
+    if (file.is_error())
+        return;
+
+    auto contents = file.value()->read_until_eof();
+    if (contents.is_error())
+        return;
+
+    FixedMemoryStream stream { contents.value().bytes() };
+    auto oldest_usable_expiration = UnixDateTime::now() - DNS::LookupResult::max_stale_duration;
+
+    Vector<DNS::Resolver::CachedAddress> addresses;
+    auto result = [&]() -> ErrorOr<void> {
+        if (TRY(stream.read_value<LittleEndian<u32>>()) != DNS_CACHE_MAGIC)
+            return Error::from_string_literal("Magic value mismatch");
+        if (TRY(stream.read_value<LittleEndian<u32>>()) != DNS_CACHE_VERSION)
+            return Error::from_string_literal("Version mismatch");
+
+        while (!stream.is_eof()) {
+            auto expiration = UnixDateTime::from_seconds_since_epoch(static_cast<i64>(TRY(stream.read_value<LittleEndian<u64>>())));
+            auto name = ByteString { TRY(stream.read_in_place<u8 const>(TRY(stream.read_value<LittleEndian<u32>>()))) };
+
+            Variant<IPv4Address, IPv6Address> address = IPv4Address {};
+            switch (TRY(stream.read_value<u8>())) {
+            case 4:
+                address = IPv4Address { TRY(stream.read_in_place<u8 const>(4)).data() };
+                break;
+            case 6: {
+                Array<u8, 16> bytes;
+                TRY(stream.read_until_filled(bytes.span()));
+                address = IPv6Address { bytes };
+                break;
+            }
+            default:
+                return Error::from_string_literal("Invalid address family");
+            }
+
+            if (expiration < oldest_usable_expiration)
+                continue;
+
+            addresses.append({ move(name), address, expiration });
+        }
+
+        return {};
+    }();
+
+    if (result.is_error()) {
+        dbgln("Resolver: Unable to load DNS cache from {}: {}", *s_persisted_cache_path, result.error());
+        return;
+    }
+
+    resolver.add_cached_addresses(addresses);
+}
+
+void Resolver::save_persisted_cache()
+{
+    if (!s_persisted_cache_path.has_value())
+        return;
+
+    auto resolver = s_default_resolver.strong_ref();
+    if (!resolver)
+        return;
+
+    AllocatingMemoryStream stream;
+    auto result = [&]() -> ErrorOr<void> {
+        TRY(stream.write_value<LittleEndian<u32>>(DNS_CACHE_MAGIC));
+        TRY(stream.write_value<LittleEndian<u32>>(DNS_CACHE_VERSION));
+
+        for (auto const& address : resolver->dns.cached_addresses_with_expiration()) {
+            TRY(stream.write_value<LittleEndian<u64>>(static_cast<u64>(address.expiration.seconds_since_epoch())));
+            TRY(stream.write_value<LittleEndian<u32>>(address.name.length()));
+            TRY(stream.write_until_depleted(address.name.bytes()));
+            TRY(address.address.visit(
+                [&](IPv4Address const& ipv4) -> ErrorOr<void> {
+                    TRY(stream.write_value<u8>(4));
+                    // NB: The first octet of the address is held in the lowest byte.
+                    return stream.write_value<LittleEndian<u32>>(ipv4.to_u32());
+                },
+                [&](IPv6Address const& ipv6) -> ErrorOr<void> {
+                    TRY(stream.write_value<u8>(6));
+                    return stream.write_until_depleted({ ipv6.to_in6_addr_t(), sizeof(IPv6Address::in6_addr_t) });
+                }));
+        }
+
+        auto contents = TRY(stream.read_until_eof());
+        auto file = TRY(Core::File::open(*s_persisted_cache_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+        TRY(file->write_until_depleted(contents));
+        return {};
+    }();
+
+    if (result.is_error())
+        dbgln("Resolver: Unable to save DNS cache to {}: {}", *s_persisted_cache_path, result.error());
+}
+
+void Resolver::remove_persisted_cache()
+{
+    if (!s_persisted_cache_path.has_value())
+        return;
+
+    // NB: Like persisted TLS sessions, the addresses that are already in memory remain in use until RequestServer
+    //     exits, but are no longer written to disk.
+    (void)Core::System::unlink(*s_persisted_cache_path);
+    s_persisted_cache_path.clear();
+}
+
 Resolver::Resolver(Function<ErrorOr<DNS::Resolver::SocketResult>()> create_socket)
     : dns(move(create_socket))
 {
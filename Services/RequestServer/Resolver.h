@@ -33,6 +33,16 @@ struct Resolver
     , public Weakable<Resolver> {
     static NonnullRefPtr<Resolver> default_resolver();
 
+    // When persistence is enabled, the addresses in the cache of the default resolver are written to disk when
+    // RequestServer exits, and are used (and revalidated once they've expired) the next time it starts.
+    enum class Persistence {
+        Disabled,
+        Enabled,
+    };
+    static void initialize_persistence(Persistence);
+    static void save_persisted_cache();
+    static void remove_persisted_cache();
+
     DNS::Resolver dns;
 
 private:
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Endian.h>
+#include <AK/MemoryStream.h>
+#include <AK/OwnPtr.h>
+#include <AK/Time.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <RequestServer/CURL.h>
+#include <RequestServer/TLSSessionCache.h>
+
+namespace RequestServer {
+
+static constexpr u32 TLS_SESSION_CACHE_MAGIC = 0x4c425453; // "LBTS"
+static constexpr u32 TLS_SESSION_CACHE_VERSION = 1;
+
+static OwnPtr<TLSSessionCache> s_tls_session_cache;
+
+void TLSSessionCache::initialize(Persistence persistence)
+{
+    VERIFY(!s_tls_session_cache);
+
+    Optional<ByteString> persisted_sessions_path;
+    if (persistence == Persistence::Enabled)
+        persisted_sessions_path = ByteString::formatted("{}/Ladybird/tls-session-cache.bin", Core::StandardPaths::cache_directory());
+
+    s_tls_session_cache = adopt_own(*new TLSSessionCache(move(persisted_sessions_path)));
+}
+
+TLSSessionCache& TLSSessionCache::the()
+{
+    if (!s_tls_session_cache)
+        initialize(Persistence::Disabled);
+    return *s_tls_session_cache;
+}
+
+TLSSessionCache::TLSSessionCache(Optional<ByteString> persisted_sessions_path)
+    : m_share_handle(curl_share_init())
+    , m_persisted_sessions_path(move(persisted_sessions_path))
+{
+    VERIFY(m_share_handle);
+
+    auto result = curl_share_setopt(m_share_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    VERIFY(result == CURLSHE_OK);
+
+    load();
+}
+
+TLSSessionCache::~TLSSessionCache()
+{
+    curl_share_cleanup(m_share_handle);
+}
+
+template<typename Callback>
+static void with_easy_handle_on_share(void* share_handle, Callback callback)
+{
+    auto* easy_handle = curl_easy_init();
+    if (!easy_handle)
+        return;
+
+    if (curl_easy_setopt(easy_handle, CURLOPT_SHARE, share_handle) == CURLE_OK)
+        callback(easy_handle);
+
+    curl_easy_cleanup(easy_handle);
+}
+
+void TLSSessionCache::load()
+{
+    if (!m_persisted_sessions_path.has_value())
+        return;
+
+    auto file = Core::File::open(*m_persisted_sessions_path, Core::File::OpenMode::Read);
+    if (file.is_error())
+        return;
+
+    auto contents = file.value()->read_until_eof();
+    if (contents.is_error())
+        return;
+
+    FixedMemoryStream stream { contents.value().bytes() };
+    auto now = UnixDateTime::now().seconds_since_epoch();
+
+    with_easy_handle_on_share(m_share_handle, [&](CURL* easy_handle) {
+        auto result = [&]() -> ErrorOr<void> {
+            if (TRY(stream.read_value<LittleEndian<u32>>()) != TLS_SESSION_CACHE_MAGIC)
+                return Error::from_string_literal("Magic value mismatch");
+            if (TRY(stream.read_value<LittleEndian<u32>>()) != TLS_SESSION_CACHE_VERSION)
+                return Error::from_string_literal("Version mismatch");
+
+            while (!stream.is_eof()) {
+                auto valid_until = static_cast<i64>(TRY(stream.read_value<LittleEndian<u64>>()));
+
+                auto session_key_size = TRY(stream.read_value<LittleEndian<u32>>());
+                auto session_key = ByteString { TRY(stream.read_in_place<u8 const>(session_key_size)) };
+                auto shmac = TRY(stream.read_in_place<u8 const>(TRY(stream.read_value<LittleEndian<u32>>())));
+                auto session_data = TRY(stream.read_in_place<u8 const>(TRY(stream.read_value<LittleEndian<u32>>())));
+
+                // Servers will refuse to resume expired sessions anyways.
+                if (valid_until <= now)
+                    continue;
+
+                auto const* session_key_or_null = session_key.is_empty() ? nullptr : session_key.characters();
+                if (auto result = curl_easy_ssls_import(easy_handle, session_key_or_null, shmac.data(), shmac.size(), session_data.data(), session_data.size()); result != CURLE_OK)
+                    return Error::from_string_view({ curl_easy_strerror(result), strlen(curl_easy_strerror(result)) });
+            }
+
+            return {};
+        }();
+
+        if (result.is_error())
+            dbgln("TLSSessionCache: Unable to load TLS sessions from {}: {}", *m_persisted_sessions_path, result.error());
+    });
+}
+
+void TLSSessionCache::save()
+{
+    if (!m_persisted_sessions_path.has_value())
+        return;
+
+    AllocatingMemoryStream stream;
+    auto result = [&]() -> ErrorOr<void> {
+        TRY(stream.write_value<LittleEndian<u32>>(TLS_SESSION_CACHE_MAGIC));
+        TRY(stream.write_value<LittleEndian<u32>>(TLS_SESSION_CACHE_VERSION));
+
+        auto export_session = [](CURL*, void* user_data, char const* session_key, unsigned char const* shmac, size_t shmac_size, unsigned char const* session_data, size_t session_data_size, curl_off_t valid_until, int, char const*, size_t) -> CURLcode {
+            auto& stream = *static_cast<AllocatingMemoryStream*>(user_data);
+            auto session_key_view = session_key ? StringView { session_key, strlen(session_key) } : StringView {};
+
+            auto result = [&]() -> ErrorOr<void> {
+                TRY(stream.write_value<LittleEndian<u64>>(static_cast<u64>(valid_until)));
+                TRY(stream.write_value<LittleEndian<u32>>(session_key_view.length()));
+                TRY(stream.write_until_depleted(session_key_view.bytes()));
+                TRY(stream.write_value<LittleEndian<u32>>(shmac_size));
+                TRY(stream.write_until_depleted({ shmac, shmac_size }));
+                TRY(stream.write_value<LittleEndian<u32>>(session_data_size));
+                TRY(stream.write_until_depleted({ session_data, session_data_size }));
+                return {};
+            }();
+
+            return result.is_error() ? CURLE_OUT_OF_MEMORY : CURLE_OK;
+        };
+
+        auto export_result = CURLE_FAILED_INIT;
+        with_easy_handle_on_share(m_share_handle, [&](CURL* easy_handle) {
+            export_result = curl_easy_ssls_export(easy_handle, export_session, &stream);
+        });
+        if (export_result != CURLE_OK)
+            return Error::from_string_view({ curl_easy_strerror(export_result), strlen(curl_easy_strerror(export_result)) });
+
+        auto contents = TRY(stream.read_until_eof());
+        auto file = TRY(Core::File::open(*m_persisted_sessions_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+        TRY(file->write_until_depleted(contents));
+        return {};
+    }();
+
+    if (result.is_error())
+        dbgln("TLSSessionCache: Unable to save TLS sessions to {}: {}", *m_persisted_sessions_path, result.error());
+}
+
+void TLSSessionCache::remove_persisted_sessions()
+{
+    if (!m_persisted_sessions_path.has_value())
+        return;
+
+    // NB: The sessions that are already in memory remain in use until RequestServer exits, but are no longer written
+    //     to disk, so that clearing browsing data does not leave resumable sessions behind.
+    (void)Core::System::unlink(*m_persisted_sessions_path);
+    m_persisted_sessions_path.clear();
+}
+
+}
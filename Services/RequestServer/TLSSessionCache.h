@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+
+namespace RequestServer {
+
+// The TLS sessions negotiated by every connection to RequestServer. Sharing them lets a connection resume a session
+// that was negotiated by another connection (e.g. by a preconnect, or by another WebContent process) with an
+// abbreviated handshake. When persistence is enabled, the sessions are also written to disk when RequestServer exits,
+// and are resumed the next time it starts.
+class TLSSessionCache {
+    AK_MAKE_NONCOPYABLE(TLSSessionCache);
+    AK_MAKE_NONMOVABLE(TLSSessionCache);
+
+public:
+    enum class Persistence {
+        Disabled,
+        Enabled,
+    };
+    static void initialize(Persistence);
+    static TLSSessionCache& the();
+
+    ~TLSSessionCache();
+
+    // The curl share handle to set as each easy handle's CURLOPT_SHARE.
+    void* share_handle() const { return m_share_handle; }
+
+    void save();
+    void remove_persisted_sessions();
+
+private:
+    explicit TLSSessionCache(Optional<ByteString> persisted_sessions_path);
+
+    void load();
+
+    void* m_share_handle { nullptr };
+    Optional<ByteString> m_persisted_sessions_path;
+};
+
+}
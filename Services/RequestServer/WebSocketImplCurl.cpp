@@ -138,6 +138,22 @@ bool WebSocketImplCurl::send(ReadonlyBytes bytes)
     return result == CURLE_OK;
 }
 
+Optional<ByteString> WebSocketImplCurl::server_extensions() const
+{
+    curl_header* header = nullptr;
+    if (curl_easy_header(m_easy_handle, "Sec-WebSocket-Extensions", 0, CURLH_HEADER, -1, &header) != CURLHE_OK)
+        return {};
+
+    // The header may have been sent more than once, in which case its values are combined into a single list.
+    Vector<StringView> values;
+    for (size_t index = 0; index < header->amount; ++index) {
+        if (index != 0 && curl_easy_header(m_easy_handle, "Sec-WebSocket-Extensions", index, CURLH_HEADER, -1, &header) != CURLHE_OK)
+            break;
+        values.append({ header->value, strlen(header->value) });
+    }
+    return ByteString::join(", "sv, values);
+}
+
 bool WebSocketImplCurl::eof()
 {
     return m_read_buffer.is_eof();
@@ -17,8 +17,10 @@
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/Request.h>
 #include <RequestServer/Resolver.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
+#include <RequestServer/TLSSessionCache.h>
 
 namespace RequestServer {
 
@@ -41,6 +43,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     Vector<ByteString> certificates;
     StringView mach_server_name;
     StringView http_disk_cache_mode;
+    StringView http3_mode;
     StringView resource_map_path;
     bool wait_for_debugger = false;
 
@@ -48,6 +51,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(http_disk_cache_mode, "HTTP disk cache mode", "http-disk-cache-mode", 0, "mode");
+    args_parser.add_option(http3_mode, "HTTP/3 mode", "http3-mode", 0, "mode");
     args_parser.add_option(resource_map_path, "Path to JSON file mapping URLs to local files", "resource-map", 0, "path");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
     args_parser.parse(arguments);
@@ -67,6 +71,20 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             RequestServer::g_resource_substitution_map = map.release_value();
     }
 
+    if (!http3_mode.is_empty()) {
+        auto mode = TRY([&]() -> ErrorOr<RequestServer::HTTP3Mode> {
+            if (http3_mode == "disabled"sv)
+                return RequestServer::HTTP3Mode::Disabled;
+            if (http3_mode == "alt-svc"sv)
+                return RequestServer::HTTP3Mode::AltSvc;
+            if (http3_mode == "enabled"sv)
+                return RequestServer::HTTP3Mode::Enabled;
+            return Error::from_string_literal("Unrecognized HTTP/3 mode");
+        }());
+
+        RequestServer::set_http3_mode(mode);
+    }
+
 #if !defined(AK_OS_WINDOWS)
     MUST(Core::System::signal(SIGPIPE, SIG_IGN));
 #endif
@@ -97,6 +115,19 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             disk_cache = cache.release_value();
     }
 
+    // TLS sessions are keyed by server, not by the site that connected to it. So they are only kept across restarts
+    // when the disk cache isn't partitioned either, as resuming a session is otherwise a cross-site tracking vector.
+    // The same goes for cached DNS answers, as the time a lookup takes reveals whether a name was looked up before.
+    auto tls_session_persistence = http_disk_cache_mode == "enabled"sv
+        ? RequestServer::TLSSessionCache::Persistence::Enabled
+        : RequestServer::TLSSessionCache::Persistence::Disabled;
+    RequestServer::TLSSessionCache::initialize(tls_session_persistence);
+
+    auto dns_cache_persistence = http_disk_cache_mode == "enabled"sv
+        ? RequestServer::Resolver::Persistence::Enabled
+        : RequestServer::Resolver::Persistence::Disabled;
+    RequestServer::Resolver::initialize_persistence(dns_cache_persistence);
+
     // Connections are stored on the stack to ensure they are destroyed before static destruction begins. This prevents
     // crashes from notifiers trying to unregister from already-destroyed thread data during process exit.
     RequestServer::ConnectionFromClient::ConnectionMap connections;
@@ -105,5 +136,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         mach_server_name,
         RequestServer::ConnectionFromClient::IsPrimaryConnection::Yes, connections, disk_cache));
 
-    return event_loop.exec();
+    auto exit_code = event_loop.exec();
+    RequestServer::TLSSessionCache::the().save();
+    RequestServer::Resolver::save_persisted_cache();
+
+    return exit_code;
 }
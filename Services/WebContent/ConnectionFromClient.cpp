@@ -13,12 +13,15 @@
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/System.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
+#include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/SharedFunctionInstanceData.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -55,6 +58,7 @@
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/StorageAPI/LocalStorageCache.h>
 #include <LibWebView/Attribute.h>
 #include <LibWebView/ViewImplementation.h>
 #include <WebContent/ConnectionFromClient.h>
@@ -109,6 +113,19 @@ void ConnectionFromClient::close_server()
     shutdown();
 }
 
+Messages::WebContentServer::CreatePageResponse ConnectionFromClient::create_page()
+{
+    return m_page_host->create_page().id();
+}
+
+void ConnectionFromClient::close_page(u64 page_id)
+{
+    // NB: The page may have already closed itself (e.g. through window.close()) by the time the UI gets rid of its
+    //     view, so this is not looked up through page(), which would complain about it.
+    if (auto page = m_page_host->page(page_id); page.has_value())
+        page->page().top_level_traversable()->close_top_level_traversable();
+}
+
 Messages::WebContentServer::GetWindowHandleResponse ConnectionFromClient::get_window_handle(u64 page_id)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -387,6 +404,23 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "dump-gc-cell-statistics") {
+        Web::Bindings::main_thread_vm().heap().dump_cell_statistics();
+        return;
+    }
+
+    if (request == "dump-lazy-compilation-statistics") {
+        JS::SharedFunctionInstanceData::dump_lazy_compilation_statistics(Web::Bindings::main_thread_vm().heap());
+        return;
+    }
+
+    if (request == "dump-inline-cache-statistics") {
+        if (!JS::Bytecode::g_collect_inline_cache_statistics)
+            dbgln("Inline cache statistics are not being collected, restart with --collect-inline-cache-statistics");
+        JS::Bytecode::dump_inline_cache_statistics(Web::Bindings::main_thread_vm().heap());
+        return;
+    }
+
     if (request == "set-line-box-borders") {
         bool state = argument == "on";
         auto traversable = page->page().top_level_traversable();
@@ -1365,6 +1399,21 @@ void ConnectionFromClient::system_time_zone_changed()
     Unicode::clear_system_time_zone_cache();
 }
 
+void ConnectionFromClient::release_memory(Core::MemoryPressureLevel level)
+{
+    Core::MemoryPressure::notify(level);
+}
+
+void ConnectionFromClient::set_tracing_enabled(bool enabled)
+{
+    Core::Tracing::set_enabled(enabled);
+}
+
+Messages::WebContentServer::TakeTraceEventsResponse ConnectionFromClient::take_trace_events()
+{
+    return Core::Tracing::take_events_as_json();
+}
+
 void ConnectionFromClient::set_document_cookie_version_buffer(u64 page_id, Core::AnonymousBuffer document_cookie_version_buffer)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -1388,6 +1437,17 @@ void ConnectionFromClient::cookies_changed(u64 page_id, Vector<HTTP::Cookie::Coo
     }
 }
 
+void ConnectionFromClient::storage_changed(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
+{
+    if (storage_endpoint == Web::StorageAPI::StorageEndpointType::LocalStorage)
+        Web::StorageAPI::LocalStorageCache::the().storage_did_change(storage_key);
+}
+
+void ConnectionFromClient::all_storage_changed()
+{
+    Web::StorageAPI::LocalStorageCache::the().all_storage_did_change();
+}
+
 // https://html.spec.whatwg.org/multipage/speculative-loading.html#nav-traversal-ui:close-a-top-level-traversable
 void ConnectionFromClient::request_close(u64 page_id)
 {
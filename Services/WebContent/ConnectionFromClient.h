@@ -60,6 +60,8 @@ private:
 
     virtual Messages::WebContentServer::InitTransportResponse init_transport(int peer_pid) override;
     virtual void close_server() override;
+    virtual Messages::WebContentServer::CreatePageResponse create_page() override;
+    virtual void close_page(u64 page_id) override;
     virtual Messages::WebContentServer::GetWindowHandleResponse get_window_handle(u64 page_id) override;
     virtual void set_window_handle(u64 page_id, String handle) override;
     virtual void connect_to_webdriver(u64 page_id, ByteString webdriver_endpoint) override;
@@ -163,11 +165,18 @@ private:
     virtual void paste(u64 page_id, Utf16String text) override;
 
     virtual void system_time_zone_changed() override;
+    virtual void release_memory(Core::MemoryPressureLevel) override;
+
+    virtual void set_tracing_enabled(bool) override;
+    virtual Messages::WebContentServer::TakeTraceEventsResponse take_trace_events() override;
 
     virtual void set_document_cookie_version_buffer(u64 page_id, Core::AnonymousBuffer document_cookie_version_buffer) override;
     virtual void set_document_cookie_version_index(u64 page_id, i64 document_id, Core::SharedVersionIndex document_index) override;
     virtual void cookies_changed(u64 page_id, Vector<HTTP::Cookie::Cookie>) override;
 
+    virtual void storage_changed(Web::StorageAPI::StorageEndpointType, String storage_key) override;
+    virtual void all_storage_changed() override;
+
     virtual void request_close(u64 page_id) override;
 
     virtual void exit_fullscreen(u64 page_id) override;
@@ -574,6 +574,15 @@ void PageClient::page_did_set_cookie(URL::URL const& url, HTTP::Cookie::ParsedCo
     }
 }
 
+void PageClient::page_did_set_cookies(URL::URL const& url, Vector<HTTP::Cookie::ParsedCookie> const& cookies, HTTP::Cookie::Source source)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidSetCookies>(url, cookies, source);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidSetCookies. Exiting peacefully.");
+        exit(0);
+    }
+}
+
 void PageClient::page_did_update_cookie(HTTP::Cookie::Cookie const& cookie)
 {
     client().async_did_update_cookie(cookie);
@@ -592,52 +601,32 @@ void PageClient::page_did_expire_cookies_with_time_offset(AK::Duration offset)
         document->reset_cookie_version();
 }
 
-Optional<String> PageClient::page_did_request_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key)
+OrderedHashMap<String, String> PageClient::page_did_request_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageItem>(storage_endpoint, storage_key, bottle_key);
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageItems>(storage_endpoint, storage_key);
     if (!response) {
-        dbgln("WebContent client disconnected during DidRequestStorageItem. Exiting peacefully.");
+        dbgln("WebContent client disconnected during DidRequestStorageItems. Exiting peacefully.");
         exit(0);
     }
-    return response->take_value();
+    return response->take_items();
 }
 
-WebView::StorageSetResult PageClient::page_did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, String const& value)
+void PageClient::page_did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, String const& value)
 {
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidSetStorageItem>(storage_endpoint, storage_key, bottle_key, value);
-    if (!response) {
-        dbgln("WebContent client disconnected during DidSetStorageItem. Exiting peacefully.");
-        exit(0);
-    }
-    return response->result();
+    // NB: Nothing waits on the write, and later storage requests on this connection are handled after it.
+    client().async_did_set_storage_item(storage_endpoint, storage_key, bottle_key, value);
 }
 
 void PageClient::page_did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key)
 {
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRemoveStorageItem>(storage_endpoint, storage_key, bottle_key);
-    if (!response) {
-        dbgln("WebContent client disconnected during DidRemoveStorageItem. Exiting peacefully.");
-        exit(0);
-    }
-}
-
-Vector<String> PageClient::page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
-{
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageKeys>(storage_endpoint, storage_key);
-    if (!response) {
-        dbgln("WebContent client disconnected during DidRequestStorageKeys. Exiting peacefully.");
-        exit(0);
-    }
-    return response->take_keys();
+    // NB: Nothing waits on the removal, and later storage requests on this connection are handled after it.
+    client().async_did_remove_storage_item(storage_endpoint, storage_key, bottle_key);
 }
 
 void PageClient::page_did_clear_storage(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidClearStorage>(storage_endpoint, storage_key);
-    if (!response) {
-        dbgln("WebContent client disconnected during DidClearStorage. Exiting peacefully.");
-        exit(0);
-    }
+    // NB: Nothing waits on the clear, and later storage requests on this connection are handled after it.
+    client().async_did_clear_storage(storage_endpoint, storage_key);
 }
 
 void PageClient::page_did_update_resource_count(i32 count_waiting)
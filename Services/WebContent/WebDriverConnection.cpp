@@ -2562,14 +2562,15 @@ Messages::WebDriverClient::TakeScreenshotResponse WebDriverConnection::take_scre
 
             // b. Let screenshot result be the result of trying to call draw a bounding box from the framebuffer, given root rect as an argument.
             // c. Let canvas be a canvas element of screenshot result's data.
-            auto canvas = WEBDRIVER_TRY(Web::WebDriver::draw_bounding_box_from_the_framebuffer(*current_top_level_browsing_context(), *document->document_element(), root_rect));
+            auto canvas = WEBDRIVER_TRY(Web::WebDriver::draw_bounding_box_from_the_framebuffer(*current_top_level_browsing_context(), root_rect));
 
             // d. Let encoding result be the result of trying encoding a canvas as Base64 canvas.
             // e. Let encoded string be encoding result's data.
-            auto encoded_string = Web::WebDriver::encode_canvas_element(canvas);
-
-            // 3. Return success with data encoded string.
-            async_driver_execution_complete(move(encoded_string));
+            Web::WebDriver::encode_bitmap_as_base64(move(canvas), [weak_this = make_weak_ptr<WebDriverConnection>()](Web::WebDriver::Response encoded_string) {
+                // 3. Return success with data encoded string.
+                if (weak_this)
+                    weak_this->async_driver_execution_complete(move(encoded_string));
+            });
         }));
     });
 
@@ -2600,14 +2601,15 @@ Messages::WebDriverClient::TakeElementScreenshotResponse WebDriverConnection::ta
 
             // b. Let screenshot result be the result of trying to call draw a bounding box from the framebuffer, given element rect as an argument.
             // c. Let canvas be a canvas element of screenshot result's data.
-            auto canvas = WEBDRIVER_TRY(Web::WebDriver::draw_bounding_box_from_the_framebuffer(current_browsing_context(), element, element_rect));
+            auto canvas = WEBDRIVER_TRY(Web::WebDriver::draw_bounding_box_from_the_framebuffer(current_browsing_context(), element_rect));
 
             // d. Let encoding result be the result of trying encoding a canvas as Base64 canvas.
             // e. Let encoded string be encoding result's data.
-            auto encoded_string = Web::WebDriver::encode_canvas_element(canvas);
-
-            // 6. Return success with data encoded string.
-            async_driver_execution_complete(move(encoded_string));
+            Web::WebDriver::encode_bitmap_as_base64(move(canvas), [weak_this = make_weak_ptr<WebDriverConnection>()](Web::WebDriver::Response encoded_string) {
+                // 6. Return success with data encoded string.
+                if (weak_this)
+                    weak_this->async_driver_execution_complete(move(encoded_string));
+            });
         }));
     });
 
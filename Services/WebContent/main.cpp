@@ -8,21 +8,27 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/LocalServer.h>
+#include <LibCore/MemoryPressure.h>
 #include <LibCore/Process.h>
 #include <LibCore/Resource.h>
 #include <LibCore/System.h>
 #include <LibCrypto/OpenSSLForward.h>
+#include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/PathFontProvider.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibIPC/TransportHandle.h>
+#include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibMain/Main.h>
 #include <LibRequests/RequestClient.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/HTML/Navigable.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/UniversalGlobalScope.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
@@ -101,6 +107,7 @@ static void install_crash_signal_handlers()
 #endif
 
 static ErrorOr<void> load_content_filters(StringView config_path);
+static void register_memory_pressure_handlers(GC::Heap&);
 
 static ErrorOr<void> connect_to_resource_loader(GC::Heap& heap, IPC::TransportHandle const& handle);
 static ErrorOr<void> connect_to_image_decoder(IPC::TransportHandle const& handle);
@@ -148,6 +155,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
+    bool collect_inline_cache_statistics = false;
+    Optional<size_t> gc_min_threshold_mib;
+    Optional<size_t> gc_max_threshold_mib;
+    Optional<double> gc_growth_factor;
+    Optional<double> gc_target_overhead_percent;
     bool is_headless = false;
     bool disable_scrollbar_painting = false;
     StringView echo_server_port_string_view {};
@@ -171,6 +183,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation");
+    args_parser.add_option(collect_inline_cache_statistics, "Record JS inline cache hit/miss counters", "collect-inline-cache-statistics");
+    args_parser.add_option(gc_min_threshold_mib, "Minimum JS heap allocation between garbage collections", "gc-min-threshold", 0, "MiB");
+    args_parser.add_option(gc_max_threshold_mib, "Maximum JS heap allocation between garbage collections", "gc-max-threshold", 0, "MiB");
+    args_parser.add_option(gc_growth_factor, "JS heap allocation between garbage collections relative to live bytes", "gc-growth-factor", 0, "factor");
+    args_parser.add_option(gc_target_overhead_percent, "Target share of time spent collecting garbage", "gc-target-overhead", 0, "percent");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical viewport scrollbars", "disable-scrollbar-painting");
     args_parser.add_option(echo_server_port_string_view, "Echo server port used in test internals", "echo-server-port", 0, "echo_server_port");
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
@@ -238,6 +255,22 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     if (collect_garbage_on_every_allocation)
         Web::Bindings::main_thread_vm().heap().set_should_collect_on_every_allocation(true);
 
+    JS::Bytecode::g_collect_inline_cache_statistics = collect_inline_cache_statistics;
+
+    if (gc_min_threshold_mib.has_value() || gc_max_threshold_mib.has_value() || gc_growth_factor.has_value() || gc_target_overhead_percent.has_value()) {
+        auto& heap = Web::Bindings::main_thread_vm().heap();
+        auto policy = heap.sizing_policy();
+        if (gc_min_threshold_mib.has_value())
+            policy.minimum_bytes_threshold = *gc_min_threshold_mib * MiB;
+        if (gc_max_threshold_mib.has_value())
+            policy.maximum_bytes_threshold = *gc_max_threshold_mib * MiB;
+        if (gc_growth_factor.has_value() && *gc_growth_factor > 0)
+            policy.live_bytes_growth_factor = *gc_growth_factor;
+        if (gc_target_overhead_percent.has_value() && *gc_target_overhead_percent >= 0 && *gc_target_overhead_percent < 100)
+            policy.target_gc_overhead = *gc_target_overhead_percent / 100.0;
+        heap.set_sizing_policy(policy);
+    }
+
     if (log_all_js_exceptions) {
         JS::set_log_all_js_exceptions(true);
     }
@@ -260,6 +293,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 #endif
 
     auto& heap = Web::Bindings::main_thread_vm().heap();
+    register_memory_pressure_handlers(heap);
+
     webcontent_client->on_request_server_connection = [&heap](auto const& handle) {
         if (auto result = connect_to_resource_loader(heap, handle); result.is_error())
             dbgln("Failed to connect to resource loader: {}", result.error());
@@ -296,6 +331,35 @@ static ErrorOr<void> load_content_filters(StringView config_path)
     return {};
 }
 
+void register_memory_pressure_handlers(GC::Heap& heap)
+{
+    // Caches that are cheap to recreate are dropped under any memory pressure.
+    Core::MemoryPressure::register_handler([](Core::MemoryPressureLevel) {
+        Gfx::Font::clear_all_shaping_caches();
+
+        for (auto navigable : Web::HTML::all_navigables()) {
+            if (auto document = navigable->active_document())
+                document->release_paint_caches();
+            if (navigable->is_top_level_traversable())
+                as<Web::HTML::TraversableNavigable>(*navigable).evict_documents_from_bfcache();
+        }
+    });
+
+    // Caches that save us from decoding images or going back to the network again are only dropped as a last resort.
+    Core::MemoryPressure::register_handler([](Core::MemoryPressureLevel level) {
+        if (level != Core::MemoryPressureLevel::Critical)
+            return;
+
+        Gfx::SkiaBackendContext::purge_caches();
+        Web::Fetch::Fetching::clear_http_memory_cache();
+    });
+
+    // NB: This is registered last, so that anything which the caches above kept alive is collected as well.
+    Core::MemoryPressure::register_handler([&heap](Core::MemoryPressureLevel) {
+        heap.release_unused_memory();
+    });
+}
+
 ErrorOr<void> connect_to_resource_loader(GC::Heap& heap, IPC::TransportHandle const& handle)
 {
     auto transport = TRY(handle.create_transport());
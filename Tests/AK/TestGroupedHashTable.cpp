@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteString.h>
+#include <AK/GroupedHashTable.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+
+TEST_CASE(construct)
+{
+    using IntTable = GroupedHashTable<int>;
+    EXPECT(IntTable().is_empty());
+    EXPECT_EQ(IntTable().size(), 0u);
+    EXPECT(IntTable().find(0) == IntTable().end());
+}
+
+TEST_CASE(populate)
+{
+    GroupedHashTable<ByteString> strings;
+    strings.set("One");
+    strings.set("Two");
+    strings.set("Three");
+
+    EXPECT_EQ(strings.is_empty(), false);
+    EXPECT_EQ(strings.size(), 3u);
+    EXPECT(strings.contains("Two"));
+    EXPECT(!strings.contains("Four"));
+}
+
+TEST_CASE(existing_entry_behavior)
+{
+    GroupedHashTable<int> table;
+    EXPECT_EQ(table.set(1), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(table.set(1), AK::HashSetResult::ReplacedExistingEntry);
+    EXPECT_EQ(table.set(1, AK::HashSetExistingEntryBehavior::Keep), AK::HashSetResult::KeptExistingEntry);
+    EXPECT_EQ(table.size(), 1u);
+}
+
+TEST_CASE(range_loop)
+{
+    GroupedHashTable<int> table;
+    for (int i = 0; i < 100; ++i)
+        table.set(i);
+
+    int sum = 0;
+    size_t count = 0;
+    for (auto value : table) {
+        sum += value;
+        ++count;
+    }
+    EXPECT_EQ(count, 100u);
+    EXPECT_EQ(sum, 4950);
+}
+
+TEST_CASE(many_strings)
+{
+    GroupedHashTable<ByteString> strings;
+    for (int i = 0; i < 999; ++i) {
+        EXPECT_EQ(strings.set(ByteString::number(i)), AK::HashSetResult::InsertedNewEntry);
+    }
+    EXPECT_EQ(strings.size(), 999u);
+    for (int i = 0; i < 999; ++i) {
+        EXPECT(strings.contains(ByteString::number(i)));
+        EXPECT(!strings.contains(ByteString::number(i + 1000)));
+    }
+    for (int i = 0; i < 999; ++i) {
+        EXPECT_EQ(strings.remove(ByteString::number(i)), true);
+    }
+    EXPECT_EQ(strings.is_empty(), true);
+}
+
+TEST_CASE(many_collisions)
+{
+    struct StringCollisionTraits : public DefaultTraits<ByteString> {
+        static unsigned hash(ByteString const&) { return 0; }
+    };
+
+    GroupedHashTable<ByteString, StringCollisionTraits> strings;
+    for (int i = 0; i < 999; ++i) {
+        EXPECT_EQ(strings.set(ByteString::number(i)), AK::HashSetResult::InsertedNewEntry);
+    }
+
+    EXPECT_EQ(strings.set("foo"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(strings.size(), 1000u);
+
+    for (int i = 0; i < 999; ++i) {
+        EXPECT_EQ(strings.remove(ByteString::number(i)), true);
+    }
+
+    EXPECT(strings.find("foo") != strings.end());
+}
+
+TEST_CASE(space_reuse)
+{
+    struct StringCollisionTraits : public DefaultTraits<ByteString> {
+        static unsigned hash(ByteString const&) { return 0; }
+    };
+
+    GroupedHashTable<ByteString, StringCollisionTraits> strings;
+
+    // Add a few items to allow it to do initial resizing.
+    EXPECT_EQ(strings.set("0"), AK::HashSetResult::InsertedNewEntry);
+    for (int i = 1; i < 5; ++i) {
+        EXPECT_EQ(strings.set(ByteString::number(i)), AK::HashSetResult::InsertedNewEntry);
+        EXPECT_EQ(strings.remove(ByteString::number(i - 1)), true);
+    }
+
+    auto capacity = strings.capacity();
+
+    for (int i = 5; i < 999; ++i) {
+        EXPECT_EQ(strings.set(ByteString::number(i)), AK::HashSetResult::InsertedNewEntry);
+        EXPECT_EQ(strings.remove(ByteString::number(i - 1)), true);
+    }
+
+    EXPECT_EQ(strings.capacity(), capacity);
+}
+
+TEST_CASE(tombstone_reuse)
+{
+    GroupedHashTable<int> table;
+    for (int i = 0; i < 1000; ++i)
+        table.set(i);
+    auto capacity = table.capacity();
+
+    // NB: Removing values from full groups leaves tombstones behind, which must neither grow the table forever nor
+    //     make the values behind them unreachable.
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 1000; i += 2)
+            EXPECT_EQ(table.remove(i + round * 1000), true);
+        for (int i = 0; i < 1000; i += 2)
+            EXPECT_EQ(table.set(i + (round + 1) * 1000), AK::HashSetResult::InsertedNewEntry);
+        for (int i = 1; i < 1000; i += 2)
+            EXPECT(table.contains(i));
+        for (int i = 1; i < 1000; i += 2)
+            table.set(i + (round + 1) * 1000);
+        for (int i = 1; i < 1000; i += 2)
+            table.remove(i + (round + 1) * 1000);
+    }
+
+    EXPECT_EQ(table.size(), 1000u);
+    EXPECT(table.capacity() <= capacity * 2);
+}
+
+TEST_CASE(remove_all_matching)
+{
+    GroupedHashTable<int> table;
+    for (int i = 0; i < 100; ++i)
+        table.set(i);
+
+    EXPECT_EQ(table.remove_all_matching([](int value) { return value % 2 == 0; }), true);
+    EXPECT_EQ(table.size(), 50u);
+    EXPECT(!table.contains(42));
+    EXPECT(table.contains(43));
+
+    EXPECT_EQ(table.remove_all_matching([](int) { return false; }), false);
+    EXPECT_EQ(table.remove_all_matching([](int) { return true; }), true);
+    EXPECT(table.is_empty());
+}
+
+TEST_CASE(take_all_matching)
+{
+    GroupedHashTable<int> table;
+    for (int i = 0; i < 10; ++i)
+        table.set(i);
+
+    auto taken = table.take_all_matching([](int value) { return value >= 5; });
+    EXPECT_EQ(taken.size(), 5u);
+    EXPECT_EQ(table.size(), 5u);
+    for (auto value : taken)
+        EXPECT(!table.contains(value));
+}
+
+TEST_CASE(iterator_removal)
+{
+    GroupedHashTable<int> table;
+    table.set(0);
+    table.set(1);
+
+    auto it = table.begin();
+    table.remove(it);
+    EXPECT_EQ(it, table.end());
+    EXPECT_EQ(table.size(), 1u);
+}
+
+TEST_CASE(non_trivial_type_table)
+{
+    GroupedHashTable<NonnullOwnPtr<int>> table;
+
+    table.set(make<int>(3));
+    table.set(make<int>(11));
+
+    for (int i = 0; i < 1'000; ++i) {
+        table.set(make<int>(-i));
+    }
+    for (int i = 0; i < 10'000; ++i) {
+        table.set(make<int>(i));
+        table.remove(make<int>(i));
+    }
+
+    EXPECT_EQ(table.remove_all_matching([&](auto&) { return true; }), true);
+    EXPECT(table.is_empty());
+    EXPECT_EQ(table.remove_all_matching([&](auto&) { return true; }), false);
+}
+
+TEST_CASE(copy_and_move)
+{
+    GroupedHashTable<ByteString> table;
+    for (int i = 0; i < 100; ++i)
+        table.set(ByteString::number(i));
+
+    auto copy = table;
+    EXPECT_EQ(copy.size(), 100u);
+    EXPECT(copy.contains("42"));
+
+    auto moved = move(table);
+    EXPECT_EQ(moved.size(), 100u);
+    EXPECT(moved.contains("42"));
+    EXPECT(table.is_empty());
+    EXPECT(!table.contains("42"));
+}
+
+TEST_CASE(clear_with_capacity)
+{
+    GroupedHashTable<ByteString> table;
+    for (int i = 0; i < 100; ++i)
+        table.set(ByteString::number(i));
+    auto capacity = table.capacity();
+
+    table.clear_with_capacity();
+    EXPECT(table.is_empty());
+    EXPECT_EQ(table.capacity(), capacity);
+    EXPECT(!table.contains("42"));
+
+    table.set("42");
+    EXPECT(table.contains("42"));
+}
+
+TEST_CASE(grouped_hash_map)
+{
+    GroupedHashMap<String, int> map;
+    for (int i = 0; i < 100; ++i)
+        map.set(String::number(i), i);
+
+    EXPECT_EQ(map.size(), 100u);
+    EXPECT_EQ(map.get("42"sv).value(), 42);
+    EXPECT(!map.get("100"sv).has_value());
+
+    map.ensure(String::number(42), [] { return 0; }) = 1042;
+    EXPECT_EQ(map.get("42"sv).value(), 1042);
+    EXPECT_EQ(map.ensure("100"_string, [] { return 100; }), 100);
+
+    EXPECT_EQ(map.take("100"_string).value(), 100);
+    EXPECT_EQ(map.remove("42"_string), true);
+    EXPECT_EQ(map.size(), 99u);
+
+    size_t count = 0;
+    for (auto const& [key, value] : map) {
+        EXPECT_EQ(key, String::number(value));
+        ++count;
+    }
+    EXPECT_EQ(count, 99u);
+}
+
+static constexpr int ITERATION_COUNT = 100;
+static constexpr size_t benchmark_capacity = 16 * KiB;
+
+// Fills a table with as many values as it can hold at the given load factor, without growing it.
+template<typename Table>
+static Table make_table_with_load_factor(size_t load_factor_percent)
+{
+    Table table(benchmark_capacity);
+    for (int i = 0; (table.size() + 1) * 100 <= table.capacity() * load_factor_percent; ++i)
+        table.set(i);
+    VERIFY(table.capacity() == benchmark_capacity);
+    return table;
+}
+
+// Looks up every value in the table, and as many values that are not in it.
+template<typename Table>
+static void lookup_at_load_factor(size_t load_factor_percent)
+{
+    auto table = make_table_with_load_factor<Table>(load_factor_percent);
+    int size = static_cast<int>(table.size());
+
+    size_t found = 0;
+    for (int iter = 0; iter < ITERATION_COUNT; ++iter) {
+        for (int i = 0; i < size * 2; ++i)
+            found += table.contains(i);
+    }
+    EXPECT_EQ(found, table.size() * ITERATION_COUNT);
+}
+
+BENCHMARK_CASE(lookup_at_25_percent_load)
+{
+    lookup_at_load_factor<HashTable<int>>(25);
+}
+
+BENCHMARK_CASE(lookup_at_25_percent_load_grouped)
+{
+    lookup_at_load_factor<GroupedHashTable<int>>(25);
+}
+
+BENCHMARK_CASE(lookup_at_50_percent_load)
+{
+    lookup_at_load_factor<HashTable<int>>(50);
+}
+
+BENCHMARK_CASE(lookup_at_50_percent_load_grouped)
+{
+    lookup_at_load_factor<GroupedHashTable<int>>(50);
+}
+
+// NB: HashTable grows at 70%, so this is as full as it gets.
+BENCHMARK_CASE(lookup_at_65_percent_load)
+{
+    lookup_at_load_factor<HashTable<int>>(65);
+}
+
+BENCHMARK_CASE(lookup_at_65_percent_load_grouped)
+{
+    lookup_at_load_factor<GroupedHashTable<int>>(65);
+}
+
+BENCHMARK_CASE(lookup_at_85_percent_load_grouped)
+{
+    lookup_at_load_factor<GroupedHashTable<int>>(85);
+}
+
+template<typename Map>
+static void lookup_missing_strings()
+{
+    Map map;
+    for (int i = 0; i < 1'000; ++i)
+        map.set(MUST(String::formatted("class-name-{}", i)), i);
+
+    Vector<String> missing;
+    for (int i = 0; i < 1'000; ++i)
+        missing.append(MUST(String::formatted("other-class-name-{}", i)));
+
+    for (int iter = 0; iter < ITERATION_COUNT; ++iter) {
+        for (auto const& key : missing)
+            EXPECT(!map.contains(key));
+    }
+}
+
+BENCHMARK_CASE(lookup_missing_strings)
+{
+    lookup_missing_strings<HashMap<String, int>>();
+}
+
+BENCHMARK_CASE(lookup_missing_strings_grouped)
+{
+    lookup_missing_strings<GroupedHashMap<String, int>>();
+}
+
+template<typename Table>
+static void insert_remove()
+{
+    for (int iter = 0; iter < ITERATION_COUNT; ++iter) {
+        Table table;
+        for (int i = 0; i < 10'000; ++i)
+            table.set(i);
+        for (int i = 0; i < 10'000; i += 2)
+            table.remove(i);
+        for (int i = 10'000; i < 15'000; ++i)
+            table.set(i);
+    }
+}
+
+BENCHMARK_CASE(insert_remove_int)
+{
+    insert_remove<HashTable<int>>();
+}
+
+BENCHMARK_CASE(insert_remove_int_grouped)
+{
+    insert_remove<GroupedHashTable<int>>();
+}
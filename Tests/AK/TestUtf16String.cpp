@@ -433,6 +433,20 @@ TEST_CASE(from_string_builder)
     EXPECT_EQ(string, "ab😀𐀀🍕cd"sv);
 }
 
+TEST_CASE(from_string_builder_with_appended_strings)
+{
+    StringBuilder builder(StringBuilder::Mode::UTF16);
+    builder.append("abc"sv);
+    builder.append("😀 déf"sv);
+    builder.append_ascii_without_validation("ghi"sv.bytes());
+    builder.append(u"jkl 🍕"sv);
+    builder.append("\xff"sv);
+
+    auto string = builder.to_utf16_string();
+    EXPECT_EQ(string.length_in_code_units(), 19uz);
+    EXPECT_EQ(string.utf16_view(), u"abc😀 défghijkl 🍕\ufffd"sv);
+}
+
 TEST_CASE(from_ipc_stream)
 {
     {
@@ -155,3 +155,36 @@ TEST_CASE(deflate_compress_literals)
     Array<u8, 0x13> test { 0, 0, 0, 0, 0x72, 0, 0, 0xee, 0, 0, 0, 0x26, 0, 0, 0, 0x28, 0, 0, 0x72 };
     auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(test));
 }
+
+TEST_CASE(deflate_flush_keeps_context)
+{
+    AllocatingMemoryStream compressed_stream;
+    auto compressor = TRY_OR_FAIL(Compress::DeflateCompressor::create(MaybeOwned<Stream> { compressed_stream }));
+
+    AllocatingMemoryStream input_stream;
+    auto decompressor = TRY_OR_FAIL(Compress::DeflateDecompressor::create(MaybeOwned<Stream> { input_stream }));
+
+    auto message = "Well hello friends, this is a message that is going to be sent twice"sv.bytes();
+    size_t first_compressed_size = 0;
+
+    for (size_t i = 0; i < 2; ++i) {
+        TRY_OR_FAIL(compressor->write_until_depleted(message));
+        TRY_OR_FAIL(compressor->flush());
+
+        auto compressed = TRY_OR_FAIL(ByteBuffer::create_uninitialized(compressed_stream.used_buffer_size()));
+        TRY_OR_FAIL(compressed_stream.read_until_filled(compressed));
+        EXPECT(compressed.bytes().slice(compressed.size() - 4) == to_array<u8>({ 0x00, 0x00, 0xff, 0xff }).span());
+
+        // The second message can refer back to the first one, so it should end up a lot smaller.
+        if (i == 0)
+            first_compressed_size = compressed.size();
+        else
+            EXPECT(compressed.size() < first_compressed_size / 2);
+
+        TRY_OR_FAIL(input_stream.write_until_depleted(compressed));
+
+        Array<u8, 256> buffer;
+        auto decompressed = TRY_OR_FAIL(decompressor->read_some_of_available_input(buffer));
+        EXPECT_EQ(StringView { decompressed }, StringView { message });
+    }
+}
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/MemoryStream.h>
 #include <LibCompress/Gzip.h>
 #include <LibTest/TestCase.h>
 
@@ -91,6 +92,35 @@ TEST_CASE(gzip_round_trip)
     EXPECT(uncompressed == original);
 }
 
+TEST_CASE(gzip_decompress_available_input)
+{
+    auto original = ByteBuffer::create_uninitialized(256 * KiB).release_value();
+    fill_with_random(original.bytes().trim(original.size() / 2));
+    original.bytes().slice(original.size() / 2).fill('a');
+    auto compressed = TRY_OR_FAIL(Compress::GzipCompressor::compress_all(original));
+
+    AllocatingMemoryStream input_stream;
+    auto decompressor = TRY_OR_FAIL(Compress::GzipDecompressor::create(MaybeOwned<Stream> { input_stream }));
+
+    ByteBuffer decompressed;
+    Array<u8, 4096> buffer;
+
+    for (size_t offset = 0; offset < compressed.size(); offset += 1000) {
+        auto piece = compressed.bytes().slice(offset, min<size_t>(1000, compressed.size() - offset));
+        TRY_OR_FAIL(input_stream.write_until_depleted(piece));
+
+        while (true) {
+            auto bytes = TRY_OR_FAIL(decompressor->read_some_of_available_input(buffer));
+            if (bytes.is_empty())
+                break;
+            decompressed.append(bytes);
+        }
+    }
+
+    EXPECT(decompressor->is_eof());
+    EXPECT(decompressed == original);
+}
+
 TEST_CASE(gzip_truncated_uncompressed_block)
 {
     Array<u8, 38> const compressed {
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+
+#ifdef AK_OS_LINUX
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+TEST_CASE(sealed_buffers_can_still_be_shared)
+{
+    auto buffer = TRY_OR_FAIL(Core::AnonymousBuffer::create_with_size(4096));
+    buffer.data<u8>()[0] = 42;
+
+    TRY_OR_FAIL(buffer.seal_against_writes());
+
+    // Our own mapping stays writable.
+    buffer.data<u8>()[1] = 43;
+
+    // While other mappings of the buffer see the same contents.
+    auto fd = TRY_OR_FAIL(Core::System::dup(buffer.fd()));
+    auto shared_buffer = TRY_OR_FAIL(Core::AnonymousBuffer::create_from_anon_fd(fd, buffer.size()));
+    EXPECT_EQ(shared_buffer.size(), buffer.size());
+    EXPECT_EQ(shared_buffer.data<u8>()[0], 42);
+    EXPECT_EQ(shared_buffer.data<u8>()[1], 43);
+
+    buffer.data<u8>()[0] = 44;
+    EXPECT_EQ(shared_buffer.data<u8>()[0], 44);
+}
+
+#if defined(AK_OS_LINUX) && defined(F_SEAL_FUTURE_WRITE)
+TEST_CASE(sealed_buffers_cannot_be_written_to)
+{
+    auto buffer = TRY_OR_FAIL(Core::AnonymousBuffer::create_with_size(4096));
+    TRY_OR_FAIL(buffer.seal_against_writes());
+
+    u8 byte = 0;
+    EXPECT_EQ(::pwrite(buffer.fd(), &byte, 1, 0), -1);
+    EXPECT_EQ(errno, EPERM);
+}
+#endif
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibCore/MemoryPressure.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(handlers_are_invoked_in_registration_order)
+{
+    Vector<int> invocations;
+    Vector<Core::MemoryPressureLevel> levels;
+
+    auto first = Core::MemoryPressure::register_handler([&](auto level) {
+        invocations.append(1);
+        levels.append(level);
+    });
+    auto second = Core::MemoryPressure::register_handler([&](auto level) {
+        invocations.append(2);
+        levels.append(level);
+    });
+
+    Core::MemoryPressure::notify(Core::MemoryPressureLevel::Moderate);
+    Core::MemoryPressure::notify(Core::MemoryPressureLevel::Critical);
+
+    EXPECT_EQ(invocations, (Vector<int> { 1, 2, 1, 2 }));
+    EXPECT_EQ(levels, (Vector<Core::MemoryPressureLevel> { Core::MemoryPressureLevel::Moderate, Core::MemoryPressureLevel::Moderate, Core::MemoryPressureLevel::Critical, Core::MemoryPressureLevel::Critical }));
+
+    Core::MemoryPressure::unregister_handler(first);
+    Core::MemoryPressure::unregister_handler(second);
+}
+
+TEST_CASE(unregistered_handlers_are_not_invoked)
+{
+    size_t first_invocations = 0;
+    size_t second_invocations = 0;
+
+    auto first = Core::MemoryPressure::register_handler([&](auto) { ++first_invocations; });
+    auto second = Core::MemoryPressure::register_handler([&](auto) { ++second_invocations; });
+
+    Core::MemoryPressure::unregister_handler(first);
+    Core::MemoryPressure::notify(Core::MemoryPressureLevel::Critical);
+
+    EXPECT_EQ(first_invocations, 0u);
+    EXPECT_EQ(second_invocations, 1u);
+
+    Core::MemoryPressure::unregister_handler(second);
+    Core::MemoryPressure::notify(Core::MemoryPressureLevel::Critical);
+
+    EXPECT_EQ(second_invocations, 1u);
+}
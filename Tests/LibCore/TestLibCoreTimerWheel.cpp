@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/QuickSort.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/TimerWheel.h>
+#include <LibTest/TestCase.h>
+
+namespace {
+
+struct TestTimeout {
+    explicit TestTimeout(MonotonicTime deadline)
+        : m_deadline(deadline)
+    {
+    }
+
+    MonotonicTime deadline() const { return m_deadline; }
+
+    MonotonicTime m_deadline;
+    IntrusiveListNode<TestTimeout> m_list_node;
+};
+
+using TestWheel = Core::TimerWheel<TestTimeout, &TestTimeout::m_list_node>;
+
+Vector<TestTimeout*> take_expired(TestWheel& wheel, MonotonicTime now)
+{
+    Vector<TestTimeout*> expired;
+    wheel.take_expired(now, expired);
+    quick_sort(expired, [](auto* a, auto* b) { return a->deadline() < b->deadline(); });
+    return expired;
+}
+
+}
+
+TEST_CASE(timeouts_expire_at_their_deadline)
+{
+    auto start = MonotonicTime::now();
+    TestWheel wheel { start };
+
+    // Each of these is placed into a different level of the wheel.
+    TestTimeout level_0 { start + AK::Duration::from_milliseconds(5) };
+    TestTimeout level_1 { start + AK::Duration::from_milliseconds(70) };
+    TestTimeout level_2 { start + AK::Duration::from_milliseconds(5'000) };
+    TestTimeout level_3 { start + AK::Duration::from_seconds(600) };
+
+    wheel.insert(level_3);
+    wheel.insert(level_1);
+    wheel.insert(level_0);
+    wheel.insert(level_2);
+    EXPECT_EQ(wheel.size(), 4u);
+    EXPECT_EQ(wheel.next_deadline(), level_0.deadline());
+
+    EXPECT(take_expired(wheel, start + AK::Duration::from_milliseconds(4)).is_empty());
+    EXPECT_EQ(take_expired(wheel, start + AK::Duration::from_milliseconds(5)), (Vector<TestTimeout*> { &level_0 }));
+    EXPECT_EQ(wheel.next_deadline(), level_1.deadline());
+
+    EXPECT(take_expired(wheel, start + AK::Duration::from_milliseconds(69)).is_empty());
+    EXPECT_EQ(take_expired(wheel, start + AK::Duration::from_milliseconds(100)), (Vector<TestTimeout*> { &level_1 }));
+    EXPECT_EQ(wheel.next_deadline(), level_2.deadline());
+
+    EXPECT(take_expired(wheel, start + AK::Duration::from_milliseconds(4'999)).is_empty());
+    EXPECT_EQ(take_expired(wheel, start + AK::Duration::from_seconds(60)), (Vector<TestTimeout*> { &level_2 }));
+    EXPECT_EQ(wheel.next_deadline(), level_3.deadline());
+
+    EXPECT_EQ(take_expired(wheel, start + AK::Duration::from_seconds(3'600)), (Vector<TestTimeout*> { &level_3 }));
+    EXPECT(wheel.is_empty());
+    EXPECT(!wheel.next_deadline().has_value());
+}
+
+TEST_CASE(timeouts_expire_together_when_advancing_past_several_deadlines)
+{
+    auto start = MonotonicTime::now();
+    TestWheel wheel { start };
+
+    Vector<NonnullOwnPtr<TestTimeout>> timeouts;
+    for (i64 milliseconds = 1; milliseconds <= 10'000; milliseconds += 7) {
+        timeouts.append(make<TestTimeout>(start + AK::Duration::from_milliseconds(milliseconds)));
+        wheel.insert(*timeouts.last());
+    }
+
+    auto expired = take_expired(wheel, start + AK::Duration::from_milliseconds(5'000));
+    EXPECT_EQ(expired.size(), 715u);
+    EXPECT_EQ(expired.last()->deadline(), start + AK::Duration::from_milliseconds(4'999));
+    EXPECT_EQ(wheel.next_deadline(), start + AK::Duration::from_milliseconds(5'006));
+
+    expired = take_expired(wheel, start + AK::Duration::from_milliseconds(10'000));
+    EXPECT_EQ(expired.size(), 714u);
+    EXPECT(wheel.is_empty());
+}
+
+TEST_CASE(removed_timeouts_do_not_expire)
+{
+    auto start = MonotonicTime::now();
+    TestWheel wheel { start };
+
+    TestTimeout first { start + AK::Duration::from_milliseconds(10) };
+    TestTimeout second { start + AK::Duration::from_milliseconds(100) };
+
+    wheel.insert(first);
+    wheel.insert(second);
+    EXPECT_EQ(wheel.next_deadline(), first.deadline());
+
+    wheel.remove(first);
+    EXPECT_EQ(wheel.size(), 1u);
+    EXPECT_EQ(wheel.next_deadline(), second.deadline());
+
+    EXPECT_EQ(take_expired(wheel, start + AK::Duration::from_milliseconds(200)), (Vector<TestTimeout*> { &second }));
+}
+
+TEST_CASE(timeouts_never_expire_early_within_a_millisecond)
+{
+    auto start = MonotonicTime::now();
+    TestWheel wheel { start };
+
+    TestTimeout timeout { start + AK::Duration::from_microseconds(10'500) };
+    wheel.insert(timeout);
+
+    EXPECT(take_expired(wheel, start + AK::Duration::from_microseconds(10'200)).is_empty());
+    EXPECT_EQ(wheel.next_deadline(), timeout.deadline());
+    EXPECT_EQ(take_expired(wheel, start + AK::Duration::from_microseconds(10'500)), (Vector<TestTimeout*> { &timeout }));
+}
+
+TEST_CASE(timeouts_in_the_past_expire_immediately)
+{
+    auto start = MonotonicTime::now();
+    TestWheel wheel { start };
+
+    EXPECT(take_expired(wheel, start + AK::Duration::from_milliseconds(100)).is_empty());
+
+    TestTimeout timeout { start + AK::Duration::from_milliseconds(50) };
+    wheel.insert(timeout);
+    EXPECT_EQ(wheel.next_deadline(), timeout.deadline());
+    EXPECT_EQ(take_expired(wheel, start + AK::Duration::from_milliseconds(100)), (Vector<TestTimeout*> { &timeout }));
+}
+
+TEST_CASE(next_deadline_considers_every_level)
+{
+    auto start = MonotonicTime::now();
+    TestWheel wheel { start };
+
+    // This starts out too far away for the lowest level.
+    TestTimeout earlier { start + AK::Duration::from_milliseconds(70) };
+    wheel.insert(earlier);
+
+    EXPECT(take_expired(wheel, start + AK::Duration::from_milliseconds(60)).is_empty());
+
+    // While this one is close enough to be placed into the lowest level, despite expiring later.
+    TestTimeout later { start + AK::Duration::from_milliseconds(120) };
+    wheel.insert(later);
+
+    EXPECT_EQ(wheel.next_deadline(), earlier.deadline());
+    EXPECT_EQ(take_expired(wheel, start + AK::Duration::from_milliseconds(70)), (Vector<TestTimeout*> { &earlier }));
+    EXPECT_EQ(take_expired(wheel, start + AK::Duration::from_milliseconds(120)), (Vector<TestTimeout*> { &later }));
+}
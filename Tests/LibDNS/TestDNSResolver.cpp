@@ -102,3 +102,54 @@ TEST_CASE(test_tls)
 
     EXPECT_EQ(0, loop.exec());
 }
+
+TEST_CASE(test_cached_addresses)
+{
+    Core::EventLoop loop;
+
+    DNS::Resolver resolver {
+        [&] -> ErrorOr<DNS::Resolver::SocketResult> {
+            return Error::from_string_literal("No network in this test");
+        }
+    };
+
+    auto expiration = AK::UnixDateTime::now() + AK::Duration::from_seconds(60);
+    Array addresses {
+        DNS::Resolver::CachedAddress { "example.invalid", IPv4Address { 192, 0, 2, 1 }, expiration },
+        DNS::Resolver::CachedAddress { "example.invalid", IPv6Address::loopback(), expiration },
+    };
+    resolver.add_cached_addresses(addresses);
+
+    auto result = TRY_OR_FAIL(resolver.lookup("example.invalid", DNS::Messages::Class::IN, { { DNS::Messages::ResourceType::A }, { DNS::Messages::ResourceType::AAAA } })->await());
+    EXPECT(!result->is_stale());
+    EXPECT_EQ(result->cached_addresses().size(), 2u);
+
+    auto cached_addresses = resolver.cached_addresses_with_expiration();
+    EXPECT_EQ(cached_addresses.size(), 2u);
+    EXPECT_EQ(cached_addresses[0].name, "example.invalid"sv);
+    EXPECT_EQ(cached_addresses[0].expiration, expiration);
+}
+
+TEST_CASE(test_stale_addresses_are_served_while_revalidating)
+{
+    Core::EventLoop loop;
+
+    DNS::Resolver resolver {
+        [&] -> ErrorOr<DNS::Resolver::SocketResult> {
+            return Error::from_string_literal("No network in this test");
+        }
+    };
+
+    Array addresses {
+        DNS::Resolver::CachedAddress { "stale.invalid", IPv4Address { 192, 0, 2, 1 }, AK::UnixDateTime::now() - AK::Duration::from_seconds(60) },
+    };
+    resolver.add_cached_addresses(addresses);
+
+    auto result = TRY_OR_FAIL(resolver.lookup("stale.invalid", DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A })->await());
+    EXPECT(result->is_stale());
+    EXPECT_EQ(result->cached_addresses().size(), 1u);
+
+    // Revalidating the name fails, so the stale answer must still be there for the next lookup.
+    result = TRY_OR_FAIL(resolver.lookup("stale.invalid", DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A })->await());
+    EXPECT(result->is_stale());
+}
@@ -57,3 +57,49 @@ TEST_CASE(string_can_contain_null_bytes)
     remove_item("my_key"_string);
     EXPECT_EQ(get_item("my_key"_string), Optional<String> {});
 }
+
+TEST_CASE(statements_in_nested_transactions_are_committed_with_the_outermost_transaction)
+{
+    auto database = TRY_OR_FAIL(Database::Database::create_memory_backed());
+
+    database->execute_statement(TRY_OR_FAIL(database->prepare_statement("CREATE TABLE Numbers (value INTEGER);"sv)), {});
+
+    auto insert_statement = TRY_OR_FAIL(database->prepare_statement("INSERT INTO Numbers VALUES (?);"sv));
+    auto count_statement = TRY_OR_FAIL(database->prepare_statement("SELECT COUNT(*) FROM Numbers;"sv));
+
+    auto count = [&]() {
+        int result = 0;
+        database->execute_statement(count_statement, [&](auto statement_id) {
+            result = database->result_column<int>(statement_id, 0);
+        });
+        return result;
+    };
+
+    EXPECT(!database->is_in_transaction());
+
+    {
+        auto outer_transaction = database->begin_transaction();
+        EXPECT(database->is_in_transaction());
+
+        for (int i = 0; i < 10; ++i)
+            database->execute_statement(insert_statement, {}, i);
+
+        {
+            auto inner_transaction = database->begin_transaction();
+            database->execute_statement(insert_statement, {}, 10);
+        }
+
+        EXPECT(database->is_in_transaction());
+        EXPECT_EQ(count(), 11);
+    }
+
+    EXPECT(!database->is_in_transaction());
+    EXPECT_EQ(count(), 11);
+
+    {
+        auto transaction = database->begin_transaction();
+        database->execute_statement(insert_statement, {}, 11);
+    }
+
+    EXPECT_EQ(count(), 12);
+}
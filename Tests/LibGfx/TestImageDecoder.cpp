@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/ByteString.h>
 #include <LibCore/MappedFile.h>
 #include <LibGfx/ImageFormats/AVIFLoader.h>
@@ -147,6 +148,24 @@ TEST_CASE(test_gif)
     EXPECT(frame.duration == 400);
 }
 
+TEST_CASE(test_gif_frames_are_the_same_in_any_order)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("gif/download-animation.gif"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::GIFImageDecoderPlugin::create(file->bytes()));
+
+    Vector<NonnullRefPtr<Gfx::Bitmap>> frames;
+    for (size_t frame_index = 0; frame_index < plugin_decoder->frame_count(); ++frame_index)
+        frames.append(*TRY_OR_FAIL(plugin_decoder->frame(frame_index)).image);
+
+    // Seeking backwards may start decoding from a later frame than the first one, which must not change the result.
+    auto reverse_decoder = TRY_OR_FAIL(Gfx::GIFImageDecoderPlugin::create(file->bytes()));
+    for (size_t frame_index = frames.size(); frame_index-- > 0;) {
+        auto frame = TRY_OR_FAIL(reverse_decoder->frame(frame_index));
+        EXPECT_EQ(frame.image->size(), frames[frame_index]->size());
+        EXPECT_EQ(memcmp(frame.image->scanline_u8(0), frames[frame_index]->scanline_u8(0), frame.image->size_in_bytes()), 0);
+    }
+}
+
 TEST_CASE(test_corrupted_gif)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("gif/corrupted.gif"sv)));
@@ -275,6 +294,34 @@ TEST_CASE(test_jpeg_sof0_one_scan)
     TRY_OR_FAIL(expect_single_frame(*plugin_decoder));
 }
 
+TEST_CASE(test_jpeg_yuv_frame)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/rgb24.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+
+    auto yuv_data = TRY_OR_FAIL(plugin_decoder->yuv_frame());
+    EXPECT(yuv_data);
+    EXPECT_EQ(yuv_data->size(), Gfx::IntSize(127, 64));
+    EXPECT_EQ(yuv_data->bit_depth(), 8);
+    EXPECT(yuv_data->subsampling().x());
+    EXPECT(yuv_data->subsampling().y());
+    EXPECT(yuv_data->anonymous_buffer().is_valid());
+    EXPECT_EQ(yuv_data->y_data().size(), 127u * 64u);
+    EXPECT_EQ(yuv_data->u_data().size(), 64u * 32u);
+    EXPECT(any_of(yuv_data->y_data(), [](u8 value) { return value != 0; }));
+
+    // The image can still be decoded to RGB afterwards.
+    TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 127, 64 }));
+}
+
+TEST_CASE(test_jpeg_yuv_frame_cmyk)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/ycck-2111.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+
+    EXPECT(!TRY_OR_FAIL(plugin_decoder->yuv_frame()));
+}
+
 TEST_CASE(test_jpeg_sof0_several_scans)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
@@ -413,6 +460,17 @@ TEST_CASE(test_jpeg_grayscale_with_weird_mcu_and_reset_marker)
     TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 320, 240 }));
 }
 
+TEST_CASE(test_jpeg_truncated_progressive)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/successive_approximation.jpg"sv)));
+    auto full_plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+    auto full_frame = TRY_OR_FAIL(expect_single_frame(*full_plugin_decoder));
+
+    // The scans that did arrive are decoded into an image of the full size.
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes().trim(file->size() / 2)));
+    TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, full_frame.image->size()));
+}
+
 TEST_CASE(test_jpeg_malformed_header)
 {
     Array test_inputs = {
@@ -451,6 +509,21 @@ TEST_CASE(test_png)
     TRY_OR_FAIL(expect_single_frame(*plugin_decoder));
 }
 
+TEST_CASE(test_png_truncated)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/buggie.png"sv)));
+    auto full_plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(file->bytes()));
+    auto full_frame = TRY_OR_FAIL(expect_single_frame(*full_plugin_decoder));
+
+    // The rows that were decoded before the data was cut off are kept.
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(file->bytes().trim(file->size() * 3 / 4)));
+    auto frame = TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, full_frame.image->size()));
+
+    auto row = full_frame.image->height() / 4;
+    for (int x = 0; x < full_frame.image->width(); ++x)
+        EXPECT_EQ(frame.image->get_pixel(x, row), full_frame.image->get_pixel(x, row));
+}
+
 TEST_CASE(test_apng)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/apng-1-frame.png"sv)));
@@ -800,6 +873,28 @@ TEST_CASE(test_webp_simple_lossy)
     EXPECT_EQ(frame.image->get_pixel(198, 202), Gfx::Color(0x7a, 0xaa, 0xd5, 255));
 }
 
+TEST_CASE(test_webp_simple_lossy_yuv_frame)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("webp/simple-vp8.webp"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::WebPImageDecoderPlugin::create(file->bytes()));
+
+    auto yuv_data = TRY_OR_FAIL(plugin_decoder->yuv_frame());
+    EXPECT(yuv_data);
+    EXPECT_EQ(yuv_data->size(), Gfx::IntSize(240, 240));
+    EXPECT(yuv_data->subsampling().x());
+    EXPECT(yuv_data->subsampling().y());
+    EXPECT_EQ(yuv_data->cicp().video_full_range_flag(), Media::VideoFullRangeFlag::Studio);
+    EXPECT(any_of(yuv_data->y_data(), [](u8 value) { return value != 0; }));
+}
+
+TEST_CASE(test_webp_simple_lossless_yuv_frame)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("webp/simple-vp8l.webp"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::WebPImageDecoderPlugin::create(file->bytes()));
+
+    EXPECT(!TRY_OR_FAIL(plugin_decoder->yuv_frame()));
+}
+
 TEST_CASE(test_webp_simple_lossless)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("webp/simple-vp8l.webp"sv)));
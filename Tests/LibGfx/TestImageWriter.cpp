@@ -114,6 +114,19 @@ TEST_CASE(test_png)
     TRY_OR_FAIL((test_roundtrip<Gfx::PNGWriter, Gfx::PNGImageDecoderPlugin>(TRY_OR_FAIL(create_test_rgba_bitmap()))));
 }
 
+TEST_CASE(test_png_compression_options)
+{
+    auto bitmap = TRY_OR_FAIL(create_test_rgba_bitmap());
+
+    for (auto filter_strategy : { Gfx::PNGFilterStrategy::Adaptive, Gfx::PNGFilterStrategy::None, Gfx::PNGFilterStrategy::Sub, Gfx::PNGFilterStrategy::Up, Gfx::PNGFilterStrategy::Average, Gfx::PNGFilterStrategy::Paeth }) {
+        for (auto compression_level : { 0, 1, 9 }) {
+            auto encoded_data = TRY_OR_FAIL(Gfx::PNGWriter::encode(*bitmap, { .compression_level = compression_level, .filter_strategy = filter_strategy }));
+            auto decoded = TRY_OR_FAIL(expect_single_frame_of_size(*TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(encoded_data)), bitmap->size()));
+            expect_bitmaps_equal(*decoded, *bitmap);
+        }
+    }
+}
+
 TEST_CASE(test_webp)
 {
     TRY_OR_FAIL((test_roundtrip<Gfx::WebPWriter, Gfx::WebPImageDecoderPlugin>(TRY_OR_FAIL(create_test_rgb_bitmap()))));
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Vector.h>
+#include <LibGfx/Color.h>
+#include <LibGfx/PixelConversion.h>
+#include <LibTest/TestCase.h>
+
+// These counts cover both the vectorized loops and the scalar loops that handle the remaining pixels.
+static constexpr size_t pixel_counts[] = { 0, 1, 3, 4, 5, 7, 8, 13, 64, 101 };
+
+static u8 test_byte(size_t index)
+{
+    return static_cast<u8>(index * 37 + (index >> 3) * 11 + 5);
+}
+
+TEST_CASE(convert_bgr888_to_rgbx8888)
+{
+    for (auto count : pixel_counts) {
+        Vector<u8> source;
+        for (size_t i = 0; i < count * 3; ++i)
+            source.append(test_byte(i));
+
+        Vector<Gfx::RawPixel> destination;
+        destination.resize(count);
+        Gfx::convert_bgr888_to_rgbx8888(source, destination);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto const* bytes = reinterpret_cast<u8 const*>(&destination[i]);
+            EXPECT_EQ(bytes[0], source[i * 3 + 2]);
+            EXPECT_EQ(bytes[1], source[i * 3 + 1]);
+            EXPECT_EQ(bytes[2], source[i * 3]);
+            EXPECT_EQ(bytes[3], 0xff);
+        }
+    }
+}
+
+TEST_CASE(convert_cmyk_to_bgrx8888)
+{
+    for (auto count : pixel_counts) {
+        Vector<Gfx::CMYK> source;
+        for (size_t i = 0; i < count; ++i)
+            source.append({ test_byte(i * 4), test_byte(i * 4 + 1), test_byte(i * 4 + 2), test_byte(i * 4 + 3) });
+
+        Vector<Gfx::RawPixel> destination;
+        destination.resize(count);
+        Gfx::convert_cmyk_to_bgrx8888(source, destination);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto const& cmyk = source[i];
+            u8 k = 255 - cmyk.k;
+            auto expected = Color((255 - cmyk.c) * k / 255, (255 - cmyk.m) * k / 255, (255 - cmyk.y) * k / 255);
+            EXPECT_EQ(Color::from_bgra(destination[i]), expected);
+        }
+    }
+}
+
+TEST_CASE(expand_palette_indices)
+{
+    Vector<Gfx::RawPixel> palette;
+    for (u32 i = 0; i < 256; ++i)
+        palette.append(0xff000000 | (i << 16) | ((255 - i) << 8) | (i * 7 % 256));
+
+    for (auto count : pixel_counts) {
+        Vector<u8> indices;
+        for (size_t i = 0; i < count; ++i)
+            indices.append(test_byte(i));
+
+        Vector<Gfx::RawPixel> destination;
+        destination.resize(count);
+        Gfx::expand_palette_indices(indices, palette, destination);
+
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(destination[i], palette[indices[i]]);
+    }
+}
+
+TEST_CASE(expand_palette_indices_with_transparent_index)
+{
+    Array<Gfx::RawPixel, 256> palette;
+    palette.fill(0xff00ff00);
+
+    u8 indices[] = { 0, 1, 2, 1, 0 };
+    u8 transparent_index = 1;
+    Gfx::RawPixel destination[] = { 1, 2, 3, 4, 5 };
+    Gfx::expand_palette_indices(indices, palette, destination, transparent_index);
+
+    EXPECT_EQ(destination[0], 0xff00ff00u);
+    EXPECT_EQ(destination[1], 2u);
+    EXPECT_EQ(destination[2], 0xff00ff00u);
+    EXPECT_EQ(destination[3], 4u);
+    EXPECT_EQ(destination[4], 0xff00ff00u);
+}
+
+TEST_CASE(premultiply_alpha)
+{
+    for (auto count : pixel_counts) {
+        Vector<Gfx::RawPixel> pixels;
+        for (size_t i = 0; i < count; ++i)
+            pixels.append(test_byte(i * 4) | (test_byte(i * 4 + 1) << 8) | (test_byte(i * 4 + 2) << 16) | (test_byte(i * 4 + 3) << 24));
+
+        auto original = pixels;
+        Gfx::premultiply_alpha(pixels);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto color = Color::from_bgra(original[i]);
+            auto rounded = [&](u8 channel) { return static_cast<u8>((channel * color.alpha() * 2 + 255) / 510); };
+            EXPECT_EQ(Color::from_bgra(pixels[i]), Color(rounded(color.red()), rounded(color.green()), rounded(color.blue()), color.alpha()));
+        }
+    }
+}
+
+TEST_CASE(unpremultiply_alpha)
+{
+    // Each premultiplied pixel should turn into the unpremultiplied pixel at the same position in the second array.
+    Gfx::RawPixel pixels[] = { 0xff123456, 0x00000000, 0x80404040, 0x40102030, 0x01010101, 0x10ffffff };
+    Gfx::RawPixel expected[] = { 0xff123456, 0x00000000, 0x80808080, 0x404080bf, 0x01ffffff, 0x10ffffff };
+
+    // Unpremultiply the pixels both one at a time and all at once, which covers both the scalar and the vectorized loop.
+    Gfx::RawPixel pixels_one_at_a_time[array_size(pixels)];
+    for (size_t i = 0; i < array_size(pixels); ++i) {
+        pixels_one_at_a_time[i] = pixels[i];
+        Gfx::unpremultiply_alpha({ &pixels_one_at_a_time[i], 1 });
+    }
+    Gfx::unpremultiply_alpha(pixels);
+
+    for (size_t i = 0; i < array_size(pixels); ++i) {
+        EXPECT_EQ(pixels[i], expected[i]);
+        EXPECT_EQ(pixels_one_at_a_time[i], expected[i]);
+    }
+}
+
+TEST_CASE(unpremultiply_alpha_undoes_premultiply_alpha)
+{
+    Vector<Gfx::RawPixel> pixels;
+    for (u32 alpha = 0; alpha < 256; ++alpha)
+        pixels.append((alpha << 24) | 0x00ff8000 | alpha);
+
+    auto original = pixels;
+    Gfx::premultiply_alpha(pixels);
+    Gfx::unpremultiply_alpha(pixels);
+
+    for (size_t alpha = 0; alpha < pixels.size(); ++alpha) {
+        auto before = Color::from_bgra(original[alpha]);
+        auto after = Color::from_bgra(pixels[alpha]);
+        EXPECT_EQ(after.alpha(), before.alpha());
+        if (alpha == 0)
+            continue;
+
+        // Premultiplying loses precision for the lower alpha values, so we can only expect the color to be close.
+        auto tolerance = static_cast<int>(255 / alpha / 2 + 1);
+        EXPECT(max(after.red(), before.red()) - min(after.red(), before.red()) <= tolerance);
+        EXPECT(max(after.green(), before.green()) - min(after.green(), before.green()) <= tolerance);
+        EXPECT(max(after.blue(), before.blue()) - min(after.blue(), before.blue()) <= tolerance);
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibHTTP/Cache/CompressionDictionary.h>
+#include <LibHTTP/HeaderList.h>
+#include <LibTest/TestCase.h>
+#include <LibURL/Parser.h>
+#include <LibURL/URL.h>
+
+static constexpr auto DICTIONARY_URL = "https://example.com/app/main.v1.js"sv;
+
+static Optional<HTTP::CompressionDictionary> create_dictionary(StringView use_as_dictionary, StringView url = DICTIONARY_URL)
+{
+    auto headers = HTTP::HeaderList::create({ { "Use-As-Dictionary", use_as_dictionary } });
+    return HTTP::CompressionDictionary::create(1, 2, url, *headers, ByteString::repeated('a', 32));
+}
+
+static bool matches(HTTP::CompressionDictionary const& dictionary, StringView url, Optional<StringView> destination = {})
+{
+    auto parsed_url = URL::Parser::basic_parse(url);
+    VERIFY(parsed_url.has_value());
+
+    return dictionary.matches(*parsed_url, destination);
+}
+
+TEST_CASE(use_as_dictionary_requires_match)
+{
+    EXPECT(!create_dictionary(""sv).has_value());
+    EXPECT(!create_dictionary("id=\"v1\""sv).has_value());
+    EXPECT(!create_dictionary("match=app"sv).has_value());
+    EXPECT(create_dictionary("match=\"/app/*\""sv).has_value());
+}
+
+TEST_CASE(use_as_dictionary_rejects_invalid_structured_fields)
+{
+    EXPECT(!create_dictionary("match=\"/app/*"sv).has_value());
+    EXPECT(!create_dictionary("match=\"/app/*\","sv).has_value());
+    EXPECT(!create_dictionary("match=\"/app/*\" id=\"v1\""sv).has_value());
+    EXPECT(!create_dictionary("match=\"/app/*\", match-dest=\"script\""sv).has_value());
+}
+
+TEST_CASE(use_as_dictionary_rejects_unknown_types)
+{
+    EXPECT(create_dictionary("match=\"/app/*\", type=raw"sv).has_value());
+    EXPECT(!create_dictionary("match=\"/app/*\", type=other"sv).has_value());
+    EXPECT(!create_dictionary("match=\"/app/*\", type=\"raw\""sv).has_value());
+}
+
+TEST_CASE(use_as_dictionary_rejects_regexp_groups)
+{
+    EXPECT(!create_dictionary("match=\"/app/(\\\\d+)/*\""sv).has_value());
+}
+
+TEST_CASE(use_as_dictionary_requires_secure_context)
+{
+    EXPECT(!create_dictionary("match=\"/app/*\""sv, "http://example.com/app/main.v1.js"sv).has_value());
+}
+
+TEST_CASE(use_as_dictionary_parses_id)
+{
+    auto dictionary = create_dictionary("match=\"/app/*\", id=\"release \\\"1\\\"\";a=1"sv);
+    VERIFY(dictionary.has_value());
+
+    EXPECT_EQ(dictionary->available_dictionary().id, "release \"1\""sv);
+    EXPECT_EQ(dictionary->available_dictionary().dictionary_id_header_value(), "\"release \\\"1\\\"\""sv);
+}
+
+TEST_CASE(available_dictionary_is_a_byte_sequence)
+{
+    auto dictionary = create_dictionary("match=\"/app/*\""sv);
+    VERIFY(dictionary.has_value());
+
+    EXPECT_EQ(dictionary->available_dictionary().available_dictionary_header_value(), ":YWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWFhYWE=:"sv);
+}
+
+TEST_CASE(dictionary_matches_same_origin_urls)
+{
+    auto dictionary = create_dictionary("match=\"/app/*\""sv);
+    VERIFY(dictionary.has_value());
+
+    EXPECT(matches(*dictionary, "https://example.com/app/main.v2.js"sv));
+    EXPECT(!matches(*dictionary, "https://example.com/other/main.v2.js"sv));
+    EXPECT(!matches(*dictionary, "https://example.org/app/main.v2.js"sv));
+    EXPECT(!matches(*dictionary, "http://example.com/app/main.v2.js"sv));
+}
+
+TEST_CASE(dictionary_matches_destinations)
+{
+    auto dictionary = create_dictionary("match=\"/app/*\", match-dest=(\"script\" \"style\")"sv);
+    VERIFY(dictionary.has_value());
+    EXPECT(dictionary->has_match_destinations());
+
+    EXPECT(matches(*dictionary, "https://example.com/app/main.v2.js"sv, "script"sv));
+    EXPECT(matches(*dictionary, "https://example.com/app/main.v2.css"sv, "style"sv));
+    EXPECT(!matches(*dictionary, "https://example.com/app/main.v2.js"sv, "image"sv));
+    EXPECT(!matches(*dictionary, "https://example.com/app/main.v2.js"sv));
+
+    auto any_destination = create_dictionary("match=\"/app/*\", match-dest=()"sv);
+    VERIFY(any_destination.has_value());
+    EXPECT(!any_destination->has_match_destinations());
+    EXPECT(matches(*any_destination, "https://example.com/app/main.v2.js"sv, "image"sv));
+}
@@ -7,6 +7,7 @@
 #include <AK/Atomic.h>
 #include <AK/Function.h>
 #include <AK/Time.h>
+#include <AK/Vector.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Socket.h>
 #include <LibCore/System.h>
@@ -93,3 +94,51 @@ TEST_CASE(read_hook_is_notified_when_io_thread_exits_on_close)
 
     EXPECT(observed_shutdown.load(AK::MemoryOrder::memory_order_relaxed));
 }
+
+TEST_CASE(large_and_small_messages_are_received_intact)
+{
+    Core::EventLoop loop;
+
+    int fds[2] = {};
+    MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+
+    auto reader_socket = TRY_OR_FAIL(Core::LocalSocket::adopt_fd(fds[0]));
+    auto writer_socket = TRY_OR_FAIL(Core::LocalSocket::adopt_fd(fds[1]));
+
+    MUST(reader_socket->set_blocking(false));
+    MUST(writer_socket->set_blocking(false));
+
+    IPC::TransportSocket reader(move(reader_socket));
+    IPC::TransportSocket writer(move(writer_socket));
+
+    // The large message is sent through shared memory, while the small one goes through the socket.
+    Vector<u8> large_message;
+    large_message.resize(IPC::TransportSocket::SOCKET_BUFFER_SIZE * 2);
+    for (size_t i = 0; i < large_message.size(); ++i)
+        large_message[i] = static_cast<u8>(i * 7);
+
+    Vector<u8> small_message { 1, 2, 3, 4 };
+
+    Vector<IPC::Attachment> attachments;
+    writer.post_message(large_message, attachments);
+    writer.post_message(small_message, attachments);
+
+    Vector<Vector<u8>> received_messages;
+
+    reader.set_up_read_hook([&] {
+        (void)reader.read_as_many_messages_as_possible_without_blocking([&](auto&& message) {
+            EXPECT(message.attachments.is_empty());
+            Vector<u8> bytes;
+            bytes.append(message.payload().data(), message.payload().size());
+            received_messages.append(move(bytes));
+        });
+    });
+
+    spin_until(loop, [&] {
+        return received_messages.size() == 2;
+    });
+
+    EXPECT_EQ(received_messages.size(), 2u);
+    EXPECT_EQ(received_messages[0], large_message);
+    EXPECT_EQ(received_messages[1], small_message);
+}
@@ -0,0 +1,11 @@
+// Short-lived objects, arrays, strings and closures, almost none of which survive the next collection.
+let checksum = 0;
+for (let i = 0; i < 300_000; ++i) {
+    const point = { x: i, y: i * 2, label: "point" + (i % 100) };
+    const pair = [point, { ...point, y: -point.y }];
+    const add = value => value + pair[1].y;
+    checksum = (checksum + add(point.x) + pair.length + point.label.length) | 0;
+}
+
+if (checksum === 0.5)
+    throw new Error("unreachable");
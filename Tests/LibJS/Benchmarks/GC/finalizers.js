@@ -0,0 +1,24 @@
+// Objects registered with finalization registries, which need their cleanup callbacks scheduled when they die.
+let finalizedCount = 0;
+const registries = [];
+for (let i = 0; i < 16; ++i)
+    registries.push(new FinalizationRegistry(() => ++finalizedCount));
+
+const tokens = [];
+for (let i = 0; i < 100_000; ++i) {
+    const target = { index: i, payload: [i] };
+    const token = {};
+    registries[i % registries.length].register(target, i, token);
+
+    // Some of the registrations are undone again before their targets die.
+    if (i % 4 === 0)
+        tokens.push({ registry: registries[i % registries.length], token });
+    if (tokens.length > 1000) {
+        for (const { registry, token } of tokens)
+            registry.unregister(token);
+        tokens.length = 0;
+    }
+}
+
+if (finalizedCount < 0)
+    throw new Error("unreachable");
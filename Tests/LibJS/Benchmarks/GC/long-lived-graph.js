@@ -0,0 +1,24 @@
+// A large object graph that stays alive throughout, and has to be marked by every collection, while short-lived
+// garbage keeps triggering those collections.
+function makeTree(depth) {
+    if (depth === 0)
+        return { value: depth };
+    return { left: makeTree(depth - 1), right: makeTree(depth - 1), value: depth };
+}
+
+const retained = [];
+for (let i = 0; i < 16; ++i)
+    retained.push(makeTree(13));
+
+// Some edges between the trees, so that the graph isn't just a forest.
+for (let i = 0; i < retained.length; ++i)
+    retained[i].sibling = retained[(i + 1) % retained.length];
+
+let checksum = 0;
+for (let i = 0; i < 200_000; ++i) {
+    const garbage = { index: i, values: [i, i + 1, i + 2] };
+    checksum = (checksum + garbage.values[i % 3]) | 0;
+}
+
+if (retained[0].sibling !== retained[1] || checksum === 0.5)
+    throw new Error("unreachable");
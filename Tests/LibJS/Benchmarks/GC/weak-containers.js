@@ -0,0 +1,28 @@
+// Weak containers whose entries keep dying, which every collection has to sweep.
+const weakMaps = [];
+const weakSets = [];
+for (let i = 0; i < 64; ++i) {
+    weakMaps.push(new WeakMap());
+    weakSets.push(new WeakSet());
+}
+
+const survivors = [];
+let weakRefs = [];
+
+for (let i = 0; i < 200_000; ++i) {
+    const key = { index: i };
+    weakMaps[i % weakMaps.length].set(key, { value: i });
+    weakSets[i % weakSets.length].add(key);
+
+    // A few of the keys stay alive, so that not every entry of the containers dies.
+    if (i % 1000 === 0)
+        survivors.push(key);
+
+    if (i % 10 === 0)
+        weakRefs.push(new WeakRef(key));
+    if (weakRefs.length > 10_000)
+        weakRefs = [];
+}
+
+if (!weakMaps[0].has(survivors[0]) || !weakSets[0].has(survivors[0]))
+    throw new Error("Lost a live key");
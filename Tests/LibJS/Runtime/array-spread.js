@@ -0,0 +1,45 @@
+test("spreading packed arrays", () => {
+    const a = [1, 2, 3];
+    expect([0, ...a, 4]).toEqual([0, 1, 2, 3, 4]);
+    expect(Math.max(...a)).toBe(3);
+
+    const [first, ...rest] = a;
+    expect(first).toBe(1);
+    expect(rest).toEqual([2, 3]);
+});
+
+test("spreading honors a replaced iterator", () => {
+    const a = [1, 2, 3];
+    a[Symbol.iterator] = function* () {
+        yield "x";
+    };
+    expect([...a]).toEqual(["x"]);
+
+    const values = Array.prototype[Symbol.iterator];
+    try {
+        Array.prototype[Symbol.iterator] = function* () {
+            yield "y";
+        };
+        expect([...[1, 2]]).toEqual(["y"]);
+    } finally {
+        Array.prototype[Symbol.iterator] = values;
+    }
+});
+
+test("spreading honors a replaced next method", () => {
+    const arrayIteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+    const next = arrayIteratorPrototype.next;
+    try {
+        let calls = 0;
+        arrayIteratorPrototype.next = function () {
+            ++calls;
+            return next.call(this);
+        };
+        expect([...[1, 2]]).toEqual([1, 2]);
+        const [, ...rest] = [1, 2, 3];
+        expect(rest).toEqual([2, 3]);
+        expect(calls).toBe(7);
+    } finally {
+        arrayIteratorPrototype.next = next;
+    }
+});
@@ -49,3 +49,17 @@ test("throws when appending to a non-extensible packed array", () => {
     }).toThrow(TypeError);
     expect(a).toEqual([1, 2]);
 });
+
+test("called through an alias or on a non-array", () => {
+    const push = Array.prototype.push;
+    const a = [1];
+    expect(push.call(a, 2, 3)).toBe(3);
+    expect(a).toEqual([1, 2, 3]);
+
+    const o = { length: 1, push };
+    expect(o.push("x")).toBe(2);
+    expect(o[1]).toBe("x");
+    expect(o.length).toBe(2);
+
+    expect(() => push.call(undefined, 1)).toThrow(TypeError);
+});
@@ -0,0 +1,55 @@
+describe("storing to the append position or a hole", () => {
+    test("filling an empty array", () => {
+        const a = [];
+        for (let i = 0; i < 100; ++i) a[i] = i * 2;
+        expect(a).toHaveLength(100);
+        expect(a[0]).toBe(0);
+        expect(a[99]).toBe(198);
+    });
+
+    test("filling holes", () => {
+        const a = new Array(10);
+        for (let i = 9; i >= 0; --i) a[i] = i;
+        expect(a).toEqual([0, 1, 2, 3, 4, 5, 6, 7, 8, 9]);
+    });
+
+    test("setter on Array.prototype is called", () => {
+        let setterValue;
+        Object.defineProperty(Array.prototype, 1, {
+            set(value) {
+                setterValue = value;
+            },
+            configurable: true,
+        });
+        try {
+            const a = [0];
+            a[1] = "foo";
+            expect(setterValue).toBe("foo");
+            expect(a).toHaveLength(1);
+            expect(Object.hasOwn(a, 1)).toBeFalse();
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+
+    test("non-writable length", () => {
+        const a = [1, 2, 3];
+        Object.defineProperty(a, "length", { writable: false });
+        a[3] = 4;
+        expect(a).toHaveLength(3);
+        expect(a[3]).toBeUndefined();
+        expect(() => {
+            "use strict";
+            a[3] = 4;
+        }).toThrow(TypeError);
+    });
+
+    test("non-extensible array", () => {
+        const a = [1, , 3];
+        Object.preventExtensions(a);
+        a[1] = 2;
+        a[3] = 4;
+        expect(Object.hasOwn(a, 1)).toBeFalse();
+        expect(a).toHaveLength(3);
+    });
+});
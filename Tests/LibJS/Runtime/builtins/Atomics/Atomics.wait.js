@@ -70,4 +70,18 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.wait).toHaveLength(4);
     });
+
+    test("value not equal", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        typedArray[0] = 1;
+        expect(Atomics.wait(typedArray, 0, 0, 0)).toBe("not-equal");
+    });
+
+    test("timed out", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        expect(Atomics.wait(typedArray, 0, 0, 0)).toBe("timed-out");
+
+        const bigTypedArray = new BigInt64Array(new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT));
+        expect(Atomics.wait(bigTypedArray, 0, 0n, 0)).toBe("timed-out");
+    });
 });
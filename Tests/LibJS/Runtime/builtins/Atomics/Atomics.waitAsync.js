@@ -70,4 +70,45 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.waitAsync).toHaveLength(4);
     });
+
+    test("value not equal", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        typedArray[0] = 1;
+        const result = Atomics.waitAsync(typedArray, 0, 0, 0);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("not-equal");
+    });
+
+    test("timed out immediately", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        const result = Atomics.waitAsync(typedArray, 0, 0, 0);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("timed-out");
+    });
+
+    test("woken up by notify", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        const first = Atomics.waitAsync(typedArray, 0, 0);
+        const second = Atomics.waitAsync(typedArray, 0, 0);
+        expect(first.async).toBeTrue();
+        expect(first.value).toBeInstanceOf(Promise);
+
+        let results = [];
+        first.value.then(value => results.push(["first", value]));
+        second.value.then(value => results.push(["second", value]));
+
+        expect(Atomics.notify(typedArray, 1)).toBe(0);
+        expect(Atomics.notify(typedArray, 0, 1)).toBe(1);
+        runQueuedPromiseJobs();
+        expect(results).toEqual([["first", "ok"]]);
+
+        expect(Atomics.notify(typedArray, 0)).toBe(1);
+        runQueuedPromiseJobs();
+        expect(results).toEqual([
+            ["first", "ok"],
+            ["second", "ok"],
+        ]);
+
+        expect(Atomics.notify(typedArray, 0)).toBe(0);
+    });
 });
@@ -144,3 +144,25 @@ test("whitespace handling", () => {
     expect(JSON.parse("  {  }  ")).toEqual({});
     expect(JSON.parse("  [  ]  ")).toEqual([]);
 });
+
+test("arrays of objects with similar keys", () => {
+    const result = JSON.parse(
+        '[{"a":1,"b":2},{"a":3,"b":4},{"b":5,"a":6},{"a":7},{"a":8,"b":9,"c":10},{"a":1,"a":2,"b":3},{"0":1,"a":2},{"\\u0061":11,"b":12},{"a":{"a":13,"b":14},"b":15}]'
+    );
+    expect(result).toHaveLength(9);
+    expect(Object.keys(result[0])).toEqual(["a", "b"]);
+    expect(result[1]).toEqual({ a: 3, b: 4 });
+    expect(Object.keys(result[2])).toEqual(["b", "a"]);
+    expect(result[2]).toEqual({ b: 5, a: 6 });
+    expect(result[3]).toEqual({ a: 7 });
+    expect(result[4]).toEqual({ a: 8, b: 9, c: 10 });
+    expect(result[5]).toEqual({ a: 2, b: 3 });
+    expect(Object.keys(result[6])).toEqual(["0", "a"]);
+    expect(result[7]).toEqual({ a: 11, b: 12 });
+    expect(result[8].a).toEqual({ a: 13, b: 14 });
+    expect(result[8].b).toBe(15);
+
+    result[1].c = 16;
+    expect(result[0].c).toBeUndefined();
+    expect(Object.keys(result[1])).toEqual(["a", "b", "c"]);
+});
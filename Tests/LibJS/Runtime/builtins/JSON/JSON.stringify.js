@@ -149,3 +149,52 @@ describe("errors", () => {
         });
     });
 });
+
+describe("objects sharing a shape", () => {
+    test("keys are escaped once and reused", () => {
+        const records = [];
+        for (let i = 0; i < 5; ++i) records.push({ 'a"b': i, "\n": "x", [Symbol()]: 1 });
+        expect(JSON.stringify(records)).toBe(
+            '[{"a\\"b":0,"\\n":"x"},{"a\\"b":1,"\\n":"x"},{"a\\"b":2,"\\n":"x"},{"a\\"b":3,"\\n":"x"},{"a\\"b":4,"\\n":"x"}]'
+        );
+    });
+
+    test("getters and non-enumerable properties", () => {
+        const make = i => {
+            const o = {
+                a: i,
+                get b() {
+                    return i * 2;
+                },
+            };
+            Object.defineProperty(o, "hidden", { value: 1, enumerable: false });
+            return o;
+        };
+        expect(JSON.stringify([make(1), make(2)])).toBe('[{"a":1,"b":2},{"a":2,"b":4}]');
+    });
+
+    test("object reshaped while its properties are being serialized", () => {
+        const o = {
+            a: 1,
+            b: {
+                toJSON() {
+                    delete o.c;
+                    o.d = 4;
+                    return 2;
+                },
+            },
+            c: 3,
+        };
+        const p = { a: 1, b: 2, c: 3 };
+        expect(JSON.stringify([p, o, p])).toBe('[{"a":1,"b":2,"c":3},{"a":1,"b":2},{"a":1,"b":2,"c":3}]');
+    });
+
+    test("property value replaced by an earlier replacer call", () => {
+        const o = { a: 1, b: 2 };
+        const result = JSON.stringify(o, function (key, value) {
+            if (key === "a") o.b = 20;
+            return value;
+        });
+        expect(result).toBe('{"a":1,"b":20}');
+    });
+});
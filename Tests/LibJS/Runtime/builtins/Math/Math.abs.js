@@ -16,3 +16,17 @@ test("basic functionality", () => {
 test("i32 min value", () => {
     expect(Math.abs(-2_147_483_648)).toBe(2_147_483_648);
 });
+
+test("called through an alias", () => {
+    const { abs } = Math;
+    expect(abs(-2)).toBe(2);
+    expect(abs(-2, 3)).toBe(2);
+    expect(abs()).toBeNaN();
+    expect(() => {
+        abs({
+            valueOf() {
+                throw new RangeError();
+            },
+        });
+    }).toThrow(RangeError);
+});
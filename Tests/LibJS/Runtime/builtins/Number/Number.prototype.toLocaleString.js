@@ -76,3 +76,32 @@ describe("styles", () => {
         ).toBe("\u0661\u066b\u0662\u0663 كيلومتر في الساعة");
     });
 });
+
+describe("repeated calls", () => {
+    test("alternating locales", () => {
+        for (let i = 0; i < 3; ++i) {
+            expect((12345.6).toLocaleString("en")).toBe("12,345.6");
+            expect((12345.6).toLocaleString("de")).toBe("12.345,6");
+            expect((12345.6).toLocaleString()).toBe("12,345.6");
+            expect((12345.6).toLocaleString("de", { maximumFractionDigits: 0 })).toBe("12.346");
+        }
+    });
+
+    test("more locales than are kept around", () => {
+        const locales = ["en", "de", "fr", "es", "it", "pt", "nl", "sv", "da", "fi", "pl", "cs", "ru", "ja", "zh", "ko", "ar", "he"];
+        const expected = locales.map(locale => new Intl.NumberFormat(locale).format(1234.5));
+        for (let i = 0; i < 2; ++i) {
+            locales.forEach((locale, index) => {
+                expect((1234.5).toLocaleString(locale)).toBe(expected[index]);
+            });
+        }
+    });
+
+    test("invalid locale still throws", () => {
+        for (let i = 0; i < 2; ++i) {
+            expect(() => {
+                (1).toLocaleString("en-");
+            }).toThrowWithMessage(RangeError, "en- is not a structurally valid language tag");
+        }
+    });
+});
@@ -22,3 +22,12 @@ test("UTF-16", () => {
     expect("😀".concat("a", 4)).toBe("😀a4");
     expect("😀".concat("a", "😀")).toBe("😀a😀");
 });
+
+test("length of a string built by repeated concatenation", () => {
+    let s = "";
+    for (let i = 0; i < 200; ++i) {
+        s += i % 2 ? "é" : "😀";
+        expect(s).toHaveLength(i + 1 + Math.ceil((i + 1) / 2));
+    }
+    expect(s.slice(0, 3)).toBe("😀é");
+});
@@ -25,3 +25,21 @@ test("UTF-16", () => {
     expect(s.slice(0, 1)).toBe("\ud83d");
     expect(s.slice(0, 2)).toBe("😀");
 });
+
+test("long slices", () => {
+    const base = "abcdefghij".repeat(100) + "😀" + "0123456789".repeat(100);
+    const slice = base.slice(500, 1500);
+    expect(slice).toHaveLength(1000);
+    expect(slice.slice(0, 10)).toBe("abcdefghij");
+    expect(slice.slice(500, 502)).toBe("😀");
+    expect(slice.slice(400, 900).slice(100, 102)).toBe("😀");
+    expect(slice + "!").toBe(base.substring(500, 1500) + "!");
+    expect(("<" + slice.slice(501) + ">").slice(-11)).toBe("123456789>");
+    expect(slice === base.substr(500, 1000)).toBeTrue();
+});
+
+test("concatenating surrogate halves", () => {
+    const s = "😀";
+    expect(s.slice(0, 1) + s.slice(1)).toBe("😀");
+    expect((s.slice(0, 1) + s.slice(1)).codePointAt(0)).toBe(0x1f600);
+});
@@ -76,3 +76,13 @@ test("basic functionality", () => {
         expect(typedArray[2]).toBe(0n);
     });
 });
+
+test("values that need conversion", () => {
+    expect(Array.from(new Int8Array(3).fill(257.9))).toEqual([1, 1, 1]);
+    expect(Array.from(new Uint8ClampedArray(3).fill(300))).toEqual([255, 255, 255]);
+    expect(Array.from(new Uint8ClampedArray(3).fill(1.5))).toEqual([2, 2, 2]);
+    expect(Array.from(new Float32Array(3).fill(0.1))).toEqual([Math.fround(0.1), Math.fround(0.1), Math.fround(0.1)]);
+    expect(Array.from(new Float64Array(2).fill(-0)).map(x => Object.is(x, -0))).toEqual([true, true]);
+    expect(Array.from(new Uint16Array(3).fill("7", 1))).toEqual([0, 7, 7]);
+    expect(Array.from(new BigInt64Array(2).fill(2n ** 64n + 3n))).toEqual([3n, 3n]);
+});
@@ -63,3 +63,21 @@ test("basic functionality", () => {
         expect(typedArray.includes(2n, -2)).toBe(true);
     });
 });
+
+test("searching long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100);
+        typedArray[70] = 5;
+
+        expect(typedArray.includes(5)).toBeTrue();
+        expect(typedArray.includes(5, 71)).toBeFalse();
+        expect(typedArray.includes(6)).toBeFalse();
+    });
+
+    const floats = new Float64Array(50);
+    expect(floats.includes(NaN)).toBeFalse();
+    floats[33] = NaN;
+    expect(floats.includes(NaN)).toBeTrue();
+    expect(floats.includes(NaN, 34)).toBeFalse();
+    expect(new Float32Array([1, 2, 3, 4, 5, NaN]).includes(NaN)).toBeTrue();
+});
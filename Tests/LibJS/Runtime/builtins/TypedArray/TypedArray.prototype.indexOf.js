@@ -63,3 +63,25 @@ test("basic functionality", () => {
         expect(typedArray.indexOf(2n, -2)).toBe(1);
     });
 });
+
+test("searching long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100);
+        typedArray[37] = 5;
+        typedArray[70] = 5;
+
+        expect(typedArray.indexOf(5)).toBe(37);
+        expect(typedArray.indexOf(5, 38)).toBe(70);
+        expect(typedArray.indexOf(5, 71)).toBe(-1);
+        expect(typedArray.indexOf(5.5)).toBe(-1);
+        expect(typedArray.indexOf(-0)).toBe(0);
+        expect(typedArray.indexOf(NaN)).toBe(-1);
+        expect(typedArray.indexOf("5")).toBe(-1);
+    });
+
+    expect(new Uint8Array(40).indexOf(256)).toBe(-1);
+    expect(new Int8Array([0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1]).indexOf(255)).toBe(-1);
+    expect(new Int8Array([0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1]).indexOf(-1)).toBe(17);
+    expect(new Float32Array([0, 0, 0, 0, 0, 0.1]).indexOf(0.1)).toBe(-1);
+    expect(new Float32Array([0, 0, 0, 0, 0, 0.5]).indexOf(0.5)).toBe(5);
+});
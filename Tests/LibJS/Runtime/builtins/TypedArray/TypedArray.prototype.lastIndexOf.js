@@ -63,3 +63,17 @@ test("basic functionality", () => {
         expect(typedArray.lastIndexOf(2n, -2)).toBe(1);
     });
 });
+
+test("searching long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100);
+        typedArray[3] = 5;
+        typedArray[37] = 5;
+
+        expect(typedArray.lastIndexOf(5)).toBe(37);
+        expect(typedArray.lastIndexOf(5, 36)).toBe(3);
+        expect(typedArray.lastIndexOf(5, 2)).toBe(-1);
+        expect(typedArray.lastIndexOf(0)).toBe(99);
+        expect(typedArray.lastIndexOf(NaN)).toBe(-1);
+    });
+});
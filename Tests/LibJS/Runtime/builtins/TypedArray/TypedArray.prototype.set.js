@@ -113,6 +113,33 @@ describe("normal behavior", () => {
         TYPED_ARRAYS.forEach(T => argumentTests(T));
         BIGINT_TYPED_ARRAYS.forEach(T => argumentTests(T));
     });
+
+    test("set from Array converts each element and honors the offset", () => {
+        const int8 = new Int8Array(5);
+        int8.set([1, 255, 1.5, -129], 1);
+        expect(Array.from(int8)).toEqual([0, 1, -1, 1, 127]);
+
+        const float32 = new Float32Array(3);
+        float32.set([0.1, NaN, -0]);
+        expect(float32[0]).toBe(Math.fround(0.1));
+        expect(float32[1]).toBeNaN();
+        expect(Object.is(float32[2], -0)).toBeTrue();
+    });
+
+    test("set from Array with elements that need user code to convert", () => {
+        const source = [1, 2, 3];
+        const valueOfArray = {
+            valueOf() {
+                source[2] = 42;
+                return 7;
+            },
+        };
+        source[1] = valueOfArray;
+
+        const typedArray = new Uint8Array(3);
+        typedArray.set(source);
+        expect(Array.from(typedArray)).toEqual([1, 7, 42]);
+    });
 });
 
 test("length is 1", () => {
@@ -777,3 +777,60 @@ describe("constructor patterns with dictionaries", () => {
         expect(things[4].p10).toBe(50);
     });
 });
+
+describe("property tables shared between shapes", () => {
+    test("sibling shapes diverging from a common prefix", () => {
+        const make = () => {
+            const o = {};
+            for (let i = 0; i < 20; i++) o["common" + i] = i;
+            return o;
+        };
+        const a = make();
+        const b = make();
+        a.onlyA = "a";
+        b.onlyB = "b";
+        expect(Object.keys(a).at(-1)).toBe("onlyA");
+        expect(Object.keys(b).at(-1)).toBe("onlyB");
+        expect(Object.hasOwn(a, "onlyB")).toBeFalse();
+        expect(Object.hasOwn(b, "onlyA")).toBeFalse();
+        expect(a.common19).toBe(19);
+        expect(b.common0).toBe(0);
+    });
+
+    test("shorter shape does not see properties added by a longer one", () => {
+        const short = { x: 1 };
+        const long = { x: 1 };
+        for (let i = 0; i < 20; i++) long["p" + i] = i;
+        expect(short.p0).toBeUndefined();
+        expect(Object.keys(short)).toEqual(["x"]);
+        short.p0 = "short";
+        expect(short.p0).toBe("short");
+        expect(long.p0).toBe(0);
+    });
+
+    test("deleting the last property of a dictionary object", () => {
+        const obj = {};
+        for (let i = 0; i < 100; i++) obj["k" + i] = i;
+        for (let i = 99; i >= 50; i--) delete obj["k" + i];
+        expect(Object.keys(obj)).toHaveLength(50);
+        expect(obj.k49).toBe(49);
+        expect(obj.k50).toBeUndefined();
+        obj.k50 = "again";
+        expect(Object.keys(obj).at(-1)).toBe("k50");
+    });
+
+    test("deleting from the middle of a dictionary object keeps order", () => {
+        const obj = {};
+        for (let i = 0; i < 100; i++) obj["k" + i] = i;
+        delete obj.k10;
+        delete obj.k42;
+        const keys = Object.keys(obj);
+        expect(keys).toHaveLength(98);
+        expect(keys[10]).toBe("k11");
+        expect(keys[41]).toBe("k43");
+        for (let i = 0; i < 100; i++) {
+            if (i === 10 || i === 42) expect(obj["k" + i]).toBeUndefined();
+            else expect(obj["k" + i]).toBe(i);
+        }
+    });
+});
@@ -0,0 +1,70 @@
+function keysOf(object) {
+    const keys = [];
+    for (const key in object) keys.push(key);
+    return keys;
+}
+
+test("objects with the same shape enumerate the same keys", () => {
+    for (let i = 0; i < 10; ++i) {
+        expect(keysOf({ a: i, b: i, c: i })).toEqual(["a", "b", "c"]);
+    }
+});
+
+test("adding a property to a prototype between loops", () => {
+    const proto = { x: 1 };
+    const object = Object.create(proto);
+    object.own = 2;
+
+    expect(keysOf(object)).toEqual(["own", "x"]);
+    proto.y = 3;
+    expect(keysOf(object)).toEqual(["own", "x", "y"]);
+    delete proto.x;
+    expect(keysOf(object)).toEqual(["own", "y"]);
+});
+
+test("making a prototype property non-enumerable between loops", () => {
+    const proto = { x: 1 };
+    const object = Object.create(proto);
+
+    expect(keysOf(object)).toEqual(["x"]);
+    Object.defineProperty(proto, "x", { enumerable: false });
+    expect(keysOf(object)).toEqual([]);
+});
+
+test("adding an indexed property to Object.prototype between loops", () => {
+    expect(keysOf({ a: 1 })).toEqual(["a"]);
+    try {
+        Object.prototype[0] = "zero";
+        expect(keysOf({ a: 1 })).toEqual(["a", "0"]);
+    } finally {
+        delete Object.prototype[0];
+    }
+    expect(keysOf({ a: 1 })).toEqual(["a"]);
+});
+
+test("deleting a key during enumeration", () => {
+    for (let i = 0; i < 3; ++i) {
+        const object = { a: 1, b: 2, c: 3 };
+        const keys = [];
+        for (const key in object) {
+            keys.push(key);
+            if (key === "a") delete object.b;
+        }
+        expect(keys).toEqual(["a", "c"]);
+    }
+});
+
+test("deleting a shadowing own property during enumeration", () => {
+    const proto = { a: "proto" };
+    for (let i = 0; i < 3; ++i) {
+        const object = Object.create(proto);
+        object.a = "own";
+        object.b = "own";
+        const keys = [];
+        for (const key in object) {
+            keys.push(key);
+            delete object.a;
+        }
+        expect(keys).toEqual(["a", "b"]);
+    }
+});
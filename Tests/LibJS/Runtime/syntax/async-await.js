@@ -757,3 +757,39 @@ describe("await observably looks up constructor of Promise objects", () => {
     runQueuedPromiseJobs();
     expect(calls).toBe(4);
 });
+
+describe("awaiting pending promises repeatedly", () => {
+    test("fulfilled and rejected promises resume the same function in order", () => {
+        const resolvers = [];
+        const makePending = () =>
+            new Promise((resolve, reject) => {
+                resolvers.push({ resolve, reject });
+            });
+
+        const log = [];
+        async function f(name) {
+            log.push(`${name}: ${await makePending()}`);
+            try {
+                await makePending();
+            } catch (e) {
+                log.push(`${name}: caught ${e}`);
+            }
+            log.push(`${name}: ${await makePending()}`);
+            return name;
+        }
+
+        let results = [];
+        f("a").then(value => results.push(value));
+        f("b").then(value => results.push(value));
+
+        for (let i = 0; resolvers.length > 0; ++i) {
+            const { resolve, reject } = resolvers.shift();
+            if (i % 4 === 2 || i % 4 === 3) reject(i);
+            else resolve(i);
+            runQueuedPromiseJobs();
+        }
+
+        expect(log).toEqual(["a: 0", "b: 1", "a: caught 2", "b: caught 3", "a: 4", "b: 5"]);
+        expect(results).toEqual(["a", "b"]);
+    });
+});
@@ -1910,3 +1910,145 @@ TEST_CASE(optimizer_simple_compare_char_class)
         EXPECT_EQ(re.match("abc"sv).success, false);
     }
 }
+
+TEST_CASE(optimizer_nfa_search)
+{
+    struct _test {
+        StringView pattern;
+        StringView subject;
+        ECMAScriptFlags options {};
+    };
+
+    // Searching a long input for these patterns should find the same matches as the backtracking matcher does.
+    constexpr _test tests[] {
+        { "(a|ab)(c|bcd)(d*)"sv, "abcd"sv },
+        { "(?:a?)*b"sv, "aab"sv },
+        { "(a*)*b"sv, "aaab"sv },
+        { "x(?:y|z)+?w"sv, "xyzyw"sv },
+        { "\\bfoo\\b"sv, "a foo b"sv },
+        { "(?<word>[a-z]+)@"sv, "hello@"sv },
+        { "(?:^abc|def)"sv, "xabcdef"sv },
+        { "caf\\u00e9+"sv, "CAFÉé"sv, ECMAScriptFlags::Insensitive },
+        { "(\\u{1F600}|b)+c"sv, "b\U0001F600bc"sv, ECMAScriptFlags::Unicode },
+        { "(?:a|b)*?c"sv, "ababx"sv },
+    };
+
+    auto padding = ByteString::repeated('#', 300);
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.pattern, (ECMAScriptFlags)regex::AllFlags::Global | test.options);
+        EXPECT_EQ(re.parser_result.error, regex::Error::NoError);
+
+        auto short_subject = Utf16String::from_utf8(test.subject);
+        auto long_subject = Utf16String::from_utf8(ByteString::formatted("{}{}", padding, test.subject));
+
+        auto expected = re.match(Utf16View { short_subject });
+        auto result = re.match(Utf16View { long_subject });
+
+        EXPECT_EQ(result.success, expected.success);
+        EXPECT_EQ(result.matches.size(), expected.matches.size());
+        if (!result.success || result.matches.size() != expected.matches.size())
+            continue;
+
+        for (size_t i = 0; i < result.matches.size(); ++i) {
+            EXPECT_EQ(result.matches[i].view.to_byte_string(), expected.matches[i].view.to_byte_string());
+            EXPECT_EQ(result.matches[i].column, expected.matches[i].column + padding.length());
+
+            if (i >= expected.capture_group_matches.size())
+                continue;
+            EXPECT_EQ(result.capture_group_matches[i].size(), expected.capture_group_matches[i].size());
+            if (result.capture_group_matches[i].size() != expected.capture_group_matches[i].size())
+                continue;
+            for (size_t j = 0; j < expected.capture_group_matches[i].size(); ++j) {
+                auto const& capture = result.capture_group_matches[i][j];
+                auto const& expected_capture = expected.capture_group_matches[i][j];
+                EXPECT_EQ(capture.view.is_null(), expected_capture.view.is_null());
+                if (!expected_capture.view.is_null())
+                    EXPECT_EQ(capture.view.to_byte_string(), expected_capture.view.to_byte_string());
+            }
+        }
+    }
+
+    Regex<ECMA262> re("[a-z]+@"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+    EXPECT(re.parser_result.optimization_data.nfa_program.has_value());
+}
+
+TEST_CASE(optimizer_literal_prefix)
+{
+    {
+        Regex<ECMA262> re("foo(bar|baz)"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+        EXPECT(re.parser_result.optimization_data.literal_prefix.size() >= 3);
+
+        auto subject = Utf16String::from_utf8("fo foo fobar foobaz foobar foo"sv);
+        auto result = re.match(Utf16View { subject });
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view.to_byte_string(), "foobaz"sv);
+        EXPECT_EQ(result.matches[0].column, 13u);
+        EXPECT_EQ(result.matches[1].view.to_byte_string(), "foobar"sv);
+        EXPECT_EQ(result.matches[1].column, 20u);
+    }
+
+    // Case-insensitive patterns don't have a literal prefix.
+    {
+        Regex<ECMA262> re("foo"sv, combine_flags(ECMAScriptFlags::Global, ECMAScriptFlags::Insensitive));
+        EXPECT(re.parser_result.optimization_data.literal_prefix.is_empty());
+
+        auto subject = Utf16String::from_utf8("xFOOx"sv);
+        EXPECT_EQ(re.match(Utf16View { subject }).success, true);
+    }
+
+    // Positions are counted in code points in Unicode mode.
+    {
+        Regex<ECMA262> re("\\u{1F600}a"sv, combine_flags(ECMAScriptFlags::Global, ECMAScriptFlags::Unicode));
+        EXPECT_EQ(re.parser_result.optimization_data.literal_prefix.size(), 3u);
+
+        auto subject = Utf16String::from_utf8("x\U0001F600b\U0001F600a"sv);
+        auto result = re.match(Utf16View { subject });
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches[0].column, 3u);
+    }
+}
+
+TEST_CASE(parser_cache_shares_bytecode)
+{
+    Regex<ECMA262> re1("shared[0-9]+(?<name>bytecode)"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+    Regex<ECMA262> re2("shared[0-9]+(?<name>bytecode)"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+    Regex<ECMA262> re3("shared[0-9]+(?<name>bytecode)"sv, combine_flags(ECMAScriptFlags::Global, ECMAScriptFlags::Insensitive));
+
+    auto const& bytecode1 = re1.parser_result.bytecode.get<regex::FlatByteCode>();
+    auto const& bytecode2 = re2.parser_result.bytecode.get<regex::FlatByteCode>();
+    auto const& bytecode3 = re3.parser_result.bytecode.get<regex::FlatByteCode>();
+    EXPECT_EQ(bytecode1.flat_data().data(), bytecode2.flat_data().data());
+    EXPECT_NE(bytecode1.flat_data().data(), bytecode3.flat_data().data());
+
+    auto result = re2.match("shared42bytecode"sv);
+    EXPECT_EQ(result.success, true);
+    EXPECT_EQ(bytecode2.get_string(result.capture_group_matches.at(0).at(0).capture_group_name), "name"sv);
+}
+
+TEST_CASE(catastrophic_backtracking_falls_back_to_nfa)
+{
+    struct _test {
+        StringView pattern;
+        StringView subject;
+        bool matches;
+    };
+
+    // Without the NFA fallback, these would take exponential time in the backtracking matcher.
+    constexpr _test tests[] {
+        { "(a+)+b"sv, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"sv, false },
+        { "(x+x+)+y"sv, "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"sv, false },
+        { "^(\\w+\\s?)*$"sv, "An input string that would take forever to match!"sv, false },
+        { "(a|aa)+c"sv, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaac"sv, true },
+    };
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.pattern, (ECMAScriptFlags)regex::AllFlags::Global);
+        EXPECT(re.parser_result.optimization_data.nfa_program.has_value());
+
+        auto subject = Utf16String::from_utf8(test.subject);
+        EXPECT_EQ(re.match(Utf16View { subject }).success, test.matches);
+    }
+}
@@ -48,3 +48,34 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+TEST_CASE(test_single_byte_decode)
+{
+    auto windows_1252_decoder = TextCodec::decoder_for("windows-1252"sv);
+    EXPECT(windows_1252_decoder.has_value());
+    EXPECT_EQ(MUST(windows_1252_decoder->to_utf8("Caf\xe9 au lait \x80 5, na\xefve"sv)), "Café au lait € 5, naïve"sv);
+    EXPECT_EQ(MUST(windows_1252_decoder->to_utf8("\xe9\xe8"sv)), "éè"sv);
+    EXPECT_EQ(MUST(windows_1252_decoder->to_utf8("plain ASCII"sv)), "plain ASCII"sv);
+    EXPECT_EQ(MUST(windows_1252_decoder->to_utf8(""sv)), ""sv);
+
+    auto latin1_decoder = TextCodec::decoder_for_exact_name("iso-8859-1"sv);
+    EXPECT(latin1_decoder.has_value());
+    EXPECT_EQ(MUST(latin1_decoder->to_utf8("Caf\xe9 \xff"sv)), "Café ÿ"sv);
+
+    auto x_user_defined_decoder = TextCodec::decoder_for("x-user-defined"sv);
+    EXPECT(x_user_defined_decoder.has_value());
+    EXPECT_EQ(MUST(x_user_defined_decoder->to_utf8("a\x80z"sv)), "a\xef\x9e\x80z"sv);
+}
+
+TEST_CASE(test_multi_byte_decode_of_ascii_input)
+{
+    auto shift_jis_decoder = TextCodec::decoder_for("shift_jis"sv);
+    EXPECT(shift_jis_decoder.has_value());
+    EXPECT_EQ(MUST(shift_jis_decoder->to_utf8("plain ASCII"sv)), "plain ASCII"sv);
+    EXPECT_EQ(MUST(shift_jis_decoder->to_utf8("\x82\xa0 ASCII"sv)), "あ ASCII"sv);
+
+    // ISO-2022-JP is not ASCII compatible, as escape sequences switch between character sets.
+    auto iso_2022_jp_decoder = TextCodec::decoder_for("iso-2022-jp"sv);
+    EXPECT(iso_2022_jp_decoder.has_value());
+    EXPECT_EQ(MUST(iso_2022_jp_decoder->to_utf8("\x1b$B$\"\x1b(B"sv)), "あ"sv);
+}
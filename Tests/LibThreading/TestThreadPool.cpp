@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibThreading/WorkStealingDeque.h>
+
+TEST_CASE(deque_pops_most_recent_and_steals_oldest)
+{
+    Threading::WorkStealingDeque<int> deque { 2 };
+    int values[] = { 1, 2, 3, 4, 5 };
+
+    // Pushing more items than the initial capacity grows the deque.
+    for (auto& value : values)
+        deque.push(&value);
+
+    EXPECT_EQ(*deque.pop(), 5);
+    EXPECT_EQ(*deque.steal(), 1);
+    EXPECT_EQ(*deque.steal(), 2);
+    EXPECT_EQ(*deque.pop(), 4);
+    EXPECT_EQ(*deque.pop(), 3);
+
+    EXPECT(deque.is_empty());
+    EXPECT_EQ(deque.pop(), nullptr);
+    EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_CASE(task_group_waits_for_all_tasks)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> completed_tasks = 0;
+
+    {
+        Threading::TaskGroup group;
+
+        for (size_t i = 0; i < 1000; ++i)
+            group.spawn([&] { completed_tasks.fetch_add(1); });
+
+        group.wait();
+        EXPECT_EQ(completed_tasks.load(), 1000u);
+    }
+}
+
+TEST_CASE(task_groups_may_be_nested)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> completed_tasks = 0;
+
+    Threading::TaskGroup outer_group;
+
+    for (size_t i = 0; i < 16; ++i) {
+        outer_group.spawn([&] {
+            Threading::TaskGroup inner_group;
+
+            for (size_t j = 0; j < 16; ++j)
+                inner_group.spawn([&] { completed_tasks.fetch_add(1); });
+
+            inner_group.wait();
+        });
+    }
+
+    outer_group.wait();
+    EXPECT_EQ(completed_tasks.load(), 256u);
+}
+
+TEST_CASE(parallel_for_visits_each_index_once)
+{
+    static constexpr size_t count = 10'000;
+
+    Vector<u32> visits;
+    visits.resize(count);
+
+    Threading::ThreadPool::the().parallel_for(count, [&](size_t index) {
+        ++visits[index];
+    });
+
+    for (auto visit_count : visits)
+        EXPECT_EQ(visit_count, 1u);
+
+    // An empty range must not call the callback at all.
+    Threading::ThreadPool::the().parallel_for(0, [&](size_t) { FAIL("Callback invoked for empty range"); });
+}
+
+TEST_CASE(tasks_of_every_priority_are_run)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> completed_tasks = 0;
+
+    for (auto priority : { Threading::ThreadPool::Priority::High, Threading::ThreadPool::Priority::Normal, Threading::ThreadPool::Priority::Low }) {
+        Threading::TaskGroup group { Threading::ThreadPool::the(), priority };
+
+        for (size_t i = 0; i < 100; ++i)
+            group.spawn([&] { completed_tasks.fetch_add(1); });
+    }
+
+    // Task groups wait for their tasks when they are destroyed.
+    EXPECT_EQ(completed_tasks.load(), 300u);
+}
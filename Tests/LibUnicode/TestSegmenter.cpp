@@ -226,3 +226,26 @@ TEST_CASE(out_of_bounds)
         EXPECT(!result.has_value());
     }
 }
+
+TEST_CASE(resegment_utf16_string)
+{
+    auto segmenter = Unicode::Segmenter::create(Unicode::SegmenterGranularity::Grapheme);
+
+    auto text = u"ab"_utf16;
+    segmenter->set_segmented_text(text);
+    EXPECT_EQ(segmenter->next_boundary(0), 1u);
+    EXPECT_EQ(segmenter->next_boundary(1), 2u);
+
+    text = u"a😀b"_utf16;
+    segmenter->set_segmented_text(text);
+    EXPECT_EQ(segmenter->next_boundary(0), 1u);
+    EXPECT_EQ(segmenter->next_boundary(1), 3u);
+    EXPECT_EQ(segmenter->next_boundary(2), 3u);
+    EXPECT_EQ(segmenter->previous_boundary(3), 1u);
+    EXPECT_EQ(segmenter->next_boundary(3), 4u);
+
+    auto second_segmenter = Unicode::Segmenter::create(Unicode::SegmenterGranularity::Grapheme);
+    second_segmenter->set_segmented_text(u"😀😀"_utf16);
+    EXPECT_EQ(second_segmenter->next_boundary(0), 2u);
+    EXPECT_EQ(second_segmenter->next_boundary(2), 4u);
+}
@@ -0,0 +1,8 @@
+// Every workload is generated at the size given by the "n" query parameter.
+const n = parseInt(new URLSearchParams(location.search).get("n") ?? "1000");
+
+function appendStyleSheet(text) {
+    const style = document.createElement("style");
+    style.textContent = text;
+    document.head.appendChild(style);
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/WebAudio/AudioKernels.h>
+
+// These counts cover both the vectorized loops and the scalar loops that handle the remaining samples.
+static constexpr size_t sample_counts[] = { 0, 1, 3, 4, 5, 7, 8, 13, 128, 131 };
+
+static float test_sample(size_t index)
+{
+    return static_cast<float>(static_cast<int>(index * 37 % 101) - 50) / 64.0f;
+}
+
+static Vector<float> test_samples(size_t count, size_t offset = 0)
+{
+    Vector<float> samples;
+    for (size_t i = 0; i < count; ++i)
+        samples.append(test_sample(i + offset));
+    return samples;
+}
+
+TEST_CASE(scale_samples)
+{
+    for (auto count : sample_counts) {
+        auto samples = test_samples(count);
+        Web::WebAudio::scale_samples(samples, 0.75f);
+
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(samples[i], test_sample(i) * 0.75f);
+    }
+}
+
+TEST_CASE(add_scaled_samples)
+{
+    for (auto factor : { 1.0f, 0.5f, -2.0f }) {
+        for (auto count : sample_counts) {
+            auto destination = test_samples(count);
+            auto source = test_samples(count, 7);
+            Web::WebAudio::add_scaled_samples(destination, source, factor);
+
+            for (size_t i = 0; i < count; ++i)
+                EXPECT_EQ(destination[i], test_sample(i) + (test_sample(i + 7) * factor));
+        }
+    }
+}
+
+TEST_CASE(multiply_samples)
+{
+    for (auto count : sample_counts) {
+        auto destination = test_samples(count);
+        auto source = test_samples(count, 3);
+        Web::WebAudio::multiply_samples(destination, source);
+
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(destination[i], test_sample(i) * test_sample(i + 3));
+    }
+}
+
+// Mixes a second of stereo audio from a few hundred sources through a gain each, which is what rendering a large graph
+// mostly consists of.
+BENCHMARK_CASE(mix_many_sources)
+{
+    static constexpr size_t quantum_size = 128;
+    static constexpr size_t source_count = 256;
+    static constexpr size_t quantum_count = 48000 / quantum_size;
+
+    auto source = test_samples(quantum_size * 2);
+    Vector<float> gain_output;
+    gain_output.resize(quantum_size * 2);
+    Vector<float> destination;
+    destination.resize(quantum_size * 2);
+
+    for (size_t quantum = 0; quantum < quantum_count; ++quantum) {
+        destination.span().fill(0.0f);
+        for (size_t i = 0; i < source_count; ++i) {
+            source.span().copy_to(gain_output);
+            Web::WebAudio::scale_samples(gain_output, 1.0f / source_count);
+            Web::WebAudio::add_scaled_samples(destination, gain_output, 1.0f);
+        }
+    }
+
+    EXPECT(destination[0] != 0.0f);
+}
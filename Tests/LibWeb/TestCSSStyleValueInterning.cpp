@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/StyleValues/ColorStyleValue.h>
+#include <LibWeb/CSS/StyleValues/IntegerStyleValue.h>
+#include <LibWeb/CSS/StyleValues/KeywordStyleValue.h>
+#include <LibWeb/CSS/StyleValues/LengthStyleValue.h>
+#include <LibWeb/CSS/StyleValues/NumberStyleValue.h>
+#include <LibWeb/CSS/StyleValues/PercentageStyleValue.h>
+
+namespace Web::CSS {
+
+TEST_CASE(keywords_are_shared)
+{
+    EXPECT_EQ(KeywordStyleValue::create(Keyword::Auto).ptr(), KeywordStyleValue::create(Keyword::Auto).ptr());
+    EXPECT_EQ(KeywordStyleValue::create(Keyword::Inherit).ptr(), KeywordStyleValue::create(Keyword::Inherit).ptr());
+    EXPECT_NE(KeywordStyleValue::create(Keyword::Auto).ptr(), KeywordStyleValue::create(Keyword::None).ptr());
+}
+
+TEST_CASE(equal_dimensions_are_interned)
+{
+    auto length = LengthStyleValue::create(Length::make_px(12));
+    EXPECT_EQ(length.ptr(), LengthStyleValue::create(Length::make_px(12)).ptr());
+    EXPECT_NE(length.ptr(), LengthStyleValue::create(Length(12, LengthUnit::Em)).ptr());
+    EXPECT_NE(length.ptr(), LengthStyleValue::create(Length::make_px(13)).ptr());
+
+    auto percentage = PercentageStyleValue::create(Percentage(50));
+    EXPECT_EQ(percentage.ptr(), PercentageStyleValue::create(Percentage(50)).ptr());
+
+    auto number = NumberStyleValue::create(1.5);
+    EXPECT_EQ(number.ptr(), NumberStyleValue::create(1.5).ptr());
+
+    auto integer = IntegerStyleValue::create(3);
+    EXPECT_EQ(integer.ptr(), IntegerStyleValue::create(3).ptr());
+}
+
+TEST_CASE(numbers_are_interned_by_their_bits)
+{
+    auto nan = NumberStyleValue::create(AK::NaN<double>);
+    EXPECT_EQ(nan.ptr(), NumberStyleValue::create(AK::NaN<double>).ptr());
+
+    EXPECT_NE(NumberStyleValue::create(0.0).ptr(), NumberStyleValue::create(-0.0).ptr());
+}
+
+TEST_CASE(colors_are_interned)
+{
+    auto red = ColorStyleValue::create_from_color(Color(Color::Red), ColorSyntax::Legacy);
+    EXPECT_EQ(red.ptr(), ColorStyleValue::create_from_color(Color(Color::Red), ColorSyntax::Legacy).ptr());
+    EXPECT_NE(red.ptr(), ColorStyleValue::create_from_color(Color(Color::Red), ColorSyntax::Modern).ptr());
+    EXPECT_NE(red.ptr(), ColorStyleValue::create_from_color(Color(Color::Red), ColorSyntax::Legacy, "red"_fly_string).ptr());
+}
+
+TEST_CASE(interned_values_are_not_kept_alive)
+{
+    {
+        auto length = LengthStyleValue::create(Length::make_px(1234.5));
+        EXPECT_EQ(length->ref_count(), 1u);
+    }
+
+    // The released instance must have been removed from the table, or this would hand it out again.
+    auto length = LengthStyleValue::create(Length::make_px(1234.5));
+    EXPECT_EQ(length->ref_count(), 1u);
+    EXPECT_EQ(length->length(), Length::make_px(1234.5));
+}
+
+}
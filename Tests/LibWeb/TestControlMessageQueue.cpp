@@ -10,27 +10,27 @@
 
 TEST_CASE(drain_returns_all_and_clears)
 {
-    Web::WebAudio::ControlMessageQueue queue;
+    auto queue = make_ref_counted<Web::WebAudio::ControlMessageQueue>();
 
-    queue.enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 1.0 });
-    queue.enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 1 }, .when = 2.0 });
+    queue->enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 1.0 });
+    queue->enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 1 }, .when = 2.0 });
 
-    auto batch = queue.drain();
+    auto batch = queue->drain();
     EXPECT_EQ(batch.size(), 2u);
 
-    auto empty = queue.drain();
+    auto empty = queue->drain();
     EXPECT_EQ(empty.size(), 0u);
 }
 
 TEST_CASE(drain_preserves_first_in_first_out)
 {
-    Web::WebAudio::ControlMessageQueue queue;
+    auto queue = make_ref_counted<Web::WebAudio::ControlMessageQueue>();
 
-    queue.enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 1.0 });
-    queue.enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 1 }, .when = 2.0 });
-    queue.enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 2 }, .when = 3.0 });
+    queue->enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 1.0 });
+    queue->enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 1 }, .when = 2.0 });
+    queue->enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 2 }, .when = 3.0 });
 
-    auto batch = queue.drain();
+    auto batch = queue->drain();
     EXPECT_EQ(batch.size(), 3u);
 
     EXPECT(batch[0].has<Web::WebAudio::StartSource>());
@@ -45,3 +45,25 @@ TEST_CASE(drain_preserves_first_in_first_out)
     EXPECT_EQ(batch[2].get<Web::WebAudio::StartSource>().when, 3.0);
     EXPECT_EQ(batch[2].get<Web::WebAudio::StartSource>().node_id, Web::WebAudio::NodeID { 2 });
 }
+
+TEST_CASE(drain_preserves_first_in_first_out_past_capacity)
+{
+    auto queue = make_ref_counted<Web::WebAudio::ControlMessageQueue>();
+
+    auto message_count = Web::WebAudio::ControlMessageQueue::capacity * 2 + 3;
+    for (size_t i = 0; i < message_count; ++i)
+        queue->enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { i }, .when = 1.0 });
+
+    size_t drained_count = 0;
+    queue->drain([&](Web::WebAudio::ControlMessage message) {
+        EXPECT(message.has<Web::WebAudio::StartSource>());
+        EXPECT_EQ(message.get<Web::WebAudio::StartSource>().node_id, Web::WebAudio::NodeID { drained_count });
+        ++drained_count;
+    });
+    EXPECT_EQ(drained_count, message_count);
+
+    queue->enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 2.0 });
+    auto batch = queue->drain();
+    EXPECT_EQ(batch.size(), 1u);
+    EXPECT(batch[0].has<Web::WebAudio::StopSource>());
+}
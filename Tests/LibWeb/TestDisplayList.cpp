@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+namespace Web::Painting {
+
+TEST_CASE(remove_empty_saves)
+{
+    auto display_list = DisplayList::create(AccumulatedVisualContextTree::create());
+    display_list->append(Save {}, {});
+    display_list->append(AddClipRect { .rect = { 0, 0, 10, 10 } }, {});
+    display_list->append(Save {}, {});
+    display_list->append(Translate { .delta = { 5, 5 } }, {});
+    display_list->append(Restore {}, {});
+    display_list->append(Restore {}, {});
+    display_list->append(Save {}, {});
+    display_list->append(FillRect { .rect = { 0, 0, 10, 10 }, .color = Color::Red }, {});
+    display_list->append(Restore {}, {});
+    display_list->remove_redundant_commands();
+
+    auto const& commands = display_list->commands();
+    EXPECT_EQ(commands.size(), 3u);
+    EXPECT(commands[0].command.has<Save>());
+    EXPECT(commands[1].command.has<FillRect>());
+    EXPECT(commands[2].command.has<Restore>());
+}
+
+TEST_CASE(merge_fill_rects)
+{
+    auto display_list = DisplayList::create(AccumulatedVisualContextTree::create());
+    auto translucent_red = Color(255, 0, 0, 128);
+    display_list->append(FillRect { .rect = { 0, 0, 10, 10 }, .color = translucent_red }, {});
+    display_list->append(FillRect { .rect = { 10, 0, 5, 10 }, .color = translucent_red }, {});
+    display_list->append(FillRect { .rect = { 0, 10, 15, 5 }, .color = translucent_red }, {});
+    // Overlapping translucent fills must both be painted.
+    display_list->append(FillRect { .rect = { 5, 5, 20, 20 }, .color = translucent_red }, {});
+    // An opaque fill hides the fill underneath it.
+    display_list->append(FillRect { .rect = { 5, 5, 30, 30 }, .color = Color::Blue }, {});
+    display_list->append(FillRect { .rect = { 10, 10, 5, 5 }, .color = Color::Blue }, {});
+    display_list->remove_redundant_commands();
+
+    auto const& commands = display_list->commands();
+    EXPECT_EQ(commands.size(), 2u);
+    EXPECT_EQ(commands[0].command.get<FillRect>().rect, Gfx::IntRect(0, 0, 15, 15));
+    EXPECT_EQ(commands[1].command.get<FillRect>().rect, Gfx::IntRect(5, 5, 30, 30));
+    EXPECT_EQ(commands[1].command.get<FillRect>().color, Color::Blue);
+}
+
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayListSerialization.h>
+
+namespace Web::Painting {
+
+static String dump_display_list(DisplayList const& display_list)
+{
+    StringBuilder builder;
+    for (auto const& item : display_list.commands()) {
+        display_list.visual_context_tree().dump(item.context_index, builder);
+        item.command.visit([&](auto const& command) {
+            builder.appendff("{}", command.command_name);
+            command.dump(builder);
+        });
+        builder.append('\n');
+    }
+    return builder.to_string_without_validation();
+}
+
+static NonnullRefPtr<DisplayList> create_display_list()
+{
+    auto visual_context_tree = AccumulatedVisualContextTree::create();
+    auto clip = visual_context_tree->append(ClipData { { 0, 0, 100, 80 }, {} }, {});
+    auto transform = visual_context_tree->append(TransformData { Gfx::FloatMatrix4x4::identity(), { 10, 20 } }, clip);
+
+    auto nested_display_list = DisplayList::create(AccumulatedVisualContextTree::create());
+    nested_display_list->append(FillRect { .rect = { 1, 2, 3, 4 }, .color = Color::Blue }, {});
+
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 2, 2 }));
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 0; x < 2; ++x)
+            bitmap->set_pixel(x, y, x == y ? Color::Red : Color::Green);
+    }
+
+    Gfx::Path path;
+    path.move_to({ 0, 0 });
+    path.line_to({ 50, 0 });
+    path.quadratic_bezier_curve_to({ 50, 50 }, { 0, 50 });
+    path.close();
+
+    LinearGradientData gradient_data { 90, { .list = { { Color::Red, 0 }, { Color::Blue, 1 } } }, CSS::RectangularColorSpace::Oklab };
+
+    auto display_list = DisplayList::create(visual_context_tree);
+    display_list->append(FillRect { .rect = { 0, 0, 10, 10 }, .color = Color::Red }, {});
+    display_list->append(Save {}, clip);
+    display_list->append(AddClipRect { .rect = { 5, 5, 20, 20 } }, clip);
+    display_list->append(FillPath { .path_bounding_rect = { 0, 0, 50, 50 }, .path = path, .paint_style_or_color = Color::Yellow, .winding_rule = Gfx::WindingRule::EvenOdd }, transform);
+    display_list->append(PaintLinearGradient { .gradient_rect = { 0, 0, 40, 40 }, .linear_gradient_data = gradient_data }, transform);
+    display_list->append(DrawScaledImmutableBitmap { .dst_rect = { 0, 0, 4, 4 }, .clip_rect = { 0, 0, 4, 4 }, .bitmap = Gfx::ImmutableBitmap::create(bitmap), .scaling_mode = Gfx::ScalingMode::NearestNeighbor }, transform);
+    display_list->append(PaintNestedDisplayList { .display_list = nested_display_list, .rect = { 0, 0, 10, 10 } }, clip);
+    display_list->append(Restore {}, clip);
+    return display_list;
+}
+
+TEST_CASE(round_trip)
+{
+    auto display_list = create_display_list();
+
+    ScrollStateSnapshotByDisplayList scroll_state_snapshot_by_display_list;
+    scroll_state_snapshot_by_display_list.set(display_list, ScrollStateSnapshot::create_from_device_offsets({ {}, { 0, 120 } }));
+
+    auto bytes = MUST(serialize_display_list(*display_list, scroll_state_snapshot_by_display_list));
+    auto deserialized = MUST(deserialize_display_list(bytes));
+
+    EXPECT_EQ(dump_display_list(*deserialized.display_list), dump_display_list(*display_list));
+
+    auto scroll_state_snapshot = deserialized.scroll_state_snapshot_by_display_list.get(deserialized.display_list);
+    EXPECT(scroll_state_snapshot.has_value());
+    EXPECT_EQ(scroll_state_snapshot->device_offset_for_index(ScrollFrameIndex { 1 }), Gfx::FloatPoint(0, 120));
+
+    auto const& nested = deserialized.display_list->commands()[6].command.get<PaintNestedDisplayList>();
+    auto const& original_nested = display_list->commands()[6].command.get<PaintNestedDisplayList>();
+    EXPECT_EQ(dump_display_list(*nested.display_list), dump_display_list(*original_nested.display_list));
+
+    auto bitmap = deserialized.display_list->commands()[5].command.get<DrawScaledImmutableBitmap>().bitmap->bitmap();
+    EXPECT_EQ(bitmap->get_pixel(0, 1), Color::Green);
+    EXPECT_EQ(bitmap->get_pixel(1, 1), Color::Red);
+}
+
+TEST_CASE(malformed_input)
+{
+    auto display_list = create_display_list();
+    auto bytes = MUST(serialize_display_list(*display_list, {}));
+
+    EXPECT(deserialize_display_list(bytes.bytes().trim(bytes.size() - 1)).is_error());
+    EXPECT(deserialize_display_list(bytes.bytes().slice(1)).is_error());
+
+    auto corrupted = bytes;
+    corrupted[0] ^= 0xff;
+    EXPECT(deserialize_display_list(corrupted).is_error());
+}
+
+}
@@ -6,6 +6,7 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/Utf32View.h>
 #include <LibCore/File.h>
 #include <LibWeb/HTML/Parser/HTMLTokenizer.h>
 
@@ -161,6 +162,18 @@ TEST_CASE(double_quoted_attributes)
     END_ENUMERATION();
 }
 
+TEST_CASE(long_quoted_attributes)
+{
+    auto tokens = run_tokenizer("<p title=\"a long attribute value\" alt='another long one'>"sv);
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_START_TAG_TOKEN(p, 1u, 56u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE_COUNT(2);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(title, "a long attribute value", 3u, 8u, 9u, 33u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(alt, "another long one", 34u, 37u, 38u, 56u);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
 TEST_CASE(valueless_attribute)
 {
     auto tokens = run_tokenizer("<p foo>"sv);
@@ -267,6 +280,45 @@ TEST_CASE(regression)
     EXPECT_EQ(hash, 3657343287u);
 }
 
+TEST_CASE(text_runs)
+{
+    auto input = "<p>Some text that\nspans lines &amp; has a\r\ncharacter reference</p><b>x</b>"sv;
+
+    StringBuilder expected_text;
+    Vector<Token> expected_tags;
+    for (auto& token : run_tokenizer(input)) {
+        if (token.is_character())
+            expected_text.append_code_point(token.code_point());
+        else
+            expected_tags.append(move(token));
+    }
+
+    StringBuilder text;
+    Vector<Token> tags;
+    Tokenizer tokenizer { input, "UTF-8"sv };
+    while (true) {
+        auto maybe_token = tokenizer.next_token();
+        if (!maybe_token.has_value())
+            break;
+        if (!maybe_token->is_character()) {
+            tags.append(maybe_token.release_value());
+            continue;
+        }
+        text.append_code_point(maybe_token->code_point());
+        text.append(Utf32View { tokenizer.consume_text_run_in_data_state(Tokenizer::StopAtInsertionPoint::No) });
+    }
+
+    EXPECT_EQ(text.string_view(), expected_text.string_view());
+    EXPECT_EQ(tags.size(), expected_tags.size());
+    for (size_t i = 0; i < min(tags.size(), expected_tags.size()); ++i) {
+        EXPECT_EQ(tags[i].type(), expected_tags[i].type());
+        EXPECT_EQ(tags[i].start_position().line, expected_tags[i].start_position().line);
+        EXPECT_EQ(tags[i].start_position().column, expected_tags[i].start_position().column);
+        EXPECT_EQ(tags[i].end_position().line, expected_tags[i].end_position().line);
+        EXPECT_EQ(tags[i].end_position().column, expected_tags[i].end_position().column);
+    }
+}
+
 TEST_CASE(ambiguous_ampersand_offset)
 {
     auto tokens = run_tokenizer("&a"sv);
@@ -10,6 +10,7 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
 #include <LibCore/System.h>
+#include <LibFileSystem/FileSystem.h>
 
 namespace TestWeb {
 
@@ -46,6 +47,11 @@ void Application::create_platform_arguments(Core::ArgsParser& args_parser)
     args_parser.add_option(shuffle, "Shuffle the order of tests before running them", "shuffle", 's');
     args_parser.add_option(per_test_timeout_in_seconds, "Per-test timeout (default: 30)", "per-test-timeout", 't', "seconds");
 
+    args_parser.add_option(perf_corpus_path, "Measure how long it takes to load the pages of the given corpus, instead of running tests", "perf", 0, "path");
+    args_parser.add_option(perf_baseline_path, "Fail if a performance run regressed against the given results", "perf-baseline", 0, "path");
+    args_parser.add_option(perf_iterations, "Number of times to load each page of a performance run (default: 5)", "perf-iterations", 0, "n");
+    args_parser.add_option(perf_regression_threshold_percent, "Percentage by which a metric may regress against the baseline (default: 10)", "perf-threshold", 0, "percent");
+
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
         .help_string = "Log extra information about test results (use multiple times for more information)",
@@ -83,6 +89,16 @@ void Application::create_platform_options(WebView::BrowserOptions& browser_optio
     // Ensure consistent time zone operations across different machine configurations.
     web_content_options.default_time_zone = "UTC"sv;
 
+    if (!perf_corpus_path.is_empty()) {
+        // Serve the pages of the corpus from disk, so that every run loads exactly the same resources.
+        auto resource_map_path = LexicalPath::join(perf_corpus_path, "resource-map.json"sv).string();
+        if (!request_server_options.resource_substitution_map_path.has_value() && FileSystem::exists(resource_map_path))
+            request_server_options.resource_substitution_map_path = move(resource_map_path);
+
+        // Every page load should be measured as a cold one.
+        request_server_options.http_disk_cache_mode = WebView::HTTPDiskCacheMode::Disabled;
+    }
+
     if (dump_gc_graph) {
         // Force all tests to run in serial if we are interested in the GC graph.
         test_concurrency = 1;
@@ -22,7 +22,8 @@ public:
 
     virtual void create_platform_arguments(Core::ArgsParser&) override;
     virtual void create_platform_options(WebView::BrowserOptions&, WebView::RequestServerOptions&, WebView::WebContentOptions&) override;
-    virtual bool should_capture_web_content_output() const override { return true; }
+    // NB: Nobody reads the output of the WebContent processes that performance runs use.
+    virtual bool should_capture_web_content_output() const override { return perf_corpus_path.is_empty(); }
 
     ErrorOr<void> launch_test_fixtures();
 
@@ -48,6 +49,11 @@ public:
 
     int per_test_timeout_in_seconds { 30 };
 
+    ByteString perf_corpus_path;
+    ByteString perf_baseline_path;
+    size_t perf_iterations { 5 };
+    double perf_regression_threshold_percent { 10 };
+
     u8 verbosity { 0 };
 };
 
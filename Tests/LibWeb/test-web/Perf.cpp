@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "Perf.h"
+#include "Application.h"
+#include "TestWebView.h"
+
+#include <AK/AnyOf.h>
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <AK/Math.h>
+#include <AK/QuickSort.h>
+#include <AK/Time.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibURL/Parser.h>
+#include <LibURL/URL.h>
+#include <LibWebView/ProcessManager.h>
+
+namespace TestWeb {
+
+enum class Metric : u8 {
+    TimeToFirstPaint,
+    LoadTime,
+    StyleTime,
+    LayoutTime,
+    PaintTime,
+    GarbageCollectionTime,
+    LongestGarbageCollectionPause,
+    PeakMemoryUsage,
+    IPCMessages,
+    Count,
+};
+
+static constexpr size_t metric_count = to_underlying(Metric::Count);
+using Metrics = Array<double, metric_count>;
+
+struct MetricDefinition {
+    StringView name;
+
+    // The amount by which a metric may grow before it is reported as a regression, no matter the relative threshold.
+    // This keeps the noise in metrics with small values from failing the run.
+    double noise_floor { 0 };
+};
+
+static constexpr Array<MetricDefinition, metric_count> s_metric_definitions { {
+    { "time_to_first_paint_ms"sv, 5 },
+    { "load_ms"sv, 5 },
+    { "style_ms"sv, 2 },
+    { "layout_ms"sv, 2 },
+    { "paint_ms"sv, 2 },
+    { "gc_ms"sv, 2 },
+    { "gc_max_pause_ms"sv, 2 },
+    { "peak_rss_kib"sv, 1024 },
+    { "ipc_messages"sv, 10 },
+} };
+
+static constexpr int memory_sampling_interval_ms = 10;
+
+struct Page {
+    String name;
+    URL::URL url;
+
+    // Synthetic workloads are loaded at several sizes, to see how their cost grows with the size of the document.
+    Optional<String> workload;
+    size_t size { 0 };
+};
+
+// A workload whose style or layout time grows faster than this with its size has likely hit an algorithmic cliff.
+static constexpr double max_scaling_exponent = 1.5;
+
+// Workloads that take less time than this at their largest size are too noisy to tell how their cost grows.
+static constexpr double min_scaling_time_ms = 10;
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+}
+
+static ErrorOr<JsonValue> read_json_file(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+    return JsonValue::from_string(contents);
+}
+
+// The corpus is a directory with a pages.json file, which lists the pages to load:
+//
+//     { "pages": [ { "name": "wikipedia-article", "url": "https://en.wikipedia.org/wiki/Web_browser" } ] }
+//
+// The pages themselves are served from a resource-map.json file next to it (see RequestServer's resource substitution
+// map), so that every run loads exactly the same resources, without ever touching the network. URLs may also be relative
+// to the corpus directory, for pages that are part of the corpus itself.
+//
+// Synthetic workloads list the sizes to generate them at, which they are given as the "n" query parameter:
+//
+//     { "pages": [ { "name": "wide-flex", "url": "wide-flex.html", "sizes": [ 500, 1000, 2000 ] } ] }
+static ErrorOr<Vector<Page>> load_corpus(StringView corpus_path)
+{
+    auto base_url = URL::create_with_file_scheme(ByteString::formatted("{}/", corpus_path));
+    VERIFY(base_url.has_value());
+
+    auto json = TRY(read_json_file(LexicalPath::join(corpus_path, "pages.json"sv).string()));
+    if (!json.is_object())
+        return Error::from_string_literal("Performance corpus must be a JSON object");
+
+    auto pages_array = json.as_object().get_array("pages"sv);
+    if (!pages_array.has_value())
+        return Error::from_string_literal("Performance corpus must contain a 'pages' array");
+
+    Vector<Page> pages;
+
+    for (auto const& entry : pages_array->values()) {
+        if (!entry.is_object())
+            return Error::from_string_literal("Performance corpus pages must be JSON objects");
+
+        auto name = entry.as_object().get_string("name"sv);
+        auto url_string = entry.as_object().get_string("url"sv);
+        if (!name.has_value() || !url_string.has_value())
+            return Error::from_string_literal("Performance corpus pages must have a 'name' and a 'url'");
+
+        auto url = URL::Parser::basic_parse(*url_string, *base_url);
+        if (!url.has_value())
+            return Error::from_string_literal("Performance corpus page has an invalid URL");
+
+        auto sizes = entry.as_object().get_array("sizes"sv);
+        if (!sizes.has_value()) {
+            pages.append({ .name = *name, .url = url.release_value() });
+            continue;
+        }
+
+        for (auto const& size_value : sizes->values()) {
+            if (!size_value.is_integer<size_t>() || size_value.as_integer<size_t>() == 0)
+                return Error::from_string_literal("Performance corpus workload sizes must be positive integers");
+            auto size = size_value.as_integer<size_t>();
+
+            auto sized_url = *url;
+            sized_url.set_query(MUST(String::formatted("n={}", size)));
+
+            pages.append({
+                .name = MUST(String::formatted("{}?n={}", *name, size)),
+                .url = move(sized_url),
+                .workload = *name,
+                .size = size,
+            });
+        }
+    }
+
+    return pages;
+}
+
+static void add_trace_events_to_metrics(JsonValue const& trace, pid_t web_content_pid, Metrics& metrics)
+{
+    if (!trace.is_object())
+        return;
+
+    auto events = trace.as_object().get_array("traceEvents"sv);
+    if (!events.has_value())
+        return;
+
+    auto own_pid = Core::System::getpid();
+
+    for (auto const& event_value : events->values()) {
+        if (!event_value.is_object())
+            continue;
+
+        auto const& event = event_value.as_object();
+        auto category = event.get_string("cat"sv);
+        auto phase = event.get_string("ph"sv);
+        auto pid = event.get_i32("pid"sv);
+        if (!category.has_value() || !phase.has_value() || !pid.has_value() || *phase != "X"sv)
+            continue;
+
+        // NB: The messages we send ourselves are left out, as they include the ones that collect the trace.
+        if (*category == "ipc.send"sv) {
+            if (*pid != own_pid)
+                metrics[to_underlying(Metric::IPCMessages)] += 1;
+            continue;
+        }
+
+        if (*pid != web_content_pid)
+            continue;
+
+        // Trace event durations are in microseconds.
+        auto duration = event.get_double_with_precision_loss("dur"sv).value_or(0) / 1000.0;
+
+        // NB: Layout durations include the style updates they cause, as those are nested in them.
+        if (*category == "style"sv) {
+            metrics[to_underlying(Metric::StyleTime)] += duration;
+        } else if (*category == "layout"sv) {
+            metrics[to_underlying(Metric::LayoutTime)] += duration;
+        } else if (*category == "paint"sv) {
+            metrics[to_underlying(Metric::PaintTime)] += duration;
+        } else if (*category == "gc"sv) {
+            metrics[to_underlying(Metric::GarbageCollectionTime)] += duration;
+            metrics[to_underlying(Metric::LongestGarbageCollectionPause)] = max(metrics[to_underlying(Metric::LongestGarbageCollectionPause)], duration);
+        }
+    }
+}
+
+static ErrorOr<Metrics> measure_page_load(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size, Page const& page)
+{
+    auto& app = Application::the();
+
+    // Every load gets a WebContent process of its own, so that it isn't sped up by anything an earlier load cached, and
+    // so that its peak memory usage is its own.
+    auto view = TestWebView::create(theme, window_size);
+
+    // As with tests, we need to wait for the initial about:blank load to complete before loading the page.
+    bool did_load_initial_page = false;
+    view->on_load_finish = [&](auto const&) { did_load_initial_page = true; };
+    Core::EventLoop::current().spin_until([&]() { return did_load_initial_page; });
+    view->reset_zoom();
+
+    bool did_start_loading = false;
+    bool did_time_out = false;
+    Optional<MonotonicTime> first_paint_time;
+    Optional<MonotonicTime> load_finish_time;
+
+    view->on_load_start = [&](auto const&, bool) { did_start_loading = true; };
+    view->on_ready_to_paint = [&]() {
+        if (did_start_loading && !first_paint_time.has_value())
+            first_paint_time = MonotonicTime::now();
+    };
+    view->on_load_finish = [&](auto const&) {
+        if (did_start_loading && !load_finish_time.has_value())
+            load_finish_time = MonotonicTime::now();
+    };
+
+    auto web_content_pid = view->web_content_pid();
+    u64 peak_memory_usage = 0;
+
+    auto sample_memory_usage = [&]() {
+        auto& process_manager = Application::process_manager();
+        process_manager.update_all_process_statistics();
+
+        if (auto memory_usage = process_manager.memory_usage_of_process(web_content_pid); memory_usage.has_value())
+            peak_memory_usage = max(peak_memory_usage, *memory_usage);
+    };
+
+    auto memory_sampling_timer = Core::Timer::create_repeating(memory_sampling_interval_ms, sample_memory_usage);
+    auto timeout_timer = Core::Timer::create_single_shot(app.per_test_timeout_in_seconds * 1000, [&]() { did_time_out = true; });
+
+    app.start_recording_trace();
+    memory_sampling_timer->start();
+    timeout_timer->start();
+
+    auto start_time = MonotonicTime::now();
+    view->load(page.url);
+
+    Core::EventLoop::current().spin_until([&]() {
+        return did_time_out || (first_paint_time.has_value() && load_finish_time.has_value());
+    });
+
+    timeout_timer->stop();
+    memory_sampling_timer->stop();
+    sample_memory_usage();
+
+    auto trace = app.stop_recording_trace();
+
+    if (did_time_out)
+        return Error::from_string_literal("Timed out while loading page");
+
+    Metrics metrics {};
+    metrics[to_underlying(Metric::TimeToFirstPaint)] = to_milliseconds(*first_paint_time - start_time);
+    metrics[to_underlying(Metric::LoadTime)] = to_milliseconds(*load_finish_time - start_time);
+    metrics[to_underlying(Metric::PeakMemoryUsage)] = static_cast<double>(peak_memory_usage / KiB);
+
+    add_trace_events_to_metrics(TRY(JsonValue::from_string(trace)), web_content_pid, metrics);
+    return metrics;
+}
+
+static double median(Vector<double>& values)
+{
+    VERIFY(!values.is_empty());
+    quick_sort(values);
+
+    auto middle = values.size() / 2;
+    if (values.size() % 2 == 0)
+        return (values[middle - 1] + values[middle]) / 2;
+    return values[middle];
+}
+
+static JsonObject metrics_to_json(Metrics const& metrics)
+{
+    JsonObject object;
+    for (size_t i = 0; i < metric_count; ++i)
+        object.set(s_metric_definitions[i].name, metrics[i]);
+    return object;
+}
+
+static size_t report_regressions(StringView page_name, Metrics const& metrics, JsonObject const& baseline, double threshold_percent)
+{
+    size_t regression_count = 0;
+
+    for (size_t i = 0; i < metric_count; ++i) {
+        auto const& definition = s_metric_definitions[i];
+
+        auto baseline_value = baseline.get_double_with_precision_loss(definition.name);
+        if (!baseline_value.has_value())
+            continue;
+
+        auto difference = metrics[i] - *baseline_value;
+        if (difference <= definition.noise_floor || difference <= *baseline_value * threshold_percent / 100)
+            continue;
+
+        auto percentage = *baseline_value > 0 ? difference / *baseline_value * 100 : 100.0;
+        outln("\033[31;1mRegression:\033[0m {} {}: {:.1} -> {:.1} (+{:.1}%)", page_name, definition.name, *baseline_value, metrics[i], percentage);
+        ++regression_count;
+    }
+
+    return regression_count;
+}
+
+struct ScalingSample {
+    size_t size { 0 };
+    Metrics metrics;
+};
+
+// Reports how the style and layout time per element of a workload change as it grows. If the time grows by more than
+// a power of max_scaling_exponent of the size between two sizes, the workload is reported as scaling superlinearly.
+static size_t report_scaling(StringView workload, Vector<ScalingSample>& samples, JsonObject& scaling_results)
+{
+    static constexpr Array scaling_metrics { Metric::StyleTime, Metric::LayoutTime };
+
+    quick_sort(samples, [](auto const& a, auto const& b) { return a.size < b.size; });
+
+    outln("{} scaling:", workload);
+    outln("    {:>8} {:>18} {:>18}", "n", "style µs/element", "layout µs/element");
+
+    JsonArray results;
+    for (auto const& sample : samples) {
+        auto per_element = [&](Metric metric) { return sample.metrics[to_underlying(metric)] * 1000 / static_cast<double>(sample.size); };
+        outln("    {:>8} {:>18.3} {:>18.3}", sample.size, per_element(Metric::StyleTime), per_element(Metric::LayoutTime));
+
+        JsonObject result;
+        result.set("n"sv, sample.size);
+        for (auto metric : scaling_metrics) {
+            result.set(s_metric_definitions[to_underlying(metric)].name, sample.metrics[to_underlying(metric)]);
+            result.set(MUST(String::formatted("{}_per_element", s_metric_definitions[to_underlying(metric)].name)), per_element(metric));
+        }
+        results.must_append(move(result));
+    }
+    scaling_results.set(workload, move(results));
+
+    size_t superlinear_count = 0;
+    for (size_t i = 1; i < samples.size(); ++i) {
+        auto const& smaller = samples[i - 1];
+        auto const& larger = samples[i];
+        if (smaller.size == larger.size)
+            continue;
+
+        for (auto metric : scaling_metrics) {
+            auto smaller_time = smaller.metrics[to_underlying(metric)];
+            auto larger_time = larger.metrics[to_underlying(metric)];
+            if (smaller_time <= 0 || larger_time < min_scaling_time_ms)
+                continue;
+
+            auto exponent = AK::log2(larger_time / smaller_time) / AK::log2(static_cast<double>(larger.size) / static_cast<double>(smaller.size));
+            if (exponent <= max_scaling_exponent)
+                continue;
+
+            outln("\033[31;1mSuperlinear scaling:\033[0m {} {} grows with n^{:.2} from n={} to n={}", workload, s_metric_definitions[to_underlying(metric)].name, exponent, smaller.size, larger.size);
+            ++superlinear_count;
+        }
+    }
+
+    return superlinear_count;
+}
+
+ErrorOr<int> run_performance_tests(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size)
+{
+    auto& app = Application::the();
+
+    auto pages = TRY(load_corpus(app.perf_corpus_path));
+
+    if (!app.test_globs.is_empty()) {
+        pages.remove_all_matching([&](Page const& page) {
+            return !any_of(app.test_globs, [&](auto const& glob) {
+                return page.name.bytes_as_string_view().matches(ByteString::formatted("*{}*", glob), CaseSensitivity::CaseSensitive);
+            });
+        });
+    }
+
+    if (pages.is_empty())
+        return Error::from_string_literal("No pages found in the performance corpus");
+    if (app.perf_iterations == 0)
+        return Error::from_string_literal("At least one iteration is required");
+
+    Optional<JsonObject> baseline_pages;
+    if (!app.perf_baseline_path.is_empty()) {
+        auto baseline = TRY(read_json_file(app.perf_baseline_path));
+        if (!baseline.is_object() || !baseline.as_object().has_object("pages"sv))
+            return Error::from_string_literal("Performance baseline must contain a 'pages' object");
+        baseline_pages = *baseline.as_object().get_object("pages"sv);
+    }
+
+    JsonObject result_pages;
+    size_t regression_count = 0;
+
+    // NB: Workloads are kept in the order in which they first appear in the corpus.
+    Vector<String> workloads;
+    HashMap<String, Vector<ScalingSample>> scaling_samples;
+
+    for (auto const& page : pages) {
+        Array<Vector<double>, metric_count> samples;
+
+        for (size_t iteration = 0; iteration < app.perf_iterations; ++iteration) {
+            auto metrics = measure_page_load(theme, window_size, page);
+            if (metrics.is_error()) {
+                warnln("\033[31;1mFailed to measure {}:\033[0m {}", page.name, metrics.error());
+                return 1;
+            }
+
+            for (size_t i = 0; i < metric_count; ++i)
+                samples[i].append(metrics.value()[i]);
+        }
+
+        // The median is used rather than the mean, so that a single outlier (e.g. a page load that was descheduled)
+        // doesn't skew the results.
+        Metrics metrics {};
+        for (size_t i = 0; i < metric_count; ++i)
+            metrics[i] = median(samples[i]);
+
+        outln("{}:", page.name);
+        for (size_t i = 0; i < metric_count; ++i)
+            outln("    {:<24} {:.1}", s_metric_definitions[i].name, metrics[i]);
+
+        if (baseline_pages.has_value()) {
+            if (auto page_baseline = baseline_pages->get_object(page.name); page_baseline.has_value())
+                regression_count += report_regressions(page.name, metrics, *page_baseline, app.perf_regression_threshold_percent);
+        }
+
+        result_pages.set(page.name, metrics_to_json(metrics));
+
+        if (page.workload.has_value()) {
+            auto& samples_for_workload = scaling_samples.ensure(*page.workload, [&] {
+                workloads.append(*page.workload);
+                return Vector<ScalingSample> {};
+            });
+            samples_for_workload.append({ page.size, metrics });
+        }
+    }
+
+    JsonObject scaling_results;
+    size_t superlinear_count = 0;
+    for (auto const& workload : workloads)
+        superlinear_count += report_scaling(workload, scaling_samples.find(workload)->value, scaling_results);
+
+    JsonObject results;
+    results.set("iterations"sv, app.perf_iterations);
+    results.set("pages"sv, move(result_pages));
+    if (!workloads.is_empty())
+        results.set("scaling"sv, move(scaling_results));
+
+    auto results_path = LexicalPath::join(app.results_directory, "perf-results.json"sv);
+    auto results_file = TRY(Core::File::open(results_path.string(), Core::File::OpenMode::Write));
+    TRY(results_file->write_until_depleted(results.serialized().bytes()));
+    outln("Wrote performance results to {}", results_path);
+
+    if (regression_count > 0)
+        outln("\033[31;1m{} metric(s) regressed by more than {}% against the baseline\033[0m", regression_count, app.perf_regression_threshold_percent);
+    if (superlinear_count > 0)
+        outln("\033[31;1m{} metric(s) of synthetic workloads scaled superlinearly\033[0m", superlinear_count);
+
+    return regression_count > 0 || superlinear_count > 0 ? 1 : 0;
+}
+
+}
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibWeb/PixelUnits.h>
+
+namespace TestWeb {
+
+// Loads every page of the performance corpus a number of times, and reports how long it took to load, style, lay out
+// and paint them, along with how much memory and IPC traffic that took. If a baseline is given, any metric that got
+// worse than the baseline by more than the regression threshold is reported as a failure.
+ErrorOr<int> run_performance_tests(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size);
+
+}
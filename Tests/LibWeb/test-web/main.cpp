@@ -10,6 +10,7 @@
 
 #include "Application.h"
 #include "Debug.h"
+#include "Perf.h"
 #include "TestWeb.h"
 #include "TestWebView.h"
 
@@ -1848,6 +1849,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     app->results_directory = LexicalPath::absolute_path(TRY(FileSystem::current_working_directory()), app->results_directory);
     TRY(Core::Directory::create(app->results_directory, Core::Directory::CreateDirectories::Yes));
 
+    if (!app->perf_corpus_path.is_empty()) {
+        app->perf_corpus_path = LexicalPath::absolute_path(TRY(FileSystem::current_working_directory()), app->perf_corpus_path);
+        return TestWeb::run_performance_tests(theme, window_size);
+    }
+
     TRY(app->launch_test_fixtures());
 
     return TestWeb::run_tests(theme, window_size);
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibURL/Parser.h>
+#include <LibWebView/SiteIsolation.h>
+
+static Optional<String> site_for_url(StringView url)
+{
+    auto parsed_url = URL::Parser::basic_parse(url);
+    VERIFY(parsed_url.has_value());
+
+    return WebView::site_for_process_consolidation(*parsed_url);
+}
+
+TEST_CASE(site_for_process_consolidation)
+{
+    EXPECT_EQ(site_for_url("https://example.com/"sv), "https://example.com"sv);
+    EXPECT_EQ(site_for_url("https://www.example.com/path?query#fragment"sv), "https://example.com"sv);
+    EXPECT_EQ(site_for_url("https://a.b.example.co.uk:8443/"sv), "https://example.co.uk"sv);
+    EXPECT_EQ(site_for_url("http://example.com/"sv), "http://example.com"sv);
+    EXPECT_EQ(site_for_url("http://127.0.0.1:8080/"sv), "http://127.0.0.1"sv);
+
+    EXPECT(!site_for_url("about:blank"sv).has_value());
+    EXPECT(!site_for_url("file:///home/user/index.html"sv).has_value());
+    EXPECT(!site_for_url("data:text/html,hello"sv).has_value());
+}
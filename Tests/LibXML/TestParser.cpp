@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/StringBuilder.h>
 #include <LibTest/TestCase.h>
 #include <LibXML/Parser/Parser.h>
 
@@ -45,3 +46,28 @@ TEST_CASE(unicode_name)
     XML::Parser parser("<div 中文=\"\"></div>"sv);
     TRY_OR_FAIL(parser.parse());
 }
+
+TEST_CASE(source_larger_than_one_chunk)
+{
+    StringBuilder builder;
+    builder.append("<root xmlns:svg=\"http://www.w3.org/2000/svg\">"sv);
+    for (size_t i = 0; i < 20'000; ++i)
+        builder.appendff("<svg:rect svg:width=\"{}\"/>", i);
+    builder.append(ByteString::repeated('x', 100'000));
+    builder.append("</root>"sv);
+
+    XML::Parser parser(builder.string_view());
+    auto document = MUST(parser.parse());
+
+    auto const& root = document.root().content.get<XML::Node::Element>();
+    EXPECT_EQ(root.name, "root");
+    EXPECT_EQ(root.attributes.get("xmlns:svg"sv).value(), "http://www.w3.org/2000/svg"sv);
+    EXPECT_EQ(root.children.size(), 20'001u);
+
+    auto const& last_rect = root.children[19'999]->content.get<XML::Node::Element>();
+    EXPECT_EQ(last_rect.name, "svg:rect");
+    EXPECT_EQ(last_rect.attributes.get("svg:width"sv).value(), "19999"sv);
+
+    auto const& text = root.children.last()->content.get<XML::Node::Text>();
+    EXPECT_EQ(text.builder.length(), 100'000u);
+}
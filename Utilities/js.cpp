@@ -7,12 +7,19 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/Math.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/StandardPaths.h>
+#include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
@@ -22,6 +29,8 @@
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/SharedFunctionInstanceData.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/RustFFI.h>
@@ -89,6 +98,7 @@ private:
 GC_DEFINE_ALLOCATOR(ScriptObject);
 
 static bool s_dump_ast = false;
+static bool s_dump_lazy_compilation_statistics = false;
 static bool s_as_module = false;
 static bool s_print_last_result = false;
 static bool s_strip_ansi = false;
@@ -834,6 +844,255 @@ static ErrorOr<int> run_repl(bool gc_on_every_allocation, bool syntax_highlight)
 
 #endif
 
+static ErrorOr<ByteString> read_script_file(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto file_contents = TRY(file->read_until_eof());
+    auto source = StringView { file_contents };
+
+    if (Utf8View { file_contents }.validate())
+        return ByteString { source };
+
+    auto decoder = TextCodec::decoder_for("windows-1252"sv);
+    VERIFY(decoder.has_value());
+
+    auto utf8_source = TRY(TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*decoder, source));
+    return utf8_source.to_byte_string();
+}
+
+// Summed up over all measured iterations of a benchmark.
+struct GarbageCollectionStatistics {
+    Vector<double> pauses_in_milliseconds;
+    double total_time { 0 };
+    double gather_conservative_roots_time { 0 };
+    u64 allocated_bytes { 0 };
+    size_t peak_live_bytes { 0 };
+};
+
+struct BenchmarkResult {
+    StringView name;
+    Vector<double> samples_in_milliseconds;
+    double mean { 0 };
+    double standard_deviation { 0 };
+    double confidence_interval { 0 };
+    double min { 0 };
+    double max { 0 };
+    GarbageCollectionStatistics garbage_collection;
+};
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+}
+
+// Returns the nearest-rank percentile of the given samples, which must be sorted.
+static double percentile(ReadonlySpan<double> sorted_samples, double percentage)
+{
+    VERIFY(!sorted_samples.is_empty());
+    auto rank = static_cast<size_t>(AK::ceil(percentage / 100 * static_cast<double>(sorted_samples.size())));
+    return sorted_samples[clamp<size_t>(rank, 1, sorted_samples.size()) - 1];
+}
+
+// Two-sided 95% quantiles of Student's t-distribution, indexed by the degrees of freedom minus one.
+static constexpr Array<double, 30> s_student_t_95_quantiles {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+};
+
+static double student_t_95_quantile(size_t degrees_of_freedom)
+{
+    VERIFY(degrees_of_freedom > 0);
+    if (degrees_of_freedom <= s_student_t_95_quantiles.size())
+        return s_student_t_95_quantiles[degrees_of_freedom - 1];
+    // NB: With more degrees of freedom than that, the normal distribution is a close enough approximation.
+    return 1.960;
+}
+
+static void compute_benchmark_statistics(BenchmarkResult& result)
+{
+    auto& samples = result.samples_in_milliseconds;
+    VERIFY(!samples.is_empty());
+
+    double sum = 0;
+    result.min = samples.first();
+    result.max = samples.first();
+    for (auto sample : samples) {
+        sum += sample;
+        result.min = min(result.min, sample);
+        result.max = max(result.max, sample);
+    }
+    result.mean = sum / static_cast<double>(samples.size());
+
+    if (samples.size() < 2)
+        return;
+
+    double sum_of_squared_deviations = 0;
+    for (auto sample : samples)
+        sum_of_squared_deviations += (sample - result.mean) * (sample - result.mean);
+
+    auto degrees_of_freedom = samples.size() - 1;
+    result.standard_deviation = AK::sqrt(sum_of_squared_deviations / static_cast<double>(degrees_of_freedom));
+    result.confidence_interval = student_t_95_quantile(degrees_of_freedom) * result.standard_deviation / AK::sqrt(static_cast<double>(samples.size()));
+}
+
+// Every iteration runs in a realm of its own, so that it can't observe (or be sped up by) the globals of earlier ones.
+// The collections that happen while it runs are added to the given statistics, if any.
+static ErrorOr<Optional<AK::Duration>> run_benchmark_iteration(StringView source, StringView source_name, bool gc_on_every_allocation, GarbageCollectionStatistics* garbage_collection_statistics)
+{
+    auto root_execution_context = JS::create_simple_execution_context<ScriptObject>(*g_vm);
+    auto& realm = *root_execution_context->realm;
+    auto& console_object = *realm.intrinsics().console_object();
+    ReplConsoleClient console_client(console_object.console());
+    console_object.console().set_client(console_client);
+    g_vm->heap().set_should_collect_on_every_allocation(gc_on_every_allocation);
+
+    auto& heap = g_vm->heap();
+
+    // Start from a clean heap, so that this iteration isn't billed for collecting the garbage of the one before it.
+    heap.collect_garbage();
+
+    auto allocated_bytes_before_running = heap.total_allocated_bytes();
+    if (garbage_collection_statistics) {
+        heap.set_collection_statistics_callback([garbage_collection_statistics](GC::Heap::CollectionStatistics const& collection) {
+            garbage_collection_statistics->pauses_in_milliseconds.append(to_milliseconds(collection.total_time));
+            garbage_collection_statistics->total_time += to_milliseconds(collection.total_time);
+            garbage_collection_statistics->gather_conservative_roots_time += to_milliseconds(collection.gather_conservative_roots_time);
+            garbage_collection_statistics->peak_live_bytes = max(garbage_collection_statistics->peak_live_bytes, collection.live_bytes_after_collection);
+        });
+    }
+
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    auto did_run_successfully = TRY(parse_and_run(realm, source, source_name));
+    auto elapsed_time = timer.elapsed_time();
+
+    heap.set_collection_statistics_callback({});
+    if (garbage_collection_statistics)
+        garbage_collection_statistics->allocated_bytes += heap.total_allocated_bytes() - allocated_bytes_before_running;
+
+    heap.set_should_collect_on_every_allocation(false);
+    g_vm->pop_execution_context();
+
+    if (!did_run_successfully)
+        return OptionalNone {};
+    return Optional<AK::Duration> { elapsed_time };
+}
+
+static ErrorOr<Optional<BenchmarkResult>> run_benchmark(StringView path, size_t warmup_iterations, size_t iterations, bool gc_on_every_allocation)
+{
+    auto source = TRY(read_script_file(path));
+
+    BenchmarkResult result { .name = path };
+    TRY(result.samples_in_milliseconds.try_ensure_capacity(iterations));
+
+    for (size_t i = 0; i < warmup_iterations + iterations; ++i) {
+        // Warmup iterations give the engine a chance to settle (e.g. fill its caches) before we start measuring.
+        bool is_measured = i >= warmup_iterations;
+
+        auto elapsed_time = TRY(run_benchmark_iteration(source, path, gc_on_every_allocation, is_measured ? &result.garbage_collection : nullptr));
+        if (!elapsed_time.has_value())
+            return OptionalNone {};
+
+        if (is_measured)
+            result.samples_in_milliseconds.unchecked_append(to_milliseconds(*elapsed_time));
+    }
+
+    compute_benchmark_statistics(result);
+    quick_sort(result.garbage_collection.pauses_in_milliseconds);
+    return Optional<BenchmarkResult> { move(result) };
+}
+
+static JsonObject benchmark_result_to_json(BenchmarkResult const& result)
+{
+    JsonArray samples;
+    for (auto sample : result.samples_in_milliseconds)
+        samples.must_append(sample);
+
+    JsonObject object;
+    object.set("name"sv, result.name);
+    object.set("iterations"sv, result.samples_in_milliseconds.size());
+    object.set("mean_ms"sv, result.mean);
+    object.set("stddev_ms"sv, result.standard_deviation);
+    object.set("confidence_interval_95_ms"sv, result.confidence_interval);
+    object.set("min_ms"sv, result.min);
+    object.set("max_ms"sv, result.max);
+    object.set("samples_ms"sv, move(samples));
+
+    auto const& garbage_collection = result.garbage_collection;
+    auto const& pauses = garbage_collection.pauses_in_milliseconds;
+    auto total_time = result.mean * static_cast<double>(result.samples_in_milliseconds.size());
+
+    JsonObject garbage_collection_object;
+    garbage_collection_object.set("collections"sv, pauses.size());
+    if (!pauses.is_empty()) {
+        garbage_collection_object.set("pause_p50_ms"sv, percentile(pauses, 50));
+        garbage_collection_object.set("pause_p90_ms"sv, percentile(pauses, 90));
+        garbage_collection_object.set("pause_p99_ms"sv, percentile(pauses, 99));
+        garbage_collection_object.set("pause_max_ms"sv, pauses.last());
+    }
+    garbage_collection_object.set("total_ms"sv, garbage_collection.total_time);
+    garbage_collection_object.set("gather_conservative_roots_ms"sv, garbage_collection.gather_conservative_roots_time);
+    garbage_collection_object.set("allocated_bytes"sv, garbage_collection.allocated_bytes);
+    if (total_time > 0)
+        garbage_collection_object.set("allocated_bytes_per_second"sv, static_cast<double>(garbage_collection.allocated_bytes) * 1000 / total_time);
+    garbage_collection_object.set("peak_live_bytes"sv, garbage_collection.peak_live_bytes);
+    object.set("gc"sv, move(garbage_collection_object));
+
+    return object;
+}
+
+static void print_garbage_collection_statistics(BenchmarkResult const& result)
+{
+    auto const& garbage_collection = result.garbage_collection;
+    auto const& pauses = garbage_collection.pauses_in_milliseconds;
+    auto total_time = result.mean * static_cast<double>(result.samples_in_milliseconds.size());
+
+    if (!pauses.is_empty()) {
+        outln("    GC: {} collections, pauses p50 {:.3}ms, p90 {:.3}ms, p99 {:.3}ms, max {:.3}ms, {:.1}% of run time ({:.3}ms gathering conservative roots)",
+            pauses.size(), percentile(pauses, 50), percentile(pauses, 90), percentile(pauses, 99), pauses.last(),
+            total_time > 0 ? garbage_collection.total_time * 100 / total_time : 0.0, garbage_collection.gather_conservative_roots_time);
+    }
+
+    if (total_time > 0) {
+        outln("    Allocated {:.1} MiB/s, peak live heap after a collection {} KiB",
+            static_cast<double>(garbage_collection.allocated_bytes) * 1000 / total_time / MiB, garbage_collection.peak_live_bytes / KiB);
+    }
+}
+
+static ErrorOr<int> run_benchmarks(Vector<StringView> const& script_paths, size_t warmup_iterations, size_t iterations, StringView json_output_path, bool gc_on_every_allocation)
+{
+    if (iterations == 0) {
+        warnln("At least one benchmark iteration is required");
+        return 1;
+    }
+
+    JsonArray results;
+    for (auto path : script_paths) {
+        auto result = TRY(run_benchmark(path, warmup_iterations, iterations, gc_on_every_allocation));
+        if (!result.has_value()) {
+            warnln("Benchmark {} failed", path);
+            return 1;
+        }
+
+        outln("{}: {:.3}ms ±{:.3}ms (stddev {:.3}ms, min {:.3}ms, max {:.3}ms, {} iterations)",
+            result->name, result->mean, result->confidence_interval, result->standard_deviation, result->min, result->max, iterations);
+        print_garbage_collection_statistics(*result);
+        results.must_append(benchmark_result_to_json(*result));
+    }
+
+    if (!json_output_path.is_empty()) {
+        JsonObject output;
+        output.set("warmup_iterations"sv, warmup_iterations);
+        output.set("iterations"sv, iterations);
+        output.set("benchmarks"sv, move(results));
+
+        auto file = TRY(Core::File::open(json_output_path, Core::File::OpenMode::Write));
+        TRY(file->write_until_depleted(output.serialized().bytes()));
+    }
+
+    return s_exit_code;
+}
+
 ErrorOr<int> ladybird_main(Main::Arguments arguments)
 {
     bool gc_on_every_allocation = false;
@@ -842,6 +1101,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool use_test262_global = false;
     bool parse_only = false;
     StringView evaluate_script;
+    StringView profile_path;
+    bool benchmark = false;
+    size_t benchmark_warmup_iterations = 3;
+    size_t benchmark_iterations = 10;
+    StringView benchmark_json_path;
     Vector<StringView> script_paths;
 
     Core::ArgsParser args_parser;
@@ -849,6 +1113,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(parse_only, "Parse only", "parse-only", 'p');
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_collect_inline_cache_statistics, "Dump inline cache statistics next to the bytecode on exit", "inline-cache-statistics", {});
+    args_parser.add_option(s_dump_lazy_compilation_statistics, "Dump how many functions were compiled or never called on exit", "lazy-compilation-statistics", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -859,6 +1125,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
+    args_parser.add_option(profile_path, "Sample the JavaScript call stack and write a .cpuprofile to the given path on exit", "profile", {}, "path");
+    args_parser.add_option(benchmark, "Run each script as a benchmark, and report how long it took to run", "bench", {});
+    args_parser.add_option(benchmark_warmup_iterations, "Number of benchmark iterations to run before measuring (default: 3)", "bench-warmup", {}, "count");
+    args_parser.add_option(benchmark_iterations, "Number of benchmark iterations to measure (default: 10)", "bench-iterations", {}, "count");
+    args_parser.add_option(benchmark_json_path, "Write the benchmark results as JSON to the given path", "bench-json", {}, "path");
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -895,6 +1166,14 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     // FIXME: Figure out some way to interrupt the interpreter now that vm.exception() is gone.
 
+    if (benchmark) {
+        if (script_paths.is_empty()) {
+            warnln("No benchmark scripts given");
+            return 1;
+        }
+        return run_benchmarks(script_paths, benchmark_warmup_iterations, benchmark_iterations, benchmark_json_path, gc_on_every_allocation);
+    }
+
     if (evaluate_script.is_empty() && script_paths.is_empty()) {
 #if defined(AK_OS_WINDOWS)
         dbgln("REPL functionality is not supported on Windows");
@@ -922,21 +1201,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             if (script_paths.size() > 1)
                 warnln("Warning: Multiple files supplied, this will concatenate the sources and resolve modules as if it was the first file");
 
-            for (auto& path : script_paths) {
-                auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
-                auto file_contents = TRY(file->read_until_eof());
-                auto source = StringView { file_contents };
-
-                if (Utf8View { file_contents }.validate()) {
-                    builder.append(source);
-                } else {
-                    auto decoder = TextCodec::decoder_for("windows-1252"sv);
-                    VERIFY(decoder.has_value());
-
-                    auto utf8_source = TRY(TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*decoder, source));
-                    builder.append(utf8_source);
-                }
-            }
+            for (auto& path : script_paths)
+                builder.append(TRY(read_script_file(path)));
 
             source_name = script_paths[0];
         } else {
@@ -946,7 +1212,23 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only)))
+        if (!profile_path.is_empty())
+            g_vm->start_sampling_profiler(JS::SamplingProfiler::default_interval);
+
+        auto did_run_successfully = TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only));
+
+        if (auto profiler = g_vm->stop_sampling_profiler()) {
+            auto file = TRY(Core::File::open(profile_path, Core::File::OpenMode::Write));
+            TRY(file->write_until_depleted(profiler->to_cpuprofile().serialized().bytes()));
+            warnln("Wrote {} samples to {}", profiler->sample_count(), profile_path);
+        }
+
+        if (JS::Bytecode::g_collect_inline_cache_statistics)
+            JS::Bytecode::dump_inline_cache_statistics(g_vm->heap());
+        if (s_dump_lazy_compilation_statistics)
+            JS::SharedFunctionInstanceData::dump_lazy_compilation_statistics(g_vm->heap());
+
+        if (!did_run_successfully)
             return 1;
     }
 